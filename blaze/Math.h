@@ -46,6 +46,7 @@
 #include <blaze/math/BLAS.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
+#include <blaze/math/CompressedView.h>
 #include <blaze/math/Constraints.h>
 #include <blaze/math/CustomMatrix.h>
 #include <blaze/math/CustomVector.h>
@@ -63,11 +64,19 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MappedArchive.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/math/MatrixBatch.h>
+#include <blaze/math/MatrixMarket.h>
+#include <blaze/math/Npy.h>
 #include <blaze/math/PaddingFlag.h>
 #include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/Reordering.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/SpectrumFlag.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
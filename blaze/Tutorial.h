@@ -1544,6 +1544,31 @@
    max( a - c, c + d );  // Results in ( 0 4 14 6 )
    \endcode
 
+// \n \subsection vector_operations_reduce reduce() / sum() / prod()
+//
+// The \c reduce() function reduces the elements of a dense or sparse vector (or vector
+// expression) to a single value by means of the given binary operation. The \c sum() and
+// \c prod() functions are shortcuts for the reduction by means of addition and multiplication,
+// respectively:
+
+   \code
+   blaze::DynamicVector<double> a, b;
+   // ... Resizing and initialization
+
+   const double s = sum( a );                              // Sum of all elements
+   const double p = prod( a );                             // Product of all elements
+   const double d = reduce( abs( a - b ), blaze::Max() );  // Maximum absolute difference
+   \endcode
+
+// For dense vectors, the reduction is vectorized in case the operation provides a \c load()
+// function (as for instance \c blaze::Add, \c blaze::Mult, \c blaze::Min, and \c blaze::Max)
+// and is executed in parallel for sufficiently large vectors. Vector expressions are evaluated
+// element-wise as part of the reduction, i.e. no temporary vector is created. Since the order
+// of the reduction is unspecified, the given operation is required to be associative and
+// commutative. For sparse vectors \c reduce() and \c sum() only consider the non-zero elements,
+// whereas \c prod() also takes the zero elements into account.
+//
+//
 // \n \subsection vector_operators_abs abs()
 //
 // The \c abs() function can be used to compute the absolute values of each element of a vector.
@@ -1927,6 +1952,35 @@
 // \ref intra_statement_optimization).
 //
 //
+// \n \subsection vector_operations_deferred_scope DeferredScope
+//
+// Each assignment is evaluated immediately and in isolation. Therefore a sequence of several
+// element-wise operations on large dense vectors loads each involved vector several times from
+// main memory. The \c DeferredScope class allows to record several dense vector assignments
+// and reductions and to evaluate them in a single, fused pass over the vectors:
+
+   \code
+   blaze::DynamicVector<double> x, r, d, h;
+   double alpha, beta;
+   // ... Resizing and initialization
+
+   {
+      blaze::DeferredScope scope;
+      scope.addAssign( x, alpha * d );  // Recording x += alpha * d
+      scope.addAssign( r, alpha * h );  // Recording r += alpha * h
+      scope.dot( beta, r, r );          // Recording beta = trans(r) * r
+   }  // Fused evaluation of all three statements
+   \endcode
+
+// The recorded statements are evaluated at the end of the scope or via an explicit call to the
+// \c evaluate() member function. Since a destructor cannot report errors, \c evaluate() should
+// be called explicitly in case errors during the evaluation have to be handled. As the vectors
+// are evaluated block by block, two statements cannot be fused in case one of them accesses the
+// target vector of the other one at different indices, as for instance the operand of a
+// matrix/vector product. In this case, all pending statements are evaluated before the new
+// statement is recorded. Also, all vectors of a scope must have the same size.
+//
+//
 // \n \subsection vector_operations_normalize normalize()
 //
 // The \c normalize() function can be used to scale any non-zero vector to a length of 1. In
@@ -2237,6 +2291,7 @@
 //  -# <b>\ref matrix_types_custom_matrix_copy_operations</b>
 //  -# <b>\ref matrix_types_custom_matrix_alignment</b>
 //  -# <b>\ref matrix_types_custom_matrix_padding</b>
+//  -# <b>\ref matrix_types_custom_matrix_mapped_files</b>
 //
 // \n \subsection matrix_types_custom_matrix_memory_management Memory Management
 //
@@ -2400,6 +2455,38 @@
 // the padding is insufficient with respect to the available instruction set, a
 // \c std::invalid_argument exception is thrown.
 //
+// \n \subsection matrix_types_custom_matrix_mapped_files Memory-Mapped Files
+//
+// Matrices that exceed the main memory can be stored in a file and mapped into memory via the
+// blaze::MappedMatrix class template. The file contains a header describing the element type,
+// the dimensions and the storage order, followed by the aligned and zero-padded matrix elements.
+// The elements are accessed via an aligned blaze::CustomMatrix, which can be used in all
+// expressions. The elements are loaded on demand from the page cache of the operating system:
+
+   \code
+   using blaze::MappedMatrix;
+
+   // Creating a new 200000x100000 matrix file
+   {
+      MappedMatrix<double,blaze::rowMajor> A( "A.mat", 200000UL, 100000UL );
+      // ... Initialization of A.matrix()
+   }
+
+   // Mapping the matrix file read-only and computing a matrix/vector multiplication
+   MappedMatrix<double,blaze::rowMajor> A( "A.mat", blaze::readOnly );
+   A.advise( blaze::sequentialAccess );
+
+   blaze::DynamicVector<double> x( A.columns() ), y;
+   y = A.matrix() * x;
+   \endcode
+
+// Files can be mapped read-only (blaze::readOnly) or for reading and writing (blaze::readWrite).
+// Note that the elements of a read-only mapping must not be modified. The advise() functions
+// forward access pattern hints (\c madvise()) for the entire matrix or for a range of rows
+// (columns) to the operating system, for instance to prefetch the next block of a blocked
+// algorithm via blaze::willNeedAccess. Memory-mapped matrices are only available on POSIX
+// systems.
+//
 //
 // \n \section matrix_types_compressed_matrix CompressedMatrix
 // <hr>
@@ -3363,6 +3450,42 @@
    max( A - B - C );  // Returns 11, i.e. the largest value of the resulting matrix
    \endcode
 
+// \n \subsection matrix_operations_reduce reduce() / sum() / prod()
+//
+// Analogous to vectors, the \c reduce(), \c sum(), and \c prod() functions reduce all elements
+// of a dense or sparse matrix (or matrix expression) to a single value:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+
+   const double s = sum( A );                              // Sum of all elements
+   const double p = prod( A );                             // Product of all elements
+   const double d = reduce( abs( A - B ), blaze::Max() );  // Maximum absolute difference
+   \endcode
+
+// Also for matrices, the given operation is required to be associative and commutative.
+//
+// Additionally, it is possible to reduce only the rows or the columns of a matrix by means of
+// the \c blaze::rowwise and \c blaze::columnwise flags. A row-wise reduction results in a column
+// vector, a column-wise reduction in a row vector:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+
+   blaze::DynamicVector<double,columnVector> r;
+   blaze::DynamicVector<double,rowVector> c;
+
+   r = blaze::sum<blaze::rowwise>( A );                           // Sum of each row
+   c = blaze::max<blaze::columnwise>( A );                        // Maximum of each column
+   r = blaze::reduce<blaze::rowwise>( abs( A ), blaze::Max() );   // Maximum norm of each row
+   \endcode
+
+// Dense partial reductions are vectorized and parallelized via the shared memory backend. For
+// sparse matrices, only the non-zero elements of each row/column are taken into account.
+//
+//
 // \n \subsection matrix_operators_trace trace()
 //
 // The \c trace() function sums the diagonal elements of a square dense or sparse matrix:
@@ -4154,6 +4277,43 @@
 // \note The inversion functions do not provide any exception safety guarantee, i.e. in case an
 // exception is thrown the matrix may already have been modified.
 //
+// \n \subsection matrix_operations_matrix_inversion_batched Batched Inversion of Small Matrices
+//
+// In case a large number of independent small matrices (as for instance the \f$ 3 \times 3 \f$
+// to \f$ 6 \times 6 \f$ matrices of local Newton solves) has to be inverted or decomposed, the
+// matrices can be stored in a blaze::MatrixBatch. The elements of all matrices of a batch are
+// stored interleaved, i.e. the element \f$ (i,j) \f$ of SIMD-width many consecutive matrices is
+// stored contiguously. This enables \b Blaze to process SIMD-width many matrices at once. In
+// addition, all batched operations are parallelized via the active shared memory parallelization
+// in case the batch contains at least \c BLAZE_SMP_MATRIXBATCH_THRESHOLD matrices:
+
+   \code
+   blaze::MatrixBatch<double,3UL,3UL> A( 100000UL );  // 100000 3x3 matrices
+   blaze::VectorBatch<double,3UL> b( 100000UL );      // 100000 right-hand sides
+
+   blaze::StaticMatrix<double,3UL,3UL> M;
+   A.set( 0UL, M );  // Setting the first matrix
+   A(1UL,2UL,0UL) = 4.0;  // Setting the element (2,0) of the second matrix
+   // ... Initialization
+
+   solve( A, b );  // Solving all 100000 linear systems; the solutions replace b
+
+   lu( A );          // In-place LU decompositions of all matrices
+   luSolve( A, b );  // Forward and backward substitution for all right-hand sides
+
+   invert( A );  // In-place inversion of all matrices
+   M = A.get( 0UL );  // Extracting the first (inverted) matrix
+   \endcode
+
+// For symmetric positive definite matrices the Cholesky decomposition can be used via the
+// \c llh() and \c llhSolve() functions. Note that the batched functions can only be used for
+// \c float and \c double matrices and that the LU decomposition and inversion are performed
+// without pivoting. Therefore they are suited for well-conditioned matrices (as for instance
+// diagonally dominant matrices), but may fail for general invertible matrices. In case a zero
+// pivot is encountered in any matrix of the batch (or if a matrix is not positive definite in
+// case of the \c llh() function), an exception is thrown. In contrast to the other inversion
+// and decomposition functions, the batched functions don't require LAPACK.
+//
 //
 // \n \section matrix_operations_decomposition Matrix Decomposition
 // <hr>
@@ -4584,6 +4744,284 @@
 // available and linked to the executable. Otherwise a linker error will be created.
 //
 //
+// \n \section matrix_operations_iterative_solvers Iterative Solvers
+// <hr>
+//
+// For large sparse linear systems \f$ A*x=b \f$ \b Blaze provides the Krylov subspace solvers
+// \c cg() (conjugate gradient method for symmetric/Hermitian positive definite matrices),
+// \c bicgstab() (BiCGStab method for general matrices), and \c gmres() (restarted GMRES method
+// for general matrices). The system matrix can be any dense or sparse matrix (including adaptors
+// as for instance the blaze::SymmetricMatrix) or a matrix-free operator, i.e. a callable object
+// computing \f$ y = A*x \f$. The given vector \a x is used as initial guess and is overwritten
+// by the computed solution. All solvers return a blaze::SolverStatistics object containing the
+// number of iterations, the final relative residual \f$ \|b-A*x\|_2 / \|b\|_2 \f$ and a flag
+// whether the solver converged. The termination criteria can be specified via a
+// blaze::SolverControl object:
+
+   \code
+   blaze::CompressedMatrix<double> A( 10000UL, 10000UL );  // The sparse system matrix
+   blaze::DynamicVector<double> b( 10000UL );              // The right-hand side vector
+   blaze::DynamicVector<double> x( 10000UL, 0.0 );         // The initial guess
+   // ... Initialization
+
+   // Solving with the default termination criteria (1000 iterations, tolerance 1E-8)
+   blaze::SolverStatistics stats = cg( A, b, x );
+
+   // Solving with at most 500 iterations, a tolerance of 1E-10 and a GMRES restart length of 50
+   stats = gmres( A, b, x, blaze::SolverControl( 500UL, 1E-10, 50UL ) );
+
+   // Solving with a matrix-free operator and a Jacobi preconditioner
+   auto op = [&A]( const blaze::DynamicVector<double>& v, blaze::DynamicVector<double>& y ) {
+      y = A * v;
+   };
+   auto jacobi = []( const blaze::DynamicVector<double>& r, blaze::DynamicVector<double>& z ) {
+      z = 0.25 * r;
+   };
+   stats = bicgstab( op, b, x, jacobi );
+   \endcode
+
+// In order to reuse the internal work vectors for several linear systems of the same size, the
+// blaze::CGSolver, blaze::BiCGStabSolver, and blaze::GMRESSolver class templates can be used
+// directly:
+
+   \code
+   blaze::CGSolver<double> solver( blaze::SolverControl( 500UL, 1E-10 ) );
+
+   solver.solve( A, b1, x1 );          // Solving without preconditioner
+   solver.solve( A, b2, x2, jacobi );  // Solving with Jacobi preconditioner
+   \endcode
+
+// The vector updates and inner products of each iteration are fused into as few passes over the
+// vectors as possible. For row-major sparse matrices, the sparse matrix/vector multiplication is
+// additionally fused with the subsequent inner product. For large systems the fused kernels are
+// parallelized via the active shared memory parallelization. In contrast to the decomposition
+// functions, the iterative solvers don't require LAPACK. Note that preconditioners are applied
+// from the right in the BiCGStab and GMRES solvers, i.e. the convergence is always measured in
+// terms of the unpreconditioned residual.
+//
+// \n \subsection matrix_operations_preconditioners Preconditioners
+//
+// For sparse system matrices \b Blaze provides a set of ready-to-use preconditioners, which can
+// be passed to all iterative solvers:
+//
+//  - blaze::JacobiPreconditioner: Scaling by the inverse of the diagonal
+//  - blaze::BlockJacobiPreconditioner: Inversion of the small dense diagonal blocks via LU
+//  - blaze::SSORPreconditioner: Symmetric successive over-relaxation
+//  - blaze::ILU0Preconditioner: Incomplete LU decomposition without fill-in
+//  - blaze::IC0Preconditioner: Incomplete Cholesky decomposition without fill-in (for symmetric
+//    and Hermitian positive definite matrices)
+//
+// The ILU(0), IC(0) and SSOR preconditioners perform a forward and a backward substitution on
+// every application. In an analysis phase, the rows of the triangular factors are grouped into
+// levels of mutually independent rows (see blaze::LevelSchedule), which are processed in parallel
+// via the active shared memory parallelization. In case the values of the system matrix change
+// but its sparsity pattern remains the same, the \c factorize() function recomputes the numeric
+// factors without repeating the analysis:
+
+   \code
+   blaze::CompressedMatrix<double> A( 10000UL, 10000UL );
+   // ... Initialization
+
+   blaze::ILU0Preconditioner<double> ilu( A );  // Analysis and factorization
+
+   blaze::GMRESSolver<double> solver;
+   solver.solve( A, b, x, ilu );
+
+   // ... Update of the values of A with the same sparsity pattern
+
+   ilu.factorize( A );  // Numeric refactorization only
+   solver.solve( A, b, x, ilu );
+   \endcode
+
+// The block Jacobi preconditioner is restricted to the block sizes known at compile time and to
+// single and double precision values:
+
+   \code
+   blaze::BlockJacobiPreconditioner<double,4UL> bjacobi( A );
+   solver.solve( A, b, x, bjacobi );
+   \endcode
+
+// \n \subsection matrix_operations_sparse_triangular_solver Sparse Triangular Solver
+//
+// Sparse triangular systems of equations can be solved by means of the
+// blaze::SparseTriangularSolver class template. It accepts a blaze::LowerMatrix,
+// blaze::UniLowerMatrix, blaze::UpperMatrix, or blaze::UniUpperMatrix adapting a sparse
+// matrix and solves for a single right-hand side vector or for multiple right-hand sides given
+// as the columns of a dense matrix:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L( 10000UL );
+   // ... Initialization
+
+   blaze::SparseTriangularSolver<double> solver( L );  // One-time analysis of L
+
+   blaze::DynamicVector<double> b( 10000UL ), x;
+   blaze::DynamicMatrix<double,blaze::rowMajor> B( 10000UL, 8UL ), X;
+   // ... Initialization
+
+   solver.solve( b, x );  // Forward substitution for a single right-hand side
+   solver.solve( B, X );  // Forward substitution for eight right-hand sides
+   \endcode
+
+// During the construction, the rows of the triangular matrix are grouped into levels of mutually
+// independent rows (the same analysis as used by the ILU(0), IC(0), and SSOR preconditioners).
+// The analysis is reused for all subsequent solves and the rows of large levels are processed in
+// parallel. In case only the values of the triangular matrix change, the \c update() function
+// replaces the values without repeating the analysis. Note that for multiple right-hand sides a
+// row-major solution matrix is preferable, since all right-hand sides are processed within a
+// single substitution.
+//
+//
+// \n \subsection matrix_operations_sparse_cholesky_solver Sparse Cholesky Solver
+//
+// Sparse symmetric positive definite (or Hermitian positive definite) systems of equations can
+// be solved directly by means of the blaze::SparseCholeskySolver class template, which computes
+// the decomposition \f$ PAP^T = LL^H \f$ of a blaze::SymmetricMatrix or blaze::HermitianMatrix
+// adapting a sparse matrix. General sparse matrices are accepted as well, in which case only
+// their lower part is used:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A( 10000UL );
+   // ... Initialization
+
+   blaze::SparseCholeskySolver<double> solver( A );  // Symbolic and numeric decomposition
+
+   blaze::DynamicVector<double> b( 10000UL ), x;
+   blaze::DynamicMatrix<double,blaze::columnMajor> B( 10000UL, 8UL ), X;
+   // ... Initialization
+
+   solver.solve( b, x );  // Solving for a single right-hand side
+   solver.solve( B, X );  // Solving for eight right-hand sides
+   \endcode
+
+// The decomposition is split into a symbolic and a numeric phase. The symbolic \c analyze()
+// function reorders the matrix by means of the approximate minimum degree ordering (or by a
+// given permutation, see \ref matrix_operations_reordering) and groups the columns of the factor
+// with (almost) identical sparsity patterns into supernodes, which are stored as dense blocks.
+// The numeric \c factorize() function computes the factor supernode by supernode by means of
+// the dense matrix multiplication and Cholesky kernels of \b Blaze and decomposes independent
+// supernodes in parallel. In case only the values of the matrix change, the symbolic analysis
+// can be reused:
+
+   \code
+   for( ... ) {
+      // ... Updating the values of A, but not its sparsity pattern
+      solver.factorize( A );  // Numeric decomposition only
+      solver.solve( b, x );
+   }
+   \endcode
+
+// In case the matrix is not positive definite or the sparsity pattern of the matrix passed to
+// \c factorize() differs from the analyzed pattern, a \c std::invalid_argument exception is
+// thrown.
+//
+//
+// \n \subsection matrix_operations_sparse_eigenvalues Sparse Eigenvalue Solvers
+//
+// A few eigenvalues at one end of the spectrum of a large sparse matrix (or of a matrix-free
+// operator) can be computed by means of the blaze::LanczosSolver class template for symmetric
+// (Hermitian) operators and by means of the blaze::ArnoldiSolver class template for general
+// operators. The wanted part of the spectrum is selected via the blaze::SpectrumFlag
+// (\c largestMagnitude, \c largestAlgebraic, or \c smallestAlgebraic):
+
+   \code
+   blaze::CompressedMatrix<double> A( 100000UL, 100000UL );  // A symmetric sparse matrix
+   blaze::CompressedMatrix<double> B( 100000UL, 100000UL );  // A general sparse matrix
+   // ... Initialization
+
+   blaze::DynamicVector<double> w1;                                  // Real eigenvalues
+   blaze::DynamicMatrix<double,blaze::columnMajor> X1;               // Real eigenvectors
+   blaze::DynamicVector< blaze::complex<double> > w2;                // Complex eigenvalues
+   blaze::DynamicMatrix< blaze::complex<double>, blaze::columnMajor > X2;  // Complex eigenvectors
+
+   const blaze::SolverControl control( 100UL, 1E-10, 40UL );  // Restarts, tolerance, subspace size
+
+   blaze::LanczosSolver<double> lanczos( control );
+   lanczos.solve( A, w1, X1, 6UL, blaze::smallestAlgebraic );  // The 6 smallest eigenpairs of A
+
+   blaze::ArnoldiSolver<double> arnoldi( control );
+   arnoldi.solve( B, w2, X2, 4UL, blaze::largestMagnitude );  // The 4 largest eigenpairs of B
+   \endcode
+
+// Both solvers are restarted Krylov subspace methods: The Krylov basis is stored in a single
+// column-major matrix and orthogonalized by means of dense matrix/vector multiplications, the
+// sparse matrix is applied via the parallel sparse matrix/vector multiplication, and in case
+// the wanted eigenpairs did not yet converge, the Krylov subspace is compressed to the wanted
+// Ritz vectors by a single dense matrix/matrix multiplication (thick restart). The \c restart
+// parameter of the SolverControl specifies the maximum dimension of the Krylov subspace, the
+// \c maxIterations parameter the maximum number of restarts.
+//
+// Krylov methods converge quickly to well separated eigenvalues at the ends of the spectrum,
+// but only very slowly (if at all) to eigenvalues close to zero or in the interior of the
+// spectrum. These eigenvalues should be computed via a shift-invert operator
+// \f$ (A-\sigma I)^{-1} \f$, whose eigenvalues of largest magnitude \f$ \mu \f$ correspond to
+// the eigenvalues \f$ \lambda = \sigma + 1/\mu \f$ of \a A closest to the shift \f$ \sigma \f$.
+// Since the solvers accept any matrix-free operator, the inverse can for instance be applied
+// via the sparse Cholesky solver:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > S( A );  // Positive definite A
+   const blaze::SparseCholeskySolver<double> cholesky( S );
+
+   auto op = [&cholesky]( const blaze::DynamicVector<double>& x, blaze::DynamicVector<double>& y ) {
+      cholesky.solve( x, y );  // y = A^{-1} * x
+   };
+
+   blaze::DynamicVector<double> x0( 100000UL );  // The start vector
+   randomize( x0 );
+
+   lanczos.solve( op, x0, w1, X1, 6UL, blaze::largestAlgebraic );
+   w1 = map( w1, []( double mu ){ return 1.0 / mu; } );  // The 6 eigenvalues of A closest to zero
+   \endcode
+
+// Note that the Lanczos and Arnoldi methods find a single eigenvector per eigenspace only, i.e.
+// the multiplicity of multiple eigenvalues is in general not revealed.
+//
+//
+// \n \section matrix_operations_reordering Sparse Matrix Reordering
+// <hr>
+//
+// The numbering of the unknowns of a sparse system strongly affects both the memory traffic of
+// sparse matrix operations and the fill-in of sparse factorizations. \b Blaze provides two
+// fill- and bandwidth-reducing orderings for square sparse matrices, which both operate on the
+// sparsity pattern of \f$ A+A^T \f$ and return a permutation vector:
+
+   \code
+   blaze::CompressedMatrix<double> A( 10000UL, 10000UL );
+   // ... Initialization
+
+   const std::vector<size_t> p1( blaze::rcm( A ) );  // Reverse Cuthill-McKee ordering
+   const std::vector<size_t> p2( blaze::amd( A ) );  // Approximate minimum degree ordering
+   \endcode
+
+// The reverse Cuthill-McKee ordering (\c rcm()) reduces the bandwidth and profile of the matrix
+// and thus improves the locality of sparse matrix/vector multiplications and of the level-based
+// preconditioners and triangular solvers. The approximate minimum degree ordering (\c amd())
+// reduces the fill-in of sparse LU and Cholesky factorizations.
+//
+// The permutation vector \c p is interpreted such that the \c i-th row and column of the
+// reordered matrix correspond to the <tt>p[i]</tt>-th row and column of the original matrix.
+// The \c permute() function computes the symmetric permutation \f$ PAP^T \f$ of a sparse
+// matrix and applies the same permutation to dense vectors, whereas the \c ipermute() function
+// reverts the permutation of a dense vector:
+
+   \code
+   blaze::DynamicVector<double> b( 10000UL ), x, z;
+   // ... Initialization
+
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, p1 ) );  // B(i,j) == A(p1[i],p1[j])
+
+   blaze::DynamicVector<double> y( blaze::permute( b, p1 ) );  // y[i] == b[p1[i]]
+   // ... Solving the reordered system B*z = y
+   x = blaze::ipermute( z, p1 );                                // x[p1[i]] == z[i]
+
+   const size_t bw( blaze::bandwidth( B ) );  // Computing the bandwidth of the reordered matrix
+   \endcode
+
+// Note that the permutation of a sparse matrix is performed in linear time with respect to
+// the number of non-zero elements, i.e. without sorting the elements of the resulting rows.
+//
+//
 // \n Previous: \ref matrix_types &nbsp; &nbsp; Next: \ref adaptors
 */
 //*************************************************************************************************
@@ -8724,6 +9162,23 @@
 // highest performance for a multiplication between two matrices can be expected for two
 // matrices with the same scalar element type.
 //
+// In case three or more matrices are multiplied, \b Blaze does not necessarily evaluate the
+// multiplications from left to right. Instead, the order of evaluation is determined at runtime
+// based on the current dimensions of the matrices and the number of non-zero elements of all
+// sparse matrices, such that the total number of required operations is minimized:
+
+   \code
+   using blaze::DynamicMatrix;
+
+   DynamicMatrix<double> A( 1000UL, 10UL ), B( 10UL, 1000UL ), C( 1000UL, 10UL ), D;
+
+   // ... Initialization of the matrices
+
+   D = A * B * C;  // Evaluated as A * ( B * C )
+   \endcode
+
+// Note that declared multiplications (see below) are never reordered.
+//
 // In case the resulting matrix is known to be symmetric, Hermitian, lower triangular, upper
 // triangular, or diagonal, the computation can be optimized by explicitly declaring the
 // multiplication as symmetric, Hermitian, lower triangular, upper triangular, or diagonal by
@@ -9294,6 +9749,48 @@
 // have been determined using the OpenMP parallelization and require individual adaption for
 // the C++11 thread parallelization.
 //
+// In order to balance the load among the threads, each parallel operation is split into several
+// tasks per thread, which are dynamically claimed by the next idle thread. For dense vectors the
+// size of the tasks decreases towards the end of the vector (guided scheduling), for lower and
+// upper triangular matrices the tasks are weighted by the number of elements in the triangular
+// part. The number of tasks per thread can be adjusted via the \c BLAZE_SMP_TASKS_PER_THREAD
+// setting in the configuration file <tt>./blaze/config/SMP.h</tt>. A value of 1 restores the
+// static scheduling of exactly one task per thread.
+//
+// By default, idle threads block on a condition variable and the thread calling a parallel
+// operation passively waits for its completion. For latency-sensitive applications performing
+// many fine-grained parallel operations it is possible to enable a hybrid spin-then-block mode
+// via the \c BLAZE_SMP_SPIN_COUNT setting in the same configuration file. In this mode idle
+// threads poll for new tasks for the given number of iterations before blocking and the calling
+// thread participates in the execution of the tasks. This avoids the wake-up latency of the
+// operating system and therefore enables considerably smaller SMP thresholds. Note that the
+// hybrid mode is only active if the number of threads is smaller than the number of hardware
+// threads.
+//
+//
+// \n \section cpp_threads_execution_contexts Execution Contexts
+// <hr>
+//
+// By default all application threads share a single pool of threads. In case several application
+// threads execute parallel operations concurrently, their tasks are processed by the same threads
+// and each application thread has to wait for the completion of the tasks of all other threads.
+// In order to isolate the parallel operations of different application threads, it is possible
+// to create an execution context with an independent pool of threads:
+
+   \code
+   blaze::DynamicMatrix<double> A( ... );
+   blaze::DynamicVector<double> x( ... ), y;
+
+   blaze::ExecutionContext ctx( 8 );  // Execution context with 8 threads
+
+   ctx.run( [&]{ y = A * x; } );  // Parallel execution with the 8 threads of the context
+   \endcode
+
+// All parallel operations within the given function are exclusively executed by the threads of
+// the execution context. Within the function, getNumThreads() and setNumThreads() refer to the
+// execution context instead of the global thread pool. Note that an execution context must not
+// be used by several application threads at the same time.
+//
 //
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
@@ -9680,6 +10177,98 @@
 // In case an error is encountered during (de-)serialization, a \c std::runtime_exception is
 // thrown.
 //
+// \n \section matrix_serialization_mapped_archives Memory-Mapped Archives
+//
+// Large matrices can alternatively be stored in a memory-mapped archive. In contrast to the
+// stream-based blaze::Archive, the objects of a blaze::MappedArchive are not copied on loading,
+// but are directly viewed in place: dense vectors and matrices are viewed via an unpadded
+// blaze::CustomVector or blaze::CustomMatrix, sparse matrices via a blaze::CompressedView.
+// Loading an archive therefore only costs the time to map the file, and the elements are
+// loaded on demand by the operating system:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::CompressedView;
+   using blaze::CustomVector;
+   using blaze::unaligned;
+   using blaze::unpadded;
+
+   // Writing a sparse matrix and a dense vector to the archive "data.blaze"
+   {
+      CompressedMatrix<double> A;
+      blaze::DynamicVector<double> b;
+      // ... Resizing and initialization
+
+      blaze::MappedArchiveWriter writer( "data.blaze" );
+      writer << A << b;
+      writer.close();
+   }
+
+   // Viewing the stored objects without copying
+   blaze::MappedArchive archive( "data.blaze" );
+
+   CompressedView<double> A;
+   CustomVector<double,unaligned,unpadded> b;
+   archive >> A >> b;
+
+   blaze::DynamicVector<double> x( A * b );
+   \endcode
+
+// Note that the views returned by a read-only archive must not be modified and remain valid
+// only as long as the archive exists. In order to keep loading cheap, the column indices of a
+// sparse matrix are not validated; in case of an untrusted archive, the isIntact() function
+// can be used to check the view. Memory-mapped archives are only available on POSIX systems.
+//
+//
+// \n \section matrix_serialization_matrix_market Matrix Market Files
+//
+// For the exchange with other tools, matrices can be read from and written to files in the
+// Matrix Market exchange format. The readMatrixMarket() function accepts both coordinate and
+// array files with real, integer, complex and pattern fields and general, symmetric,
+// skew-symmetric and Hermitian symmetry. Duplicate entries of coordinate files are summed up:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::readMatrixMarket( "matrix.mtx", A );
+
+   blaze::writeMatrixMarket( "result.mtx", A * A );  // Writing a sparse matrix in coordinate format
+   blaze::writeMatrixMarket( "dense.mtx", blaze::DynamicMatrix<double>( A ) );  // Array format
+   \endcode
+
+// Both functions parse and format the file in parallel chunks (see \ref shared_memory_parallelization)
+// and the parsed entries of a sparse matrix are assembled directly into the compressed format
+// of the target matrix. Note that written files always use the general symmetry.
+//
+//
+// \n \section matrix_serialization_npy NumPy Files
+//
+// Dense matrices and vectors can also be exchanged with NumPy via the binary .npy format. The
+// writeNpy() function writes a matrix in its own storage order (i.e. column-major matrices are
+// written with \c fortran_order set to \c True), the readNpy() function reads any two- or
+// one-dimensional array with matching element type:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 1000UL, 500UL );
+   // ... Initialization
+
+   blaze::writeNpy( "A.npy", A );  // np.load( "A.npy" ) yields a Fortran-ordered array
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> B;
+   blaze::readNpy( "A.npy", B );
+   \endcode
+
+// In case the storage order of the file matches, the file can additionally be mapped into memory
+// via the blaze::NpyMatrix class template, which provides a blaze::CustomMatrix view on the
+// elements without copying them:
+
+   \code
+   blaze::NpyMatrix<double,blaze::columnMajor> C( "A.npy" );  // Read-only mapping
+   blaze::DynamicVector<double> y( C.matrix() * x );
+
+   blaze::NpyMatrix<double,blaze::columnMajor> D( "D.npy", 1000UL, 1000UL );  // New file
+   D.matrix() = C.matrix() * trans( C.matrix() );
+   \endcode
+
 // \n Previous: \ref vector_serialization &nbsp; &nbsp; Next: \ref blas_functions \n
 */
 //*************************************************************************************************
@@ -10003,12 +10592,39 @@
    getri( A, ipiv.get() );  // Reports failure via exception
    \endcode
 
+// The high-level wrappers query LAPACK for the optimal size of all auxiliary work arrays and
+// therefore enable the blocked algorithms of the LAPACK library. By default the work arrays are
+// allocated anew for every call. In case many matrices of the same size have to be processed,
+// the auxiliary memory can be provided by means of a reusable blaze::LAPACKWorkspace. All
+// high-level wrappers, the decomposition functions, the in-place inversion via invert(), and the
+// eigen() and svd() functions accept a workspace as additional, last argument:
+
+   \code
+   blaze::LAPACKWorkspace ws;
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( N, N ), Q, R;
+   blaze::DynamicVector<double,blaze::columnVector> s;
+
+   for( size_t i=0UL; i<1000UL; ++i ) {
+      // ... Initializing the matrix
+      qr( A, Q, R, ws );  // No allocation of LAPACK work arrays after the first iteration
+      svd( A, s, ws );
+   }
+   \endcode
+
 // \note All functions only work for general, non-adapted matrices with \c float, \c double,
 // \c complex<float>, or \c complex<double> element type. The attempt to call the function with
 // adaptors or matrices of any other element type results in a compile time error!
 //
 // \note All functions can only be used if a fitting LAPACK library is available and linked to
-// the final executable. Otherwise a call to this function will result in a linker error.
+// the final executable. Otherwise a call to this function will result in a linker error. The
+// only exception are the LU- and Cholesky-based functions (getrf(), getrs(), getri(), gesv(),
+// potrf(), potrs(), potri(), posv()) and the triangular functions (trtri(), trtrs(), trsv()):
+// In case the LAPACK mode is disabled via the \c BLAZE_LAPACK_MODE switch (see the
+// <tt>./blaze/config/LAPACK.h</tt> configuration file), these functions are handled by native,
+// blocked \b Blaze kernels, which do not require a LAPACK library. Consequently, the LU and
+// Cholesky decompositions, the according inversions and solvers, and the computation of the
+// determinant remain available without LAPACK. The CMake configuration automatically disables
+// the LAPACK mode in case no LAPACK library is found.
 //
 // \note For performance reasons all functions do only provide the basic exception safety guarantee,
 // i.e. in case an exception is thrown the given matrix may already have been modified.
@@ -11106,6 +11722,80 @@
 // must be performed prior to calling this function!
 //
 //
+// \n \subsection lapack_factorization_classes Reusable Factorizations
+//
+// In case several linear systems with the same system matrix have to be solved at different
+// points in time, the matrix should be factorized only once. For this purpose \b Blaze provides
+// the blaze::LUFactorization, blaze::CholeskyFactorization, and blaze::QRFactorization class
+// templates, which compute and own the factors of a given dense matrix and reuse them for an
+// arbitrary number of right-hand sides:
+
+   \code
+   blaze::DynamicMatrix<double> A( 100UL, 100UL );   // The general system matrix
+   blaze::DynamicMatrix<double> S( 100UL, 100UL );   // A symmetric positive definite system matrix
+   blaze::DynamicMatrix<double> O( 200UL, 100UL );   // An overdetermined system matrix
+   blaze::DynamicVector<double> b( 100UL ), c( 200UL );
+   blaze::DynamicMatrix<double> B( 100UL, 10UL );
+   // ... Initialization
+
+   blaze::LUFactorization<double> lu( A );         // Factorizes A only once
+   blaze::DynamicVector<double> x( lu.solve( b ) );  // Solves A*x=b
+   blaze::DynamicMatrix<double> X( lu.solve( B ) );  // Solves A*X=B for all columns of B
+   lu.solveInPlace( b );                             // Overwrites b with the solution
+
+   blaze::CholeskyFactorization<double> llh( S );  // Throws for non-positive definite matrices
+   x = llh.solve( b );
+
+   blaze::QRFactorization<double> qr( O );         // QR factorization of a 200x100 matrix
+   x = qr.solve( c );                              // Least squares solution of O*x=c
+
+   const double d ( lu.det()   );  // Determinant of A computed from the LU factors
+   const double rc( lu.rcond() );  // Estimate of the reciprocal condition number of A
+   \endcode
+
+// The rcond() function estimates the reciprocal of the condition number of the matrix in the
+// 1-norm based on the existing factors (see the gecon(), pocon(), and trcon() functions in
+// \ref lapack_condition_estimation). A value close to 0 indicates an ill-conditioned matrix.
+// Note that all factorization classes own a LAPACKWorkspace, i.e. repeated solves don't
+// allocate any auxiliary LAPACK memory. However, a single instance of a factorization class
+// must not be used concurrently by several threads.
+//
+//
+// \n \section lapack_condition_estimation Condition Estimation
+//
+// The following functions provide an interface for the LAPACK functions \c sgecon(), \c dgecon(),
+// \c cgecon(), \c zgecon(), \c spocon(), \c dpocon(), \c cpocon(), \c zpocon(), \c strcon(),
+// \c dtrcon(), \c ctrcon(), and \c ztrcon(), which estimate the reciprocal condition number of
+// a general, a positive definite, or a triangular matrix:
+
+   \code
+   namespace blaze {
+
+   template< typename MT, bool SO >
+   UnderlyingElement_< ElementType_<MT> > gecon( const DenseMatrix<MT,SO>& A, char norm, UnderlyingElement_< ElementType_<MT> > anorm );
+
+   template< typename MT, bool SO >
+   UnderlyingElement_< ElementType_<MT> > pocon( const DenseMatrix<MT,SO>& A, char uplo, UnderlyingElement_< ElementType_<MT> > anorm );
+
+   template< typename MT, bool SO >
+   UnderlyingElement_< ElementType_<MT> > trcon( const DenseMatrix<MT,SO>& A, char norm, char uplo, char diag );
+
+   } // namespace blaze
+   \endcode
+
+// The gecon() function expects the LU factors of the matrix as computed by getrf() and the
+// norm of the original matrix, the pocon() function expects the Cholesky factor as computed by
+// potrf() and the 1-norm of the original matrix. All functions are also available with an
+// additional LAPACKWorkspace argument. The functions fail if ...
+//
+//  - ... the given matrix is not a square matrix;
+//  - ... the given \a norm argument is neither '1', 'O', nor 'I';
+//  - ... the given \a uplo argument is neither 'L' nor 'U';
+//  - ... the given \a diag argument is neither 'U' nor 'N'.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+//
 // \n \section lapack_eigenvalues Eigenvalues/Eigenvectors
 //
 // \subsection lapack_eigenvalues_general General Matrices
@@ -11767,6 +12457,124 @@
 // is beneficial or hurtful for performance.
 //
 //
+// \n \section memory_resources Memory Resources
+// <hr>
+//
+// By default all \b Blaze data structures (as for instance \c DynamicVector, \c DynamicMatrix,
+// \c CompressedVector and \c CompressedMatrix) and all temporaries of expressions request their
+// memory via the system-specific aligned allocation functions. Alternatively, the memory can be
+// provided by a custom memory resource, i.e. by any class derived from \c blaze::MemoryResource.
+// A memory resource can either be installed for all threads via the \c setMemoryResource()
+// function or for the calling thread via a \c blaze::MemoryResourceScope:
+
+   \code
+   // Pre-reserving 1 GiB for all subsequent allocations of all threads
+   blaze::PoolMemoryResource pool( 1024UL*1024UL*1024UL );
+   blaze::setMemoryResource( &pool );
+
+   // Using a custom (e.g. NUMA-local) memory resource for the calling thread
+   {
+      blaze::MemoryResourceScope scope( myResource );
+      blaze::DynamicMatrix<double> A( 1000UL, 1000UL );
+   }
+   \endcode
+
+// Memory is always returned to the resource it was allocated from. Therefore data structures can
+// be freely copied and moved between resources, but each resource must outlive all the memory
+// allocated from it. The \c blaze::PoolMemoryResource class reserves its entire capacity on
+// construction and afterwards never touches the system allocator again. In case it is exhausted,
+// a \c std::bad_alloc exception is thrown.
+//
+//
+// \n \section huge_pages Huge Pages
+// <hr>
+//
+// For very large vectors and matrices the number of TLB misses can considerably reduce the
+// performance of strided memory accesses (as for instance the traversal of the columns of a
+// row-major matrix or a transposition). On Linux systems all allocations of at least
+// \c BLAZE_HUGE_PAGE_THRESHOLD bytes are therefore backed by huge pages. The configuration
+// file <tt>./blaze/config/Memory.h</tt> provides the according switches:
+
+   \code
+   #define BLAZE_HUGE_PAGE_MODE 1
+   #define BLAZE_HUGE_PAGE_THRESHOLD 33554432UL
+   \endcode
+
+// If \c BLAZE_HUGE_PAGE_MODE is set to 0, huge pages are not used. If it is set to 1, large
+// allocations are aligned to 2 MiB and marked as eligible for transparent huge pages. If it is
+// set to 2, large allocations are taken from the explicitly reserved huge pages of the system
+// (hugetlbfs), with a fallback to transparent huge pages. The setting can also be changed at
+// runtime by installing a \c blaze::SystemMemoryResource with a different mode (see also
+// \ref memory_resources):
+
+   \code
+   blaze::SystemMemoryResource resource( blaze::explicitHugePages, 8UL*1024UL*1024UL );
+   blaze::setMemoryResource( &resource );
+   \endcode
+
+//
+//
+// \n \section scratch_arena Scratch Arena
+// <hr>
+//
+// Many computations create temporaries of the same size over and over again, for instance the
+// intermediate result of \c A*B in the expression \c (A*B)*x or the result of an explicit call
+// to the \c eval() function. Within the lifetime of a \c blaze::ScratchScope all memory of
+// \b Blaze data structures is taken from a preallocated, per-thread scratch arena instead of
+// the system allocator. Released memory is immediately reused for the next temporary:
+
+   \code
+   for( size_t step=0UL; step<steps; ++step )
+   {
+      blaze::ScratchScope scope;
+      y = ( A * B ) * x;
+      x = eval( A * x ) + y;
+   }
+   \endcode
+
+// The capacity of each arena is specified in the configuration file
+// <tt>./blaze/config/Memory.h</tt>:
+
+   \code
+   #define BLAZE_SCRATCH_ARENA_CAPACITY 16777216UL
+   \endcode
+
+// Requests that don't fit into the arena are served by the system allocator. Setting the capacity
+// to 0 disables the scratch arena completely.
+//
+//
+// \n \section memory_accounting Memory Accounting
+// <hr>
+//
+// In order to analyze the memory footprint of an application, \b Blaze can record all
+// allocations and deallocations of its data structures and temporaries. The memory accounting
+// is activated via the \c BLAZE_USE_MEMORY_ACCOUNTING switch in the configuration file
+// <tt>./blaze/config/Memory.h</tt>:
+
+   \code
+   #define BLAZE_USE_MEMORY_ACCOUNTING 1
+   \endcode
+
+// The \c blaze::getMemoryStatistics() function returns the number of bytes currently in use,
+// the peak memory usage, the number of allocations and deallocations and the allocated bytes
+// per data structure (dense/sparse vectors and matrices). The \c blaze::MemorySnapshot class
+// restricts the statistics to a specific scope, which for instance allows to check whether
+// an expression creates any temporaries:
+
+   \code
+   {
+      blaze::MemorySnapshot snapshot;
+
+      C = A * B + D;
+
+      std::cout << snapshot.statistics() << "\n";
+   }
+   \endcode
+
+// In case the switch is set to 0 (the default), the memory accounting is completely removed from
+// the code and all statistics are zero.
+//
+//
 // \n Previous: \ref lapack_functions &nbsp; &nbsp; Next: \ref block_vectors_and_matrices \n
 */
 //*************************************************************************************************
@@ -60,8 +60,11 @@
 #include <blaze/util/InputString.h>
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Limits.h>
+#include <blaze/util/MappedFile.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryAccounting.h>
 #include <blaze/util/MemoryPool.h>
+#include <blaze/util/MemoryResource.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/NonCreatable.h>
@@ -69,7 +72,9 @@
 #include <blaze/util/NumericCast.h>
 #include <blaze/util/PointerCast.h>
 #include <blaze/util/Policies.h>
+#include <blaze/util/PoolMemoryResource.h>
 #include <blaze/util/Random.h>
+#include <blaze/util/ScratchArena.h>
 #include <blaze/util/Serialization.h>
 #include <blaze/util/Singleton.h>
 #include <blaze/util/StaticAssert.h>
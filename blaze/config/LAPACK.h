@@ -0,0 +1,70 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/LAPACK.h
+//  \brief Configuration of the LAPACK mode
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the LAPACK mode.
+// \ingroup config
+//
+// This compilation switch specifies whether a LAPACK library is available. In case the LAPACK
+// mode is enabled, all LAPACK-based functions (as for instance the LU decomposition, the Cholesky
+// decomposition or the inversion of dense matrices) call the functions of the LAPACK library,
+// which is mandatory to be linked to the executable. In case the LAPACK mode is disabled, the
+// LU and Cholesky decompositions, the according inversion and substitution functions, and the
+// triangular solvers (i.e. the getrf(), getrs(), getri(), gesv(), potrf(), potrs(), potri(),
+// posv(), trtri(), trtrs(), and trsv() functions) are handled by native, blocked Blaze kernels
+// and therefore LAPACK is not required for these functions. Note that all other LAPACK-based
+// functions (as for instance the QR decomposition or the eigenvalue and singular value
+// functions) still require a LAPACK library.
+//
+// Possible settings for the LAPACK switch:
+//  - Disabled: \b 0
+//  - Enabled : \b 1 (default)
+//
+// \warning Changing the setting of the LAPACK mode requires a recompilation of all code using
+// the Blaze library!
+//
+// \note It is possible to (de-)activate the LAPACK mode via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_LAPACK_MODE 0
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_LAPACK_MODE
+#define BLAZE_LAPACK_MODE 1
+#endif
+//*************************************************************************************************
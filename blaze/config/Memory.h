@@ -0,0 +1,144 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/Memory.h
+//  \brief Configuration of the memory management
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Configuration of the capacity of the per-thread scratch arena.
+// \ingroup config
+//
+// This configuration switch specifies the capacity (in bytes) of the scratch arena of each
+// thread. Within the lifetime of a blaze::ScratchScope all memory requested by \b Blaze data
+// structures (e.g. by the temporaries created during the evaluation of expressions) is taken
+// from the scratch arena of the calling thread instead of the system allocator. The arena of a
+// thread is created during the first use of a blaze::ScratchScope. In case the arena is full,
+// the memory is requested from the system allocator. Setting the capacity to 0 completely
+// disables the scratch arena.
+//
+// The default setting for the capacity of the scratch arena is 16 MiB.
+//
+// \note It is possible to specify the capacity via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SCRATCH_ARENA_CAPACITY 67108864UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SCRATCH_ARENA_CAPACITY
+#define BLAZE_SCRATCH_ARENA_CAPACITY 16777216UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration of the huge page allocation mode.
+// \ingroup config
+//
+// This configuration switch specifies whether and how large allocations (see the
+// BLAZE_HUGE_PAGE_THRESHOLD switch) are backed by huge pages in order to reduce the number of
+// TLB misses. The following modes are available:
+//
+//  - 0: Huge pages are not used.
+//  - 1: Large allocations are aligned to 2 MiB and marked as eligible for transparent huge pages
+//       via \c madvise(MADV_HUGEPAGE).
+//  - 2: Large allocations are taken from the explicitly reserved huge pages of the system
+//       (hugetlbfs, see \c /proc/sys/vm/nr_hugepages). In case no huge pages are available,
+//       transparent huge pages are used instead.
+//
+// The default setting is 1. Note that huge pages are only available on Linux systems. On all
+// other systems this switch has no effect.
+//
+// \note It is possible to specify the huge page mode via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_HUGE_PAGE_MODE 2
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_HUGE_PAGE_MODE
+#define BLAZE_HUGE_PAGE_MODE 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration of the huge page threshold.
+// \ingroup config
+//
+// This configuration switch specifies the minimum size (in bytes) of an allocation to be backed
+// by huge pages (see the BLAZE_HUGE_PAGE_MODE switch). Since huge page allocations are rounded
+// up to multiples of 2 MiB, the threshold should be considerably larger than 2 MiB.
+//
+// The default setting for the huge page threshold is 32 MiB.
+//
+// \note It is possible to specify the threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_HUGE_PAGE_THRESHOLD 8388608UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_HUGE_PAGE_THRESHOLD
+#define BLAZE_HUGE_PAGE_THRESHOLD 33554432UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the memory accounting.
+// \ingroup config
+//
+// This compilation switch enables/disables the memory accounting of \b Blaze. In case the switch
+// is set to 1, all allocations and deallocations of \b Blaze data structures and temporaries are
+// recorded in a set of atomic counters, which can be queried via the getMemoryStatistics()
+// function and the blaze::MemorySnapshot class. In case the switch is set to 0, the memory
+// accounting is completely removed from the code.
+//
+// The default setting for the memory accounting is 0 (disabled).
+//
+// \note It is possible to (de-)activate the memory accounting via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_MEMORY_ACCOUNTING 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_MEMORY_ACCOUNTING
+#define BLAZE_USE_MEMORY_ACCOUNTING 0
+#endif
+//*************************************************************************************************
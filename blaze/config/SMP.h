@@ -58,3 +58,64 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Over-decomposition factor of the thread-based shared-memory parallelization.
+// \ingroup config
+//
+// This value specifies the number of tasks per thread the C++11 and Boost thread-based SMP
+// assignments split their work into. With a value of 1, each thread is assigned exactly one
+// chunk of equal size, which means that the operation has to wait for the slowest chunk. Any
+// larger value results in smaller chunks, which are claimed dynamically by the next idle thread
+// of the thread pool. This compensates both for operations with unequal costs per chunk (as for
+// instance for lower and upper triangular matrices) and for a varying load on shared nodes.
+//
+// The default setting for this value is 4. Note that this setting has no effect on the OpenMP
+// parallelization.
+//
+// \note It is possible to specify the over-decomposition factor via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_TASKS_PER_THREAD 4
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_TASKS_PER_THREAD
+#define BLAZE_SMP_TASKS_PER_THREAD 4
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Spin count of the thread-based shared-memory parallelization.
+// \ingroup config
+//
+// This value specifies the number of polling iterations of the C++11 and Boost thread-based
+// parallelization before an idle thread falls back to blocking on a condition variable. In case
+// the value is set to 0, all idle threads block immediately and the thread calling a parallel
+// operation waits passively for its completion. This minimizes the CPU usage, but every parallel
+// operation pays the latency of waking up the threads via the operating system. In case the
+// value is larger than 0, the threads of the thread pool operate in a hybrid spin-then-block
+// mode: Idle threads poll for new tasks before blocking and the calling thread participates in
+// the execution of the tasks. This considerably reduces the latency of fine-grained parallel
+// operations and enables a reduction of the SMP thresholds (see <tt>./blaze/config/Thresholds.h</tt>)
+// at the cost of busy CPU cores. A reasonable setting for the hybrid mode is in the range of
+// 10000 to 100000 iterations, which corresponds to a polling period of roughly 0.1 to 5ms.
+//
+// The default setting for the spin count is 0. Note that this setting has no effect on the
+// OpenMP parallelization.
+//
+// \note It is possible to specify the spin count via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SPIN_COUNT 20000
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SPIN_COUNT
+#define BLAZE_SMP_SPIN_COUNT 0
+#endif
+//*************************************************************************************************
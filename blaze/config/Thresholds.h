@@ -1211,6 +1211,136 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP row-wise/column-wise dense matrix reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when a row-wise or column-wise reduction of a dense matrix can be
+// executed in parallel. In case the number of elements of the reduced matrix is larger or equal
+// to this threshold, the operation is executed in parallel. If the number of elements is below
+// this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 48400 (which corresponds to a matrix size of
+// \f$ 220 \times 220 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATREDUCE_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATREDUCE_THRESHOLD
+#define BLAZE_SMP_DMATREDUCE_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched small matrix operation threshold.
+// \ingroup config
+//
+// This threshold specifies when a batched operation on many small matrices (as for instance the
+// batched inversion or the batched LU decomposition of a blaze::MatrixBatch) can be executed in
+// parallel. In case the number of matrices in the batch is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of matrices is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 4096. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_MATRIXBATCH_THRESHOLD 4096UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_MATRIXBATCH_THRESHOLD
+#define BLAZE_SMP_MATRIXBATCH_THRESHOLD 4096UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This threshold specifies when a level of a level-scheduled sparse triangular solve (as for
+// instance performed during the application of an incomplete LU or Cholesky preconditioner) can
+// be executed in parallel. In case the number of rows of a level is larger or equal to this
+// threshold, the rows of the level are processed in parallel. If the number of rows is below
+// this threshold the level is processed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 1024. In case the threshold is set to 0, all levels
+// are unconditionally processed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATTRSV_THRESHOLD 1024UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATTRSV_THRESHOLD
+#define BLAZE_SMP_SMATTRSV_THRESHOLD 1024UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse Cholesky decomposition threshold.
+// \ingroup config
+//
+// This threshold specifies when a level of the supernodal elimination tree of a sparse Cholesky
+// decomposition (see the blaze::SparseCholeskySolver class template) can be decomposed in
+// parallel. In case the total number of factor elements of all supernodes of a level is larger
+// or equal to this threshold, the supernodes of the level are decomposed in parallel. If the
+// number of elements is below this threshold the level is processed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 16384. In case the threshold is set to 0, all levels
+// containing at least two supernodes are unconditionally processed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATLLH_THRESHOLD 16384UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATLLH_THRESHOLD
+#define BLAZE_SMP_SMATLLH_THRESHOLD 16384UL
+#endif
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/row-major dense matrix addition threshold.
 // \ingroup config
@@ -45,14 +45,17 @@
 #include <blaze/math/adaptors/LowerMatrix.h>
 #include <blaze/math/adaptors/SymmetricMatrix.h>
 #include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/dense/CholeskyFactorization.h>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/dense/Eigen.h>
 #include <blaze/math/dense/Inversion.h>
 #include <blaze/math/dense/LLH.h>
 #include <blaze/math/dense/LQ.h>
 #include <blaze/math/dense/LU.h>
+#include <blaze/math/dense/LUFactorization.h>
 #include <blaze/math/dense/QL.h>
 #include <blaze/math/dense/QR.h>
+#include <blaze/math/dense/QRFactorization.h>
 #include <blaze/math/dense/RQ.h>
 #include <blaze/math/dense/SVD.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -71,6 +74,7 @@
 #include <blaze/math/expressions/DMatEvalExpr.h>
 #include <blaze/math/expressions/DMatInvExpr.h>
 #include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/expressions/DMatScalarDivExpr.h>
 #include <blaze/math/expressions/DMatScalarMultExpr.h>
 #include <blaze/math/expressions/DMatSerialExpr.h>
@@ -89,6 +93,7 @@
 #include <blaze/math/expressions/DMatTSMatMultExpr.h>
 #include <blaze/math/expressions/DMatTSMatSubExpr.h>
 #include <blaze/math/expressions/DVecDVecOuterExpr.h>
+#include <blaze/math/expressions/MatChainMultExpr.h>
 #include <blaze/math/expressions/SMatDMatMultExpr.h>
 #include <blaze/math/expressions/SMatDMatSubExpr.h>
 #include <blaze/math/expressions/SMatTDMatMultExpr.h>
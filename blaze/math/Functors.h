@@ -43,6 +43,7 @@
 #include <blaze/math/functors/Abs.h>
 #include <blaze/math/functors/Acos.h>
 #include <blaze/math/functors/Acosh.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Asin.h>
 #include <blaze/math/functors/Asinh.h>
 #include <blaze/math/functors/Atan.h>
@@ -76,6 +77,7 @@
 #include <blaze/math/functors/Log10.h>
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
 #include <blaze/math/functors/Noop.h>
 #include <blaze/math/functors/Pow.h>
 #include <blaze/math/functors/Real.h>
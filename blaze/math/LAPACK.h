@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/gecon.h>
 #include <blaze/math/lapack/geev.h>
 #include <blaze/math/lapack/gelqf.h>
 #include <blaze/math/lapack/geqlf.h>
@@ -68,6 +69,7 @@
 #include <blaze/math/lapack/ormql.h>
 #include <blaze/math/lapack/ormqr.h>
 #include <blaze/math/lapack/ormrq.h>
+#include <blaze/math/lapack/pocon.h>
 #include <blaze/math/lapack/posv.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/lapack/potri.h>
@@ -79,6 +81,7 @@
 #include <blaze/math/lapack/sytrf.h>
 #include <blaze/math/lapack/sytri.h>
 #include <blaze/math/lapack/sytrs.h>
+#include <blaze/math/lapack/trcon.h>
 #include <blaze/math/lapack/trsv.h>
 #include <blaze/math/lapack/trtri.h>
 #include <blaze/math/lapack/trtrs.h>
@@ -90,5 +93,6 @@
 #include <blaze/math/lapack/unmql.h>
 #include <blaze/math/lapack/unmqr.h>
 #include <blaze/math/lapack/unmrq.h>
+#include <blaze/math/lapack/Workspace.h>
 
 #endif
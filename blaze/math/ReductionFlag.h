@@ -0,0 +1,69 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/ReductionFlag.h
+//  \brief Header file for the matrix reduction flags
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_REDUCTIONFLAG_H_
+#define _BLAZE_MATH_REDUCTIONFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REDUCTION FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reduction flag.
+// \ingroup math
+//
+// The ReductionFlag type enumeration represents the two directions of a partial reduction of
+// a dense or sparse matrix (see for instance the \c reduce() function). The following flags
+// are available:
+//
+//  - \c columnwise: Each column of the matrix is reduced to a single value. The result is a
+//          row vector with as many elements as the matrix has columns.
+//  - \c rowwise: Each row of the matrix is reduced to a single value. The result is a column
+//          vector with as many elements as the matrix has rows.
+*/
+enum ReductionFlag
+{
+   columnwise = 0,  //!< Flag for the reduction of each column of a matrix.
+   rowwise    = 1   //!< Flag for the reduction of each row of a matrix.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
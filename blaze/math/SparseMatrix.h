@@ -49,6 +49,7 @@
 #include <blaze/math/expressions/DMatSMatSchurExpr.h>
 #include <blaze/math/expressions/DMatTSMatSchurExpr.h>
 #include <blaze/math/expressions/DVecSVecOuterExpr.h>
+#include <blaze/math/expressions/MatChainMultExpr.h>
 #include <blaze/math/expressions/SMatDeclDiagExpr.h>
 #include <blaze/math/expressions/SMatDeclHermExpr.h>
 #include <blaze/math/expressions/SMatDeclLowExpr.h>
@@ -58,6 +59,7 @@
 #include <blaze/math/expressions/SMatDVecMultExpr.h>
 #include <blaze/math/expressions/SMatEvalExpr.h>
 #include <blaze/math/expressions/SMatMapExpr.h>
+#include <blaze/math/expressions/SMatReduceExpr.h>
 #include <blaze/math/expressions/SMatScalarDivExpr.h>
 #include <blaze/math/expressions/SMatScalarMultExpr.h>
 #include <blaze/math/expressions/SMatSerialExpr.h>
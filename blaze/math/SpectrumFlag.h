@@ -0,0 +1,78 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/SpectrumFlag.h
+//  \brief Header file for the spectrum flag enumeration
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPECTRUMFLAG_H_
+#define _BLAZE_MATH_SPECTRUMFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPECTRUM FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Spectrum flag.
+// \ingroup math
+//
+// The SpectrumFlag type enumeration represents the different parts of the spectrum of a matrix
+// that can be computed by the iterative eigenvalue solvers of the Blaze library (see for instance
+// the LanczosSolver and the ArnoldiSolver class templates). The following flags are available:
+//
+//  - \c largestMagnitude: The eigenvalues \f$ \lambda \f$ with the largest magnitude
+//          \f$ |\lambda| \f$.
+//  - \c largestAlgebraic: The eigenvalues with the largest value. For non-Hermitian matrices
+//          the eigenvalues with the largest real part are selected.
+//  - \c smallestAlgebraic: The eigenvalues with the smallest value. For non-Hermitian matrices
+//          the eigenvalues with the smallest real part are selected.
+//
+// Note that Krylov subspace methods converge fastest for eigenvalues at the boundary of the
+// spectrum that are well separated from the remaining eigenvalues. Eigenvalues in the interior
+// of the spectrum or close to zero (e.g. the smallest eigenvalues of a positive definite matrix)
+// are computed most efficiently by applying the solver to the inverse of the (shifted) matrix.
+*/
+enum SpectrumFlag
+{
+   largestMagnitude  = 0,  //!< Flag for the eigenvalues of largest magnitude.
+   largestAlgebraic  = 1,  //!< Flag for the eigenvalues of largest (real part of the) value.
+   smallestAlgebraic = 2   //!< Flag for the eigenvalues of smallest (real part of the) value.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,885 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchSolvers.h
+//  \brief Header file for the batched inversion and solvers for small dense matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_MATH_DENSE_BATCHSOLVERS_H_
+#define _BLAZE_MATH_DENSE_BATCHSOLVERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/dense/MatrixBatch.h>
+#include <blaze/math/dense/VectorBatch.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSqrt.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS BATCHPACKET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the vectorized batch kernels.
+// \ingroup matrix_batch
+//
+// This type trait evaluates to \a true in case all SIMD operations required by the batch
+// kernels (addition, subtraction, multiplication, division and square root) are available
+// for the given data type.
+*/
+template< typename Type >  // Data type of the batch elements
+struct UseVectorizedBatchKernel
+   : public BoolConstant< IsVectorizable<Type>::value &&
+                          HasSIMDAdd<Type,Type>::value &&
+                          HasSIMDSub<Type,Type>::value &&
+                          HasSIMDMult<Type,Type>::value &&
+                          HasSIMDDiv<Type,Type>::value &&
+                          HasSIMDSqrt<Type>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packet of batch elements processed by a single instance of a batch kernel.
+// \ingroup matrix_batch
+//
+// The BatchPacket class template abstracts the loading and storing of the elements of a chunk
+// of consecutive matrices of a batch. In case the required SIMD operations are available, a
+// packet is a SIMD vector of SIMD-width many elements, else it is a single scalar element.
+*/
+template< typename Type                                       // Data type of the batch elements
+        , bool = UseVectorizedBatchKernel<Type>::value >  // Vectorization flag
+struct BatchPacket
+{
+   //**Type definitions****************************************************************************
+   using ValueType = Type;  //!< Type of a single packet.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t { size = 1UL };  //!< The number of matrices processed per packet.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE ValueType load ( const Type* p ) noexcept { return *p; }
+   static BLAZE_ALWAYS_INLINE void      store( Type* p, const ValueType& v ) noexcept { *p = v; }
+   static BLAZE_ALWAYS_INLINE void      storeu( Type* p, const ValueType& v ) noexcept { *p = v; }
+   static BLAZE_ALWAYS_INLINE ValueType set  ( Type v ) noexcept { return v; }
+   static BLAZE_ALWAYS_INLINE ValueType sqrt ( const ValueType& v ) noexcept { return std::sqrt( v ); }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BatchPacket class template for vectorizable data types.
+// \ingroup matrix_batch
+*/
+template< typename Type >  // Data type of the batch elements
+struct BatchPacket<Type,true>
+{
+   //**Type definitions****************************************************************************
+   using ValueType = SIMDTrait_<Type>;  //!< Type of a single packet.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t { size = SIMDTrait<Type>::size };  //!< The number of matrices processed per packet.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE ValueType load ( const Type* p ) noexcept { return loada( p ); }
+   static BLAZE_ALWAYS_INLINE void      store( Type* p, const ValueType& v ) noexcept { storea( p, v ); }
+   static BLAZE_ALWAYS_INLINE void      storeu( Type* p, const ValueType& v ) noexcept { blaze::storeu( p, v ); }
+   static BLAZE_ALWAYS_INLINE ValueType set  ( Type v ) noexcept { return blaze::set( v ); }
+   static BLAZE_ALWAYS_INLINE ValueType sqrt ( const ValueType& v ) noexcept { return blaze::sqrt( v ); }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the given pivot elements of a chunk of matrices for zero elements.
+// \ingroup matrix_batch
+//
+// \param pivots The pivot elements of all matrices of the chunk.
+// \param lanes The number of matrices of the chunk that belong to the batch.
+// \return \a true in case all pivot elements are valid divisors, \a false if not.
+*/
+template< size_t N         // Number of pivot elements per matrix
+        , size_t L         // Number of matrices per chunk
+        , typename Type >  // Data type of the pivot elements
+inline bool checkBatchPivots( const Type (&pivots)[N][L], size_t lanes ) noexcept
+{
+   for( size_t p=0UL; p<N; ++p ) {
+      for( size_t l=0UL; l<lanes; ++l ) {
+         if( !isDivisor( pivots[p][l] ) ) return false;
+      }
+   }
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place Gauss-Jordan inversion of a chunk of \f$ N \times N \f$ matrices.
+// \ingroup matrix_batch
+//
+// \param v Pointer to the interleaved elements of the batch.
+// \param spacing The spacing of the batch.
+// \param k The index of the first matrix of the chunk.
+// \param lanes The number of matrices of the chunk that belong to the batch.
+// \return \a true in case all matrices have been inverted, \a false if a zero pivot occurred.
+*/
+template< typename PT      // Type of the batch packet
+        , size_t N         // Number of rows and columns of each matrix
+        , typename Type >  // Data type of the batch elements
+inline bool invertBatchKernel( Type* v, size_t spacing, size_t k, size_t lanes )
+{
+   using V = typename PT::ValueType;
+
+   V a[N][N];
+   Type pivots[N][PT::size];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = PT::load( v+(i*N+j)*spacing+k );
+
+   const V one ( PT::set( Type(1) ) );
+   const V zero( PT::set( Type(0) ) );
+
+   for( size_t p=0UL; p<N; ++p )
+   {
+      PT::storeu( pivots[p], a[p][p] );
+      const V r( one / a[p][p] );
+      const V s( zero - r );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         if( j != p ) a[p][j] = a[p][j] * r;
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         if( i == p ) continue;
+         const V f( a[i][p] );
+         for( size_t j=0UL; j<N; ++j ) {
+            if( j != p ) a[i][j] = a[i][j] - f * a[p][j];
+         }
+         a[i][p] = f * s;
+      }
+
+      a[p][p] = r;
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         PT::store( v+(i*N+j)*spacing+k, a[i][j] );
+
+   return checkBatchPivots( pivots, lanes );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place LU decomposition (without pivoting) of a chunk of \f$ N \times N \f$ matrices.
+// \ingroup matrix_batch
+//
+// \param v Pointer to the interleaved elements of the batch.
+// \param spacing The spacing of the batch.
+// \param k The index of the first matrix of the chunk.
+// \param lanes The number of matrices of the chunk that belong to the batch.
+// \return \a true in case all matrices have been decomposed, \a false if a zero pivot occurred.
+*/
+template< typename PT      // Type of the batch packet
+        , size_t N         // Number of rows and columns of each matrix
+        , typename Type >  // Data type of the batch elements
+inline bool luBatchKernel( Type* v, size_t spacing, size_t k, size_t lanes )
+{
+   using V = typename PT::ValueType;
+
+   V a[N][N];
+   Type pivots[N][PT::size];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = PT::load( v+(i*N+j)*spacing+k );
+
+   const V one( PT::set( Type(1) ) );
+
+   for( size_t p=0UL; p<N; ++p )
+   {
+      PT::storeu( pivots[p], a[p][p] );
+      const V r( one / a[p][p] );
+
+      for( size_t i=p+1UL; i<N; ++i ) {
+         a[i][p] = a[i][p] * r;
+         for( size_t j=p+1UL; j<N; ++j ) {
+            a[i][j] = a[i][j] - a[i][p] * a[p][j];
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         PT::store( v+(i*N+j)*spacing+k, a[i][j] );
+
+   return checkBatchPivots( pivots, lanes );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place Cholesky decomposition of a chunk of \f$ N \times N \f$ matrices.
+// \ingroup matrix_batch
+//
+// \param v Pointer to the interleaved elements of the batch.
+// \param spacing The spacing of the batch.
+// \param k The index of the first matrix of the chunk.
+// \param lanes The number of matrices of the chunk that belong to the batch.
+// \return \a true in case all matrices have been decomposed, \a false if a matrix is not positive definite.
+*/
+template< typename PT      // Type of the batch packet
+        , size_t N         // Number of rows and columns of each matrix
+        , typename Type >  // Data type of the batch elements
+inline bool llhBatchKernel( Type* v, size_t spacing, size_t k, size_t lanes )
+{
+   using V = typename PT::ValueType;
+
+   V a[N][N];
+   Type diagonal[N][PT::size];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<=i; ++j )
+         a[i][j] = PT::load( v+(i*N+j)*spacing+k );
+
+   const V one ( PT::set( Type(1) ) );
+   const V zero( PT::set( Type(0) ) );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      V d( a[j][j] );
+      for( size_t p=0UL; p<N; ++p ) {
+         if( p == j ) break;
+         d = d - a[j][p] * a[j][p];
+      }
+      PT::storeu( diagonal[j], d );
+
+      a[j][j] = PT::sqrt( d );
+      const V r( one / a[j][j] );
+
+      for( size_t i=j+1UL; i<N; ++i ) {
+         V s( a[i][j] );
+         for( size_t p=0UL; p<N; ++p ) {
+            if( p == j ) break;
+            s = s - a[i][p] * a[j][p];
+         }
+         a[i][j] = s * r;
+      }
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         PT::store( v+(i*N+j)*spacing+k, ( j <= i ? a[i][j] : zero ) );
+
+   for( size_t p=0UL; p<N; ++p ) {
+      for( size_t l=0UL; l<lanes; ++l ) {
+         if( !( diagonal[p][l] > Type(0) ) ) return false;
+      }
+   }
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and backward substitution for a chunk of LU decomposed \f$ N \times N \f$ matrices.
+// \ingroup matrix_batch
+//
+// \param a The packets of the LU decomposed matrices.
+// \param b Pointer to the interleaved elements of the right-hand side vectors.
+// \param spacing The spacing of the batch.
+// \param k The index of the first matrix of the chunk.
+// \return void
+*/
+template< typename PT      // Type of the batch packet
+        , size_t N         // Number of rows and columns of each matrix
+        , typename Type >  // Data type of the batch elements
+inline void luSubstitution( const typename PT::ValueType (&a)[N][N], Type* b, size_t spacing, size_t k )
+{
+   using V = typename PT::ValueType;
+
+   V x[N];
+
+   for( size_t i=0UL; i<N; ++i ) {
+      x[i] = PT::load( b+i*spacing+k );
+      for( size_t j=0UL; j<i; ++j ) {
+         x[i] = x[i] - a[i][j] * x[j];
+      }
+   }
+
+   for( size_t i=N; i-- > 0UL; ) {
+      for( size_t j=i+1UL; j<N; ++j ) {
+         x[i] = x[i] - a[i][j] * x[j];
+      }
+      x[i] = x[i] / a[i][i];
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      PT::store( b+i*spacing+k, x[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a chunk of \f$ N \times N \f$ LU decomposed linear systems of equations.
+// \ingroup matrix_batch
+//
+// \param v Pointer to the interleaved elements of the LU decomposed matrices.
+// \param b Pointer to the interleaved elements of the right-hand side vectors.
+// \param spacing The spacing of the batch.
+// \param k The index of the first matrix of the chunk.
+// \return \a true.
+*/
+template< typename PT      // Type of the batch packet
+        , size_t N         // Number of rows and columns of each matrix
+        , typename Type >  // Data type of the batch elements
+inline bool luSolveBatchKernel( const Type* v, Type* b, size_t spacing, size_t k )
+{
+   using V = typename PT::ValueType;
+
+   V a[N][N];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = PT::load( v+(i*N+j)*spacing+k );
+
+   luSubstitution<PT>( a, b, spacing, k );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a chunk of \f$ N \times N \f$ Cholesky decomposed linear systems of equations.
+// \ingroup matrix_batch
+//
+// \param v Pointer to the interleaved elements of the Cholesky factors.
+// \param b Pointer to the interleaved elements of the right-hand side vectors.
+// \param spacing The spacing of the batch.
+// \param k The index of the first matrix of the chunk.
+// \return \a true.
+*/
+template< typename PT      // Type of the batch packet
+        , size_t N         // Number of rows and columns of each matrix
+        , typename Type >  // Data type of the batch elements
+inline bool llhSolveBatchKernel( const Type* v, Type* b, size_t spacing, size_t k )
+{
+   using V = typename PT::ValueType;
+
+   V a[N][N];
+   V x[N];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<=i; ++j )
+         a[i][j] = PT::load( v+(i*N+j)*spacing+k );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      x[i] = PT::load( b+i*spacing+k );
+      for( size_t j=0UL; j<i; ++j ) {
+         x[i] = x[i] - a[i][j] * x[j];
+      }
+      x[i] = x[i] / a[i][i];
+   }
+
+   for( size_t i=N; i-- > 0UL; ) {
+      for( size_t j=i+1UL; j<N; ++j ) {
+         x[i] = x[i] - a[j][i] * x[j];
+      }
+      x[i] = x[i] / a[i][i];
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      PT::store( b+i*spacing+k, x[i] );
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solution of a chunk of \f$ N \times N \f$ linear systems of equations.
+// \ingroup matrix_batch
+//
+// \param v Pointer to the interleaved elements of the system matrices.
+// \param b Pointer to the interleaved elements of the right-hand side vectors.
+// \param spacing The spacing of the batch.
+// \param k The index of the first matrix of the chunk.
+// \param lanes The number of matrices of the chunk that belong to the batch.
+// \return \a true in case all systems have been solved, \a false if a zero pivot occurred.
+//
+// This kernel combines the LU decomposition (without pivoting) and the forward and backward
+// substitution. The system matrices are not modified.
+*/
+template< typename PT      // Type of the batch packet
+        , size_t N         // Number of rows and columns of each matrix
+        , typename Type >  // Data type of the batch elements
+inline bool solveBatchKernel( const Type* v, Type* b, size_t spacing, size_t k, size_t lanes )
+{
+   using V = typename PT::ValueType;
+
+   V a[N][N];
+   Type pivots[N][PT::size];
+
+   for( size_t i=0UL; i<N; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         a[i][j] = PT::load( v+(i*N+j)*spacing+k );
+
+   const V one( PT::set( Type(1) ) );
+
+   for( size_t p=0UL; p<N; ++p )
+   {
+      PT::storeu( pivots[p], a[p][p] );
+      const V r( one / a[p][p] );
+
+      for( size_t i=p+1UL; i<N; ++i ) {
+         a[i][p] = a[i][p] * r;
+         for( size_t j=p+1UL; j<N; ++j ) {
+            a[i][j] = a[i][j] - a[i][p] * a[p][j];
+         }
+      }
+   }
+
+   luSubstitution<PT>( a, b, spacing, k );
+
+   return checkBatchPivots( pivots, lanes );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given batch kernel to all matrices of a batch.
+// \ingroup matrix_batch
+//
+// \param size The number of matrices of the batch.
+// \param kernel The batch kernel to be applied to each chunk of matrices.
+// \return \a true in case the kernel succeeded for all chunks, \a false if not.
+//
+// This function applies the given kernel to all chunks of SIMD-width many consecutive matrices
+// of a batch. In case the number of matrices is larger or equal to the SMP_MATRIXBATCH_THRESHOLD
+// the chunks are processed in parallel by means of the active SMP backend.
+*/
+template< typename PT        // Type of the batch packet
+        , typename Kernel >  // Type of the batch kernel
+bool batchFor( size_t size, const Kernel& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t chunkSize( PT::size );
+   constexpr size_t blockSize( 32UL*chunkSize );
+
+   if( size < SMP_MATRIXBATCH_THRESHOLD || size <= blockSize )
+   {
+      bool success( true );
+      for( size_t k=0UL; k<size; k+=chunkSize ) {
+         success = kernel( k, min( chunkSize, size-k ) ) && success;
+      }
+      return success;
+   }
+
+   const size_t blocks( ( size + blockSize - 1UL ) / blockSize );
+   std::vector<unsigned char> success( blocks, 1U );
+
+   smpFor( blocks, [&]( size_t block )
+   {
+      const size_t end( min( size, (block+1UL)*blockSize ) );
+      for( size_t k=block*blockSize; k<end; k+=chunkSize ) {
+         if( !kernel( k, min( chunkSize, size-k ) ) ) success[block] = 0U;
+      }
+   } );
+
+   for( unsigned char s : success ) {
+      if( !s ) return false;
+   }
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MatrixBatch functions */
+//@{
+template< typename Type, size_t N >
+void invert( MatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N >
+void lu( MatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N >
+void llh( MatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N >
+void solve( const MatrixBatch<Type,N,N>& A, VectorBatch<Type,N>& b );
+
+template< typename Type, size_t N >
+void luSolve( const MatrixBatch<Type,N,N>& LU, VectorBatch<Type,N>& b );
+
+template< typename Type, size_t N >
+void llhSolve( const MatrixBatch<Type,N,N>& L, VectorBatch<Type,N>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of all matrices of the given batch.
+// \ingroup matrix_batch
+//
+// \param A The batch of square matrices to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts all \f$ N \times N \f$ matrices of the given batch by means of a
+// Gauss-Jordan elimination. SIMD-width many matrices are processed at once by a vectorized
+// kernel and in case the batch contains at least SMP_MATRIXBATCH_THRESHOLD matrices, the
+// inversion is executed in parallel:
+
+   \code
+   blaze::MatrixBatch<double,3UL,3UL> A( 100000UL );
+   // ... Initialization
+
+   invert( A );
+   \endcode
+
+// Note that the elimination is performed without pivoting (since the pivot would differ from
+// matrix to matrix). Therefore the function is meant for well-conditioned matrices, as for
+// instance diagonally dominant or symmetric positive definite matrices. In case a zero pivot
+// is encountered for any of the matrices, a \a std::runtime_error exception is thrown. In
+// this case the content of the batch is undefined.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns of each matrix
+void invert( MatrixBatch<Type,N,N>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using PT = BatchPacket<Type>;
+
+   Type* const v( A.data() );
+   const size_t spacing( A.spacing() );
+
+   const bool success = batchFor<PT>( A.size(), [v,spacing]( size_t k, size_t lanes ) {
+      return invertBatchKernel<PT,N>( v, spacing, k, lanes );
+   } );
+
+   if( !success ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place LU decomposition of all matrices of the given batch.
+// \ingroup matrix_batch
+//
+// \param A The batch of square matrices to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the LU decomposition \f$ A = L \cdot U \f$ of all \f$ N \times N \f$
+// matrices of the given batch, where \a L is a lower unitriangular and \a U is an upper
+// triangular matrix. Both factors are stored in place of the decomposed matrix (the unit
+// diagonal of \a L is not stored). The decomposition is performed without pivoting (since the
+// pivot would differ from matrix to matrix). In case a zero pivot is encountered for any of the
+// matrices, a \a std::runtime_error exception is thrown. In this case the content of the
+// batch is undefined. The decomposed batch can be used to solve linear systems of equations by
+// means of the luSolve() function:
+
+   \code
+   blaze::MatrixBatch<double,4UL,4UL> A( 100000UL );
+   blaze::VectorBatch<double,4UL> b( 100000UL );
+   // ... Initialization
+
+   lu( A );
+   luSolve( A, b );
+   \endcode
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns of each matrix
+void lu( MatrixBatch<Type,N,N>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using PT = BatchPacket<Type>;
+
+   Type* const v( A.data() );
+   const size_t spacing( A.spacing() );
+
+   const bool success = batchFor<PT>( A.size(), [v,spacing]( size_t k, size_t lanes ) {
+      return luBatchKernel<PT,N>( v, spacing, k, lanes );
+   } );
+
+   if( !success ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Decomposition of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place Cholesky decomposition of all matrices of the given batch.
+// \ingroup matrix_batch
+//
+// \param A The batch of symmetric positive definite matrices to be decomposed.
+// \return void
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the Cholesky decomposition \f$ A = L \cdot L^T \f$ of all \f$ N
+// \times N \f$ matrices of the given batch. Only the lower part of the matrices is referenced.
+// The lower triangular factor \a L replaces the lower part of each matrix, the strictly upper
+// part is reset to zero. In case any matrix of the batch is not positive definite, a
+// \a std::invalid_argument exception is thrown. In this case the content of the batch is
+// undefined. The decomposed batch can be used to solve linear systems of equations by means of
+// the llhSolve() function:
+
+   \code
+   blaze::MatrixBatch<double,6UL,6UL> A( 100000UL );
+   blaze::VectorBatch<double,6UL> b( 100000UL );
+   // ... Initialization
+
+   llh( A );
+   llhSolve( A, b );
+   \endcode
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns of each matrix
+void llh( MatrixBatch<Type,N,N>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using PT = BatchPacket<Type>;
+
+   Type* const v( A.data() );
+   const size_t spacing( A.spacing() );
+
+   const bool success = batchFor<PT>( A.size(), [v,spacing]( size_t k, size_t lanes ) {
+      return llhBatchKernel<PT,N>( v, spacing, k, lanes );
+   } );
+
+   if( !success ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of non-positive-definite matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving all linear systems of equations of the given batches.
+// \ingroup matrix_batch
+//
+// \param A The batch of square system matrices.
+// \param b The batch of right-hand side vectors, which is overwritten by the solutions.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+// \exception std::runtime_error Solution of singular system failed.
+//
+// This function solves the linear systems of equations \f$ A_k x_k = b_k \f$ for all matrices
+// of the given batch. The solutions replace the right-hand side vectors. In contrast to a
+// combination of the lu() and luSolve() functions the system matrices are not modified and
+// each matrix is only read once. The systems are solved via an LU decomposition without
+// pivoting. In case a zero pivot is encountered for any of the matrices, a
+// \a std::runtime_error exception is thrown. In this case the content of \a b is undefined.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns of each matrix
+void solve( const MatrixBatch<Type,N,N>& A, VectorBatch<Type,N>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using PT = BatchPacket<Type>;
+
+   if( A.size() != b.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   const Type* const v( A.data() );
+   Type* const x( b.data() );
+   const size_t spacing( A.spacing() );
+
+   const bool success = batchFor<PT>( A.size(), [v,x,spacing]( size_t k, size_t lanes ) {
+      return solveBatchKernel<PT,N>( v, x, spacing, k, lanes );
+   } );
+
+   if( !success ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solution of singular system failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving all linear systems of equations of the given LU decomposed batch.
+// \ingroup matrix_batch
+//
+// \param LU The batch of LU decomposed matrices (see the lu() function).
+// \param b The batch of right-hand side vectors, which is overwritten by the solutions.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function solves the linear systems of equations \f$ L_k U_k x_k = b_k \f$ for all
+// matrices of the given batch, which has been decomposed by the lu() function. The solutions
+// replace the right-hand side vectors.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns of each matrix
+void luSolve( const MatrixBatch<Type,N,N>& LU, VectorBatch<Type,N>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using PT = BatchPacket<Type>;
+
+   if( LU.size() != b.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   const Type* const v( LU.data() );
+   Type* const x( b.data() );
+   const size_t spacing( LU.spacing() );
+
+   batchFor<PT>( LU.size(), [v,x,spacing]( size_t k, size_t ) {
+      return luSolveBatchKernel<PT,N>( v, x, spacing, k );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving all linear systems of equations of the given Cholesky decomposed batch.
+// \ingroup matrix_batch
+//
+// \param L The batch of Cholesky factors (see the llh() function).
+// \param b The batch of right-hand side vectors, which is overwritten by the solutions.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function solves the linear systems of equations \f$ L_k L_k^T x_k = b_k \f$ for all
+// matrices of the given batch, which has been decomposed by the llh() function. Only the lower
+// part of the Cholesky factors is referenced. The solutions replace the right-hand side vectors.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns of each matrix
+void llhSolve( const MatrixBatch<Type,N,N>& L, VectorBatch<Type,N>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using PT = BatchPacket<Type>;
+
+   if( L.size() != b.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   const Type* const v( L.data() );
+   Type* const x( b.data() );
+   const size_t spacing( L.spacing() );
+
+   batchFor<PT>( L.size(), [v,x,spacing]( size_t k, size_t ) {
+      return llhSolveBatchKernel<PT,N>( v, x, spacing, k );
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
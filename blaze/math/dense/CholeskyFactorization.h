@@ -0,0 +1,477 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CholeskyFactorization.h
+//  \brief Header file for the implementation of the CholeskyFactorization class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_CHOLESKYFACTORIZATION_H_
+#define _BLAZE_MATH_DENSE_CHOLESKYFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/pocon.h>
+#include <blaze/math/lapack/potrf.h>
+#include <blaze/math/lapack/potrs.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reusable Cholesky factorization of a positive definite matrix.
+// \ingroup dense_matrix
+//
+// The CholeskyFactorization class template represents the Cholesky decomposition
+// \f$ A = L \cdot L^H \f$ of a symmetric (or Hermitian) positive definite \a n-by-\a n matrix.
+// The class owns the packed Cholesky factor as computed by the LAPACK potrf() functions. After
+// the matrix has been factorized once, an arbitrary number of linear systems of equations can
+// be solved via the LAPACK potrs() functions without refactorizing the matrix. In contrast to
+// computing the inverse of the matrix (i.e. \c inv(A)*b), solving via the factorization is both
+// faster and numerically more accurate. The element type of the class template must be \c float,
+// \c double, \c complex<float>, or \c complex<double>:
+
+   \code
+   using blaze::CholeskyFactorization;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A( 100UL, 100UL );  // The positive definite system matrix
+   DynamicVector<double> b( 100UL );         // A single right-hand side vector
+   DynamicMatrix<double> B( 100UL, 20UL );   // 20 right-hand side vectors
+   // ... Initialization
+
+   CholeskyFactorization<double> llh( A );  // Factorizing the matrix A
+
+   DynamicVector<double> x( llh.solve( b ) );  // Solving A*x=b
+   DynamicMatrix<double> X( llh.solve( B ) );  // Solving A*X=B for all 20 right-hand sides
+
+   llh.solveInPlace( b );  // Solving A*x=b in-place; b is overwritten by the solution
+
+   const double d    ( llh.det()   );  // Computing the determinant of A
+   const double rcond( llh.rcond() );  // Estimating the reciprocal condition number of A
+   \endcode
+
+// Note that only the lower part of the given matrix is referenced during the factorization,
+// i.e. the matrix is assumed to be symmetric (or Hermitian). The attempt to factorize a matrix
+// that is not positive definite results in a \a std::runtime_error exception.
+//
+// \note The CholeskyFactorization class template can only be used if a fitting LAPACK library
+// is available and linked to the executable. Otherwise a call to any of its functions will
+// result in a linker error.
+//
+// \note A single CholeskyFactorization instance must not be used concurrently by several threads.
+*/
+template< typename Type >  // Data type of the matrix elements
+class CholeskyFactorization
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Type of the matrix elements.
+   using BuiltinType = UnderlyingElement_<Type>;         //!< Underlying builtin element type.
+   using FactorType  = DynamicMatrix<Type,columnMajor>;  //!< Type of the packed Cholesky factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CholeskyFactorization();
+
+   template< typename MT, bool SO >
+   explicit inline CholeskyFactorization( const DenseMatrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void factorize( const DenseMatrix<MT,SO>& A );
+
+   inline size_t            size   () const noexcept;
+   inline const FactorType& factors() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT, bool TF >
+   inline DynamicVector<Type,TF> solve( const DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   inline DynamicMatrix<Type,SO> solve( const DenseMatrix<MT,SO>& B ) const;
+
+   template< typename VT, bool TF >
+   inline void solveInPlace( DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   inline void solveInPlace( DenseMatrix<MT,SO>& B ) const;
+
+   inline Type        det  () const;
+   inline BuiltinType rcond() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   FactorType              llh_;    //!< The packed Cholesky factor of the matrix.
+   BuiltinType             anorm_;  //!< The 1-norm of the factorized matrix.
+   mutable LAPACKWorkspace ws_;     //!< The workspace for the auxiliary LAPACK memory.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CholeskyFactorization.
+//
+// The default constructor creates the factorization of an empty 0-by-0 matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline CholeskyFactorization<Type>::CholeskyFactorization()
+   : llh_  ()  // The packed Cholesky factor of the matrix
+   , anorm_()  // The 1-norm of the factorized matrix
+   , ws_   ()  // The workspace for the auxiliary LAPACK memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the Cholesky factorization of the given positive definite matrix.
+//
+// \param A The given symmetric (or Hermitian) positive definite matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This constructor computes the Cholesky factorization of the given positive definite matrix
+// \a A. In case \a A is not a square matrix, a \a std::invalid_argument exception is thrown.
+// In case \a A is not positive definite, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline CholeskyFactorization<Type>::CholeskyFactorization( const DenseMatrix<MT,SO>& A )
+   : CholeskyFactorization()
+{
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computing the Cholesky factorization of the given positive definite matrix.
+//
+// \param A The given symmetric (or Hermitian) positive definite matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the Cholesky factorization of the given positive definite matrix \a A
+// and replaces any previously computed factorization. Only the lower part of \a A is referenced.
+// Note that the memory of the previous factorization is reused in case \a A has the same size.
+// In case \a A is not a square matrix, a \a std::invalid_argument exception is thrown. In case
+// \a A is not positive definite, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline void CholeskyFactorization<Type>::factorize( const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, Type );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   llh_ = ~A;
+
+   anorm_ = BuiltinType();
+   for( size_t j=0UL; j<n; ++j ) {
+      BuiltinType sum{};
+      for( size_t i=0UL; i<j; ++i ) {
+         sum += abs( llh_(j,i) );
+      }
+      for( size_t i=j; i<n; ++i ) {
+         sum += abs( llh_(i,j) );
+      }
+      if( sum > anorm_ ) anorm_ = sum;
+   }
+
+   try {
+      potrf( llh_, 'L' );
+   }
+   catch( ... ) {
+      llh_.clear();
+      throw;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the factorized matrix.
+//
+// \return The number of rows/columns of the factorized matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t CholeskyFactorization<Type>::size() const noexcept
+{
+   return llh_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the packed Cholesky factor of the factorized matrix.
+//
+// \return The packed Cholesky factor as computed by the potrf() functions.
+//
+// The lower part of the returned column-major matrix contains the lower triangular Cholesky
+// factor \a L. The strictly upper part contains the according elements of the original matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename CholeskyFactorization<Type>::FactorType&
+   CholeskyFactorization<Type>::factors() const noexcept
+{
+   return llh_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ for the given right-hand side vector.
+//
+// \param b The right-hand side vector.
+// \return The solution vector \a x.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+inline DynamicVector<Type,TF> CholeskyFactorization<Type>::solve( const DenseVector<VT,TF>& b ) const
+{
+   DynamicVector<Type,TF> x( ~b );
+   solveInPlace( x );
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*X=B \f$ for the given right-hand side matrix.
+//
+// \param B The matrix of right-hand sides (one right-hand side per column).
+// \return The solution matrix \a X.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// This function solves the linear system for all columns of \a B at once. Thus it is
+// considerably more efficient than solving for each right-hand side separately.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO> CholeskyFactorization<Type>::solve( const DenseMatrix<MT,SO>& B ) const
+{
+   DynamicMatrix<Type,SO> X( ~B );
+   solveInPlace( X );
+   return X;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of the linear system \f$ A*x=b \f$.
+//
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+inline void CholeskyFactorization<Type>::solveInPlace( DenseVector<VT,TF>& b ) const
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<VT>, Type );
+
+   if( (~b).size() != llh_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   potrs( llh_, ~b, 'L' );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of the linear system \f$ A*X=B \f$.
+//
+// \param B The matrix of right-hand sides (one per column), which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// Column-major right-hand side matrices are solved directly. Row-major right-hand side matrices
+// require a temporary column-major copy of \a B.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline void CholeskyFactorization<Type>::solveInPlace( DenseMatrix<MT,SO>& B ) const
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, Type );
+
+   if( (~B).rows() != llh_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( IsRowMajorMatrix<MT>::value ) {
+      DynamicMatrix<Type,columnMajor> X( ~B );
+      potrs( llh_, X, 'L' );
+      ~B = X;
+   }
+   else {
+      potrs( llh_, ~B, 'L' );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the determinant of the factorized matrix.
+//
+// \return The determinant of the factorized matrix.
+//
+// The determinant is computed as the squared product of the diagonal elements of the Cholesky
+// factor \a L. The determinant of a 0-by-0 matrix is 1.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline Type CholeskyFactorization<Type>::det() const
+{
+   const size_t n( llh_.rows() );
+
+   Type d( 1 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      d *= llh_(i,i);
+   }
+
+   return d*d;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Estimates the reciprocal condition number of the factorized matrix.
+//
+// \return The estimate of the reciprocal condition number in the 1-norm.
+//
+// This function estimates the reciprocal of the condition number of the factorized matrix in
+// the 1-norm via the LAPACK pocon() functions. In case the returned value is close to zero,
+// the matrix is close to singular. For a 0-by-0 matrix the function returns 1.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename CholeskyFactorization<Type>::BuiltinType CholeskyFactorization<Type>::rcond() const
+{
+   return pocon( llh_, 'L', anorm_, ws_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -2145,7 +2145,7 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline bool CustomMatrix<Type,AF,PF,SO>::isAligned() const noexcept
 {
-   return ( AF || ( checkAlignment( v_ ) && columns() % SIMDSIZE == 0UL ) );
+   return ( AF || ( checkAlignment( v_ ) && nn_ % SIMDSIZE == 0UL ) );
 }
 //*************************************************************************************************
 
@@ -5030,7 +5030,7 @@ template< typename Type  // Data type of the matrix
         , bool PF >      // Padding flag
 inline bool CustomMatrix<Type,AF,PF,true>::isAligned() const noexcept
 {
-   return ( AF || ( checkAlignment( v_ ) && rows() % SIMDSIZE == 0UL ) );
+   return ( AF || ( checkAlignment( v_ ) && mm_ % SIMDSIZE == 0UL ) );
 }
 /*! \endcond */
 //*************************************************************************************************
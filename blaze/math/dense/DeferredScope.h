@@ -0,0 +1,1032 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DeferredScope.h
+//  \brief Header file for the deferred evaluation of dense vector operations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DEFERREDSCOPE_H_
+#define _BLAZE_MATH_DENSE_DEFERREDSCOPE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecDVecMultExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFERREDSTATEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Base class for all statements of a deferred scope.
+// \ingroup dense_vector
+//
+// The DeferredStatement class represents the interface of a single statement recorded by a
+// DeferredScope. A statement is evaluated block by block, where each block is a consecutive
+// range of indices of the involved dense vectors. In order to detect conflicts between the
+// statements of a scope, each statement provides the address of its target vector and the
+// information whether it accesses a given vector non-element-wise, i.e. at indices outside
+// of the currently evaluated block.
+*/
+class DeferredStatement
+{
+ public:
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor of the DeferredStatement class.
+   */
+   virtual ~DeferredStatement() = default;
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   virtual size_t      size() const noexcept = 0;
+   virtual const void* target() const noexcept = 0;
+   virtual bool        canSMPAssign() const noexcept = 0;
+   virtual bool        hasNonElementwiseAccess( const void* alias ) const = 0;
+   virtual void        evaluate( size_t block, size_t index, size_t size ) = 0;
+   virtual void        finalize() = 0;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFERREDASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deferred (compound) assignment of a dense vector to a dense vector.
+// \ingroup dense_vector
+//
+// The DeferredAssignment class template represents a deferred assignment of a dense vector
+// (expression) to a dense vector. The kind of the assignment is specified by the functor \a OP,
+// which performs the (compound) assignment of a single block.
+*/
+template< typename VT1   // Type of the left-hand side dense vector
+        , typename VT2   // Type of the right-hand side dense vector
+        , typename OP >  // Type of the assignment operation
+class DeferredAssignment
+   : public DeferredStatement
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side dense vector.
+   using Operand = If_< IsExpression<VT2>, const VT2, const VT2& >;
+   //**********************************************************************************************
+
+   //! Compilation switch for the vectorized evaluation of the assignment.
+   enum : bool { simdEnabled = VT1::simdEnabled && VT2::simdEnabled };
+
+   //! Compilation switch for the parallel evaluation of the assignment.
+   enum : bool { smpAssignable = VT1::smpAssignable && VT2::smpAssignable };
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DeferredAssignment class template.
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side dense vector.
+   */
+   explicit inline DeferredAssignment( VT1& lhs, const VT2& rhs )
+      : lhs_( lhs )  // The target left-hand side dense vector
+      , rhs_( rhs )  // The right-hand side dense vector
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the size of the target vector.
+   //
+   // \return The size of the target vector.
+   */
+   inline size_t size() const noexcept override {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**Target function*****************************************************************************
+   /*!\brief Returns the address of the target vector.
+   //
+   // \return The address of the target vector.
+   */
+   inline const void* target() const noexcept override {
+      return &lhs_;
+   }
+   //**********************************************************************************************
+
+   //**CanSMPAssign function***********************************************************************
+   /*!\brief Returns whether the assignment can be evaluated in parallel.
+   //
+   // \return \a true in case the assignment can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept override {
+      return smpAssignable;
+   }
+   //**********************************************************************************************
+
+   //**HasNonElementwiseAccess function************************************************************
+   /*!\brief Returns whether the given vector is accessed non-element-wise by the assignment.
+   //
+   // \param alias The address of the vector to be checked.
+   // \return \a true in case the vector is accessed non-element-wise, \a false if not.
+   */
+   inline bool hasNonElementwiseAccess( const void* alias ) const override {
+      return IsExpression<VT2>::value && rhs_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Evaluates the assignment for the given block of elements.
+   //
+   // \param block The index of the block (unused).
+   // \param index The index of the first element of the block.
+   // \param size The number of elements of the block.
+   // \return void
+   */
+   inline void evaluate( size_t block, size_t index, size_t size ) override
+   {
+      UNUSED_PARAMETER( block );
+
+      const bool lhsAligned( lhs_.isAligned() );
+      const bool rhsAligned( rhs_.isAligned() );
+
+      if( simdEnabled && lhsAligned && rhsAligned ) {
+         auto target( subvector<aligned>( lhs_, index, size ) );
+         OP()( target, subvector<aligned>( rhs_, index, size ) );
+      }
+      else if( simdEnabled && lhsAligned ) {
+         auto target( subvector<aligned>( lhs_, index, size ) );
+         OP()( target, subvector<unaligned>( rhs_, index, size ) );
+      }
+      else if( simdEnabled && rhsAligned ) {
+         auto target( subvector<unaligned>( lhs_, index, size ) );
+         OP()( target, subvector<aligned>( rhs_, index, size ) );
+      }
+      else {
+         auto target( subvector<unaligned>( lhs_, index, size ) );
+         OP()( target, subvector<unaligned>( rhs_, index, size ) );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Completes the assignment after all blocks have been evaluated.
+   //
+   // \return void
+   */
+   inline void finalize() override
+   {}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&    lhs_;  //!< The target left-hand side dense vector.
+   Operand rhs_;  //!< The right-hand side dense vector.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFERREDREDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Deferred reduction of a dense vector.
+// \ingroup dense_vector
+//
+// The DeferredReduction class template represents a deferred reduction of a dense vector
+// (expression). Each block is reduced to a partial result, which are combined in ascending
+// order of the blocks. Therefore the result of the reduction does not depend on the number
+// of threads.
+*/
+template< typename T     // Type of the target value
+        , typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+class DeferredReduction
+   : public DeferredStatement
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ET = ElementType_<VT>;  //!< Element type of the dense vector.
+
+   //! Composite type of the dense vector.
+   using Operand = If_< IsExpression<VT>, const VT, const VT& >;
+   //**********************************************************************************************
+
+   //! Compilation switch for the vectorized evaluation of the reduction.
+   enum : bool { simdEnabled = VT::simdEnabled };
+
+   //! Compilation switch for the parallel evaluation of the reduction.
+   enum : bool { smpAssignable = VT::smpAssignable };
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DeferredReduction class template.
+   //
+   // \param target The target value the result of the reduction is assigned to.
+   // \param dv The dense vector to be reduced.
+   // \param op The reduction operation.
+   // \param blocks The number of blocks of the evaluation.
+   */
+   explicit inline DeferredReduction( T& target, const VT& dv, OP op, size_t blocks )
+      : target_  ( target )  // The target value
+      , dv_      ( dv     )  // The dense vector to be reduced
+      , op_      ( op     )  // The reduction operation
+      , partials_( blocks )  // The partial results of the blocks
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the size of the reduced vector.
+   //
+   // \return The size of the reduced vector.
+   */
+   inline size_t size() const noexcept override {
+      return dv_.size();
+   }
+   //**********************************************************************************************
+
+   //**Target function*****************************************************************************
+   /*!\brief Returns the address of the target vector.
+   //
+   // \return \a nullptr since the target of a reduction is a scalar value.
+   */
+   inline const void* target() const noexcept override {
+      return nullptr;
+   }
+   //**********************************************************************************************
+
+   //**CanSMPAssign function***********************************************************************
+   /*!\brief Returns whether the reduction can be evaluated in parallel.
+   //
+   // \return \a true in case the reduction can be evaluated in parallel, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept override {
+      return smpAssignable;
+   }
+   //**********************************************************************************************
+
+   //**HasNonElementwiseAccess function************************************************************
+   /*!\brief Returns whether the given vector is accessed non-element-wise by the reduction.
+   //
+   // \param alias The address of the vector to be checked.
+   // \return \a true in case the vector is accessed non-element-wise, \a false if not.
+   */
+   inline bool hasNonElementwiseAccess( const void* alias ) const override {
+      return IsExpression<VT>::value && dv_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**Evaluate function***************************************************************************
+   /*!\brief Computes the partial result of the given block of elements.
+   //
+   // \param block The index of the block.
+   // \param index The index of the first element of the block.
+   // \param size The number of elements of the block.
+   // \return void
+   */
+   inline void evaluate( size_t block, size_t index, size_t size ) override
+   {
+      if( simdEnabled && dv_.isAligned() ) {
+         partials_[block] = dvecreduce( subvector<aligned>( dv_, index, size ), op_ );
+      }
+      else {
+         partials_[block] = dvecreduce( subvector<unaligned>( dv_, index, size ), op_ );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Finalize function***************************************************************************
+   /*!\brief Combines the partial results and assigns the result to the target value.
+   //
+   // \return void
+   */
+   inline void finalize() override
+   {
+      if( partials_.empty() ) {
+         target_ = ET();
+         return;
+      }
+
+      ET redux( partials_[0UL] );
+      for( size_t i=1UL; i<partials_.size(); ++i ) {
+         redux = op_( redux, partials_[i] );
+      }
+
+      target_ = redux;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T&              target_;    //!< The target value.
+   Operand         dv_;        //!< The dense vector to be reduced.
+   OP              op_;        //!< The reduction operation.
+   std::vector<ET> partials_;  //!< The partial results of the blocks.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the deferred assignment of a single block.
+// \ingroup dense_vector
+*/
+struct DeferredAssign
+{
+   template< typename VT1, typename VT2 >
+   inline void operator()( VT1& lhs, const VT2& rhs ) const { assign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the deferred addition assignment of a single block.
+// \ingroup dense_vector
+*/
+struct DeferredAddAssign
+{
+   template< typename VT1, typename VT2 >
+   inline void operator()( VT1& lhs, const VT2& rhs ) const { addAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the deferred subtraction assignment of a single block.
+// \ingroup dense_vector
+*/
+struct DeferredSubAssign
+{
+   template< typename VT1, typename VT2 >
+   inline void operator()( VT1& lhs, const VT2& rhs ) const { subAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the deferred multiplication assignment of a single block.
+// \ingroup dense_vector
+*/
+struct DeferredMultAssign
+{
+   template< typename VT1, typename VT2 >
+   inline void operator()( VT1& lhs, const VT2& rhs ) const { multAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the deferred division assignment of a single block.
+// \ingroup dense_vector
+*/
+struct DeferredDivAssign
+{
+   template< typename VT1, typename VT2 >
+   inline void operator()( VT1& lhs, const VT2& rhs ) const { divAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFERREDSCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope for the deferred, fused evaluation of dense vector operations.
+// \ingroup dense_vector
+//
+// By default, each statement of the form \c y = ... is evaluated immediately and in isolation.
+// Therefore a sequence of element-wise operations on large dense vectors, as for instance the
+// update steps of a conjugate gradient solver, streams every involved vector from main memory
+// once per statement. The DeferredScope class collects several dense vector assignments and
+// reductions and evaluates them in a single, fused pass: The index range of the vectors is
+// split into cache-sized blocks and for each block all recorded statements are evaluated in
+// the order of their recording. This way each block of the involved vectors is loaded only
+// once from main memory. The evaluation of each block is vectorized and the blocks are
+// distributed among the threads of the active shared-memory parallelization:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, r, d, h;
+   double alpha, beta, dh;
+   // ... Resizing and initialization
+
+   {
+      blaze::DeferredScope scope;
+      scope.assign( h, A * d );   // Deferred assignment h = A * d
+      scope.dot( dh, d, h );      // Deferred dot product of d and h
+      scope.evaluate();           // Explicit fused evaluation of both statements
+   }
+
+   alpha = delta / dh;
+
+   blaze::DeferredScope scope;
+   scope.addAssign( x, alpha * d );  // Deferred addition assignment x += alpha * d
+   scope.addAssign( r, alpha * h );  // Deferred addition assignment r += alpha * h
+   scope.dot( beta, r, r );          // Deferred squared norm of r
+   scope.evaluate();                 // Explicit fused evaluation of all three statements
+   \endcode
+
+// All statements are evaluated either by an explicit call to the evaluate() function or at the
+// end of the scope. Until then, none of the target vectors and values is modified. Note that
+// scalar factors are captured at the time a statement is recorded, whereas all vector operands
+// are referenced and must not be destroyed or resized before the evaluation. Since a destructor
+// cannot report errors, the evaluate() function should be called explicitly in case errors
+// during the evaluation have to be handled. Also note that the pending statements are evaluated
+// at the end of the scope even in case the scope is left due to an exception.
+//
+// Since all statements are evaluated block by block, two statements cannot be fused in case one
+// of them accesses the target vector of the other one non-element-wise, i.e. at indices outside
+// of the currently evaluated block, as for instance as operand of a matrix/vector multiplication.
+// In this case all pending statements are evaluated before the new statement is recorded:
+
+   \code
+   blaze::DeferredScope scope;
+   scope.subAssign( r, alpha * h );  // Deferred subtraction assignment r -= alpha * h
+   scope.assign( z, M * r );         // Evaluation of r -= alpha * h, deferred assignment z = M * r
+   scope.evaluate();
+   \endcode
+
+// A statement that accesses its own target vector non-element-wise (as for instance \c x = A * x)
+// is evaluated immediately after all pending statements. Therefore the result of the statements
+// of a scope is equal to the result of their sequential evaluation. Note however that aliasing
+// is detected on the level of the target vectors (see the \c canAlias() function of vector and
+// matrix expressions). Therefore views (e.g. subvectors) must not be used as targets in case
+// they are accessed non-element-wise within the same scope. Also, all vectors of a scope are
+// required to have the same size. Furthermore, in contrast to a sequential evaluation, the
+// result of a reduction is not available to the subsequent statements of the same scope.
+//
+// The order of the reduction of different blocks is unspecified. Therefore the operation of a
+// reduction is required to be associative and commutative. Note however that the partial
+// results of the blocks are always combined in the same order, i.e. the results of a reduction
+// do not depend on the number of threads.
+*/
+class DeferredScope
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the container for the recorded statements.
+   using Statements = std::vector< std::unique_ptr<DeferredStatement> >;
+   //**********************************************************************************************
+
+ public:
+   //**Constants***********************************************************************************
+   //! The number of elements of each block of the fused evaluation.
+   enum : size_t { blockSize = 2048UL };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline DeferredScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~DeferredScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment functions************************************************************************
+   /*!\name Assignment functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   inline void assign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void addAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void subAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void multAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void divAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Reduction functions*************************************************************************
+   /*!\name Reduction functions */
+   //@{
+   template< typename T, typename VT, bool TF, typename OP >
+   inline void reduce( T& result, const DenseVector<VT,TF>& dv, OP op );
+
+   template< typename T, typename VT1, bool TF, typename VT2 >
+   inline void dot( T& result, const DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline void   evaluate();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename OP, typename VT1, bool TF, typename VT2 >
+   inline void record( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+   inline void record( std::unique_ptr<DeferredStatement> statement );
+   inline void checkSize( size_t n ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Statements statements_;  //!< The recorded, not yet evaluated statements.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the DeferredScope class.
+*/
+inline DeferredScope::DeferredScope()
+   : statements_()  // The recorded, not yet evaluated statements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the DeferredScope class.
+//
+// The destructor evaluates all recorded statements, which have not yet been evaluated. Since
+// the destructor must not throw, an error during the evaluation is only reported by means of
+// an assertion. In order to handle errors, the evaluate() function has to be called explicitly.
+*/
+inline DeferredScope::~DeferredScope()
+{
+   try {
+      evaluate();
+   }
+   catch( ... ) {
+      BLAZE_USER_ASSERT( false, "Evaluation of the pending statements failed" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the deferred assignment of a dense vector to a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the assignment \c lhs = \c rhs. In case the sizes of the two vectors
+// don't match or in case the size doesn't match the size of the previously recorded statements,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void DeferredScope::assign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   record<DeferredAssign>( lhs, rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the deferred addition assignment of a dense vector to a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the addition assignment \c lhs += \c rhs. In case the sizes of the two
+// vectors don't match or in case the size doesn't match the size of the previously recorded
+// statements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void DeferredScope::addAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   record<DeferredAddAssign>( lhs, rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the deferred subtraction assignment of a dense vector to a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the subtraction assignment \c lhs -= \c rhs. In case the sizes of the
+// two vectors don't match or in case the size doesn't match the size of the previously recorded
+// statements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void DeferredScope::subAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   record<DeferredSubAssign>( lhs, rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the deferred componentwise multiplication assignment of a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the componentwise multiplication assignment \c lhs *= \c rhs. In case
+// the sizes of the two vectors don't match or in case the size doesn't match the size of the
+// previously recorded statements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void DeferredScope::multAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   record<DeferredMultAssign>( lhs, rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the deferred componentwise division assignment of a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the componentwise division assignment \c lhs /= \c rhs. In case the
+// sizes of the two vectors don't match or in case the size doesn't match the size of the
+// previously recorded statements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void DeferredScope::divAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   record<DeferredDivAssign>( lhs, rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the deferred reduction of a dense vector.
+//
+// \param result The target value the result of the reduction is assigned to.
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the reduction of the given dense vector by means of the given
+// reduction operation (see the reduce() function). The result is assigned to \a result as
+// soon as the scope is evaluated. In case the size of the vector doesn't match the size of
+// the previously recorded statements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename T     // Type of the target value
+        , typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline void DeferredScope::reduce( T& result, const DenseVector<VT,TF>& dv, OP op )
+{
+   const size_t blocks( ( (~dv).size() + blockSize - 1UL ) / blockSize );
+
+   record( std::make_unique< DeferredReduction<T,VT,OP> >( result, ~dv, op, blocks ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the deferred dot product of two dense vectors.
+//
+// \param result The target value the dot product is assigned to.
+// \param lhs The left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function records the dot product (inner product) of the two given dense vectors. The
+// result is assigned to \a result as soon as the scope is evaluated. In case the sizes of the
+// two vectors don't match or in case the size doesn't match the size of the previously recorded
+// statements, a \a std::invalid_argument exception is thrown.
+*/
+template< typename T      // Type of the target value
+        , typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void DeferredScope::dot( T& result, const DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   reduce( result, (~lhs) * (~rhs), Add() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of recorded, not yet evaluated statements.
+//
+// \return The number of pending statements.
+*/
+inline size_t DeferredScope::size() const noexcept
+{
+   return statements_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fused evaluation of all recorded statements.
+//
+// \return void
+//
+// This function evaluates all recorded statements in a single pass over the involved dense
+// vectors. The statements are evaluated block by block and for each block in the order of
+// their recording. In case the vectors are large enough (see the \c BLAZE_SMP_DVECASSIGN_THRESHOLD
+// threshold), the blocks are evaluated in parallel. After the evaluation, the scope is empty
+// and can be used to record further statements.
+*/
+inline void DeferredScope::evaluate()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( statements_.empty() )
+      return;
+
+   const Statements statements( std::move( statements_ ) );
+   statements_.clear();
+
+   const size_t n     ( statements.front()->size() );
+   const size_t blocks( ( n + blockSize - 1UL ) / blockSize );
+
+   bool smpAssignable( n >= SMP_DVECASSIGN_THRESHOLD );
+   for( const auto& statement : statements ) {
+      smpAssignable = smpAssignable && statement->canSMPAssign();
+   }
+
+   const auto evaluateBlock = [&statements,n]( size_t block )
+   {
+      const size_t index( block*blockSize );
+      const size_t size ( min( n - index, size_t( blockSize ) ) );
+
+      for( const auto& statement : statements ) {
+         statement->evaluate( block, index, size );
+      }
+   };
+
+   if( smpAssignable ) {
+      smpFor( blocks, evaluateBlock );
+   }
+   else {
+      for( size_t block=0UL; block<blocks; ++block ) {
+         evaluateBlock( block );
+      }
+   }
+
+   for( const auto& statement : statements ) {
+      statement->finalize();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the deferred (compound) assignment of a dense vector to a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the right-hand side dense vector accesses the target vector non-element-wise, the
+// assignment cannot be evaluated block by block. In this case all pending statements and the
+// assignment are evaluated immediately, where the right-hand side is evaluated into a temporary.
+*/
+template< typename OP     // Type of the assignment operation
+        , typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void DeferredScope::record( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( IsExpression<VT2>::value && (~rhs).canAlias( &~lhs ) )
+   {
+      checkSize( (~lhs).size() );
+      evaluate();
+
+      const ResultType_<VT2> tmp( ~rhs );
+      OP()( ~lhs, tmp );
+   }
+   else {
+      record( std::make_unique< DeferredAssignment<VT1,VT2,OP> >( ~lhs, ~rhs ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the given statement.
+//
+// \param statement The statement to be recorded.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the given statement accesses the target vector of a pending statement non-element-wise
+// or vice versa, the statement cannot be fused with the pending statements. In this case all
+// pending statements are evaluated before the statement is recorded.
+*/
+inline void DeferredScope::record( std::unique_ptr<DeferredStatement> statement )
+{
+   checkSize( statement->size() );
+
+   for( const auto& pending : statements_ ) {
+      if( statement->hasNonElementwiseAccess( pending->target() ) ||
+          pending->hasNonElementwiseAccess( statement->target() ) ) {
+         evaluate();
+         break;
+      }
+   }
+
+   statements_.push_back( std::move( statement ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the given size against the size of the pending statements.
+//
+// \param n The size of a new statement.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+inline void DeferredScope::checkSize( size_t n ) const
+{
+   if( !statements_.empty() && n != statements_.front()->size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -67,8 +67,6 @@
 #include <blaze/math/typetraits/IsUniTriangular.h>
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
-#include <blaze/util/algorithms/Max.h>
-#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FalseType.h>
@@ -605,12 +603,6 @@ bool isDiagonal( const DenseMatrix<MT,SO>& dm );
 
 template< bool RF, typename MT, bool SO >
 bool isIdentity( const DenseMatrix<MT,SO>& dm );
-
-template< typename MT, bool SO >
-const ElementType_<MT> min( const DenseMatrix<MT,SO>& dm );
-
-template< typename MT, bool SO >
-const ElementType_<MT> max( const DenseMatrix<MT,SO>& dm );
 //@}
 //*************************************************************************************************
 
@@ -1744,100 +1736,6 @@ bool isIdentity( const DenseMatrix<MT,SO>& dm )
 }
 //*************************************************************************************************
 
-
-//*************************************************************************************************
-/*!\brief Returns the smallest element of the dense matrix.
-// \ingroup dense_matrix
-//
-// \param dm The given dense matrix.
-// \return The smallest dense matrix element.
-//
-// This function returns the smallest element of the given dense matrix. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// matrix currently has either 0 rows or 0 columns, the returned value is the default value
-// (e.g. 0 in case of fundamental data types).
-*/
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Storage order
-const ElementType_<MT> min( const DenseMatrix<MT,SO>& dm )
-{
-   using blaze::min;
-
-   using ET = ElementType_<MT>;
-   using CT = CompositeType_<MT>;
-
-   CT A( ~dm );  // Evaluation of the dense matrix operand
-
-   if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
-
-   ET minimum( A(0,0) );
-
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         minimum = min( minimum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            minimum = min( minimum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         minimum = min( minimum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            minimum = min( minimum, A(i,j) );
-   }
-
-   return minimum;
-}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Returns the largest element of the dense matrix.
-// \ingroup dense_matrix
-//
-// \param dm The given dense matrix.
-// \return The largest dense matrix element.
-//
-// This function returns the largest element of the given dense matrix. This function can
-// only be used for element types that support the smaller-than relationship. In case the
-// matrix currently has either 0 rows or 0 columns, the returned value is the default value
-// (e.g. 0 in case of fundamental data types).
-*/
-template< typename MT  // Type of the dense matrix
-        , bool SO >    // Transpose flag
-const ElementType_<MT> max( const DenseMatrix<MT,SO>& dm )
-{
-   using blaze::max;
-
-   using ET = ElementType_<MT>;
-   using CT = CompositeType_<MT>;
-
-   CT A( ~dm );  // Evaluation of the dense matrix operand
-
-   if( A.rows() == 0UL || A.columns() == 0UL ) return ET();
-
-   ET maximum( A(0,0) );
-
-   if( SO == rowMajor ) {
-      for( size_t j=1UL; j<A.columns(); ++j )
-         maximum = max( maximum, A(0UL,j) );
-      for( size_t i=1UL; i<A.rows(); ++i )
-         for( size_t j=0UL; j<A.columns(); ++j )
-            maximum = max( maximum, A(i,j) );
-   }
-   else {
-      for( size_t i=1UL; i<A.rows(); ++i )
-         maximum = max( maximum, A(i,0UL) );
-      for( size_t j=1UL; j<A.columns(); ++j )
-         for( size_t i=0UL; i<A.rows(); ++i )
-            maximum = max( maximum, A(i,j) );
-   }
-
-   return maximum;
-}
-//*************************************************************************************************
-
 } // namespace blaze
 
 #endif
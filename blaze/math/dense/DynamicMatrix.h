@@ -572,11 +572,11 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                               // The current number of rows of the matrix
+   , n_       ( n )                                               // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )                                 // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
@@ -603,11 +603,11 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                               // The current number of rows of the matrix
+   , n_       ( n )                                               // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )                                 // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    for( size_t i=0UL; i<m; ++i ) {
       for( size_t j=0UL; j<n_; ++j )
@@ -647,11 +647,11 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
-   : m_       ( list.size() )                  // The current number of rows of the matrix
-   , n_       ( determineColumns( list ) )     // The current number of columns of the matrix
-   , nn_      ( addPadding( n_ ) )             // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( list.size() )                                     // The current number of rows of the matrix
+   , n_       ( determineColumns( list ) )                        // The current number of columns of the matrix
+   , nn_      ( addPadding( n_ ) )                                // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    size_t i( 0UL );
 
@@ -692,11 +692,11 @@ template< typename Type     // Data type of the matrix
         , bool SO >         // Storage order
 template< typename Other >  // Data type of the initialization array
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Other* array )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                               // The current number of rows of the matrix
+   , n_       ( n )                                               // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )                                 // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    for( size_t i=0UL; i<m; ++i ) {
       for( size_t j=0UL; j<n; ++j )
@@ -740,11 +740,11 @@ template< typename Other  // Data type of the initialization array
         , size_t Rows     // Number of rows of the initialization array
         , size_t Cols >   // Number of columns of the initialization array
 inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[Rows][Cols] )
-   : m_       ( Rows )                         // The current number of rows of the matrix
-   , n_       ( Cols )                         // The current number of columns of the matrix
-   , nn_      ( addPadding( Cols ) )           // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( Rows )                                            // The current number of rows of the matrix
+   , n_       ( Cols )                                            // The current number of columns of the matrix
+   , nn_      ( addPadding( Cols ) )                              // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    for( size_t i=0UL; i<Rows; ++i ) {
       for( size_t j=0UL; j<Cols; ++j )
@@ -772,11 +772,11 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[Rows][Cols] )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
-   : m_       ( m.m_  )                        // The current number of rows of the matrix
-   , n_       ( m.n_  )                        // The current number of columns of the matrix
-   , nn_      ( m.nn_ )                        // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m.m_  )                                           // The current number of rows of the matrix
+   , n_       ( m.n_  )                                           // The current number of columns of the matrix
+   , nn_      ( m.nn_ )                                           // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
@@ -821,11 +821,11 @@ template< typename Type  // Data type of the matrix
 template< typename MT    // Type of the foreign matrix
         , bool SO2 >     // Storage order of the foreign matrix
 inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
-   : m_       ( (~m).rows() )                  // The current number of rows of the matrix
-   , n_       ( (~m).columns() )               // The current number of columns of the matrix
-   , nn_      ( addPadding( n_ ) )             // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( (~m).rows() )                                     // The current number of rows of the matrix
+   , n_       ( (~m).columns() )                                  // The current number of columns of the matrix
+   , nn_      ( addPadding( n_ ) )                                // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    for( size_t i=0UL; i<m_; ++i ) {
       for( size_t j=( IsSparseMatrix<MT>::value   ? 0UL : n_ );
@@ -1808,7 +1808,7 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn, denseMatrixMemory );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -1821,7 +1821,7 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       capacity_ = m*nn;
    }
    else if( m*nn > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn, denseMatrixMemory );
       std::swap( v_, v );
       deallocate( v );
       capacity_ = m*nn;
@@ -1879,7 +1879,7 @@ inline void DynamicMatrix<Type,SO>::reserve( size_t elements )
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements, denseMatrixMemory );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -3633,11 +3633,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                               // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )                                 // The alignment adjusted number of rows
+   , n_       ( n )                                               // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j ) {
@@ -3665,11 +3665,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                               // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )                                 // The alignment adjusted number of rows
+   , n_       ( n )                                               // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    for( size_t j=0UL; j<n_; ++j ) {
       for( size_t i=0UL; i<m_; ++i )
@@ -3710,11 +3710,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( initializer_list< initializer_list<Type> > list )
-   : m_       ( list.size() )                  // The current number of rows of the matrix
-   , mm_      ( addPadding( m_ ) )             // The alignment adjusted number of rows
-   , n_       ( determineColumns( list ) )     // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( list.size() )                                     // The current number of rows of the matrix
+   , mm_      ( addPadding( m_ ) )                                // The alignment adjusted number of rows
+   , n_       ( determineColumns( list ) )                        // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    size_t i( 0UL );
 
@@ -3773,11 +3773,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( initializer_list< initializer_li
 template< typename Type >   // Data type of the matrix
 template< typename Other >  // Data type of the initialization array
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Other* array )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m )                                               // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )                                 // The alignment adjusted number of rows
+   , n_       ( n )                                               // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    for( size_t j=0UL; j<n; ++j ) {
       for( size_t i=0UL; i<m; ++i )
@@ -3822,11 +3822,11 @@ template< typename Other   // Data type of the initialization array
         , size_t Rows      // Number of rows of the initialization array
         , size_t Cols >    // Number of columns of the initialization array
 inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[Rows][Cols] )
-   : m_       ( Rows )                         // The current number of rows of the matrix
-   , mm_      ( addPadding( Rows ) )           // The alignment adjusted number of rows
-   , n_       ( Cols )                         // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( Rows )                                            // The current number of rows of the matrix
+   , mm_      ( addPadding( Rows ) )                              // The alignment adjusted number of rows
+   , n_       ( Cols )                                            // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    for( size_t j=0UL; j<Cols; ++j ) {
       for( size_t i=0UL; i<Rows; ++i )
@@ -3855,11 +3855,11 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[Rows][Cols]
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
-   : m_       ( m.m_  )                        // The current number of rows of the matrix
-   , mm_      ( m.mm_ )                        // The alignment adjusted number of rows
-   , n_       ( m.n_  )                        // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( m.m_  )                                           // The current number of rows of the matrix
+   , mm_      ( m.mm_ )                                           // The alignment adjusted number of rows
+   , n_       ( m.n_  )                                           // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
@@ -3906,11 +3906,11 @@ template< typename Type >  // Data type of the matrix
 template< typename MT      // Type of the foreign matrix
         , bool SO >        // Storage order of the foreign matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
-   : m_       ( (~m).rows() )                  // The current number of rows of the matrix
-   , mm_      ( addPadding( m_ ) )             // The alignment adjusted number of rows
-   , n_       ( (~m).columns() )               // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : m_       ( (~m).rows() )                                     // The current number of rows of the matrix
+   , mm_      ( addPadding( m_ ) )                                // The alignment adjusted number of rows
+   , n_       ( (~m).columns() )                                  // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                                          // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_, denseMatrixMemory ) )  // The matrix elements
 {
    for( size_t j=0UL; j<n_; ++j ) {
       for( size_t i=( IsSparseMatrix<MT>::value   ? 0UL : m_ );
@@ -4894,7 +4894,7 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    if( preserve )
    {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n, denseMatrixMemory );
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -4907,7 +4907,7 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       capacity_ = mm*n;
    }
    else if( mm*n > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n, denseMatrixMemory );
       std::swap( v_, v );
       deallocate( v );
       capacity_ = mm*n;
@@ -4967,7 +4967,7 @@ inline void DynamicMatrix<Type,true>::reserve( size_t elements )
    if( elements > capacity_ )
    {
       // Allocating a new array
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( elements, denseMatrixMemory );
 
       // Initializing the new array
       transfer( v_, v_+capacity_, tmp );
@@ -533,9 +533,9 @@ inline DynamicVector<Type,TF>::DynamicVector() noexcept
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( size_t n )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( addPadding( n ) )              // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( n )                                               // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )                                 // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_, denseVectorMemory ) )  // The vector elements
 {
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -558,9 +558,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( addPadding( n ) )              // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( n )                                               // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )                                 // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_, denseVectorMemory ) )  // The vector elements
 {
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = init;
@@ -593,9 +593,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( initializer_list<Type> list )
-   : size_    ( list.size() )                  // The current size/dimension of the vector
-   , capacity_( addPadding( size_ ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( list.size() )                                     // The current size/dimension of the vector
+   , capacity_( addPadding( size_ ) )                             // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_, denseVectorMemory ) )  // The vector elements
 {
    std::fill( std::copy( list.begin(), list.end(), v_ ), v_+capacity_, Type() );
 
@@ -628,9 +628,9 @@ template< typename Type     // Data type of the vector
         , bool TF >         // Transpose flag
 template< typename Other >  // Data type of the initialization array
 inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Other* array )
-   : size_    ( n )                            // The current size/dimension of the vector
-   , capacity_( addPadding( n ) )              // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( n )                                               // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )                                 // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_, denseVectorMemory ) )  // The vector elements
 {
    for( size_t i=0UL; i<n; ++i )
       v_[i] = array[i];
@@ -667,9 +667,9 @@ template< typename Type   // Data type of the vector
 template< typename Other  // Data type of the initialization array
         , size_t Dim >    // Dimension of the initialization array
 inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[Dim] )
-   : size_    ( Dim )                          // The current size/dimension of the vector
-   , capacity_( addPadding( Dim ) )            // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( Dim )                                             // The current size/dimension of the vector
+   , capacity_( addPadding( Dim ) )                               // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_, denseVectorMemory ) )  // The vector elements
 {
    for( size_t i=0UL; i<Dim; ++i )
       v_[i] = array[i];
@@ -695,9 +695,9 @@ inline DynamicVector<Type,TF>::DynamicVector( const Other (&array)[Dim] )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( const DynamicVector& v )
-   : size_    ( v.size_ )                      // The current size/dimension of the vector
-   , capacity_( addPadding( v.size_ ) )        // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( v.size_ )                                         // The current size/dimension of the vector
+   , capacity_( addPadding( v.size_ ) )                           // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_, denseVectorMemory ) )  // The vector elements
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= v.capacity_, "Invalid capacity estimation" );
 
@@ -737,9 +737,9 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the foreign vector
 inline DynamicVector<Type,TF>::DynamicVector( const Vector<VT,TF>& v )
-   : size_    ( (~v).size() )                  // The current size/dimension of the vector
-   , capacity_( addPadding( size_ ) )          // The maximum capacity of the vector
-   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
+   : size_    ( (~v).size() )                                     // The current size/dimension of the vector
+   , capacity_( addPadding( size_ ) )                             // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_, denseVectorMemory ) )  // The vector elements
 {
    for( size_t i=( IsSparseVector<VT>::value   ? 0UL       : size_ );
                i<( IsVectorizable<Type>::value ? capacity_ : size_ ); ++i ) {
@@ -1524,7 +1524,7 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity, denseVectorMemory );
 
       // Initializing the new array
       if( preserve ) {
@@ -1590,7 +1590,7 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
    {
       // Allocating a new array
       const size_t newCapacity( addPadding( n ) );
-      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
+      Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity, denseVectorMemory );
 
       // Initializing the new array
       transfer( v_, v_+size_, tmp );
@@ -50,6 +50,7 @@
 #include <blaze/math/lapack/geev.h>
 #include <blaze/math/lapack/heevd.h>
 #include <blaze/math/lapack/syevd.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -78,6 +79,13 @@ inline void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w );
 
 template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
 inline void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V );
+
+template< typename MT, bool SO, typename VT, bool TF >
+inline void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, LAPACKWorkspace& ws );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+inline void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+                   LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -89,6 +97,7 @@ inline void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMa
 //
 // \param A The given symmetric matrix.
 // \param w The resulting vector of eigenvalues.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::invalid_argument Vector cannot be resized.
@@ -106,7 +115,8 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline EnableIf_< And< IsSymmetric<MT>, IsFloatingPoint< ElementType_<MT> > > >
-   eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
+                  LAPACKWorkspace& ws )
 {
    using Tmp = ResultType_< RemoveAdaptor_<MT> >;
 
@@ -117,7 +127,7 @@ inline EnableIf_< And< IsSymmetric<MT>, IsFloatingPoint< ElementType_<MT> > > >
 
    Tmp tmp( A );
 
-   syevd( tmp, ~w, 'N', 'L' );
+   syevd( tmp, ~w, 'N', 'L', ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -130,6 +140,7 @@ inline EnableIf_< And< IsSymmetric<MT>, IsFloatingPoint< ElementType_<MT> > > >
 //
 // \param A The given Hermitian matrix.
 // \param w The resulting vector of eigenvalues.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::invalid_argument Vector cannot be resized.
@@ -147,7 +158,8 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline EnableIf_< And< IsHermitian<MT>, IsComplex< ElementType_<MT> > > >
-   eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
+                  LAPACKWorkspace& ws )
 {
    using Tmp = ResultType_< RemoveAdaptor_<MT> >;
 
@@ -158,7 +170,7 @@ inline EnableIf_< And< IsHermitian<MT>, IsComplex< ElementType_<MT> > > >
 
    Tmp tmp( A );
 
-   heevd( tmp, ~w, 'N', 'L' );
+   heevd( tmp, ~w, 'N', 'L', ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -171,6 +183,7 @@ inline EnableIf_< And< IsHermitian<MT>, IsComplex< ElementType_<MT> > > >
 //
 // \param A The given general matrix.
 // \param w The resulting vector of eigenvalues.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::invalid_argument Vector cannot be resized.
@@ -189,7 +202,8 @@ template< typename MT  // Type of the matrix A
         , bool TF >    // Transpose flag of the vector w
 inline DisableIf_< Or< And< IsSymmetric<MT>, IsFloatingPoint< ElementType_<MT> > >
                      , And< IsHermitian<MT>, IsComplex< ElementType_<MT> > > > >
-   eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   eigen_backend( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
+                  LAPACKWorkspace& ws )
 {
    using Tmp = ResultType_< RemoveAdaptor_<MT> >;
 
@@ -200,7 +214,7 @@ inline DisableIf_< Or< And< IsSymmetric<MT>, IsFloatingPoint< ElementType_<MT> >
 
    Tmp tmp( A );
 
-   geev( tmp, ~w );
+   geev( tmp, ~w, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -306,7 +320,46 @@ inline void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
    BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<VT> );
 
-   eigen_backend( ~A, ~w );
+   LAPACKWorkspace ws;
+   eigen( ~A, ~w, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Eigenvalue computation of the given dense matrix with user-provided workspace.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param w The resulting vector of eigenvalues.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according eigen() function without workspace argument,
+// except that all auxiliary memory of the LAPACK functions is taken from the given workspace
+// \a ws (see LAPACKWorkspace). Thus repeated eigenvalue computations for matrices of the same
+// size don't perform any memory allocation for the LAPACK work arrays.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, LAPACKWorkspace& ws )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<VT> );
+
+   eigen_backend( ~A, ~w, ws );
 }
 //*************************************************************************************************
 
@@ -319,6 +372,7 @@ inline void eigen( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
 // \param A The given symmetric matrix.
 // \param w The resulting vector of eigenvalues.
 // \param V The resulting matrix of eigenvectors.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::invalid_argument Vector cannot be resized.
@@ -339,7 +393,8 @@ template< typename MT1  // Type of the matrix A
         , typename MT2  // Type of the matrix V
         , bool SO2 >    // Storage order of the matrix V
 inline EnableIf_< And< IsSymmetric<MT1>, IsFloatingPoint< ElementType_<MT1> > > >
-   eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V )
+   eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+                  LAPACKWorkspace& ws )
 {
    using Tmp = ResultType_< RemoveAdaptor_<MT1> >;
 
@@ -350,7 +405,7 @@ inline EnableIf_< And< IsSymmetric<MT1>, IsFloatingPoint< ElementType_<MT1> > >
 
    Tmp tmp( A );
 
-   syevd( tmp, ~w, 'V', 'L' );
+   syevd( tmp, ~w, 'V', 'L', ws );
 
    (~V) = tmp;
 }
@@ -366,6 +421,7 @@ inline EnableIf_< And< IsSymmetric<MT1>, IsFloatingPoint< ElementType_<MT1> > >
 // \param A The given Hermitian matrix.
 // \param w The resulting vector of eigenvalues.
 // \param V The resulting matrix of eigenvectors.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::invalid_argument Vector cannot be resized.
@@ -386,7 +442,8 @@ template< typename MT1  // Type of the matrix A
         , typename MT2  // Type of the matrix V
         , bool SO2 >    // Storage order of the matrix V
 inline EnableIf_< And< IsHermitian<MT1>, IsComplex< ElementType_<MT1> > > >
-   eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V )
+   eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+                  LAPACKWorkspace& ws )
 {
    using Tmp = ResultType_< RemoveAdaptor_<MT1> >;
 
@@ -397,7 +454,7 @@ inline EnableIf_< And< IsHermitian<MT1>, IsComplex< ElementType_<MT1> > > >
 
    Tmp tmp( A );
 
-   heevd( tmp, ~w, 'V', 'L' );
+   heevd( tmp, ~w, 'V', 'L', ws );
 
    (~V) = tmp;
 }
@@ -413,6 +470,7 @@ inline EnableIf_< And< IsHermitian<MT1>, IsComplex< ElementType_<MT1> > > >
 // \param A The given general matrix.
 // \param w The resulting vector of eigenvalues.
 // \param V The resulting matrix of eigenvectors.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::invalid_argument Vector cannot be resized.
@@ -434,7 +492,8 @@ template< typename MT1  // Type of the matrix A
         , bool SO2 >    // Storage order of the matrix V
 inline DisableIf_< Or< And< IsSymmetric<MT1>, IsFloatingPoint< ElementType_<MT1> > >
                      , And< IsHermitian<MT1>, IsComplex< ElementType_<MT1> > > > >
-   eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V )
+   eigen_backend( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+                  LAPACKWorkspace& ws )
 {
    using Tmp = ResultType_< RemoveAdaptor_<MT1> >;
 
@@ -446,9 +505,9 @@ inline DisableIf_< Or< And< IsSymmetric<MT1>, IsFloatingPoint< ElementType_<MT1>
    Tmp tmp( A );
 
    if( IsRowMajorMatrix<MT1>::value )
-      geev( tmp, ~V, ~w );
+      geev( tmp, ~V, ~w, ws );
    else
-      geev( tmp, ~w, ~V );
+      geev( tmp, ~w, ~V, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -574,7 +633,56 @@ inline void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMa
    BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT2> );
 
-   eigen_backend( ~A, ~w, ~V );
+   LAPACKWorkspace ws;
+   eigen( ~A, ~w, ~V, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Eigenvalue computation of the given dense matrix with user-provided workspace.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param w The resulting vector of eigenvalues.
+// \param V The resulting matrix of eigenvectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according eigen() function without workspace argument,
+// except that all auxiliary memory of the LAPACK functions is taken from the given workspace
+// \a ws (see LAPACKWorkspace). Thus repeated eigenvalue computations for matrices of the same
+// size don't perform any memory allocation for the LAPACK work arrays.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix V
+        , bool SO2 >    // Storage order of the matrix V
+inline void eigen( const DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& V,
+                   LAPACKWorkspace& ws )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<VT> );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT2 );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT2> );
+
+   eigen_backend( ~A, ~w, ~V, ws );
 }
 //*************************************************************************************************
 
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -58,10 +57,12 @@
 #include <blaze/math/lapack/sytrf.h>
 #include <blaze/math/lapack/sytri.h>
 #include <blaze/math/lapack/trtri.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/IsDivisor.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/Real.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -3272,6 +3273,7 @@ inline void invert6x6( DenseMatrix<MT,SO>& dm )
 // \ingroup dense_matrix
 //
 // \param dm The dense matrix to be inverted.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::runtime_error Inversion of singular matrix failed.
@@ -3296,16 +3298,16 @@ inline void invert6x6( DenseMatrix<MT,SO>& dm )
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
-inline void invertByLU( DenseMatrix<MT,SO>& dm )
+inline void invertByLU( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
    const size_t n( min( (~dm).rows(), (~dm).columns() ) );
-   const std::unique_ptr<int[]> ipiv( new int[n] );
+   int* const ipiv( ws.get<int>( 8UL, n ) );
 
-   getrf( ~dm, ipiv.get() );
-   getri( ~dm, ipiv.get() );
+   getrf( ~dm, ipiv );
+   getri( ~dm, ipiv, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3317,6 +3319,7 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
 // \ingroup dense_matrix
 //
 // \param dm The dense matrix to be inverted.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::runtime_error Inversion of singular matrix failed.
@@ -3334,25 +3337,28 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), the matrix is inverted by means of the native LU-based
+// inversion.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
-inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
+inline void invertByLDLT( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
    BLAZE_USER_ASSERT( isSymmetric( ~dm ), "Invalid non-symmetric matrix detected" );
 
+#if BLAZE_LAPACK_MODE
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
-   const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
+   int* const ipiv( ws.get<int>( 8UL, (~dm).rows() ) );
 
-   sytrf( ~dm, uplo, ipiv.get() );
-   sytri( ~dm, uplo, ipiv.get() );
+   sytrf( ~dm, uplo, ipiv, ws );
+   sytri( ~dm, uplo, ipiv, ws );
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3368,6 +3374,9 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
          }
       }
    }
+#else
+   invertByLU( ~dm, ws );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3379,6 +3388,7 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 // \ingroup dense_matrix
 //
 // \param dm The dense matrix to be inverted.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::runtime_error Inversion of singular matrix failed.
@@ -3404,9 +3414,9 @@ inline void invertByLDLT( DenseMatrix<MT,SO>& dm )
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
 inline EnableIf_< IsBuiltin< ElementType_<MT> > >
-   invertByLDLH( DenseMatrix<MT,SO>& dm )
+   invertByLDLH( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws )
 {
-   invertByLDLT( ~dm );
+   invertByLDLT( ~dm, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3418,6 +3428,7 @@ inline EnableIf_< IsBuiltin< ElementType_<MT> > >
 // \ingroup dense_matrix
 //
 // \param dm The dense matrix to be inverted.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 // \exception std::invalid_argument Invalid non-square matrix provided.
 // \exception std::runtime_error Inversion of singular matrix failed.
@@ -3435,7 +3446,9 @@ inline EnableIf_< IsBuiltin< ElementType_<MT> > >
 // matrices of any other element type results in a compile time error!
 //
 // \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// the executable. Otherwise a linker error will be created. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), the matrix is inverted by means of the native LU-based
+// inversion.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3443,18 +3456,19 @@ inline EnableIf_< IsBuiltin< ElementType_<MT> > >
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
 inline EnableIf_< IsComplex< ElementType_<MT> > >
-   invertByLDLH( DenseMatrix<MT,SO>& dm )
+   invertByLDLH( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
 
    BLAZE_USER_ASSERT( isHermitian( ~dm ), "Invalid non-Hermitian matrix detected" );
 
+#if BLAZE_LAPACK_MODE
    const char uplo( ( SO )?( 'L' ):( 'U' ) );
-   const std::unique_ptr<int[]> ipiv( new int[(~dm).rows()] );
+   int* const ipiv( ws.get<int>( 8UL, (~dm).rows() ) );
 
-   hetrf( ~dm, uplo, ipiv.get() );
-   hetri( ~dm, uplo, ipiv.get() );
+   hetrf( ~dm, uplo, ipiv, ws );
+   hetri( ~dm, uplo, ipiv, ws );
 
    if( SO ) {
       for( size_t i=1UL; i<(~dm).rows(); ++i ) {
@@ -3470,6 +3484,9 @@ inline EnableIf_< IsComplex< ElementType_<MT> > >
          }
       }
    }
+#else
+   invertByLU( ~dm, ws );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3754,6 +3771,7 @@ inline void invertDiagonalNxN( DenseMatrix<MT,SO>& dm )
 // \ingroup dense_matrix
 //
 // \param dm The dense matrix to be inverted.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 // \exception std::runtime_error Inversion of singular matrix failed.
 //
@@ -3774,7 +3792,7 @@ inline void invertDiagonalNxN( DenseMatrix<MT,SO>& dm )
 template< InversionFlag IF  // Inversion algorithm
         , typename MT       // Type of the dense matrix
         , bool SO >         // Storage order of the dense matrix
-inline void invertNxN( DenseMatrix<MT,SO>& dm )
+inline void invertNxN( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
@@ -3782,18 +3800,18 @@ inline void invertNxN( DenseMatrix<MT,SO>& dm )
    BLAZE_INTERNAL_ASSERT( isSquare( ~dm ), "Non-square matrix detected" );
 
    switch( IF ) {
-      case byLU       : invertByLU       ( ~dm ); break;
-      case byLDLT     : invertByLDLT     ( ~dm ); break;
-      case byLDLH     : invertByLDLH     ( ~dm ); break;
-      case byLLH      : invertByLLH      ( ~dm ); break;
-      case asGeneral  : invertByLU       ( ~dm ); break;
-      case asSymmetric: invertByLDLT     ( ~dm ); break;
-      case asHermitian: invertByLDLH     ( ~dm ); break;
-      case asLower    : invertLowerNxN   ( ~dm ); break;
-      case asUniLower : invertUniLowerNxN( ~dm ); break;
-      case asUpper    : invertUpperNxN   ( ~dm ); break;
-      case asUniUpper : invertUniUpperNxN( ~dm ); break;
-      case asDiagonal : invertDiagonalNxN( ~dm ); break;
+      case byLU       : invertByLU       ( ~dm, ws ); break;
+      case byLDLT     : invertByLDLT     ( ~dm, ws ); break;
+      case byLDLH     : invertByLDLH     ( ~dm, ws ); break;
+      case byLLH      : invertByLLH      ( ~dm     ); break;
+      case asGeneral  : invertByLU       ( ~dm, ws ); break;
+      case asSymmetric: invertByLDLT     ( ~dm, ws ); break;
+      case asHermitian: invertByLDLH     ( ~dm, ws ); break;
+      case asLower    : invertLowerNxN   ( ~dm     ); break;
+      case asUniLower : invertUniLowerNxN( ~dm     ); break;
+      case asUpper    : invertUpperNxN   ( ~dm     ); break;
+      case asUniUpper : invertUniUpperNxN( ~dm     ); break;
+      case asDiagonal : invertDiagonalNxN( ~dm     ); break;
       default: BLAZE_INTERNAL_ASSERT( false, "Unhandled case detected" );
    }
 
@@ -3817,8 +3835,14 @@ inline void invertNxN( DenseMatrix<MT,SO>& dm )
 template< typename MT, bool SO >
 inline void invert( DenseMatrix<MT,SO>& dm );
 
+template< typename MT, bool SO >
+inline void invert( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws );
+
 template< InversionFlag IF, typename MT, bool SO >
 inline void invert( DenseMatrix<MT,SO>& dm );
+
+template< InversionFlag IF, typename MT, bool SO >
+inline void invert( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -3858,6 +3882,46 @@ inline void invert( DenseMatrix<MT,SO>& dm )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief In-place inversion of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be inverted.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is identical to the invert() function without workspace argument, except that
+// all auxiliary memory (including the pivoting indices) is taken from the given workspace \a ws
+// (see LAPACKWorkspace). Thus the repeated inversion of matrices of the same size doesn't perform
+// any memory allocation:
+
+   \code
+   blaze::DynamicMatrix<double> A( 500UL, 500UL );
+   blaze::LAPACKWorkspace ws;
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      // ... Initialization of A
+      invert( A, ws );
+   }
+   \endcode
+
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a dm may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void invert( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws )
+{
+   invert<byLU>( ~dm, ws );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief In-place inversion of the given dense matrix.
 // \ingroup dense_matrix
@@ -3900,6 +3964,43 @@ template< InversionFlag IF  // Inversion algorithm
         , typename MT       // Type of the dense matrix
         , bool SO >         // Storage order of the dense matrix
 inline void invert( DenseMatrix<MT,SO>& dm )
+{
+   LAPACKWorkspace ws;
+   invert<IF>( ~dm, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The dense matrix to be inverted.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is identical to the invert() function without workspace argument, except that
+// all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace):
+
+   \code
+   blaze::LAPACKWorkspace ws;
+
+   invert<byLDLT>( A, ws );  // Inversion by means of a Bunch-Kaufman decomposition
+   invert<byLLH>( B, ws );   // Inversion by means of a Cholesky decomposition
+   \endcode
+
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a dm may already have been modified.
+*/
+template< InversionFlag IF  // Inversion algorithm
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order of the dense matrix
+inline void invert( DenseMatrix<MT,SO>& dm, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
@@ -3916,7 +4017,7 @@ inline void invert( DenseMatrix<MT,SO>& dm )
       case 4UL: invert4x4<IF>( ~dm ); break;
       case 5UL: invert5x5<IF>( ~dm ); break;
       case 6UL: invert6x6<IF>( ~dm ); break;
-      default : invertNxN<IF>( ~dm ); break;
+      default : invertNxN<IF>( ~dm, ws ); break;
    }
 
    BLAZE_INTERNAL_ASSERT( isIntact( ~dm ), "Broken invariant detected" );
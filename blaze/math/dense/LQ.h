@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -54,6 +53,7 @@
 #include <blaze/math/lapack/gelqf.h>
 #include <blaze/math/lapack/orglq.h>
 #include <blaze/math/lapack/unglq.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
@@ -75,6 +75,10 @@ namespace blaze {
 //@{
 template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
 void lq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void lq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R,
+         LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -86,6 +90,7 @@ void lq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 //
 // \param A The LQ decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix LQ decomposition. It performs the
@@ -93,9 +98,9 @@ void lq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
-   lq_backend( MT1& A, const ElementType_<MT1>* tau )
+   lq_backend( MT1& A, const ElementType_<MT1>* tau, LAPACKWorkspace& ws )
 {
-   orglq( A, tau );
+   orglq( A, tau, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -108,6 +113,7 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 //
 // \param A The LQ decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix LQ decomposition. It performs the
@@ -115,9 +121,9 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsComplex< ElementType_<MT1> > >
-   lq_backend( MT1& A, const ElementType_<MT1>* tau )
+   lq_backend( MT1& A, const ElementType_<MT1>* tau, LAPACKWorkspace& ws )
 {
-   unglq( A, tau );
+   unglq( A, tau, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -178,6 +184,41 @@ template< typename MT1  // Type of matrix A
         , typename MT3  // Type of matrix Q
         , bool SO3 >    // Storage order of matrix Q
 void lq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L, DenseMatrix<MT3,SO3>& Q )
+{
+   LAPACKWorkspace ws;
+   lq( A, L, Q, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LQ decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param L The resulting \c L matrix.
+// \param Q The resulting \c Q matrix.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix do not match.
+// \exception std::invalid_argument Square matrix cannot be resized to \a m-by-\a n.
+//
+// This function is identical to the lq() function without workspace argument, except that all
+// auxiliary memory (including the scalar factors of the elementary reflectors) is taken from the
+// given workspace \a ws (see LAPACKWorkspace). Thus the repeated decomposition of matrices of the
+// same size doesn't perform any temporary memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix L
+        , bool SO2      // Storage order of matrix L
+        , typename MT3  // Type of matrix Q
+        , bool SO3 >    // Storage order of matrix Q
+void lq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L, DenseMatrix<MT3,SO3>& Q,
+         LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
@@ -206,13 +247,13 @@ void lq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L, DenseMatrix<MT3
       BLAZE_THROW_INVALID_ARGUMENT( "Square matrix cannot be resized to m-by-min(m,n)" );
    }
 
-   const std::unique_ptr<ET1[]> tau( new ET1[mindim] );
+   ET1* const tau( ws.get<ET1>( 9UL, mindim ) );
    DerestrictTrait_<MT3> l( derestrict( ~L ) );
 
    if( m < n )
    {
       (~Q) = A;
-      gelqf( ~Q, tau.get() );
+      gelqf( ~Q, tau, ws );
 
       resize( ~L, m, m, false );
       reset( l );
@@ -223,14 +264,14 @@ void lq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L, DenseMatrix<MT3
          }
       }
 
-      lq_backend( ~Q, tau.get() );
+      lq_backend( ~Q, tau, ws );
    }
    else
    {
       l = A;
-      gelqf( l, tau.get() );
+      gelqf( l, tau, ws );
       (~Q) = submatrix( l, 0UL, 0UL, n, n );
-      lq_backend( ~Q, tau.get() );
+      lq_backend( ~Q, tau, ws );
 
       for( size_t i=0UL; i<m; ++i ) {
          for( size_t j=i+1UL; j<n; ++j ) {
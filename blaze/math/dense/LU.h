@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
@@ -54,6 +53,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/util/algorithms/Min.h>
@@ -74,6 +74,10 @@ namespace blaze {
 template< typename MT1, bool SO1, typename MT2, typename MT3, typename MT4, bool SO2 >
 void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
          DenseMatrix<MT3,SO1>& U, Matrix<MT4,SO2>& P );
+
+template< typename MT1, bool SO1, typename MT2, typename MT3, typename MT4, bool SO2 >
+void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
+         DenseMatrix<MT3,SO1>& U, Matrix<MT4,SO2>& P, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -85,6 +89,7 @@ void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
 //
 // \param A The matrix to be decomposed.
 // \param P The resulting permutation matrix.
+// \param ws The workspace for the pivoting indices.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix LU decomposition. It performs an
@@ -95,7 +100,7 @@ template< typename MT1  // Type of matrix A
         , bool SO1      // Storage order of dense matrix A
         , typename MT2  // Type of matrix P
         , bool SO2 >    // Storage order of matrix P
-void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
+void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
@@ -108,8 +113,7 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    const int mindim( min( m, n ) );
    const int size( SO1 ? m : n );
 
-   const std::unique_ptr<int[]> helper( new int[mindim + size] );
-   int* ipiv  ( helper.get() );
+   int* ipiv  ( ws.get<int>( 8UL, mindim + size ) );
    int* permut( ipiv + mindim );
 
    getrf( ~A, ipiv );
@@ -219,6 +223,42 @@ template< typename MT1  // Type of matrix A
         , bool SO2 >    // Storage order of matrix P
 void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
          DenseMatrix<MT3,SO1>& U, Matrix<MT4,SO2>& P )
+{
+   LAPACKWorkspace ws;
+   lu( A, L, U, P, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LU decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param L The resulting lower triangular matrix.
+// \param U The resulting upper triangular matrix.
+// \param P The resulting permutation matrix.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix do not match.
+// \exception std::invalid_argument Square matrix cannot be resized to \a m-by-\a n.
+//
+// This function is identical to the lu() function without workspace argument, except that the
+// pivoting indices are taken from the given workspace \a ws (see LAPACKWorkspace). Thus the
+// repeated decomposition of matrices of the same size doesn't perform any temporary memory
+// allocation.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A, L and U
+        , typename MT2  // Type of matrix L
+        , typename MT3  // Type of matrix U
+        , typename MT4  // Type of matrix P
+        , bool SO2 >    // Storage order of matrix P
+void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
+         DenseMatrix<MT3,SO1>& U, Matrix<MT4,SO2>& P, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
@@ -257,7 +297,7 @@ void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
    if( m < n )
    {
       u = (~A);
-      lu( u, ~P );
+      lu( u, ~P, ws );
 
       resize( ~L, m, m, false );
       reset( l );
@@ -291,7 +331,7 @@ void lu( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO1>& L,
    else
    {
       l = (~A);
-      lu( l, ~P );
+      lu( l, ~P, ws );
 
       resize( ~U, n, n, false );
       reset( u );
@@ -0,0 +1,527 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/LUFactorization.h
+//  \brief Header file for the implementation of the LUFactorization class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_LUFACTORIZATION_H_
+#define _BLAZE_MATH_DENSE_LUFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/gecon.h>
+#include <blaze/math/lapack/getrf.h>
+#include <blaze/math/lapack/getrs.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reusable LU factorization of a general square matrix.
+// \ingroup dense_matrix
+//
+// The LUFactorization class template represents the LU decomposition \f$ A = P \cdot L \cdot U \f$
+// of a general, square \a n-by-\a n matrix with partial pivoting. The class owns the packed LU
+// factors and the pivot indices as computed by the LAPACK getrf() functions. After the matrix
+// has been factorized once, an arbitrary number of linear systems of equations can be solved
+// via the LAPACK getrs() functions without refactorizing the matrix. In contrast to computing
+// the inverse of the matrix (i.e. \c inv(A)*b), solving via the factorization is both faster
+// and numerically more accurate. The element type of the class template must be \c float,
+// \c double, \c complex<float>, or \c complex<double>:
+
+   \code
+   using blaze::LUFactorization;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A( 100UL, 100UL );  // The general system matrix
+   DynamicVector<double> b( 100UL );         // A single right-hand side vector
+   DynamicMatrix<double> B( 100UL, 20UL );   // 20 right-hand side vectors
+   // ... Initialization
+
+   LUFactorization<double> lu( A );  // Factorizing the matrix A
+
+   DynamicVector<double> x( lu.solve( b ) );  // Solving A*x=b
+   DynamicMatrix<double> X( lu.solve( B ) );  // Solving A*X=B for all 20 right-hand sides
+
+   lu.solveInPlace( b );  // Solving A*x=b in-place; b is overwritten by the solution
+
+   const double d    ( lu.det()   );  // Computing the determinant of A
+   const double rcond( lu.rcond() );  // Estimating the reciprocal condition number of A
+   \endcode
+
+// Note that the factorization of a singular matrix succeeds, but the attempt to solve a linear
+// system based on the factorization of a singular matrix results in a \a std::runtime_error
+// exception. The singularity of the matrix can be queried via the isSingular() function.
+//
+// \note The LUFactorization class template can only be used if a fitting LAPACK library is
+// available and linked to the executable. Otherwise a call to any of its functions will result
+// in a linker error.
+//
+// \note A single LUFactorization instance must not be used concurrently by several threads.
+*/
+template< typename Type >  // Data type of the matrix elements
+class LUFactorization
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Type of the matrix elements.
+   using BuiltinType = UnderlyingElement_<Type>;         //!< Underlying builtin element type.
+   using FactorType  = DynamicMatrix<Type,columnMajor>;  //!< Type of the packed LU factors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LUFactorization();
+
+   template< typename MT, bool SO >
+   explicit inline LUFactorization( const DenseMatrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void factorize( const DenseMatrix<MT,SO>& A );
+
+   inline size_t            size      () const noexcept;
+   inline bool              isSingular() const noexcept;
+   inline const FactorType& factors   () const noexcept;
+   inline const int*        pivots    () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT, bool TF >
+   inline DynamicVector<Type,TF> solve( const DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   inline DynamicMatrix<Type,SO> solve( const DenseMatrix<MT,SO>& B ) const;
+
+   template< typename VT, bool TF >
+   inline void solveInPlace( DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   inline void solveInPlace( DenseMatrix<MT,SO>& B ) const;
+
+   inline Type        det  () const;
+   inline BuiltinType rcond() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   FactorType              lu_;        //!< The packed LU factors of the matrix.
+   DynamicVector<int>      ipiv_;      //!< The pivot indices of the LU decomposition.
+   BuiltinType             anorm_;     //!< The 1-norm of the factorized matrix.
+   bool                    singular_;  //!< Flag for a singular factorized matrix.
+   mutable LAPACKWorkspace ws_;        //!< The workspace for the auxiliary LAPACK memory.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LUFactorization.
+//
+// The default constructor creates the factorization of an empty 0-by-0 matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline LUFactorization<Type>::LUFactorization()
+   : lu_      ()         // The packed LU factors of the matrix
+   , ipiv_    ()         // The pivot indices of the LU decomposition
+   , anorm_   ()         // The 1-norm of the factorized matrix
+   , singular_( false )  // Flag for a singular factorized matrix
+   , ws_      ()         // The workspace for the auxiliary LAPACK memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the LU factorization of the given square matrix.
+//
+// \param A The given general square matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This constructor computes the LU factorization of the given square matrix \a A. In case \a A
+// is not a square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline LUFactorization<Type>::LUFactorization( const DenseMatrix<MT,SO>& A )
+   : LUFactorization()
+{
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computing the LU factorization of the given square matrix.
+//
+// \param A The given general square matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the LU factorization of the given square matrix \a A and replaces any
+// previously computed factorization. Note that the memory of the previous factorization is
+// reused in case \a A has the same size. In case \a A is not a square matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline void LUFactorization<Type>::factorize( const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, Type );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   lu_ = ~A;
+   ipiv_.resize( n, false );
+
+   anorm_ = BuiltinType();
+   for( size_t j=0UL; j<n; ++j ) {
+      BuiltinType sum{};
+      for( size_t i=0UL; i<n; ++i ) {
+         sum += abs( lu_(i,j) );
+      }
+      if( sum > anorm_ ) anorm_ = sum;
+   }
+
+   getrf( lu_, ipiv_.data() );
+
+   singular_ = false;
+   for( size_t i=0UL; i<n; ++i ) {
+      if( isDefault( lu_(i,i) ) ) {
+         singular_ = true;
+         break;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the factorized matrix.
+//
+// \return The number of rows/columns of the factorized matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t LUFactorization<Type>::size() const noexcept
+{
+   return lu_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the factorized matrix is singular.
+//
+// \return \a true in case the factorized matrix is singular, \a false if not.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline bool LUFactorization<Type>::isSingular() const noexcept
+{
+   return singular_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the packed LU factors of the factorized matrix.
+//
+// \return The packed LU factors as computed by the getrf() functions.
+//
+// The strictly lower part of the returned column-major matrix contains the unit lower triangular
+// factor \a L, the upper part contains the upper triangular factor \a U.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename LUFactorization<Type>::FactorType&
+   LUFactorization<Type>::factors() const noexcept
+{
+   return lu_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the pivot indices of the LU factorization.
+//
+// \return Pointer to the first of the \a n (one-based) pivot indices.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const int* LUFactorization<Type>::pivots() const noexcept
+{
+   return ipiv_.data();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ for the given right-hand side vector.
+//
+// \param b The right-hand side vector.
+// \return The solution vector \a x.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solution of singular system failed.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+inline DynamicVector<Type,TF> LUFactorization<Type>::solve( const DenseVector<VT,TF>& b ) const
+{
+   DynamicVector<Type,TF> x( ~b );
+   solveInPlace( x );
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*X=B \f$ for the given right-hand side matrix.
+//
+// \param B The matrix of right-hand sides (one right-hand side per column).
+// \return The solution matrix \a X.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Solution of singular system failed.
+//
+// This function solves the linear system for all columns of \a B at once. Thus it is
+// considerably more efficient than solving for each right-hand side separately.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO> LUFactorization<Type>::solve( const DenseMatrix<MT,SO>& B ) const
+{
+   DynamicMatrix<Type,SO> X( ~B );
+   solveInPlace( X );
+   return X;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of the linear system \f$ A*x=b \f$.
+//
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Solution of singular system failed.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+inline void LUFactorization<Type>::solveInPlace( DenseVector<VT,TF>& b ) const
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<VT>, Type );
+
+   if( (~b).size() != lu_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( singular_ ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solution of singular system failed" );
+   }
+
+   getrs( lu_, ~b, 'N', ipiv_.data() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of the linear system \f$ A*X=B \f$.
+//
+// \param B The matrix of right-hand sides (one per column), which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Solution of singular system failed.
+//
+// Column-major right-hand side matrices are solved directly. Row-major right-hand side matrices
+// require a temporary column-major copy of \a B.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline void LUFactorization<Type>::solveInPlace( DenseMatrix<MT,SO>& B ) const
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, Type );
+
+   if( (~B).rows() != lu_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( singular_ ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solution of singular system failed" );
+   }
+
+   if( IsRowMajorMatrix<MT>::value ) {
+      DynamicMatrix<Type,columnMajor> X( ~B );
+      getrs( lu_, X, 'N', ipiv_.data() );
+      ~B = X;
+   }
+   else {
+      getrs( lu_, ~B, 'N', ipiv_.data() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the determinant of the factorized matrix.
+//
+// \return The determinant of the factorized matrix.
+//
+// The determinant is computed as the product of the diagonal elements of \a U, where the sign
+// is adapted according to the number of row interchanges. The determinant of a 0-by-0 matrix
+// is 1.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline Type LUFactorization<Type>::det() const
+{
+   const size_t n( lu_.rows() );
+
+   Type d( 1 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      d *= lu_(i,i);
+      if( ipiv_[i] != static_cast<int>( i+1UL ) ) {
+         d = -d;
+      }
+   }
+
+   return d;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Estimates the reciprocal condition number of the factorized matrix.
+//
+// \return The estimate of the reciprocal condition number in the 1-norm.
+//
+// This function estimates the reciprocal of the condition number of the factorized matrix in
+// the 1-norm via the LAPACK gecon() functions. In case the returned value is close to zero,
+// the matrix is close to singular. For a singular matrix the function returns 0, for a 0-by-0
+// matrix it returns 1.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename LUFactorization<Type>::BuiltinType LUFactorization<Type>::rcond() const
+{
+   if( singular_ ) {
+      return BuiltinType();
+   }
+
+   return gecon( lu_, '1', anorm_, ws_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
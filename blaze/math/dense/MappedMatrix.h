@@ -0,0 +1,628 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MappedMatrix.h
+//  \brief Header file for the implementation of file-backed, memory-mapped dense matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_MAPPEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_MAPPEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MAPPEDMATRIXHEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief File header of a memory-mapped dense matrix.
+// \ingroup dense_matrix
+//
+// The header occupies the first 64 bytes of the file. The matrix elements start at the given
+// offset (by default the first page boundary), each row (row-major) or column (column-major)
+// is padded with zeros to a multiple of 64 bytes. All values are stored in the native byte
+// order of the system.
+*/
+struct MappedMatrixHeader
+{
+   char     magic[8];      //!< The file signature ("BLAZEMAT").
+   uint32_t version;       //!< The version of the file format.
+   uint32_t elementType;   //!< The type of the elements (see TypeValueMapping).
+   uint32_t elementSize;   //!< The size of a single element in bytes.
+   uint32_t storageOrder;  //!< The storage order of the matrix (0 for row-major).
+   uint64_t rows;          //!< The number of rows of the matrix.
+   uint64_t columns;       //!< The number of columns of the matrix.
+   uint64_t spacing;       //!< The number of elements between two rows/columns.
+   uint64_t offset;        //!< The offset of the first element in bytes.
+   uint8_t  reserved[8];   //!< Reserved for future use.
+
+   static constexpr uint32_t currentVersion = 1U;      //!< The current version of the format.
+   static constexpr size_t   dataOffset     = 4096UL;  //!< The default offset of the elements.
+   static constexpr size_t   padding        = 64UL;    //!< The padding of rows/columns in bytes.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup mapped_matrix MappedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief File-backed, memory-mapped dense matrix.
+// \ingroup mapped_matrix
+//
+// The MappedMatrix class template maps a dense matrix stored in a file into memory. This allows
+// to work with matrices that exceed the main memory of the system, since the elements are loaded
+// on demand from the file system and can be evicted from the page cache by the operating system
+// at any time. The type of the elements and the storage order of the matrix can be specified via
+// the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class MappedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MappedMatrix can be used with any
+//          trivially copyable, non-cv-qualified element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//
+// A file starts with a 64 byte header, which describes the element type, the dimensions and the
+// storage order of the matrix (see the BLAZE_INTERNAL documentation of MappedMatrixHeader). The
+// elements start at the first page boundary, each row (or column) is zero-padded to a multiple
+// of 64 bytes. Therefore the matrix elements are properly aligned and padded for all available
+// SIMD instruction sets. The matrix itself is accessed via a CustomMatrix, which can be used in
+// all expressions:
+
+   \code
+   using blaze::MappedMatrix;
+   using blaze::DynamicVector;
+
+   // Creating a new 100000x100000 matrix in the file "A.mat"
+   {
+      MappedMatrix<double,rowMajor> A( "A.mat", 100000UL, 100000UL );
+      A.matrix() = ...;
+   }
+
+   // Mapping the existing matrix read-only and streaming it through a matrix/vector multiplication
+   MappedMatrix<double,rowMajor> A( "A.mat", blaze::readOnly );
+   A.advise( blaze::sequentialAccess );
+
+   DynamicVector<double> x( A.columns() ), y;
+   y = A.matrix() * x;
+   \endcode
+
+// Note that the elements of a read-only mapping must not be modified, i.e. the matrix may only be
+// used as operand of expressions. Also note that the matrix view is declared as unpadded, since
+// the padding elements are never touched in order to avoid unnecessary writes to the file.
+// However, due to the alignment and spacing of the rows/columns, all kernels are vectorized.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class MappedMatrix : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                                    //!< Type of the matrix elements.
+   using MatrixType  = CustomMatrix<Type,aligned,unpadded,SO>;  //!< Type of the mapped matrix.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedMatrix( const std::string& filename, MappingMode mode = readOnly );
+   explicit inline MappedMatrix( const std::string& filename, size_t m, size_t n );
+            inline MappedMatrix( MappedMatrix&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Conversion operators************************************************************************
+   /*!\name Conversion operators */
+   //@{
+   inline operator MatrixType&() noexcept;
+   inline operator const MatrixType&() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline MatrixType&       matrix() noexcept;
+   inline const MatrixType& matrix() const noexcept;
+   inline size_t            rows() const noexcept;
+   inline size_t            columns() const noexcept;
+   inline size_t            spacing() const noexcept;
+   inline void              advise( AccessAdvice advice );
+   inline void              advise( AccessAdvice advice, size_t index, size_t n );
+   inline void              flush();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t     spacing( size_t n ) noexcept;
+   static inline MappedFile open  ( const std::string& filename, MappingMode mode );
+   static inline MappedFile create( const std::string& filename, size_t m, size_t n );
+   static inline MatrixType view  ( const MappedFile& file );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;    //!< The memory-mapped file.
+   MatrixType matrix_;  //!< The matrix view on the mapped elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( sizeof( MappedMatrixHeader ) == 64UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mapping an existing matrix file.
+//
+// \param filename The name of the matrix file.
+// \param mode The access mode of the mapping (\a readOnly or \a readWrite).
+// \exception std::runtime_error Mapping the file failed.
+// \exception std::invalid_argument Invalid matrix file.
+//
+// This constructor maps the matrix stored in the given file. In case the file is mapped
+// read-only, the elements of the matrix must not be modified. In case the file cannot be mapped, a \a std::runtime_error exception is thrown. In case the
+// file is no valid matrix file or the element type or the storage order of the stored matrix
+// don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::MappedMatrix( const std::string& filename, MappingMode mode )
+   : file_  ( open( filename, mode ) )  // The memory-mapped file
+   , matrix_( view( file_ ) )           // The matrix view on the mapped elements
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST   ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a new \f$ m \times n \f$ matrix file.
+//
+// \param filename The name of the matrix file.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::runtime_error Creating the file failed.
+//
+// This constructor creates a new matrix file (or overwrites an existing file) and maps it for
+// reading and writing. All elements of the new matrix are zero. Note that the file is created
+// as sparse file, i.e. disk space is only consumed for the elements that are actually written.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::MappedMatrix( const std::string& filename, size_t m, size_t n )
+   : file_  ( create( filename, m, n ) )  // The memory-mapped file
+   , matrix_( view( file_ ) )             // The matrix view on the mapped elements
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST   ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( Type );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MappedMatrix.
+//
+// \param m The mapped matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::MappedMatrix( MappedMatrix&& m ) noexcept
+   : file_  ( std::move( m.file_ ) )    // The memory-mapped file
+   , matrix_( std::move( m.matrix_ ) )  // The matrix view on the mapped elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the mapped matrix.
+//
+// \return Reference to the matrix view on the mapped elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::operator MatrixType&() noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion to the mapped matrix.
+//
+// \return Reference to the matrix view on the mapped elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedMatrix<Type,SO>::operator const MatrixType&() const noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the matrix view on the mapped elements.
+//
+// \return Reference to the mapped matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedMatrix<Type,SO>::MatrixType& MappedMatrix<Type,SO>::matrix() noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the matrix view on the mapped elements.
+//
+// \return Reference to the mapped matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const typename MappedMatrix<Type,SO>::MatrixType& MappedMatrix<Type,SO>::matrix() const noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedMatrix<Type,SO>::rows() const noexcept
+{
+   return matrix_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedMatrix<Type,SO>::columns() const noexcept
+{
+   return matrix_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns.
+//
+// \return The spacing between the beginning of two rows/columns.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedMatrix<Type,SO>::spacing() const noexcept
+{
+   return matrix_.spacing();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advising the operating system about the access pattern of the entire matrix.
+//
+// \param advice The expected access pattern.
+// \return void
+// \exception std::runtime_error Invalid advice.
+//
+// This function forwards the expected access pattern of the matrix elements to the operating
+// system. For instance, \a sequentialAccess increases the read-ahead for streaming kernels like
+// a row-major matrix/vector multiplication.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::advise( AccessAdvice advice )
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advising the operating system about the access pattern of a range of rows/columns.
+//
+// \param advice The expected access pattern.
+// \param index The index of the first row (row-major) or column (column-major) of the range.
+// \param n The number of rows/columns of the range.
+// \return void
+// \exception std::invalid_argument Invalid range specification.
+// \exception std::runtime_error Invalid advice.
+//
+// This function forwards the expected access pattern for the specified range of rows (in case
+// of a row-major matrix) or columns (in case of a column-major matrix) to the operating system.
+// This allows for instance to prefetch the next block of rows of a blocked algorithm:
+
+   \code
+   blaze::MappedMatrix<double,blaze::rowMajor> A( "A.mat" );
+
+   for( size_t i=0UL; i<A.rows(); i+=block )
+   {
+      const size_t m( blaze::min( block, A.rows()-i ) );
+
+      if( i+m < A.rows() )
+         A.advise( blaze::willNeedAccess, i+m, blaze::min( block, A.rows()-i-m ) );
+
+      // ... Processing the rows [i..i+m)
+
+      A.advise( blaze::dontNeedAccess, i, m );
+   }
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::advise( AccessAdvice advice, size_t index, size_t n )
+{
+   const size_t size( SO ? matrix_.columns() : matrix_.rows() );
+
+   if( index > size || n > size - index ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid row/column range" );
+   }
+
+   const size_t bytes( matrix_.spacing() * sizeof( ElementType ) );
+   file_.advise( advice, MappedMatrixHeader::dataOffset + index*bytes, n*bytes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Synchronously writing all modifications of the matrix back to the file.
+//
+// \return void
+// \exception std::runtime_error Synchronization failed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void MappedMatrix<Type,SO>::flush()
+{
+   file_.flush();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the spacing between two rows/columns.
+//
+// \param n The number of elements per row/column.
+// \return The number of elements between the beginning of two rows/columns.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t MappedMatrix<Type,SO>::spacing( size_t n ) noexcept
+{
+   constexpr size_t elements( MappedMatrixHeader::padding / sizeof( ElementType ) );
+
+   if( IsVectorizable<ElementType>::value && elements > 1UL )
+      return nextMultiple<size_t>( n, elements );
+   else return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opening and validating an existing matrix file.
+//
+// \param filename The name of the matrix file.
+// \param mode The access mode of the mapping.
+// \return The mapped file.
+// \exception std::runtime_error Mapping the file failed.
+// \exception std::invalid_argument Invalid matrix file.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedFile MappedMatrix<Type,SO>::open( const std::string& filename, MappingMode mode )
+{
+   MappedFile file( filename, mode );
+
+   if( file.size() < sizeof( MappedMatrixHeader ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix file" );
+   }
+
+   MappedMatrixHeader header;
+   std::memcpy( &header, file.data(), sizeof( MappedMatrixHeader ) );
+
+   if( std::memcmp( header.magic, "BLAZEMAT", 8UL ) != 0 ||
+       header.version != MappedMatrixHeader::currentVersion ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix file" );
+   }
+
+   if( header.elementType != TypeValueMapping<ElementType>::value ||
+       header.elementSize != sizeof( ElementType ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type" );
+   }
+
+   if( header.storageOrder != static_cast<uint32_t>( SO ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid storage order" );
+   }
+
+   const size_t n( SO ? header.rows : header.columns );
+   const size_t m( SO ? header.columns : header.rows );
+
+   if( header.offset != MappedMatrixHeader::dataOffset || header.spacing < n ||
+       header.spacing % spacing( 1UL ) != 0UL ||
+       ( m > 0UL && header.spacing > ( file.size() - header.offset ) / sizeof( ElementType ) / m ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix file" );
+   }
+
+   return file;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a new matrix file.
+//
+// \param filename The name of the matrix file.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The mapped file.
+// \exception std::runtime_error Creating the file failed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedFile MappedMatrix<Type,SO>::create( const std::string& filename, size_t m, size_t n )
+{
+   MappedMatrixHeader header = {};
+   std::memcpy( header.magic, "BLAZEMAT", 8UL );
+   header.version      = MappedMatrixHeader::currentVersion;
+   header.elementType  = TypeValueMapping<ElementType>::value;
+   header.elementSize  = sizeof( ElementType );
+   header.storageOrder = static_cast<uint32_t>( SO );
+   header.rows         = m;
+   header.columns      = n;
+   header.spacing      = spacing( SO ? m : n );
+   header.offset       = MappedMatrixHeader::dataOffset;
+
+   const size_t size( header.offset + ( SO ? n : m ) * header.spacing * sizeof( ElementType ) );
+
+   MappedFile file( filename, size );
+   std::memcpy( file.data(), &header, sizeof( MappedMatrixHeader ) );
+
+   return file;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating the matrix view on the elements of a mapped matrix file.
+//
+// \param file The mapped matrix file.
+// \return The matrix view on the mapped elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename MappedMatrix<Type,SO>::MatrixType
+   MappedMatrix<Type,SO>::view( const MappedFile& file )
+{
+   MappedMatrixHeader header;
+   std::memcpy( &header, file.data(), sizeof( MappedMatrixHeader ) );
+
+   Type* const ptr( reinterpret_cast<Type*>( file.data() + header.offset ) );
+
+   return MatrixType( ptr, header.rows, header.columns, header.spacing );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
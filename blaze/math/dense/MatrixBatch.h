@@ -0,0 +1,735 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MatrixBatch.h
+//  \brief Header file for the implementation of a batch of small dense matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+#define _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup matrix_batch MatrixBatch
+// \ingroup dense_matrix
+*/
+/*!\brief Batch of small dense matrices of fixed size stored in an interleaved layout.
+// \ingroup matrix_batch
+//
+// The MatrixBatch class template represents a batch of an arbitrary number of dense matrices
+// of the compile time fixed size \f$ M \times N \f$:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class MatrixBatch;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MatrixBatch can only be used with the
+//          floating point data types \c float and \c double.
+//  - M   : specifies the number of rows of each matrix.
+//  - N   : specifies the number of columns of each matrix.
+//
+// In contrast to an array of StaticMatrix, the elements of all matrices are stored interleaved:
+// the element \f$ (i,j) \f$ of the \a k-th matrix is stored at position \f$ (i \cdot N + j)
+// \cdot s + k \f$, where \f$ s \f$ is the spacing of the batch (see the spacing() function).
+// The spacing is the number of matrices rounded up to a multiple of the SIMD width. Thus each
+// SIMD load of an element \f$ (i,j) \f$ fetches this element of SIMD-width many consecutive
+// matrices. The unused padding matrices of a square batch are identity matrices, the padding
+// matrices of a non-square batch are zero.
+//
+// This layout is the basis for the batched inversion and the batched LU and Cholesky solvers
+// (see invert(), lu(), llh(), solve(), luSolve() and llhSolve()), which process SIMD-width
+// many small matrices at once and which are parallelized via the SMP backend of \b Blaze:
+
+   \code
+   blaze::MatrixBatch<double,6UL,6UL> A( 100000UL );
+
+   // Initializing the matrices of the batch
+   for( size_t k=0UL; k<A.size(); ++k ) {
+      A.set( k, ... );
+   }
+
+   invert( A );  // Inverting all 100000 matrices in-place
+   \endcode
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+class MatrixBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = MatrixBatch<Type,M,N>;             //!< Type of this MatrixBatch instance.
+   using ElementType    = Type;                              //!< Type of the matrix elements.
+   using MatrixType     = StaticMatrix<Type,M,N,rowMajor>;   //!< Type of a single matrix.
+   using Reference      = Type&;                             //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;                       //!< Reference to a constant matrix value.
+   using Pointer        = Type*;                             //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;                       //!< Pointer to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MatrixBatch( size_t n = 0UL );
+   explicit inline MatrixBatch( size_t n, const Type& init );
+            inline MatrixBatch( const MatrixBatch& b );
+            inline MatrixBatch( MatrixBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MatrixBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const noexcept;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i, size_t j ) noexcept;
+   inline ConstPointer   data  ( size_t i, size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MatrixBatch& operator=( const MatrixBatch& rhs );
+   inline MatrixBatch& operator=( MatrixBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                                    inline size_t           size   () const noexcept;
+                                    inline size_t           spacing() const noexcept;
+   static                           inline constexpr size_t rows   () noexcept;
+   static                           inline constexpr size_t columns() noexcept;
+                                    inline MatrixType       get    ( size_t k ) const;
+   template< typename MT, bool SO > inline void             set    ( size_t k, const DenseMatrix<MT,SO>& m );
+                                    inline void             resize ( size_t n );
+                                    inline void             swap   ( MatrixBatch& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t addPadding( size_t n ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of matrices.
+   size_t spacing_;          //!< The number of elements between two elements of the same matrix.
+   Type* BLAZE_RESTRICT v_;  //!< The interleaved elements of all matrices.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+//
+// All elements of the matrices are initialized to 0.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( size_t n )
+   : MatrixBatch( n, Type() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices with homogeneous initialization.
+//
+// \param n The number of matrices of the batch.
+// \param init The initial value of the matrix elements.
+//
+// All elements of the matrices are initialized with the specified value. The padding matrices
+// are initialized to the identity (square matrices) or to 0 (non-square matrices).
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( size_t n, const Type& init )
+   : size_   ( n )                                                      // The current number of matrices
+   , spacing_( addPadding( n ) )                                        // The spacing of the batch
+   , v_      ( spacing_ > 0UL ? allocate<Type>( M*N*spacing_ ) : nullptr )  // The interleaved elements
+{
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         Type* const element( v_ + (i*N+j)*spacing_ );
+         std::fill( element, element+size_, init );
+         std::fill( element+size_, element+spacing_, ( M == N && i == j ? Type(1) : Type() ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for MatrixBatch.
+//
+// \param b The matrix batch to be copied.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( const MatrixBatch& b )
+   : size_   ( b.size_ )                                                // The current number of matrices
+   , spacing_( b.spacing_ )                                             // The spacing of the batch
+   , v_      ( spacing_ > 0UL ? allocate<Type>( M*N*spacing_ ) : nullptr )  // The interleaved elements
+{
+   std::copy( b.v_, b.v_+M*N*spacing_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MatrixBatch.
+//
+// \param b The matrix batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::MatrixBatch( MatrixBatch&& b ) noexcept
+   : size_   ( b.size_ )     // The current number of matrices
+   , spacing_( b.spacing_ )  // The spacing of the batch
+   , v_      ( b.v_ )        // The interleaved elements
+{
+   b.size_    = 0UL;
+   b.spacing_ = 0UL;
+   b.v_       = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MatrixBatch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>::~MatrixBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the elements of the matrices.
+//
+// \param k Index of the accessed matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::Reference
+   MatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i < M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N    , "Invalid column access index" );
+   return v_[(i*N+j)*spacing_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the elements of the matrices.
+//
+// \param k Index of the accessed matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::ConstReference
+   MatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i < M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N    , "Invalid column access index" );
+   return v_[(i*N+j)*spacing_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the matrix batch. The element
+// \f$ (i,j) \f$ of the \a k-th matrix is stored at position \f$ (i \cdot N + j) \cdot s + k \f$,
+// where \f$ s \f$ is the spacing of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::Pointer MatrixBatch<Type,M,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the matrix batch. The element
+// \f$ (i,j) \f$ of the \a k-th matrix is stored at position \f$ (i \cdot N + j) \cdot s + k \f$,
+// where \f$ s \f$ is the spacing of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::ConstPointer MatrixBatch<Type,M,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the element \f$ (i,j) \f$ of all matrices.
+//
+// \param i The row index.
+// \param j The column index.
+// \return Pointer to the element \f$ (i,j) \f$ of the first matrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::Pointer
+   MatrixBatch<Type,M,N>::data( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < M, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N, "Invalid column access index" );
+   return v_ + (i*N+j)*spacing_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the element \f$ (i,j) \f$ of all matrices.
+//
+// \param i The row index.
+// \param j The column index.
+// \return Pointer to the element \f$ (i,j) \f$ of the first matrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::ConstPointer
+   MatrixBatch<Type,M,N>::data( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < M, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < N, "Invalid column access index" );
+   return v_ + (i*N+j)*spacing_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MatrixBatch.
+//
+// \param rhs Matrix batch to be copied.
+// \return Reference to the assigned matrix batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( const MatrixBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   MatrixBatch tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MatrixBatch.
+//
+// \param rhs The matrix batch to be moved into this instance.
+// \return Reference to the assigned matrix batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( MatrixBatch&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_    = rhs.size_;
+   spacing_ = rhs.spacing_;
+   v_       = rhs.v_;
+
+   rhs.size_    = 0UL;
+   rhs.spacing_ = 0UL;
+   rhs.v_       = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of matrices of the batch.
+//
+// \return The number of matrices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t MatrixBatch<Type,M,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between two consecutive elements of the same matrix.
+//
+// \return The spacing of the batch.
+//
+// The spacing is the number of matrices rounded up to a multiple of the SIMD width.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t MatrixBatch<Type,M,N>::spacing() const noexcept
+{
+   return spacing_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of each matrix.
+//
+// \return The number of rows \a M.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline constexpr size_t MatrixBatch<Type,M,N>::rows() noexcept
+{
+   return M;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of each matrix.
+//
+// \return The number of columns \a N.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline constexpr size_t MatrixBatch<Type,M,N>::columns() noexcept
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the \a k-th matrix of the batch.
+//
+// \param k The index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \return The \a k-th matrix.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename MatrixBatch<Type,M,N>::MatrixType MatrixBatch<Type,M,N>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid matrix access index" );
+
+   MatrixType A;
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         A(i,j) = v_[(i*N+j)*spacing_+k];
+      }
+   }
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the \a k-th matrix of the batch.
+//
+// \param k The index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param m The new value of the \a k-th matrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+template< typename MT    // Type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+inline void MatrixBatch<Type,M,N>::set( size_t k, const DenseMatrix<MT,SO>& m )
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid matrix access index" );
+
+   if( (~m).rows() != M || (~m).columns() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix size" );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         v_[(i*N+j)*spacing_+k] = (~m)(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices.
+// \return void
+//
+// This function changes the number of matrices of the batch. The values of the first
+// \f$ \min(n,size) \f$ matrices are preserved, all new matrices are initialized to 0.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void MatrixBatch<Type,M,N>::resize( size_t n )
+{
+   if( n == size_ ) return;
+
+   MatrixBatch tmp( n );
+   const size_t m( min( n, size_ ) );
+
+   for( size_t i=0UL; i<M*N; ++i ) {
+      std::copy( v_+i*spacing_, v_+i*spacing_+m, tmp.v_+i*tmp.spacing_ );
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrix batches.
+//
+// \param b The matrix batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void MatrixBatch<Type,M,N>::swap( MatrixBatch& b ) noexcept
+{
+   using std::swap;
+
+   swap( size_   , b.size_    );
+   swap( spacing_, b.spacing_ );
+   swap( v_      , b.v_       );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the spacing for the given number of matrices.
+//
+// \param n The number of matrices.
+// \return The number of matrices rounded up to a multiple of the SIMD width.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t MatrixBatch<Type,M,N>::addPadding( size_t n ) noexcept
+{
+   return nextMultiple<size_t>( n, SIMDSIZE );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MatrixBatch operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrix batches.
+// \ingroup matrix_batch
+//
+// \param a The first matrix batch to be swapped.
+// \param b The second matrix batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
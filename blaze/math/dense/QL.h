@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -54,6 +53,7 @@
 #include <blaze/math/lapack/geqlf.h>
 #include <blaze/math/lapack/orgql.h>
 #include <blaze/math/lapack/ungql.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
@@ -75,6 +75,10 @@ namespace blaze {
 //@{
 template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
 void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& L );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& L,
+         LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -86,6 +90,7 @@ void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 //
 // \param A The QL decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix QL decomposition. It performs the
@@ -93,9 +98,9 @@ void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
-   ql_backend( MT1& A, const ElementType_<MT1>* tau )
+   ql_backend( MT1& A, const ElementType_<MT1>* tau, LAPACKWorkspace& ws )
 {
-   orgql( A, tau );
+   orgql( A, tau, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -108,6 +113,7 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 //
 // \param A The QL decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix QL decomposition. It performs the
@@ -115,9 +121,9 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsComplex< ElementType_<MT1> > >
-   ql_backend( MT1& A, const ElementType_<MT1>* tau )
+   ql_backend( MT1& A, const ElementType_<MT1>* tau, LAPACKWorkspace& ws )
 {
-   ungql( A, tau );
+   ungql( A, tau, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -178,6 +184,41 @@ template< typename MT1  // Type of matrix A
         , typename MT3  // Type of matrix L
         , bool SO3 >    // Storage order of matrix L
 void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& L )
+{
+   LAPACKWorkspace ws;
+   ql( A, Q, L, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief QL decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param Q The resulting \c Q matrix.
+// \param L The resulting \c L matrix.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix do not match.
+// \exception std::invalid_argument Square matrix cannot be resized to \a m-by-\a n.
+//
+// This function is identical to the ql() function without workspace argument, except that all
+// auxiliary memory (including the scalar factors of the elementary reflectors) is taken from the
+// given workspace \a ws (see LAPACKWorkspace). Thus the repeated decomposition of matrices of the
+// same size doesn't perform any temporary memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix Q
+        , bool SO2      // Storage order of matrix Q
+        , typename MT3  // Type of matrix L
+        , bool SO3 >    // Storage order of matrix L
+void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& L,
+         LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
@@ -207,15 +248,15 @@ void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
       BLAZE_THROW_INVALID_ARGUMENT( "Square matrix cannot be resized to min(m,n)-by-n" );
    }
 
-   const std::unique_ptr<ET1[]> tau( new ET1[mindim] );
+   ET1* const tau( ws.get<ET1>( 9UL, mindim ) );
    DerestrictTrait_<MT2> l( derestrict( ~L ) );
 
    if( m < n )
    {
       l = A;
-      geqlf( l, tau.get() );
+      geqlf( l, tau, ws );
       (~Q) = submatrix( l, 0UL, n-m, m, m );
-      ql_backend( ~Q, tau.get() );
+      ql_backend( ~Q, tau, ws );
 
       for( size_t i=0UL; i<m; ++i ) {
          for( size_t j=i+n-m+1UL; j<n; ++j ) {
@@ -226,7 +267,7 @@ void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    else
    {
       (~Q) = A;
-      geqlf( ~Q, tau.get() );
+      geqlf( ~Q, tau, ws );
 
       resize( ~L, n, n, false );
       reset( l );
@@ -237,7 +278,7 @@ void ql( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
          }
       }
 
-      ql_backend( ~Q, tau.get() );
+      ql_backend( ~Q, tau, ws );
    }
 }
 //*************************************************************************************************
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -54,6 +53,7 @@
 #include <blaze/math/lapack/geqrf.h>
 #include <blaze/math/lapack/orgqr.h>
 #include <blaze/math/lapack/ungqr.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
@@ -75,6 +75,10 @@ namespace blaze {
 //@{
 template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
 void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R,
+         LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -86,6 +90,7 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 //
 // \param A The QR decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix QR decomposition. It performs the
@@ -93,9 +98,9 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
-   qr_backend( MT1& A, const ElementType_<MT1>* tau )
+   qr_backend( MT1& A, const ElementType_<MT1>* tau, LAPACKWorkspace& ws )
 {
-   orgqr( A, tau );
+   orgqr( A, tau, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -108,6 +113,7 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 //
 // \param A The QR decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix QR decomposition. It performs the
@@ -115,9 +121,9 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsComplex< ElementType_<MT1> > >
-   qr_backend( MT1& A, const ElementType_<MT1>* tau )
+   qr_backend( MT1& A, const ElementType_<MT1>* tau, LAPACKWorkspace& ws )
 {
-   ungqr( A, tau );
+   ungqr( A, tau, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -178,6 +184,41 @@ template< typename MT1  // Type of matrix A
         , typename MT3  // Type of matrix R
         , bool SO3 >    // Storage order of matrix R
 void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R )
+{
+   LAPACKWorkspace ws;
+   qr( A, Q, R, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief QR decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param Q The resulting \c Q matrix.
+// \param R The resulting \c R matrix.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix do not match.
+// \exception std::invalid_argument Square matrix cannot be resized to m-by-n.
+//
+// This function is identical to the qr() function without workspace argument, except that all
+// auxiliary memory (including the scalar factors of the elementary reflectors) is taken from the
+// given workspace \a ws (see LAPACKWorkspace). Thus the repeated decomposition of matrices of the
+// same size doesn't perform any temporary memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix Q
+        , bool SO2      // Storage order of matrix Q
+        , typename MT3  // Type of matrix R
+        , bool SO3 >    // Storage order of matrix R
+void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3,SO3>& R,
+         LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
@@ -206,15 +247,15 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
       BLAZE_THROW_INVALID_ARGUMENT( "Square matrix cannot be resized to min(m,n)-by-n" );
    }
 
-   const std::unique_ptr<ET1[]> tau( new ET1[mindim] );
+   ET1* const tau( ws.get<ET1>( 9UL, mindim ) );
    DerestrictTrait_<MT3> r( derestrict( ~R ) );
 
    if( m < n )
    {
       r = A;
-      geqrf( r, tau.get() );
+      geqrf( r, tau, ws );
       (~Q) = submatrix( r, 0UL, 0UL, m, m );
-      qr_backend( ~Q, tau.get() );
+      qr_backend( ~Q, tau, ws );
 
       for( size_t i=1UL; i<m; ++i ) {
          for( size_t j=0UL; j<i; ++j ) {
@@ -225,7 +266,7 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    else
    {
       (~Q) = A;
-      geqrf( ~Q, tau.get() );
+      geqrf( ~Q, tau, ws );
 
       resize( ~R, n, n, false );
       reset( r );
@@ -236,7 +277,7 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
          }
       }
 
-      qr_backend( ~Q, tau.get() );
+      qr_backend( ~Q, tau, ws );
    }
 }
 //*************************************************************************************************
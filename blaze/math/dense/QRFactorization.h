@@ -0,0 +1,775 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/QRFactorization.h
+//  \brief Header file for the implementation of the QRFactorization class template
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_QRFACTORIZATION_H_
+#define _BLAZE_MATH_DENSE_QRFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/lapack/clapack/ormqr.h>
+#include <blaze/math/lapack/clapack/trcon.h>
+#include <blaze/math/lapack/clapack/trtrs.h>
+#include <blaze/math/lapack/clapack/unmqr.h>
+#include <blaze/math/lapack/geqrf.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BACKEND FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the multiplication of a dense matrix with \f$ Q^T \f$ (real case).
+// \ingroup dense_matrix
+//
+// \param C The column-major \a m-by-\a k matrix to be multiplied with \f$ Q^T \f$ from the left.
+// \param QR The column-major \a m-by-\a n packed QR factors (\a m >= \a n).
+// \param tau The \a n scalar factors of the Householder reflectors.
+// \param ws The workspace for the auxiliary LAPACK memory.
+// \return void
+//
+// This function is used as the backend of the QRFactorization class template for matrices with
+// real element type. In contrast to the high-level ormqr() function it accepts the reflectors
+// of a tall matrix \a QR.
+*/
+template< typename MT1    // Type of the matrix C
+        , typename MT2 >  // Type of the packed QR factors
+inline EnableIf_< IsBuiltin< ElementType_<MT2> > >
+   applyQH_backend( MT1& C, const MT2& QR, const ElementType_<MT2>* tau, LAPACKWorkspace& ws )
+{
+   using ET = ElementType_<MT2>;
+
+   int m   ( numeric_cast<int>( C.rows() ) );
+   int n   ( numeric_cast<int>( C.columns() ) );
+   int k   ( numeric_cast<int>( QR.columns() ) );
+   int lda ( numeric_cast<int>( QR.spacing() ) );
+   int ldc ( numeric_cast<int>( C.spacing() ) );
+   int info( 0 );
+
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   ormqr( 'L', 'T', m, n, k, QR.data(), lda, tau, C.data(), ldc, &wkopt, lwork, &info );
+
+   lwork = optimalWorkspace( wkopt, n );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   ormqr( 'L', 'T', m, n, k, QR.data(), lda, tau, C.data(), ldc, work, lwork, &info );
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for Q multiplication" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend for the multiplication of a dense matrix with \f$ Q^H \f$ (complex case).
+// \ingroup dense_matrix
+//
+// \param C The column-major \a m-by-\a k matrix to be multiplied with \f$ Q^H \f$ from the left.
+// \param QR The column-major \a m-by-\a n packed QR factors (\a m >= \a n).
+// \param tau The \a n scalar factors of the Householder reflectors.
+// \param ws The workspace for the auxiliary LAPACK memory.
+// \return void
+//
+// This function is used as the backend of the QRFactorization class template for matrices with
+// complex element type. In contrast to the high-level unmqr() function it accepts the reflectors
+// of a tall matrix \a QR.
+*/
+template< typename MT1    // Type of the matrix C
+        , typename MT2 >  // Type of the packed QR factors
+inline EnableIf_< IsComplex< ElementType_<MT2> > >
+   applyQH_backend( MT1& C, const MT2& QR, const ElementType_<MT2>* tau, LAPACKWorkspace& ws )
+{
+   using ET = ElementType_<MT2>;
+
+   int m   ( numeric_cast<int>( C.rows() ) );
+   int n   ( numeric_cast<int>( C.columns() ) );
+   int k   ( numeric_cast<int>( QR.columns() ) );
+   int lda ( numeric_cast<int>( QR.spacing() ) );
+   int ldc ( numeric_cast<int>( C.spacing() ) );
+   int info( 0 );
+
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   unmqr( 'L', 'C', m, n, k, QR.data(), lda, tau, C.data(), ldc, &wkopt, lwork, &info );
+
+   lwork = optimalWorkspace( wkopt, n );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   unmqr( 'L', 'C', m, n, k, QR.data(), lda, tau, C.data(), ldc, work, lwork, &info );
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for Q multiplication" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reusable QR factorization of a general matrix.
+// \ingroup dense_matrix
+//
+// The QRFactorization class template represents the QR decomposition \f$ A = Q \cdot R \f$ of a
+// general \a m-by-\a n matrix. The class owns the packed factors (i.e. the upper trapezoidal
+// matrix \a R and the Householder reflectors representing \a Q) as computed by the LAPACK geqrf()
+// functions. After the matrix has been factorized once, an arbitrary number of linear systems of
+// equations can be solved by applying \f$ Q^H \f$ via the LAPACK ormqr()/unmqr() functions and
+// a triangular substitution with \a R. In case \a m is larger than \a n, the solve functions
+// compute the least squares solution of the overdetermined system. The element type of the class
+// template must be \c float, \c double, \c complex<float>, or \c complex<double>:
+
+   \code
+   using blaze::QRFactorization;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicMatrix<double> A( 200UL, 100UL );  // The (overdetermined) system matrix
+   DynamicVector<double> b( 200UL );         // A single right-hand side vector
+   DynamicMatrix<double> B( 200UL, 20UL );   // 20 right-hand side vectors
+   // ... Initialization
+
+   QRFactorization<double> qr( A );  // Factorizing the matrix A
+
+   DynamicVector<double> x( qr.solve( b ) );  // Least squares solution of A*x=b (100 elements)
+   DynamicMatrix<double> X( qr.solve( B ) );  // Least squares solution of A*X=B (100x20)
+
+   qr.solveInPlace( b );  // In-place solution; b is resized to 100 elements
+   \endcode
+
+// The attempt to solve an underdetermined system (i.e. \a m is smaller than \a n) or a system
+// with a rank deficient matrix results in an exception. The determinant (det()) and the estimate
+// of the reciprocal condition number (rcond()) are only available for square matrices.
+//
+// \note The QRFactorization class template can only be used if a fitting LAPACK library is
+// available and linked to the executable. Otherwise a call to any of its functions will result
+// in a linker error.
+//
+// \note A single QRFactorization instance must not be used concurrently by several threads.
+*/
+template< typename Type >  // Data type of the matrix elements
+class QRFactorization
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Type of the matrix elements.
+   using BuiltinType = UnderlyingElement_<Type>;         //!< Underlying builtin element type.
+   using FactorType  = DynamicMatrix<Type,columnMajor>;  //!< Type of the packed QR factors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline QRFactorization();
+
+   template< typename MT, bool SO >
+   explicit inline QRFactorization( const DenseMatrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void factorize( const DenseMatrix<MT,SO>& A );
+
+   inline size_t                   rows      () const noexcept;
+   inline size_t                   columns   () const noexcept;
+   inline bool                     isSingular() const noexcept;
+   inline const FactorType&        factors   () const noexcept;
+   inline const DynamicVector<Type>& tau     () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename VT, bool TF >
+   inline DynamicVector<Type,TF> solve( const DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   inline DynamicMatrix<Type,SO> solve( const DenseMatrix<MT,SO>& B ) const;
+
+   template< typename VT, bool TF >
+   inline void solveInPlace( DenseVector<VT,TF>& b ) const;
+
+   template< typename MT, bool SO >
+   inline void solveInPlace( DenseMatrix<MT,SO>& B ) const;
+
+   inline Type        det  () const;
+   inline BuiltinType rcond() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void checkSolvable( size_t m ) const;
+
+   template< typename MT >
+   inline void solveColumnMajor( MT& B ) const;
+
+   template< typename MT >
+   inline void solveInPlace_backend( DenseMatrix<MT,rowMajor>& B ) const;
+
+   template< typename MT >
+   inline void solveInPlace_backend( DenseMatrix<MT,columnMajor>& B ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   FactorType              qr_;        //!< The packed QR factors of the matrix.
+   DynamicVector<Type>     tau_;       //!< The scalar factors of the Householder reflectors.
+   bool                    singular_;  //!< Flag for a rank deficient factorized matrix.
+   mutable LAPACKWorkspace ws_;        //!< The workspace for the auxiliary LAPACK memory.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for QRFactorization.
+//
+// The default constructor creates the factorization of an empty 0-by-0 matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline QRFactorization<Type>::QRFactorization()
+   : qr_      ()         // The packed QR factors of the matrix
+   , tau_     ()         // The scalar factors of the Householder reflectors
+   , singular_( false )  // Flag for a rank deficient factorized matrix
+   , ws_      ()         // The workspace for the auxiliary LAPACK memory
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the QR factorization of the given matrix.
+//
+// \param A The given general matrix.
+//
+// This constructor computes the QR factorization of the given \a m-by-\a n matrix \a A.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline QRFactorization<Type>::QRFactorization( const DenseMatrix<MT,SO>& A )
+   : QRFactorization()
+{
+   factorize( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computing the QR factorization of the given matrix.
+//
+// \param A The given general matrix.
+// \return void
+//
+// This function computes the QR factorization of the given \a m-by-\a n matrix \a A and replaces
+// any previously computed factorization. Note that the memory of the previous factorization is
+// reused in case \a A has the same size.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline void QRFactorization<Type>::factorize( const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, Type );
+
+   const size_t m( (~A).rows()    );
+   const size_t n( (~A).columns() );
+   const size_t k( min( m, n ) );
+
+   qr_ = ~A;
+   tau_.resize( k, false );
+
+   geqrf( qr_, tau_.data(), ws_ );
+
+   singular_ = false;
+   for( size_t i=0UL; i<k; ++i ) {
+      if( isDefault( qr_(i,i) ) ) {
+         singular_ = true;
+         break;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the factorized matrix.
+//
+// \return The number of rows of the factorized matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t QRFactorization<Type>::rows() const noexcept
+{
+   return qr_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the factorized matrix.
+//
+// \return The number of columns of the factorized matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t QRFactorization<Type>::columns() const noexcept
+{
+   return qr_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the factorized matrix is rank deficient.
+//
+// \return \a true in case a diagonal element of \a R is zero, \a false if not.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline bool QRFactorization<Type>::isSingular() const noexcept
+{
+   return singular_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the packed QR factors of the factorized matrix.
+//
+// \return The packed QR factors as computed by the geqrf() functions.
+//
+// The upper trapezoidal part of the returned column-major matrix contains the factor \a R, the
+// strictly lower part contains the Householder reflectors representing \a Q (see tau()).
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const typename QRFactorization<Type>::FactorType&
+   QRFactorization<Type>::factors() const noexcept
+{
+   return qr_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scalar factors of the Householder reflectors.
+//
+// \return The min(\a m,\a n) scalar factors of the Householder reflectors.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const DynamicVector<Type>& QRFactorization<Type>::tau() const noexcept
+{
+   return tau_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether a linear system can be solved via the factorization.
+//
+// \param m The number of rows of the right-hand side.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side provided.
+// \exception std::invalid_argument Underdetermined system cannot be solved.
+// \exception std::runtime_error Solution of rank deficient system failed.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline void QRFactorization<Type>::checkSolvable( size_t m ) const
+{
+   if( m != qr_.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side provided" );
+   }
+
+   if( qr_.rows() < qr_.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Underdetermined system cannot be solved" );
+   }
+
+   if( singular_ ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Solution of rank deficient system failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system for the given column-major right-hand side matrix.
+//
+// \param B The column-major matrix of right-hand sides.
+// \return void
+//
+// This function overwrites the first \a n rows of the given \a m-by-\a k matrix \a B with the
+// solution of the linear system. The remaining rows are overwritten by intermediate results.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT >    // Type of the right-hand side matrix
+inline void QRFactorization<Type>::solveColumnMajor( MT& B ) const
+{
+   BLAZE_INTERNAL_ASSERT( B.rows() == qr_.rows(), "Invalid number of rows detected" );
+
+   if( qr_.columns() == 0UL || B.columns() == 0UL ) {
+      return;
+   }
+
+   applyQH_backend( B, qr_, tau_.data(), ws_ );
+
+   int n   ( numeric_cast<int>( qr_.columns() ) );
+   int nrhs( numeric_cast<int>( B.columns() ) );
+   int lda ( numeric_cast<int>( qr_.spacing() ) );
+   int ldb ( numeric_cast<int>( B.spacing() ) );
+   int info( 0 );
+
+   trtrs( 'U', 'N', 'N', n, nrhs, qr_.data(), lda, B.data(), ldb, &info );
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid function argument" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution for a row-major right-hand side matrix.
+//
+// \param B The row-major matrix of right-hand sides.
+// \return void
+//
+// Since the LAPACK functions expect column-major right-hand sides, a row-major matrix is
+// solved via a temporary column-major copy.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT >    // Type of the right-hand side matrix
+inline void QRFactorization<Type>::solveInPlace_backend( DenseMatrix<MT,rowMajor>& B ) const
+{
+   DynamicMatrix<Type,columnMajor> X( ~B );
+   solveColumnMajor( X );
+   resize( ~B, qr_.columns(), X.columns(), false );
+   ~B = submatrix( X, 0UL, 0UL, qr_.columns(), X.columns() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution for a column-major right-hand side matrix.
+//
+// \param B The column-major matrix of right-hand sides.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT >    // Type of the right-hand side matrix
+inline void QRFactorization<Type>::solveInPlace_backend( DenseMatrix<MT,columnMajor>& B ) const
+{
+   solveColumnMajor( ~B );
+   resize( ~B, qr_.columns(), (~B).columns(), true );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ for the given right-hand side vector.
+//
+// \param b The right-hand side vector of size \a m.
+// \return The (least squares) solution vector \a x of size \a n.
+// \exception std::invalid_argument Invalid right-hand side provided.
+// \exception std::invalid_argument Underdetermined system cannot be solved.
+// \exception std::runtime_error Solution of rank deficient system failed.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+inline DynamicVector<Type,TF> QRFactorization<Type>::solve( const DenseVector<VT,TF>& b ) const
+{
+   DynamicVector<Type,TF> x( ~b );
+   solveInPlace( x );
+   return x;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*X=B \f$ for the given right-hand side matrix.
+//
+// \param B The \a m-by-\a k matrix of right-hand sides (one right-hand side per column).
+// \return The (least squares) \a n-by-\a k solution matrix \a X.
+// \exception std::invalid_argument Invalid right-hand side provided.
+// \exception std::invalid_argument Underdetermined system cannot be solved.
+// \exception std::runtime_error Solution of rank deficient system failed.
+//
+// This function solves the linear system for all columns of \a B at once. Thus it is
+// considerably more efficient than solving for each right-hand side separately.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline DynamicMatrix<Type,SO> QRFactorization<Type>::solve( const DenseMatrix<MT,SO>& B ) const
+{
+   DynamicMatrix<Type,SO> X( ~B );
+   solveInPlace( X );
+   return X;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of the linear system \f$ A*x=b \f$.
+//
+// \param b The right-hand side vector of size \a m, which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side provided.
+// \exception std::invalid_argument Underdetermined system cannot be solved.
+// \exception std::runtime_error Solution of rank deficient system failed.
+//
+// In case of an overdetermined system (i.e. \a m is larger than \a n), the given vector is
+// resized to the \a n elements of the least squares solution. In case the vector is not
+// resizable, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT      // Type of the right-hand side vector
+        , bool TF >        // Transpose flag of the right-hand side vector
+inline void QRFactorization<Type>::solveInPlace( DenseVector<VT,TF>& b ) const
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( VT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<VT>, Type );
+
+   checkSolvable( (~b).size() );
+
+   CustomMatrix<Type,unaligned,unpadded,columnMajor> B( (~b).data(), (~b).size(), 1UL );
+   solveColumnMajor( B );
+
+   resize( ~b, qr_.columns(), true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place solution of the linear system \f$ A*X=B \f$.
+//
+// \param B The \a m-by-\a k matrix of right-hand sides, which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side provided.
+// \exception std::invalid_argument Underdetermined system cannot be solved.
+// \exception std::runtime_error Solution of rank deficient system failed.
+//
+// In case of an overdetermined system (i.e. \a m is larger than \a n), the given matrix is
+// resized to the \a n-by-\a k least squares solution. In case the matrix is not resizable, a
+// \a std::invalid_argument exception is thrown. Column-major right-hand side matrices are solved
+// directly, row-major right-hand side matrices require a temporary column-major copy of \a B.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline void QRFactorization<Type>::solveInPlace( DenseMatrix<MT,SO>& B ) const
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ElementType_<MT>, Type );
+
+   checkSolvable( (~B).rows() );
+
+   solveInPlace_backend( ~B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the determinant of the factorized matrix.
+//
+// \return The determinant of the factorized matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// The determinant is computed as the product of the diagonal elements of \a R and the
+// determinants of the Householder reflectors representing \a Q. The determinant of a
+// 0-by-0 matrix is 1. In case the factorized matrix is not a square matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline Type QRFactorization<Type>::det() const
+{
+   if( !isSquare( qr_ ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( qr_.rows() );
+
+   Type d( 1 );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      // The determinant of the Householder reflector H(j) = I - tau(j)*v*v^H is 1 - tau(j)*v^H*v
+      BuiltinType vnorm( 1 );
+      for( size_t i=j+1UL; i<n; ++i ) {
+         vnorm += real( conj( qr_(i,j) ) * qr_(i,j) );
+      }
+
+      d *= ( Type( 1 ) - tau_[j] * vnorm ) * qr_(j,j);
+   }
+
+   return d;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Estimates the reciprocal condition number of the factorized matrix.
+//
+// \return The estimate of the reciprocal condition number in the 1-norm.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function estimates the reciprocal of the condition number of the factor \a R in the
+// 1-norm via the LAPACK trcon() functions. Since \a Q is unitary, \a R has the same 2-norm
+// condition number as the factorized matrix. In case the returned value is close to zero,
+// the matrix is close to singular. For a rank deficient matrix the function returns 0, for
+// a 0-by-0 matrix it returns 1. In case the factorized matrix is not a square matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename QRFactorization<Type>::BuiltinType QRFactorization<Type>::rcond() const
+{
+   using AT = If_< IsComplex<Type>, BuiltinType, int >;
+
+   if( !isSquare( qr_ ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( singular_ ) {
+      return BuiltinType();
+   }
+
+   int n   ( numeric_cast<int>( qr_.rows() ) );
+   int lda ( numeric_cast<int>( qr_.spacing() ) );
+   int info( 0 );
+
+   BuiltinType rcond( 1 );
+
+   if( n == 0 ) {
+      return rcond;
+   }
+
+   Type* const work( ws_.get<Type>( 0UL, 3*n ) );
+   AT*   const aux ( ws_.get<AT>  ( 1UL, n ) );
+
+   trcon( '1', 'U', 'N', n, qr_.data(), lda, &rcond, work, aux, &info );
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for condition estimation" );
+
+   return rcond;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
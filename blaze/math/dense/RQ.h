@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -54,6 +53,7 @@
 #include <blaze/math/lapack/gerqf.h>
 #include <blaze/math/lapack/orgrq.h>
 #include <blaze/math/lapack/ungrq.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/traits/DerestrictTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
@@ -75,6 +75,10 @@ namespace blaze {
 //@{
 template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
 void rq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& R, DenseMatrix<MT3,SO3>& Q );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void rq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& R, DenseMatrix<MT3,SO3>& Q,
+         LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -86,6 +90,7 @@ void rq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& R, DenseMatrix<MT3
 //
 // \param A The RQ decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix RQ decomposition. It performs the
@@ -93,9 +98,9 @@ void rq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& R, DenseMatrix<MT3
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
-   rq_backend( MT1& A, const ElementType_<MT1>* tau )
+   rq_backend( MT1& A, const ElementType_<MT1>* tau, LAPACKWorkspace& ws )
 {
-   orgrq( A, tau );
+   orgrq( A, tau, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -108,6 +113,7 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 //
 // \param A The RQ decomposed column-major matrix.
 // \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
 // \return void
 //
 // This function is an auxiliary helper for the dense matrix RQ decomposition. It performs the
@@ -115,9 +121,9 @@ inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
 */
 template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsComplex< ElementType_<MT1> > >
-   rq_backend( MT1& A, const ElementType_<MT1>* tau )
+   rq_backend( MT1& A, const ElementType_<MT1>* tau, LAPACKWorkspace& ws )
 {
-   ungrq( A, tau );
+   ungrq( A, tau, ws );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -179,6 +185,41 @@ template< typename MT1  // Type of matrix A
         , typename MT3  // Type of matrix Q
         , bool SO3 >    // Storage order of matrix Q
 void rq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& R, DenseMatrix<MT3,SO3>& Q )
+{
+   LAPACKWorkspace ws;
+   rq( A, R, Q, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief RQ decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param R The resulting \c R matrix.
+// \param Q The resulting \c Q matrix.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix do not match.
+// \exception std::invalid_argument Square matrix cannot be resized to \a m-by-\a n.
+//
+// This function is identical to the rq() function without workspace argument, except that all
+// auxiliary memory (including the scalar factors of the elementary reflectors) is taken from the
+// given workspace \a ws (see LAPACKWorkspace). Thus the repeated decomposition of matrices of the
+// same size doesn't perform any temporary memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1  // Type of matrix A
+        , bool SO1      // Storage order of matrix A
+        , typename MT2  // Type of matrix R
+        , bool SO2      // Storage order of matrix R
+        , typename MT3  // Type of matrix Q
+        , bool SO3 >    // Storage order of matrix Q
+void rq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& R, DenseMatrix<MT3,SO3>& Q,
+         LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
@@ -208,13 +249,13 @@ void rq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& R, DenseMatrix<MT3
       BLAZE_THROW_INVALID_ARGUMENT( "Square matrix cannot be resized to m-by-min(m,n)" );
    }
 
-   const std::unique_ptr<ET1[]> tau( new ET1[mindim] );
+   ET1* const tau( ws.get<ET1>( 9UL, mindim ) );
    DerestrictTrait_<MT2> r( derestrict( ~R ) );
 
    if( m < n )
    {
       (~Q) = A;
-      gerqf( ~Q, tau.get() );
+      gerqf( ~Q, tau, ws );
 
       resize( ~R, m, m, false );
       reset( r );
@@ -225,14 +266,14 @@ void rq( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& R, DenseMatrix<MT3
          }
       }
 
-      rq_backend( ~Q, tau.get() );
+      rq_backend( ~Q, tau, ws );
    }
    else
    {
       r = A;
-      gerqf( r, tau.get() );
+      gerqf( r, tau, ws );
       (~Q) = submatrix( r, m-n, 0UL, n, n );
-      rq_backend( ~Q, tau.get() );
+      rq_backend( ~Q, tau, ws );
 
       for( size_t i=m-n; i<m; ++i ) {
          for( size_t j=0UL; j<i+n-m; ++j ) {
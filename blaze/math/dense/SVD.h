@@ -48,6 +48,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/gesdd.h>
 #include <blaze/math/lapack/gesvdx.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 
 
@@ -75,6 +76,22 @@ inline size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, S
 template< typename MT1, bool SO, typename VT, bool TF, typename MT2, typename MT3, typename ST >
 inline size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp );
+
+template< typename MT, bool SO, typename VT, bool TF >
+inline void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, LAPACKWorkspace& ws );
+
+template< typename MT1, bool SO, typename VT, bool TF, typename MT2, typename MT3 >
+inline void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                 DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, LAPACKWorkspace& ws );
+
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+inline size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
+                   ST low, ST upp, LAPACKWorkspace& ws );
+
+template< typename MT1, bool SO, typename VT, bool TF, typename MT2, typename MT3, typename ST >
+inline size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp,
+                   LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -131,6 +148,38 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
 inline void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+{
+   LAPACKWorkspace ws;
+   svd( ~A, ~s, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Singular value decomposition (SVD) of the given dense matrix with user-provided workspace.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according svd() function without workspace argument,
+// except that all auxiliary memory of the LAPACK functions is taken from the given workspace
+// \a ws (see LAPACKWorkspace). Thus repeated singular value decompositions of matrices of the
+// same size don't perform any memory allocation for the LAPACK work arrays.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
+                 LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
@@ -148,7 +197,7 @@ inline void svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
 
    Tmp tmp( A );
 
-   gesdd( tmp, s );
+   gesdd( tmp, s, ws );
 }
 //*************************************************************************************************
 
@@ -218,6 +267,45 @@ template< typename MT1    // Type of the matrix A
         , typename MT3 >  // Type of the matrix V
 inline void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V )
+{
+   LAPACKWorkspace ws;
+   svd( ~A, ~U, ~s, ~V, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Singular value decomposition (SVD) of the given dense matrix with user-provided workspace.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return void
+// \exception std::invalid_argument Dimensions of fixed size matrix U do not match.
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::invalid_argument Dimensions of fixed size matrix V do not match.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according svd() function without workspace argument,
+// except that all auxiliary memory of the LAPACK functions is taken from the given workspace
+// \a ws (see LAPACKWorkspace). Thus repeated singular value decompositions of matrices of the
+// same size don't perform any memory allocation for the LAPACK work arrays.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT2    // Type of the matrix U
+        , typename MT3 >  // Type of the matrix V
+inline void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                 DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V,
+                 LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
@@ -245,7 +333,7 @@ inline void svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 
    Tmp tmp( A );
 
-   gesdd( tmp, U, s, V, 'S' );
+   gesdd( tmp, U, s, V, 'S', ws );
 }
 //*************************************************************************************************
 
@@ -318,6 +406,43 @@ template< typename MT    // Type of the matrix A
         , bool TF        // Transpose flag of the vector s
         , typename ST >  // Type of the scalar boundary values
 inline size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp )
+{
+   LAPACKWorkspace ws;
+   return svd( ~A, ~s, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Singular value decomposition (SVD) of the given dense matrix with user-provided workspace.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param low The lower bound of the interval to be searched for singular values.
+// \param upp The upper bound of the interval to be searched for singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according svd() function without workspace argument,
+// except that all auxiliary memory of the LAPACK functions is taken from the given workspace
+// \a ws (see LAPACKWorkspace). Thus repeated singular value decompositions of matrices of the
+// same size don't perform any memory allocation for the LAPACK work arrays.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT    // Type of the matrix A
+        , bool SO        // Storage order of the matrix A
+        , typename VT    // Type of the vector s
+        , bool TF        // Transpose flag of the vector s
+        , typename ST >  // Type of the scalar boundary values
+inline size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp,
+                   LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
@@ -337,7 +462,7 @@ inline size_t svd( const DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, S
 
    Tmp tmp( A );
 
-   return gesvdx( tmp, s, low, upp );
+   return gesvdx( tmp, s, low, upp, ws );
 }
 //*************************************************************************************************
 
@@ -429,6 +554,50 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp )
+{
+   LAPACKWorkspace ws;
+   return svd( ~A, ~U, ~s, ~V, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Singular value decomposition (SVD) of the given dense matrix with user-provided workspace.
+// \ingroup dense_matrix
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param low The lower bound of the interval to be searched for singular values.
+// \param upp The upper bound of the interval to be searched for singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK functions.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Dimensions of fixed size matrix U do not match.
+// \exception std::invalid_argument Size of fixed size vector does not match.
+// \exception std::invalid_argument Dimensions of fixed size matrix V do not match.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according svd() function without workspace argument,
+// except that all auxiliary memory of the LAPACK functions is taken from the given workspace
+// \a ws (see LAPACKWorkspace). Thus repeated singular value decompositions of matrices of the
+// same size don't perform any memory allocation for the LAPACK work arrays.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a call to this function will result in a linker error.
+*/
+template< typename MT1   // Type of the matrix A
+        , bool SO        // Storage order of all matrices
+        , typename VT    // Type of the vector s
+        , bool TF        // Transpose flag of the vector s
+        , typename MT2   // Type of the matrix U
+        , typename MT3   // Type of the matrix V
+        , typename ST >  // Type of the scalar boundary values
+inline size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp,
+                   LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT1> );
@@ -458,7 +627,7 @@ inline size_t svd( const DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 
    Tmp tmp( A );
 
-   return gesvdx( tmp, U, s, V, low, upp );
+   return gesvdx( tmp, U, s, V, low, upp, ws );
 }
 //*************************************************************************************************
 
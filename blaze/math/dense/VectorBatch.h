@@ -0,0 +1,670 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/VectorBatch.h
+//  \brief Header file for the implementation of a batch of small dense vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+#ifndef _BLAZE_MATH_DENSE_VECTORBATCH_H_
+#define _BLAZE_MATH_DENSE_VECTORBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup vector_batch VectorBatch
+// \ingroup dense_vector
+*/
+/*!\brief Batch of small dense vectors of fixed size stored in an interleaved layout.
+// \ingroup vector_batch
+//
+// The VectorBatch class template represents a batch of an arbitrary number of dense vectors of
+// the compile time fixed size \a N:
+
+   \code
+   template< typename Type, size_t N >
+   class VectorBatch;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. VectorBatch can only be used with the
+//          floating point data types \c float and \c double.
+//  - N   : specifies the number of elements of each vector.
+//
+// In contrast to an array of StaticVector, the elements of all vectors are stored interleaved:
+// the \a i-th element of the \a k-th vector is stored at position \f$ i \cdot s + k \f$, where
+// \f$ s \f$ is the spacing of the batch (see the spacing() function). The spacing is the number
+// of vectors rounded up to a multiple of the SIMD width, all unused padding elements are zero.
+// This layout allows to process SIMD-width many vectors with a single SIMD operation and is
+// therefore used as right-hand side for the batched solvers of the MatrixBatch class template:
+
+   \code
+   blaze::MatrixBatch<double,3UL,3UL> A( 100000UL );
+   blaze::VectorBatch<double,3UL> b( 100000UL );
+
+   // ... Initializing the matrices and vectors via set() or the function call operator
+
+   solve( A, b );  // Solving all 100000 linear systems of equations
+   \endcode
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+class VectorBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = VectorBatch<Type,N>;                //!< Type of this VectorBatch instance.
+   using ElementType    = Type;                               //!< Type of the vector elements.
+   using VectorType     = StaticVector<Type,N,columnVector>;  //!< Type of a single vector.
+   using Reference      = Type&;                              //!< Reference to a non-constant vector value.
+   using ConstReference = const Type&;                        //!< Reference to a constant vector value.
+   using Pointer        = Type*;                              //!< Pointer to a non-constant vector value.
+   using ConstPointer   = const Type*;                        //!< Pointer to a constant vector value.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline VectorBatch( size_t n = 0UL );
+   explicit inline VectorBatch( size_t n, const Type& init );
+            inline VectorBatch( const VectorBatch& b );
+            inline VectorBatch( VectorBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~VectorBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i ) const noexcept;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t i ) noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline VectorBatch& operator=( const VectorBatch& rhs );
+   inline VectorBatch& operator=( VectorBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                           inline size_t           size   () const noexcept;
+                           inline size_t           spacing() const noexcept;
+   static                  inline constexpr size_t length () noexcept;
+                           inline VectorType       get    ( size_t k ) const;
+   template< typename VT > inline void             set    ( size_t k, const DenseVector<VT,columnVector>& v );
+                           inline void             resize ( size_t n );
+                           inline void             swap   ( VectorBatch& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t addPadding( size_t n ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of vectors.
+   size_t spacing_;          //!< The number of elements between two elements of the same vector.
+   Type* BLAZE_RESTRICT v_;  //!< The interleaved elements of all vectors.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   BLAZE_STATIC_ASSERT( N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n vectors.
+//
+// \param n The number of vectors of the batch.
+//
+// All elements of the vectors are initialized to 0.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::VectorBatch( size_t n )
+   : VectorBatch( n, Type() )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n vectors with homogeneous initialization.
+//
+// \param n The number of vectors of the batch.
+// \param init The initial value of the vector elements.
+//
+// All elements of the vectors are initialized with the specified value. The padding elements
+// are initialized to 0.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::VectorBatch( size_t n, const Type& init )
+   : size_   ( n )                                                    // The current number of vectors
+   , spacing_( addPadding( n ) )                                      // The spacing of the batch
+   , v_      ( spacing_ > 0UL ? allocate<Type>( N*spacing_ ) : nullptr )  // The interleaved elements
+{
+   for( size_t i=0UL; i<N; ++i ) {
+      std::fill( v_+i*spacing_, v_+i*spacing_+size_, init );
+      std::fill( v_+i*spacing_+size_, v_+(i+1UL)*spacing_, Type() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for VectorBatch.
+//
+// \param b The vector batch to be copied.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::VectorBatch( const VectorBatch& b )
+   : size_   ( b.size_ )                                              // The current number of vectors
+   , spacing_( b.spacing_ )                                           // The spacing of the batch
+   , v_      ( spacing_ > 0UL ? allocate<Type>( N*spacing_ ) : nullptr )  // The interleaved elements
+{
+   std::copy( b.v_, b.v_+N*spacing_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for VectorBatch.
+//
+// \param b The vector batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::VectorBatch( VectorBatch&& b ) noexcept
+   : size_   ( b.size_ )     // The current number of vectors
+   , spacing_( b.spacing_ )  // The spacing of the batch
+   , v_      ( b.v_ )        // The interleaved elements
+{
+   b.size_    = 0UL;
+   b.spacing_ = 0UL;
+   b.v_       = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for VectorBatch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>::~VectorBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the elements of the vectors.
+//
+// \param k Index of the accessed vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::Reference
+   VectorBatch<Type,N>::operator()( size_t k, size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid vector access index" );
+   BLAZE_USER_ASSERT( i < N    , "Invalid element access index" );
+   return v_[i*spacing_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the elements of the vectors.
+//
+// \param k Index of the accessed vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Index of the accessed element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::ConstReference
+   VectorBatch<Type,N>::operator()( size_t k, size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid vector access index" );
+   BLAZE_USER_ASSERT( i < N    , "Invalid element access index" );
+   return v_[i*spacing_+k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the vector elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the vector batch. The \a i-th
+// element of the \a k-th vector is stored at position \f$ i \cdot s + k \f$, where \f$ s \f$
+// is the spacing of the batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::Pointer VectorBatch<Type,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the vector elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the vector batch. The \a i-th
+// element of the \a k-th vector is stored at position \f$ i \cdot s + k \f$, where \f$ s \f$
+// is the spacing of the batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::ConstPointer VectorBatch<Type,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the \a i-th element of all vectors.
+//
+// \param i The element index.
+// \return Pointer to the \a i-th element of the first vector.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::Pointer VectorBatch<Type,N>::data( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < N, "Invalid element access index" );
+   return v_ + i*spacing_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the \a i-th element of all vectors.
+//
+// \param i The element index.
+// \return Pointer to the \a i-th element of the first vector.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::ConstPointer VectorBatch<Type,N>::data( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < N, "Invalid element access index" );
+   return v_ + i*spacing_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for VectorBatch.
+//
+// \param rhs Vector batch to be copied.
+// \return Reference to the assigned vector batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>& VectorBatch<Type,N>::operator=( const VectorBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   VectorBatch tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for VectorBatch.
+//
+// \param rhs The vector batch to be moved into this instance.
+// \return Reference to the assigned vector batch.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline VectorBatch<Type,N>& VectorBatch<Type,N>::operator=( VectorBatch&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_    = rhs.size_;
+   spacing_ = rhs.spacing_;
+   v_       = rhs.v_;
+
+   rhs.size_    = 0UL;
+   rhs.spacing_ = 0UL;
+   rhs.v_       = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of vectors of the batch.
+//
+// \return The number of vectors.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline size_t VectorBatch<Type,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between two consecutive elements of the same vector.
+//
+// \return The spacing of the batch.
+//
+// The spacing is the number of vectors rounded up to a multiple of the SIMD width.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline size_t VectorBatch<Type,N>::spacing() const noexcept
+{
+   return spacing_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements of each vector.
+//
+// \return The size \a N of each vector.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline constexpr size_t VectorBatch<Type,N>::length() noexcept
+{
+   return N;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the \a k-th vector of the batch.
+//
+// \param k The index of the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \return The \a k-th vector.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline typename VectorBatch<Type,N>::VectorType VectorBatch<Type,N>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid vector access index" );
+
+   VectorType v;
+   for( size_t i=0UL; i<N; ++i ) {
+      v[i] = v_[i*spacing_+k];
+   }
+   return v;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the \a k-th vector of the batch.
+//
+// \param k The index of the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param v The new value of the \a k-th vector.
+// \return void
+// \exception std::invalid_argument Invalid vector size.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+template< typename VT >  // Type of the dense vector
+inline void VectorBatch<Type,N>::set( size_t k, const DenseVector<VT,columnVector>& v )
+{
+   BLAZE_USER_ASSERT( k < size_, "Invalid vector access index" );
+
+   if( (~v).size() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size" );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      v_[i*spacing_+k] = (~v)[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of vectors of the batch.
+//
+// \param n The new number of vectors.
+// \return void
+//
+// This function changes the number of vectors of the batch. The values of the first
+// \f$ \min(n,size) \f$ vectors are preserved, all new vectors are initialized to 0.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void VectorBatch<Type,N>::resize( size_t n )
+{
+   if( n == size_ ) return;
+
+   VectorBatch tmp( n );
+   const size_t m( min( n, size_ ) );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      std::copy( v_+i*spacing_, v_+i*spacing_+m, tmp.v_+i*tmp.spacing_ );
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vector batches.
+//
+// \param b The vector batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void VectorBatch<Type,N>::swap( VectorBatch& b ) noexcept
+{
+   using std::swap;
+
+   swap( size_   , b.size_    );
+   swap( spacing_, b.spacing_ );
+   swap( v_      , b.v_       );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the spacing for the given number of vectors.
+//
+// \param n The number of vectors.
+// \return The number of vectors rounded up to a multiple of the SIMD width.
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline size_t VectorBatch<Type,N>::addPadding( size_t n ) noexcept
+{
+   return nextMultiple<size_t>( n, SIMDSIZE );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name VectorBatch operators */
+//@{
+template< typename Type, size_t N >
+inline void swap( VectorBatch<Type,N>& a, VectorBatch<Type,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two vector batches.
+// \ingroup vector_batch
+//
+// \param a The first vector batch to be swapped.
+// \param b The second vector batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vectors
+        , size_t N >     // Number of elements of each vector
+inline void swap( VectorBatch<Type,N>& a, VectorBatch<Type,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1458 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatReduceExpr.h
+//  \brief Header file for the dense matrix reduction functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatReduceExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense matrix reduction operation.
+// \ingroup dense_matrix
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+struct DMatReduceExprHelper
+{
+   //**Type definitions****************************************************************************
+   //! Composite type of the dense matrix expression.
+   using CT = RemoveReference_< CompositeType_<MT> >;
+
+   //! Element type of the dense matrix expression.
+   using ET = ElementType_<CT>;
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   //! Helper structure for the detection of the SIMD capabilities of the given reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::template simdEnabled<ET,ET>() };
+   };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : bool { value = useOptimizedKernels &&
+                         CT::simdEnabled &&
+                         If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  CLASS DMATREDUCEEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for row-wise and column-wise dense matrix reduction operations.
+// \ingroup dense_vector_expression
+//
+// The DMatReduceExpr class represents the compile time expression for the partial reduction
+// of a dense matrix. In case of a column-wise reduction (\a RF = \a columnwise) each column of
+// the matrix is reduced to a single element of the resulting row vector, in case of a row-wise
+// reduction (\a RF = \a rowwise) each row of the matrix is reduced to a single element of the
+// resulting column vector.
+*/
+template< typename MT         // Type of the dense matrix
+        , typename OP         // Type of the reduction operation
+        , ReductionFlag RF >  // Reduction flag
+class DMatReduceExpr
+   : public MatReduceExpr< DenseVector< DMatReduceExpr<MT,OP,RF>, RF == columnwise >, RF >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT = ResultType_<MT>;     //!< Result type of the dense matrix expression.
+   using CT = CompositeType_<MT>;  //!< Composite type of the dense matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Transpose flag of the resulting vector.
+   enum : bool { TF = ( RF == columnwise ) };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the dense matrix expression.
+   enum : bool { evaluateMatrix = RequiresEvaluation<MT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the dense matrix operand requires an intermediate evaluation, the
+       nested \value will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseSMPAssign {
+      enum : bool { value = evaluateMatrix };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DMatReduceExpr<MT,OP,RF>;    //!< Type of this DMatReduceExpr instance.
+   using ResultType    = IfTrue_< TF, RowTrait_<RT>, ColumnTrait_<RT> >;  //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;    //!< Resulting element type.
+   using ReturnType    = const ElementType;           //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;            //!< Data type for composite expression templates.
+
+   //! Composite data type of the dense matrix expression.
+   using Operand = If_< IsExpression<MT>, const MT, const MT& >;
+
+   //! Data type of the reduction operation.
+   using Operation = OP;
+
+   //! Type for the assignment of the dense matrix operand.
+   using LT = IfTrue_< evaluateMatrix, const RT, CT >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = !evaluateMatrix && MT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatReduceExpr class.
+   //
+   // \param dm The dense matrix operand of the reduction expression.
+   // \param op The reduction operation.
+   */
+   explicit inline DMatReduceExpr( const MT& dm, OP op ) noexcept
+      : dm_( dm )  // Dense matrix of the reduction expression
+      , op_( op )  // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < size(), "Invalid vector access index" );
+
+      if( RF == columnwise )
+         return dvecreduce( column( dm_, index ), op_ );
+      else
+         return dvecreduce( row( dm_, index ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= size() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return ( RF == columnwise )?( dm_.columns() ):( dm_.rows() );
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense matrix operand.
+   //
+   // \return The dense matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return dm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return dm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return dm_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( dm_.rows() * dm_.columns() >= SMP_DMATREDUCE_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   dm_;  //!< Dense matrix of the reduction expression.
+   Operation op_;  //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a row-wise/column-wise dense matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a row-wise/column-wise
+   // dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( serial( rhs.dm_ ) );  // Evaluation of the dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.dm_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.dm_.columns(), "Invalid number of columns" );
+
+      dmatreduce( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a row-wise/column-wise dense matrix reduction to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a row-wise/column-wise
+   // dense matrix reduction expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a row-wise/column-wise dense matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a row-wise/
+   // column-wise dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a row-wise/column-wise dense matrix reduction to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a row-wise/
+   // column-wise dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a row-wise/column-wise dense matrix reduction to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a row-wise/
+   // column-wise dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a row-wise/column-wise dense matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a row-wise/
+   // column-wise dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise/column-wise dense matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise/column-wise
+   // dense matrix reduction expression to a dense vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // dense matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const RT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+      smpAssign( ~lhs, DMatReduceExpr<RT,OP,RF>( tmp, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise/column-wise dense matrix reduction to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise/column-wise
+   // dense matrix reduction expression to a sparse vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // dense matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( SparseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a row-wise/column-wise dense matrix reduction to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a row-wise/
+   // column-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the dense matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAddAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a row-wise/column-wise dense matrix reduction to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a row-wise/
+   // column-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the dense matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpSubAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a row-wise/column-wise dense matrix reduction to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // row-wise/column-wise dense matrix reduction expression to a dense vector. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the dense matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpMultAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a row-wise/column-wise dense matrix reduction to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a row-wise/
+   // column-wise dense matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the dense matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpDivAssign( DenseVector<VT1,TF>& lhs, const DMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default serial reduction of the elements of the given dense
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case vectorization cannot be applied.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   using CT = CompositeType_<MT>;
+   using ET = ElementType_<MT>;
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT tmp( ~dm );
+
+   ET redux( tmp(0UL,0UL) );
+
+   if( SO == rowMajor ) {
+      for( size_t j=1UL; j<N; ++j ) {
+         redux = op( redux, tmp(0UL,j) );
+      }
+      for( size_t i=1UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            redux = op( redux, tmp(i,j) );
+         }
+      }
+   }
+   else {
+      for( size_t i=1UL; i<M; ++i ) {
+         redux = op( redux, tmp(i,0UL) );
+      }
+      for( size_t j=1UL; j<N; ++j ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            redux = op( redux, tmp(i,j) );
+         }
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given row-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the performance optimized reduction of the elements of the given
+// row-major dense matrix. The elements are reduced by means of four independent SIMD
+// accumulators, which are carried across all rows of the matrix and are combined and
+// horizontally reduced at the end of the computation. Due to the explicit application of
+// the SFINAE principle, this function can only be selected by the compiler in case
+// vectorization can be applied.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   using CT = CompositeType_<MT>;
+   using ET = ElementType_<MT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT tmp( ~dm );
+
+   const size_t jpos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   if( jpos == 0UL ) {
+      ET redux( tmp(0UL,0UL) );
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=( i == 0UL ? 1UL : 0UL ); j<N; ++j ) {
+            redux = op( redux, tmp(i,j) );
+         }
+      }
+      return redux;
+   }
+
+   SIMDTrait_<ET> xmm1( tmp.load(0UL,0UL) );
+
+   if( jpos >= SIMDSIZE*4UL )
+   {
+      SIMDTrait_<ET> xmm2( tmp.load(0UL,SIMDSIZE    ) );
+      SIMDTrait_<ET> xmm3( tmp.load(0UL,SIMDSIZE*2UL) );
+      SIMDTrait_<ET> xmm4( tmp.load(0UL,SIMDSIZE*3UL) );
+      size_t j( SIMDSIZE*4UL );
+
+      for( size_t i=0UL; i<M; ++i, j=0UL )
+      {
+         for( ; (j+SIMDSIZE*4UL) <= jpos; j+=SIMDSIZE*4UL ) {
+            xmm1 = op.load( xmm1, tmp.load(i,j             ) );
+            xmm2 = op.load( xmm2, tmp.load(i,j+SIMDSIZE    ) );
+            xmm3 = op.load( xmm3, tmp.load(i,j+SIMDSIZE*2UL) );
+            xmm4 = op.load( xmm4, tmp.load(i,j+SIMDSIZE*3UL) );
+         }
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 = op.load( xmm1, tmp.load(i,j) );
+         }
+      }
+
+      xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+   }
+   else
+   {
+      size_t j( SIMDSIZE );
+
+      for( size_t i=0UL; i<M; ++i, j=0UL ) {
+         for( ; j<jpos; j+=SIMDSIZE ) {
+            xmm1 = op.load( xmm1, tmp.load(i,j) );
+         }
+      }
+   }
+
+   alignas( AlignmentOf<ET>::value ) ET array[SIMDSIZE];
+   storea( array, xmm1 );
+
+   ET redux( array[0UL] );
+
+   for( size_t k=1UL; k<SIMDSIZE; ++k ) {
+      redux = op( redux, array[k] );
+   }
+
+   if( jpos < N ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=jpos; j<N; ++j ) {
+            redux = op( redux, tmp(i,j) );
+         }
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given column-major dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the performance optimized reduction of the elements of the given
+// column-major dense matrix. The elements are reduced by means of four independent SIMD
+// accumulators, which are carried across all columns of the matrix and are combined and
+// horizontally reduced at the end of the computation. Due to the explicit application of
+// the SFINAE principle, this function can only be selected by the compiler in case
+// vectorization can be applied.
+*/
+template< typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DMatReduceExprHelper<MT,OP>, ElementType_<MT> >
+   dmatreduce( const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   using CT = CompositeType_<MT>;
+   using ET = ElementType_<MT>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   if( M == 0UL || N == 0UL ) return ET();
+
+   CT tmp( ~dm );
+
+   const size_t ipos( M & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( M - ( M % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   if( ipos == 0UL ) {
+      ET redux( tmp(0UL,0UL) );
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t i=( j == 0UL ? 1UL : 0UL ); i<M; ++i ) {
+            redux = op( redux, tmp(i,j) );
+         }
+      }
+      return redux;
+   }
+
+   SIMDTrait_<ET> xmm1( tmp.load(0UL,0UL) );
+
+   if( ipos >= SIMDSIZE*4UL )
+   {
+      SIMDTrait_<ET> xmm2( tmp.load(SIMDSIZE    ,0UL) );
+      SIMDTrait_<ET> xmm3( tmp.load(SIMDSIZE*2UL,0UL) );
+      SIMDTrait_<ET> xmm4( tmp.load(SIMDSIZE*3UL,0UL) );
+      size_t i( SIMDSIZE*4UL );
+
+      for( size_t j=0UL; j<N; ++j, i=0UL )
+      {
+         for( ; (i+SIMDSIZE*4UL) <= ipos; i+=SIMDSIZE*4UL ) {
+            xmm1 = op.load( xmm1, tmp.load(i             ,j) );
+            xmm2 = op.load( xmm2, tmp.load(i+SIMDSIZE    ,j) );
+            xmm3 = op.load( xmm3, tmp.load(i+SIMDSIZE*2UL,j) );
+            xmm4 = op.load( xmm4, tmp.load(i+SIMDSIZE*3UL,j) );
+         }
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            xmm1 = op.load( xmm1, tmp.load(i,j) );
+         }
+      }
+
+      xmm1 = op.load( op.load( xmm1, xmm2 ), op.load( xmm3, xmm4 ) );
+   }
+   else
+   {
+      size_t i( SIMDSIZE );
+
+      for( size_t j=0UL; j<N; ++j, i=0UL ) {
+         for( ; i<ipos; i+=SIMDSIZE ) {
+            xmm1 = op.load( xmm1, tmp.load(i,j) );
+         }
+      }
+   }
+
+   alignas( AlignmentOf<ET>::value ) ET array[SIMDSIZE];
+   storea( array, xmm1 );
+
+   ET redux( array[0UL] );
+
+   for( size_t k=1UL; k<SIMDSIZE; ++k ) {
+      redux = op( redux, array[k] );
+   }
+
+   if( ipos < M ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t i=ipos; i<M; ++i ) {
+            redux = op( redux, tmp(i,j) );
+         }
+      }
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the row-wise reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense column vector.
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function reduces each row of the given row-major dense matrix separately by means of
+// the (potentially vectorized) dense vector reduction kernel.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline void dmatreduce( DenseVector<VT,columnVector>& lhs, const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~dm).rows(), "Invalid vector size" );
+
+   const size_t M( (~dm).rows() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      (~lhs)[i] = dvecreduce( row( ~dm, i ), op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the column-wise reduction of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense row vector.
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function reduces each column of the given column-major dense matrix separately by means
+// of the (potentially vectorized) dense vector reduction kernel.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline void dmatreduce( DenseVector<VT,rowVector>& lhs, const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~dm).columns(), "Invalid vector size" );
+
+   const size_t N( (~dm).columns() );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      (~lhs)[j] = dvecreduce( column( ~dm, j ), op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the column-wise reduction of a row-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense row vector.
+// \param dm The given row-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function reduces the columns of the given row-major dense matrix by accumulating the
+// rows of the matrix one after another in the target vector. Thus the matrix is traversed in
+// storage order and the accumulation is vectorized in case the reduction operation provides a
+// SIMD implementation.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline void dmatreduce( DenseVector<VT,rowVector>& lhs, const DenseMatrix<MT,rowMajor>& dm, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~dm).columns(), "Invalid vector size" );
+
+   const size_t M( (~dm).rows() );
+
+   if( M == 0UL ) {
+      reset( ~lhs );
+      return;
+   }
+
+   assign( ~lhs, row( ~dm, 0UL ) );
+
+   for( size_t i=1UL; i<M; ++i ) {
+      assign( ~lhs, map( ~lhs, row( ~dm, i ), op ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the row-wise reduction of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param lhs The target left-hand side dense column vector.
+// \param dm The given column-major dense matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function reduces the rows of the given column-major dense matrix by accumulating the
+// columns of the matrix one after another in the target vector. Thus the matrix is traversed
+// in storage order and the accumulation is vectorized in case the reduction operation provides
+// a SIMD implementation.
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline void dmatreduce( DenseVector<VT,columnVector>& lhs, const DenseMatrix<MT,columnMajor>& dm, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~dm).rows(), "Invalid vector size" );
+
+   const size_t N( (~dm).columns() );
+
+   if( N == 0UL ) {
+      reset( ~lhs );
+      return;
+   }
+
+   assign( ~lhs, column( ~dm, 0UL ) );
+
+   for( size_t j=1UL; j<N; ++j ) {
+      assign( ~lhs, map( ~lhs, column( ~dm, j ), op ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces all elements of the given dense matrix \a dm by means of the given
+// reduction operation \a op:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( A, blaze::Add() );
+   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// The given operation must be associative and commutative, since the elements are reduced in
+// several independent chains and (in case the matrix is large enough) in parallel by several
+// threads. In case the operation provides a SIMD implementation (see \ref custom_operations),
+// the reduction is vectorized. Note that matrix expressions are reduced directly without the
+// creation of a temporary matrix (as long as the expression does not require an intermediate
+// evaluation).
+//
+// In case the matrix has either 0 rows or 0 columns, the function returns the default value
+// of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_<MT>;
+   using ET = ElementType_<MT>;
+
+   if( (~dm).rows() == 0UL || (~dm).columns() == 0UL ) return ET();
+
+   CT tmp( ~dm );  // Evaluation of the dense matrix operand
+
+   return smpReduce( tmp, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense matrix by means of addition:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalsum = sum( A );  // Results in 10
+   \endcode
+
+// In case the matrix has either 0 rows or 0 columns, the function returns the default value
+// of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense matrix by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense matrix by means of multiplication:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   const int totalprod = prod( A );  // Results in 24
+   \endcode
+
+// In case the matrix has either 0 rows or 0 columns, the function returns the default value
+// of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The smallest dense matrix element.
+//
+// This function returns the smallest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The largest dense matrix element.
+//
+// This function returns the largest element of the given dense matrix. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// matrix currently has either 0 rows or 0 columns, the returned value is the default value
+// (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dm, Max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom row-wise or column-wise reduction operation on the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the rows or columns of the given dense matrix \a dm by means of the
+// given reduction operation \a op. In case the reduction flag \a RF is set to \a columnwise,
+// each column of the matrix is reduced to a single element of the resulting row vector. In
+// case \a RF is set to \a rowwise, each row is reduced to a single element of the resulting
+// column vector:
+
+   \code
+   using blaze::columnwise;
+   using blaze::rowwise;
+
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double,blaze::rowVector> colsums;
+   blaze::DynamicVector<double,blaze::columnVector> rowmax;
+   // ... Resizing and initialization
+
+   colsums = reduce<columnwise>( A, blaze::Add() );
+   rowmax  = reduce<rowwise>( A, []( double a, double b ){ return blaze::max( a, b ); } );
+   \endcode
+
+// The function returns an expression representing the partial reduction, i.e. the reduction
+// is performed as soon as the expression is assigned. In case the reduction follows the
+// storage order of the matrix (e.g. a row-wise reduction of a row-major matrix), each row
+// (or column) is reduced by the vectorized dense vector reduction kernel. Otherwise the rows
+// (or columns) of the matrix are accumulated one after another, which also results in a
+// traversal in storage order and a vectorized accumulation. For large matrices the reduction
+// is executed in parallel.
+//
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. In case a
+// row or column to be reduced is empty, the corresponding element of the result is set to
+// the default value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense matrix
+        , bool SO           // Storage order
+        , typename OP >     // Type of the reduction operation
+inline decltype(auto) reduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ReturnType = const DMatReduceExpr<MT,OP,RF>;
+   return ReturnType( ~dm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the rows or columns of the given dense matrix by means of addition.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function computes the row-wise or column-wise sums of the given dense matrix:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   blaze::DynamicVector<int,blaze::rowVector> colsums;
+   blaze::DynamicVector<int,blaze::columnVector> rowsums;
+
+   colsums = sum<blaze::columnwise>( A );  // Results in ( 4 6 )
+   rowsums = sum<blaze::rowwise>( A );     // Results in ( 3 7 )
+   \endcode
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+inline decltype(auto) sum( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the rows or columns of the given dense matrix by means of multiplication.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function computes the row-wise or column-wise products of the given dense matrix:
+
+   \code
+   blaze::DynamicMatrix<int> A{ { 1, 2 }, { 3, 4 } };
+
+   blaze::DynamicVector<int,blaze::rowVector> colprods;
+   blaze::DynamicVector<int,blaze::columnVector> rowprods;
+
+   colprods = prod<blaze::columnwise>( A );  // Results in ( 3 8 )
+   rowprods = prod<blaze::rowwise>( A );     // Results in ( 2 12 )
+   \endcode
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+inline decltype(auto) prod( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of each row or column of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The row-wise or column-wise minima.
+//
+// This function returns the smallest element of each row (\a RF = \a rowwise) or each column
+// (\a RF = \a columnwise) of the given dense matrix. This function can only be used for element
+// types that support the smaller-than relationship.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+inline decltype(auto) min( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of each row or column of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param dm The given dense matrix.
+// \return The row-wise or column-wise maxima.
+//
+// This function returns the largest element of each row (\a RF = \a rowwise) or each column
+// (\a RF = \a columnwise) of the given dense matrix. This function can only be used for element
+// types that support the smaller-than relationship.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the dense matrix
+        , bool SO >         // Storage order
+inline decltype(auto) max( const DenseMatrix<MT,SO>& dm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~dm, Max() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_EXPRESSIONS_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/ReductionFlag.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -59,6 +66,7 @@ template< typename, typename, bool > class DMatDMatSubExpr;
 template< typename, typename > class DMatDVecMultExpr;
 template< typename, bool > class DMatEvalExpr;
 template< typename, typename, bool > class DMatMapExpr;
+template< typename, typename, ReductionFlag > class DMatReduceExpr;
 template< typename, bool > class DMatInvExpr;
 template< typename, typename, bool > class DMatScalarDivExpr;
 template< typename, typename, bool > class DMatScalarMultExpr;
@@ -110,6 +118,7 @@ template< typename, typename, bool > class SMatDMatSubExpr;
 template< typename, typename > class SMatDVecMultExpr;
 template< typename, bool > class SMatEvalExpr;
 template< typename, typename, bool > class SMatMapExpr;
+template< typename, typename, ReductionFlag > class SMatReduceExpr;
 template< typename, typename, bool > class SMatScalarDivExpr;
 template< typename, typename, bool > class SMatScalarMultExpr;
 template< typename, bool > class SMatSerialExpr;
@@ -536,6 +545,13 @@ template< typename MT1, typename MT2, typename OP >
 decltype(auto) map( const DenseMatrix<MT1,true>&, const DenseMatrix<MT2,false>&, OP );
 
 
+template< ReductionFlag RF, typename MT, bool SO, typename OP >
+decltype(auto) reduce( const DenseMatrix<MT,SO>&, OP );
+
+template< ReductionFlag RF, typename MT, bool SO, typename OP >
+decltype(auto) reduce( const SparseMatrix<MT,SO>&, OP );
+
+
 template< typename MT, bool SO >
 inline decltype(auto) declsym( const DenseMatrix<MT,SO>& );
 
@@ -0,0 +1,1543 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/MatChainMultExpr.h
+//  \brief Header file for the matrix chain multiplication expression
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_MATCHAINMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_MATCHAINMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Bool.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MATCHAINMULTTRAIT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the result type of a contiguous range of a matrix multiplication chain.
+// \ingroup math_traits
+//
+// The MatChainMultTrait class template evaluates the resulting data type of the multiplication
+// of the matrices \a I to \a J (inclusive) of the given tuple of matrix types. The result is
+// computed as left fold of the MultTrait class template over the result types of the matrices.
+*/
+template< size_t I        // Index of the first matrix of the range
+        , size_t J        // Index of the last matrix of the range
+        , typename MTs >  // Tuple of the matrix types of the chain
+struct MatChainMultTrait
+{
+ public:
+   //**********************************************************************************************
+   using Type = MultTrait_< typename MatChainMultTrait<I,J-1UL,MTs>::Type
+                          , ResultType_< std::tuple_element_t<J,MTs> > >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the MatChainMultTrait class template for a single matrix.
+// \ingroup math_traits
+*/
+template< size_t I        // Index of the matrix
+        , typename MTs >  // Tuple of the matrix types of the chain
+struct MatChainMultTrait<I,I,MTs>
+{
+ public:
+   //**********************************************************************************************
+   using Type = ResultType_< std::tuple_element_t<I,MTs> >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of the expression type of the left-to-right multiplication of the first
+//        \a J+1 operands of a matrix multiplication chain.
+// \ingroup math_traits
+*/
+template< typename OTs  // Tuple of the operand types of the chain
+        , size_t J >    // Index of the last operand
+struct MatChainProductTrait
+{
+ public:
+   //**********************************************************************************************
+   using Type = decltype( std::declval< typename MatChainProductTrait<OTs,J-1UL>::Type >() *
+                          std::declval< std::tuple_element_t<J,OTs> >() );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the MatChainProductTrait class template for the first operand.
+// \ingroup math_traits
+*/
+template< typename OTs >  // Tuple of the operand types of the chain
+struct MatChainProductTrait<OTs,0UL>
+{
+ public:
+   //**********************************************************************************************
+   using Type = std::tuple_element_t<0UL,OTs>;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATCHAINMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for chains of matrix multiplications.
+// \ingroup math
+//
+// The MatChainMultExpr class represents the compile time expression for the multiplication of
+// three or more dense and/or sparse matrices (\f$ A*B*C*... \f$). In contrast to a nested tree
+// of binary multiplication expressions, which is always evaluated from left to right, the
+// MatChainMultExpr class determines the order of the individual multiplications at runtime.
+// Based on the current dimensions of the matrices and the number of non-zero elements of all
+// sparse matrices the cheapest parenthesization of the chain is selected by means of dynamic
+// programming. In case several parenthesizations are equally expensive, the left-to-right
+// evaluation order is preserved. Note that MatChainMultExpr instances are never created
+// explicitly, but result from the multiplication of matrix-matrix multiplication expressions.
+*/
+template< typename... MTs >  // Types of the matrix operands
+class MatChainMultExpr
+   : public MatMatMultExpr< If_< IsDenseMatrix< typename MatChainMultTrait< 0UL, sizeof...(MTs)-1UL, std::tuple<MTs...> >::Type >
+                               , DenseMatrix< MatChainMultExpr<MTs...>
+                                            , IsColumnMajorMatrix< typename MatChainMultTrait< 0UL, sizeof...(MTs)-1UL, std::tuple<MTs...> >::Type >::value >
+                               , SparseMatrix< MatChainMultExpr<MTs...>
+                                             , IsColumnMajorMatrix< typename MatChainMultTrait< 0UL, sizeof...(MTs)-1UL, std::tuple<MTs...> >::Type >::value > > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Number of matrices in the multiplication chain.
+   enum : size_t { N = sizeof...(MTs) };
+
+   //! Tuple of the matrix types of the chain.
+   using Types = std::tuple<MTs...>;
+
+   //! Index type for the compile time selection of a matrix of the chain.
+   template< size_t I >
+   using Index = std::integral_constant<size_t,I>;
+
+   //! Result type of the multiplication of the matrices \a I to \a J.
+   template< size_t I, size_t J >
+   using RangeResult = typename MatChainMultTrait<I,J,Types>::Type;
+
+   //! Table of the optimal splitting points of all subchains.
+   using Splits = std::array<size_t,N*N>;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   BLAZE_STATIC_ASSERT( N > 2UL );
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = MatChainMultExpr<MTs...>;   //!< Type of this MatChainMultExpr instance.
+   using ResultType    = RangeResult<0UL,N-1UL>;      //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_<ResultType>;   //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;    //!< Resulting element type.
+   using ReturnType    = const ElementType;           //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;            //!< Data type for composite expression templates.
+
+   //! Composite type of the matrix operands.
+   using Operands = std::tuple< If_< IsExpression<MTs>, const MTs, const MTs& >... >;
+
+   //! Type of the multiplication of all but the last matrix of the chain.
+   using LeftOperand = typename MatChainProductTrait<Operands,N-2UL>::Type;
+
+   //! Composite type of the last matrix of the chain.
+   using RightOperand = std::tuple_element_t<N-1UL,Operands>;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MatChainMultExpr class.
+   //
+   // \param operands The matrix operands of the multiplication chain.
+   */
+   explicit inline MatChainMultExpr( const Operands& operands ) noexcept
+      : operands_( operands )  // The matrix operands of the multiplication chain
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+      return row( leftOperand(), i ) * column( rightOperand(), j );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return std::get<0UL>( operands_ ).rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return std::get<N-1UL>( operands_ ).columns();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the sparse matrix.
+   //
+   // \return The number of non-zero elements in the sparse matrix.
+   */
+   inline constexpr size_t nonZeros() const noexcept {
+      return 0UL;
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the specified row/column.
+   //
+   // \param i The index of the row/column.
+   // \return The number of non-zero elements of row/column \a i.
+   */
+   inline size_t nonZeros( size_t i ) const noexcept {
+      UNUSED_PARAMETER( i );
+      return 0UL;
+   }
+   //**********************************************************************************************
+
+   //**Operands access*****************************************************************************
+   /*!\brief Returns the matrix operands of the multiplication chain.
+   //
+   // \return The matrix operands of the multiplication chain.
+   */
+   inline const Operands& operands() const noexcept {
+      return operands_;
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the multiplication of all but the last matrix of the chain.
+   //
+   // \return The multiplication of all but the last matrix of the chain.
+   */
+   inline LeftOperand leftOperand() const {
+      return product( Index<0UL>(), Index<N-2UL>() );
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the last matrix of the chain.
+   //
+   // \return The last matrix of the chain.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return std::get<N-1UL>( operands_ );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return isAliased( alias, Index<0UL>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return isAliased( alias, Index<0UL>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Aliasing check******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Checks whether the matrices \a I to \a N-1 are aliased with the given address.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T, size_t I >
+   inline bool isAliased( const T* alias, Index<I> ) const noexcept {
+      return std::get<I>( operands_ ).isAliased( alias ) || isAliased( alias, Index<I+1UL>() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Aliasing check******************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Terminating aliasing check beyond the last matrix of the chain.
+   //
+   // \return \a false.
+   */
+   template< typename T >
+   inline bool isAliased( const T* /*alias*/, Index<N> ) const noexcept {
+      return false;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Product of a subchain***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the left-to-right multiplication expression of the matrices \a I to \a J.
+   //
+   // \return The multiplication expression of the matrices \a I to \a J.
+   */
+   template< size_t I, size_t J >
+   inline decltype(auto) product( Index<I>, Index<J> ) const {
+      return product( Index<I>(), Index<J-1UL>() ) * std::get<J>( operands_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Product of a subchain***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the single matrix \a I of the chain.
+   //
+   // \return The matrix \a I.
+   */
+   template< size_t I >
+   inline std::tuple_element_t<I,Operands> product( Index<I>, Index<I> ) const {
+      return std::get<I>( operands_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Computation of the optimal evaluation order*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Computes the optimal parenthesization of the multiplication chain.
+   //
+   // \return The table of the optimal splitting points of all subchains.
+   //
+   // This function computes the cheapest parenthesization of the multiplication chain by means
+   // of dynamic programming. The cost of the multiplication of a \f$ M \times K \f$ matrix and
+   // a \f$ K \times N \f$ matrix is estimated by \f$ M \cdot K \cdot N \f$ multiplications,
+   // scaled by the fill ratio of all sparse operands. The fill ratio of a sparse product is
+   // estimated by assuming uniformly distributed non-zero elements. In case of a tie, the
+   // left-to-right evaluation order is preferred.
+   */
+   inline Splits computeSplits() const
+   {
+      std::array<double,N+1UL> dims;
+      std::array<double,N*N> cost{}, fill;
+      std::array<bool,N*N> dense;
+      Splits splits;
+
+      collect( dims, fill, dense, Index<0UL>() );
+
+      for( size_t length=1UL; length<N; ++length ) {
+         for( size_t i=0UL; i+length<N; ++i )
+         {
+            const size_t j( i+length );
+            double best( std::numeric_limits<double>::max() );
+
+            for( size_t k=j; k-- > i; )
+            {
+               const double current( cost[i*N+k] + cost[(k+1UL)*N+j] +
+                                     dims[i] * dims[k+1UL] * dims[j+1UL] *
+                                     fill[i*N+k] * fill[(k+1UL)*N+j] );
+
+               if( current < best ) {
+                  best = current;
+                  splits[i*N+j] = k;
+               }
+            }
+
+            const size_t k( splits[i*N+j] );
+
+            cost [i*N+j] = best;
+            dense[i*N+j] = dense[i*N+k] || dense[(k+1UL)*N+j];
+            fill [i*N+j] = ( dense[i*N+j] )
+                           ?( 1.0 )
+                           :( min( 1.0, fill[i*N+k] * fill[(k+1UL)*N+j] * dims[k+1UL] ) );
+         }
+      }
+
+      return splits;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Collection of the matrix properties*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Collects the dimensions and fill ratios of the matrices \a I to \a N-1.
+   //
+   // \param dims The dimensions of the matrices.
+   // \param fill The fill ratios of the matrices.
+   // \param dense The dense matrix flags of the matrices.
+   // \return void
+   */
+   template< size_t I >
+   inline void collect( std::array<double,N+1UL>& dims, std::array<double,N*N>& fill,
+                        std::array<bool,N*N>& dense, Index<I> ) const
+   {
+      const auto& mat( std::get<I>( operands_ ) );
+      const double size( static_cast<double>( mat.rows() ) * mat.columns() );
+
+      if( I == 0UL ) {
+         dims[0UL] = static_cast<double>( mat.rows() );
+      }
+      dims[I+1UL] = static_cast<double>( mat.columns() );
+
+      dense[I*N+I] = IsDenseMatrix< std::tuple_element_t<I,Types> >::value;
+      fill [I*N+I] = ( dense[I*N+I] || size == 0.0 )
+                     ?( 1.0 )
+                     :( nonZeros( mat, IsDenseMatrix< std::tuple_element_t<I,Types> >() ) / size );
+
+      collect( dims, fill, dense, Index<I+1UL>() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Collection of the matrix properties*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Terminating collection of the matrix properties beyond the last matrix of the chain.
+   //
+   // \return void
+   */
+   inline void collect( std::array<double,N+1UL>& /*dims*/, std::array<double,N*N>& /*fill*/,
+                        std::array<bool,N*N>& /*dense*/, Index<N> ) const noexcept
+   {}
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Number of non-zero elements*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the number of non-zero elements of a sparse matrix operand.
+   //
+   // \param mat The sparse matrix operand.
+   // \return The number of non-zero elements.
+   */
+   template< typename MT >
+   static inline double nonZeros( const MT& mat, FalseType ) {
+      return static_cast<double>( mat.nonZeros() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Number of non-zero elements*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the number of elements of a dense matrix operand.
+   //
+   // \param mat The dense matrix operand.
+   // \return The number of elements.
+   */
+   template< typename MT >
+   static inline double nonZeros( const MT& mat, TrueType ) {
+      return static_cast<double>( mat.rows() ) * mat.columns();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Serial evaluation selection*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selects the serial evaluation of the given intermediate multiplication.
+   //
+   // \param mat The intermediate multiplication expression.
+   // \return The serial evaluation expression of the multiplication.
+   */
+   template< typename MT >
+   static inline decltype(auto) select( const MT& mat, FalseType ) {
+      return serial( mat );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Parallel evaluation selection***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selects the (potentially) parallel evaluation of the given intermediate multiplication.
+   //
+   // \param mat The intermediate multiplication expression.
+   // \return Reference to the multiplication.
+   */
+   template< typename MT >
+   static inline const MT& select( const MT& mat, TrueType ) {
+      return mat;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Evaluation of a subchain********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Evaluation of the matrices \a I to \a J according to the given splitting points.
+   //
+   // \param splits The table of the optimal splitting points.
+   // \return The result of the multiplication of the matrices \a I to \a J.
+   */
+   template< typename SMP, size_t I, size_t J >
+   inline RangeResult<I,J> evaluateRange( const Splits& splits, Index<I>, Index<J> ) const
+   {
+      return split<SMP>( splits, []( const auto& A, const auto& B ) {
+         return RangeResult<I,J>( select( A * B, SMP() ) );
+      }, Index<I>(), Index<J>(), Index<I>(), Bool< ( I+1UL < J ) >() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Evaluation of a subchain********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Evaluation of the single matrix \a I of the chain.
+   //
+   // \return Reference to the matrix \a I.
+   */
+   template< typename SMP, size_t I >
+   inline decltype(auto) evaluateRange( const Splits& /*splits*/, Index<I>, Index<I> ) const
+   {
+      return std::get<I>( operands_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Splitting of a subchain*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Applies the given operation to the two evaluated halves of the matrices \a I to \a J.
+   //
+   // \param splits The table of the optimal splitting points.
+   // \param op The operation to be applied to the left and the right half of the subchain.
+   // \return The result of the operation.
+   //
+   // This function translates the runtime splitting point of the subchain \a I to \a J into a
+   // compile time index. In case \a K is not the optimal splitting point, the next splitting
+   // point is checked.
+   */
+   template< typename SMP, typename OP, size_t I, size_t J, size_t K >
+   inline decltype(auto) split( const Splits& splits, OP op, Index<I>, Index<J>, Index<K>, TrueType ) const
+   {
+      if( splits[I*N+J] == K ) {
+         return op( evaluateRange<SMP>( splits, Index<I>(), Index<K>() )
+                  , evaluateRange<SMP>( splits, Index<K+1UL>(), Index<J>() ) );
+      }
+      else {
+         return split<SMP>( splits, op, Index<I>(), Index<J>(), Index<K+1UL>(), Bool< ( K+2UL < J ) >() );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Splitting of a subchain*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Applies the given operation to the two evaluated halves of the matrices \a I to \a J
+   //        for the last possible splitting point \a K.
+   //
+   // \param splits The table of the optimal splitting points.
+   // \param op The operation to be applied to the left and the right half of the subchain.
+   // \return The result of the operation.
+   */
+   template< typename SMP, typename OP, size_t I, size_t J, size_t K >
+   inline decltype(auto) split( const Splits& splits, OP op, Index<I>, Index<J>, Index<K>, FalseType ) const
+   {
+      BLAZE_INTERNAL_ASSERT( splits[I*N+J] == K, "Invalid splitting point detected" );
+
+      return op( evaluateRange<SMP>( splits, Index<I>(), Index<K>() )
+               , evaluateRange<SMP>( splits, Index<K+1UL>(), Index<J>() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Application of the final multiplication*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Evaluates both halves of the chain and applies the given operation to them.
+   //
+   // \param op The operation to be applied to the left and the right half of the chain.
+   // \return void
+   */
+   template< typename SMP, typename OP >
+   inline void apply( OP op ) const
+   {
+      split<SMP>( computeSplits(), op, Index<0UL>(), Index<N-1UL>(), Index<0UL>(), Bool< ( 1UL < N-1UL ) >() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Operands operands_;  //!< The matrix operands of the multiplication chain.
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a matrix multiplication chain to a dense matrix (\f$ D=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a matrix multiplication
+   // chain to a dense matrix. All intermediate products are evaluated in the optimal order and
+   // the final multiplication is directly assigned to the target matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      rhs.template apply<FalseType>( [&lhs]( const auto& A, const auto& B ) {
+         assign( ~lhs, A * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a matrix multiplication chain to a sparse matrix (\f$ S=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication chain to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a matrix multiplication
+   // chain to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO >    // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      rhs.template apply<FalseType>( [&lhs]( const auto& A, const auto& B ) {
+         assign( ~lhs, A * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a matrix multiplication chain to a dense matrix
+   //        (\f$ D+=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a matrix
+   // multiplication chain to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      rhs.template apply<FalseType>( [&lhs]( const auto& A, const auto& B ) {
+         addAssign( ~lhs, A * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a matrix multiplication chain to a dense matrix
+   //        (\f$ D-=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a matrix
+   // multiplication chain to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      rhs.template apply<FalseType>( [&lhs]( const auto& A, const auto& B ) {
+         subAssign( ~lhs, A * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a matrix multiplication chain to a dense matrix
+   //        (\f$ D\circ=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a matrix
+   // multiplication chain to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void schurAssign( DenseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to sparse matrices*************************************************
+   // No special implementation for the Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a matrix multiplication chain to a dense matrix (\f$ D=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a matrix
+   // multiplication chain to a dense matrix. Both the intermediate products and the final
+   // multiplication are evaluated by means of the SMP assignment of the binary multiplication
+   // expressions.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void smpAssign( DenseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      rhs.template apply<TrueType>( [&lhs]( const auto& A, const auto& B ) {
+         smpAssign( ~lhs, A * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a matrix multiplication chain to a sparse matrix (\f$ S=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication chain to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a matrix
+   // multiplication chain to a sparse matrix.
+   */
+   template< typename MT  // Type of the target sparse matrix
+           , bool SO >    // Storage order of the target sparse matrix
+   friend inline void smpAssign( SparseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      rhs.template apply<TrueType>( [&lhs]( const auto& A, const auto& B ) {
+         smpAssign( ~lhs, A * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a matrix multiplication chain to a dense matrix
+   //        (\f$ D+=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a matrix
+   // multiplication chain to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void smpAddAssign( DenseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      rhs.template apply<TrueType>( [&lhs]( const auto& A, const auto& B ) {
+         smpAddAssign( ~lhs, A * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a matrix multiplication chain to a dense matrix
+   //        (\f$ D-=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a matrix
+   // multiplication chain to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void smpSubAssign( DenseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      rhs.template apply<TrueType>( [&lhs]( const auto& A, const auto& B ) {
+         smpSubAssign( ~lhs, A * B );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to dense matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP Schur product assignment of a matrix multiplication chain to a dense matrix
+   //        (\f$ D\circ=A*B*C \f$).
+   // \ingroup math
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication chain for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized SMP Schur product assignment of a
+   // matrix multiplication chain to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline void smpSchurAssign( DenseMatrix<MT,SO>& lhs, const MatChainMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( rhs );
+      smpSchurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP Schur product assignment to sparse matrices*********************************************
+   // No special implementation for the SMP Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the flattening of matrix multiplication chains.
+// \ingroup math
+//
+// This type trait evaluates whether the given matrix-matrix multiplication expression can be
+// flattened into a matrix multiplication chain. All multiplications that have been declared
+// or are known to be symmetric, Hermitian, lower, or upper are treated as opaque operands in
+// order to preserve their special evaluation kernels.
+*/
+template< typename MT >
+struct IsFlattenableMatMatMultExpr
+   : public And< IsMatMatMultExpr<MT>
+               , Not< Or< IsSymmetric<MT>, IsHermitian<MT>, IsLower<MT>, IsUpper<MT> > > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the operands of the given matrix multiplication chain.
+// \ingroup math
+//
+// \param mat The given matrix multiplication chain.
+// \return The operands of the matrix multiplication chain.
+*/
+template< typename... MTs >  // Types of the matrix operands
+inline auto matChainOperands( const MatChainMultExpr<MTs...>& mat )
+{
+   return mat.operands();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given matrix as the single operand of a matrix multiplication chain.
+// \ingroup math
+//
+// \param mat The given matrix.
+// \return Tuple containing the matrix.
+*/
+template< typename MT >  // Type of the matrix
+inline auto matChainOperands( const MT& mat, FalseType )
+{
+   return std::tuple< If_< IsExpression<MT>, const MT, const MT& > >( mat );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the flattened operands of the given matrix-matrix multiplication expression.
+// \ingroup math
+//
+// \param mat The given matrix-matrix multiplication expression.
+// \return The flattened operands of the multiplication.
+*/
+template< typename MT >  // Type of the matrix-matrix multiplication expression
+inline auto matChainOperands( const MT& mat, TrueType )
+{
+   return std::tuple_cat( matChainOperands( mat.leftOperand() )
+                        , matChainOperands( mat.rightOperand() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the operands of the given matrix within a matrix multiplication chain.
+// \ingroup math
+//
+// \param mat The given matrix.
+// \return The flattened operands of the matrix.
+*/
+template< typename MT >  // Type of the matrix
+inline auto matChainOperands( const MT& mat )
+{
+   return matChainOperands( mat, IsFlattenableMatMatMultExpr<MT>() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given dense matrix as dense matrix base.
+// \ingroup math
+//
+// \param mat The given dense matrix.
+// \return Reference to the dense matrix base.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const DenseMatrix<MT,SO>& matChainBase( const DenseMatrix<MT,SO>& mat ) noexcept
+{
+   return mat;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given sparse matrix as sparse matrix base.
+// \ingroup math
+//
+// \param mat The given sparse matrix.
+// \return Reference to the sparse matrix base.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const SparseMatrix<MT,SO>& matChainBase( const SparseMatrix<MT,SO>& mat ) noexcept
+{
+   return mat;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creation of a matrix multiplication chain from the given tuple of operands.
+// \ingroup math
+//
+// \param operands The flattened operands of the chain.
+// \param lhs The left-hand side matrix for the multiplication.
+// \param rhs The right-hand side matrix for the multiplication.
+// \return The matrix multiplication chain.
+*/
+template< typename... Ts  // Types of the flattened operands
+        , typename MT1    // Type of the left-hand side matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+inline decltype(auto)
+   matChainMult( const std::tuple<Ts...>& operands, TrueType, const MT1& lhs, const MT2& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+
+   return MatChainMultExpr< Decay_<Ts>... >( operands );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creation of a binary matrix multiplication in case the multiplication cannot be
+//        flattened.
+// \ingroup math
+//
+// \param operands The flattened operands of the chain.
+// \param lhs The left-hand side matrix for the multiplication.
+// \param rhs The right-hand side matrix for the multiplication.
+// \return The binary matrix multiplication expression.
+*/
+template< typename... Ts  // Types of the flattened operands
+        , typename MT1    // Type of the left-hand side matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+inline decltype(auto)
+   matChainMult( const std::tuple<Ts...>& operands, FalseType, const MT1& lhs, const MT2& rhs )
+{
+   UNUSED_PARAMETER( operands );
+
+   return matChainBase( lhs ) * matChainBase( rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of two matrices, at least one of which is a matrix-matrix multiplication.
+// \ingroup math
+//
+// \param lhs The left-hand side matrix for the multiplication.
+// \param rhs The right-hand side matrix for the multiplication.
+// \return The resulting matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1    // Type of the left-hand side matrix
+        , typename MT2 >  // Type of the right-hand side matrix
+inline decltype(auto) matChainMult( const MT1& lhs, const MT2& rhs )
+{
+   if( lhs.columns() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const auto operands( std::tuple_cat( matChainOperands( lhs ), matChainOperands( rhs ) ) );
+
+   return matChainMult( operands, Bool< ( std::tuple_size< Decay_<decltype( operands )> >::value > 2UL ) >(), lhs, rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a matrix-matrix multiplication
+//        expression and a dense matrix (\f$ D=(A*B)*C \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side matrix-matrix multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// matrix-matrix multiplication expression and a dense matrix. It flattens the expression
+// into a single matrix multiplication chain, whose evaluation order is selected at runtime.
+*/
+template< typename MT1  // Matrix base type of the left-hand side expression
+        , typename MT2  // Type of the right-hand side dense matrix
+        , bool SO >     // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const MatMatMultExpr<MT1>& lhs, const DenseMatrix<MT2,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return matChainMult( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a matrix-matrix multiplication
+//        expression and a sparse matrix (\f$ D=(A*B)*C \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side matrix-matrix multiplication.
+// \param rhs The right-hand side sparse matrix for the multiplication.
+// \return The resulting matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// matrix-matrix multiplication expression and a sparse matrix. It flattens the expression
+// into a single matrix multiplication chain, whose evaluation order is selected at runtime.
+*/
+template< typename MT1  // Matrix base type of the left-hand side expression
+        , typename MT2  // Type of the right-hand side sparse matrix
+        , bool SO >     // Storage order of the right-hand side sparse matrix
+inline decltype(auto)
+   operator*( const MatMatMultExpr<MT1>& lhs, const SparseMatrix<MT2,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return matChainMult( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a dense matrix and a matrix-matrix
+//        multiplication expression (\f$ D=A*(B*C) \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side dense matrix for the multiplication.
+// \param rhs The right-hand side matrix-matrix multiplication.
+// \return The resulting matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// dense matrix and a matrix-matrix multiplication expression. It flattens the expression
+// into a single matrix multiplication chain, whose evaluation order is selected at runtime.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO       // Storage order of the left-hand side dense matrix
+        , typename MT2 >  // Matrix base type of the right-hand side expression
+inline decltype(auto)
+   operator*( const DenseMatrix<MT1,SO>& lhs, const MatMatMultExpr<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return matChainMult( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a sparse matrix and a matrix-matrix
+//        multiplication expression (\f$ D=A*(B*C) \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side sparse matrix for the multiplication.
+// \param rhs The right-hand side matrix-matrix multiplication.
+// \return The resulting matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of a
+// sparse matrix and a matrix-matrix multiplication expression. It flattens the expression
+// into a single matrix multiplication chain, whose evaluation order is selected at runtime.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , bool SO         // Storage order of the left-hand side sparse matrix
+        , typename MT2 >  // Matrix base type of the right-hand side expression
+inline decltype(auto)
+   operator*( const SparseMatrix<MT1,SO>& lhs, const MatMatMultExpr<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return matChainMult( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of two matrix-matrix multiplication
+//        expressions (\f$ E=(A*B)*(C*D) \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side matrix-matrix multiplication.
+// \param rhs The right-hand side matrix-matrix multiplication.
+// \return The resulting matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator implements a performance optimized treatment of the multiplication of two
+// matrix-matrix multiplication expressions. It flattens the expression into a single matrix
+// multiplication chain, whose evaluation order is selected at runtime.
+*/
+template< typename MT1    // Matrix base type of the left-hand side expression
+        , typename MT2 >  // Matrix base type of the right-hand side expression
+inline decltype(auto)
+   operator*( const MatMatMultExpr<MT1>& lhs, const MatMatMultExpr<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return matChainMult( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a matrix-matrix multiplication
+//        expression and a scaled dense matrix (\f$ D=(A*B)*(s*C) \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side matrix-matrix multiplication.
+// \param rhs The right-hand side scaled dense matrix.
+// \return The scaled matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator restructures the expression \f$ D=(A*B)*(s*C) \f$ to the expression
+// \f$ D=((A*B)*C)*s \f$.
+*/
+template< typename MT1  // Matrix base type of the left-hand side expression
+        , typename MT2  // Type of the dense matrix of the right-hand side expression
+        , typename ST   // Type of the scalar of the right-hand side expression
+        , bool SO >     // Storage order of the right-hand side expression
+inline decltype(auto)
+   operator*( const MatMatMultExpr<MT1>& lhs, const DMatScalarMultExpr<MT2,ST,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( (~lhs) * rhs.leftOperand() ) * rhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a matrix-matrix multiplication
+//        expression and a scaled sparse matrix (\f$ D=(A*B)*(s*C) \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side matrix-matrix multiplication.
+// \param rhs The right-hand side scaled sparse matrix.
+// \return The scaled matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator restructures the expression \f$ D=(A*B)*(s*C) \f$ to the expression
+// \f$ D=((A*B)*C)*s \f$.
+*/
+template< typename MT1  // Matrix base type of the left-hand side expression
+        , typename MT2  // Type of the sparse matrix of the right-hand side expression
+        , typename ST   // Type of the scalar of the right-hand side expression
+        , bool SO >     // Storage order of the right-hand side expression
+inline decltype(auto)
+   operator*( const MatMatMultExpr<MT1>& lhs, const SMatScalarMultExpr<MT2,ST,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( (~lhs) * rhs.leftOperand() ) * rhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a scaled dense matrix and a
+//        matrix-matrix multiplication expression (\f$ D=(s*A)*(B*C) \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side scaled dense matrix.
+// \param rhs The right-hand side matrix-matrix multiplication.
+// \return The scaled matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator restructures the expression \f$ D=(s*A)*(B*C) \f$ to the expression
+// \f$ D=(A*(B*C))*s \f$.
+*/
+template< typename MT1  // Type of the dense matrix of the left-hand side expression
+        , typename ST   // Type of the scalar of the left-hand side expression
+        , bool SO       // Storage order of the left-hand side expression
+        , typename MT2 >  // Matrix base type of the right-hand side expression
+inline decltype(auto)
+   operator*( const DMatScalarMultExpr<MT1,ST,SO>& lhs, const MatMatMultExpr<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( lhs.leftOperand() * (~rhs) ) * lhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a scaled sparse matrix and a
+//        matrix-matrix multiplication expression (\f$ D=(s*A)*(B*C) \f$).
+// \ingroup math
+//
+// \param lhs The left-hand side scaled sparse matrix.
+// \param rhs The right-hand side matrix-matrix multiplication.
+// \return The scaled matrix multiplication chain.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator restructures the expression \f$ D=(s*A)*(B*C) \f$ to the expression
+// \f$ D=(A*(B*C))*s \f$.
+*/
+template< typename MT1  // Type of the sparse matrix of the left-hand side expression
+        , typename ST   // Type of the scalar of the left-hand side expression
+        , bool SO       // Storage order of the left-hand side expression
+        , typename MT2 >  // Matrix base type of the right-hand side expression
+inline decltype(auto)
+   operator*( const SMatScalarMultExpr<MT1,ST,SO>& lhs, const MatMatMultExpr<MT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( lhs.leftOperand() * (~rhs) ) * lhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename... MTs >
+struct Rows< MatChainMultExpr<MT,MTs...> >
+   : public Rows<MT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename... MTs >
+struct Columns< MatChainMultExpr<MTs...> >
+   : public Columns< std::tuple_element_t< sizeof...(MTs)-1UL, std::tuple<MTs...> > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
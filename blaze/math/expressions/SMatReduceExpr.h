@@ -0,0 +1,1026 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SMatReduceExpr.h
+//  \brief Header file for the sparse matrix reduction functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatReduceExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SVecReduceExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SMATREDUCEEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for row-wise and column-wise sparse matrix reduction operations.
+// \ingroup dense_vector_expression
+//
+// The SMatReduceExpr class represents the compile time expression for the partial reduction
+// of a sparse matrix. In case of a column-wise reduction (\a RF = \a columnwise) each column of
+// the matrix is reduced to a single element of the resulting row vector, in case of a row-wise
+// reduction (\a RF = \a rowwise) each row of the matrix is reduced to a single element of the
+// resulting column vector. Only the non-zero elements of the sparse matrix are taken into account.
+*/
+template< typename MT         // Type of the sparse matrix
+        , typename OP         // Type of the reduction operation
+        , ReductionFlag RF >  // Reduction flag
+class SMatReduceExpr
+   : public MatReduceExpr< DenseVector< SMatReduceExpr<MT,OP,RF>, RF == columnwise >, RF >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT = ResultType_<MT>;     //!< Result type of the sparse matrix expression.
+   using CT = CompositeType_<MT>;  //!< Composite type of the sparse matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Transpose flag of the resulting vector.
+   enum : bool { TF = ( RF == columnwise ) };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the sparse matrix expression.
+   enum : bool { evaluateMatrix = RequiresEvaluation<MT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the sparse matrix operand requires an intermediate evaluation, the
+       nested \value will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseSMPAssign {
+      enum : bool { value = evaluateMatrix };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = SMatReduceExpr<MT,OP,RF>;    //!< Type of this SMatReduceExpr instance.
+   using ResultType    = DynamicVector<ElementType_<MT>,TF>;  //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;    //!< Resulting element type.
+   using ReturnType    = const ElementType;           //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;            //!< Data type for composite expression templates.
+
+   //! Composite data type of the sparse matrix expression.
+   using Operand = If_< IsExpression<MT>, const MT, const MT& >;
+
+   //! Data type of the reduction operation.
+   using Operation = OP;
+
+   //! Type for the assignment of the sparse matrix operand.
+   using LT = IfTrue_< evaluateMatrix, const RT, CT >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatReduceExpr class.
+   //
+   // \param sm The sparse matrix operand of the reduction expression.
+   // \param op The reduction operation.
+   */
+   explicit inline SMatReduceExpr( const MT& sm, OP op ) noexcept
+      : sm_( sm )  // Sparse matrix of the reduction expression
+      , op_( op )  // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < size(), "Invalid vector access index" );
+
+      if( RF == columnwise )
+         return reduce( column( sm_, index ), op_ );
+      else
+         return reduce( row( sm_, index ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= size() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return ( RF == columnwise )?( sm_.columns() ):( sm_.rows() );
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the sparse matrix operand.
+   //
+   // \return The sparse matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return sm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return sm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the given alias is contained in this expression, \a false if not.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return sm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return sm_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   sm_;  //!< Sparse matrix of the reduction expression.
+   Operation op_;  //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a row-wise/column-wise sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a row-wise/column-wise
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      LT A( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.sm_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.sm_.columns(), "Invalid number of columns" );
+
+      smatreduce( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a row-wise/column-wise sparse matrix reduction to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a row-wise/column-wise
+   // sparse matrix reduction expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a row-wise/column-wise sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a row-wise/
+   // column-wise sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a row-wise/column-wise sparse matrix reduction to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a row-wise/
+   // column-wise sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a row-wise/column-wise sparse matrix reduction to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a row-wise/
+   // column-wise sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a row-wise/column-wise sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a row-wise/
+   // column-wise sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise/column-wise sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise/column-wise
+   // sparse matrix reduction expression to a dense vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // sparse matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const RT tmp( rhs.sm_ );  // Evaluation of the sparse matrix operand
+      smpAssign( ~lhs, SMatReduceExpr<RT,OP,RF>( tmp, rhs.op_ ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise/column-wise sparse matrix reduction to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise/column-wise
+   // sparse matrix reduction expression to a sparse vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // sparse matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAssign( SparseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a row-wise/column-wise sparse matrix reduction to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a row-wise/
+   // column-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the sparse matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpAddAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a row-wise/column-wise sparse matrix reduction to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a row-wise/
+   // column-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the sparse matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpSubAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse vectors************************************************
+   // No special implementation for the SMP subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a row-wise/column-wise sparse matrix reduction to a
+   //        dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // row-wise/column-wise sparse matrix reduction expression to a dense vector. Due to the
+   // explicit application of the SFINAE principle, this function can only be selected by the
+   // compiler in case the sparse matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpMultAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP multiplication assignment to sparse vectors*********************************************
+   // No special implementation for the SMP multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a row-wise/column-wise sparse matrix reduction to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a row-wise/
+   // column-wise sparse matrix reduction expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the sparse matrix operand requires an intermediate evaluation.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_< UseSMPAssign<VT1> >
+      smpDivAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP division assignment to sparse vectors***************************************************
+   // No special implementation for the SMP division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the partial reduction of a sparse matrix in storage order.
+// \ingroup sparse_matrix
+//
+// \param lhs The target left-hand side dense vector.
+// \param sm The given sparse matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function reduces the non-zero elements of each row of a row-major sparse matrix (or of
+// each column of a column-major sparse matrix) separately.
+*/
+template< typename VT    // Type of the target dense vector
+        , bool TF        // Transpose flag of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatreduce( DenseVector<VT,TF>& lhs, const SparseMatrix<MT,TF>& sm, OP op )
+{
+   using ET = ElementType_<VT>;
+   using ConstIterator = ConstIterator_<MT>;
+
+   const size_t N( (~lhs).size() );
+
+   BLAZE_INTERNAL_ASSERT( N == ( TF ? (~sm).columns() : (~sm).rows() ), "Invalid vector size" );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      const ConstIterator end( (~sm).end(i) );
+      ConstIterator element( (~sm).begin(i) );
+
+      if( element == end ) {
+         (~lhs)[i] = ET();
+         continue;
+      }
+
+      ET redux( element->value() );
+      ++element;
+
+      for( ; element!=end; ++element ) {
+         redux = op( redux, element->value() );
+      }
+
+      (~lhs)[i] = redux;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the partial reduction of a sparse matrix across storage order.
+// \ingroup sparse_matrix
+//
+// \param lhs The target left-hand side dense vector.
+// \param sm The given sparse matrix.
+// \param op The reduction operation.
+// \return void
+//
+// This function performs the column-wise reduction of a row-major sparse matrix (or the row-wise
+// reduction of a column-major sparse matrix) by traversing the matrix in storage order and by
+// accumulating the non-zero elements in the according elements of the target vector.
+*/
+template< typename VT    // Type of the target dense vector
+        , bool TF        // Transpose flag of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatreduce( DenseVector<VT,TF>& lhs, const SparseMatrix<MT,!TF>& sm, OP op )
+{
+   using ConstIterator = ConstIterator_<MT>;
+
+   const size_t M( TF ? (~sm).rows() : (~sm).columns() );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == ( TF ? (~sm).columns() : (~sm).rows() ), "Invalid vector size" );
+
+   reset( ~lhs );
+
+   std::vector<bool> initialized( (~lhs).size(), false );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      const ConstIterator end( (~sm).end(i) );
+      for( ConstIterator element=(~sm).begin(i); element!=end; ++element )
+      {
+         const size_t j( element->index() );
+
+         if( initialized[j] ) {
+            (~lhs)[j] = op( (~lhs)[j], element->value() );
+         }
+         else {
+            (~lhs)[j] = element->value();
+            initialized[j] = true;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the given sparse matrix \a sm by means of the
+// given reduction operation \a op:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( A, blaze::Add() );
+   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also note
+// that only the non-zero elements of the sparse matrix are taken into account, i.e. the
+// implicit zero elements are not part of the reduction. In case the matrix does not contain
+// any non-zero element, the function returns the default value of the element type (e.g. 0
+// in case of fundamental data types).
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> reduce( const SparseMatrix<MT,SO>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_<MT>;
+   using ET = ElementType_<MT>;
+   using ConstIterator = ConstIterator_< RemoveReference_<CT> >;
+
+   CT tmp( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t N( SO == rowMajor ? tmp.rows() : tmp.columns() );
+
+   ET redux = ET();
+   bool initialized( false );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      const ConstIterator end( tmp.end(i) );
+      ConstIterator element( tmp.begin(i) );
+
+      if( element == end ) continue;
+
+      if( !initialized ) {
+         redux = element->value();
+         initialized = true;
+         ++element;
+      }
+
+      for( ; element!=end; ++element ) {
+         redux = op( redux, element->value() );
+      }
+   }
+
+   return redux;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse matrix by means of addition.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given sparse matrix by means of addition:
+
+   \code
+   blaze::CompressedMatrix<int> A( 3UL, 3UL );
+   A(0,0) = 1;
+   A(1,2) = 2;
+   A(2,1) = 3;
+
+   const int totalsum = sum( A );  // Results in 6
+   \endcode
+
+// In case the matrix does not contain any non-zero element, the function returns the default
+// value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> sum( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~sm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse matrix by means of multiplication.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given sparse matrix by means of multiplication:
+
+   \code
+   blaze::CompressedMatrix<int> A( 2UL, 2UL );
+   A(0,0) = 1;
+   A(0,1) = 2;
+   A(1,0) = 3;
+   A(1,1) = 4;
+
+   const int totalprod = prod( A );  // Results in 24
+   \endcode
+
+// In contrast to the reduce() function, the implicit zero elements of the sparse matrix are
+// taken into account, i.e. in case the matrix is not completely filled, the function returns
+// 0. In case the matrix has either 0 rows or 0 columns, the function returns the default value
+// of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline const ElementType_<MT> prod( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_<MT>;
+   using ET = ElementType_<MT>;
+   using ConstIterator = ConstIterator_< RemoveReference_<CT> >;
+
+   if( (~sm).rows() == 0UL || (~sm).columns() == 0UL ) return ET();
+
+   CT tmp( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t N( SO == rowMajor ? tmp.rows() : tmp.columns() );
+
+   ET redux( 1 );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      const ConstIterator end( tmp.end(i) );
+
+      for( ConstIterator element=tmp.begin(i); element!=end; ++element, ++nonzeros ) {
+         redux *= element->value();
+      }
+   }
+
+   return ( nonzeros == tmp.rows() * tmp.columns() ? redux : ET() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom row-wise or column-wise reduction operation on the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the rows or columns of the given sparse matrix
+// \a sm by means of the given reduction operation \a op. In case the reduction flag \a RF is set
+// to \a columnwise, each column of the matrix is reduced to a single element of the resulting
+// dense row vector. In case \a RF is set to \a rowwise, each row is reduced to a single element
+// of the resulting dense column vector:
+
+   \code
+   using blaze::columnwise;
+   using blaze::rowwise;
+
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double,blaze::rowVector> colsums;
+   blaze::DynamicVector<double,blaze::columnVector> rowmax;
+   // ... Resizing and initialization
+
+   colsums = reduce<columnwise>( A, blaze::Add() );
+   rowmax  = reduce<rowwise>( A, []( double a, double b ){ return blaze::max( a, b ); } );
+   \endcode
+
+// Please note that the evaluation order of the reduction operation is unspecified. Thus the
+// behavior is non-deterministic if \a op is not associative or not commutative. Also note
+// that only the non-zero elements of the sparse matrix are taken into account, i.e. the
+// implicit zero elements are not part of the reduction. In case a row or column does not
+// contain any non-zero element, the corresponding element of the result is set to the default
+// value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the sparse matrix
+        , bool SO           // Storage order
+        , typename OP >     // Type of the reduction operation
+inline decltype(auto) reduce( const SparseMatrix<MT,SO>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ReturnType = const SMatReduceExpr<MT,OP,RF>;
+   return ReturnType( ~sm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the rows or columns of the given sparse matrix by means of addition.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function computes the row-wise or column-wise sums of the given sparse matrix:
+
+   \code
+   blaze::CompressedMatrix<int> A( 2UL, 3UL );
+   A(0,0) = 1;
+   A(0,2) = 2;
+   A(1,2) = 3;
+
+   blaze::DynamicVector<int,blaze::rowVector> colsums;
+   blaze::DynamicVector<int,blaze::columnVector> rowsums;
+
+   colsums = sum<blaze::columnwise>( A );  // Results in ( 1 0 5 )
+   rowsums = sum<blaze::rowwise>( A );     // Results in ( 3 3 )
+   \endcode
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+inline decltype(auto) sum( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~sm, Add() );
+}
+//*************************************************************************************************
+
+
+} // namespace blaze
+
+#endif
@@ -90,4 +90,11 @@
 */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\defgroup lapack_condition Condition Estimation
+// \ingroup lapack
+*/
+//*************************************************************************************************
+
 #endif
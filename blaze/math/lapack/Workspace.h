@@ -0,0 +1,356 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/Workspace.h
+//  \brief Header file for the LAPACKWorkspace class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_WORKSPACE_H_
+#define _BLAZE_MATH_LAPACK_WORKSPACE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reusable workspace for the LAPACK functions.
+// \ingroup lapack
+//
+// The LAPACKWorkspace class provides the auxiliary memory required by the LAPACK functions (as
+// for instance the \c work, \c rwork, and \c iwork arrays and the Householder scalars of a QR
+// decomposition). All LAPACK functions size their workspace by means of a workspace query,
+// which enables the blocked algorithms of LAPACK. By default, every call to a LAPACK function
+// allocates and releases its own workspace. Alternatively, a LAPACKWorkspace object can be
+// passed as last argument to all LAPACK functions that require auxiliary memory and to the
+// according high-level functions (as for instance eigen(), svd(), qr(), lu(), and inv()). In
+// this case, the memory of the workspace is reused and only grows if a larger workspace is
+// required. Therefore repeated decompositions of matrices of the same size don't perform any
+// memory allocation after the first call:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 1000UL, 1000UL ), Q, R;
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   blaze::LAPACKWorkspace ws;
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      // ... Initialization of A
+      blaze::qr( A, Q, R, ws );  // Allocation-free after the first iteration
+      blaze::eigen( declsym( A*trans(A) ), w, ws );
+   }
+   \endcode
+
+// Note that a LAPACKWorkspace object must not be used concurrently by several threads.
+*/
+class LAPACKWorkspace : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LAPACKWorkspace() noexcept;
+            inline LAPACKWorkspace( LAPACKWorkspace&& ws ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~LAPACKWorkspace();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline LAPACKWorkspace& operator=( LAPACKWorkspace&& ws ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t capacity() const noexcept;
+   inline void   clear() noexcept;
+
+   template< typename T > inline T* get( size_t slot, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! The number of independent memory slots.
+   /*! The slots 0 to 7 are used within the LAPACK functions, the slots 8 and 9 are used by the
+       high-level decomposition and inversion functions. */
+   static constexpr size_t slots = 10UL;
+
+   //! The alignment of all memory slots.
+   static constexpr size_t alignment = 64UL;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t* memory_[slots];  //!< The memory of the individual slots.
+   size_t  sizes_ [slots];  //!< The capacity of the individual slots in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LAPACKWorkspace.
+//
+// The default constructor creates an empty workspace. Memory is only allocated on demand.
+*/
+inline LAPACKWorkspace::LAPACKWorkspace() noexcept
+{
+   for( size_t i=0UL; i<slots; ++i ) {
+      memory_[i] = nullptr;
+      sizes_ [i] = 0UL;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for LAPACKWorkspace.
+//
+// \param ws The workspace to be moved into this instance.
+*/
+inline LAPACKWorkspace::LAPACKWorkspace( LAPACKWorkspace&& ws ) noexcept
+{
+   for( size_t i=0UL; i<slots; ++i ) {
+      memory_[i] = ws.memory_[i];
+      sizes_ [i] = ws.sizes_ [i];
+      ws.memory_[i] = nullptr;
+      ws.sizes_ [i] = 0UL;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for LAPACKWorkspace.
+*/
+inline LAPACKWorkspace::~LAPACKWorkspace()
+{
+   clear();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for LAPACKWorkspace.
+//
+// \param ws The workspace to be moved into this instance.
+// \return Reference to the assigned workspace.
+*/
+inline LAPACKWorkspace& LAPACKWorkspace::operator=( LAPACKWorkspace&& ws ) noexcept
+{
+   if( &ws != this ) {
+      clear();
+      for( size_t i=0UL; i<slots; ++i ) {
+         memory_[i] = ws.memory_[i];
+         sizes_ [i] = ws.sizes_ [i];
+         ws.memory_[i] = nullptr;
+         ws.sizes_ [i] = 0UL;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total capacity of the workspace.
+//
+// \return The total capacity of the workspace in bytes.
+*/
+inline size_t LAPACKWorkspace::capacity() const noexcept
+{
+   size_t total( 0UL );
+   for( size_t i=0UL; i<slots; ++i ) {
+      total += sizes_[i];
+   }
+   return total;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the entire memory of the workspace.
+//
+// \return void
+*/
+inline void LAPACKWorkspace::clear() noexcept
+{
+   for( size_t i=0UL; i<slots; ++i ) {
+      if( memory_[i] != nullptr ) {
+         deallocate_backend( memory_[i] );
+      }
+      memory_[i] = nullptr;
+      sizes_ [i] = 0UL;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory of the given slot for at least \a n elements of type \a T.
+//
+// \param slot The index of the memory slot \f$[0..9]\f$.
+// \param n The required number of elements.
+// \return Pointer to the first element of the slot.
+// \exception std::bad_alloc Allocation failed.
+//
+// This function returns the memory of the given slot. In case the capacity of the slot is too
+// small for \a n elements of type \a T, the slot is reallocated. Note that the previous content
+// of the slot is not preserved in this case. The returned memory is 64-byte aligned and is not
+// initialized.
+*/
+template< typename T >  // Type of the elements
+inline T* LAPACKWorkspace::get( size_t slot, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( slot < slots, "Invalid workspace slot" );
+
+   const size_t bytes( ( n > 0UL ? n : 1UL ) * sizeof(T) );
+
+   if( bytes > sizes_[slot] ) {
+      if( memory_[slot] != nullptr ) {
+         deallocate_backend( memory_[slot] );
+         memory_[slot] = nullptr;
+         sizes_ [slot] = 0UL;
+      }
+      memory_[slot] = allocate_backend( bytes, alignment );
+      sizes_ [slot] = bytes;
+   }
+
+   return reinterpret_cast<T*>( memory_[slot] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKSPACE QUERY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the result of a LAPACK workspace query into a workspace size.
+// \ingroup lapack
+//
+// \param query The first element of the \c work array after a workspace query (\c lwork=-1).
+// \param minimum The minimum size of the workspace.
+// \return The optimal size of the workspace.
+//
+// LAPACK returns the optimal workspace size of a workspace query as floating point value, which
+// in single precision might be rounded down for large workspaces. Therefore the result is
+// rounded up and slightly enlarged.
+*/
+template< typename T >  // Type of the workspace elements
+inline int optimalWorkspace( const T& query, int minimum )
+{
+   using BT = UnderlyingElement_<T>;
+
+   const double size( std::ceil( static_cast<double>( real( query ) ) *
+                                 ( 1.0 + std::numeric_limits<BT>::epsilon() ) ) );
+
+   return ( size > minimum )?( numeric_cast<int>( size ) ):( minimum );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/gesv.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void sgesv_( int* n, int* nrhs, float*  A, int* lda, int* ipiv, float*  b, int* ldb, int* info );
@@ -131,15 +133,20 @@ inline void gesv( int n, int nrhs, complex<double>* A, int lda, int* ipiv, compl
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void gesv( int n, int nrhs, float* A, int lda, int* ipiv, float* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    sgesv_( &n, &nrhs, A, &lda, ipiv, B, &ldb, info );
+#else
+   gesv_native( n, nrhs, A, lda, ipiv, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -185,15 +192,20 @@ inline void gesv( int n, int nrhs, float* A, int lda, int* ipiv, float* B, int l
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void gesv( int n, int nrhs, double* A, int lda, int* ipiv, double* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dgesv_( &n, &nrhs, A, &lda, ipiv, B, &ldb, info );
+#else
+   gesv_native( n, nrhs, A, lda, ipiv, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -239,10 +251,12 @@ inline void gesv( int n, int nrhs, double* A, int lda, int* ipiv, double* B, int
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void gesv( int n, int nrhs, complex<float>* A, int lda, int* ipiv, complex<float>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -254,6 +268,9 @@ inline void gesv( int n, int nrhs, complex<float>* A, int lda, int* ipiv, comple
 
    cgesv_( &n, &nrhs, reinterpret_cast<ET*>( A ), &lda, ipiv,
            reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   gesv_native( n, nrhs, A, lda, ipiv, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -299,10 +316,12 @@ inline void gesv( int n, int nrhs, complex<float>* A, int lda, int* ipiv, comple
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void gesv( int n, int nrhs, complex<double>* A, int lda, int* ipiv, complex<double>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -314,6 +333,9 @@ inline void gesv( int n, int nrhs, complex<double>* A, int lda, int* ipiv, compl
 
    zgesv_( &n, &nrhs, reinterpret_cast<ET*>( A ), &lda, ipiv,
            reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   gesv_native( n, nrhs, A, lda, ipiv, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/getrf.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void sgetrf_( int* m, int* n, float*  A, int* lda, int* ipiv, int* info );
@@ -126,15 +128,20 @@ inline void getrf( int m, int n, complex<double>* A, int lda, int* ipiv, int* in
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getrf( int m, int n, float* A, int lda, int* ipiv, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    sgetrf_( &m, &n, A, &lda, ipiv, info );
+#else
+   getrf_native( m, n, A, lda, ipiv, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -175,15 +182,20 @@ inline void getrf( int m, int n, float* A, int lda, int* ipiv, int* info )
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getrf( int m, int n, double* A, int lda, int* ipiv, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dgetrf_( &m, &n, A, &lda, ipiv, info );
+#else
+   getrf_native( m, n, A, lda, ipiv, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -224,10 +236,12 @@ inline void getrf( int m, int n, double* A, int lda, int* ipiv, int* info )
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getrf( int m, int n, complex<float>* A, int lda, int* ipiv, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -238,6 +252,9 @@ inline void getrf( int m, int n, complex<float>* A, int lda, int* ipiv, int* inf
 #endif
 
    cgetrf_( &m, &n, reinterpret_cast<ET*>( A ), &lda, ipiv, info );
+#else
+   getrf_native( m, n, A, lda, ipiv, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -278,10 +295,12 @@ inline void getrf( int m, int n, complex<float>* A, int lda, int* ipiv, int* inf
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getrf( int m, int n, complex<double>* A, int lda, int* ipiv, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -292,6 +311,9 @@ inline void getrf( int m, int n, complex<double>* A, int lda, int* ipiv, int* in
 #endif
 
    zgetrf_( &m, &n, reinterpret_cast<ET*>( A ), &lda, ipiv, info );
+#else
+   getrf_native( m, n, A, lda, ipiv, info );
+#endif
 }
 //*************************************************************************************************
 
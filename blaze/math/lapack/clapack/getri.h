@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/getri.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void sgetri_( int* n, float*  A, int* lda, int* ipiv, float*  work, int* lwork, int* info );
@@ -126,15 +128,20 @@ inline void getri( int n, complex<double>* A, int lda, const int* ipiv,
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getri( int n, float* A, int lda, const int* ipiv, float* work, int lwork, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    sgetri_( &n, A, &lda, const_cast<int*>( ipiv ), work, &lwork, info );
+#else
+   getri_native( n, A, lda, ipiv, work, lwork, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -173,15 +180,20 @@ inline void getri( int n, float* A, int lda, const int* ipiv, float* work, int l
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getri( int n, double* A, int lda, const int* ipiv, double* work, int lwork, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dgetri_( &n, A, &lda, const_cast<int*>( ipiv ), work, &lwork, info );
+#else
+   getri_native( n, A, lda, ipiv, work, lwork, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -220,11 +232,13 @@ inline void getri( int n, double* A, int lda, const int* ipiv, double* work, int
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getri( int n, complex<float>* A, int lda, const int* ipiv,
                    complex<float>* work, int lwork, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -236,6 +250,9 @@ inline void getri( int n, complex<float>* A, int lda, const int* ipiv,
 
    cgetri_( &n, reinterpret_cast<ET*>( A ), &lda, const_cast<int*>( ipiv ),
             reinterpret_cast<ET*>( work ), &lwork, info );
+#else
+   getri_native( n, A, lda, ipiv, work, lwork, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -274,11 +291,13 @@ inline void getri( int n, complex<float>* A, int lda, const int* ipiv,
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getri( int n, complex<double>* A, int lda, const int* ipiv,
                    complex<double>* work, int lwork, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -290,6 +309,9 @@ inline void getri( int n, complex<double>* A, int lda, const int* ipiv,
 
    zgetri_( &n, reinterpret_cast<ET*>( A ), &lda, const_cast<int*>( ipiv ),
             reinterpret_cast<ET*>( work ), &lwork, info );
+#else
+   getri_native( n, A, lda, ipiv, work, lwork, info );
+#endif
 }
 //*************************************************************************************************
 
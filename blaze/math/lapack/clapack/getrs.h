@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/getrs.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void sgetrs_( char* trans, int* n, int* nrhs, float*  A, int* lda, int* ipiv, float*  B, int* ldb, int* info );
@@ -131,17 +133,22 @@ inline void getrs( char trans, int n, int nrhs, const complex<double>* A, int ld
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getrs( char trans, int n, int nrhs, const float* A, int lda,
                    const int* ipiv, float* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    sgetrs_( &trans, &n, &nrhs, const_cast<float*>( A ), &lda,
             const_cast<int*>( ipiv ), B, &ldb, info );
+#else
+   getrs_native( trans, n, nrhs, A, lda, ipiv, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -183,17 +190,22 @@ inline void getrs( char trans, int n, int nrhs, const float* A, int lda,
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getrs( char trans, int n, int nrhs, const double* A, int lda,
                    const int* ipiv, double* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dgetrs_( &trans, &n, &nrhs, const_cast<double*>( A ), &lda,
             const_cast<int*>( ipiv ), B, &ldb, info );
+#else
+   getrs_native( trans, n, nrhs, A, lda, ipiv, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -235,11 +247,13 @@ inline void getrs( char trans, int n, int nrhs, const double* A, int lda,
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getrs( char trans, int n, int nrhs, const complex<float>* A, int lda,
                    const int* ipiv, complex<float>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -251,6 +265,9 @@ inline void getrs( char trans, int n, int nrhs, const complex<float>* A, int lda
 
    cgetrs_( &trans, &n, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ),
             &lda, const_cast<int*>( ipiv ), reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   getrs_native( trans, n, nrhs, A, lda, ipiv, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -292,11 +309,13 @@ inline void getrs( char trans, int n, int nrhs, const complex<float>* A, int lda
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void getrs( char trans, int n, int nrhs, const complex<double>* A, int lda,
                    const int* ipiv, complex<double>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -308,6 +327,9 @@ inline void getrs( char trans, int n, int nrhs, const complex<double>* A, int ld
 
    zgetrs_( &trans, &n, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ),
             &lda, const_cast<int*>( ipiv ), reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   getrs_native( trans, n, nrhs, A, lda, ipiv, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
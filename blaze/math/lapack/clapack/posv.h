@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/posv.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void sposv_( char* uplo, int* n, int* nrhs, float*  A, int* lda, float*  b, int* ldb, int* info );
@@ -133,15 +135,20 @@ inline void posv( char uplo, int n, int nrhs, complex<double>* A, int lda, compl
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void posv( char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    sposv_( &uplo, &n, &nrhs, A, &lda, B, &ldb, info );
+#else
+   posv_native( uplo, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -189,15 +196,20 @@ inline void posv( char uplo, int n, int nrhs, float* A, int lda, float* B, int l
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void posv( char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dposv_( &uplo, &n, &nrhs, A, &lda, B, &ldb, info );
+#else
+   posv_native( uplo, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -245,10 +257,12 @@ inline void posv( char uplo, int n, int nrhs, double* A, int lda, double* B, int
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void posv( char uplo, int n, int nrhs, complex<float>* A, int lda, complex<float>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -260,6 +274,9 @@ inline void posv( char uplo, int n, int nrhs, complex<float>* A, int lda, comple
 
    cposv_( &uplo, &n, &nrhs, reinterpret_cast<ET*>( A ), &lda,
            reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   posv_native( uplo, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -307,10 +324,12 @@ inline void posv( char uplo, int n, int nrhs, complex<float>* A, int lda, comple
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void posv( char uplo, int n, int nrhs, complex<double>* A, int lda, complex<double>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -322,6 +341,9 @@ inline void posv( char uplo, int n, int nrhs, complex<double>* A, int lda, compl
 
    zposv_( &uplo, &n, &nrhs, reinterpret_cast<ET*>( A ), &lda,
            reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   posv_native( uplo, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/potrf.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void spotrf_( char* uplo, int* n, float*  A, int* lda, int* info );
@@ -126,15 +128,20 @@ inline void potrf( char uplo, int n, complex<double>* A, int lda, int* info );
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void potrf( char uplo, int n, float* A, int lda, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    spotrf_( &uplo, &n, A, &lda, info );
+#else
+   potrf_native( uplo, n, A, lda, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -175,15 +182,20 @@ inline void potrf( char uplo, int n, float* A, int lda, int* info )
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void potrf( char uplo, int n, double* A, int lda, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dpotrf_( &uplo, &n, A, &lda, info );
+#else
+   potrf_native( uplo, n, A, lda, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -224,10 +236,12 @@ inline void potrf( char uplo, int n, double* A, int lda, int* info )
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void potrf( char uplo, int n, complex<float>* A, int lda, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -238,6 +252,9 @@ inline void potrf( char uplo, int n, complex<float>* A, int lda, int* info )
 #endif
 
    cpotrf_( &uplo, &n, reinterpret_cast<ET*>( A ), &lda, info );
+#else
+   potrf_native( uplo, n, A, lda, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -278,10 +295,12 @@ inline void potrf( char uplo, int n, complex<float>* A, int lda, int* info )
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void potrf( char uplo, int n, complex<double>* A, int lda, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -292,6 +311,9 @@ inline void potrf( char uplo, int n, complex<double>* A, int lda, int* info )
 #endif
 
    zpotrf_( &uplo, &n, reinterpret_cast<ET*>( A ), &lda, info );
+#else
+   potrf_native( uplo, n, A, lda, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/potrs.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void spotrs_( char* uplo, int* n, int* nrhs, float*  A, int* lda, float*  B, int* ldb, int* info );
@@ -121,15 +123,20 @@ inline void potrs( char uplo, int n, int nrhs, const complex<double>* A, int lda
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void potrs( char uplo, int n, int nrhs, const float* A, int lda, float* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    spotrs_( &uplo, &n, &nrhs, const_cast<float*>( A ), &lda, B, &ldb, info );
+#else
+   potrs_native( uplo, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -165,15 +172,20 @@ inline void potrs( char uplo, int n, int nrhs, const float* A, int lda, float* B
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void potrs( char uplo, int n, int nrhs, const double* A, int lda, double* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dpotrs_( &uplo, &n, &nrhs, const_cast<double*>( A ), &lda, B, &ldb, info );
+#else
+   potrs_native( uplo, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -209,11 +221,13 @@ inline void potrs( char uplo, int n, int nrhs, const double* A, int lda, double*
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void potrs( char uplo, int n, int nrhs, const complex<float>* A,
                    int lda, complex<float>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -225,6 +239,9 @@ inline void potrs( char uplo, int n, int nrhs, const complex<float>* A,
 
    cpotrs_( &uplo, &n, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ),
             &lda, reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   potrs_native( uplo, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -260,11 +277,13 @@ inline void potrs( char uplo, int n, int nrhs, const complex<float>* A,
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void potrs( char uplo, int n, int nrhs, const complex<double>* A,
                    int lda, complex<double>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -276,6 +295,9 @@ inline void potrs( char uplo, int n, int nrhs, const complex<double>* A,
 
    zpotrs_( &uplo, &n, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ),
             &lda, reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   potrs_native( uplo, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -0,0 +1,290 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/clapack/trcon.h
+//  \brief Header file for the CLAPACK trcon wrapper functions
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_CLAPACK_TRCON_H_
+#define _BLAZE_MATH_LAPACK_CLAPACK_TRCON_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Complex.h>
+#include <blaze/util/StaticAssert.h>
+
+
+//=================================================================================================
+//
+//  LAPACK FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !defined(INTEL_MKL_VERSION)
+extern "C" {
+
+void strcon_( char* norm, char* uplo, char* diag, int* n, float*  A, int* lda, float*  rcond, float*  work, int*   iwork, int* info );
+void dtrcon_( char* norm, char* uplo, char* diag, int* n, double* A, int* lda, double* rcond, double* work, int*   iwork, int* info );
+void ctrcon_( char* norm, char* uplo, char* diag, int* n, float*  A, int* lda, float*  rcond, float*  work, float*  rwork, int* info );
+void ztrcon_( char* norm, char* uplo, char* diag, int* n, double* A, int* lda, double* rcond, double* work, double* rwork, int* info );
+
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK TRIANGULAR MATRIX CONDITION ESTIMATION FUNCTIONS (TRCON)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK triangular matrix condition estimation functions (trcon) */
+//@{
+inline void trcon( char norm, char uplo, char diag, int n, const float* A, int lda, float* rcond,
+                   float* work, int* iwork, int* info );
+
+inline void trcon( char norm, char uplo, char diag, int n, const double* A, int lda, double* rcond,
+                   double* work, int* iwork, int* info );
+
+inline void trcon( char norm, char uplo, char diag, int n, const complex<float>* A, int lda, float* rcond,
+                   complex<float>* work, float* rwork, int* info );
+
+inline void trcon( char norm, char uplo, char diag, int n, const complex<double>* A, int lda, double* rcond,
+                   complex<double>* work, double* rwork, int* info );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for estimating the reciprocal of the condition number of a triangular
+//        single precision matrix.
+// \ingroup lapack_condition
+//
+// \param norm \c '1' or \c 'O' for the 1-norm, \c 'I' for the infinity-norm.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision column-major square matrix.
+// \param lda The total number of elements between two columns of matrix \a A \f$[0..\infty)\f$.
+// \param rcond Pointer to the resulting reciprocal condition number.
+// \param work Auxiliary array; size >= 3*\a n.
+// \param iwork Auxiliary array; size >= \a n.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK strcon() function to estimate the reciprocal of the condition
+// number of a triangular single precision \a n-by-\a n matrix in either the 1-norm or the infinity-norm.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the strcon() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void trcon( char norm, char uplo, char diag, int n, const float* A, int lda, float* rcond,
+                   float* work, int* iwork, int* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+#endif
+
+   strcon_( &norm, &uplo, &diag, &n, const_cast<float*>( A ), &lda, rcond, work, iwork, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for estimating the reciprocal of the condition number of a triangular
+//        double precision matrix.
+// \ingroup lapack_condition
+//
+// \param norm \c '1' or \c 'O' for the 1-norm, \c 'I' for the infinity-norm.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision column-major square matrix.
+// \param lda The total number of elements between two columns of matrix \a A \f$[0..\infty)\f$.
+// \param rcond Pointer to the resulting reciprocal condition number.
+// \param work Auxiliary array; size >= 3*\a n.
+// \param iwork Auxiliary array; size >= \a n.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK dtrcon() function to estimate the reciprocal of the condition
+// number of a triangular double precision \a n-by-\a n matrix in either the 1-norm or the infinity-norm.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the dtrcon() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void trcon( char norm, char uplo, char diag, int n, const double* A, int lda, double* rcond,
+                   double* work, int* iwork, int* info )
+{
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+#endif
+
+   dtrcon_( &norm, &uplo, &diag, &n, const_cast<double*>( A ), &lda, rcond, work, iwork, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for estimating the reciprocal of the condition number of a triangular
+//        single precision complex matrix.
+// \ingroup lapack_condition
+//
+// \param norm \c '1' or \c 'O' for the 1-norm, \c 'I' for the infinity-norm.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the single precision complex column-major square matrix.
+// \param lda The total number of elements between two columns of matrix \a A \f$[0..\infty)\f$.
+// \param rcond Pointer to the resulting reciprocal condition number.
+// \param work Auxiliary array; size >= 2*\a n.
+// \param rwork Auxiliary array; size >= \a n.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK ctrcon() function to estimate the reciprocal of the condition
+// number of a triangular single precision complex \a n-by-\a n matrix in either the 1-norm or the infinity-norm.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the ctrcon() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void trcon( char norm, char uplo, char diag, int n, const complex<float>* A, int lda, float* rcond,
+                   complex<float>* work, float* rwork, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+   using ET = MKL_Complex8;
+#else
+   using ET = float;
+#endif
+
+   ctrcon_( &norm, &uplo, &diag, &n, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ), &lda,
+           rcond, reinterpret_cast<ET*>( work ), rwork, info );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for estimating the reciprocal of the condition number of a triangular
+//        double precision complex matrix.
+// \ingroup lapack_condition
+//
+// \param norm \c '1' or \c 'O' for the 1-norm, \c 'I' for the infinity-norm.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the double precision complex column-major square matrix.
+// \param lda The total number of elements between two columns of matrix \a A \f$[0..\infty)\f$.
+// \param rcond Pointer to the resulting reciprocal condition number.
+// \param work Auxiliary array; size >= 2*\a n.
+// \param rwork Auxiliary array; size >= \a n.
+// \param info Return code of the function call.
+// \return void
+//
+// This function uses the LAPACK ztrcon() function to estimate the reciprocal of the condition
+// number of a triangular double precision complex \a n-by-\a n matrix in either the 1-norm or the infinity-norm.
+//
+// The \a info argument provides feedback on the success of the function call:
+//
+//   - = 0: The function finished successfully.
+//   - < 0: If info = -i, the i-th argument had an illegal value.
+//
+// For more information on the ztrcon() function, see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+inline void trcon( char norm, char uplo, char diag, int n, const complex<double>* A, int lda, double* rcond,
+                   complex<double>* work, double* rwork, int* info )
+{
+   BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
+
+#if defined(INTEL_MKL_VERSION)
+   BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
+   using ET = MKL_Complex16;
+#else
+   using ET = double;
+#endif
+
+   ztrcon_( &norm, &uplo, &diag, &n, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ), &lda,
+           rcond, reinterpret_cast<ET*>( work ), rwork, info );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
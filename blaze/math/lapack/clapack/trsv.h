@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/trsv.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,6 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if BLAZE_LAPACK_MODE
 extern "C" {
 
 void strsv_( char* uplo, char* trans, char* diag, int* n, float*  A, int* lda, float*  x, int* incX );
@@ -60,6 +63,7 @@ void ctrsv_( char* uplo, char* trans, char* diag, int* n, float*  A, int* lda, f
 void ztrsv_( char* uplo, char* trans, char* diag, int* n, double* A, int* lda, double* x, int* incX );
 
 }
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -122,7 +126,8 @@ inline void trsv( char uplo, char trans, char diag, int n, const complex<double>
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 //
 // \note The function does not perform any test for singularity or near-singularity. Such tests
 // must be performed prior to calling this function!
@@ -130,7 +135,11 @@ inline void trsv( char uplo, char trans, char diag, int n, const complex<double>
 inline void trsv( char uplo, char trans, char diag, int n, const float* A,
                   int lda, float* x, int incX )
 {
+#if BLAZE_LAPACK_MODE
    strsv_( &uplo, &trans, &diag, &n, const_cast<float*>( A ), &lda, x, &incX );
+#else
+   trsv_native( uplo, trans, diag, n, A, lda, x, incX );
+#endif
 }
 //*************************************************************************************************
 
@@ -165,7 +174,8 @@ inline void trsv( char uplo, char trans, char diag, int n, const float* A,
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 //
 // \note The function does not perform any test for singularity or near-singularity. Such tests
 // must be performed prior to calling this function!
@@ -173,7 +183,11 @@ inline void trsv( char uplo, char trans, char diag, int n, const float* A,
 inline void trsv( char uplo, char trans, char diag, int n, const double* A,
                   int lda, double* x, int incX )
 {
+#if BLAZE_LAPACK_MODE
    dtrsv_( &uplo, &trans, &diag, &n, const_cast<double*>( A ), &lda, x, &incX );
+#else
+   trsv_native( uplo, trans, diag, n, A, lda, x, incX );
+#endif
 }
 //*************************************************************************************************
 
@@ -208,7 +222,8 @@ inline void trsv( char uplo, char trans, char diag, int n, const double* A,
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 //
 // \note The function does not perform any test for singularity or near-singularity. Such tests
 // must be performed prior to calling this function!
@@ -216,10 +231,14 @@ inline void trsv( char uplo, char trans, char diag, int n, const double* A,
 inline void trsv( char uplo, char trans, char diag, int n, const complex<float>* A,
                   int lda, complex<float>* x, int incX )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
    ctrsv_( &uplo, &trans, &diag, &n, const_cast<float*>( reinterpret_cast<const float*>( A ) ),
            &lda, reinterpret_cast<float*>( x ), &incX );
+#else
+   trsv_native( uplo, trans, diag, n, A, lda, x, incX );
+#endif
 }
 //*************************************************************************************************
 
@@ -254,7 +273,8 @@ inline void trsv( char uplo, char trans, char diag, int n, const complex<float>*
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 //
 // \note The function does not perform any test for singularity or near-singularity. Such tests
 // must be performed prior to calling this function!
@@ -262,10 +282,14 @@ inline void trsv( char uplo, char trans, char diag, int n, const complex<float>*
 inline void trsv( char uplo, char trans, char diag, int n, const complex<double>* A,
                   int lda, complex<double>* x, int incX )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
    ztrsv_( &uplo, &trans, &diag, &n, const_cast<double*>( reinterpret_cast<const double*>( A ) ),
            &lda, reinterpret_cast<double*>( x ), &incX );
+#else
+   trsv_native( uplo, trans, diag, n, A, lda, x, incX );
+#endif
 }
 //*************************************************************************************************
 
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/trtri.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void strtri_( char* uplo, char* diag, int* n, float*  A, int* lda, int* info );
@@ -119,15 +121,20 @@ inline void trtri( char uplo, char diag, int n, complex<double>* A, int lda, int
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void trtri( char uplo, char diag, int n, float* A, int lda, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    strtri_( &uplo, &diag, &n, A, &lda, info );
+#else
+   trtri_native( uplo, diag, n, A, lda, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -161,15 +168,20 @@ inline void trtri( char uplo, char diag, int n, float* A, int lda, int* info )
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void trtri( char uplo, char diag, int n, double* A, int lda, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dtrtri_( &uplo, &diag, &n, A, &lda, info );
+#else
+   trtri_native( uplo, diag, n, A, lda, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -203,10 +215,12 @@ inline void trtri( char uplo, char diag, int n, double* A, int lda, int* info )
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void trtri( char uplo, char diag, int n, complex<float>* A, int lda, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -217,6 +231,9 @@ inline void trtri( char uplo, char diag, int n, complex<float>* A, int lda, int*
 #endif
 
    ctrtri_( &uplo, &diag, &n, reinterpret_cast<ET*>( A ), &lda, info );
+#else
+   trtri_native( uplo, diag, n, A, lda, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -250,10 +267,12 @@ inline void trtri( char uplo, char diag, int n, complex<float>* A, int lda, int*
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void trtri( char uplo, char diag, int n, complex<double>* A, int lda, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -264,6 +283,9 @@ inline void trtri( char uplo, char diag, int n, complex<double>* A, int lda, int
 #endif
 
    ztrtri_( &uplo, &diag, &n, reinterpret_cast<ET*>( A ), &lda, info );
+#else
+   trtri_native( uplo, diag, n, A, lda, info );
+#endif
 }
 //*************************************************************************************************
 
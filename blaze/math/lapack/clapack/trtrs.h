@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/lapack/native/trtrs.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/StaticAssert.h>
 
@@ -52,7 +54,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if !defined(INTEL_MKL_VERSION)
+#if BLAZE_LAPACK_MODE && !defined(INTEL_MKL_VERSION)
 extern "C" {
 
 void strtrs_( char* uplo, char* trans, char* diag, int* n, int* nrhs, float*  A, int* lda, float*  B, int* ldb, int* info );
@@ -132,16 +134,21 @@ inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const comp
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const float* A, int lda,
                    float* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    strtrs_( &uplo, &trans, &diag, &n, &nrhs, const_cast<float*>( A ), &lda, B, &ldb, info );
+#else
+   trtrs_native( uplo, trans, diag, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -184,16 +191,21 @@ inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const floa
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const double* A, int lda,
                    double* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
 #if defined(INTEL_MKL_VERSION)
    BLAZE_STATIC_ASSERT( sizeof( MKL_INT ) == sizeof( int ) );
 #endif
 
    dtrtrs_( &uplo, &trans, &diag, &n, &nrhs, const_cast<double*>( A ), &lda, B, &ldb, info );
+#else
+   trtrs_native( uplo, trans, diag, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -236,11 +248,13 @@ inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const doub
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const complex<float>* A,
                    int lda, complex<float>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<float> ) == 2UL*sizeof( float ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -252,6 +266,9 @@ inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const comp
 
    ctrtrs_( &uplo, &trans, &diag, &n, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ),
             &lda, reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   trtrs_native( uplo, trans, diag, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -294,11 +311,13 @@ inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const comp
 //
 // \note This function can only be used if a fitting LAPACK library, which supports this function,
 // is available and linked to the executable. Otherwise a call to this function will result in a
-// linker error.
+// linker error. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE switch), the
+// function is handled by a native Blaze kernel and does not require a LAPACK library.
 */
 inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const complex<double>* A,
                    int lda, complex<double>* B, int ldb, int* info )
 {
+#if BLAZE_LAPACK_MODE
    BLAZE_STATIC_ASSERT( sizeof( complex<double> ) == 2UL*sizeof( double ) );
 
 #if defined(INTEL_MKL_VERSION)
@@ -310,6 +329,9 @@ inline void trtrs( char uplo, char trans, char diag, int n, int nrhs, const comp
 
    ztrtrs_( &uplo, &trans, &diag, &n, &nrhs, const_cast<ET*>( reinterpret_cast<const ET*>( A ) ),
             &lda, reinterpret_cast<ET*>( B ), &ldb, info );
+#else
+   trtrs_native( uplo, trans, diag, n, nrhs, A, lda, B, ldb, info );
+#endif
 }
 //*************************************************************************************************
 
@@ -0,0 +1,219 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/gecon.h
+//  \brief Header file for the LAPACK general matrix condition estimation functions (gecon)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_LAPACK_GECON_H_
+#define _BLAZE_MATH_LAPACK_GECON_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/lapack/clapack/gecon.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LAPACK GENERAL MATRIX CONDITION ESTIMATION FUNCTIONS (GECON)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name LAPACK general matrix condition estimation functions (gecon) */
+//@{
+template< typename MT, bool SO >
+inline UnderlyingElement_< ElementType_<MT> >
+   gecon( const DenseMatrix<MT,SO>& A, char norm, UnderlyingElement_< ElementType_<MT> > anorm );
+
+template< typename MT, bool SO >
+inline UnderlyingElement_< ElementType_<MT> >
+   gecon( const DenseMatrix<MT,SO>& A, char norm, UnderlyingElement_< ElementType_<MT> > anorm, LAPACKWorkspace& ws );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for estimating the reciprocal condition number of a general matrix.
+// \ingroup lapack_condition
+//
+// \param A The LU decomposition of the square matrix as computed by getrf().
+// \param norm \c '1' or \c 'O' for the 1-norm, \c 'I' for the infinity-norm.
+// \param anorm The according norm of the original (not decomposed) matrix.
+// \return The estimate of the reciprocal condition number.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid norm argument provided.
+//
+// This function uses the LAPACK gecon() functions to estimate the reciprocal of the condition
+// number of a general square matrix in either the 1-norm or the infinity-norm. The given matrix
+// \a A is expected to contain the LU decomposition of the original matrix as computed by the
+// getrf() functions and \a anorm is expected to contain the 1-norm (\c '1' or \c 'O') or the
+// infinity-norm (\c 'I') of the original matrix. In case the reciprocal condition number is
+// close to zero, the matrix is close to singular.
+// Note that the function only works for general, non-adapted matrices with \c float, \c double,
+// \c complex<float>, or \c complex<double> element type. The attempt to call the function with
+// adaptors or matrices of any other element type results in a compile time error!
+//
+// The function fails if ...
+//
+//  - ... the given matrix is not a square matrix;
+//  - ... the given \a norm argument is neither \c '1', \c 'O', nor \c 'I'.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// Example:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   DynamicMatrix<double,columnMajor> A( 5UL, 5UL );  // The system matrix A
+   DynamicVector<int,columnVector> ipiv( 5UL );      // Pivoting indices
+   // ... Initialization
+
+   double anorm( 0.0 );
+   for( size_t j=0UL; j<A.columns(); ++j )
+      anorm = max( anorm, sum( abs( column( A, j ) ) ) );
+
+   getrf( A, ipiv.data() );
+   const double rcond = gecon( A, '1', anorm );
+   \endcode
+
+// For more information on the gecon() functions (i.e. sgecon(), dgecon(), cgecon(), and zgecon())
+// see the LAPACK online documentation browser:
+//
+//        http://www.netlib.org/lapack/explore-html/
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline UnderlyingElement_< ElementType_<MT> >
+   gecon( const DenseMatrix<MT,SO>& A, char norm, UnderlyingElement_< ElementType_<MT> > anorm )
+{
+   LAPACKWorkspace ws;
+   return gecon( ~A, norm, anorm, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for estimating the reciprocal condition number of a general matrix.
+// \ingroup lapack_condition
+//
+// \param A The LU decomposition of the square matrix as computed by getrf().
+// \param norm \c '1' or \c 'O' for the 1-norm, \c 'I' for the infinity-norm.
+// \param anorm The according norm of the original (not decomposed) matrix.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The estimate of the reciprocal condition number.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid norm argument provided.
+//
+// This function is identical to the according gecon() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline UnderlyingElement_< ElementType_<MT> >
+   gecon( const DenseMatrix<MT,SO>& A, char norm, UnderlyingElement_< ElementType_<MT> > anorm, LAPACKWorkspace& ws )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   using ET = ElementType_<MT>;
+   using BT = UnderlyingElement_<ET>;
+   using AT = If_< IsComplex<ET>, BT, int >;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( norm != '1' && norm != 'O' && norm != 'I' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid norm argument provided" );
+   }
+
+   int n   ( numeric_cast<int>( (~A).columns() ) );
+   int lda ( numeric_cast<int>( (~A).spacing() ) );
+   int info( 0 );
+
+   BT rcond( 0 );
+
+   if( n == 0 ) {
+      return BT( 1 );
+   }
+
+   if( IsRowMajorMatrix<MT>::value ) {
+      ( norm == 'I' )?( norm = 'O' ):( norm = 'I' );
+   }
+
+   ET* const work( ws.get<ET>( 0UL, 4*n ) );
+   AT* const aux ( ws.get<AT>( 1UL, 2*n ) );
+
+   gecon( norm, n, (~A).data(), lda, anorm, &rcond, work, aux, &info );
+
+   BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for condition estimation" );
+
+   return rcond;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -50,6 +49,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/geev.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/UnderlyingElement.h>
@@ -77,15 +77,30 @@ namespace blaze {
 template< typename MT, bool SO, typename VT, bool TF >
 inline void geev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w );
 
+template< typename MT, bool SO, typename VT, bool TF >
+inline void geev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO1, typename MT2, bool SO2, typename VT, bool TF >
 inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector<VT,TF>& w );
 
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename VT, bool TF >
+inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector<VT,TF>& w,
+                  LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
 inline void geev( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& VR );
 
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+inline void geev( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& VR,
+                  LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO1, typename MT2, bool SO2, typename VT, bool TF, typename MT3, bool SO3 >
 inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL,
                   DenseVector<VT,TF>& w, DenseMatrix<MT3,SO3>& VR );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename VT, bool TF, typename MT3, bool SO3 >
+inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL,
+                  DenseVector<VT,TF>& w, DenseMatrix<MT3,SO3>& VR, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -97,6 +112,7 @@ inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL,
 //
 // \param A The given real general matrix.
 // \param w The resulting vector of complex eigenvalues.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -112,7 +128,7 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline DisableIf_< IsComplex< ElementType_<MT> > >
-   geev_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   geev_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ), "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( (~w).size() == (~A).rows(), "Invalid vector dimension detected" );
@@ -128,12 +144,19 @@ inline DisableIf_< IsComplex< ElementType_<MT> > >
    int info( 0 );
 
    int lwork( 3*n + 2 );
-   const std::unique_ptr<BT[]> wr  ( new BT[n] );
-   const std::unique_ptr<BT[]> wi  ( new BT[n] );
-   const std::unique_ptr<BT[]> work( new BT[lwork] );
+   BT* const wr( ws.get<BT>( 3UL, n ) );
+   BT* const wi( ws.get<BT>( 4UL, n ) );
+
+   BT wkopt( 0 );
 
-   geev( 'N', 'N', n, (~A).data(), lda, wr.get(), wi.get(),
-         nullptr, 1, nullptr, 1, work.get(), lwork, &info );
+   geev( 'N', 'N', n, (~A).data(), lda, wr, wi,
+         nullptr, 1, nullptr, 1, &wkopt, -1, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   BT* const work( ws.get<BT>( 0UL, lwork ) );
+
+   geev( 'N', 'N', n, (~A).data(), lda, wr, wi,
+         nullptr, 1, nullptr, 1, work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -156,6 +179,7 @@ inline DisableIf_< IsComplex< ElementType_<MT> > >
 //
 // \param A The given complex general matrix.
 // \param w The resulting vector of complex eigenvalues.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -171,7 +195,7 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline EnableIf_< IsComplex< ElementType_<MT> > >
-   geev_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+   geev_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ), "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( (~w).size() == (~A).rows(), "Invalid vector dimension detected" );
@@ -187,11 +211,18 @@ inline EnableIf_< IsComplex< ElementType_<MT> > >
    int info( 0 );
 
    int lwork( 2*n + 2 );
-   const std::unique_ptr<CT[]> work ( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[2*n] );
+   BT* const rwork( ws.get<BT>( 1UL, 2*n ) );
+
+   CT wkopt( 0 );
+
+   geev( 'N', 'N', n, (~A).data(), lda, (~w).data(),
+         nullptr, 1, nullptr, 1, &wkopt, -1, rwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    geev( 'N', 'N', n, (~A).data(), lda, (~w).data(),
-         nullptr, 1, nullptr, 1, work.get(), lwork, rwork.get(), &info );
+         nullptr, 1, nullptr, 1, work, lwork, rwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -263,6 +294,38 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline void geev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
+{
+   LAPACKWorkspace ws;
+   geev( A, w, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense general matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given general matrix.
+// \param w The resulting vector of complex eigenvalues.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according geev() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline void geev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -286,7 +349,7 @@ inline void geev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
       return;
    }
 
-   geev_backend( ~A, ~w );
+   geev_backend( ~A, ~w, ws );
 }
 //*************************************************************************************************
 
@@ -299,6 +362,7 @@ inline void geev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w )
 // \param A The given real general matrix.
 // \param VL The resulting matrix of left eigenvectors.
 // \param w The resulting vector of complex eigenvalues.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -316,7 +380,8 @@ template< typename MT1  // Type of the matrix A
         , typename VT   // Type of the vector w
         , bool TF >     // Transpose flag of the vector w
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
-   geev_backend( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector<VT,TF>& w )
+   geev_backend( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector<VT,TF>& w,
+                 LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ) , "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( isSquare( ~VL ), "Invalid non-square matrix detected" );
@@ -334,15 +399,24 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    int info( 0 );
 
    int lwork( 4*n + 2 );
-   const std::unique_ptr<BT[]> vl  ( new BT[n*n] );
-   const std::unique_ptr<BT[]> wr  ( new BT[n] );
-   const std::unique_ptr<BT[]> wi  ( new BT[n] );
-   const std::unique_ptr<BT[]> work( new BT[lwork] );
+   BT* const vl( ws.get<BT>( 3UL, n*n ) );
+   BT* const wr( ws.get<BT>( 4UL, n ) );
+   BT* const wi( ws.get<BT>( 5UL, n ) );
+
+   BT wkopt( 0 );
+
+   geev( ( SO1 ? 'V' : 'N' ), ( SO1 ? 'N' : 'V' ), n, (~A).data(), lda, wr, wi,
+         ( SO1 ? vl : nullptr ), ( SO1 ? n : 1 ),
+         ( SO1 ? nullptr : vl ), ( SO1 ? 1 : n ),
+         &wkopt, -1, &info );
 
-   geev( ( SO1 ? 'V' : 'N' ), ( SO1 ? 'N' : 'V' ), n, (~A).data(), lda, wr.get(), wi.get(),
-         ( SO1 ? vl.get() : nullptr ), ( SO1 ? n : 1 ),
-         ( SO1 ? nullptr : vl.get() ), ( SO1 ? 1 : n ),
-         work.get(), lwork, &info );
+   lwork = optimalWorkspace( wkopt, lwork );
+   BT* const work( ws.get<BT>( 0UL, lwork ) );
+
+   geev( ( SO1 ? 'V' : 'N' ), ( SO1 ? 'N' : 'V' ), n, (~A).data(), lda, wr, wi,
+         ( SO1 ? vl : nullptr ), ( SO1 ? n : 1 ),
+         ( SO1 ? nullptr : vl ), ( SO1 ? 1 : n ),
+         work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -391,6 +465,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param A The given complex general matrix.
 // \param VL The resulting matrix of left eigenvectors.
 // \param w The resulting vector of complex eigenvalues.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -408,7 +483,8 @@ template< typename MT1  // Type of the matrix A
         , typename VT   // Type of the vector w
         , bool TF >     // Transpose flag of the vector w
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
-   geev_backend( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector<VT,TF>& w )
+   geev_backend( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector<VT,TF>& w,
+                 LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ) , "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( isSquare( ~VL ), "Invalid non-square matrix detected" );
@@ -427,13 +503,22 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
    int info( 0 );
 
    int lwork( 2*n + 2 );
-   const std::unique_ptr<CT[]> work ( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[2*n] );
+   BT* const rwork( ws.get<BT>( 1UL, 2*n ) );
+
+   CT wkopt( 0 );
+
+   geev( ( SO1 ? 'V' : 'N' ), ( SO1 ? 'N' : 'V' ), n, (~A).data(), lda, (~w).data(),
+         ( SO1 ? (~VL).data() : nullptr ), ( SO1 ? ldvl : 1 ),
+         ( SO1 ? nullptr : (~VL).data() ), ( SO1 ? 1 : ldvl ),
+         &wkopt, -1, rwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    geev( ( SO1 ? 'V' : 'N' ), ( SO1 ? 'N' : 'V' ), n, (~A).data(), lda, (~w).data(),
          ( SO1 ? (~VL).data() : nullptr ), ( SO1 ? ldvl : 1 ),
          ( SO1 ? nullptr : (~VL).data() ), ( SO1 ? 1 : ldvl ),
-         work.get(), lwork, rwork.get(), &info );
+         work, lwork, rwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -521,6 +606,43 @@ template< typename MT1  // Type of the matrix A
         , typename VT   // Type of the vector w
         , bool TF >     // Transpose flag of the vector w
 inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector<VT,TF>& w )
+{
+   LAPACKWorkspace ws;
+   geev( A, VL, w, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense general matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given general matrix.
+// \param VL The resulting matrix of left eigenvectors.
+// \param w The resulting vector of complex eigenvalues.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according geev() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename MT2  // Type of the matrix VL
+        , bool SO2      // Storage order of the matrix VL
+        , typename VT   // Type of the vector w
+        , bool TF >     // Transpose flag of the vector w
+inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector<VT,TF>& w,
+                  LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -551,7 +673,7 @@ inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector
       return;
    }
 
-   geev_backend( ~A, ~VL, ~w );
+   geev_backend( ~A, ~VL, ~w, ws );
 }
 //*************************************************************************************************
 
@@ -564,6 +686,7 @@ inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL, DenseVector
 // \param A The given real general matrix.
 // \param w The resulting vector of complex eigenvalues.
 // \param VR The resulting matrix of right eigenvectors.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -581,7 +704,8 @@ template< typename MT1  // Type of the matrix A
         , typename MT2  // Type of the matrix VR
         , bool SO2 >    // Storage order of the matrix VR
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
-   geev_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& VR )
+   geev_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& VR,
+                 LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ) , "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( isSquare( ~VR ), "Invalid non-square matrix detected" );
@@ -599,15 +723,24 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    int info( 0 );
 
    int lwork( 4*n + 2 );
-   const std::unique_ptr<BT[]> vr  ( new BT[n*n] );
-   const std::unique_ptr<BT[]> wr  ( new BT[n] );
-   const std::unique_ptr<BT[]> wi  ( new BT[n] );
-   const std::unique_ptr<BT[]> work( new BT[lwork] );
+   BT* const vr( ws.get<BT>( 3UL, n*n ) );
+   BT* const wr( ws.get<BT>( 4UL, n ) );
+   BT* const wi( ws.get<BT>( 5UL, n ) );
+
+   BT wkopt( 0 );
 
-   geev( ( SO1 ? 'N' : 'V' ), ( SO1 ? 'V' : 'N' ), n, (~A).data(), lda, wr.get(), wi.get(),
-         ( SO1 ? nullptr : vr.get() ), ( SO1 ? 1 : n ),
-         ( SO1 ? vr.get() : nullptr ), ( SO1 ? n : 1 ),
-         work.get(), lwork, &info );
+   geev( ( SO1 ? 'N' : 'V' ), ( SO1 ? 'V' : 'N' ), n, (~A).data(), lda, wr, wi,
+         ( SO1 ? nullptr : vr ), ( SO1 ? 1 : n ),
+         ( SO1 ? vr : nullptr ), ( SO1 ? n : 1 ),
+         &wkopt, -1, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   BT* const work( ws.get<BT>( 0UL, lwork ) );
+
+   geev( ( SO1 ? 'N' : 'V' ), ( SO1 ? 'V' : 'N' ), n, (~A).data(), lda, wr, wi,
+         ( SO1 ? nullptr : vr ), ( SO1 ? 1 : n ),
+         ( SO1 ? vr : nullptr ), ( SO1 ? n : 1 ),
+         work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -656,6 +789,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param A The given complex general matrix.
 // \param w The resulting vector of complex eigenvalues.
 // \param VR The resulting matrix of right eigenvectors.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -673,7 +807,8 @@ template< typename MT1  // Type of the matrix A
         , typename MT2  // Type of the matrix VR
         , bool SO2 >    // Storage order of the matrix VR
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
-   geev_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& VR )
+   geev_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& VR,
+                 LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ) , "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( isSquare( ~VR ), "Invalid non-square matrix detected" );
@@ -692,13 +827,22 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
    int info( 0 );
 
    int lwork( 2*n + 2 );
-   const std::unique_ptr<CT[]> work ( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[2*n] );
+   BT* const rwork( ws.get<BT>( 1UL, 2*n ) );
+
+   CT wkopt( 0 );
+
+   geev( ( SO1 ? 'N' : 'V' ), ( SO1 ? 'V' : 'N' ), n, (~A).data(), lda, (~w).data(),
+         ( SO1 ? nullptr : (~VR).data() ), ( SO1 ? 1 : ldvr ),
+         ( SO1 ? (~VR).data() : nullptr ), ( SO1 ? ldvr : 1 ),
+         &wkopt, -1, rwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    geev( ( SO1 ? 'N' : 'V' ), ( SO1 ? 'V' : 'N' ), n, (~A).data(), lda, (~w).data(),
          ( SO1 ? nullptr : (~VR).data() ), ( SO1 ? 1 : ldvr ),
          ( SO1 ? (~VR).data() : nullptr ), ( SO1 ? ldvr : 1 ),
-         work.get(), lwork, rwork.get(), &info );
+         work, lwork, rwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -786,6 +930,43 @@ template< typename MT1  // Type of the matrix A
         , typename MT2  // Type of the matrix VR
         , bool SO2 >    // Storage order of the matrix VR
 inline void geev( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& VR )
+{
+   LAPACKWorkspace ws;
+   geev( A, w, VR, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense general matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given general matrix.
+// \param w The resulting vector of complex eigenvalues.
+// \param VR The resulting matrix of right eigenvectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according geev() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix VR
+        , bool SO2 >    // Storage order of the matrix VR
+inline void geev( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT2,SO2>& VR,
+                  LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -816,7 +997,7 @@ inline void geev( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT
       return;
    }
 
-   geev_backend( ~A, ~w, ~VR );
+   geev_backend( ~A, ~w, ~VR, ws );
 }
 //*************************************************************************************************
 
@@ -830,6 +1011,7 @@ inline void geev( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w, DenseMatrix<MT
 // \param VL The resulting matrix of left eigenvectors.
 // \param w The resulting vector of complex eigenvalues.
 // \param VR The resulting matrix of right eigenvectors.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -850,7 +1032,7 @@ template< typename MT1  // Type of the matrix A
         , bool SO3 >    // Storage order of the matrix VR
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
    geev_backend( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL,
-                 DenseVector<VT,TF>& w, DenseMatrix<MT3,SO3>& VR )
+                 DenseVector<VT,TF>& w, DenseMatrix<MT3,SO3>& VR, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ) , "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( isSquare( ~VL ), "Invalid non-square matrix detected" );
@@ -870,15 +1052,23 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    int info( 0 );
 
    int lwork( 4*n + 2 );
-   const std::unique_ptr<BT[]> vl  ( new BT[n*n] );
-   const std::unique_ptr<BT[]> vr  ( new BT[n*n] );
-   const std::unique_ptr<BT[]> wr  ( new BT[n] );
-   const std::unique_ptr<BT[]> wi  ( new BT[n] );
-   const std::unique_ptr<BT[]> work( new BT[lwork] );
+   BT* const vl( ws.get<BT>( 3UL, n*n ) );
+   BT* const vr( ws.get<BT>( 4UL, n*n ) );
+   BT* const wr( ws.get<BT>( 5UL, n ) );
+   BT* const wi( ws.get<BT>( 6UL, n ) );
+
+   BT wkopt( 0 );
+
+   geev( 'V', 'V', n, (~A).data(), lda, wr, wi,
+         ( SO1 ? vl : vr ), n, ( SO1 ? vr : vl ), n,
+         &wkopt, -1, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   BT* const work( ws.get<BT>( 0UL, lwork ) );
 
-   geev( 'V', 'V', n, (~A).data(), lda, wr.get(), wi.get(),
-         ( SO1 ? vl.get() : vr.get() ), n, ( SO1 ? vr.get() : vl.get() ), n,
-         work.get(), lwork, &info );
+   geev( 'V', 'V', n, (~A).data(), lda, wr, wi,
+         ( SO1 ? vl : vr ), n, ( SO1 ? vr : vl ), n,
+         work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -933,6 +1123,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param VL The resulting matrix of left eigenvectors.
 // \param w The resulting vector of complex eigenvalues.
 // \param VR The resulting matrix of right eigenvectors.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -953,7 +1144,7 @@ template< typename MT1  // Type of the matrix A
         , bool SO3 >    // Storage order of the matrix VR
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
    geev_backend( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL,
-                 DenseVector<VT,TF>& w, DenseMatrix<MT3,SO3>& VR )
+                 DenseVector<VT,TF>& w, DenseMatrix<MT3,SO3>& VR, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ) , "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( isSquare( ~VL ), "Invalid non-square matrix detected" );
@@ -975,13 +1166,22 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
    int info( 0 );
 
    int lwork( 2*n + 2 );
-   const std::unique_ptr<CT[]> work ( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[2*n] );
+   BT* const rwork( ws.get<BT>( 1UL, 2*n ) );
+
+   CT wkopt( 0 );
+
+   geev( 'V', 'V', n, (~A).data(), lda, (~w).data(),
+         ( SO1 ? (~VL).data() : (~VR).data() ), ( SO1 ? ldvl : ldvr ),
+         ( SO1 ? (~VR).data() : (~VL).data() ), ( SO1 ? ldvr : ldvl ),
+         &wkopt, -1, rwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    geev( 'V', 'V', n, (~A).data(), lda, (~w).data(),
          ( SO1 ? (~VL).data() : (~VR).data() ), ( SO1 ? ldvl : ldvr ),
          ( SO1 ? (~VR).data() : (~VL).data() ), ( SO1 ? ldvr : ldvl ),
-         work.get(), lwork, rwork.get(), &info );
+         work, lwork, rwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -1081,6 +1281,46 @@ template< typename MT1  // Type of the matrix A
         , bool SO3 >    // Storage order of the matrix VR
 inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL,
                   DenseVector<VT,TF>& w, DenseMatrix<MT3,SO3>& VR )
+{
+   LAPACKWorkspace ws;
+   geev( A, VL, w, VR, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense general matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given general matrix.
+// \param VL The resulting matrix of left eigenvectors.
+// \param w The resulting vector of complex eigenvalues.
+// \param VR The resulting matrix of right eigenvectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according geev() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename MT2  // Type of the matrix VL
+        , bool SO2      // Storage order of the matrix VL
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT3  // Type of the matrix VR
+        , bool SO3 >    // Storage order of the matrix VR
+inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL,
+                  DenseVector<VT,TF>& w, DenseMatrix<MT3,SO3>& VR, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -1118,7 +1358,7 @@ inline void geev( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& VL,
       return;
    }
 
-   geev_backend( ~A, ~VL, ~w, ~VR );
+   geev_backend( ~A, ~VL, ~w, ~VR, ws );
 }
 //*************************************************************************************************
 
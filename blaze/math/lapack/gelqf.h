@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -49,6 +48,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/gelqf.h>
 #include <blaze/math/lapack/clapack/geqrf.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 
@@ -66,6 +66,9 @@ namespace blaze {
 //@{
 template< typename MT, bool SO >
 inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau );
+
+template< typename MT, bool SO >
+inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -115,6 +118,33 @@ inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau );
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
 inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
+{
+   LAPACKWorkspace ws;
+   gelqf( A, tau, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the LQ decomposition of the given dense matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+//
+// This function is identical to the according gelqf() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -132,14 +162,24 @@ inline void gelqf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
       return;
    }
 
-   int lwork( ( SO ? m : n ) * lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   if( SO ) {
+      gelqf( m, n, (~A).data(), lda, tau, &wkopt, lwork, &info );
+   }
+   else {
+      geqrf( m, n, (~A).data(), lda, tau, &wkopt, lwork, &info );
+   }
+
+   lwork = optimalWorkspace( wkopt, ( SO ? m : n ) );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
 
    if( SO ) {
-      gelqf( m, n, (~A).data(), lda, tau, work.get(), lwork, &info );
+      gelqf( m, n, (~A).data(), lda, tau, work, lwork, &info );
    }
    else {
-      geqrf( m, n, (~A).data(), lda, tau, work.get(), lwork, &info );
+      geqrf( m, n, (~A).data(), lda, tau, work, lwork, &info );
    }
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for LQ decomposition" );
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -50,6 +49,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/gesdd.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/UnderlyingElement.h>
 #include <blaze/util/algorithms/Max.h>
@@ -75,17 +75,32 @@ namespace blaze {
 template< typename MT, bool SO, typename VT, bool TF >
 inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s );
 
+template< typename MT, bool SO, typename VT, bool TF >
+inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF >
 inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, char jobz );
 
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF >
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, char jobz, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF >
 inline void gesdd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
                    DenseMatrix<MT2,SO>& V, char jobz );
 
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF >
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
+                   DenseMatrix<MT2,SO>& V, char jobz, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
 inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -97,6 +112,7 @@ inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 //
 // \param A The given real general matrix.
 // \param s The resulting vector of singular values.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -112,7 +128,7 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
 inline DisableIf_< IsComplex< ElementType_<MT> > >
-   gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+   gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
 
@@ -127,11 +143,18 @@ inline DisableIf_< IsComplex< ElementType_<MT> > >
    const int maximum( max( m, n ) );
 
    int lwork( 3*minimum + max( maximum, 7*minimum ) + 2 );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+   int* const iwork( ws.get<int>( 2UL, 8*minimum ) );
+
+   ET wkopt( 0 );
+
+   gesdd( 'N', m, n, (~A).data(), lda, (~s).data(),
+          nullptr, 1, nullptr, 1, &wkopt, -1, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
 
    gesdd( 'N', m, n, (~A).data(), lda, (~s).data(),
-          nullptr, 1, nullptr, 1, work.get(), lwork, iwork.get(), &info );
+          nullptr, 1, nullptr, 1, work, lwork, iwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -150,6 +173,7 @@ inline DisableIf_< IsComplex< ElementType_<MT> > >
 //
 // \param A The given complex general matrix.
 // \param s The resulting vector of singular values.
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -165,7 +189,7 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
 inline EnableIf_< IsComplex< ElementType_<MT> > >
-   gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+   gesdd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
 
@@ -181,12 +205,19 @@ inline EnableIf_< IsComplex< ElementType_<MT> > >
    const int maximum( max( m, n ) );
 
    int lwork( 2*minimum + maximum + 2 );
-   const std::unique_ptr<CT[]> work( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[7*minimum] );
-   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+   BT*  const rwork( ws.get<BT> ( 1UL, 7*minimum ) );
+   int* const iwork( ws.get<int>( 2UL, 8*minimum ) );
+
+   CT wkopt( 0 );
 
    gesdd( 'N', m, n, (~A).data(), lda, (~s).data(),
-          nullptr, 1, nullptr, 1, work.get(), lwork, rwork.get(), iwork.get(), &info );
+          nullptr, 1, nullptr, 1, &wkopt, -1, rwork, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
+
+   gesdd( 'N', m, n, (~A).data(), lda, (~s).data(),
+          nullptr, 1, nullptr, 1, work, lwork, rwork, iwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -265,6 +296,37 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
 inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+{
+   LAPACKWorkspace ws;
+   gesdd( A, s, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesdd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -285,7 +347,7 @@ inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
       return;
    }
 
-   gesdd_backend( A, s );
+   gesdd_backend( A, s, ws );
 }
 //*************************************************************************************************
 
@@ -299,6 +361,7 @@ inline void gesdd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
 // \param U The resulting matrix of left singular vectors.
 // \param s The resulting vector of singular values.
 // \param jobz Specifies the computation of the singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -316,7 +379,7 @@ template< typename MT1    // Type of the matrix A
         , bool TF >       // Transpose flag of the vector s
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
    gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
-                  DenseVector<VT,TF>& s, char jobz )
+                  DenseVector<VT,TF>& s, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobz == 'O' || jobz == 'N', "Invalid jobz flag detected" );
    BLAZE_INTERNAL_ASSERT( jobz == 'N' || isSquare( ~U ), "Invalid matrix dimensions detected" );
@@ -337,13 +400,22 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    int lwork( ( jobz == 'O' )
               ?( 3*minimum + max( maximum, 5*minimum*minimum + 4*maximum ) + 2 )
               :( 3*minimum + max( maximum, 7*minimum ) + 2 ) );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+   int* const iwork( ws.get<int>( 2UL, 8*minimum ) );
+
+   ET wkopt( 0 );
 
    gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
           ( SO ? (~U).data() : nullptr ), ( SO ? ldu : 1 ),
           ( SO ? nullptr : (~U).data() ), ( SO ? 1 : ldu ),
-          work.get(), lwork, iwork.get(), &info );
+          &wkopt, -1, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? (~U).data() : nullptr ), ( SO ? ldu : 1 ),
+          ( SO ? nullptr : (~U).data() ), ( SO ? 1 : ldu ),
+          work, lwork, iwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -364,6 +436,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param U The resulting matrix of left singular vectors.
 // \param s The resulting vector of singular values.
 // \param jobz Specifies the computation of the singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -381,7 +454,7 @@ template< typename MT1    // Type of the matrix A
         , bool TF >       // Transpose flag of the vector s
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
    gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
-                  DenseVector<VT,TF>& s, char jobz )
+                  DenseVector<VT,TF>& s, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobz == 'O' || jobz == 'N', "Invalid jobz flag detected" );
    BLAZE_INTERNAL_ASSERT( jobz == 'N' || isSquare( ~U ), "Invalid matrix dimensions detected" );
@@ -407,14 +480,23 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
                      ?( max( 5*minimum*minimum + 5*minimum,
                              2*maximum*minimum + 2*minimum*minimum + minimum ) )
                      :( 7*minimum ) );
-   const std::unique_ptr<CT[]> work( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[lrwork] );
-   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+   BT*  const rwork( ws.get<BT> ( 1UL, lrwork ) );
+   int* const iwork( ws.get<int>( 2UL, 8*minimum ) );
+
+   CT wkopt( 0 );
+
+   gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? (~U).data() : nullptr ), ( SO ? ldu : 1 ),
+          ( SO ? nullptr : (~U).data() ), ( SO ? 1 : ldu ),
+          &wkopt, -1, rwork, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
           ( SO ? (~U).data() : nullptr ), ( SO ? ldu : 1 ),
           ( SO ? nullptr : (~U).data() ), ( SO ? 1 : ldu ),
-          work.get(), lwork, rwork.get(), iwork.get(), &info );
+          work, lwork, rwork, iwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -522,6 +604,44 @@ template< typename MT1    // Type of the matrix A
         , bool TF >       // Transpose flag of the vector s
 inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, char jobz )
+{
+   LAPACKWorkspace ws;
+   gesdd( A, U, s, jobz, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param jobz Specifies the computation of the singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid input matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesdd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename MT2    // Type of the matrix U
+        , typename VT     // Type of the vector s
+        , bool TF >       // Transpose flag of the vector s
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -559,7 +679,7 @@ inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
       return;
    }
 
-   gesdd_backend( ~A, ~U, ~s, jobz );
+   gesdd_backend( ~A, ~U, ~s, jobz, ws );
 }
 //*************************************************************************************************
 
@@ -573,6 +693,7 @@ inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 // \param s The resulting vector of singular values.
 // \param V The resulting matrix of right singular vectors.
 // \param jobz Specifies the computation of the singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -590,7 +711,7 @@ template< typename MT1    // Type of the matrix A
         , typename MT2 >  // Type of the matrix V
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
    gesdd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
-                  DenseMatrix<MT2,SO>& V, char jobz )
+                  DenseMatrix<MT2,SO>& V, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobz == 'O' || jobz == 'N', "Invalid jobz flag detected" );
    BLAZE_INTERNAL_ASSERT( jobz == 'N' || isSquare( ~V ), "Invalid matrix dimensions detected" );
@@ -611,13 +732,22 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    int lwork( ( jobz == 'O' )
               ?( 3*minimum + max( maximum, 5*minimum*minimum + 4*maximum + 2 ) )
               :( 3*minimum + max( maximum, 7*minimum ) + 2 ) );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+   int* const iwork( ws.get<int>( 2UL, 8*minimum ) );
+
+   ET wkopt( 0 );
 
    gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
           ( SO ? nullptr : (~V).data() ), ( SO ? 1 : ldv ),
           ( SO ? (~V).data() : nullptr ), ( SO ? ldv : 1 ),
-          work.get(), lwork, iwork.get(), &info );
+          &wkopt, -1, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? nullptr : (~V).data() ), ( SO ? 1 : ldv ),
+          ( SO ? (~V).data() : nullptr ), ( SO ? ldv : 1 ),
+          work, lwork, iwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -638,6 +768,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param s The resulting vector of singular values.
 // \param V The resulting matrix of right singular vectors.
 // \param jobz Specifies the computation of the singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -655,7 +786,7 @@ template< typename MT1    // Type of the matrix A
         , typename MT2 >  // Type of the matrix V
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
    gesdd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
-                  DenseMatrix<MT2,SO>& V, char jobz )
+                  DenseMatrix<MT2,SO>& V, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobz == 'O' || jobz == 'N', "Invalid jobz flag detected" );
    BLAZE_INTERNAL_ASSERT( jobz == 'N' || isSquare( ~V ), "Invalid matrix dimensions detected" );
@@ -681,14 +812,23 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
                      ?( max( 5*minimum*minimum + 5*minimum,
                              2*maximum*minimum + 2*minimum*minimum + minimum ) )
                      :( 7*minimum ) );
-   const std::unique_ptr<CT[]> work( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[lrwork] );
-   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+   BT*  const rwork( ws.get<BT> ( 1UL, lrwork ) );
+   int* const iwork( ws.get<int>( 2UL, 8*minimum ) );
+
+   CT wkopt( 0 );
+
+   gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? nullptr : (~V).data() ), ( SO ? 1 : ldv ),
+          ( SO ? (~V).data() : nullptr ), ( SO ? ldv : 1 ),
+          &wkopt, -1, rwork, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
           ( SO ? nullptr : (~V).data() ), ( SO ? 1 : ldv ),
           ( SO ? (~V).data() : nullptr ), ( SO ? ldv : 1 ),
-          work.get(), lwork, rwork.get(), iwork.get(), &info );
+          work, lwork, rwork, iwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -787,6 +927,44 @@ template< typename MT1    // Type of the matrix A
         , bool TF >       // Transpose flag of the vector s
 inline void gesdd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
                    DenseMatrix<MT2,SO>& V, char jobz )
+{
+   LAPACKWorkspace ws;
+   gesdd( A, s, V, jobz, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param jobz Specifies the computation of the singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid input matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesdd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename MT2    // Type of the matrix U
+        , typename VT     // Type of the vector s
+        , bool TF >       // Transpose flag of the vector s
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
+                   DenseMatrix<MT2,SO>& V, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -824,7 +1002,7 @@ inline void gesdd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
       return;
    }
 
-   gesdd_backend( ~A, ~s, ~V, jobz );
+   gesdd_backend( ~A, ~s, ~V, jobz, ws );
 }
 //*************************************************************************************************
 
@@ -839,6 +1017,7 @@ inline void gesdd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
 // \param s The resulting vector of singular values.
 // \param V The resulting matrix of right singular vectors.
 // \param jobz Specifies the computation of the singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -857,7 +1036,7 @@ template< typename MT1    // Type of the matrix A
         , typename MT3 >  // Type of the matrix V
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
    gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
-                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz )
+                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobz == 'A' || jobz == 'S' || jobz == 'N', "Invalid jobz flag detected" );
    BLAZE_INTERNAL_ASSERT( jobz == 'N' || (~U).rows() == (~A).rows(), "Invalid matrix dimension detected" );
@@ -881,13 +1060,22 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    const int maximum( max( m, n ) );
 
    int lwork( 4*minimum*minimum + 6*minimum + maximum + 2 );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+   int* const iwork( ws.get<int>( 2UL, 8*minimum ) );
+
+   ET wkopt( 0 );
 
    gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
           ( SO ? (~U).data() : (~V).data() ), ( SO ? ldu : ldv ),
           ( SO ? (~V).data() : (~U).data() ), ( SO ? ldv : ldu ),
-          work.get(), lwork, iwork.get(), &info );
+          &wkopt, -1, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? (~U).data() : (~V).data() ), ( SO ? ldu : ldv ),
+          ( SO ? (~V).data() : (~U).data() ), ( SO ? ldv : ldu ),
+          work, lwork, iwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -909,6 +1097,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param s The resulting vector of singular values.
 // \param V The resulting matrix of right singular vectors.
 // \param jobz Specifies the computation of the singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -927,7 +1116,7 @@ template< typename MT1    // Type of the matrix A
         , typename MT3 >  // Type of the matrix V
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
    gesdd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
-                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz )
+                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobz == 'A' || jobz == 'S' || jobz == 'N', "Invalid jobz flag detected" );
    BLAZE_INTERNAL_ASSERT( jobz == 'N' || (~U).rows() == (~A).rows(), "Invalid matrix dimension detected" );
@@ -954,14 +1143,23 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
    int lwork( 4*minimum*minimum + 6*minimum + maximum + 2 );
    const int lrwork( max( 5*minimum*minimum + 5*minimum,
                           2*maximum*minimum + 2*minimum*minimum + minimum ) );
-   const std::unique_ptr<CT[]> work( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[lrwork] );
-   const std::unique_ptr<int[]> iwork( new int[8*minimum] );
+   BT*  const rwork( ws.get<BT> ( 1UL, lrwork ) );
+   int* const iwork( ws.get<int>( 2UL, 8*minimum ) );
+
+   CT wkopt( 0 );
+
+   gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? (~U).data() : (~V).data() ), ( SO ? ldu : ldv ),
+          ( SO ? (~V).data() : (~U).data() ), ( SO ? ldv : ldu ),
+          &wkopt, -1, rwork, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    gesdd( jobz, m, n, (~A).data(), lda, (~s).data(),
           ( SO ? (~U).data() : (~V).data() ), ( SO ? ldu : ldv ),
           ( SO ? (~V).data() : (~U).data() ), ( SO ? ldv : ldu ),
-          work.get(), lwork, rwork.get(), iwork.get(), &info );
+          work, lwork, rwork, iwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -1083,6 +1281,45 @@ template< typename MT1    // Type of the matrix A
         , typename MT3 >  // Type of the matrix V
 inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz )
+{
+   LAPACKWorkspace ws;
+   gesdd( A, U, s, V, jobz, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param jobz Specifies the computation of the singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesdd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename MT2    // Type of the matrix U
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT3 >  // Type of the matrix V
+inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobz, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -1122,7 +1359,7 @@ inline void gesdd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
       return;
    }
 
-   gesdd_backend( ~A, ~U, ~s, ~V, jobz );
+   gesdd_backend( ~A, ~U, ~s, ~V, jobz, ws );
 }
 //*************************************************************************************************
 
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -50,6 +49,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/gesvd.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/UnderlyingElement.h>
 #include <blaze/util/algorithms/Max.h>
@@ -75,17 +75,34 @@ namespace blaze {
 template< typename MT, bool SO, typename VT, bool TF >
 inline void gesvd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char jobv );
 
+template< typename MT, bool SO, typename VT, bool TF >
+inline void gesvd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char jobv,
+                   LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF >
 inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, char jobu, char jobv );
 
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF >
+inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, char jobu, char jobv, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename VT, bool TF, typename MT2 >
 inline void gesvd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
                    DenseMatrix<MT2,SO>& V, char jobu, char jobv );
 
+template< typename MT1, bool SO, typename VT, bool TF, typename MT2 >
+inline void gesvd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
+                   DenseMatrix<MT2,SO>& V, char jobu, char jobv, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
 inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobu, char jobv );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
+inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobu, char jobv,
+                   LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -99,6 +116,7 @@ inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 // \param s The resulting vector of singular values.
 // \param jobu Specifies the computation of the left singular vectors (\c 'O' or \c 'N').
 // \param jobv Specifies the computation of the right singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -114,7 +132,8 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
 inline DisableIf_< IsComplex< ElementType_<MT> > >
-   gesvd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char jobv )
+   gesvd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char jobv,
+                  LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobu == 'O' || jobu == 'N', "Invalid jobu flag detected" );
    BLAZE_INTERNAL_ASSERT( jobv == 'O' || jobv == 'N', "Invalid jobv flag detected" );
@@ -132,10 +151,17 @@ inline DisableIf_< IsComplex< ElementType_<MT> > >
    const int maximum( max( m, n ) );
 
    int lwork( max( 3*minimum + maximum, 5*minimum ) + 2 );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+
+   ET wkopt( 0 );
 
    gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ), m, n, (~A).data(), lda,
-          (~s).data(), nullptr, 1, nullptr, 1, work.get(), lwork, &info );
+          (~s).data(), nullptr, 1, nullptr, 1, &wkopt, -1, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ), m, n, (~A).data(), lda,
+          (~s).data(), nullptr, 1, nullptr, 1, work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -156,6 +182,7 @@ inline DisableIf_< IsComplex< ElementType_<MT> > >
 // \param s The resulting vector of singular values.
 // \param jobu Specifies the computation of the left singular vectors (\c 'O' or \c 'N').
 // \param jobv Specifies the computation of the right singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -171,7 +198,8 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
 inline EnableIf_< IsComplex< ElementType_<MT> > >
-   gesvd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char jobv )
+   gesvd_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char jobv,
+                  LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobu == 'O' || jobu == 'N', "Invalid jobu flag detected" );
    BLAZE_INTERNAL_ASSERT( jobv == 'O' || jobv == 'N', "Invalid jobv flag detected" );
@@ -190,11 +218,18 @@ inline EnableIf_< IsComplex< ElementType_<MT> > >
    const int maximum( max( m, n ) );
 
    int lwork( 2*minimum + maximum + 2 );
-   const std::unique_ptr<CT[]> work ( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[5*minimum] );
+   BT* const rwork( ws.get<BT>( 1UL, 5*minimum ) );
+
+   CT wkopt( 0 );
+
+   gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ), m, n, (~A).data(), lda,
+          (~s).data(), nullptr, 1, nullptr, 1, &wkopt, -1, rwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ), m, n, (~A).data(), lda,
-          (~s).data(), nullptr, 1, nullptr, 1, work.get(), lwork, rwork.get(), &info );
+          (~s).data(), nullptr, 1, nullptr, 1, work, lwork, rwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -295,6 +330,43 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
 inline void gesvd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char jobv )
+{
+   LAPACKWorkspace ws;
+   gesvd( A, s, jobu, jobv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param jobu Specifies the computation of the left singular vectors (\c 'O' or \c 'N').
+// \param jobv Specifies the computation of the right singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid jobu argument provided.
+// \exception std::invalid_argument Invalid jobv argument provided.
+// \exception std::invalid_argument Invalid combination of jobu and jobv provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline void gesvd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char jobv,
+                   LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -327,7 +399,7 @@ inline void gesvd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char
       return;
    }
 
-   gesvd_backend( ~A, ~s, jobu, jobv );
+   gesvd_backend( ~A, ~s, jobu, jobv, ws );
 }
 //*************************************************************************************************
 
@@ -342,6 +414,7 @@ inline void gesvd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, char jobu, char
 // \param s The resulting vector of singular values.
 // \param jobu Specifies the computation of the left singular vectors (\c 'A', \c 'S', or \c 'N').
 // \param jobv Specifies the computation of the right singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -359,7 +432,7 @@ template< typename MT1    // Type of the matrix A
         , bool TF >       // Transpose flag of the vector s
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
    gesvd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
-                  DenseVector<VT,TF>& s, char jobu, char jobv )
+                  DenseVector<VT,TF>& s, char jobu, char jobv, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobu == 'A' || jobu == 'S' || jobu == 'N', "Invalid jobu flag detected" );
    BLAZE_INTERNAL_ASSERT( jobv == 'O' || jobv == 'N', "Invalid jobv flag detected" );
@@ -380,13 +453,23 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    const int maximum( max( m, n ) );
 
    int lwork( max( 3*minimum + maximum, 5*minimum ) + 2 );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+
+   ET wkopt( 0 );
+
+   gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
+          m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? (~U).data() : nullptr ), ( SO ? ldu : 1 ),
+          ( SO ? nullptr : (~U).data() ), ( SO ? 1 : ldu ),
+          &wkopt, -1, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
 
    gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
           m, n, (~A).data(), lda, (~s).data(),
           ( SO ? (~U).data() : nullptr ), ( SO ? ldu : 1 ),
           ( SO ? nullptr : (~U).data() ), ( SO ? 1 : ldu ),
-          work.get(), lwork, &info );
+          work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -408,6 +491,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param s The resulting vector of singular values.
 // \param jobu Specifies the computation of the left singular vectors (\c 'A', \c 'S', or \c 'N').
 // \param jobv Specifies the computation of the right singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -425,7 +509,7 @@ template< typename MT1    // Type of the matrix A
         , bool TF >       // Transpose flag of the vector s
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
    gesvd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
-                  DenseVector<VT,TF>& s, char jobu, char jobv )
+                  DenseVector<VT,TF>& s, char jobu, char jobv, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobu == 'A' || jobu == 'S' || jobu == 'N', "Invalid jobu flag detected" );
    BLAZE_INTERNAL_ASSERT( jobv == 'O' || jobv == 'N', "Invalid jobv flag detected" );
@@ -447,14 +531,24 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
    const int maximum( max( m, n ) );
 
    int lwork( 2*minimum + maximum + 2 );
-   const std::unique_ptr<CT[]> work ( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[5*minimum] );
+   BT* const rwork( ws.get<BT>( 1UL, 5*minimum ) );
+
+   CT wkopt( 0 );
+
+   gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
+          m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? (~U).data() : nullptr ), ( SO ? ldu : 1 ),
+          ( SO ? nullptr : (~U).data() ), ( SO ? 1 : ldu ),
+          &wkopt, -1, rwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
           m, n, (~A).data(), lda, (~s).data(),
           ( SO ? (~U).data() : nullptr ), ( SO ? ldu : 1 ),
           ( SO ? nullptr : (~U).data() ), ( SO ? 1 : ldu ),
-          work.get(), lwork, rwork.get(), &info );
+          work, lwork, rwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -574,6 +668,45 @@ template< typename MT1    // Type of the matrix A
         , bool TF >       // Transpose flag of the vector s
 inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, char jobu, char jobv )
+{
+   LAPACKWorkspace ws;
+   gesvd( A, U, s, jobu, jobv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param jobu Specifies the computation of the left singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param jobv Specifies the computation of the right singular vectors (\c 'O' or \c 'N').
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid jobu argument provided.
+// \exception std::invalid_argument Invalid jobv argument provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename MT2    // Type of the matrix U
+        , typename VT     // Type of the vector s
+        , bool TF >       // Transpose flag of the vector s
+inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, char jobu, char jobv, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -611,7 +744,7 @@ inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
       return;
    }
 
-   gesvd_backend( ~A, ~U, ~s, jobu, jobv );
+   gesvd_backend( ~A, ~U, ~s, jobu, jobv, ws );
 }
 //*************************************************************************************************
 
@@ -626,6 +759,7 @@ inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 // \param V The resulting matrix of right singular vectors.
 // \param jobu Specifies the computation of the left singular vectors (\c 'O' or \c 'N').
 // \param jobv Specifies the computation of the right singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -643,7 +777,7 @@ template< typename MT1    // Type of the matrix A
         , typename MT2 >  // Type of the matrix V
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
    gesvd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
-                  DenseMatrix<MT2,SO>& V, char jobu, char jobv )
+                  DenseMatrix<MT2,SO>& V, char jobu, char jobv, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobu == 'O' || jobu == 'N', "Invalid jobu flag detected" );
    BLAZE_INTERNAL_ASSERT( jobv == 'A' || jobv == 'S' || jobv == 'N', "Invalid jobv flag detected" );
@@ -664,13 +798,23 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    const int maximum( max( m, n ) );
 
    int lwork( max( 3*minimum + maximum, 5*minimum ) + 2 );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+
+   ET wkopt( 0 );
+
+   gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
+          m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? nullptr : (~V).data() ), ( SO ? 1 : ldv ),
+          ( SO ? (~V).data() : nullptr ), ( SO ? ldv : 1 ),
+          &wkopt, -1, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
 
    gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
           m, n, (~A).data(), lda, (~s).data(),
           ( SO ? nullptr : (~V).data() ), ( SO ? 1 : ldv ),
           ( SO ? (~V).data() : nullptr ), ( SO ? ldv : 1 ),
-          work.get(), lwork, &info );
+          work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -692,6 +836,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param V The resulting matrix of right singular vectors.
 // \param jobu Specifies the computation of the left singular vectors (\c 'O' or \c 'N').
 // \param jobv Specifies the computation of the right singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -709,7 +854,7 @@ template< typename MT1    // Type of the matrix A
         , typename MT2 >  // Type of the matrix V
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
    gesvd_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
-                  DenseMatrix<MT2,SO>& V, char jobu, char jobv )
+                  DenseMatrix<MT2,SO>& V, char jobu, char jobv, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobu == 'O' || jobu == 'N', "Invalid jobu flag detected" );
    BLAZE_INTERNAL_ASSERT( jobv == 'A' || jobv == 'S' || jobv == 'N', "Invalid jobv flag detected" );
@@ -731,14 +876,24 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
    const int maximum( max( m, n ) );
 
    int lwork( 2*minimum + maximum + 2 );
-   const std::unique_ptr<CT[]> work ( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[5*minimum] );
+   BT* const rwork( ws.get<BT>( 1UL, 5*minimum ) );
+
+   CT wkopt( 0 );
+
+   gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
+          m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? nullptr : (~V).data() ), ( SO ? 1 : ldv ),
+          ( SO ? (~V).data() : nullptr ), ( SO ? ldv : 1 ),
+          &wkopt, -1, rwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
           m, n, (~A).data(), lda, (~s).data(),
           ( SO ? nullptr : (~V).data() ), ( SO ? 1 : ldv ),
           ( SO ? (~V).data() : nullptr ), ( SO ? ldv : 1 ),
-          work.get(), lwork, rwork.get(), &info );
+          work, lwork, rwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -858,6 +1013,45 @@ template< typename MT1    // Type of the matrix A
         , typename MT2 >  // Type of the matrix V
 inline void gesvd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
                    DenseMatrix<MT2,SO>& V, char jobu, char jobv )
+{
+   LAPACKWorkspace ws;
+   gesvd( A, s, V, jobu, jobv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param jobu Specifies the computation of the left singular vectors (\c 'O' or \c 'N').
+// \param jobv Specifies the computation of the right singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid jobu argument provided.
+// \exception std::invalid_argument Invalid jobv argument provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT2 >  // Type of the matrix V
+inline void gesvd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
+                   DenseMatrix<MT2,SO>& V, char jobu, char jobv, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -895,7 +1089,7 @@ inline void gesvd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
       return;
    }
 
-   gesvd_backend( ~A, ~s, ~V, jobu, jobv );
+   gesvd_backend( ~A, ~s, ~V, jobu, jobv, ws );
 }
 //*************************************************************************************************
 
@@ -911,6 +1105,7 @@ inline void gesvd( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
 // \param V The resulting matrix of right singular vectors.
 // \param jobu Specifies the computation of the left singular vectors (\c 'A', \c 'S', or \c 'N').
 // \param jobv Specifies the computation of the right singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -929,7 +1124,8 @@ template< typename MT1    // Type of the matrix A
         , typename MT3 >  // Type of the matrix V
 inline DisableIf_< IsComplex< ElementType_<MT1> > >
    gesvd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
-                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobu, char jobv )
+                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobu, char jobv,
+                  LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobu == 'A' || jobu == 'S' || jobu == 'N', "Invalid jobu flag detected" );
    BLAZE_INTERNAL_ASSERT( jobv == 'A' || jobv == 'S' || jobv == 'N', "Invalid jobv flag detected" );
@@ -954,13 +1150,23 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
    const int maximum( max( m, n ) );
 
    int lwork( max( 3*minimum + maximum, 5*minimum ) + 2 );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+
+   ET wkopt( 0 );
 
    gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
           m, n, (~A).data(), lda, (~s).data(),
           ( SO ? (~U).data() : (~V).data() ), ( SO ? ldu : ldv ),
           ( SO ? (~V).data() : (~U).data() ), ( SO ? ldv : ldu ),
-          work.get(), lwork, &info );
+          &wkopt, -1, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
+          m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? (~U).data() : (~V).data() ), ( SO ? ldu : ldv ),
+          ( SO ? (~V).data() : (~U).data() ), ( SO ? ldv : ldu ),
+          work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -983,6 +1189,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> > >
 // \param V The resulting matrix of right singular vectors.
 // \param jobu Specifies the computation of the left singular vectors (\c 'A', \c 'S', or \c 'N').
 // \param jobv Specifies the computation of the right singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory.
 // \return void
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -1001,7 +1208,8 @@ template< typename MT1    // Type of the matrix A
         , typename MT3 >  // Type of the matrix V
 inline EnableIf_< IsComplex< ElementType_<MT1> > >
    gesvd_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
-                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobu, char jobv )
+                  DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobu, char jobv,
+                  LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( jobu == 'A' || jobu == 'S' || jobu == 'N', "Invalid jobu flag detected" );
    BLAZE_INTERNAL_ASSERT( jobv == 'A' || jobv == 'S' || jobv == 'N', "Invalid jobv flag detected" );
@@ -1027,14 +1235,24 @@ inline EnableIf_< IsComplex< ElementType_<MT1> > >
    const int maximum( max( m, n ) );
 
    int lwork( 2*minimum + maximum + 2 );
-   const std::unique_ptr<CT[]> work ( new CT[lwork] );
-   const std::unique_ptr<BT[]> rwork( new BT[5*minimum] );
+   BT* const rwork( ws.get<BT>( 1UL, 5*minimum ) );
+
+   CT wkopt( 0 );
+
+   gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
+          m, n, (~A).data(), lda, (~s).data(),
+          ( SO ? (~U).data() : (~V).data() ), ( SO ? ldu : ldv ),
+          ( SO ? (~V).data() : (~U).data() ), ( SO ? ldv : ldu ),
+          &wkopt, -1, rwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
 
    gesvd( ( SO ? jobu : jobv ), ( SO ? jobv : jobu ),
           m, n, (~A).data(), lda, (~s).data(),
           ( SO ? (~U).data() : (~V).data() ), ( SO ? ldu : ldv ),
           ( SO ? (~V).data() : (~U).data() ), ( SO ? ldv : ldu ),
-          work.get(), lwork, rwork.get(), &info );
+          work, lwork, rwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for singular value decomposition" );
 
@@ -1162,6 +1380,48 @@ template< typename MT1    // Type of the matrix A
         , typename MT3 >  // Type of the matrix V
 inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                    DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobu, char jobv )
+{
+   LAPACKWorkspace ws;
+   gesvd( A, U, s, V, jobu, jobv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param jobu Specifies the computation of the left singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param jobv Specifies the computation of the right singular vectors (\c 'A', \c 'S', or \c 'N').
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid jobu argument provided.
+// \exception std::invalid_argument Invalid jobv argument provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename MT2    // Type of the matrix U
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT3 >  // Type of the matrix V
+inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                   DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, char jobu, char jobv,
+                   LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -1205,7 +1465,7 @@ inline void gesvd( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
       return;
    }
 
-   gesvd_backend( ~A, ~U, ~s, ~V, jobu, jobv );
+   gesvd_backend( ~A, ~U, ~s, ~V, jobu, jobv, ws );
 }
 //*************************************************************************************************
 
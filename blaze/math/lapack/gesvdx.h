@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -50,6 +49,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/gesvdx.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/Size.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/UnderlyingElement.h>
@@ -79,30 +79,62 @@ namespace blaze {
 template< typename MT, bool SO, typename VT, bool TF >
 inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s );
 
+template< typename MT, bool SO, typename VT, bool TF >
+inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, LAPACKWorkspace& ws );
+
 template< typename MT, bool SO, typename VT, bool TF, typename ST >
 inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp );
 
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp,
+                      LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF >
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVector<VT,TF>& s );
 
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF >
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVector<VT,TF>& s,
+                      LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename ST >
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                       DenseVector<VT,TF>& s, ST low, ST upp );
 
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename ST >
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, ST low, ST upp, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename VT, bool TF, typename MT2 >
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, DenseMatrix<MT2,SO>& V );
 
+template< typename MT1, bool SO, typename VT, bool TF, typename MT2 >
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, DenseMatrix<MT2,SO>& V,
+                      LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename VT, bool TF, typename MT2, typename ST >
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
                       DenseMatrix<MT2,SO>& V, ST low, ST upp );
 
+template< typename MT1, bool SO, typename VT, bool TF, typename MT2, typename ST >
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
+                      DenseMatrix<MT2,SO>& V, ST low, ST upp, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                       DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V );
 
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3 >
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3, typename ST >
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                       DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp );
+
+template< typename MT1, bool SO, typename MT2, typename VT, bool TF, typename MT3, typename ST >
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp,
+                      LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -119,6 +151,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 // \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
 // \param il The index of the smallest singular value to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of singular values found.
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -136,7 +169,7 @@ template< typename MT    // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline DisableIf_< IsComplex< ElementType_<MT> >, size_t >
    gesvdx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
-                   char range, ST vl, ST vu, int il, int iu )
+                   char range, ST vl, ST vu, int il, int iu, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( range == 'A' || range == 'V' || range == 'I', "Invalid range flag detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
@@ -158,23 +191,30 @@ inline DisableIf_< IsComplex< ElementType_<MT> >, size_t >
    int info( 0 );
 
    ET* sptr( (~s).data() );
-   std::unique_ptr<ET[]> stmp;
+   ET* stmp( nullptr );
 
    const bool tmpRequired( (~s).size() < mindim );
 
    if( tmpRequired ) {
-      stmp.reset( new ET[2UL*mindim] );
-      sptr = stmp.get();
+      stmp = ws.get<ET>( 5UL, 2UL*mindim );
+      sptr = stmp;
    }
 
    const int minimum( min( m, n ) );
 
    int lwork( minimum*( minimum*3 + 20 ) + 2 );
-   const std::unique_ptr<ET[]>  work ( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[12*minimum] );
+   int* const iwork( ws.get<int>( 2UL, 12*minimum ) );
+
+   ET wkopt( 0 );
 
    gesvdx( 'N', 'N', range, m, n, (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
-           nullptr, 1, nullptr, 1, work.get(), lwork, iwork.get(), &info );
+           nullptr, 1, nullptr, 1, &wkopt, -1, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   gesvdx( 'N', 'N', range, m, n, (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
+           nullptr, 1, nullptr, 1, work, lwork, iwork, &info );
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -209,6 +249,7 @@ inline DisableIf_< IsComplex< ElementType_<MT> >, size_t >
 // \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
 // \param il The index of the smallest singular value to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of singular values found.
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -226,7 +267,7 @@ template< typename MT    // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline EnableIf_< IsComplex< ElementType_<MT> >, size_t >
    gesvdx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s,
-                   char range, ST vl, ST vu, int il, int iu )
+                   char range, ST vl, ST vu, int il, int iu, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( range == 'A' || range == 'V' || range == 'I', "Invalid range flag detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
@@ -249,24 +290,31 @@ inline EnableIf_< IsComplex< ElementType_<MT> >, size_t >
    int info( 0 );
 
    BT* sptr( (~s).data() );
-   std::unique_ptr<BT[]> stmp;
+   BT* stmp( nullptr );
 
    const bool tmpRequired( (~s).size() < mindim );
 
    if( tmpRequired ) {
-      stmp.reset( new BT[2UL*mindim] );
-      sptr = stmp.get();
+      stmp = ws.get<BT>( 5UL, 2UL*mindim );
+      sptr = stmp;
    }
 
    const int minimum( min( m, n ) );
 
    int lwork( minimum*( minimum*3 + 20 ) + 2 );
-   const std::unique_ptr<CT[]>  work ( new CT[lwork] );
-   const std::unique_ptr<BT[]>  rwork( new BT[17*minimum*minimum] );
-   const std::unique_ptr<int[]> iwork( new int[12*minimum] );
+   BT*  const rwork( ws.get<BT> ( 1UL, 17*minimum*minimum ) );
+   int* const iwork( ws.get<int>( 2UL, 12*minimum ) );
+
+   CT wkopt( 0 );
 
    gesvdx( 'N', 'N', range, m, n, (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
-           nullptr, 1, nullptr, 1, work.get(), lwork, rwork.get(), iwork.get(), &info );
+           nullptr, 1, nullptr, 1, &wkopt, -1, rwork, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
+
+   gesvdx( 'N', 'N', range, m, n, (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
+           nullptr, 1, nullptr, 1, work, lwork, rwork, iwork, &info );
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -346,6 +394,37 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector s
         , bool TF >    // Transpose flag of the vector s
 inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
+{
+   LAPACKWorkspace ws;
+   return gesvdx( A, s, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvdx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector s
+        , bool TF >    // Transpose flag of the vector s
+inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -369,7 +448,7 @@ inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s )
       return 0;
    }
 
-   return gesvdx_backend( ~A, ~s, 'A', UT(), UT(), 0, 0 );
+   return gesvdx_backend( ~A, ~s, 'A', UT(), UT(), 0, 0, ws );
 }
 //*************************************************************************************************
 
@@ -461,6 +540,43 @@ template< typename MT    // Type of the matrix A
         , bool TF        // Transpose flag of the vector s
         , typename ST >  // Type of the scalar boundary values
 inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp )
+{
+   LAPACKWorkspace ws;
+   return gesvdx( A, s, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param low The lower bound of the interval to be searched for singular values.
+// \param upp The upper bound of the interval to be searched for singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvdx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT    // Type of the matrix A
+        , bool SO        // Storage order of the matrix A
+        , typename VT    // Type of the vector s
+        , bool TF        // Transpose flag of the vector s
+        , typename ST >  // Type of the scalar boundary values
+inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST upp,
+                      LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -502,7 +618,7 @@ inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST u
    const int  il   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( low ) );
    const int  iu   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( upp ) );
 
-   const size_t actual( gesvdx_backend( ~A, ~s, range, vl, vu, il, iu ) );
+   const size_t actual( gesvdx_backend( ~A, ~s, range, vl, vu, il, iu, ws ) );
 
    if( IsResizable<VT>::value ) {
       resize( ~s, actual, true );
@@ -526,6 +642,7 @@ inline size_t gesvdx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& s, ST low, ST u
 // \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
 // \param il The index of the smallest singular value to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of singular values found.
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -544,7 +661,7 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
    gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVector<VT,TF>& s,
-                   char range, ST vl, ST vu, int il, int iu )
+                   char range, ST vl, ST vu, int il, int iu, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( range == 'A' || range == 'V' || range == 'I', "Invalid range flag detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
@@ -570,29 +687,39 @@ inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
 
    ET* sptr( (~s).data() );
    ET* uptr( (~U).data() );
-   std::unique_ptr<ET[]> stmp;
-   std::unique_ptr<ET[]> utmp;
+   ET* stmp( nullptr );
+   ET* utmp( nullptr );
 
    const bool tmpRequired( (~s).size() < mindim );
 
    if( tmpRequired ) {
-      stmp.reset( new ET[2UL*mindim] );
-      utmp.reset( new ET[M*mindim] );
-      sptr = stmp.get();
-      uptr = utmp.get();
+      stmp = ws.get<ET>( 5UL, 2UL*mindim );
+      utmp = ws.get<ET>( 6UL, M*mindim );
+      sptr = stmp;
+      uptr = utmp;
    }
 
    const int minimum( min( m, n ) );
 
    int lwork( minimum*( minimum*3 + 20 ) + 2 );
-   const std::unique_ptr<ET[]>  work ( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[12*minimum] );
+   int* const iwork( ws.get<int>( 2UL, 12*minimum ) );
+
+   ET wkopt( 0 );
 
    gesvdx( ( SO ? 'V' : 'N' ), ( SO ? 'N' : 'V' ), range, m, n,
            (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
            ( SO ? uptr : nullptr ), ( tmpRequired ? m : ( SO ? ldu : 1 ) ),
            ( SO ? nullptr : uptr ), ( tmpRequired ? mindim : ( SO ? 1 : ldu ) ),
-           work.get(), lwork, iwork.get(), &info );
+           &wkopt, -1, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   gesvdx( ( SO ? 'V' : 'N' ), ( SO ? 'N' : 'V' ), range, m, n,
+           (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
+           ( SO ? uptr : nullptr ), ( tmpRequired ? m : ( SO ? ldu : 1 ) ),
+           ( SO ? nullptr : uptr ), ( tmpRequired ? mindim : ( SO ? 1 : ldu ) ),
+           work, lwork, iwork, &info );
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -646,6 +773,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
 // \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
 // \param il The index of the smallest singular value to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of singular values found.
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -664,7 +792,7 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline EnableIf_< IsComplex< ElementType_<MT1> >, size_t >
    gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVector<VT,TF>& s,
-                   char range, ST vl, ST vu, int il, int iu )
+                   char range, ST vl, ST vu, int il, int iu, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( range == 'A' || range == 'V' || range == 'I', "Invalid range flag detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
@@ -691,30 +819,40 @@ inline EnableIf_< IsComplex< ElementType_<MT1> >, size_t >
 
    BT* sptr( (~s).data() );
    CT* uptr( (~U).data() );
-   std::unique_ptr<BT[]> stmp;
-   std::unique_ptr<CT[]> utmp;
+   BT* stmp( nullptr );
+   CT* utmp( nullptr );
 
    const bool tmpRequired( (~s).size() < mindim );
 
    if( tmpRequired ) {
-      stmp.reset( new BT[2UL*mindim] );
-      utmp.reset( new CT[M*mindim] );
-      sptr = stmp.get();
-      uptr = utmp.get();
+      stmp = ws.get<BT>( 5UL, 2UL*mindim );
+      utmp = ws.get<CT>( 6UL, M*mindim );
+      sptr = stmp;
+      uptr = utmp;
    }
 
    const int minimum( min( m, n ) );
 
    int lwork( minimum*( minimum*3 + 20 ) + 2 );
-   const std::unique_ptr<CT[]>  work ( new CT[lwork] );
-   const std::unique_ptr<BT[]>  rwork( new BT[17*minimum*minimum] );
-   const std::unique_ptr<int[]> iwork( new int[12*minimum] );
+   BT*  const rwork( ws.get<BT> ( 1UL, 17*minimum*minimum ) );
+   int* const iwork( ws.get<int>( 2UL, 12*minimum ) );
+
+   CT wkopt( 0 );
 
    gesvdx( ( SO ? 'V' : 'N' ), ( SO ? 'N' : 'V' ), range, m, n,
            (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
            ( SO ? uptr : nullptr ), ( tmpRequired ? m : ( SO ? ldu : 1 ) ),
            ( SO ? nullptr : uptr ), ( tmpRequired ? mindim : ( SO ? 1 : ldu ) ),
-           work.get(), lwork, rwork.get(), iwork.get(), &info );
+           &wkopt, -1, rwork, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
+
+   gesvdx( ( SO ? 'V' : 'N' ), ( SO ? 'N' : 'V' ), range, m, n,
+           (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
+           ( SO ? uptr : nullptr ), ( tmpRequired ? m : ( SO ? ldu : 1 ) ),
+           ( SO ? nullptr : uptr ), ( tmpRequired ? mindim : ( SO ? 1 : ldu ) ),
+           work, lwork, rwork, iwork, &info );
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -818,6 +956,41 @@ template< typename MT1    // Type of the matrix A
         , typename VT     // Type of the vector s
         , bool TF >       // Transpose flag of the vector s
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVector<VT,TF>& s )
+{
+   LAPACKWorkspace ws;
+   return gesvdx( A, U, s, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvdx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename MT2    // Type of the matrix U
+        , typename VT     // Type of the vector s
+        , bool TF >       // Transpose flag of the vector s
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVector<VT,TF>& s,
+                      LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -847,7 +1020,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVecto
       return 0;
    }
 
-   return gesvdx_backend( ~A, ~U, ~s, 'A', UT(), UT(), 0, 0 );
+   return gesvdx_backend( ~A, ~U, ~s, 'A', UT(), UT(), 0, 0, ws );
 }
 //*************************************************************************************************
 
@@ -950,6 +1123,46 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                       DenseVector<VT,TF>& s, ST low, ST upp )
+{
+   LAPACKWorkspace ws;
+   return gesvdx( A, U, s, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param low The lower bound of the interval to be searched for singular values.
+// \param upp The upper bound of the interval to be searched for singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvdx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1   // Type of the matrix A
+        , bool SO        // Storage order of all matrices
+        , typename MT2   // Type of the matrix U
+        , typename VT    // Type of the vector s
+        , bool TF        // Transpose flag of the vector s
+        , typename ST >  // Type of the scalar boundary values
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, ST low, ST upp, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -997,7 +1210,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    const int  il   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( low ) );
    const int  iu   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( upp ) );
 
-   const size_t actual( gesvdx_backend( ~A, ~U, ~s, range, vl, vu, il, iu ) );
+   const size_t actual( gesvdx_backend( ~A, ~U, ~s, range, vl, vu, il, iu, ws ) );
 
    if( IsResizable<VT>::value ) {
       resize( ~s, actual, true );
@@ -1025,6 +1238,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
 // \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
 // \param il The index of the smallest singular value to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of singular values found.
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -1043,7 +1257,7 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
    gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, DenseMatrix<MT2,SO>& V,
-                   char range, ST vl, ST vu, int il, int iu )
+                   char range, ST vl, ST vu, int il, int iu, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( range == 'A' || range == 'V' || range == 'I', "Invalid range flag detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
@@ -1069,29 +1283,39 @@ inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
 
    ET* sptr( (~s).data() );
    ET* vptr( (~V).data() );
-   std::unique_ptr<ET[]> stmp;
-   std::unique_ptr<ET[]> vtmp;
+   ET* stmp( nullptr );
+   ET* vtmp( nullptr );
 
    const bool tmpRequired( (~s).size() < mindim );
 
    if( tmpRequired ) {
-      stmp.reset( new ET[2UL*mindim] );
-      vtmp.reset( new ET[mindim*N] );
-      sptr = stmp.get();
-      vptr = vtmp.get();
+      stmp = ws.get<ET>( 5UL, 2UL*mindim );
+      vtmp = ws.get<ET>( 7UL, mindim*N );
+      sptr = stmp;
+      vptr = vtmp;
    }
 
    const int minimum( min( m, n ) );
 
    int lwork( minimum*( minimum*3 + 20 ) + 2 );
-   const std::unique_ptr<ET[]>  work ( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[12*minimum] );
+   int* const iwork( ws.get<int>( 2UL, 12*minimum ) );
+
+   ET wkopt( 0 );
+
+   gesvdx( ( SO ? 'N' : 'V' ), ( SO ? 'V' : 'N' ), range, m, n,
+           (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
+           ( SO ? nullptr : vptr ), ( tmpRequired ? m : ( SO ? 1 : ldv ) ),
+           ( SO ? vptr : nullptr ), ( tmpRequired ? mindim : ( SO ? ldv : 1 ) ),
+           &wkopt, -1, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
 
    gesvdx( ( SO ? 'N' : 'V' ), ( SO ? 'V' : 'N' ), range, m, n,
            (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
            ( SO ? nullptr : vptr ), ( tmpRequired ? m : ( SO ? 1 : ldv ) ),
            ( SO ? vptr : nullptr ), ( tmpRequired ? mindim : ( SO ? ldv : 1 ) ),
-           work.get(), lwork, iwork.get(), &info );
+           work, lwork, iwork, &info );
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -1145,6 +1369,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
 // \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
 // \param il The index of the smallest singular value to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of singular values found.
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -1163,7 +1388,7 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline EnableIf_< IsComplex< ElementType_<MT1> >, size_t >
    gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, DenseMatrix<MT2,SO>& V,
-                   char range, ST vl, ST vu, int il, int iu )
+                   char range, ST vl, ST vu, int il, int iu, LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( range == 'A' || range == 'V' || range == 'I', "Invalid range flag detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
@@ -1190,30 +1415,40 @@ inline EnableIf_< IsComplex< ElementType_<MT1> >, size_t >
 
    BT* sptr( (~s).data() );
    CT* vptr( (~V).data() );
-   std::unique_ptr<BT[]> stmp;
-   std::unique_ptr<CT[]> vtmp;
+   BT* stmp( nullptr );
+   CT* vtmp( nullptr );
 
    const bool tmpRequired( (~s).size() < mindim );
 
    if( tmpRequired ) {
-      stmp.reset( new BT[2UL*mindim] );
-      vtmp.reset( new CT[mindim*N] );
-      sptr = stmp.get();
-      vptr = vtmp.get();
+      stmp = ws.get<BT>( 5UL, 2UL*mindim );
+      vtmp = ws.get<CT>( 7UL, mindim*N );
+      sptr = stmp;
+      vptr = vtmp;
    }
 
    const int minimum( min( m, n ) );
 
    int lwork( minimum*( minimum*3 + 20 ) + 2 );
-   const std::unique_ptr<CT[]>  work ( new CT[lwork] );
-   const std::unique_ptr<BT[]>  rwork( new BT[17*minimum*minimum] );
-   const std::unique_ptr<int[]> iwork( new int[12*minimum] );
+   BT*  const rwork( ws.get<BT> ( 1UL, 17*minimum*minimum ) );
+   int* const iwork( ws.get<int>( 2UL, 12*minimum ) );
+
+   CT wkopt( 0 );
 
    gesvdx( ( SO ? 'N' : 'V' ), ( SO ? 'V' : 'N' ), range, m, n,
            (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
            ( SO ? nullptr : vptr ), ( tmpRequired ? m : ( SO ? 1 : ldv ) ),
            ( SO ? vptr : nullptr ), ( tmpRequired ? mindim : ( SO ? ldv : 1 ) ),
-           work.get(), lwork, rwork.get(), iwork.get(), &info );
+           &wkopt, -1, rwork, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
+
+   gesvdx( ( SO ? 'N' : 'V' ), ( SO ? 'V' : 'N' ), range, m, n,
+           (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
+           ( SO ? nullptr : vptr ), ( tmpRequired ? m : ( SO ? 1 : ldv ) ),
+           ( SO ? vptr : nullptr ), ( tmpRequired ? mindim : ( SO ? ldv : 1 ) ),
+           work, lwork, rwork, iwork, &info );
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -1317,6 +1552,41 @@ template< typename MT1    // Type of the matrix A
         , bool TF         // Transpose flag of the vector s
         , typename MT2 >  // Type of the matrix V
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, DenseMatrix<MT2,SO>& V )
+{
+   LAPACKWorkspace ws;
+   return gesvdx( A, s, V, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvdx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT2 >  // Type of the matrix V
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, DenseMatrix<MT2,SO>& V,
+                      LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -1346,7 +1616,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s, DenseMatrix
       return 0;
    }
 
-   return gesvdx_backend( ~A, ~s, ~V, 'A', UT(), UT(), 0, 0 );
+   return gesvdx_backend( ~A, ~s, ~V, 'A', UT(), UT(), 0, 0, ws );
 }
 //*************************************************************************************************
 
@@ -1449,6 +1719,46 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
                       DenseMatrix<MT2,SO>& V, ST low, ST upp )
+{
+   LAPACKWorkspace ws;
+   return gesvdx( A, s, V, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param low The lower bound of the interval to be searched for singular values.
+// \param upp The upper bound of the interval to be searched for singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvdx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1   // Type of the matrix A
+        , bool SO        // Storage order of all matrices
+        , typename VT    // Type of the vector s
+        , bool TF        // Transpose flag of the vector s
+        , typename MT2   // Type of the matrix V
+        , typename ST >  // Type of the scalar boundary values
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
+                      DenseMatrix<MT2,SO>& V, ST low, ST upp, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -1496,7 +1806,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
    const int  il   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( low ) );
    const int  iu   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( upp ) );
 
-   const size_t actual( gesvdx_backend( ~A, ~s, ~V, range, vl, vu, il, iu ) );
+   const size_t actual( gesvdx_backend( ~A, ~s, ~V, range, vl, vu, il, iu, ws ) );
 
    if( IsResizable<VT>::value ) {
       resize( ~s, actual, true );
@@ -1525,6 +1835,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseVector<VT,TF>& s,
 // \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
 // \param il The index of the smallest singular value to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of singular values found.
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -1544,7 +1855,8 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
    gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVector<VT,TF>& s,
-                   DenseMatrix<MT3,SO>& V, char range, ST vl, ST vu, int il, int iu )
+                   DenseMatrix<MT3,SO>& V, char range, ST vl, ST vu, int il, int iu,
+                   LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( range == 'A' || range == 'V' || range == 'I', "Invalid range flag detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
@@ -1574,31 +1886,40 @@ inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
    ET* sptr( (~s).data() );
    ET* uptr( (~U).data() );
    ET* vptr( (~V).data() );
-   std::unique_ptr<ET[]> stmp;
-   std::unique_ptr<ET[]> utmp;
-   std::unique_ptr<ET[]> vtmp;
+   ET* stmp( nullptr );
+   ET* utmp( nullptr );
+   ET* vtmp( nullptr );
 
    const bool tmpRequired( (~s).size() < mindim );
 
    if( tmpRequired ) {
-      stmp.reset( new ET[2UL*mindim] );
-      utmp.reset( new ET[M*mindim] );
-      vtmp.reset( new ET[mindim*N] );
-      sptr = stmp.get();
-      uptr = utmp.get();
-      vptr = vtmp.get();
+      stmp = ws.get<ET>( 5UL, 2UL*mindim );
+      utmp = ws.get<ET>( 6UL, M*mindim );
+      vtmp = ws.get<ET>( 7UL, mindim*N );
+      sptr = stmp;
+      uptr = utmp;
+      vptr = vtmp;
    }
 
    const int minimum( min( m, n ) );
 
    int lwork( minimum*( minimum*3 + 20 ) + 2 );
-   const std::unique_ptr<ET[]>  work ( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[12*minimum] );
+   int* const iwork( ws.get<int>( 2UL, 12*minimum ) );
+
+   ET wkopt( 0 );
 
    gesvdx( 'V', 'V', range, m, n, (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
            ( SO ? uptr : vptr ), ( tmpRequired ? m : ( SO ? ldu : ldv ) ),
            ( SO ? vptr : uptr ), ( tmpRequired ? mindim : ( SO ? ldv : ldu ) ),
-           work.get(), lwork, iwork.get(), &info );
+           &wkopt, -1, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   gesvdx( 'V', 'V', range, m, n, (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
+           ( SO ? uptr : vptr ), ( tmpRequired ? m : ( SO ? ldu : ldv ) ),
+           ( SO ? vptr : uptr ), ( tmpRequired ? mindim : ( SO ? ldv : ldu ) ),
+           work, lwork, iwork, &info );
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -1665,6 +1986,7 @@ inline DisableIf_< IsComplex< ElementType_<MT1> >, size_t >
 // \param vu The upper bound of the interval to be searched for singular values (\a vl < \a vu).
 // \param il The index of the smallest singular value to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest singular value to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of singular values found.
 // \exception std::runtime_error Singular value decomposition failed.
 //
@@ -1684,7 +2006,8 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline EnableIf_< IsComplex< ElementType_<MT1> >, size_t >
    gesvdx_backend( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U, DenseVector<VT,TF>& s,
-                   DenseMatrix<MT3,SO>& V, char range, ST vl, ST vu, int il, int iu )
+                   DenseMatrix<MT3,SO>& V, char range, ST vl, ST vu, int il, int iu,
+                   LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( range == 'A' || range == 'V' || range == 'I', "Invalid range flag detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~s).size() == min( (~A).rows(), (~A).columns() ), "Invalid vector dimension detected" );
@@ -1715,32 +2038,41 @@ inline EnableIf_< IsComplex< ElementType_<MT1> >, size_t >
    BT* sptr( (~s).data() );
    CT* uptr( (~U).data() );
    CT* vptr( (~V).data() );
-   std::unique_ptr<BT[]> stmp;
-   std::unique_ptr<CT[]> utmp;
-   std::unique_ptr<CT[]> vtmp;
+   BT* stmp( nullptr );
+   CT* utmp( nullptr );
+   CT* vtmp( nullptr );
 
    const bool tmpRequired( (~s).size() < mindim );
 
    if( tmpRequired ) {
-      stmp.reset( new BT[2UL*mindim] );
-      utmp.reset( new CT[M*mindim] );
-      vtmp.reset( new CT[mindim*N] );
-      sptr = stmp.get();
-      uptr = utmp.get();
-      vptr = vtmp.get();
+      stmp = ws.get<BT>( 5UL, 2UL*mindim );
+      utmp = ws.get<CT>( 6UL, M*mindim );
+      vtmp = ws.get<CT>( 7UL, mindim*N );
+      sptr = stmp;
+      uptr = utmp;
+      vptr = vtmp;
    }
 
    const int minimum( min( m, n ) );
 
    int lwork( minimum*( minimum*3 + 20 ) + 2 );
-   const std::unique_ptr<CT[]>  work ( new CT[lwork] );
-   const std::unique_ptr<BT[]>  rwork( new BT[17*minimum*minimum] );
-   const std::unique_ptr<int[]> iwork( new int[12*minimum] );
+   BT*  const rwork( ws.get<BT> ( 1UL, 17*minimum*minimum ) );
+   int* const iwork( ws.get<int>( 2UL, 12*minimum ) );
+
+   CT wkopt( 0 );
 
    gesvdx( 'V', 'V', range, m, n, (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
            ( SO ? uptr : vptr ), ( tmpRequired ? m : ( SO ? ldu : ldv ) ),
            ( SO ? vptr : uptr ), ( tmpRequired ? mindim : ( SO ? ldv : ldu ) ),
-           work.get(), lwork, rwork.get(), iwork.get(), &info );
+           &wkopt, -1, rwork, iwork, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   CT* const work( ws.get<CT>( 0UL, lwork ) );
+
+   gesvdx( 'V', 'V', range, m, n, (~A).data(), lda, vl, vu, il, iu, &ns, sptr,
+           ( SO ? uptr : vptr ), ( tmpRequired ? m : ( SO ? ldu : ldv ) ),
+           ( SO ? vptr : uptr ), ( tmpRequired ? mindim : ( SO ? ldv : ldu ) ),
+           work, lwork, rwork, iwork, &info );
 
    const size_t num( numeric_cast<size_t>( ns ) );
 
@@ -1862,6 +2194,43 @@ template< typename MT1    // Type of the matrix A
         , typename MT3 >  // Type of the matrix V
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                       DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V )
+{
+   LAPACKWorkspace ws;
+   return gesvdx( A, U, s, V, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvdx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1    // Type of the matrix A
+        , bool SO         // Storage order of all matrices
+        , typename MT2    // Type of the matrix U
+        , typename VT     // Type of the vector s
+        , bool TF         // Transpose flag of the vector s
+        , typename MT3 >  // Type of the matrix V
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -1897,7 +2266,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
       return 0;
    }
 
-   return gesvdx_backend( ~A, ~U, ~s, ~V, 'A', UT(), UT(), 0, 0 );
+   return gesvdx_backend( ~A, ~U, ~s, ~V, 'A', UT(), UT(), 0, 0, ws );
 }
 //*************************************************************************************************
 
@@ -2008,6 +2377,49 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
                       DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp )
+{
+   LAPACKWorkspace ws;
+   return gesvdx( A, U, s, V, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the singular value decomposition (SVD) of the given dense general matrix.
+// \ingroup lapack_singular_value
+//
+// \param A The given general matrix.
+// \param U The resulting matrix of left singular vectors.
+// \param s The resulting vector of singular values.
+// \param V The resulting matrix of right singular vectors.
+// \param low The lower bound of the interval to be searched for singular values.
+// \param upp The upper bound of the interval to be searched for singular values.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of singular values found.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Singular value decomposition failed.
+//
+// This function is identical to the according gesvdx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1   // Type of the matrix A
+        , bool SO        // Storage order of all matrices
+        , typename MT2   // Type of the matrix U
+        , typename VT    // Type of the vector s
+        , bool TF        // Transpose flag of the vector s
+        , typename MT3   // Type of the matrix V
+        , typename ST >  // Type of the scalar boundary values
+inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
+                      DenseVector<VT,TF>& s, DenseMatrix<MT3,SO>& V, ST low, ST upp,
+                      LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -2061,7 +2473,7 @@ inline size_t gesvdx( DenseMatrix<MT1,SO>& A, DenseMatrix<MT2,SO>& U,
    const int  il   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( low ) );
    const int  iu   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( upp ) );
 
-   const size_t actual( gesvdx_backend( ~A, ~U, ~s, ~V, range, vl, vu, il, iu ) );
+   const size_t actual( gesvdx_backend( ~A, ~U, ~s, ~V, range, vl, vu, il, iu, ws ) );
 
    if( IsResizable<VT>::value ) {
       resize( ~s, actual, true );
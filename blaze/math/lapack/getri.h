@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -49,6 +48,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/getri.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 
@@ -66,6 +66,9 @@ namespace blaze {
 //@{
 template< typename MT, bool SO >
 inline void getri( DenseMatrix<MT,SO>& A, const int* ipiv );
+
+template< typename MT, bool SO >
+inline void getri( DenseMatrix<MT,SO>& A, const int* ipiv, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -108,6 +111,35 @@ inline void getri( DenseMatrix<MT,SO>& A, const int* ipiv );
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
 inline void getri( DenseMatrix<MT,SO>& A, const int* ipiv )
+{
+   LAPACKWorkspace ws;
+   getri( A, ipiv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the inversion of the given dense general matrix.
+// \ingroup lapack_inversion
+//
+// \param A The matrix to be inverted.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is identical to the according getri() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void getri( DenseMatrix<MT,SO>& A, const int* ipiv, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -128,10 +160,15 @@ inline void getri( DenseMatrix<MT,SO>& A, const int* ipiv )
       return;
    }
 
-   int lwork( n*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   getri( n, (~A).data(), lda, ipiv, &wkopt, lwork, &info );
+
+   lwork = optimalWorkspace( wkopt, n );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
 
-   getri( n, (~A).data(), lda, ipiv, work.get(), lwork, &info );
+   getri( n, (~A).data(), lda, ipiv, work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix inversion" );
 
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -50,6 +49,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/heevd.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
@@ -70,6 +70,10 @@ namespace blaze {
 //@{
 template< typename MT, bool SO, typename VT, bool TF >
 inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo );
+
+template< typename MT, bool SO, typename VT, bool TF >
+inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo,
+                   LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -138,6 +142,43 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo )
+{
+   LAPACKWorkspace ws;
+   heevd( A, w, jobz, uplo, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense Hermitian matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given Hermitian matrix.
+// \param w The resulting vector of eigenvalues.
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according heevd() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo,
+                   LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -175,21 +216,30 @@ inline void heevd( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char
       return;
    }
 
-   int lwork( n*n + 2*n + 2 );
-   const std::unique_ptr<CT[]> work( new CT[lwork] );
-
-   int lrwork( 1 + 5*n + 2*n*n );
-   const std::unique_ptr<BT[]> rwork( new BT[lrwork] );
-
-   int liwork( 3 + 5*n );
-   const std::unique_ptr<int[]> iwork( new int[liwork] );
-
    if( IsRowMajorMatrix<MT>::value ) {
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
+   CT wkopt( 0 );
+   BT rwkopt( 0 );
+   int iwkopt( 0 );
+   int lwork( -1 );
+   int lrwork( -1 );
+   int liwork( -1 );
+
+   heevd( jobz, uplo, n, (~A).data(), lda, (~w).data(),
+          &wkopt, lwork, &rwkopt, lrwork, &iwkopt, liwork, &info );
+
+   lwork  = optimalWorkspace( wkopt , ( jobz == 'V' )?( n*n + 2*n ):( n + 1 ) );
+   lrwork = optimalWorkspace( rwkopt, ( jobz == 'V' )?( 1 + 5*n + 2*n*n ):( n ) );
+   liwork = ( iwkopt > 3 + 5*n )?( iwkopt ):( 3 + 5*n );
+
+   CT*  const work ( ws.get<CT> ( 0UL, lwork  ) );
+   BT*  const rwork( ws.get<BT> ( 1UL, lrwork ) );
+   int* const iwork( ws.get<int>( 2UL, liwork ) );
+
    heevd( jobz, uplo, n, (~A).data(), lda, (~w).data(),
-          work.get(), lwork, rwork.get(), lrwork, iwork.get(), liwork, &info );
+          work, lwork, rwork, lrwork, iwork, liwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -49,6 +48,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/hesv.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/SameType.h>
@@ -69,8 +69,16 @@ namespace blaze {
 template< typename MT, bool SO, typename VT, bool TF >
 inline void hesv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo, int* ipiv );
 
+template< typename MT, bool SO, typename VT, bool TF >
+inline void hesv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo, int* ipiv,
+                  LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline void hesv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, char uplo, int* ipiv );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void hesv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B, char uplo, int* ipiv,
+                  LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -139,6 +147,42 @@ template< typename MT  // Type of the system matrix
         , typename VT  // Type of the right-hand side vector
         , bool TF >    // Transpose flag of the right-hand side vector
 inline void hesv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo, int* ipiv )
+{
+   LAPACKWorkspace ws;
+   hesv( A, b, uplo, ipiv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a Hermitian indefinite linear system of equations (\f$ A*x=b \f$).
+// \ingroup lapack_solver
+//
+// \param A The column-major system matrix.
+// \param b The right-hand side vector.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is identical to the according hesv() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename VT  // Type of the right-hand side vector
+        , bool TF >    // Transpose flag of the right-hand side vector
+inline void hesv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo, int* ipiv,
+                  LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -176,10 +220,15 @@ inline void hesv( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& b, char uplo, int*
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
-   int lwork( n*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   hesv( uplo, n, nrhs, (~A).data(), lda, ipiv, (~b).data(), ldb, &wkopt, lwork, &info );
 
-   hesv( uplo, n, nrhs, (~A).data(), lda, ipiv, (~b).data(), ldb, work.get(), lwork, &info );
+   lwork = optimalWorkspace( wkopt, 1 );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   hesv( uplo, n, nrhs, (~A).data(), lda, ipiv, (~b).data(), ldb, work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
 
@@ -259,6 +308,42 @@ template< typename MT1  // Type of the system matrix
         , bool SO2 >    // Storage order of the right-hand side matrix
 inline void hesv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B,
                   char uplo, int* ipiv )
+{
+   LAPACKWorkspace ws;
+   hesv( A, B, uplo, ipiv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for solving a Hermitian indefinite linear system of equations (\f$ A*X=B \f$).
+// \ingroup lapack_solver
+//
+// \param A The system matrix.
+// \param B The matrix of right-hand sides.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is identical to the according hesv() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void hesv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B,
+                  char uplo, int* ipiv, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT2 );
@@ -298,10 +383,15 @@ inline void hesv( DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& B,
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
-   int lwork( n*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   hesv( uplo, n, nrhs, (~A).data(), lda, ipiv, (~B).data(), ldb, &wkopt, lwork, &info );
+
+   lwork = optimalWorkspace( wkopt, 1 );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
 
-   hesv( uplo, n, nrhs, (~A).data(), lda, ipiv, (~B).data(), ldb, work.get(), lwork, &info );
+   hesv( uplo, n, nrhs, (~A).data(), lda, ipiv, (~B).data(), ldb, work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid function argument" );
 
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -49,6 +48,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/hetri.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
@@ -68,6 +68,9 @@ namespace blaze {
 //@{
 template< typename MT, bool SO >
 inline void hetri( DenseMatrix<MT,SO>& A, char uplo, const int* ipiv );
+
+template< typename MT, bool SO >
+inline void hetri( DenseMatrix<MT,SO>& A, char uplo, const int* ipiv, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -113,6 +116,37 @@ inline void hetri( DenseMatrix<MT,SO>& A, char uplo, const int* ipiv );
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
 inline void hetri( DenseMatrix<MT,SO>& A, char uplo, const int* ipiv )
+{
+   LAPACKWorkspace ws;
+   hetri( A, uplo, ipiv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the inversion of the given dense Hermitian indefinite matrix.
+// \ingroup lapack_inversion
+//
+// \param A The triangular matrix to be inverted.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is identical to the according hetri() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void hetri( DenseMatrix<MT,SO>& A, char uplo, const int* ipiv, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -141,9 +175,9 @@ inline void hetri( DenseMatrix<MT,SO>& A, char uplo, const int* ipiv )
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
-   const std::unique_ptr<ET[]> work( new ET[n] );
+   ET* const work( ws.get<ET>( 0UL, n ) );
 
-   hetri( uplo, n, (~A).data(), lda, ipiv, work.get(), &info );
+   hetri( uplo, n, (~A).data(), lda, ipiv, work, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix inversion" );
 
@@ -0,0 +1,206 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/getrf.h
+//  \brief Header file for the native LU decomposition kernels (getrf)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GETRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GETRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU DECOMPOSITION KERNELS (GETRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Interchanges rows of a column-major matrix according to the given pivot indices.
+// \ingroup lapack
+//
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of \a A.
+// \param jbegin The index of the first column to be processed.
+// \param jend The index one past the last column to be processed.
+// \param k1 The index of the first pivot index to be applied.
+// \param k2 The index one past the last pivot index to be applied.
+// \param ipiv The 1-based pivot indices.
+// \param forward \a true to apply the interchanges in order, \a false to apply them in reverse order.
+// \return void
+//
+// This function is the native Blaze equivalent of the LAPACK laswp() functions.
+*/
+template< typename T >  // Type of the matrix elements
+void laswp_native( T* A, size_t lda, size_t jbegin, size_t jend,
+                   size_t k1, size_t k2, const int* ipiv, bool forward )
+{
+   for( size_t j=jbegin; j<jend; ++j ) {
+      T* const col( A + j*lda );
+      for( size_t kk=k1; kk<k2; ++kk ) {
+         const size_t k( forward ? kk : k2-kk+k1-1UL );
+         const size_t p( static_cast<size_t>( ipiv[k]-1 ) );
+         if( p != k ) {
+            std::swap( col[k], col[p] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native kernel for the LU decomposition of a general column-major matrix.
+// \ingroup lapack
+//
+// \param m The number of rows of the given matrix \f$[0..\infty)\f$.
+// \param n The number of columns of the given matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native Blaze equivalent of the LAPACK getrf() functions. It computes the
+// LU decomposition \f$ A = P \cdot L \cdot U \f$ with partial pivoting by means of a blocked,
+// right-looking algorithm: Each panel of LAPACK_BLOCK_SIZE columns is factorized by an unblocked
+// algorithm, the according block row of \c U is computed via a triangular solve and the trailing
+// submatrix is updated by the vectorized and parallelized dense matrix multiplication kernels of
+// Blaze. The result, the 1-based pivot indices and the \a info value match the LAPACK getrf()
+// functions.
+*/
+template< typename T >  // Type of the matrix elements
+void getrf_native( int m, int n, T* A, int lda, int* ipiv, int* info )
+{
+   using MT = CustomMatrix<T,unaligned,unpadded,columnMajor>;
+
+   *info = 0;
+
+   const size_t M ( m );
+   const size_t N ( n );
+   const size_t LD( lda );
+   const size_t mindim( min( M, N ) );
+
+   for( size_t j=0UL; j<mindim; j+=LAPACK_BLOCK_SIZE )
+   {
+      const size_t jb( min( LAPACK_BLOCK_SIZE, mindim-j ) );
+
+      // Unblocked factorization of the current panel A(j:M,j:j+jb)
+      for( size_t jj=j; jj<j+jb; ++jj )
+      {
+         T* const col( A + jj*LD );
+
+         size_t p( jj );
+         auto pmax( abs( col[jj] ) );
+         for( size_t i=jj+1UL; i<M; ++i ) {
+            if( abs( col[i] ) > pmax ) {
+               pmax = abs( col[i] );
+               p = i;
+            }
+         }
+
+         ipiv[jj] = static_cast<int>( p+1UL );
+
+         if( !isDefault( col[p] ) )
+         {
+            if( p != jj ) {
+               for( size_t k=j; k<j+jb; ++k ) {
+                  std::swap( A[jj+k*LD], A[p+k*LD] );
+               }
+            }
+
+            const T pivot( col[jj] );
+            for( size_t i=jj+1UL; i<M; ++i ) {
+               col[i] /= pivot;
+            }
+         }
+         else if( *info == 0 ) {
+            *info = static_cast<int>( jj+1UL );
+         }
+
+         for( size_t k=jj+1UL; k<j+jb; ++k ) {
+            T* const colk( A + k*LD );
+            const T tmp( colk[jj] );
+            for( size_t i=jj+1UL; i<M; ++i ) {
+               colk[i] -= col[i] * tmp;
+            }
+         }
+      }
+
+      // Application of the row interchanges to the columns left and right of the panel
+      laswp_native( A, LD, 0UL, j, j, j+jb, ipiv, true );
+      laswp_native( A, LD, j+jb, N, j, j+jb, ipiv, true );
+
+      if( j+jb < N )
+      {
+         // Computation of the block row of U: A(j:j+jb,j+jb:N) = L11^-1 * A(j:j+jb,j+jb:N)
+         trsmKernel<columnMajor,columnMajor>( true, true, false, jb, N-j-jb,
+                                              A+j+j*LD, LD, A+j+(j+jb)*LD, LD );
+
+         // Update of the trailing submatrix: A22 -= A21 * A12
+         if( j+jb < M ) {
+            MT       A22( nativeBlock<columnMajor>( A, LD, j+jb, j+jb, M-j-jb, N-j-jb ) );
+            const MT A21( nativeBlock<columnMajor>( A, LD, j+jb, j   , M-j-jb, jb     ) );
+            const MT A12( nativeBlock<columnMajor>( A, LD, j   , j+jb, jb    , N-j-jb ) );
+            A22 -= A21 * A12;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
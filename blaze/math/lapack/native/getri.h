@@ -0,0 +1,153 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/getri.h
+//  \brief Header file for the native LU-based inversion kernels (getri)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_GETRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_GETRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/math/lapack/native/trtri.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE LU-BASED INVERSION KERNELS (GETRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native kernel for the inversion of a general LU decomposed column-major matrix.
+// \ingroup lapack
+//
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the LU decomposed column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param work Auxiliary array; size >= max( 1, \a lwork ).
+// \param lwork The dimension of the array \a work; size >= max( 1, \a n ).
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native Blaze equivalent of the LAPACK getri() functions. After the
+// inversion of \c U the system \f$ A^{-1} \cdot L = U^{-1} \f$ is solved block column by
+// block column, starting with the last block column. The strictly lower part of each block
+// column of \c L is saved in the workspace, which is used as a column-major matrix with \a n
+// rows. The column interchanges of the pivoting are finally applied in reverse order. In case
+// \a lwork is -1, a workspace query is assumed and the optimal workspace size is returned in
+// the first element of \a work.
+*/
+template< typename T >  // Type of the matrix elements
+void getri_native( int n, T* A, int lda, const int* ipiv, T* work, int lwork, int* info )
+{
+   using MT = CustomMatrix<T,unaligned,unpadded,columnMajor>;
+
+   *info = 0;
+
+   if( lwork == -1 ) {
+      work[0] = T( max( n, 1 ) * static_cast<int>( LAPACK_BLOCK_SIZE ) );
+      return;
+   }
+
+   if( n <= 0 ) {
+      return;
+   }
+
+   trtri_native( 'U', 'N', n, A, lda, info );
+
+   if( *info != 0 ) {
+      return;
+   }
+
+   const size_t N ( n );
+   const size_t LD( lda );
+   const size_t NB( max( min( LAPACK_BLOCK_SIZE, static_cast<size_t>( lwork ) / N ), size_t(1) ) );
+
+   for( size_t jj=0UL; jj<N; jj+=NB )
+   {
+      const size_t j ( ( ( N-1UL ) / NB ) * NB - jj );
+      const size_t jb( min( NB, N-j ) );
+
+      // Saving and zeroing of the strictly lower part of the current block column of L
+      for( size_t c=0UL; c<jb; ++c ) {
+         for( size_t i=j+c+1UL; i<N; ++i ) {
+            work[i+c*N] = A[i+(j+c)*LD];
+            A[i+(j+c)*LD] = T(0);
+         }
+      }
+
+      // Computation of the current block column of the inverse
+      if( j+jb < N ) {
+         MT       X1( nativeBlock<columnMajor>( A, LD, 0UL, j, N, jb ) );
+         const MT X2( nativeBlock<columnMajor>( A, LD, 0UL, j+jb, N, N-j-jb ) );
+         const MT W2( nativeBlock<columnMajor>( work, N, j+jb, 0UL, N-j-jb, jb ) );
+         X1 -= X2 * W2;
+      }
+
+      trsm_native( 'R', 'L', 'N', 'U', n, static_cast<int>( jb ), work+j, n, A+j*LD, lda );
+   }
+
+   // Application of the column interchanges
+   for( size_t jj=1UL; jj<N; ++jj ) {
+      const size_t j( N-jj-1UL );
+      const size_t p( static_cast<size_t>( ipiv[j]-1 ) );
+      if( p != j ) {
+         for( size_t i=0UL; i<N; ++i ) {
+            std::swap( A[i+j*LD], A[i+p*LD] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
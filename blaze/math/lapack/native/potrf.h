@@ -0,0 +1,201 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potrf.h
+//  \brief Header file for the native Cholesky decomposition kernels (potrf)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRF_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRF_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY DECOMPOSITION KERNELS (POTRF)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked kernel for the Cholesky decomposition of a lower positive definite matrix.
+// \ingroup lapack
+//
+// \param n The number of rows/columns of the matrix \a A.
+// \param A Pointer to the first element of the matrix.
+// \param lda The total number of elements between two rows/columns of \a A.
+// \return 0 in case of success, the 1-based index of the first non-positive pivot otherwise.
+//
+// This function computes the Cholesky decomposition \f$ A = L \cdot L^H \f$ of the Hermitian
+// positive definite matrix \a A, whose lower part is given in the array \a A. The storage order
+// \a SO specifies how the array is interpreted (i.e. the upper part of a column-major matrix is
+// processed via the row-major interpretation). The decomposition is computed by a blocked,
+// right-looking algorithm: The diagonal block is factorized by an unblocked algorithm, the
+// block column below is computed by a triangular solve and the lower part of the trailing
+// submatrix is updated block column by block column by means of the Blaze dense matrix
+// multiplication kernels. The strictly upper part of \a A is not referenced.
+*/
+template< bool SO        // Storage order of the matrix
+        , typename T >   // Type of the matrix elements
+int potrfKernel( size_t n, T* A, size_t lda )
+{
+   using RT = UnderlyingElement_<T>;
+   using MT = CustomMatrix<T,unaligned,unpadded,SO>;
+
+   using blaze::real;
+
+   for( size_t j=0UL; j<n; j+=LAPACK_BLOCK_SIZE )
+   {
+      const size_t jb( min( LAPACK_BLOCK_SIZE, n-j ) );
+
+      // Unblocked factorization of the diagonal block A(j:j+jb,j:j+jb)
+      for( size_t jj=j; jj<j+jb; ++jj )
+      {
+         RT d( real( nativeElement<SO>( A, lda, jj, jj ) ) );
+         for( size_t k=j; k<jj; ++k ) {
+            const T& ajk( nativeElement<SO>( A, lda, jj, k ) );
+            d -= real( ajk * conj( ajk ) );
+         }
+
+         if( !( d > RT(0) ) ) {
+            return static_cast<int>( jj+1UL );
+         }
+
+         d = std::sqrt( d );
+         nativeElement<SO>( A, lda, jj, jj ) = T( d );
+
+         for( size_t i=jj+1UL; i<j+jb; ++i ) {
+            T tmp( nativeElement<SO>( A, lda, i, jj ) );
+            for( size_t k=j; k<jj; ++k ) {
+               tmp -= nativeElement<SO>( A, lda, i, k ) * conj( nativeElement<SO>( A, lda, jj, k ) );
+            }
+            nativeElement<SO>( A, lda, i, jj ) = tmp / d;
+         }
+      }
+
+      if( j+jb == n ) break;
+
+      // Computation of the block column of L: A21 = A21 * L11^-H (i.e. conj(L11) * A21^T = A21^T)
+      trsmKernel<SO,!SO>( true, false, true, jb, n-j-jb,
+                          &nativeElement<SO>( A, lda, j, j ), lda,
+                          &nativeElement<SO>( A, lda, j+jb, j ), lda );
+
+      // Update of the lower part of the trailing submatrix: A22 -= A21 * A21^H
+      for( size_t c=j+jb; c<n; c+=LAPACK_BLOCK_SIZE )
+      {
+         const size_t cb( min( LAPACK_BLOCK_SIZE, n-c ) );
+
+         for( size_t i=c; i<c+cb; ++i ) {
+            for( size_t l=c; l<=i; ++l ) {
+               T tmp( nativeElement<SO>( A, lda, i, l ) );
+               for( size_t k=j; k<j+jb; ++k ) {
+                  tmp -= nativeElement<SO>( A, lda, i, k ) * conj( nativeElement<SO>( A, lda, l, k ) );
+               }
+               nativeElement<SO>( A, lda, i, l ) = tmp;
+            }
+         }
+
+         if( c+cb < n ) {
+            MT       C ( nativeBlock<SO>( A, lda, c+cb, c, n-c-cb, cb ) );
+            const MT L1( nativeBlock<SO>( A, lda, c+cb, j, n-c-cb, jb ) );
+            const MT L2( nativeBlock<SO>( A, lda, c   , j, cb    , jb ) );
+            C -= L1 * ctrans( L2 );
+         }
+      }
+   }
+
+   return 0;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native kernel for the Cholesky decomposition of a positive definite column-major matrix.
+// \ingroup lapack
+//
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native Blaze equivalent of the LAPACK potrf() functions. In case \a uplo
+// is \c 'L' the decomposition \f$ A = L \cdot L^H \f$ is computed, in case \a uplo is \c 'U' the
+// decomposition \f$ A = U^H \cdot U \f$ is computed. Since the row-major interpretation of the
+// upper part of a Hermitian column-major matrix is the lower part of \f$ \overline{A} \f$, both
+// cases are handled by the same lower kernel. In case the matrix is not positive definite,
+// \a info is set to the 1-based index of the first non-positive pivot.
+*/
+template< typename T >  // Type of the matrix elements
+void potrf_native( char uplo, int n, T* A, int lda, int* info )
+{
+   BLAZE_INTERNAL_ASSERT( uplo == 'L' || uplo == 'U', "Invalid uplo argument detected" );
+
+   if( n <= 0 ) {
+      *info = 0;
+      return;
+   }
+
+   if( uplo == 'L' )
+      *info = potrfKernel<columnMajor>( n, A, lda );
+   else
+      *info = potrfKernel<rowMajor>( n, A, lda );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
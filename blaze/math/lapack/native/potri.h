@@ -0,0 +1,168 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potri.h
+//  \brief Header file for the native Cholesky-based inversion kernels (potri)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/math/lapack/native/trtri.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY-BASED INVERSION KERNELS (POTRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked kernel for the computation of the product \f$ L^H \cdot L \f$.
+// \ingroup lapack
+//
+// \param n The number of rows/columns of the matrix \a A.
+// \param A Pointer to the first element of the matrix.
+// \param lda The total number of elements between two rows/columns of \a A.
+// \return void
+//
+// This function overwrites the lower triangular matrix \a L given in the lower part of \a A
+// with the lower part of the Hermitian product \f$ L^H \cdot L \f$ (similar to the LAPACK
+// lauum() functions). The storage order \a SO specifies how the array \a A is interpreted.
+// The block rows are processed in ascending order, since each block row of the result only
+// depends on the block rows of \a L that have not been overwritten yet.
+*/
+template< bool SO        // Storage order of the matrix
+        , typename T >   // Type of the matrix elements
+void lauumKernel( size_t n, T* A, size_t lda )
+{
+   using MT = CustomMatrix<T,unaligned,unpadded,SO>;
+
+   for( size_t i=0UL; i<n; i+=LAPACK_BLOCK_SIZE )
+   {
+      const size_t ib( min( LAPACK_BLOCK_SIZE, n-i ) );
+
+      DynamicMatrix<T,SO> L11( ib, ib, T(0) );
+      for( size_t r=0UL; r<ib; ++r ) {
+         for( size_t c=0UL; c<=r; ++c ) {
+            L11(r,c) = nativeElement<SO>( A, lda, i+r, i+c );
+         }
+      }
+
+      DynamicMatrix<T,SO> R11( ctrans( L11 ) * L11 );
+
+      if( i+ib < n ) {
+         const MT L21( nativeBlock<SO>( A, lda, i+ib, i, n-i-ib, ib ) );
+         R11 += ctrans( L21 ) * L21;
+      }
+
+      // Update of the block row left of the diagonal block
+      if( i > 0UL ) {
+         MT R10( nativeBlock<SO>( A, lda, i, 0UL, ib, i ) );
+         R10 = ctrans( L11 ) * R10;
+
+         if( i+ib < n ) {
+            const MT L21( nativeBlock<SO>( A, lda, i+ib, i  , n-i-ib, ib ) );
+            const MT L20( nativeBlock<SO>( A, lda, i+ib, 0UL, n-i-ib, i  ) );
+            R10 += ctrans( L21 ) * L20;
+         }
+      }
+
+      for( size_t r=0UL; r<ib; ++r ) {
+         for( size_t c=0UL; c<=r; ++c ) {
+            nativeElement<SO>( A, lda, i+r, i+c ) = R11(r,c);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native kernel for the inversion of a positive definite column-major matrix.
+// \ingroup lapack
+//
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the Cholesky decomposed column-major matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native Blaze equivalent of the LAPACK potri() functions. It inverts the
+// Cholesky factor computed by potrf() and forms the according part of the inverse matrix (i.e.
+// \f$ L^{-H} \cdot L^{-1} \f$ or \f$ U^{-1} \cdot U^{-H} \f$). In case the matrix is singular,
+// \a info is set to the 1-based index of the first zero diagonal element.
+*/
+template< typename T >  // Type of the matrix elements
+void potri_native( char uplo, int n, T* A, int lda, int* info )
+{
+   BLAZE_INTERNAL_ASSERT( uplo == 'L' || uplo == 'U', "Invalid uplo argument detected" );
+
+   trtri_native( uplo, 'N', n, A, lda, info );
+
+   if( *info != 0 || n <= 0 ) {
+      return;
+   }
+
+   // The row-major interpretation of U^-1 * U^-H is the product of the lower part (U^-1)^T
+   if( uplo == 'L' )
+      lauumKernel<columnMajor>( n, A, lda );
+   else
+      lauumKernel<rowMajor>( n, A, lda );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
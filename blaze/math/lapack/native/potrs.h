@@ -0,0 +1,100 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/potrs.h
+//  \brief Header file for the native Cholesky-based substitution kernels (potrs)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_POTRS_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_POTRS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/util/Assert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE CHOLESKY-BASED SUBSTITUTION KERNELS (POTRS)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native kernel for the substitution step of solving a positive definite linear system.
+// \ingroup lapack
+//
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param n The number of rows/columns of the column-major system matrix \f$[0..\infty)\f$.
+// \param nrhs The number of right-hand side vectors \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the Cholesky decomposed column-major system matrix.
+// \param lda The total number of elements between two columns of the system matrix \f$[0..\infty)\f$.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of matrix \a B \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native Blaze equivalent of the LAPACK potrs() functions. It solves the
+// linear system for a matrix that has already been decomposed by potrf() via two blocked
+// triangular solves.
+*/
+template< typename T >  // Type of the matrix elements
+void potrs_native( char uplo, int n, int nrhs, const T* A, int lda, T* B, int ldb, int* info )
+{
+   BLAZE_INTERNAL_ASSERT( uplo == 'L' || uplo == 'U', "Invalid uplo argument detected" );
+
+   *info = 0;
+
+   if( n <= 0 || nrhs <= 0 ) {
+      return;
+   }
+
+   if( uplo == 'L' ) {
+      trsm_native( 'L', 'L', 'N', 'N', n, nrhs, A, lda, B, ldb );
+      trsm_native( 'L', 'L', 'C', 'N', n, nrhs, A, lda, B, ldb );
+   }
+   else {
+      trsm_native( 'L', 'U', 'C', 'N', n, nrhs, A, lda, B, ldb );
+      trsm_native( 'L', 'U', 'N', 'N', n, nrhs, A, lda, B, ldb );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,276 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/trsm.h
+//  \brief Header file for the native triangular solve kernels (trsm)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_TRSM_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_TRSM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Access to an element of a matrix given in LAPACK-style array notation.
+// \ingroup lapack
+//
+// \param A Pointer to the first element of the matrix.
+// \param lda The total number of elements between two rows/columns of the matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return Reference to the accessed element.
+//
+// This function provides access to the element (\a i,\a j) of a row-major (\a SO = \a rowMajor)
+// or column-major (\a SO = \a columnMajor) matrix. Since the transpose of a column-major matrix
+// is a row-major matrix within the same array, the storage order flag is used by the native
+// kernels to access both a matrix and its transpose.
+*/
+template< bool SO        // Storage order of the matrix
+        , typename T >   // Type of the matrix elements
+BLAZE_ALWAYS_INLINE T& nativeElement( T* A, size_t lda, size_t i, size_t j )
+{
+   return ( SO ? A[i+j*lda] : A[i*lda+j] );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a block of a matrix given in LAPACK-style array notation.
+// \ingroup lapack
+//
+// \param A Pointer to the first element of the matrix.
+// \param lda The total number of elements between two rows/columns of the matrix.
+// \param i The row index of the first element of the block.
+// \param j The column index of the first element of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \return Custom matrix representing the specified block.
+//
+// This function returns a custom matrix representing the \a m-by-\a n block starting at element
+// (\a i,\a j) of the given row-major (\a SO = \a rowMajor) or column-major (\a SO = \a columnMajor)
+// matrix. Since each block is represented by a separate custom matrix, operations on disjoint
+// blocks of the same matrix (e.g. \f$ A_{22} -= A_{21} \cdot A_{12} \f$) are directly evaluated
+// by the vectorized and parallelized Blaze kernels without any intermediate temporary. Note that
+// the block must not be empty and that a block of a const matrix must only be read.
+*/
+template< bool SO        // Storage order of the matrix
+        , typename T >   // Type of the matrix elements
+inline CustomMatrix<T,unaligned,unpadded,SO>
+   nativeBlock( const T* A, size_t lda, size_t i, size_t j, size_t m, size_t n )
+{
+   BLAZE_INTERNAL_ASSERT( m > 0UL && n > 0UL, "Invalid empty block detected" );
+
+   T* const ptr( const_cast<T*>( A ) + ( SO ? i+j*lda : i*lda+j ) );
+   return CustomMatrix<T,unaligned,unpadded,SO>( ptr, m, n, lda );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NATIVE TRIANGULAR SOLVE KERNELS (TRSM)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked kernel for the solution of a triangular system with multiple right-hand sides.
+// \ingroup lapack
+//
+// \param lower \a true in case \a A is a lower triangular matrix, \a false for an upper matrix.
+// \param unit \a true in case \a A is a unitriangular matrix, \a false otherwise.
+// \param conjugate \a true in case the conjugate of \a A should be used.
+// \param n The number of rows/columns of the triangular matrix \a A.
+// \param k The number of right-hand sides (i.e. the number of columns of \a B).
+// \param A Pointer to the first element of the triangular matrix.
+// \param lda The total number of elements between two rows/columns of \a A.
+// \param B Pointer to the first element of the right-hand side matrix.
+// \param ldb The total number of elements between two rows/columns of \a B.
+// \return void
+//
+// This function solves the triangular system \f$ op(A) \cdot X = B \f$, where \f$ op(A) \f$ is
+// either \a A or \f$ \overline{A} \f$, and overwrites \a B with the solution \a X. The storage
+// orders \a SOA and \a SOB specify how the arrays \a A and \a B are interpreted. The diagonal
+// blocks of size LAPACK_BLOCK_SIZE are solved by means of forward/backward substitution, the
+// update of the remaining rows of \a B is performed by the vectorized and parallelized dense
+// matrix multiplication kernels of Blaze.
+*/
+template< bool SOA       // Storage order of the triangular matrix
+        , bool SOB       // Storage order of the right-hand side matrix
+        , typename T >   // Type of the matrix elements
+void trsmKernel( bool lower, bool unit, bool conjugate, size_t n, size_t k,
+                 const T* A, size_t lda, T* B, size_t ldb )
+{
+   using AT = CustomMatrix<T,unaligned,unpadded,SOA>;
+   using BT = CustomMatrix<T,unaligned,unpadded,SOB>;
+
+   T* const a( const_cast<T*>( A ) );
+
+   if( n == 0UL || k == 0UL ) {
+      return;
+   }
+
+   for( size_t jj=0UL; jj<n; jj+=LAPACK_BLOCK_SIZE )
+   {
+      const size_t jb( min( LAPACK_BLOCK_SIZE, n-jj ) );
+      const size_t j ( lower ? jj : n-jj-jb );
+
+      // Forward/backward substitution for the diagonal block
+      for( size_t c=0UL; c<k; ++c )
+      {
+         for( size_t ii=0UL; ii<jb; ++ii )
+         {
+            const size_t i( lower ? j+ii : j+jb-ii-1UL );
+            const size_t lbegin( lower ? j : i+1UL );
+            const size_t lend  ( lower ? i : j+jb  );
+
+            T tmp( nativeElement<SOB>( B, ldb, i, c ) );
+
+            for( size_t l=lbegin; l<lend; ++l ) {
+               const T& ail( nativeElement<SOA>( a, lda, i, l ) );
+               tmp -= ( conjugate ? conj( ail ) : ail ) * nativeElement<SOB>( B, ldb, l, c );
+            }
+
+            if( !unit ) {
+               const T& aii( nativeElement<SOA>( a, lda, i, i ) );
+               tmp /= ( conjugate ? conj( aii ) : aii );
+            }
+
+            nativeElement<SOB>( B, ldb, i, c ) = tmp;
+         }
+      }
+
+      // Update of the remaining rows of B
+      const size_t rbegin( lower ? j+jb : 0UL );
+      const size_t rend  ( lower ? n    : j   );
+
+      if( rbegin == rend ) continue;
+
+      BT       B2( nativeBlock<SOB>( B, ldb, rbegin, 0UL, rend-rbegin, k ) );
+      const AT A2( nativeBlock<SOA>( A, lda, rbegin, j, rend-rbegin, jb ) );
+      const BT B1( nativeBlock<SOB>( B, ldb, j, 0UL, jb, k ) );
+
+      if( conjugate )
+         B2 -= conj( A2 ) * B1;
+      else
+         B2 -= A2 * B1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native kernel for the solution of a triangular system with multiple right-hand sides.
+// \ingroup lapack
+//
+// \param side \c 'L' to solve \f$ op(A) \cdot X = B \f$, \c 'R' to solve \f$ X \cdot op(A) = B \f$.
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param trans \c 'N' for \f$ op(A)=A \f$, \c 'T' for \f$ op(A)=A^T \f$, \c 'C' for \f$ op(A)=A^H \f$.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param m The number of rows of the column-major matrix \a B \f$[0..\infty)\f$.
+// \param n The number of columns of the column-major matrix \a B \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major triangular matrix.
+// \param lda The total number of elements between two columns of \a A \f$[0..\infty)\f$.
+// \param B Pointer to the first element of the column-major right-hand side matrix.
+// \param ldb The total number of elements between two columns of \a B \f$[0..\infty)\f$.
+// \return void
+//
+// This function is the native Blaze equivalent of the BLAS trsm() functions (with \f$ \alpha=1 \f$).
+// It overwrites \a B with the solution \a X of the triangular system. In case \a side is \c 'L'
+// the matrix \a A is an \a m-by-\a m matrix, in case \a side is \c 'R' it is an \a n-by-\a n
+// matrix. Note that the function does not check for singularity.
+*/
+template< typename T >  // Type of the matrix elements
+void trsm_native( char side, char uplo, char trans, char diag, int m, int n,
+                  const T* A, int lda, T* B, int ldb )
+{
+   BLAZE_INTERNAL_ASSERT( side  == 'L' || side  == 'R', "Invalid side argument detected"  );
+   BLAZE_INTERNAL_ASSERT( uplo  == 'L' || uplo  == 'U', "Invalid uplo argument detected"  );
+   BLAZE_INTERNAL_ASSERT( trans == 'N' || trans == 'T' || trans == 'C', "Invalid trans argument detected" );
+   BLAZE_INTERNAL_ASSERT( diag  == 'U' || diag  == 'N', "Invalid diag argument detected"  );
+
+   const bool unit     ( diag  == 'U' );
+   const bool conjugate( trans == 'C' );
+
+   if( side == 'L' ) {
+      // The transpose of the column-major matrix A is the row-major interpretation of A
+      const bool lower( ( uplo == 'L' ) == ( trans == 'N' ) );
+      if( trans == 'N' )
+         trsmKernel<columnMajor,columnMajor>( lower, unit, false, m, n, A, lda, B, ldb );
+      else
+         trsmKernel<rowMajor,columnMajor>( lower, unit, conjugate, m, n, A, lda, B, ldb );
+   }
+   else {
+      // X*op(A) = B is solved as op(A)^T*X^T = B^T
+      const bool lower( ( uplo == 'L' ) != ( trans == 'N' ) );
+      if( trans == 'N' )
+         trsmKernel<rowMajor,rowMajor>( lower, unit, false, n, m, A, lda, B, ldb );
+      else
+         trsmKernel<columnMajor,rowMajor>( lower, unit, conjugate, n, m, A, lda, B, ldb );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
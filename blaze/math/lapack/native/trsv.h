@@ -0,0 +1,208 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/trsv.h
+//  \brief Header file for the native triangular solve kernels (trsv)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_TRSV_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_TRSV_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE TRIANGULAR SOLVE KERNELS (TRSV)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked kernel for the solution of a triangular system with a single right-hand side.
+// \ingroup lapack
+//
+// \param lower \a true in case \a A is a lower triangular matrix, \a false for an upper matrix.
+// \param unit \a true in case \a A is a unitriangular matrix, \a false otherwise.
+// \param conjugate \a true in case the conjugate of \a A should be used.
+// \param n The number of rows/columns of the triangular matrix \a A.
+// \param A Pointer to the first element of the triangular matrix.
+// \param lda The total number of elements between two rows/columns of \a A.
+// \param x Pointer to the first element of the contiguous right-hand side vector.
+// \return void
+//
+// This function solves the triangular system \f$ op(A) \cdot y = x \f$, where \f$ op(A) \f$
+// is either \a A or \f$ \overline{A} \f$, and overwrites \a x with the solution \a y. The
+// storage order \a SO specifies how the array \a A is interpreted. The diagonal blocks of size
+// LAPACK_BLOCK_SIZE are solved by means of forward/backward substitution, the update of the
+// remaining elements of \a x is performed by the vectorized and parallelized dense matrix/dense
+// vector multiplication kernels of Blaze.
+*/
+template< bool SO        // Storage order of the triangular matrix
+        , typename T >   // Type of the matrix elements
+void trsvKernel( bool lower, bool unit, bool conjugate, size_t n, const T* A, size_t lda, T* x )
+{
+   using AT = CustomMatrix<T,unaligned,unpadded,SO>;
+   using XT = CustomVector<T,unaligned,unpadded,columnVector>;
+
+   T* const a( const_cast<T*>( A ) );
+
+   for( size_t jj=0UL; jj<n; jj+=LAPACK_BLOCK_SIZE )
+   {
+      const size_t jb( min( LAPACK_BLOCK_SIZE, n-jj ) );
+      const size_t j ( lower ? jj : n-jj-jb );
+
+      // Forward/backward substitution for the diagonal block
+      for( size_t ii=0UL; ii<jb; ++ii )
+      {
+         const size_t i( lower ? j+ii : j+jb-ii-1UL );
+         const size_t lbegin( lower ? j : i+1UL );
+         const size_t lend  ( lower ? i : j+jb  );
+
+         T tmp( x[i] );
+
+         for( size_t l=lbegin; l<lend; ++l ) {
+            const T& ail( nativeElement<SO>( a, lda, i, l ) );
+            tmp -= ( conjugate ? conj( ail ) : ail ) * x[l];
+         }
+
+         if( !unit ) {
+            const T& aii( nativeElement<SO>( a, lda, i, i ) );
+            tmp /= ( conjugate ? conj( aii ) : aii );
+         }
+
+         x[i] = tmp;
+      }
+
+      // Update of the remaining elements of x
+      const size_t rbegin( lower ? j+jb : 0UL );
+      const size_t rend  ( lower ? n    : j   );
+
+      if( rbegin == rend ) continue;
+
+      XT       x2( x+rbegin, rend-rbegin );
+      const AT A2( nativeBlock<SO>( A, lda, rbegin, j, rend-rbegin, jb ) );
+      const XT x1( x+j, jb );
+
+      if( conjugate )
+         x2 -= conj( A2 ) * x1;
+      else
+         x2 -= A2 * x1;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native kernel for the solution of a triangular system of equations.
+// \ingroup lapack
+//
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param trans \c 'N' for \f$ A*x=b \f$, \c 'T' for \f$ A^T*x=b \f$, or \c 'C' for \f$ A^H*x=b \f$.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major triangular matrix.
+// \param lda The total number of elements between two columns of \a A \f$[0..\infty)\f$.
+// \param x Pointer to the first element of the vector \a b.
+// \param incX The stride within vector \a x.
+// \return void
+//
+// This function is the native Blaze equivalent of the BLAS trsv() functions. It overwrites the
+// given vector with the solution of the triangular system. In case the given stride is not 1,
+// the vector is solved within a contiguous temporary. Note that the function does not check for
+// singularity.
+*/
+template< typename T >  // Type of the matrix elements
+void trsv_native( char uplo, char trans, char diag, int n, const T* A, int lda, T* x, int incX )
+{
+   BLAZE_INTERNAL_ASSERT( uplo  == 'L' || uplo  == 'U', "Invalid uplo argument detected"  );
+   BLAZE_INTERNAL_ASSERT( trans == 'N' || trans == 'T' || trans == 'C', "Invalid trans argument detected" );
+   BLAZE_INTERNAL_ASSERT( diag  == 'U' || diag  == 'N', "Invalid diag argument detected"  );
+   BLAZE_INTERNAL_ASSERT( incX != 0, "Invalid stride detected" );
+
+   if( n <= 0 ) {
+      return;
+   }
+
+   const bool unit     ( diag  == 'U' );
+   const bool conjugate( trans == 'C' );
+   const bool lower    ( ( uplo == 'L' ) == ( trans == 'N' ) );
+
+   std::unique_ptr<T[]> tmp;
+   T* y( x );
+
+   if( incX != 1 ) {
+      tmp.reset( new T[n] );
+      y = tmp.get();
+      for( int i=0; i<n; ++i ) {
+         y[i] = x[ ( incX > 0 ? i : i-n+1 ) * incX ];
+      }
+   }
+
+   // The transpose of the column-major matrix A is the row-major interpretation of A
+   if( trans == 'N' )
+      trsvKernel<columnMajor>( lower, unit, false, n, A, lda, y );
+   else
+      trsvKernel<rowMajor>( lower, unit, conjugate, n, A, lda, y );
+
+   if( incX != 1 ) {
+      for( int i=0; i<n; ++i ) {
+         x[ ( incX > 0 ? i : i-n+1 ) * incX ] = y[i];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
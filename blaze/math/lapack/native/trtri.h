@@ -0,0 +1,165 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/lapack/native/trtri.h
+//  \brief Header file for the native triangular inversion kernels (trtri)
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_LAPACK_NATIVE_TRTRI_H_
+#define _BLAZE_MATH_LAPACK_NATIVE_TRTRI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE TRIANGULAR INVERSION KERNELS (TRTRI)
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked kernel for the in-place inversion of a lower triangular matrix.
+// \ingroup lapack
+//
+// \param unit \a true in case \a A is a unitriangular matrix, \a false otherwise.
+// \param n The number of rows/columns of the triangular matrix \a A.
+// \param A Pointer to the first element of the lower triangular matrix.
+// \param lda The total number of elements between two rows/columns of \a A.
+// \return void
+//
+// This function inverts the lower triangular part of the given matrix in-place. The storage
+// order \a SO specifies how the array \a A is interpreted (i.e. the upper triangular part of
+// a column-major matrix can be inverted by means of the row-major interpretation). The inverse
+// is computed block column by block column: Block column \a c of the inverse is the solution of
+// the triangular system \f$ A(c:n,c:n) \cdot X = I(c:n,c:c+b) \f$, which only depends on the
+// block columns of \a A that have not been overwritten yet. The strictly upper part of \a A and,
+// in case of a unitriangular matrix, the diagonal elements are not referenced.
+*/
+template< bool SO        // Storage order of the triangular matrix
+        , typename T >   // Type of the matrix elements
+void trtriKernel( bool unit, size_t n, T* A, size_t lda )
+{
+   if( n == 0UL ) {
+      return;
+   }
+
+   DynamicMatrix<T,columnMajor> W( n, min( LAPACK_BLOCK_SIZE, n ) );
+   const size_t ldw( W.spacing() );
+
+   for( size_t c=0UL; c<n; c+=LAPACK_BLOCK_SIZE )
+   {
+      const size_t cb  ( min( LAPACK_BLOCK_SIZE, n-c ) );
+      const size_t rows( n-c );
+
+      for( size_t q=0UL; q<cb; ++q ) {
+         for( size_t r=0UL; r<rows; ++r ) {
+            W(r,q) = ( r == q )?( T(1) ):( T(0) );
+         }
+      }
+
+      trsmKernel<SO,columnMajor>( true, unit, false, rows, cb, &nativeElement<SO>( A, lda, c, c ), lda, W.data(), ldw );
+
+      for( size_t q=0UL; q<cb; ++q ) {
+         for( size_t r=( unit ? q+1UL : q ); r<rows; ++r ) {
+            nativeElement<SO>( A, lda, c+r, c+q ) = W(r,q);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native kernel for the inversion of a triangular column-major matrix.
+// \ingroup lapack
+//
+// \param uplo \c 'L' in case of a lower matrix, \c 'U' in case of an upper matrix.
+// \param diag \c 'U' in case of a unitriangular matrix, \c 'N' otherwise.
+// \param n The number of rows/columns of the column-major matrix \f$[0..\infty)\f$.
+// \param A Pointer to the first element of the column-major triangular matrix.
+// \param lda The total number of elements between two columns of the matrix \f$[0..\infty)\f$.
+// \param info Return code of the function call.
+// \return void
+//
+// This function is the native Blaze equivalent of the LAPACK trtri() functions. In case the
+// matrix is singular, \a info is set to the 1-based index of the first zero diagonal element
+// and the matrix is not modified.
+*/
+template< typename T >  // Type of the matrix elements
+void trtri_native( char uplo, char diag, int n, T* A, int lda, int* info )
+{
+   BLAZE_INTERNAL_ASSERT( uplo == 'L' || uplo == 'U', "Invalid uplo argument detected" );
+   BLAZE_INTERNAL_ASSERT( diag == 'U' || diag == 'N', "Invalid diag argument detected" );
+
+   *info = 0;
+
+   if( n <= 0 ) {
+      return;
+   }
+
+   if( diag == 'N' ) {
+      for( int i=0; i<n; ++i ) {
+         if( isDefault( A[i+i*lda] ) ) {
+            *info = i+1;
+            return;
+         }
+      }
+   }
+
+   // The upper part of the column-major matrix is the lower part of its row-major interpretation
+   if( uplo == 'L' )
+      trtriKernel<columnMajor>( diag == 'U', n, A, lda );
+   else
+      trtriKernel<rowMajor>( diag == 'U', n, A, lda );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -49,6 +48,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/orgql.h>
 #include <blaze/math/lapack/clapack/orgrq.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Builtin.h>
 #include <blaze/util/NumericCast.h>
@@ -67,6 +67,9 @@ namespace blaze {
 //@{
 template< typename MT, bool SO >
 inline void orgql( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau );
+
+template< typename MT, bool SO >
+inline void orgql( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -116,6 +119,32 @@ inline void orgql( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau );
 */
 template< typename MT, bool SO >
 inline void orgql( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
+{
+   LAPACKWorkspace ws;
+   orgql( A, tau, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the reconstruction of the orthogonal matrix Q from a QL decomposition.
+// \ingroup lapack_decomposition
+//
+// \param A The decomposed matrix.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+//
+// This function is identical to the according orgql() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT, bool SO >
+inline void orgql( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -135,16 +164,28 @@ inline void orgql( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
       return;
    }
 
-   int lwork( k*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   if( SO ) {
+      const size_t offset( ( m < n )?( n - m ):( 0UL ) );
+      orgql( m, k, k, (~A).data(offset), lda, tau, &wkopt, lwork, &info );
+   }
+   else {
+      const size_t offset( ( m > n )?( m - n ):( 0UL ) );
+      orgrq( k, n, k, (~A).data()+offset, lda, tau, &wkopt, lwork, &info );
+   }
+
+   lwork = optimalWorkspace( wkopt, k );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
 
    if( SO ) {
       const size_t offset( ( m < n )?( n - m ):( 0UL ) );
-      orgql( m, k, k, (~A).data(offset), lda, tau, work.get(), lwork, &info );
+      orgql( m, k, k, (~A).data(offset), lda, tau, work, lwork, &info );
    }
    else {
       const size_t offset( ( m > n )?( m - n ):( 0UL ) );
-      orgrq( k, n, k, (~A).data()+offset, lda, tau, work.get(), lwork, &info );
+      orgrq( k, n, k, (~A).data()+offset, lda, tau, work, lwork, &info );
    }
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for Q reconstruction" );
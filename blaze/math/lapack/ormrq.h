@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -51,6 +50,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/ormql.h>
 #include <blaze/math/lapack/clapack/ormrq.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Builtin.h>
@@ -72,6 +72,10 @@ namespace blaze {
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline void ormrq( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
                    char side, char trans, const ElementType_<MT2>* tau );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void ormrq( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                   char side, char trans, const ElementType_<MT2>* tau, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -144,6 +148,40 @@ inline void ormrq( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline void ormrq( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
                    char side, char trans, const ElementType_<MT2>* tau )
+{
+   LAPACKWorkspace ws;
+   ormrq( C, A, side, trans, tau, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the multiplication of the double precision Q from a RQ decomposition
+//        with another matrix.
+// \ingroup lapack_decomposition
+//
+// \param C The matrix multiplier.
+// \param A The decomposed matrix.
+// \param side \c 'L' to apply \f$ Q \f$ or \f$ Q^T \f$ from the left, \c 'R' to apply from the right.
+// \param trans \c 'N' for \f$ Q \f$, \c 'T' for \f$ Q^T \f$.
+// \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid size of Q matrix.
+// \exception std::invalid_argument Invalid side argument provided.
+// \exception std::invalid_argument Invalid trans argument provided.
+//
+// This function is identical to the according ormrq() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline void ormrq( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                   char side, char trans, const ElementType_<MT2>* tau, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -190,15 +228,26 @@ inline void ormrq( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
       ( trans == 'N' )?( trans = 'T' ):( trans = 'N' );
    }
 
-   int lwork( k*ldc );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
    const size_t offset( (~A).rows() - (~A).columns() );
 
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   if( SO2 ) {
+      ormrq( side, trans, m, n, k, (~A).data()+offset, lda, tau, (~C).data(), ldc, &wkopt, lwork, &info );
+   }
+   else {
+      ormql( side, trans, m, n, k, (~A).data(offset), lda, tau, (~C).data(), ldc, &wkopt, lwork, &info );
+   }
+
+   lwork = optimalWorkspace( wkopt, ( side == 'L' )?( n ):( m ) );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
    if( SO2 ) {
-      ormrq( side, trans, m, n, k, (~A).data()+offset, lda, tau, (~C).data(), ldc, work.get(), lwork, &info );
+      ormrq( side, trans, m, n, k, (~A).data()+offset, lda, tau, (~C).data(), ldc, work, lwork, &info );
    }
    else {
-      ormql( side, trans, m, n, k, (~A).data(offset), lda, tau, (~C).data(), ldc, work.get(), lwork, &info );
+      ormql( side, trans, m, n, k, (~A).data(offset), lda, tau, (~C).data(), ldc, work, lwork, &info );
    }
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for Q multiplication" );
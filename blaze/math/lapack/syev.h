@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -50,6 +49,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/syev.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
@@ -70,6 +70,10 @@ namespace blaze {
 //@{
 template< typename MT, bool SO, typename VT, bool TF >
 inline void syev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo );
+
+template< typename MT, bool SO, typename VT, bool TF >
+inline void syev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo,
+                  LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -137,6 +141,43 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline void syev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo )
+{
+   LAPACKWorkspace ws;
+   syev( A, w, jobz, uplo, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense symmetric matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given symmetric matrix.
+// \param w The resulting vector of eigenvalues.
+// \param jobz \c 'V' to compute the eigenvectors of \a A, \c 'N' to only compute the eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid jobz argument provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according syev() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline void syev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char uplo,
+                  LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -173,14 +214,19 @@ inline void syev( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char jobz, char
       return;
    }
 
-   int lwork( 10*n + 2 );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-
    if( IsRowMajorMatrix<MT>::value ) {
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
-   syev( jobz, uplo, n, (~A).data(), lda, (~w).data(), work.get(), lwork, &info );
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   syev( jobz, uplo, n, (~A).data(), lda, (~w).data(), &wkopt, lwork, &info );
+
+   lwork = optimalWorkspace( wkopt, 3*n );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   syev( jobz, uplo, n, (~A).data(), lda, (~w).data(), work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for eigenvalue computation" );
 
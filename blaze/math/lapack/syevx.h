@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -50,6 +49,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/lapack/clapack/syevx.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
@@ -73,16 +73,31 @@ namespace blaze {
 template< typename MT, bool SO, typename VT, bool TF >
 inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo );
 
+template< typename MT, bool SO, typename VT, bool TF >
+inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, LAPACKWorkspace& ws );
+
 template< typename MT, bool SO, typename VT, bool TF, typename ST >
 inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST low, ST upp );
 
+template< typename MT, bool SO, typename VT, bool TF, typename ST >
+inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST low, ST upp,
+                     LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
 inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
                      DenseMatrix<MT2,SO2>& Z, char uplo );
 
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2 >
+inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
+                     DenseMatrix<MT2,SO2>& Z, char uplo, LAPACKWorkspace& ws );
+
 template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2, typename ST >
 inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
                      DenseMatrix<MT2,SO2>& Z, char uplo, ST low, ST upp );
+
+template< typename MT1, bool SO1, typename VT, bool TF, typename MT2, bool SO2, typename ST >
+inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
+                     DenseMatrix<MT2,SO2>& Z, char uplo, ST low, ST upp, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -100,6 +115,7 @@ inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
 // \param vu The upper bound of the interval to be searched for eigenvalues (\a vl < \a vu).
 // \param il The index of the smallest eigenvalue to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest eigenvalue to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of eigenvalues found.
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -116,7 +132,8 @@ template< typename MT    // Type of the matrix A
         , bool TF        // Transpose flag of the vector w
         , typename ST >  // Type of the scalar boundary values
 inline size_t syevx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
-                             char uplo, char range, ST vl, ST vu, int il, int iu )
+                             char uplo, char range, ST vl, ST vu, int il, int iu,
+                             LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ), "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~w).size() == (~A).rows(), "Invalid vector dimension detected" );
@@ -133,12 +150,19 @@ inline size_t syevx_backend( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w,
    int info( 0 );
 
    int lwork( 12*n + 2 );
-   const std::unique_ptr<ET[]>  work ( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[12*n] );
-   const std::unique_ptr<int[]> ifail( new int[n] );
+   int* const iwork( ws.get<int>( 2UL, 12*n ) );
+   int* const ifail( ws.get<int>( 3UL, n ) );
+
+   ET wkopt( 0 );
 
    syevx( 'N', range, uplo, n, (~A).data(), lda, vl, vu, il, iu, ET(0), &m,
-          (~w).data(), nullptr, 1, work.get(), lwork, iwork.get(), ifail.get(), &info );
+          (~w).data(), nullptr, 1, &wkopt, -1, iwork, ifail, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   syevx( 'N', range, uplo, n, (~A).data(), lda, vl, vu, il, iu, ET(0), &m,
+          (~w).data(), nullptr, 1, work, lwork, iwork, ifail, &info );
 
    const size_t num( numeric_cast<size_t>( m ) );
 
@@ -216,6 +240,40 @@ template< typename MT  // Type of the matrix A
         , typename VT  // Type of the vector w
         , bool TF >    // Transpose flag of the vector w
 inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo )
+{
+   LAPACKWorkspace ws;
+   return syevx( A, w, uplo, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense symmetric matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given symmetric matrix.
+// \param w The resulting vector of eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of eigenvalues found.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according syevx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the matrix A
+        , bool SO      // Storage order of the matrix A
+        , typename VT  // Type of the vector w
+        , bool TF >    // Transpose flag of the vector w
+inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -246,7 +304,7 @@ inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo )
       return 0;
    }
 
-   return syevx_backend( ~A, ~w, uplo, 'A', ET(), ET(), 0, 0 );
+   return syevx_backend( ~A, ~w, uplo, 'A', ET(), ET(), 0, 0, ws );
 }
 //*************************************************************************************************
 
@@ -343,6 +401,46 @@ template< typename MT    // Type of the matrix A
         , bool TF        // Transpose flag of the vector w
         , typename ST >  // Type of the scalar boundary values
 inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST low, ST upp )
+{
+   LAPACKWorkspace ws;
+   return syevx( A, w, uplo, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense symmetric matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given symmetric matrix.
+// \param w The resulting vector of eigenvalues.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param low The lower bound of the interval to be searched for eigenvalues.
+// \param upp The upper bound of the interval to be searched for eigenvalues.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of eigenvalues found.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according syevx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT    // Type of the matrix A
+        , bool SO        // Storage order of the matrix A
+        , typename VT    // Type of the vector w
+        , bool TF        // Transpose flag of the vector w
+        , typename ST >  // Type of the scalar boundary values
+inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST low, ST upp,
+                     LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -390,7 +488,7 @@ inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST
    const int  il   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( low ) );
    const int  iu   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( upp ) );
 
-   return syevx_backend( ~A, ~w, uplo, range, vl, vu, il, iu );
+   return syevx_backend( ~A, ~w, uplo, range, vl, vu, il, iu, ws );
 }
 //*************************************************************************************************
 
@@ -409,6 +507,7 @@ inline size_t syevx( DenseMatrix<MT,SO>& A, DenseVector<VT,TF>& w, char uplo, ST
 // \param vu The upper bound of the interval to be searched for eigenvalues (\a vl < \a vu).
 // \param il The index of the smallest eigenvalue to be returned (0 <= \a il <= \a iu).
 // \param iu The index of the largest eigenvalue to be returned (0 <= \a il <= \a iu).
+// \param ws The workspace for the auxiliary memory.
 // \return The total number of eigenvalues found.
 // \exception std::runtime_error Eigenvalue computation failed.
 //
@@ -428,7 +527,8 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline size_t syevx_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
                              DenseMatrix<MT2,SO2>& Z, char uplo, char range,
-                             ST vl, ST vu, int il, int iu )
+                             ST vl, ST vu, int il, int iu,
+                             LAPACKWorkspace& ws )
 {
    BLAZE_INTERNAL_ASSERT( isSquare( ~A ), "Invalid non-square matrix detected" );
    BLAZE_INTERNAL_ASSERT( range != 'A' || (~w).size() == (~A).rows(), "Invalid vector dimension detected" );
@@ -450,12 +550,19 @@ inline size_t syevx_backend( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
    int info( 0 );
 
    int lwork( 12*n + 2 );
-   const std::unique_ptr<ET[]>  work ( new ET[lwork] );
-   const std::unique_ptr<int[]> iwork( new int[12*n] );
-   const std::unique_ptr<int[]> ifail( new int[n] );
+   int* const iwork( ws.get<int>( 2UL, 12*n ) );
+   int* const ifail( ws.get<int>( 3UL, n ) );
+
+   ET wkopt( 0 );
 
    syevx( 'N', range, uplo, n, (~A).data(), lda, vl, vu, il, iu, ET(0), &m,
-          (~w).data(), (~Z).data(), ldz, work.get(), lwork, iwork.get(), ifail.get(), &info );
+          (~w).data(), (~Z).data(), ldz, &wkopt, -1, iwork, ifail, &info );
+
+   lwork = optimalWorkspace( wkopt, lwork );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   syevx( 'N', range, uplo, n, (~A).data(), lda, vl, vu, il, iu, ET(0), &m,
+          (~w).data(), (~Z).data(), ldz, work, lwork, iwork, ifail, &info );
 
    const size_t num( numeric_cast<size_t>( m ) );
 
@@ -543,6 +650,45 @@ template< typename MT1  // Type of the matrix A
         , bool SO2 >    // Storage order of the matrix Z
 inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
                      DenseMatrix<MT2,SO2>& Z, char uplo )
+{
+   LAPACKWorkspace ws;
+   return syevx( A, w, Z, uplo, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense symmetric matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given symmetric matrix.
+// \param w The resulting vector of eigenvalues.
+// \param Z The resulting matrix of eigenvectors.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of eigenvalues found.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according syevx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1  // Type of the matrix A
+        , bool SO1      // Storage order of the matrix A
+        , typename VT   // Type of the vector w
+        , bool TF       // Transpose flag of the vector w
+        , typename MT2  // Type of the matrix Z
+        , bool SO2 >    // Storage order of the matrix Z
+inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
+                     DenseMatrix<MT2,SO2>& Z, char uplo, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -580,7 +726,7 @@ inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
       return 0;
    }
 
-   return syevx_backend( ~A, ~w, ~Z, uplo, 'A', ET(), ET(), 0, 0 );
+   return syevx_backend( ~A, ~w, ~Z, uplo, 'A', ET(), ET(), 0, 0, ws );
 }
 //*************************************************************************************************
 
@@ -690,6 +836,50 @@ template< typename MT1   // Type of the matrix A
         , typename ST >  // Type of the scalar boundary values
 inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
                      DenseMatrix<MT2,SO2>& Z, char uplo, ST low, ST upp )
+{
+   LAPACKWorkspace ws;
+   return syevx( A, w, Z, uplo, low, upp, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for computing the eigenvalues of the given dense symmetric matrix.
+// \ingroup lapack_eigenvalue
+//
+// \param A The given symmetric matrix.
+// \param w The resulting vector of eigenvalues.
+// \param Z The resulting matrix of eigenvectors.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param low The lower bound of the interval to be searched for eigenvalues.
+// \param upp The upper bound of the interval to be searched for eigenvalues.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return The total number of eigenvalues found.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::invalid_argument Invalid value range provided.
+// \exception std::invalid_argument Invalid index range provided.
+// \exception std::runtime_error Eigenvalue computation failed.
+//
+// This function is identical to the according syevx() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1   // Type of the matrix A
+        , bool SO1       // Storage order of the matrix A
+        , typename VT    // Type of the vector w
+        , bool TF        // Transpose flag of the vector w
+        , typename MT2   // Type of the matrix Z
+        , bool SO2       // Storage order of the matrix Z
+        , typename ST >  // Type of the scalar boundary values
+inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
+                     DenseMatrix<MT2,SO2>& Z, char uplo, ST low, ST upp, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -745,7 +935,7 @@ inline size_t syevx( DenseMatrix<MT1,SO1>& A, DenseVector<VT,TF>& w,
    const int  il   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( low ) );
    const int  iu   ( IsFloatingPoint<ST>::value ? 0 : numeric_cast<int>( upp ) );
 
-   return syevx_backend( ~A, ~w, ~Z, uplo, range, vl, vu, il, iu );
+   return syevx_backend( ~A, ~w, ~Z, uplo, range, vl, vu, il, iu, ws );
 }
 //*************************************************************************************************
 
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -49,6 +48,7 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/sytrf.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
@@ -67,6 +67,9 @@ namespace blaze {
 //@{
 template< typename MT, bool SO >
 inline void sytrf( DenseMatrix<MT,SO>& A, char uplo, int* ipiv );
+
+template< typename MT, bool SO >
+inline void sytrf( DenseMatrix<MT,SO>& A, char uplo, int* ipiv, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -118,6 +121,36 @@ inline void sytrf( DenseMatrix<MT,SO>& A, char uplo, int* ipiv );
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
 inline void sytrf( DenseMatrix<MT,SO>& A, char uplo, int* ipiv )
+{
+   LAPACKWorkspace ws;
+   sytrf( A, uplo, ipiv, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the decomposition of the given dense symmetric indefinite matrix.
+// \ingroup lapack_decomposition
+//
+// \param A The matrix to be decomposed.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \param ipiv Auxiliary array of size \a n for the pivot indices.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+//
+// This function is identical to the according sytrf() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void sytrf( DenseMatrix<MT,SO>& A, char uplo, int* ipiv, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
@@ -142,14 +175,19 @@ inline void sytrf( DenseMatrix<MT,SO>& A, char uplo, int* ipiv )
       return;
    }
 
-   int lwork( n*lda );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
-
    if( IsRowMajorMatrix<MT>::value ) {
       ( uplo == 'L' )?( uplo = 'U' ):( uplo = 'L' );
    }
 
-   sytrf( uplo, n, (~A).data(), lda, ipiv, work.get(), lwork, &info );
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   sytrf( uplo, n, (~A).data(), lda, ipiv, &wkopt, lwork, &info );
+
+   lwork = optimalWorkspace( wkopt, 1 );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
+   sytrf( uplo, n, (~A).data(), lda, ipiv, work, lwork, &info );
 
    BLAZE_INTERNAL_ASSERT( info >= 0, "Invalid argument for matrix decomposition" );
 }
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -51,6 +50,7 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/clapack/unmql.h>
 #include <blaze/math/lapack/clapack/unmrq.h>
+#include <blaze/math/lapack/Workspace.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Complex.h>
 #include <blaze/util/NumericCast.h>
@@ -70,6 +70,10 @@ namespace blaze {
 template< typename MT1, bool SO, typename MT2 >
 inline void unmql( DenseMatrix<MT1,SO>& C, const DenseMatrix<MT2,SO>& A,
                    char side, char trans, const ElementType_<MT2>* tau );
+
+template< typename MT1, bool SO, typename MT2 >
+inline void unmql( DenseMatrix<MT1,SO>& C, const DenseMatrix<MT2,SO>& A,
+                   char side, char trans, const ElementType_<MT2>* tau, LAPACKWorkspace& ws );
 //@}
 //*************************************************************************************************
 
@@ -142,6 +146,40 @@ inline void unmql( DenseMatrix<MT1,SO>& C, const DenseMatrix<MT2,SO>& A,
 template< typename MT1, bool SO, typename MT2 >
 inline void unmql( DenseMatrix<MT1,SO>& C, const DenseMatrix<MT2,SO>& A,
                    char side, char trans, const ElementType_<MT2>* tau )
+{
+   LAPACKWorkspace ws;
+   unmql( C, A, side, trans, tau, ws );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief LAPACK kernel for the multiplication of the double precision Q from a QL decomposition
+//        with another matrix.
+// \ingroup lapack_decomposition
+//
+// \param C The matrix multiplier.
+// \param A The decomposed matrix.
+// \param side \c 'L' to apply \f$ Q \f$ or \f$ Q^T \f$ from the left, \c 'R' to apply from the right.
+// \param trans \c 'N' for \f$ Q \f$, \c 'T' for \f$ Q^T \f$.
+// \param tau Array for the scalar factors of the elementary reflectors.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+// \exception std::invalid_argument Invalid size of Q matrix.
+// \exception std::invalid_argument Invalid side argument provided.
+// \exception std::invalid_argument Invalid trans argument provided.
+//
+// This function is identical to the according unmql() function without workspace argument,
+// except that all auxiliary memory is taken from the given workspace \a ws (see LAPACKWorkspace).
+// Thus repeated calls for matrices of the same size don't perform any memory allocation.
+//
+// \note This function can only be used if a fitting LAPACK library, which supports this function,
+// is available and linked to the executable. Otherwise a call to this function will result in a
+// linker error.
+*/
+template< typename MT1, bool SO, typename MT2 >
+inline void unmql( DenseMatrix<MT1,SO>& C, const DenseMatrix<MT2,SO>& A,
+                   char side, char trans, const ElementType_<MT2>* tau, LAPACKWorkspace& ws )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT1 );
    BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
@@ -184,15 +222,26 @@ inline void unmql( DenseMatrix<MT1,SO>& C, const DenseMatrix<MT2,SO>& A,
       ( side  == 'L' )?( side  = 'R' ):( side  = 'L' );
    }
 
-   int lwork( k*ldc );
-   const std::unique_ptr<ET[]> work( new ET[lwork] );
    const size_t offset( (~A).rows() - (~A).columns() );
 
+   ET wkopt( 0 );
+   int lwork( -1 );
+
+   if( SO ) {
+      unmql( side, trans, m, n, k, (~A).data()+offset, lda, tau, (~C).data(), ldc, &wkopt, lwork, &info );
+   }
+   else {
+      unmrq( side, trans, m, n, k, (~A).data(offset), lda, tau, (~C).data(), ldc, &wkopt, lwork, &info );
+   }
+
+   lwork = optimalWorkspace( wkopt, ( side == 'L' )?( n ):( m ) );
+   ET* const work( ws.get<ET>( 0UL, lwork ) );
+
    if( SO ) {
-      unmql( side, trans, m, n, k, (~A).data()+offset, lda, tau, (~C).data(), ldc, work.get(), lwork, &info );
+      unmql( side, trans, m, n, k, (~A).data()+offset, lda, tau, (~C).data(), ldc, work, lwork, &info );
    }
    else {
-      unmrq( side, trans, m, n, k, (~A).data(offset), lda, tau, (~C).data(), ldc, work.get(), lwork, &info );
+      unmrq( side, trans, m, n, k, (~A).data(offset), lda, tau, (~C).data(), ldc, work, lwork, &info );
    }
 
    BLAZE_INTERNAL_ASSERT( info == 0, "Invalid argument for Q multiplication" );
@@ -0,0 +1,958 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedArchive.h
+//  \brief Header file for the zero-copy, memory-mapped archive of vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/sparse/CompressedView.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MAPPEDARCHIVEHEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief File header of a memory-mapped archive.
+// \ingroup serialization
+//
+// The header occupies the first 64 bytes of the file. It is followed by an arbitrary number of
+// objects, each starting with a MappedObjectHeader. All objects and all data sections within
+// an object start at a multiple of 64 bytes. All values are stored in the native byte order of
+// the system.
+*/
+struct MappedArchiveHeader
+{
+   char     magic[8];      //!< The file signature ("BLAZEARC").
+   uint32_t version;       //!< The version of the file format.
+   uint8_t  reserved[52];  //!< Reserved for future use.
+
+   static constexpr uint32_t currentVersion = 1U;    //!< The current version of the format.
+   static constexpr size_t   alignment      = 64UL;  //!< The alignment of all sections in bytes.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Header of a single object within a memory-mapped archive.
+// \ingroup serialization
+//
+// The header occupies 64 bytes and is directly followed by the data sections of the object:
+//
+//  - dense vector : the \a rows elements, zero-padded to \a spacing elements.
+//  - dense matrix : \a rows rows (row-major) or \a columns columns (column-major), each one
+//                   zero-padded to \a spacing elements.
+//  - sparse matrix: the \a rows+1 (row-major) or \a columns+1 (column-major) row/column pointers,
+//                   the \a nonZeros indices (both as 64-bit unsigned integers), and the
+//                   \a nonZeros values, each section padded to a multiple of 64 bytes.
+*/
+struct MappedObjectHeader
+{
+   uint32_t type;          //!< The type of the object.
+   uint32_t elementType;   //!< The type of the elements (see TypeValueMapping).
+   uint32_t elementSize;   //!< The size of a single element in bytes.
+   uint32_t flag;          //!< The transpose flag or storage order of the object.
+   uint64_t rows;          //!< The size of the vector or the number of rows of the matrix.
+   uint64_t columns;       //!< The number of columns of the matrix (1 for vectors).
+   uint64_t spacing;       //!< The number of elements between two rows/columns.
+   uint64_t nonZeros;      //!< The number of non-zero elements of a sparse matrix.
+   uint64_t size;          //!< The total size of the object including the header in bytes.
+   uint8_t  reserved[8];   //!< Reserved for future use.
+
+   //! The types of objects stored in a memory-mapped archive.
+   enum : uint32_t { denseVector = 1U, denseMatrix = 2U, sparseMatrix = 3U };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MAPPEDARCHIVEWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writer for memory-mapped archives.
+// \ingroup serialization
+//
+// The MappedArchiveWriter class writes dense vectors, dense matrices and sparse matrices to a
+// file in a layout that can be mapped into memory and directly used without deserialization
+// (see the MappedArchive class). In contrast to the Archive class, the elements are stored in
+// the same aligned and padded layout as in memory:
+
+   \code
+   blaze::DynamicMatrix<double,blaze::rowMajor> A;
+   blaze::DynamicVector<double,blaze::columnVector> b;
+   blaze::CompressedMatrix<double,blaze::rowMajor> S;
+   // ... Resizing and initialization
+
+   blaze::MappedArchiveWriter archive( "model.blaze" );
+   archive << A << b << S;
+   \endcode
+
+// In case an error is encountered during writing, a \a std::runtime_error exception is thrown.
+// Note that only vectors and matrices with numeric element type can be written.
+*/
+class MappedArchiveWriter : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedArchiveWriter( const std::string& filename );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Output operators****************************************************************************
+   /*!\name Output operators */
+   //@{
+   template< typename VT, bool TF >
+   inline MappedArchiveWriter& operator<<( const DenseVector<VT,TF>& vec );
+
+   template< typename MT, bool SO >
+   inline MappedArchiveWriter& operator<<( const DenseMatrix<MT,SO>& mat );
+
+   template< typename MT, bool SO >
+   inline MappedArchiveWriter& operator<<( const SparseMatrix<MT,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void close();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static inline size_t spacing( size_t n ) noexcept;
+
+   template< typename Type >
+   inline MappedObjectHeader header( uint32_t type, bool flag, size_t m, size_t n );
+
+   inline void write( const void* data, size_t bytes );
+   inline void pad();
+   //@}
+   //**********************************************************************************************
+
+   //**Member constants****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Number of elements transferred per write operation.
+   static constexpr size_t blockSize = 4096UL;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::ofstream stream_;  //!< The output file stream.
+   size_t        offset_;  //!< The current offset within the file in bytes.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( sizeof( MappedArchiveHeader ) == 64UL );
+   BLAZE_STATIC_ASSERT( sizeof( MappedObjectHeader  ) == 64UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a new memory-mapped archive.
+//
+// \param filename The name of the archive file.
+// \exception std::runtime_error Opening the file failed.
+//
+// This constructor creates a new archive file (or overwrites an existing file) and writes the
+// file header.
+*/
+inline MappedArchiveWriter::MappedArchiveWriter( const std::string& filename )
+   : stream_( filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc )  // The output file stream
+   , offset_( 0UL )  // The current offset within the file in bytes
+{
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Opening file failed" );
+   }
+
+   MappedArchiveHeader header = {};
+   std::memcpy( header.magic, "BLAZEARC", 8UL );
+   header.version = MappedArchiveHeader::currentVersion;
+
+   write( &header, sizeof( MappedArchiveHeader ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OUTPUT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writing a dense vector to the archive.
+//
+// \param vec The dense vector to be written.
+// \return Reference to the archive.
+// \exception std::runtime_error Writing the file failed.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const DenseVector<VT,TF>& vec )
+{
+   using ET = ElementType_<VT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<VT> v( ~vec );  // Evaluation of the dense vector (expression)
+
+   const MappedObjectHeader object(
+      header<ET>( MappedObjectHeader::denseVector, TF, v.size(), 1UL ) );
+   write( &object, sizeof( MappedObjectHeader ) );
+
+   std::vector<ET> buffer( min( v.size(), blockSize ) );
+
+   for( size_t i=0UL; i<v.size(); i+=blockSize ) {
+      const size_t n( min( blockSize, v.size() - i ) );
+      for( size_t k=0UL; k<n; ++k ) {
+         buffer[k] = v[i+k];
+      }
+      write( buffer.data(), n*sizeof( ET ) );
+   }
+   pad();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a dense matrix to the archive.
+//
+// \param mat The dense matrix to be written.
+// \return Reference to the archive.
+// \exception std::runtime_error Writing the file failed.
+//
+// The matrix is written in its own storage order, i.e. a row-major matrix is stored row-wise
+// and a column-major matrix is stored column-wise.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<MT> A( ~mat );  // Evaluation of the dense matrix (expression)
+
+   const MappedObjectHeader object(
+      header<ET>( MappedObjectHeader::denseMatrix, SO, A.rows(), A.columns() ) );
+   write( &object, sizeof( MappedObjectHeader ) );
+
+   const size_t M( SO ? A.columns() : A.rows() );
+   const size_t N( SO ? A.rows() : A.columns() );
+
+   std::vector<ET> buffer( object.spacing );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         buffer[j] = ( SO ? A(j,i) : A(i,j) );
+      }
+      write( buffer.data(), buffer.size()*sizeof( ET ) );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a sparse matrix to the archive.
+//
+// \param mat The sparse matrix to be written.
+// \return Reference to the archive.
+// \exception std::runtime_error Writing the file failed.
+//
+// The matrix is written in its own storage order, i.e. a row-major matrix is stored in the
+// compressed sparse row (CSR) format and a column-major matrix is stored in the compressed
+// sparse column (CSC) format.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const SparseMatrix<MT,SO>& mat )
+{
+   using ET            = ElementType_<MT>;
+   using ConstIterator = ConstIterator_< RemoveReference_< CompositeType_<MT> > >;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<MT> A( ~mat );  // Evaluation of the sparse matrix (expression)
+
+   const size_t M( SO ? A.columns() : A.rows() );
+
+   std::vector<uint64_t> pointers( M+1UL, 0UL );
+   for( size_t i=0UL; i<M; ++i ) {
+      pointers[i+1UL] = pointers[i];
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element )
+         ++pointers[i+1UL];
+   }
+
+   MappedObjectHeader object(
+      header<ET>( MappedObjectHeader::sparseMatrix, SO, A.rows(), A.columns() ) );
+   object.spacing  = 0UL;
+   object.nonZeros = pointers[M];
+   object.size     = sizeof( MappedObjectHeader ) +
+                     nextMultiple<size_t>( ( M+1UL )*sizeof( uint64_t ), MappedArchiveHeader::alignment ) +
+                     nextMultiple<size_t>( pointers[M]*sizeof( uint64_t ), MappedArchiveHeader::alignment ) +
+                     nextMultiple<size_t>( pointers[M]*sizeof( ET ), MappedArchiveHeader::alignment );
+   write( &object, sizeof( MappedObjectHeader ) );
+
+   write( pointers.data(), pointers.size()*sizeof( uint64_t ) );
+   pad();
+
+   std::vector<uint64_t> indices( min( pointers[M], blockSize ) );
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         indices[k++] = element->index();
+         if( k == blockSize ) {
+            write( indices.data(), k*sizeof( uint64_t ) );
+            k = 0UL;
+         }
+      }
+   }
+   write( indices.data(), k*sizeof( uint64_t ) );
+   pad();
+
+   std::vector<ET> values( min( pointers[M], blockSize ) );
+   k = 0UL;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( ConstIterator element=A.begin(i); element!=A.end(i); ++element ) {
+         values[k++] = element->value();
+         if( k == blockSize ) {
+            write( values.data(), k*sizeof( ET ) );
+            k = 0UL;
+         }
+      }
+   }
+   write( values.data(), k*sizeof( ET ) );
+   pad();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Closing the archive file.
+//
+// \return void
+// \exception std::runtime_error Writing the file failed.
+//
+// This function flushes all pending data and closes the archive file. In case the file is not
+// explicitly closed, it is closed by the destructor of the writer, which however cannot report
+// any errors.
+*/
+inline void MappedArchiveWriter::close()
+{
+   stream_.close();
+
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Writing file failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the spacing between two rows/columns.
+//
+// \param n The number of elements per row/column.
+// \return The number of elements between the beginning of two rows/columns.
+*/
+template< typename Type >  // Data type of the elements
+inline size_t MappedArchiveWriter::spacing( size_t n ) noexcept
+{
+   constexpr size_t elements( MappedArchiveHeader::alignment / sizeof( Type ) );
+   return nextMultiple<size_t>( n, ( elements > 1UL )?( elements ):( 1UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the header of an object.
+//
+// \param type The type of the object.
+// \param flag The transpose flag or storage order of the object.
+// \param m The size of the vector or the number of rows of the matrix.
+// \param n The number of columns of the matrix (1 for vectors).
+// \return The object header.
+*/
+template< typename Type >  // Data type of the elements
+inline MappedObjectHeader MappedArchiveWriter::header( uint32_t type, bool flag, size_t m, size_t n )
+{
+   const bool   vector( type == MappedObjectHeader::denseVector );
+   const size_t M( vector ? 1UL : ( flag ? n : m ) );
+   const size_t N( vector ? m : ( flag ? m : n ) );
+
+   MappedObjectHeader object = {};
+   object.type        = type;
+   object.elementType = TypeValueMapping<Type>::value;
+   object.elementSize = sizeof( Type );
+   object.flag        = static_cast<uint32_t>( flag );
+   object.rows        = m;
+   object.columns     = n;
+   object.spacing     = spacing<Type>( N );
+   object.size        = sizeof( MappedObjectHeader ) + M * object.spacing * sizeof( Type );
+
+   return object;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing raw data to the archive file.
+//
+// \param data The data to be written.
+// \param bytes The number of bytes to be written.
+// \return void
+// \exception std::runtime_error Writing the file failed.
+*/
+inline void MappedArchiveWriter::write( const void* data, size_t bytes )
+{
+   stream_.write( static_cast<const char*>( data ), static_cast<std::streamsize>( bytes ) );
+   offset_ += bytes;
+
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Writing file failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Padding the archive file with zeros to the next multiple of the alignment.
+//
+// \return void
+// \exception std::runtime_error Writing the file failed.
+*/
+inline void MappedArchiveWriter::pad()
+{
+   static const byte_t zeros[MappedArchiveHeader::alignment] = {};
+
+   const size_t remainder( offset_ % MappedArchiveHeader::alignment );
+
+   if( remainder != 0UL ) {
+      write( zeros, MappedArchiveHeader::alignment - remainder );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MAPPEDARCHIVE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Zero-copy loader for memory-mapped archives.
+// \ingroup serialization
+//
+// The MappedArchive class maps an archive written by the MappedArchiveWriter class into memory
+// and provides direct access to the stored vectors and matrices without copying or converting
+// any elements. Dense vectors and matrices are accessed via unpadded CustomVector and
+// CustomMatrix instances, sparse matrices via CompressedView instances, which all refer
+// directly to the mapped file. The objects are extracted in the same order as they have been
+// written:
+
+   \code
+   using blaze::aligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   blaze::MappedArchive archive( "model.blaze" );
+
+   blaze::CustomMatrix<double,aligned,unpadded,rowMajor> A;
+   blaze::CustomVector<double,aligned,unpadded,columnVector> b;
+   blaze::CompressedView<double,rowMajor> S;
+
+   archive >> A >> b >> S;
+
+   blaze::DynamicVector<double,columnVector> y( A * b + S * b );
+   \endcode
+
+// Since all sections of the archive are aligned to 64 bytes and all rows/columns of dense
+// matrices are padded to a multiple of 64 bytes, the extracted vectors and matrices can be used
+// with aligned custom types and all kernels are vectorized. The elements are loaded lazily by
+// the operating system on first access. Note however the following restrictions:
+//
+//  - The extracted vectors and matrices are only valid as long as the archive exists.
+//  - The element type and the storage order of the target must match the stored object. In
+//    case of a mismatch a \a std::invalid_argument exception is thrown.
+//  - In case the archive is mapped read-only (the default), the elements of the extracted
+//    vectors and matrices must not be modified. In case the archive is mapped with the
+//    \a readWrite mode, all modifications are written back to the file.
+//  - Since loading a sparse matrix only validates the row/column pointers, the indices of an
+//    untrusted file should be validated via the isIntact() function before use.
+*/
+class MappedArchive : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedArchive( const std::string& filename, MappingMode mode = readOnly );
+            inline MappedArchive( MappedArchive&& archive ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Input operators*****************************************************************************
+   /*!\name Input operators */
+   //@{
+   template< typename Type, bool AF, bool TF >
+   inline MappedArchive& operator>>( CustomVector<Type,AF,unpadded,TF>& vec );
+
+   template< typename Type, bool AF, bool SO >
+   inline MappedArchive& operator>>( CustomMatrix<Type,AF,unpadded,SO>& mat );
+
+   template< typename Type, bool SO >
+   inline MappedArchive& operator>>( CompressedView<Type,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isEmpty() const noexcept;
+   inline void advise( AccessAdvice advice );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   inline MappedObjectHeader next( uint32_t type ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;    //!< The memory-mapped archive file.
+   size_t     offset_;  //!< The offset of the next object within the file in bytes.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == sizeof( uint64_t ) );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mapping an existing archive file.
+//
+// \param filename The name of the archive file.
+// \param mode The access mode of the mapping (\a readOnly or \a readWrite).
+// \exception std::runtime_error Mapping the file failed.
+// \exception std::invalid_argument Invalid archive file.
+//
+// This constructor maps the given archive file into memory. In case the file cannot be mapped,
+// a \a std::runtime_error exception is thrown. In case the file is no valid archive file or
+// has been written by a newer version of the file format, a \a std::invalid_argument exception
+// is thrown.
+*/
+inline MappedArchive::MappedArchive( const std::string& filename, MappingMode mode )
+   : file_  ( filename, mode )               // The memory-mapped archive file
+   , offset_( sizeof( MappedArchiveHeader ) )  // The offset of the next object within the file in bytes
+{
+   if( file_.size() < sizeof( MappedArchiveHeader ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   MappedArchiveHeader header;
+   std::memcpy( &header, file_.data(), sizeof( MappedArchiveHeader ) );
+
+   if( std::memcmp( header.magic, "BLAZEARC", 8UL ) != 0 ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   if( header.version != MappedArchiveHeader::currentVersion ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported archive version" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MappedArchive.
+//
+// \param archive The archive to be moved into this instance.
+//
+// Note that all vectors and matrices extracted from the given archive remain valid.
+*/
+inline MappedArchive::MappedArchive( MappedArchive&& archive ) noexcept
+   : file_  ( std::move( archive.file_ ) )  // The memory-mapped archive file
+   , offset_( archive.offset_ )             // The offset of the next object within the file in bytes
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INPUT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Extracting the next dense vector from the archive.
+//
+// \param vec The custom vector to be reset to the mapped elements.
+// \return Reference to the archive.
+// \exception std::runtime_error End of archive reached.
+// \exception std::invalid_argument Invalid archive file.
+//
+// This function resets the given custom vector to the elements of the next object of the
+// archive. In case the next object is not a dense vector or in case its element type doesn't
+// match, a \a std::invalid_argument exception is thrown. In case no further object is stored
+// in the archive, a \a std::runtime_error is thrown. In both cases the given vector and the
+// archive remain unchanged.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool TF >      // Transpose flag
+inline MappedArchive& MappedArchive::operator>>( CustomVector<Type,AF,unpadded,TF>& vec )
+{
+   const MappedObjectHeader object( next<Type>( MappedObjectHeader::denseVector ) );
+
+   if( object.spacing < object.rows ||
+       object.spacing > ( object.size - sizeof( MappedObjectHeader ) ) / sizeof( Type ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   Type* const ptr( reinterpret_cast<Type*>( file_.data() + offset_ + sizeof( MappedObjectHeader ) ) );
+
+   vec.reset( ptr, object.rows );
+   offset_ += object.size;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracting the next dense matrix from the archive.
+//
+// \param mat The custom matrix to be reset to the mapped elements.
+// \return Reference to the archive.
+// \exception std::runtime_error End of archive reached.
+// \exception std::invalid_argument Invalid archive file.
+//
+// This function resets the given custom matrix to the elements of the next object of the
+// archive. In case the next object is not a dense matrix or in case its element type or storage
+// order doesn't match, a \a std::invalid_argument exception is thrown. In case no further object
+// is stored in the archive, a \a std::runtime_error is thrown. In both cases the given matrix
+// and the archive remain unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool SO >      // Storage order
+inline MappedArchive& MappedArchive::operator>>( CustomMatrix<Type,AF,unpadded,SO>& mat )
+{
+   const MappedObjectHeader object( next<Type>( MappedObjectHeader::denseMatrix ) );
+
+   if( object.flag != static_cast<uint32_t>( SO ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid storage order" );
+   }
+
+   const size_t M( SO ? object.columns : object.rows );
+   const size_t N( SO ? object.rows : object.columns );
+
+   if( object.spacing < N || ( M > 0UL && object.spacing >
+       ( object.size - sizeof( MappedObjectHeader ) ) / sizeof( Type ) / M ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   Type* const ptr( reinterpret_cast<Type*>( file_.data() + offset_ + sizeof( MappedObjectHeader ) ) );
+
+   mat.reset( ptr, object.rows, object.columns, object.spacing );
+   offset_ += object.size;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracting the next sparse matrix from the archive.
+//
+// \param mat The compressed view to be reset to the mapped elements.
+// \return Reference to the archive.
+// \exception std::runtime_error End of archive reached.
+// \exception std::invalid_argument Invalid archive file.
+//
+// This function resets the given compressed view to the elements of the next object of the
+// archive. In case the next object is not a sparse matrix or in case its element type or
+// storage order doesn't match, a \a std::invalid_argument exception is thrown. In case no
+// further object is stored in the archive, a \a std::runtime_error is thrown. In both cases
+// the given view and the archive remain unchanged.
+//
+// This function validates the row/column pointers of the sparse matrix, but not the indices
+// of the non-zero elements. In order to validate the indices, the isIntact() function can be
+// used.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedArchive& MappedArchive::operator>>( CompressedView<Type,SO>& mat )
+{
+   constexpr size_t alignment( MappedArchiveHeader::alignment );
+
+   const MappedObjectHeader object( next<Type>( MappedObjectHeader::sparseMatrix ) );
+
+   if( object.flag != static_cast<uint32_t>( SO ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid storage order" );
+   }
+
+   const size_t M    ( SO ? object.columns : object.rows );
+   const size_t bytes( object.size - sizeof( MappedObjectHeader ) );
+
+   if( M >= bytes / sizeof( size_t ) || object.nonZeros > bytes / sizeof( size_t ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   const size_t pointerBytes( nextMultiple<size_t>( ( M+1UL )*sizeof( size_t ), alignment ) );
+   const size_t indexBytes  ( nextMultiple<size_t>( object.nonZeros*sizeof( size_t ), alignment ) );
+   const size_t valueBytes  ( nextMultiple<size_t>( object.nonZeros*sizeof( Type ), alignment ) );
+
+   if( pointerBytes + indexBytes > bytes || valueBytes > bytes - pointerBytes - indexBytes ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   const byte_t* const data( file_.data() + offset_ + sizeof( MappedObjectHeader ) );
+
+   const size_t* const pointers( reinterpret_cast<const size_t*>( data ) );
+   const size_t* const indices ( reinterpret_cast<const size_t*>( data + pointerBytes ) );
+   const Type*   const values  ( reinterpret_cast<const Type*>( data + pointerBytes + indexBytes ) );
+
+   if( pointers[0UL] != 0UL || pointers[M] != object.nonZeros ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      if( pointers[i] > pointers[i+1UL] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+      }
+   }
+
+   mat.reset( object.rows, object.columns, pointers, indices, values );
+   offset_ += object.size;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether all objects have been extracted from the archive.
+//
+// \return \a true in case no further object is stored in the archive, \a false if not.
+*/
+inline bool MappedArchive::isEmpty() const noexcept
+{
+   return offset_ >= file_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advising the operating system about the access pattern of the archive.
+//
+// \param advice The expected access pattern.
+// \return void
+// \exception std::runtime_error Invalid advice.
+//
+// This function forwards the expected access pattern of the entire archive to the operating
+// system. For instance, the \a willNeedAccess advice triggers an asynchronous read-ahead of
+// the archive file.
+*/
+inline void MappedArchive::advise( AccessAdvice advice )
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Validating the header of the next object of the archive.
+//
+// \param type The expected type of the object.
+// \return The header of the next object.
+// \exception std::runtime_error End of archive reached.
+// \exception std::invalid_argument Invalid archive file.
+*/
+template< typename Type >  // Data type of the elements
+inline MappedObjectHeader MappedArchive::next( uint32_t type ) const
+{
+   if( isEmpty() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "End of archive reached" );
+   }
+
+   if( file_.size() - offset_ < sizeof( MappedObjectHeader ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   MappedObjectHeader object;
+   std::memcpy( &object, file_.data() + offset_, sizeof( MappedObjectHeader ) );
+
+   if( object.size < sizeof( MappedObjectHeader ) ||
+       object.size % MappedArchiveHeader::alignment != 0UL ||
+       object.size > file_.size() - offset_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid archive file" );
+   }
+
+   if( object.type != type ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid object type" );
+   }
+
+   if( object.elementType != TypeValueMapping<Type>::value ||
+       object.elementSize != sizeof( Type ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type" );
+   }
+
+   return object;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
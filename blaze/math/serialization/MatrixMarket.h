@@ -0,0 +1,1256 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MatrixMarket.h
+//  \brief Header file for the Matrix Market file I/O
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MATRIXMARKET_H_
+#define _BLAZE_MATH_SERIALIZATION_MATRIXMARKET_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedView.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSigned.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MATRIXMARKETHEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Header information of a Matrix Market file.
+// \ingroup math_serialization
+//
+// The header consists of the banner line (e.g. "%%MatrixMarket matrix coordinate real general"),
+// optional comment lines and the size line. The data lines start at the given offset.
+*/
+struct MatrixMarketHeader
+{
+   //**Type definitions****************************************************************************
+   //! The type of the stored values.
+   enum Field { realField, integerField, complexField, patternField };
+
+   //! The symmetry of the stored matrix.
+   enum Symmetry { general, symmetric, skewSymmetric, hermitian };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   bool     coordinate;  //!< \a true for the coordinate format, \a false for the array format.
+   Field    field;       //!< The type of the stored values.
+   Symmetry symmetry;    //!< The symmetry of the stored matrix.
+   size_t   rows;        //!< The number of rows of the matrix.
+   size_t   columns;     //!< The number of columns of the matrix.
+   size_t   entries;     //!< The number of stored entries.
+   size_t   offset;      //!< The offset of the first data line in bytes.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MATRIXMARKETCHUNK
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The entries parsed from a single chunk of a Matrix Market file.
+// \ingroup math_serialization
+//
+// In case of the array format only the values are stored. Any error encountered during the
+// parsing of the chunk is stored as exception pointer in order to be rethrown by the calling
+// thread.
+*/
+template< typename Type >  // Type of the values
+struct MatrixMarketChunk
+{
+   std::vector<size_t> rows;     //!< The zero-based row indices of the entries.
+   std::vector<size_t> columns;  //!< The zero-based column indices of the entries.
+   std::vector<Type>   values;   //!< The values of the entries.
+   std::exception_ptr  error;    //!< The error encountered during the parsing of the chunk.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX MARKET PARSING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Skipping all blanks within the current line of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param pos Pointer to the current character.
+// \param last Pointer one past the last character of the chunk.
+// \return Pointer to the first character that is no blank.
+*/
+inline const char* skipMatrixMarketBlanks( const char* pos, const char* last ) noexcept
+{
+   while( pos != last && ( *pos == ' ' || *pos == '\t' || *pos == '\r' ) ) {
+      ++pos;
+   }
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing the header of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param first Pointer to the first character of the file.
+// \param last Pointer one past the last character of the file.
+// \return The header information of the file.
+// \exception std::invalid_argument Invalid Matrix Market file.
+*/
+inline MatrixMarketHeader parseMatrixMarketHeader( const char* first, const char* last )
+{
+   const char* eol( std::find( first, last, '\n' ) );
+
+   std::string banner( first, eol );
+   std::transform( banner.begin(), banner.end(), banner.begin(),
+                   []( char c ){ return static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) ); } );
+
+   std::istringstream iss( banner );
+   std::string magic, object, format, field, symmetry;
+   iss >> magic >> object >> format >> field >> symmetry;
+
+   if( !iss || magic != "%%matrixmarket" || object != "matrix" ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid Matrix Market file" );
+   }
+
+   MatrixMarketHeader header = {};
+
+   if     ( format == "coordinate" ) header.coordinate = true;
+   else if( format == "array"      ) header.coordinate = false;
+   else BLAZE_THROW_INVALID_ARGUMENT( "Unsupported Matrix Market format" );
+
+   if     ( field == "real" || field == "double" ) header.field = MatrixMarketHeader::realField;
+   else if( field == "integer" ) header.field = MatrixMarketHeader::integerField;
+   else if( field == "complex" ) header.field = MatrixMarketHeader::complexField;
+   else if( field == "pattern" && header.coordinate ) header.field = MatrixMarketHeader::patternField;
+   else BLAZE_THROW_INVALID_ARGUMENT( "Unsupported Matrix Market field" );
+
+   if     ( symmetry == "general"        ) header.symmetry = MatrixMarketHeader::general;
+   else if( symmetry == "symmetric"      ) header.symmetry = MatrixMarketHeader::symmetric;
+   else if( symmetry == "skew-symmetric" ) header.symmetry = MatrixMarketHeader::skewSymmetric;
+   else if( symmetry == "hermitian"      ) header.symmetry = MatrixMarketHeader::hermitian;
+   else BLAZE_THROW_INVALID_ARGUMENT( "Unsupported Matrix Market symmetry" );
+
+   while( eol != last )
+   {
+      const char* const pos( eol + 1 );
+      eol = std::find( pos, last, '\n' );
+
+      const char* const begin( skipMatrixMarketBlanks( pos, eol ) );
+
+      if( begin == eol || *begin == '%' )
+         continue;
+
+      std::istringstream sizes( std::string( begin, eol ) );
+      sizes >> header.rows >> header.columns;
+
+      if( header.coordinate )
+         sizes >> header.entries;
+      else
+         header.entries = header.rows * header.columns;
+
+      if( !sizes ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid Matrix Market file" );
+      }
+
+      if( header.symmetry != MatrixMarketHeader::general && header.rows != header.columns ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid Matrix Market file" );
+      }
+
+      header.offset = static_cast<size_t>( ( eol != last ? eol+1 : eol ) - first );
+      return header;
+   }
+
+   BLAZE_THROW_INVALID_ARGUMENT( "Invalid Matrix Market file" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing a one-based index of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param pos Pointer to the current character.
+// \param last Pointer one past the last character of the chunk.
+// \param size The upper bound for the index.
+// \param index The resulting zero-based index.
+// \return Pointer to the first character after the index.
+// \exception std::invalid_argument Invalid index.
+*/
+inline const char* parseMatrixMarketIndex( const char* pos, const char* last, size_t size, size_t& index )
+{
+   pos = skipMatrixMarketBlanks( pos, last );
+
+   size_t value( 0UL );
+   const char* const begin( pos );
+
+   while( pos != last && *pos >= '0' && *pos <= '9' ) {
+      value = value*10UL + static_cast<size_t>( *pos - '0' );
+      ++pos;
+   }
+
+   if( pos == begin || pos - begin > 19 || value == 0UL || value > size ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid index in Matrix Market file" );
+   }
+
+   index = value - 1UL;
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converting an integral number of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param pos Pointer to the first character of the number.
+// \param value The resulting value.
+// \return Pointer to the first character after the number.
+*/
+inline const char* convertMatrixMarketNumber( const char* pos, long long& value )
+{
+   char* end( nullptr );
+   value = std::strtoll( pos, &end, 10 );
+   return end;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converting a floating point number of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param pos Pointer to the first character of the number.
+// \param value The resulting value.
+// \return Pointer to the first character after the number.
+//
+// Numbers with a mantissa of at most 53 bits (after the removal of trailing zeros) and a decimal
+// exponent within \f$[-22..22]\f$ are converted by a single exact multiplication or division,
+// which yields the correctly rounded result. All other numbers (including infinity and NaN) are
+// converted by \c std::strtod().
+*/
+inline const char* convertMatrixMarketNumber( const char* pos, double& value )
+{
+   static const double powers[] = { 1E0 , 1E1 , 1E2 , 1E3 , 1E4 , 1E5 , 1E6 , 1E7 ,
+                                    1E8 , 1E9 , 1E10, 1E11, 1E12, 1E13, 1E14, 1E15,
+                                    1E16, 1E17, 1E18, 1E19, 1E20, 1E21, 1E22 };
+
+   constexpr uint64_t maxMantissa( 9007199254740992ULL );
+
+   const char* ptr( pos );
+   const bool negative( *ptr == '-' );
+
+   if( *ptr == '-' || *ptr == '+' ) ++ptr;
+
+   uint64_t mantissa( 0ULL );
+   int exponent( 0 ), digits( 0 );
+   bool valid( false ), exact( true );
+
+   for( ; *ptr >= '0' && *ptr <= '9'; ++ptr, valid=true ) {
+      if( digits < 19 ) {
+         mantissa = mantissa*10ULL + static_cast<uint64_t>( *ptr - '0' );
+         if( mantissa != 0ULL ) ++digits;
+      }
+      else {
+         exact = exact && ( *ptr == '0' );
+         ++exponent;
+      }
+   }
+
+   if( *ptr == '.' ) {
+      for( ++ptr; *ptr >= '0' && *ptr <= '9'; ++ptr, valid=true ) {
+         if( digits < 19 ) {
+            mantissa = mantissa*10ULL + static_cast<uint64_t>( *ptr - '0' );
+            if( mantissa != 0ULL ) ++digits;
+            --exponent;
+         }
+         else exact = exact && ( *ptr == '0' );
+      }
+   }
+
+   if( valid && ( *ptr == 'e' || *ptr == 'E' ) ) {
+      const char* const e( ptr+1 );
+      const bool negativeExponent( *e == '-' );
+      const char* digit( ( *e == '-' || *e == '+' ) ? e+1 : e );
+      int tmp( 0 );
+      if( *digit >= '0' && *digit <= '9' ) {
+         for( ; *digit >= '0' && *digit <= '9'; ++digit ) {
+            if( tmp < 10000 ) tmp = tmp*10 + ( *digit - '0' );
+         }
+         exponent += ( negativeExponent ? -tmp : tmp );
+         ptr = digit;
+      }
+   }
+
+   while( mantissa > maxMantissa && mantissa % 10ULL == 0ULL ) {
+      mantissa /= 10ULL;
+      ++exponent;
+   }
+
+   if( valid && exact && mantissa <= maxMantissa && exponent >= -22 && exponent <= 22 ) {
+      const double tmp( static_cast<double>( mantissa ) );
+      value = ( exponent < 0 )?( tmp / powers[-exponent] ):( tmp * powers[exponent] );
+      if( negative ) value = -value;
+      return ptr;
+   }
+
+   char* end( nullptr );
+   value = std::strtod( pos, &end );
+   return end;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing a single number of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param pos Pointer to the current character.
+// \param last Pointer one past the last character of the chunk.
+// \param value The resulting value.
+// \return Pointer to the first character after the number.
+// \exception std::invalid_argument Invalid value.
+//
+// This function requires the current line to be terminated by a newline character or a null
+// character within the chunk, which prevents the conversion from reading beyond the chunk.
+*/
+template< typename T >  // Type of the number (double or long long)
+inline const char* parseMatrixMarketNumber( const char* pos, const char* last, T& value )
+{
+   pos = skipMatrixMarketBlanks( pos, last );
+
+   if( pos == last || *pos == '\n' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid value in Matrix Market file" );
+   }
+
+   const char* const end( convertMatrixMarketNumber( pos, value ) );
+
+   if( end == pos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid value in Matrix Market file" );
+   }
+
+   return end;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a complex value from the parsed real and imaginary part.
+// \ingroup math_serialization
+//
+// \param re The real part of the value.
+// \param im The imaginary part of the value.
+// \return The resulting complex value.
+*/
+template< typename Type >  // Type of the value
+inline EnableIf_< IsComplex<Type>, Type > makeMatrixMarketComplex( double re, double im )
+{
+   using ValueType = typename Type::value_type;
+   return Type( static_cast<ValueType>( re ), static_cast<ValueType>( im ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a non-complex value from the parsed real and imaginary part.
+// \ingroup math_serialization
+//
+// \param re The real part of the value.
+// \param im The imaginary part of the value.
+// \return The resulting value.
+//
+// This function is never called, since the field of the file is checked in advance. It only
+// exists to enable the instantiation of the parsing function for non-complex element types.
+*/
+template< typename Type >  // Type of the value
+inline DisableIf_< IsComplex<Type>, Type > makeMatrixMarketComplex( double re, double im )
+{
+   UNUSED_PARAMETER( im );
+   return static_cast<Type>( re );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing a single value of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param pos Pointer to the current character.
+// \param last Pointer one past the last character of the chunk.
+// \param field The type of the stored values.
+// \param value The resulting value.
+// \return Pointer to the first character after the value.
+// \exception std::invalid_argument Invalid value.
+*/
+template< typename Type >  // Type of the value
+inline const char* parseMatrixMarketValue( const char* pos, const char* last,
+                                           MatrixMarketHeader::Field field, Type& value )
+{
+   switch( field )
+   {
+      case MatrixMarketHeader::patternField: {
+         value = Type( 1 );
+         return pos;
+      }
+      case MatrixMarketHeader::integerField: {
+         long long tmp( 0LL );
+         pos = parseMatrixMarketNumber( pos, last, tmp );
+         value = Type( tmp );
+         return pos;
+      }
+      case MatrixMarketHeader::complexField: {
+         double re( 0.0 ), im( 0.0 );
+         pos = parseMatrixMarketNumber( pos, last, re );
+         pos = parseMatrixMarketNumber( pos, last, im );
+         value = makeMatrixMarketComplex<Type>( re, im );
+         return pos;
+      }
+      default: {
+         double tmp( 0.0 );
+         pos = parseMatrixMarketNumber( pos, last, tmp );
+         value = Type( tmp );
+         return pos;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing all data lines of a single chunk of a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param first Pointer to the first character of the chunk.
+// \param last Pointer one past the last character of the chunk.
+// \param header The header information of the file.
+// \param chunk The resulting entries of the chunk.
+// \return void
+// \exception std::invalid_argument Invalid data line.
+//
+// The chunk is expected to consist of complete lines, i.e. all lines except the last line of
+// the file have to be terminated by a newline character.
+*/
+template< typename Type >  // Type of the values
+void parseMatrixMarketChunk( const char* first, const char* last,
+                             const MatrixMarketHeader& header, MatrixMarketChunk<Type>& chunk )
+{
+   const size_t estimate( static_cast<size_t>( last - first ) / ( header.coordinate ? 16UL : 8UL ) );
+
+   if( header.coordinate ) {
+      chunk.rows.reserve( estimate );
+      chunk.columns.reserve( estimate );
+   }
+   chunk.values.reserve( estimate );
+
+   const char* pos( first );
+
+   while( pos != last )
+   {
+      pos = skipMatrixMarketBlanks( pos, last );
+
+      if( pos != last && *pos == '%' ) {
+         pos = std::find( pos, last, '\n' );
+      }
+
+      if( pos == last || *pos == '\n' || *pos == '\0' ) {
+         if( pos != last ) ++pos;
+         continue;
+      }
+
+      if( header.coordinate ) {
+         size_t i( 0UL ), j( 0UL );
+         pos = parseMatrixMarketIndex( pos, last, header.rows   , i );
+         pos = parseMatrixMarketIndex( pos, last, header.columns, j );
+         chunk.rows.push_back( i );
+         chunk.columns.push_back( j );
+      }
+
+      Type value{};
+      pos = parseMatrixMarketValue( pos, last, header.field, value );
+      chunk.values.push_back( value );
+
+      pos = skipMatrixMarketBlanks( pos, last );
+
+      if( pos != last && *pos != '\n' && *pos != '\0' ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid data line in Matrix Market file" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing the data lines of a Matrix Market file in parallel.
+// \ingroup math_serialization
+//
+// \param first Pointer to the first data line.
+// \param last Pointer one past the last character of the file.
+// \param header The header information of the file.
+// \return The entries of all chunks in the order of the file.
+// \exception std::invalid_argument Invalid data line.
+//
+// The data lines are split into chunks of approximately 4 MiB at line boundaries, which are
+// parsed in parallel by means of the active SMP backend. Since the conversion functions rely
+// on a terminating character, a last line without trailing newline is copied into a string
+// and parsed separately.
+*/
+template< typename Type >  // Type of the values
+std::vector< MatrixMarketChunk<Type> >
+   parseMatrixMarketData( const char* first, const char* last, const MatrixMarketHeader& header )
+{
+   constexpr size_t chunkSize( 4194304UL );
+
+   const char* end( last );
+   while( end != first && *(end-1) != '\n' ) {
+      --end;
+   }
+
+   std::vector<const char*> bounds( 1UL, first );
+
+   for( const char* pos=first+chunkSize; pos<end; pos+=chunkSize ) {
+      const char* const next( std::find( pos-1, end, '\n' ) );
+      bounds.push_back( std::max( bounds.back(), next != end ? next+1 : end ) );
+   }
+
+   bounds.push_back( end );
+
+   const size_t chunks( bounds.size() - 1UL );
+   std::vector< MatrixMarketChunk<Type> > result( chunks + 1UL );
+
+   smpFor( chunks, [&]( size_t k )
+   {
+      try {
+         parseMatrixMarketChunk( bounds[k], bounds[k+1UL], header, result[k] );
+      }
+      catch( ... ) {
+         result[k].error = std::current_exception();
+      }
+   } );
+
+   const std::string tail( end, last );
+   parseMatrixMarketChunk( tail.c_str(), tail.c_str() + tail.size(), header, result[chunks] );
+
+   for( const MatrixMarketChunk<Type>& chunk : result ) {
+      if( chunk.error ) {
+         std::rethrow_exception( chunk.error );
+      }
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computing the mirrored value of an entry of a symmetric Matrix Market file.
+// \ingroup math_serialization
+//
+// \param value The stored value.
+// \param symmetry The symmetry of the matrix.
+// \return The value of the mirrored entry.
+*/
+template< typename Type >  // Type of the value
+inline Type mirrorMatrixMarketValue( const Type& value, MatrixMarketHeader::Symmetry symmetry )
+{
+   if( symmetry == MatrixMarketHeader::skewSymmetric )
+      return -value;
+   else if( symmetry == MatrixMarketHeader::hermitian )
+      return conj( value );
+   else return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assembling a matrix from the parsed entries of a coordinate Matrix Market file.
+// \ingroup math_serialization
+//
+// \param mat The target matrix.
+// \param header The header information of the file.
+// \param chunks The parsed entries of the file.
+// \return void
+// \exception std::invalid_argument Invalid number of entries.
+//
+// The entries are sorted into compressed row (row-major) or column (column-major) arrays, which
+// are assigned to the target matrix via a blaze::CompressedView. Duplicate entries are summed.
+*/
+template< typename MT       // Type of the target matrix
+        , bool SO           // Storage order of the target matrix
+        , typename Type >   // Type of the values
+void assembleMatrixMarketCoordinate( Matrix<MT,SO>& mat, const MatrixMarketHeader& header,
+                                     std::vector< MatrixMarketChunk<Type> >& chunks )
+{
+   const bool mirror( header.symmetry != MatrixMarketHeader::general );
+   const size_t outer( SO ? header.columns : header.rows );
+
+   size_t entries( 0UL );
+   for( const MatrixMarketChunk<Type>& chunk : chunks ) {
+      entries += chunk.values.size();
+   }
+
+   if( entries != header.entries ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of entries in Matrix Market file" );
+   }
+
+   std::vector<size_t> pointers( outer+1UL, 0UL );
+
+   for( const MatrixMarketChunk<Type>& chunk : chunks ) {
+      for( size_t k=0UL; k<chunk.values.size(); ++k ) {
+         const size_t i( chunk.rows[k] ), j( chunk.columns[k] );
+         ++pointers[( SO ? j : i )+1UL];
+         if( mirror && i != j )
+            ++pointers[( SO ? i : j )+1UL];
+      }
+   }
+
+   for( size_t k=1UL; k<=outer; ++k ) {
+      pointers[k] += pointers[k-1UL];
+   }
+
+   std::vector<size_t> indices( pointers[outer] );
+   std::vector<Type>   values ( pointers[outer] );
+
+   {
+      std::vector<size_t> positions( pointers.begin(), pointers.end()-1 );
+
+      for( MatrixMarketChunk<Type>& chunk : chunks )
+      {
+         for( size_t k=0UL; k<chunk.values.size(); ++k ) {
+            const size_t i( chunk.rows[k] ), j( chunk.columns[k] );
+            size_t& pos( positions[SO ? j : i] );
+            indices[pos] = ( SO ? i : j );
+            values [pos] = chunk.values[k];
+            ++pos;
+            if( mirror && i != j ) {
+               size_t& mpos( positions[SO ? i : j] );
+               indices[mpos] = ( SO ? j : i );
+               values [mpos] = mirrorMatrixMarketValue( chunk.values[k], header.symmetry );
+               ++mpos;
+            }
+         }
+
+         MatrixMarketChunk<Type>().rows.swap( chunk.rows );
+         MatrixMarketChunk<Type>().columns.swap( chunk.columns );
+         MatrixMarketChunk<Type>().values.swap( chunk.values );
+      }
+   }
+
+   constexpr size_t blockSize( 4096UL );
+   const size_t blocks( ( outer + blockSize - 1UL ) / blockSize );
+   std::vector<size_t> ends( pointers.begin()+1, pointers.end() );
+
+   smpFor( blocks, [&]( size_t block )
+   {
+      std::vector< std::pair<size_t,Type> > tmp;
+
+      for( size_t k=block*blockSize; k<min( outer, (block+1UL)*blockSize ); ++k )
+      {
+         const size_t begin( pointers[k] ), end( pointers[k+1UL] );
+
+         if( std::adjacent_find( indices.begin()+begin, indices.begin()+end,
+                                 []( size_t a, size_t b ){ return a >= b; } ) == indices.begin()+end )
+            continue;
+
+         tmp.clear();
+         for( size_t l=begin; l<end; ++l ) {
+            tmp.emplace_back( indices[l], values[l] );
+         }
+
+         std::stable_sort( tmp.begin(), tmp.end(),
+                           []( const std::pair<size_t,Type>& a, const std::pair<size_t,Type>& b ) {
+                              return a.first < b.first;
+                           } );
+
+         size_t pos( begin );
+         for( size_t l=0UL; l<tmp.size(); ++l ) {
+            if( pos != begin && indices[pos-1UL] == tmp[l].first ) {
+               values[pos-1UL] += tmp[l].second;
+            }
+            else {
+               indices[pos] = tmp[l].first;
+               values [pos] = tmp[l].second;
+               ++pos;
+            }
+         }
+         ends[k] = pos;
+      }
+   } );
+
+   if( !std::equal( ends.begin(), ends.end(), pointers.begin()+1 ) )
+   {
+      size_t pos( 0UL );
+      for( size_t k=0UL; k<outer; ++k ) {
+         const size_t begin( pointers[k] );
+         pointers[k] = pos;
+         for( size_t l=begin; l<ends[k]; ++l, ++pos ) {
+            indices[pos] = indices[l];
+            values [pos] = values[l];
+         }
+      }
+      pointers[outer] = pos;
+   }
+
+   const CompressedView<Type,SO> view( header.rows, header.columns,
+                                       pointers.data(), indices.data(), values.data() );
+   ~mat = view;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assembling a matrix from the parsed entries of an array Matrix Market file.
+// \ingroup math_serialization
+//
+// \param mat The target matrix.
+// \param header The header information of the file.
+// \param chunks The parsed entries of the file.
+// \return void
+// \exception std::invalid_argument Invalid number of entries.
+//
+// The values of an array file are stored in column-major order. In case of a symmetric,
+// skew-symmetric or Hermitian matrix only the lower triangular part is stored.
+*/
+template< typename MT       // Type of the target matrix
+        , bool SO           // Storage order of the target matrix
+        , typename Type >   // Type of the values
+void assembleMatrixMarketArray( Matrix<MT,SO>& mat, const MatrixMarketHeader& header,
+                                std::vector< MatrixMarketChunk<Type> >& chunks )
+{
+   const size_t m( header.rows    );
+   const size_t n( header.columns );
+
+   size_t expected( m*n );
+   if( header.symmetry == MatrixMarketHeader::skewSymmetric )
+      expected = ( n*(n-1UL) ) / 2UL;
+   else if( header.symmetry != MatrixMarketHeader::general )
+      expected = ( n*(n+1UL) ) / 2UL;
+
+   size_t entries( 0UL );
+   for( const MatrixMarketChunk<Type>& chunk : chunks ) {
+      entries += chunk.values.size();
+   }
+
+   if( entries != expected ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of entries in Matrix Market file" );
+   }
+
+   DynamicMatrix<Type,columnMajor> tmp( m, n, Type() );
+
+   const size_t offset( header.symmetry == MatrixMarketHeader::skewSymmetric ? 1UL : 0UL );
+   size_t i( header.symmetry == MatrixMarketHeader::general ? 0UL : offset ), j( 0UL );
+
+   for( const MatrixMarketChunk<Type>& chunk : chunks ) {
+      for( const Type& value : chunk.values )
+      {
+         tmp(i,j) = value;
+         if( header.symmetry != MatrixMarketHeader::general && i != j )
+            tmp(j,i) = mirrorMatrixMarketValue( value, header.symmetry );
+
+         if( ++i == m ) {
+            ++j;
+            i = ( header.symmetry == MatrixMarketHeader::general ? 0UL : j+offset );
+         }
+      }
+   }
+
+   ~mat = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX MARKET FORMATTING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the Matrix Market field for the given element type.
+// \ingroup math_serialization
+//
+// \return The name of the field ("complex", "integer", or "real").
+*/
+template< typename Type >  // Type of the elements
+inline const char* matrixMarketField() noexcept
+{
+   return ( IsComplex<Type>::value ? "complex" : ( IsIntegral<Type>::value ? "integer" : "real" ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appending a one-based index to the given buffer.
+// \ingroup math_serialization
+//
+// \param buffer The output buffer.
+// \param index The zero-based index.
+// \return void
+*/
+inline void appendMatrixMarketIndex( std::string& buffer, size_t index )
+{
+   char digits[24];
+   char* pos( digits + 24 );
+
+   ++index;
+   do {
+      *--pos = static_cast<char>( '0' + index % 10UL );
+      index /= 10UL;
+   } while( index != 0UL );
+
+   buffer.append( pos, digits + 24 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appending an integral value to the given buffer.
+// \ingroup math_serialization
+//
+// \param buffer The output buffer.
+// \param value The value to be appended.
+// \return void
+*/
+template< typename Type >  // Type of the value
+inline EnableIf_< IsIntegral<Type> > appendMatrixMarketValue( std::string& buffer, Type value )
+{
+   char tmp[32];
+   const int length( IsSigned<Type>::value
+                     ? std::snprintf( tmp, sizeof( tmp ), "%lld", static_cast<long long>( value ) )
+                     : std::snprintf( tmp, sizeof( tmp ), "%llu", static_cast<unsigned long long>( value ) ) );
+   buffer.append( tmp, static_cast<size_t>( length ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appending a floating point value to the given buffer.
+// \ingroup math_serialization
+//
+// \param buffer The output buffer.
+// \param value The value to be appended.
+// \return void
+//
+// The value is written with the number of digits required for an exact round trip.
+*/
+template< typename Type >  // Type of the value
+inline DisableIf_< Or< IsIntegral<Type>, IsComplex<Type> > >
+   appendMatrixMarketValue( std::string& buffer, Type value )
+{
+   char tmp[64];
+   const int length( ( sizeof( Type ) > sizeof( double ) )
+                     ? std::snprintf( tmp, sizeof( tmp ), "%.*Lg", std::numeric_limits<Type>::max_digits10,
+                                      static_cast<long double>( value ) )
+                     : std::snprintf( tmp, sizeof( tmp ), "%.*g", std::numeric_limits<Type>::max_digits10,
+                                      static_cast<double>( value ) ) );
+   buffer.append( tmp, static_cast<size_t>( length ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Appending a complex value to the given buffer.
+// \ingroup math_serialization
+//
+// \param buffer The output buffer.
+// \param value The value to be appended.
+// \return void
+*/
+template< typename Type >  // Type of the value
+inline EnableIf_< IsComplex<Type> > appendMatrixMarketValue( std::string& buffer, const Type& value )
+{
+   appendMatrixMarketValue( buffer, value.real() );
+   buffer += ' ';
+   appendMatrixMarketValue( buffer, value.imag() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writing the given blocks of a matrix to a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param blocks The number of blocks.
+// \param format The formatting function for a single block.
+// \return void
+//
+// The blocks are formatted in parallel by means of the active SMP backend and are written in
+// ascending order. In order to limit the memory consumption, at most 64 formatted blocks are
+// kept in memory at any time.
+*/
+template< typename Formatter >  // Type of the formatting function
+void writeMatrixMarketBlocks( std::ostream& os, size_t blocks, const Formatter& format )
+{
+   constexpr size_t blocksPerPass( 64UL );
+
+   std::vector<std::string> buffers( min( blocks, blocksPerPass ) );
+
+   for( size_t first=0UL; first<blocks; first+=blocksPerPass )
+   {
+      const size_t count( min( blocksPerPass, blocks - first ) );
+
+      smpFor( count, [&]( size_t k ) {
+         buffers[k].clear();
+         format( first+k, buffers[k] );
+      } );
+
+      for( size_t k=0UL; k<count; ++k ) {
+         os.write( buffers[k].data(), static_cast<std::streamsize>( buffers[k].size() ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX MARKET I/O FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Matrix Market I/O functions */
+//@{
+template< typename MT, bool SO >
+void readMatrixMarket( const std::string& filename, Matrix<MT,SO>& mat );
+
+template< typename MT, bool SO >
+void writeMatrixMarket( const std::string& filename, const DenseMatrix<MT,SO>& mat );
+
+template< typename MT, bool SO >
+void writeMatrixMarket( const std::string& filename, const SparseMatrix<MT,SO>& mat );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a matrix from a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The matrix to be read.
+// \return void
+// \exception std::runtime_error Opening the file failed.
+// \exception std::invalid_argument Invalid Matrix Market file.
+//
+// This function reads the matrix stored in the given Matrix Market file (see
+// http://math.nist.gov/MatrixMarket/formats.html) into the given dense or sparse matrix. Both
+// the coordinate and the array format are supported, including the real, integer, complex, and
+// pattern fields and the general, symmetric, skew-symmetric, and Hermitian symmetries:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   blaze::readMatrixMarket( "A.mtx", A );
+   \endcode
+
+// The file is mapped into memory and split into chunks, which are parsed in parallel by means
+// of the active SMP backend. The parsed entries of a coordinate file are sorted into compressed
+// arrays in the storage order of the given matrix and are assigned in a single bulk operation.
+// Duplicate entries are summed. Note that complex files can only be read into matrices with
+// complex element type. In case the file cannot be opened, a \a std::runtime_error exception
+// is thrown. In case the file is no valid Matrix Market file, a \a std::invalid_argument
+// exception is thrown. In case the given matrix cannot be resized to the size of the stored
+// matrix or cannot represent the stored matrix (for instance a lower matrix and a general
+// matrix file), a \a std::invalid_argument exception is thrown, too.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void readMatrixMarket( const std::string& filename, Matrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   MappedFile file( filename, readOnly );
+   file.advise( sequentialAccess );
+
+   const char* const first( reinterpret_cast<const char*>( file.data() ) );
+   const char* const last ( first + file.size() );
+
+   const MatrixMarketHeader header( parseMatrixMarketHeader( first, last ) );
+
+   if( header.field == MatrixMarketHeader::complexField && !IsComplex<ET>::value ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type" );
+   }
+
+   std::vector< MatrixMarketChunk<ET> > chunks(
+      parseMatrixMarketData<ET>( first + header.offset, last, header ) );
+
+   file.close();
+
+   if( header.coordinate )
+      assembleMatrixMarketCoordinate( ~mat, header, chunks );
+   else
+      assembleMatrixMarketArray( ~mat, header, chunks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a dense matrix to a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The dense matrix to be written.
+// \return void
+// \exception std::runtime_error Writing the file failed.
+//
+// This function writes the given dense matrix in the general array format to the given file.
+// The field of the file ("real", "integer", or "complex") is chosen according to the element
+// type of the matrix. Floating point values are written with the number of digits required
+// for an exact round trip. The values are formatted in parallel by means of the active SMP
+// backend. In case the file cannot be written, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void writeMatrixMarket( const std::string& filename, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<MT> A( ~mat );
+
+   std::ofstream os( filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Opening file failed" );
+   }
+
+   const size_t m( A.rows()    );
+   const size_t n( A.columns() );
+
+   os << "%%MatrixMarket matrix array " << matrixMarketField<ET>() << " general\n"
+      << m << " " << n << "\n";
+
+   constexpr size_t entriesPerBlock( 16384UL );
+   const size_t columnsPerBlock( max( entriesPerBlock / max( m, 1UL ), 1UL ) );
+   const size_t blocks( ( n + columnsPerBlock - 1UL ) / columnsPerBlock );
+
+   writeMatrixMarketBlocks( os, blocks, [&]( size_t block, std::string& buffer )
+   {
+      const size_t jend( min( n, (block+1UL)*columnsPerBlock ) );
+
+      for( size_t j=block*columnsPerBlock; j<jend; ++j ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            appendMatrixMarketValue( buffer, A(i,j) );
+            buffer += '\n';
+         }
+      }
+   } );
+
+   os.close();
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Writing file failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a sparse matrix to a Matrix Market file.
+// \ingroup math_serialization
+//
+// \param filename The name of the Matrix Market file.
+// \param mat The sparse matrix to be written.
+// \return void
+// \exception std::runtime_error Writing the file failed.
+//
+// This function writes all non-zero elements of the given sparse matrix in the general
+// coordinate format to the given file. The entries are written row by row (row-major) or
+// column by column (column-major). The field of the file ("real", "integer", or "complex")
+// is chosen according to the element type of the matrix. Floating point values are written
+// with the number of digits required for an exact round trip. The entries are formatted in
+// parallel by means of the active SMP backend. In case the file cannot be written, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+void writeMatrixMarket( const std::string& filename, const SparseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<MT> A( ~mat );
+
+   std::ofstream os( filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Opening file failed" );
+   }
+
+   const size_t outer( SO ? A.columns() : A.rows() );
+
+   os << "%%MatrixMarket matrix coordinate " << matrixMarketField<ET>() << " general\n"
+      << A.rows() << " " << A.columns() << " " << A.nonZeros() << "\n";
+
+   constexpr size_t entriesPerBlock( 16384UL );
+   std::vector<size_t> bounds( 1UL, 0UL );
+
+   for( size_t k=0UL, entries=0UL; k<outer; ++k ) {
+      entries += A.nonZeros( k );
+      if( entries >= entriesPerBlock ) {
+         bounds.push_back( k+1UL );
+         entries = 0UL;
+      }
+   }
+
+   if( bounds.back() != outer ) {
+      bounds.push_back( outer );
+   }
+
+   writeMatrixMarketBlocks( os, bounds.size()-1UL, [&]( size_t block, std::string& buffer )
+   {
+      for( size_t k=bounds[block]; k<bounds[block+1UL]; ++k ) {
+         for( auto element=A.begin(k); element!=A.end(k); ++element ) {
+            appendMatrixMarketIndex( buffer, SO ? element->index() : k );
+            buffer += ' ';
+            appendMatrixMarketIndex( buffer, SO ? k : element->index() );
+            buffer += ' ';
+            appendMatrixMarketValue( buffer, element->value() );
+            buffer += '\n';
+         }
+      }
+   } );
+
+   os.close();
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Writing file failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
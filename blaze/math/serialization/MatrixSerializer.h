@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstring>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
@@ -49,12 +51,15 @@
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
@@ -154,6 +159,12 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// For matrices with numeric element type the serializer transfers complete rows/columns of
+// dense matrices and blocks of index/value pairs of sparse matrices with a single call to the
+// \c write() or \c read() function of the archive. Dense matrices providing direct access to
+// their elements (as for instance DynamicMatrix) are written from and read into their storage
+// without intermediate copies.
 */
 class MatrixSerializer
 {
@@ -235,10 +246,26 @@ class MatrixSerializer
    void serializeHeader( Archive& archive, const MT& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+   EnableIf_< And< HasConstDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   DisableIf_< And< HasConstDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
    void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename ET, typename Archive, typename Iterator >
+   EnableIf_< IsNumeric<ET> >
+      serializeSparseElements( Archive& archive, size_t number, Iterator first, Iterator last );
+
+   template< typename ET, typename Archive, typename Iterator >
+   DisableIf_< IsNumeric<ET> >
+      serializeSparseElements( Archive& archive, size_t number, Iterator first, Iterator last );
+
+   template< typename Archive >
+   void flushBuffer( Archive& archive );
    //@}
    //**********************************************************************************************
 
@@ -261,7 +288,7 @@ class MatrixSerializer
    void deserializeMatrix( Archive& archive, MT& mat );
 
    template< typename Archive, typename MT >
-   EnableIfTrue_< MT::simdEnabled >
+   EnableIf_< And< HasMutableDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
       deserializeDenseRowMatrix( Archive& archive, DenseMatrix<MT,rowMajor>& mat );
 
    template< typename Archive, typename MT, bool SO >
@@ -276,7 +303,7 @@ class MatrixSerializer
       deserializeDenseRowMatrix( Archive& archive, SparseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT >
-   EnableIfTrue_< MT::simdEnabled>
+   EnableIf_< And< HasMutableDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
       deserializeDenseColumnMatrix( Archive& archive, DenseMatrix<MT,columnMajor>& mat );
 
    template< typename Archive, typename MT, bool SO >
@@ -307,6 +334,18 @@ class MatrixSerializer
 
    template< typename Archive, typename MT >
    void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive, typename ET, typename OP >
+   EnableIf_< IsNumeric<ET> > deserializeDenseElements( Archive& archive, size_t number, OP op );
+
+   template< typename Archive, typename ET, typename OP >
+   DisableIf_< IsNumeric<ET> > deserializeDenseElements( Archive& archive, size_t number, OP op );
+
+   template< typename Archive, typename ET, typename OP >
+   EnableIf_< IsNumeric<ET> > deserializeSparseElements( Archive& archive, size_t bound, OP op );
+
+   template< typename Archive, typename ET, typename OP >
+   DisableIf_< IsNumeric<ET> > deserializeSparseElements( Archive& archive, size_t bound, OP op );
    //@}
    //**********************************************************************************************
 
@@ -320,8 +359,17 @@ class MatrixSerializer
    uint64_t rows_;         //!< The number of rows of the matrix.
    uint64_t columns_;      //!< The number of columns of the matrix.
    uint64_t number_;       //!< The total number of elements contained in the matrix.
+
+   std::vector<byte_t> buffer_;  //!< Buffer for the block transfer of numeric elements.
    //@}
    //**********************************************************************************************
+
+   //**Member constants****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Size of the buffer for the block transfer of numeric elements (in bytes).
+   static constexpr size_t bufferSize = 1048576UL;
+   /*! \endcond */
+   //**********************************************************************************************
 };
 //*************************************************************************************************
 
@@ -345,6 +393,7 @@ MatrixSerializer::MatrixSerializer()
    , rows_       ( 0UL )  // The number of rows of the matrix
    , columns_    ( 0UL )  // The number of columns of the matrix
    , number_     ( 0UL )  // The total number of elements contained in the matrix
+   , buffer_     ()       // Buffer for the block transfer of numeric elements
 {}
 //*************************************************************************************************
 
@@ -409,6 +458,39 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense matrix with direct access to its numeric elements.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function writes each row (for row-major matrices) or column (for column-major matrices)
+// of the given dense matrix with a single write operation directly from the matrix storage.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_< And< HasConstDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   const size_t dim1( IsRowMajorMatrix<MT>::value ? (~mat).rows() : (~mat).columns() );
+   const size_t dim2( IsRowMajorMatrix<MT>::value ? (~mat).columns() : (~mat).rows() );
+
+   if( dim2 != 0UL ) {
+      for( size_t i=0UL; i<dim1 && archive; ++i ) {
+         archive.write( (~mat).data(i), dim2 );
+      }
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes the elements of a dense matrix.
 //
@@ -420,7 +502,8 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+DisableIf_< And< HasConstDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
 {
    if( IsRowMajorMatrix<MT>::value ) {
       for( size_t i=0UL; i<(~mat).rows(); ++i ) {
@@ -457,25 +540,14 @@ template< typename Archive  // Type of the archive
         , bool SO >         // Storage order
 void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
 {
-   using ConstIterator = ConstIterator_<MT>;
+   const size_t dim( IsRowMajorMatrix<MT>::value ? (~mat).rows() : (~mat).columns() );
 
-   if( IsRowMajorMatrix<MT>::value ) {
-      for( size_t i=0UL; i<(~mat).rows(); ++i ) {
-         archive << uint64_t( (~mat).nonZeros( i ) );
-         for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
-            archive << element->index() << element->value();
-         }
-      }
-   }
-   else {
-      for( size_t j=0UL; j<(~mat).columns(); ++j ) {
-         archive << uint64_t( (~mat).nonZeros( j ) );
-         for( ConstIterator element=(~mat).begin(j); element!=(~mat).end(j); ++element ) {
-            archive << element->index() << element->value();
-         }
-      }
+   for( size_t i=0UL; i<dim; ++i ) {
+      serializeSparseElements< ElementType_<MT> >( archive, (~mat).nonZeros( i ), (~mat).begin( i ), (~mat).end( i ) );
    }
 
+   flushBuffer( archive );
+
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
    }
@@ -483,6 +555,90 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the numeric elements of a single row/column of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param number The number of non-zero elements of the row/column.
+// \param first Iterator to the first non-zero element of the row/column.
+// \param last Iterator one past the last non-zero element of the row/column.
+// \return void
+//
+// This function appends the number of non-zero elements and all index/value pairs of a single
+// row/column to the internal buffer. The buffer is written to the archive with a single write
+// operation as soon as it exceeds its capacity (see the flushBuffer() function).
+*/
+template< typename ET          // Type of the elements
+        , typename Archive     // Type of the archive
+        , typename Iterator >  // Type of the sparse element iterator
+EnableIf_< IsNumeric<ET> >
+   MatrixSerializer::serializeSparseElements( Archive& archive, size_t number, Iterator first, Iterator last )
+{
+   constexpr size_t entry( sizeof( size_t ) + sizeof( ET ) );
+
+   if( buffer_.size() + sizeof( uint64_t ) + number*entry > bufferSize ) {
+      flushBuffer( archive );
+   }
+
+   size_t offset( buffer_.size() );
+   buffer_.resize( offset + sizeof( uint64_t ) + number*entry );
+
+   const uint64_t count( number );
+   std::memcpy( &buffer_[offset], &count, sizeof( uint64_t ) );
+   offset += sizeof( uint64_t );
+
+   for( ; first!=last; ++first ) {
+      const size_t index( first->index() );
+      const ET     value( first->value() );
+      std::memcpy( &buffer_[offset], &index, sizeof( size_t ) );
+      std::memcpy( &buffer_[offset+sizeof( size_t )], &value, sizeof( ET ) );
+      offset += entry;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the non-numeric elements of a single row/column of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param number The number of non-zero elements of the row/column.
+// \param first Iterator to the first non-zero element of the row/column.
+// \param last Iterator one past the last non-zero element of the row/column.
+// \return void
+*/
+template< typename ET          // Type of the elements
+        , typename Archive     // Type of the archive
+        , typename Iterator >  // Type of the sparse element iterator
+DisableIf_< IsNumeric<ET> >
+   MatrixSerializer::serializeSparseElements( Archive& archive, size_t number, Iterator first, Iterator last )
+{
+   archive << uint64_t( number );
+
+   for( ; first!=last; ++first ) {
+      archive << first->index() << first->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the content of the internal buffer to the archive.
+//
+// \param archive The archive to be written.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::flushBuffer( Archive& archive )
+{
+   if( !buffer_.empty() ) {
+      archive.write( buffer_.data(), buffer_.size() );
+      buffer_.clear();
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -649,13 +805,13 @@ void MatrixSerializer::deserializeMatrix( Archive& archive, MT& mat )
 */
 template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
-EnableIfTrue_< MT::simdEnabled >
+EnableIf_< And< HasMutableDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
    MatrixSerializer::deserializeDenseRowMatrix( Archive& archive, DenseMatrix<MT,rowMajor>& mat )
 {
    if( columns_ == 0UL ) return;
 
-   for( size_t i=0UL; i<rows_; ++i ) {
-      archive.read( &(~mat)(i,0), columns_ );
+   for( size_t i=0UL; i<rows_ && archive; ++i ) {
+      archive.read( (~mat).data(i), columns_ );
    }
 
    if( !archive ) {
@@ -684,14 +840,10 @@ void MatrixSerializer::deserializeDenseRowMatrix( Archive& archive, DenseMatrix<
 {
    using ET = ElementType_<MT>;
 
-   ET value = ET();
-
    for( size_t i=0UL; i<rows_; ++i ) {
-      size_t j( 0UL );
-      while( ( j != columns_ ) && ( archive >> value ) ) {
+      deserializeDenseElements<Archive,ET>( archive, columns_, [&]( size_t j, const ET& value ) {
          (~mat)(i,j) = value;
-         ++j;
-      }
+      } );
    }
 
    if( !archive ) {
@@ -788,13 +940,13 @@ DisableIf_< IsNumeric< ElementType_<MT> > >
 */
 template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
-EnableIfTrue_< MT::simdEnabled >
+EnableIf_< And< HasMutableDataAccess<MT>, IsNumeric< ElementType_<MT> > > >
    MatrixSerializer::deserializeDenseColumnMatrix( Archive& archive, DenseMatrix<MT,columnMajor>& mat )
 {
    if( rows_ == 0UL ) return;
 
-   for( size_t j=0UL; j<columns_; ++j ) {
-      archive.read( &(~mat)(0,j), rows_ );
+   for( size_t j=0UL; j<columns_ && archive; ++j ) {
+      archive.read( (~mat).data(j), rows_ );
    }
 
    if( !archive ) {
@@ -823,14 +975,10 @@ void MatrixSerializer::deserializeDenseColumnMatrix( Archive& archive, DenseMatr
 {
    using ET = ElementType_<MT>;
 
-   ET value = ET();
-
    for( size_t j=0UL; j<columns_; ++j ) {
-      size_t i( 0UL );
-      while( ( i != rows_ ) && ( archive >> value ) ) {
+      deserializeDenseElements<Archive,ET>( archive, rows_, [&]( size_t i, const ET& value ) {
          (~mat)(i,j) = value;
-         ++i;
-      }
+      } );
    }
 
    if( !archive ) {
@@ -932,17 +1080,10 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, DenseMatrix
 {
    using ET = ElementType_<MT>;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value = ET();
-
    for( size_t i=0UL; i<rows_; ++i ) {
-      archive >> number;
-      size_t j( 0UL );
-      while( ( j != number ) && ( archive >> index >> value ) ) {
-         (~mat)(i,index) = value;
-         ++j;
-      }
+      deserializeSparseElements<Archive,ET>( archive, columns_, [&]( size_t j, const ET& value ) {
+         (~mat)(i,j) = value;
+      } );
    }
 
    if( !archive ) {
@@ -970,19 +1111,11 @@ void MatrixSerializer::deserializeSparseRowMatrix( Archive& archive, SparseMatri
 {
    using ET = ElementType_<MT>;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value = ET();
-
    for( size_t i=0UL; i<rows_; ++i )
    {
-      archive >> number;
-
-      size_t j( 0UL );
-      while( ( j != number ) && ( archive >> index >> value ) ) {
-         (~mat).append( i, index, value, false );
-         ++j;
-      }
+      deserializeSparseElements<Archive,ET>( archive, columns_, [&]( size_t j, const ET& value ) {
+         (~mat).append( i, j, value, false );
+      } );
 
       (~mat).finalize( i );
    }
@@ -1040,17 +1173,10 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, DenseMat
 {
    using ET = ElementType_<MT>;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value = ET();
-
    for( size_t j=0UL; j<columns_; ++j ) {
-      archive >> number;
-      size_t i( 0UL );
-      while( ( i != number ) && ( archive >> index >> value ) ) {
-         (~mat)(index,j) = value;
-         ++i;
-      }
+      deserializeSparseElements<Archive,ET>( archive, rows_, [&]( size_t i, const ET& value ) {
+         (~mat)(i,j) = value;
+      } );
    }
 
    if( !archive ) {
@@ -1105,19 +1231,11 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 {
    using ET = ElementType_<MT>;
 
-   uint64_t number( 0UL );
-   size_t   index ( 0UL );
-   ET       value = ET();
-
    for( size_t j=0UL; j<columns_; ++j )
    {
-      archive >> number;
-
-      size_t i( 0UL );
-      while( ( i != number ) && ( archive >> index >> value ) ) {
-         (~mat).append( index, j, value, false );
-         ++i;
-      }
+      deserializeSparseElements<Archive,ET>( archive, rows_, [&]( size_t i, const ET& value ) {
+         (~mat).append( i, j, value, false );
+      } );
 
       (~mat).finalize( j );
    }
@@ -1129,6 +1247,156 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a single row/column of numeric elements of a dense matrix.
+//
+// \param archive The archive to be read from.
+// \param number The number of elements of the row/column.
+// \param op The operation to store a single element (called with index and value).
+// \return void
+//
+// This function reads the given number of elements in blocks of at most \a bufferSize bytes
+// into the internal buffer and passes them to the given operation.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET       // Type of the elements
+        , typename OP >     // Type of the store operation
+EnableIf_< IsNumeric<ET> >
+   MatrixSerializer::deserializeDenseElements( Archive& archive, size_t number, OP op )
+{
+   constexpr size_t block( ( bufferSize / sizeof( ET ) > 0UL )?( bufferSize / sizeof( ET ) ):( 1UL ) );
+
+   ET value = ET();
+
+   for( size_t i=0UL; i<number && archive; )
+   {
+      const size_t n( ( number - i < block )?( number - i ):( block ) );
+
+      buffer_.resize( n*sizeof( ET ) );
+      if( !archive.read( buffer_.data(), buffer_.size() ) )
+         return;
+
+      for( size_t k=0UL; k<n; ++k, ++i ) {
+         std::memcpy( &value, &buffer_[k*sizeof( ET )], sizeof( ET ) );
+         op( i, value );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a single row/column of non-numeric elements of a dense matrix.
+//
+// \param archive The archive to be read from.
+// \param number The number of elements of the row/column.
+// \param op The operation to store a single element (called with index and value).
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename ET       // Type of the elements
+        , typename OP >     // Type of the store operation
+DisableIf_< IsNumeric<ET> >
+   MatrixSerializer::deserializeDenseElements( Archive& archive, size_t number, OP op )
+{
+   ET value = ET();
+
+   size_t i( 0UL );
+   while( ( i != number ) && ( archive >> value ) ) {
+      op( i, value );
+      ++i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a single row/column of numeric elements of a sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param bound The size of the row/column.
+// \param op The operation to store a single element (called with index and value).
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+//
+// This function reads the number of non-zero elements of a single row/column and afterwards
+// all index/value pairs with a single read operation. In case the number of non-zero elements
+// or an index exceeds the size of the row/column, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET       // Type of the elements
+        , typename OP >     // Type of the store operation
+EnableIf_< IsNumeric<ET> >
+   MatrixSerializer::deserializeSparseElements( Archive& archive, size_t bound, OP op )
+{
+   constexpr size_t entry( sizeof( size_t ) + sizeof( ET ) );
+
+   uint64_t number( 0UL );
+   if( !( archive >> number ) || number == 0UL )
+      return;
+
+   if( number > bound ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   buffer_.resize( number*entry );
+   if( !archive.read( buffer_.data(), buffer_.size() ) )
+      return;
+
+   size_t index( 0UL );
+   ET     value = ET();
+
+   for( size_t k=0UL; k<number; ++k )
+   {
+      std::memcpy( &index, &buffer_[k*entry], sizeof( size_t ) );
+      std::memcpy( &value, &buffer_[k*entry+sizeof( size_t )], sizeof( ET ) );
+
+      if( index >= bound ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      op( index, value );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a single row/column of non-numeric elements of a sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param bound The size of the row/column.
+// \param op The operation to store a single element (called with index and value).
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET       // Type of the elements
+        , typename OP >     // Type of the store operation
+DisableIf_< IsNumeric<ET> >
+   MatrixSerializer::deserializeSparseElements( Archive& archive, size_t bound, OP op )
+{
+   uint64_t number( 0UL );
+   size_t   index ( 0UL );
+   ET       value = ET();
+
+   if( !( archive >> number ) )
+      return;
+
+   size_t i( 0UL );
+   while( ( i != number ) && ( archive >> index >> value ) )
+   {
+      if( index >= bound ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      op( index, value );
+      ++i;
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,1295 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/Npy.h
+//  \brief Header file for the NumPy .npy file I/O
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_NPY_H_
+#define _BLAZE_MATH_SERIALIZATION_NPY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MappedFile.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBoolean.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSigned.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS NPYHEADER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Header information of a NumPy .npy file.
+// \ingroup math_serialization
+//
+// A .npy file starts with the magic string "\x93NUMPY", the major and minor version of the
+// format and the length of the header, which is stored as 2-byte (version 1.0) or 4-byte
+// (version 2.0 and 3.0) little-endian integer. The header itself is a Python dictionary literal
+// containing the data type ('descr'), the storage order ('fortran_order'), and the dimensions
+// ('shape') of the array. The array elements start directly after the header.
+*/
+struct NpyHeader
+{
+   std::string         descr;         //!< The data type of the array elements (e.g. "<f8").
+   bool                fortranOrder;  //!< \a true for column-major, \a false for row-major storage.
+   std::vector<size_t> shape;         //!< The dimensions of the array.
+   size_t              offset;        //!< The offset of the first array element in bytes.
+
+   static constexpr size_t alignment = 64UL;  //!< The alignment of the array elements in bytes.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY HEADER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the NumPy data type descriptor for the given element type.
+// \ingroup math_serialization
+//
+// \return The data type descriptor (e.g. "<f8" for double precision values).
+//
+// The descriptor consists of the byte order of the system ('<' or '>', '|' for single byte
+// types), the kind of the type ('b' for boolean, 'i' for signed and 'u' for unsigned integral,
+// 'f' for floating point, and 'c' for complex types), and the size of the type in bytes.
+*/
+template< typename Type >  // Type of the elements
+inline std::string npyDescr()
+{
+   const uint16_t probe( 1U );
+   const bool littleEndian( *reinterpret_cast<const unsigned char*>( &probe ) == 1U );
+
+   const char order( ( sizeof( Type ) == 1UL ) ? '|' : ( littleEndian ? '<' : '>' ) );
+   const char kind ( IsComplex<Type>::value       ? 'c'
+                   : IsFloatingPoint<Type>::value ? 'f'
+                   : IsBoolean<Type>::value       ? 'b'
+                   : IsSigned<Type>::value        ? 'i' : 'u' );
+
+   return std::string( 1UL, order ) + kind + std::to_string( sizeof( Type ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given data type descriptor matches the given element type.
+// \ingroup math_serialization
+//
+// \param descr The data type descriptor of the file.
+// \return \a true in case the descriptor matches the element type, \a false if not.
+//
+// In addition to the exact descriptor, the native byte order character ('=') and for single
+// byte types any byte order character are accepted.
+*/
+template< typename Type >  // Type of the elements
+inline bool isNpyDescr( const std::string& descr )
+{
+   const std::string expected( npyDescr<Type>() );
+
+   if( descr.size() != expected.size() ||
+       descr.compare( 1UL, std::string::npos, expected, 1UL, std::string::npos ) != 0 )
+      return false;
+
+   return descr[0] == expected[0] || descr[0] == '=' || sizeof( Type ) == 1UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Finding the value of the given key within the header dictionary of a .npy file.
+// \ingroup math_serialization
+//
+// \param dict The header dictionary.
+// \param key The key of the value.
+// \return The position of the first non-blank character of the value.
+// \exception std::invalid_argument Invalid .npy file.
+*/
+inline size_t findNpyValue( const std::string& dict, const std::string& key )
+{
+   size_t pos( dict.find( "'" + key + "'" ) );
+
+   if( pos == std::string::npos )
+      pos = dict.find( "\"" + key + "\"" );
+
+   if( pos == std::string::npos ||
+       ( pos = dict.find_first_not_of( " ", pos + key.size() + 2UL ) ) == std::string::npos ||
+       dict[pos] != ':' ||
+       ( pos = dict.find_first_not_of( " ", pos + 1UL ) ) == std::string::npos ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+   }
+
+   return pos;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parsing the header dictionary of a .npy file.
+// \ingroup math_serialization
+//
+// \param dict The header dictionary.
+// \param offset The offset of the first array element.
+// \return The header information of the file.
+// \exception std::invalid_argument Invalid .npy file.
+*/
+inline NpyHeader parseNpyHeader( const std::string& dict, size_t offset )
+{
+   NpyHeader header;
+   header.offset = offset;
+
+   // Parsing the data type descriptor
+   {
+      const size_t pos( findNpyValue( dict, "descr" ) );
+      const size_t end( ( dict[pos] == '\'' || dict[pos] == '"' ) ? dict.find( dict[pos], pos+1UL )
+                                                                   : std::string::npos );
+      if( end == std::string::npos ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Unsupported .npy data type" );
+      }
+      header.descr = dict.substr( pos+1UL, end-pos-1UL );
+   }
+
+   // Parsing the storage order
+   {
+      const size_t pos( findNpyValue( dict, "fortran_order" ) );
+      if( dict.compare( pos, 4UL, "True" ) == 0 )
+         header.fortranOrder = true;
+      else if( dict.compare( pos, 5UL, "False" ) == 0 )
+         header.fortranOrder = false;
+      else BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+   }
+
+   // Parsing the dimensions
+   {
+      size_t pos( findNpyValue( dict, "shape" ) );
+
+      if( dict[pos] != '(' ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+      }
+
+      for( ++pos; pos < dict.size() && dict[pos] != ')'; ) {
+         if( dict[pos] >= '0' && dict[pos] <= '9' ) {
+            size_t value( 0UL );
+            for( ; pos < dict.size() && dict[pos] >= '0' && dict[pos] <= '9'; ++pos )
+               value = value*10UL + static_cast<size_t>( dict[pos] - '0' );
+            header.shape.push_back( value );
+         }
+         else if( dict[pos] == ',' || dict[pos] == ' ' || dict[pos] == 'L' ) {
+            ++pos;
+         }
+         else BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+      }
+
+      if( pos == dict.size() ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+      }
+   }
+
+   return header;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the length of the header dictionary of a .npy file.
+// \ingroup math_serialization
+//
+// \param preamble The first 12 bytes of the file.
+// \param size The number of available bytes of the preamble.
+// \param offset The offset of the header dictionary.
+// \return The length of the header dictionary in bytes.
+// \exception std::invalid_argument Invalid .npy file.
+*/
+inline size_t npyHeaderLength( const unsigned char* preamble, size_t size, size_t& offset )
+{
+   if( size < 10UL || std::memcmp( preamble, "\x93NUMPY", 6UL ) != 0 ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+   }
+
+   if( preamble[6] == 1U ) {
+      offset = 10UL;
+      return preamble[8] | ( size_t( preamble[9] ) << 8 );
+   }
+   else if( ( preamble[6] == 2U || preamble[6] == 3U ) && size >= 12UL ) {
+      offset = 12UL;
+      return preamble[8] | ( size_t( preamble[9] ) << 8 ) |
+             ( size_t( preamble[10] ) << 16 ) | ( size_t( preamble[11] ) << 24 );
+   }
+   else {
+      BLAZE_THROW_INVALID_ARGUMENT( "Unsupported .npy version" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading the header of a .npy file from the given input stream.
+// \ingroup math_serialization
+//
+// \param is The input stream.
+// \return The header information of the file.
+// \exception std::invalid_argument Invalid .npy file.
+*/
+inline NpyHeader readNpyHeader( std::istream& is )
+{
+   unsigned char preamble[12] = {};
+   is.read( reinterpret_cast<char*>( preamble ), 10 );
+
+   if( is && preamble[6] != 1U ) {
+      is.read( reinterpret_cast<char*>( preamble ) + 10, 2 );
+   }
+
+   size_t offset( 0UL );
+   const size_t length( npyHeaderLength( preamble, is ? 12UL : 0UL, offset ) );
+
+   std::string dict( length, ' ' );
+   is.read( &dict[0], static_cast<std::streamsize>( length ) );
+
+   if( !is ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+   }
+
+   return parseNpyHeader( dict, offset + length );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating the header of a .npy file.
+// \ingroup math_serialization
+//
+// \param descr The data type descriptor of the array elements.
+// \param fortranOrder \a true for column-major, \a false for row-major storage.
+// \param shape The dimensions of the array.
+// \return The complete header including the preamble.
+//
+// The header is padded with blanks such that the array elements start at a multiple of 64
+// bytes. The version 1.0 of the format is used, unless the header exceeds 65535 bytes.
+*/
+inline std::string makeNpyHeader( const std::string& descr, bool fortranOrder,
+                                  const std::vector<size_t>& shape )
+{
+   std::string dict( "{'descr': '" + descr + "', 'fortran_order': " +
+                     ( fortranOrder ? "True" : "False" ) + ", 'shape': (" );
+
+   for( size_t i=0UL; i<shape.size(); ++i ) {
+      dict += std::to_string( shape[i] );
+      if( i+1UL != shape.size() ) dict += ", ";
+   }
+   dict += ( shape.size() == 1UL ? ",), }" : "), }" );
+
+   const size_t preamble( nextMultiple( dict.size() + 11UL, NpyHeader::alignment ) <= 65545UL ? 10UL : 12UL );
+   const size_t total( nextMultiple( preamble + dict.size() + 1UL, NpyHeader::alignment ) );
+
+   dict.append( total - preamble - dict.size() - 1UL, ' ' );
+   dict += '\n';
+
+   const size_t length( dict.size() );
+   std::string header( "\x93NUMPY", 6UL );
+   header += static_cast<char>( preamble == 10UL ? 1 : 2 );
+   header += static_cast<char>( 0 );
+   for( size_t i=0UL; i<preamble-8UL; ++i ) {
+      header += static_cast<char>( ( length >> ( 8UL*i ) ) & 0xFFUL );
+   }
+
+   return header + dict;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY ELEMENT I/O FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading the elements of a .npy file directly into the given dense matrix.
+// \ingroup math_serialization
+//
+// \param is The input stream.
+// \param mat The target dense matrix with mutable data access.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void readNpyElements( std::istream& is, DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t outer( SO ? (~mat).columns() : (~mat).rows() );
+   const size_t inner( SO ? (~mat).rows() : (~mat).columns() );
+
+   if( outer > 0UL && inner == (~mat).spacing() ) {
+      is.read( reinterpret_cast<char*>( (~mat).data() ),
+               static_cast<std::streamsize>( outer*inner*sizeof( ET ) ) );
+   }
+   else {
+      for( size_t k=0UL; k<outer; ++k ) {
+         is.read( reinterpret_cast<char*>( (~mat).data(k) ),
+                  static_cast<std::streamsize>( inner*sizeof( ET ) ) );
+      }
+   }
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Reading file failed" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading a matrix from a .npy file into a dense matrix with mutable data access.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the first array element.
+// \param header The header information of the file.
+// \param mat The target dense matrix.
+// \return void
+//
+// In case the storage order of the file matches the storage order of the matrix, the elements
+// are read directly into the matrix. Otherwise the elements are read into a temporary matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+EnableIf_< HasMutableDataAccess<MT> >
+   readNpyMatrix( std::istream& is, const NpyHeader& header, DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t m( header.shape[0] );
+   const size_t n( header.shape[1] );
+
+   if( header.fortranOrder == SO ) {
+      resize( ~mat, m, n, false );
+      readNpyElements( is, ~mat );
+   }
+   else {
+      DynamicMatrix<ET,!SO> tmp( m, n );
+      readNpyElements( is, tmp );
+      ~mat = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading a matrix from a .npy file into a dense matrix without mutable data access.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the first array element.
+// \param header The header information of the file.
+// \param mat The target dense matrix.
+// \return void
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+DisableIf_< HasMutableDataAccess<MT> >
+   readNpyMatrix( std::istream& is, const NpyHeader& header, DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t m( header.shape[0] );
+   const size_t n( header.shape[1] );
+
+   if( header.fortranOrder ) {
+      DynamicMatrix<ET,columnMajor> tmp( m, n );
+      readNpyElements( is, tmp );
+      ~mat = tmp;
+   }
+   else {
+      DynamicMatrix<ET,rowMajor> tmp( m, n );
+      readNpyElements( is, tmp );
+      ~mat = tmp;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading a vector from a .npy file into a dense vector with mutable data access.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the first array element.
+// \param n The number of elements.
+// \param vec The target dense vector.
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+EnableIf_< HasMutableDataAccess<VT> >
+   readNpyVector( std::istream& is, size_t n, DenseVector<VT,TF>& vec )
+{
+   using ET = ElementType_<VT>;
+
+   resize( ~vec, n, false );
+   is.read( reinterpret_cast<char*>( (~vec).data() ), static_cast<std::streamsize>( n*sizeof( ET ) ) );
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Reading file failed" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reading a vector from a .npy file into a dense vector without mutable data access.
+// \ingroup math_serialization
+//
+// \param is The input stream positioned at the first array element.
+// \param n The number of elements.
+// \param vec The target dense vector.
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DisableIf_< HasMutableDataAccess<VT> >
+   readNpyVector( std::istream& is, size_t n, DenseVector<VT,TF>& vec )
+{
+   DynamicVector<ElementType_<VT>,TF> tmp;
+   readNpyVector( is, n, tmp );
+   ~vec = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writing the elements of a dense matrix with constant data access to a .npy file.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The dense matrix to be written.
+// \return void
+//
+// The elements are written directly from the memory of the matrix in its storage order.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+EnableIf_< HasConstDataAccess<MT> >
+   writeNpyElements( std::ostream& os, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t outer( SO ? (~mat).columns() : (~mat).rows() );
+   const size_t inner( SO ? (~mat).rows() : (~mat).columns() );
+
+   if( outer > 0UL && inner == (~mat).spacing() ) {
+      os.write( reinterpret_cast<const char*>( (~mat).data() ),
+                static_cast<std::streamsize>( outer*inner*sizeof( ET ) ) );
+   }
+   else {
+      for( size_t k=0UL; k<outer; ++k ) {
+         os.write( reinterpret_cast<const char*>( (~mat).data(k) ),
+                   static_cast<std::streamsize>( inner*sizeof( ET ) ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writing the elements of a dense matrix without data access to a .npy file.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param mat The dense matrix to be written.
+// \return void
+//
+// The elements are copied row by row (row-major) or column by column (column-major) into a
+// buffer, which is written to the file.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+DisableIf_< HasConstDataAccess<MT> >
+   writeNpyElements( std::ostream& os, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t outer( SO ? (~mat).columns() : (~mat).rows() );
+   const size_t inner( SO ? (~mat).rows() : (~mat).columns() );
+
+   std::vector<ET> buffer( inner );
+
+   for( size_t k=0UL; k<outer; ++k ) {
+      for( size_t l=0UL; l<inner; ++l ) {
+         buffer[l] = ( SO ? (~mat)(l,k) : (~mat)(k,l) );
+      }
+      os.write( reinterpret_cast<const char*>( buffer.data() ),
+                static_cast<std::streamsize>( inner*sizeof( ET ) ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writing the elements of a dense vector with constant data access to a .npy file.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param vec The dense vector to be written.
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+EnableIf_< HasConstDataAccess<VT> >
+   writeNpyElements( std::ostream& os, const DenseVector<VT,TF>& vec )
+{
+   os.write( reinterpret_cast<const char*>( (~vec).data() ),
+             static_cast<std::streamsize>( (~vec).size()*sizeof( ElementType_<VT> ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writing the elements of a dense vector without data access to a .npy file.
+// \ingroup math_serialization
+//
+// \param os The output stream.
+// \param vec The dense vector to be written.
+// \return void
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DisableIf_< HasConstDataAccess<VT> >
+   writeNpyElements( std::ostream& os, const DenseVector<VT,TF>& vec )
+{
+   const DynamicVector<ElementType_<VT>,TF> tmp( ~vec );
+   writeNpyElements( os, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NPY I/O FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name NumPy .npy I/O functions */
+//@{
+template< typename MT, bool SO >
+void readNpy( const std::string& filename, DenseMatrix<MT,SO>& mat );
+
+template< typename VT, bool TF >
+void readNpy( const std::string& filename, DenseVector<VT,TF>& vec );
+
+template< typename MT, bool SO >
+void writeNpy( const std::string& filename, const DenseMatrix<MT,SO>& mat );
+
+template< typename VT, bool TF >
+void writeNpy( const std::string& filename, const DenseVector<VT,TF>& vec );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a dense matrix from a NumPy .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the .npy file.
+// \param mat The dense matrix to be read.
+// \return void
+// \exception std::runtime_error Reading the file failed.
+// \exception std::invalid_argument Invalid .npy file.
+//
+// This function reads the two-dimensional array stored in the given .npy file into the given
+// dense matrix. In case the storage order of the file (C or Fortran order) matches the storage
+// order of the matrix and the matrix provides mutable data access (as for instance
+// blaze::DynamicMatrix or blaze::CustomMatrix), the elements are read directly into the matrix.
+// Otherwise they are transposed via a temporary matrix. The data type of the file has to match
+// the element type of the matrix exactly:
+
+   \code
+   // Python: numpy.save( "A.npy", numpy.random.rand( 100, 50 ) )
+   blaze::DynamicMatrix<double,blaze::rowMajor> A;
+   blaze::readNpy( "A.npy", A );
+   \endcode
+
+// In case the file cannot be opened or is truncated, a \a std::runtime_error exception is thrown.
+// In case the file is no valid .npy file, does not contain a two-dimensional array or the data
+// type does not match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void readNpy( const std::string& filename, DenseMatrix<MT,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType_<MT> );
+
+   std::ifstream is( filename.c_str(), std::ios::in | std::ios::binary );
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Opening file failed" );
+   }
+
+   const NpyHeader header( readNpyHeader( is ) );
+
+   if( header.shape.size() != 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions" );
+   }
+
+   if( !isNpyDescr< ElementType_<MT> >( header.descr ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type" );
+   }
+
+   readNpyMatrix( is, header, ~mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reading a dense vector from a NumPy .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the .npy file.
+// \param vec The dense vector to be read.
+// \return void
+// \exception std::runtime_error Reading the file failed.
+// \exception std::invalid_argument Invalid .npy file.
+//
+// This function reads the one-dimensional array stored in the given .npy file into the given
+// dense vector. The data type of the file has to match the element type of the vector exactly.
+// In case the file cannot be opened or is truncated, a \a std::runtime_error exception is thrown.
+// In case the file is no valid .npy file, does not contain a one-dimensional array or the data
+// type does not match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void readNpy( const std::string& filename, DenseVector<VT,TF>& vec )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType_<VT> );
+
+   std::ifstream is( filename.c_str(), std::ios::in | std::ios::binary );
+
+   if( !is ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Opening file failed" );
+   }
+
+   const NpyHeader header( readNpyHeader( is ) );
+
+   if( header.shape.size() != 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions" );
+   }
+
+   if( !isNpyDescr< ElementType_<VT> >( header.descr ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type" );
+   }
+
+   readNpyVector( is, header.shape[0], ~vec );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a dense matrix to a NumPy .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the .npy file.
+// \param mat The dense matrix to be written.
+// \return void
+// \exception std::runtime_error Writing the file failed.
+//
+// This function writes the given dense matrix as two-dimensional array to the given .npy file.
+// A row-major matrix is stored in C order, a column-major matrix in Fortran order. In case the
+// matrix provides constant data access, the elements are written directly from the memory of
+// the matrix. The elements start at a multiple of 64 bytes within the file, which allows to
+// map the file via blaze::NpyMatrix. In case the file cannot be written, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void writeNpy( const std::string& filename, const DenseMatrix<MT,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType_<MT> );
+
+   CompositeType_<MT> A( ~mat );
+
+   std::ofstream os( filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Opening file failed" );
+   }
+
+   const std::string header( makeNpyHeader( npyDescr< ElementType_<MT> >(), SO,
+                                            { A.rows(), A.columns() } ) );
+   os.write( header.data(), static_cast<std::streamsize>( header.size() ) );
+
+   writeNpyElements( os, A );
+
+   os.close();
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Writing file failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing a dense vector to a NumPy .npy file.
+// \ingroup math_serialization
+//
+// \param filename The name of the .npy file.
+// \param vec The dense vector to be written.
+// \return void
+// \exception std::runtime_error Writing the file failed.
+//
+// This function writes the given dense vector as one-dimensional array to the given .npy file.
+// In case the file cannot be written, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void writeNpy( const std::string& filename, const DenseVector<VT,TF>& vec )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ElementType_<VT> );
+
+   CompositeType_<VT> v( ~vec );
+
+   std::ofstream os( filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Opening file failed" );
+   }
+
+   const std::string header( makeNpyHeader( npyDescr< ElementType_<VT> >(), false, { v.size() } ) );
+   os.write( header.data(), static_cast<std::streamsize>( header.size() ) );
+
+   writeNpyElements( os, v );
+
+   os.close();
+
+   if( !os ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Writing file failed" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory-mapped two-dimensional NumPy array.
+// \ingroup math_serialization
+//
+// The NpyMatrix class template maps a two-dimensional array stored in a NumPy .npy file into
+// memory and provides zero-copy access to the elements via an unaligned, unpadded
+// blaze::CustomMatrix. The type of the elements and the storage order of the matrix can be
+// specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class NpyMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. The data type of the file has to match
+//          this type exactly.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix. A
+//          row-major matrix maps files in C order, a column-major matrix files in Fortran order.
+//
+// In contrast to readNpy(), which copies the elements into an arbitrary dense matrix, a
+// NpyMatrix can only map files with matching storage order. Existing files can be mapped
+// read-only or for reading and writing, new files are created via the size constructor:
+
+   \code
+   // Python: numpy.save( "A.npy", numpy.random.rand( 10000, 5000 ) )
+   blaze::NpyMatrix<double,blaze::rowMajor> A( "A.npy" );
+
+   blaze::DynamicVector<double> x( A.columns() ), y;
+   y = A.matrix() * x;
+
+   // Creating a new .npy file and initializing it in place
+   blaze::NpyMatrix<double,blaze::rowMajor> B( "B.npy", A.rows(), A.columns() );
+   B.matrix() = 2.0 * A.matrix();
+   \endcode
+
+// Note that the elements of a read-only mapping must not be modified. Memory-mapped .npy files
+// are only available on POSIX systems.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class NpyMatrix : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                                      //!< Type of the matrix elements.
+   using MatrixType  = CustomMatrix<Type,unaligned,unpadded,SO>;  //!< Type of the mapped matrix.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline NpyMatrix( const std::string& filename, MappingMode mode = readOnly );
+   explicit inline NpyMatrix( const std::string& filename, size_t m, size_t n );
+            inline NpyMatrix( NpyMatrix&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Conversion operators************************************************************************
+   /*!\name Conversion operators */
+   //@{
+   inline operator MatrixType&() noexcept;
+   inline operator const MatrixType&() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline MatrixType&       matrix() noexcept;
+   inline const MatrixType& matrix() const noexcept;
+   inline size_t            rows() const noexcept;
+   inline size_t            columns() const noexcept;
+   inline void              advise( AccessAdvice advice );
+   inline void              flush();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline NpyHeader  header( const MappedFile& file );
+   static inline MappedFile open  ( const std::string& filename, MappingMode mode );
+   static inline MappedFile create( const std::string& filename, size_t m, size_t n );
+   static inline MatrixType view  ( const MappedFile& file );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MappedFile file_;    //!< The memory-mapped file.
+   MatrixType matrix_;  //!< The matrix view on the mapped elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST   ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mapping an existing .npy file.
+//
+// \param filename The name of the .npy file.
+// \param mode The access mode of the mapping (\a readOnly or \a readWrite).
+// \exception std::runtime_error Mapping the file failed.
+// \exception std::invalid_argument Invalid .npy file.
+//
+// This constructor maps the two-dimensional array stored in the given .npy file. In case the
+// file cannot be mapped, a \a std::runtime_error exception is thrown. In case the file is no
+// valid .npy file, does not contain a two-dimensional array, or the data type or the storage
+// order of the array don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyMatrix<Type,SO>::NpyMatrix( const std::string& filename, MappingMode mode )
+   : file_  ( open( filename, mode ) )  // The memory-mapped file
+   , matrix_( view( file_ ) )           // The matrix view on the mapped elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a new .npy file for a \f$ m \times n \f$ matrix.
+//
+// \param filename The name of the .npy file.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::runtime_error Creating the file failed.
+//
+// This constructor creates a new .npy file (or overwrites an existing file) and maps it for
+// reading and writing. All elements of the new matrix are zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyMatrix<Type,SO>::NpyMatrix( const std::string& filename, size_t m, size_t n )
+   : file_  ( create( filename, m, n ) )  // The memory-mapped file
+   , matrix_( view( file_ ) )             // The matrix view on the mapped elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for NpyMatrix.
+//
+// \param m The mapped matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyMatrix<Type,SO>::NpyMatrix( NpyMatrix&& m ) noexcept
+   : file_  ( std::move( m.file_ ) )    // The memory-mapped file
+   , matrix_( std::move( m.matrix_ ) )  // The matrix view on the mapped elements
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the mapped matrix.
+//
+// \return Reference to the matrix view on the mapped elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyMatrix<Type,SO>::operator MatrixType&() noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion to the mapped matrix.
+//
+// \return Reference to the matrix view on the mapped elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyMatrix<Type,SO>::operator const MatrixType&() const noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the matrix view on the mapped elements.
+//
+// \return Reference to the mapped matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename NpyMatrix<Type,SO>::MatrixType& NpyMatrix<Type,SO>::matrix() noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the matrix view on the mapped elements.
+//
+// \return Reference to the mapped matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const typename NpyMatrix<Type,SO>::MatrixType& NpyMatrix<Type,SO>::matrix() const noexcept
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t NpyMatrix<Type,SO>::rows() const noexcept
+{
+   return matrix_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t NpyMatrix<Type,SO>::columns() const noexcept
+{
+   return matrix_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advising the operating system about the access pattern of the matrix.
+//
+// \param advice The expected access pattern.
+// \return void
+// \exception std::runtime_error Invalid advice.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void NpyMatrix<Type,SO>::advise( AccessAdvice advice )
+{
+   file_.advise( advice );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Synchronously writing all modifications of the matrix back to the file.
+//
+// \return void
+// \exception std::runtime_error Synchronization failed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void NpyMatrix<Type,SO>::flush()
+{
+   file_.flush();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing the header of a mapped .npy file.
+//
+// \param file The mapped .npy file.
+// \return The header information of the file.
+// \exception std::invalid_argument Invalid .npy file.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline NpyHeader NpyMatrix<Type,SO>::header( const MappedFile& file )
+{
+   size_t offset( 0UL );
+   const size_t length( npyHeaderLength( file.data(), file.size(), offset ) );
+
+   if( length > file.size() - offset ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+   }
+
+   const std::string dict( reinterpret_cast<const char*>( file.data() ) + offset, length );
+
+   return parseNpyHeader( dict, offset + length );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opening and validating an existing .npy file.
+//
+// \param filename The name of the .npy file.
+// \param mode The access mode of the mapping.
+// \return The mapped file.
+// \exception std::runtime_error Mapping the file failed.
+// \exception std::invalid_argument Invalid .npy file.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedFile NpyMatrix<Type,SO>::open( const std::string& filename, MappingMode mode )
+{
+   MappedFile file( filename, mode );
+
+   const NpyHeader info( header( file ) );
+
+   if( info.shape.size() != 2UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of dimensions" );
+   }
+
+   if( !isNpyDescr<Type>( info.descr ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid element type" );
+   }
+
+   if( info.fortranOrder != SO ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid storage order" );
+   }
+
+   const size_t m( info.shape[0] );
+   const size_t n( info.shape[1] );
+
+   if( info.offset % alignof( Type ) != 0UL ||
+       ( m > 0UL && n > ( file.size() - info.offset ) / sizeof( Type ) / m ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid .npy file" );
+   }
+
+   return file;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a new .npy file.
+//
+// \param filename The name of the .npy file.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The mapped file.
+// \exception std::runtime_error Creating the file failed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline MappedFile NpyMatrix<Type,SO>::create( const std::string& filename, size_t m, size_t n )
+{
+   const std::string header( makeNpyHeader( npyDescr<Type>(), SO, { m, n } ) );
+
+   MappedFile file( filename, header.size() + m*n*sizeof( Type ) );
+   std::memcpy( file.data(), header.data(), header.size() );
+
+   return file;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating the matrix view on the elements of a mapped .npy file.
+//
+// \param file The mapped .npy file.
+// \return The matrix view on the mapped elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename NpyMatrix<Type,SO>::MatrixType NpyMatrix<Type,SO>::view( const MappedFile& file )
+{
+   const NpyHeader info( header( file ) );
+
+   Type* const ptr( reinterpret_cast<Type*>( file.data() + info.offset ) );
+
+   return MatrixType( ptr, info.shape[0], info.shape[1] );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstring>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Vector.h>
 #include <blaze/math/Exception.h>
@@ -47,11 +49,14 @@
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
@@ -150,6 +155,10 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// For vectors with numeric element type the serializer transfers the elements of dense vectors
+// and blocks of index/value pairs of sparse vectors with a single call to the \c write() or
+// \c read() function of the archive.
 */
 class VectorSerializer
 {
@@ -231,10 +240,20 @@ class VectorSerializer
    void serializeHeader( Archive& archive, const VT& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+   EnableIf_< And< HasConstDataAccess<VT>, IsNumeric< ElementType_<VT> > > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   DisableIf_< And< HasConstDataAccess<VT>, IsNumeric< ElementType_<VT> > > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
+   EnableIf_< IsNumeric< ElementType_<VT> > >
+      serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   DisableIf_< IsNumeric< ElementType_<VT> > >
+      serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
    //@}
    //**********************************************************************************************
 
@@ -257,11 +276,11 @@ class VectorSerializer
    void deserializeVector( Archive& archive, VT& vec );
 
    template< typename Archive, typename VT, bool TF >
-   typename DisableIfTrue< VT::simdEnabled >::Type
+   DisableIf_< And< HasMutableDataAccess<VT>, IsNumeric< ElementType_<VT> > > >
       deserializeDenseVector( Archive& archive, DenseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
-   EnableIfTrue_< VT::simdEnabled >
+   EnableIf_< And< HasMutableDataAccess<VT>, IsNumeric< ElementType_<VT> > > >
       deserializeDenseVector( Archive& archive, DenseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
@@ -272,6 +291,12 @@ class VectorSerializer
 
    template< typename Archive, typename VT, bool TF >
    void deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename ET, typename OP >
+   EnableIf_< IsNumeric<ET> > deserializeSparseElements( Archive& archive, OP op );
+
+   template< typename Archive, typename ET, typename OP >
+   DisableIf_< IsNumeric<ET> > deserializeSparseElements( Archive& archive, OP op );
    //@}
    //**********************************************************************************************
 
@@ -284,8 +309,17 @@ class VectorSerializer
    uint8_t  elementSize_;  //!< The size in bytes of a single element of the vector.
    uint64_t size_;         //!< The size of the vector.
    uint64_t number_;       //!< The total number of elements contained in the vector.
+
+   std::vector<byte_t> buffer_;  //!< Buffer for the block transfer of numeric elements.
    //@}
    //**********************************************************************************************
+
+   //**Member constants****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Size of the buffer for the block transfer of numeric elements (in bytes).
+   static constexpr size_t bufferSize = 1048576UL;
+   /*! \endcond */
+   //**********************************************************************************************
 };
 //*************************************************************************************************
 
@@ -308,6 +342,7 @@ VectorSerializer::VectorSerializer()
    , elementSize_( 0U  )  // The size in bytes of a single element of the vector
    , size_       ( 0UL )  // The size of the vector
    , number_     ( 0UL )  // The total number of elements contained in the vector
+   , buffer_     ()       // Buffer for the block transfer of numeric elements
 {}
 //*************************************************************************************************
 
@@ -374,6 +409,34 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a dense vector with direct access to its numeric elements.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Dense vector could not be serialized.
+//
+// This function writes all elements of the given dense vector with a single write operation
+// directly from the vector storage.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_< And< HasConstDataAccess<VT>, IsNumeric< ElementType_<VT> > > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   if( (~vec).size() != 0UL ) {
+      archive.write( (~vec).data(), (~vec).size() );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes the elements of a dense vector.
 //
@@ -385,7 +448,8 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+DisableIf_< And< HasConstDataAccess<VT>, IsNumeric< ElementType_<VT> > > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
 {
    size_t i( 0UL );
    while( ( i < (~vec).size() ) && ( archive << (~vec)[i] ) ) {
@@ -399,6 +463,58 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the numeric elements of a sparse vector.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Sparse vector could not be serialized.
+//
+// This function collects the index/value pairs of the given sparse vector in an internal buffer
+// and writes them in blocks of at most \a bufferSize bytes with a single write operation each.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_< IsNumeric< ElementType_<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
+{
+   using ET            = ElementType_<VT>;
+   using ConstIterator = ConstIterator_<VT>;
+
+   constexpr size_t entry( sizeof( size_t ) + sizeof( ET ) );
+
+   buffer_.clear();
+
+   for( ConstIterator element=(~vec).begin(); element!=(~vec).end() && archive; ++element )
+   {
+      if( buffer_.size() + entry > bufferSize ) {
+         archive.write( buffer_.data(), buffer_.size() );
+         buffer_.clear();
+      }
+
+      const size_t offset( buffer_.size() );
+      buffer_.resize( offset + entry );
+
+      const size_t index( element->index() );
+      const ET     value( element->value() );
+      std::memcpy( &buffer_[offset], &index, sizeof( size_t ) );
+      std::memcpy( &buffer_[offset+sizeof( size_t )], &value, sizeof( ET ) );
+   }
+
+   if( !buffer_.empty() ) {
+      archive.write( buffer_.data(), buffer_.size() );
+      buffer_.clear();
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes the elements of a sparse vector.
 //
@@ -410,7 +526,8 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
+DisableIf_< IsNumeric< ElementType_<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
 {
    using ConstIterator = ConstIterator_<VT>;
 
@@ -593,7 +710,7 @@ void VectorSerializer::deserializeVector( Archive& archive, VT& vec )
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-typename DisableIfTrue< VT::simdEnabled >::Type
+DisableIf_< And< HasMutableDataAccess<VT>, IsNumeric< ElementType_<VT> > > >
    VectorSerializer::deserializeDenseVector( Archive& archive, DenseVector<VT,TF>& vec )
 {
    using ET = ElementType_<VT>;
@@ -628,11 +745,11 @@ typename DisableIfTrue< VT::simdEnabled >::Type
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-EnableIfTrue_< VT::simdEnabled >
+EnableIf_< And< HasMutableDataAccess<VT>, IsNumeric< ElementType_<VT> > > >
    VectorSerializer::deserializeDenseVector( Archive& archive, DenseVector<VT,TF>& vec )
 {
    if( size_ == 0UL ) return;
-   archive.read( &(~vec)[0], size_ );
+   archive.read( (~vec).data(), size_ );
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be deserialized" );
@@ -694,14 +811,9 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, DenseVector<VT
 {
    using ET = ElementType_<VT>;
 
-   size_t i( 0UL );
-   size_t index( 0UL );
-   ET     value = ET();
-
-   while( ( i != number_ ) && ( archive >> index >> value ) ) {
+   deserializeSparseElements<Archive,ET>( archive, [&]( size_t index, const ET& value ) {
       (~vec)[index] = value;
-      ++i;
-   }
+   } );
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be deserialized" );
@@ -729,17 +841,91 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
 {
    using ET = ElementType_<VT>;
 
-   size_t i( 0UL );
+   deserializeSparseElements<Archive,ET>( archive, [&]( size_t index, const ET& value ) {
+      (~vec).append( index, value, false );
+   } );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes the numeric index/value pairs of a sparse vector.
+//
+// \param archive The archive to be read from.
+// \param op The operation to store a single element (called with index and value).
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+//
+// This function reads the index/value pairs of a sparse vector in blocks of at most
+// \a bufferSize bytes with a single read operation each. In case an index exceeds the size
+// of the vector, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET       // Type of the elements
+        , typename OP >     // Type of the store operation
+EnableIf_< IsNumeric<ET> >
+   VectorSerializer::deserializeSparseElements( Archive& archive, OP op )
+{
+   constexpr size_t entry( sizeof( size_t ) + sizeof( ET ) );
+   constexpr size_t block( ( bufferSize / entry > 0UL )?( bufferSize / entry ):( 1UL ) );
+
    size_t index( 0UL );
    ET     value = ET();
 
-   while( ( i != number_ ) && ( archive >> index >> value ) ) {
-      (~vec).append( index, value, false );
-      ++i;
+   for( size_t i=0UL; i<number_; )
+   {
+      const size_t n( ( number_ - i < block )?( number_ - i ):( block ) );
+
+      buffer_.resize( n*entry );
+      if( !archive.read( buffer_.data(), buffer_.size() ) )
+         return;
+
+      for( size_t k=0UL; k<n; ++k, ++i )
+      {
+         std::memcpy( &index, &buffer_[k*entry], sizeof( size_t ) );
+         std::memcpy( &value, &buffer_[k*entry+sizeof( size_t )], sizeof( ET ) );
+
+         if( index >= size_ ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+         }
+
+         op( index, value );
+      }
    }
+}
+//*************************************************************************************************
 
-   if( !archive ) {
-      BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be deserialized" );
+
+//*************************************************************************************************
+/*!\brief Deserializes the non-numeric index/value pairs of a sparse vector.
+//
+// \param archive The archive to be read from.
+// \param op The operation to store a single element (called with index and value).
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+*/
+template< typename Archive  // Type of the archive
+        , typename ET       // Type of the elements
+        , typename OP >     // Type of the store operation
+DisableIf_< IsNumeric<ET> >
+   VectorSerializer::deserializeSparseElements( Archive& archive, OP op )
+{
+   size_t i( 0UL );
+   size_t index( 0UL );
+   ET     value = ET();
+
+   while( ( i != number_ ) && ( archive >> index >> value ) )
+   {
+      if( index >= size_ ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      op( index, value );
+      ++i;
    }
 }
 //*************************************************************************************************
@@ -41,8 +41,13 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
+
 
 namespace blaze {
 
@@ -89,10 +94,13 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static thread_local bool active_;  //!< Activity flag for the parallel section.
+                                      /*!< In case a parallel section is active (i.e. the currently
+                                           executed code is inside a parallel section), the flag
+                                           is set to \a true, otherwise it is \a false. The flag
+                                           is local to each thread in order to enable several
+                                           application threads to start parallel sections
+                                           concurrently. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +124,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+thread_local bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -209,10 +217,18 @@ inline bool isParallelSectionActive();
 // \ingroup smp
 //
 // \return \a true if a parallel section is active, \a false if not.
+//
+// Note that in case of the OpenMP parallelization, the threads of an active OpenMP parallel
+// region are considered to be inside the parallel section of the thread that has started the
+// parallel region.
 */
 inline bool isParallelSectionActive()
 {
+#if BLAZE_OPENMP_PARALLEL_MODE
+   return ParallelSection<int>::active_ || omp_in_parallel();
+#else
    return ParallelSection<int>::active_;
+#endif
 }
 //*************************************************************************************************
 
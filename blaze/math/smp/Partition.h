@@ -0,0 +1,224 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Partition.h
+//  \brief Header file for the SMP partitioning functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_PARTITION_H_
+#define _BLAZE_MATH_SMP_PARTITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARTITIONING FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partition of an index range into consecutive blocks.
+// \ingroup smp
+//
+// A partition of the index range \f$[0..n)\f$ is represented by the ascending sequence of block
+// boundaries \f$ b_0 = 0 < b_1 < \ldots < b_k = n \f$. The \a i-th block spans the indices
+// \f$[b_i..b_{i+1})\f$, i.e. a partition of \a k blocks contains \a k+1 boundaries.
+*/
+using Partition = std::vector<size_t>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds the given index up to the next multiple of the given alignment.
+// \ingroup smp
+//
+// \param index The index to be rounded up.
+// \param alignment The alignment \f$[1..\infty)\f$.
+// \return The next multiple of \a alignment.
+*/
+inline size_t alignPartitionBoundary( size_t index, size_t alignment ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( alignment > 0UL, "Invalid alignment detected" );
+
+   const size_t rest( index % alignment );
+   return ( rest != 0UL )?( index - rest + alignment ):( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a partition of the given index range into blocks of equal size.
+// \ingroup smp
+//
+// \param n The size of the index range \f$[0..n)\f$.
+// \param blocks The requested number of blocks \f$[1..\infty)\f$.
+// \param alignment The alignment of all block boundaries \f$[1..\infty)\f$.
+// \return The resulting partition.
+//
+// This function partitions the index range \f$[0..n)\f$ into at most \a blocks blocks of equal
+// size. The size of the blocks is rounded up to a multiple of \a alignment, which guarantees
+// that each block starts on an aligned index. Due to the rounding the resulting partition may
+// contain less than \a blocks blocks.
+*/
+inline Partition createUniformPartition( size_t n, size_t blocks, size_t alignment )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL, "Invalid number of blocks detected" );
+
+   const size_t addon     ( ( ( n % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( n / blocks + addon );
+   const size_t blockSize ( max( 1UL, alignPartitionBoundary( equalShare, alignment ) ) );
+
+   Partition partition;
+   partition.reserve( blocks + 1UL );
+
+   for( size_t i=0UL; i<n; i+=blockSize ) {
+      partition.push_back( i );
+   }
+   partition.push_back( n );
+
+   return partition;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a guided partition of the given index range.
+// \ingroup smp
+//
+// \param n The size of the index range \f$[0..n)\f$.
+// \param threads The number of threads processing the blocks \f$[1..\infty)\f$.
+// \param blocksPerThread The average number of blocks per thread \f$[1..\infty)\f$.
+// \param alignment The alignment of all block boundaries \f$[1..\infty)\f$.
+// \return The resulting partition.
+//
+// This function partitions the index range \f$[0..n)\f$ into blocks of decreasing size. The
+// size of each block is proportional to the number of remaining indices divided by the number
+// of threads, but is never smaller than \f$ n / (threads \cdot blocksPerThread) \f$. Given that
+// the blocks are claimed in order by the next idle thread, the large initial blocks keep the
+// scheduling overhead small, whereas the small final blocks balance the load among the threads.
+// For \a blocksPerThread equal to 1 the function creates a uniform partition.
+*/
+inline Partition createGuidedPartition( size_t n, size_t threads, size_t blocksPerThread, size_t alignment )
+{
+   BLAZE_INTERNAL_ASSERT( threads > 0UL        , "Invalid number of threads detected" );
+   BLAZE_INTERNAL_ASSERT( blocksPerThread > 0UL, "Invalid number of blocks per thread detected" );
+
+   if( blocksPerThread == 1UL ) {
+      return createUniformPartition( n, threads, alignment );
+   }
+
+   const size_t minSize( max( alignment, alignPartitionBoundary( n / ( threads*blocksPerThread ), alignment ) ) );
+
+   Partition partition;
+   partition.reserve( threads*blocksPerThread + 1UL );
+
+   size_t index( 0UL );
+
+   while( index < n ) {
+      partition.push_back( index );
+      const size_t size( alignPartitionBoundary( ( n - index ) / threads, alignment ) );
+      index += min( n - index, max( minSize, size ) );
+   }
+   partition.push_back( n );
+
+   return partition;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a cost-weighted partition of the given index range.
+// \ingroup smp
+//
+// \param n The size of the index range \f$[0..n)\f$.
+// \param blocks The requested number of blocks \f$[1..\infty)\f$.
+// \param alignment The alignment of all block boundaries \f$[1..\infty)\f$.
+// \param increasing \a true for linearly increasing costs, \a false for linearly decreasing costs.
+// \return The resulting partition.
+//
+// This function partitions the index range \f$[0..n)\f$ into at most \a blocks blocks of equal
+// cost, assuming that the cost per index grows (or shrinks) linearly along the range. This is
+// the case for instance for the rows of a lower triangular matrix, where the \a i-th row
+// contains \a i+1 non-zero elements. The block boundaries are placed such that the cumulative
+// costs of all blocks are approximately equal and are rounded up to a multiple of \a alignment.
+*/
+inline Partition createWeightedPartition( size_t n, size_t blocks, size_t alignment, bool increasing )
+{
+   BLAZE_INTERNAL_ASSERT( blocks > 0UL, "Invalid number of blocks detected" );
+
+   Partition partition;
+   partition.reserve( blocks + 1UL );
+   partition.push_back( 0UL );
+
+   for( size_t i=1UL; i<blocks; ++i )
+   {
+      const double ratio( double(i) / double(blocks) );
+      const double bound( increasing ? n * sqrt( ratio ) : n * ( 1.0 - sqrt( 1.0 - ratio ) ) );
+      const size_t index( alignPartitionBoundary( static_cast<size_t>( bound ), alignment ) );
+
+      if( index > partition.back() && index < n ) {
+         partition.push_back( index );
+      }
+   }
+
+   if( n > 0UL ) {
+      partition.push_back( n );
+   }
+
+   return partition;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
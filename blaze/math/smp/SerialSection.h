@@ -89,10 +89,12 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the serial section.
-                         /*!< In case a serial section is active (i.e. the currently executed
-                              code is inside a serial section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static thread_local bool active_;  //!< Activity flag for the serial section.
+                                      /*!< In case a serial section is active (i.e. the currently
+                                           executed code is inside a serial section), the flag
+                                           is set to \a true, otherwise it is \a false. The flag
+                                           is local to each thread, i.e. a serial section only
+                                           affects the thread that has started it. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +118,7 @@ class SerialSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool SerialSection<T>::active_ = false;
+thread_local bool SerialSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
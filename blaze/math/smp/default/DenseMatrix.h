@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -76,6 +77,9 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline EnableIf_< IsDenseMatrix<MT1> >
    smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO, typename OP >
+inline ElementType_<MT> smpReduce( const DenseMatrix<MT,SO>& dm, OP op );
 //@}
 //*************************************************************************************************
 
@@ -205,6 +209,32 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<MT> smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
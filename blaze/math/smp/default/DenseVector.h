@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -80,6 +81,9 @@ inline EnableIf_< IsDenseVector<VT1> >
 template< typename VT1, bool TF1, typename VT2, bool TF2 >
 inline EnableIf_< IsDenseVector<VT1> >
    smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT, bool TF, typename OP >
+inline ElementType_<VT> smpReduce( const DenseVector<VT,TF>& dv, OP op );
 //@}
 //*************************************************************************************************
 
@@ -229,6 +233,32 @@ inline EnableIf_< IsDenseVector<VT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default SMP reduction of a dense vector.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline ElementType_<VT> smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,181 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/ExecutionContext.h
+//  \brief Header file for the default execution context
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_EXECUTIONCONTEXT_H_
+#define _BLAZE_MATH_SMP_DEFAULT_EXECUTIONCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default execution context in case no shared-memory parallelization is active.
+// \ingroup smp
+//
+// The ExecutionContext class provides the means to execute a given function with a specific
+// number of threads:
+
+   \code
+   blaze::DynamicMatrix<double> A( ... );
+   blaze::DynamicVector<double> x( ... ), y;
+
+   blaze::ExecutionContext ctx( 8 );  // Execution context with 8 threads
+
+   ctx.run( [&]{ y = A * x; } );  // Parallel execution with 8 threads
+   \endcode
+
+// In case no parallelization is active, all operations are executed by the calling thread and
+// the execution context merely executes the given function.
+*/
+class ExecutionContext
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ExecutionContext( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   inline void   resize( size_t n );
+
+   template< typename Callable >
+   inline void run( Callable&& func );
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ExecutionContext class.
+//
+// \param n The number of threads of the execution context \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+//
+// In case the given number of threads is 0, a \a std::invalid_argument exception is thrown.
+// Note that in case no parallelization is active, the number of threads has no effect.
+*/
+inline ExecutionContext::ExecutionContext( size_t n )
+{
+   resize( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads of the execution context.
+//
+// \return The number of threads of the execution context.
+//
+// Note that in case no parallelization is active the function will always return 1.
+*/
+inline size_t ExecutionContext::size() const
+{
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the number of threads of the execution context.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// In case the given number of threads is 0, a \a std::invalid_argument exception is thrown.
+// Note that in case no parallelization is active, the function has no effect.
+*/
+inline void ExecutionContext::resize( size_t n )
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given function within the execution context.
+//
+// \param func The function to be executed.
+// \return void
+*/
+template< typename Callable >  // Type of the function
+inline void ExecutionContext::run( Callable&& func )
+{
+   std::forward<Callable>( func )();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <omp.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
@@ -1038,6 +1039,165 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup math
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// matrix. The matrix is split along its major dimension into one block per thread, which are
+// reduced concurrently. The partial results of all blocks are subsequently combined by the
+// calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+ElementType_<MT> smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ET = ElementType_<MT>;
+
+   constexpr bool simdEnabled( MT::simdEnabled );
+
+   const bool dmAligned( (~dm).isAligned() );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+   const size_t K( SO == rowMajor ? M : N );
+
+   const int    threads      ( omp_get_max_threads() );
+   const size_t addon        ( ( ( K % threads ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerThread( K / threads + addon );
+   const int    tasks        ( ( K - 1UL ) / sizePerThread + 1UL );
+
+   std::vector<ET> partials( tasks );
+
+#pragma omp parallel for schedule(dynamic,1) shared( dm, partials )
+   for( int i=0; i<tasks; ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, K - index ) );
+
+      const size_t row   ( SO == rowMajor ? index : 0UL  );
+      const size_t column( SO == rowMajor ? 0UL   : index );
+      const size_t m     ( SO == rowMajor ? size  : M    );
+      const size_t n     ( SO == rowMajor ? N     : size );
+
+      if( simdEnabled && dmAligned ) {
+         partials[i] = dmatreduce( submatrix<aligned>( ~dm, row, column, m, n ), op );
+      }
+      else {
+         partials[i] = dmatreduce( submatrix<unaligned>( ~dm, row, column, m, n ), op );
+      }
+   }
+
+   ET redux( partials[0UL] );
+   for( size_t i=1UL; i<partials.size(); ++i ) {
+      redux = op( redux, partials[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense matrix. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< Not< IsSMPAssignable<MT> >, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the OpenMP-based SMP reduction of a dense matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense matrix is SMP-assignable. In case the reduction is requested from
+// within a serial or parallel section or in case the matrix is too small, the reduction is
+// performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<MT>, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT> );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~dm).canSMPAssign() ) {
+      return dmatreduce( ~dm, op );
+   }
+
+   ElementType_<MT> redux;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( ~dm, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
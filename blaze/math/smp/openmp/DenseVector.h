@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <omp.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
@@ -1081,6 +1082,158 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the OpenMP-based SMP reduction of a dense
+// vector. The vector is split into one block per thread, which are reduced concurrently. The
+// partial results of all blocks are subsequently combined by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+ElementType_<VT> smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ET = ElementType_<VT>;
+
+   constexpr bool simdEnabled( VT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const bool dvAligned( (~dv).isAligned() );
+
+   const int    threads      ( omp_get_max_threads() );
+   const size_t addon        ( ( ( (~dv).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~dv).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const int    tasks        ( ( (~dv).size() - 1UL ) / sizePerThread + 1UL );
+
+   std::vector<ET> partials( tasks );
+
+#pragma omp parallel for schedule(dynamic,1) shared( dv, partials )
+   for( int i=0; i<tasks; ++i )
+   {
+      const size_t index( i*sizePerThread );
+      const size_t size ( min( sizePerThread, (~dv).size() - index ) );
+
+      if( simdEnabled && dvAligned ) {
+         partials[i] = dvecreduce( subvector<aligned>( ~dv, index, size ), op );
+      }
+      else {
+         partials[i] = dvecreduce( subvector<unaligned>( ~dv, index, size ), op );
+      }
+   }
+
+   ET redux( partials[0UL] );
+   for( size_t i=1UL; i<partials.size(); ++i ) {
+      redux = op( redux, partials[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default OpenMP-based SMP reduction of a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< Not< IsSMPAssignable<VT> >, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the OpenMP-based SMP reduction of a dense vector. Due to the explicit
+// application of the SFINAE principle, this function can only be selected by the compiler in
+// case the dense vector is SMP-assignable. In case the reduction is requested from within a
+// serial or parallel section or in case the vector is too small, the reduction is performed
+// serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<VT>, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT> );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~dv).canSMPAssign() ) {
+      return dvecreduce( ~dv, op );
+   }
+
+   ElementType_<VT> redux{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( ~dv, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -0,0 +1,254 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/ExecutionContext.h
+//  \brief Header file for the OpenMP-based execution context
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_EXECUTIONCONTEXT_H_
+#define _BLAZE_MATH_SMP_OPENMP_EXECUTIONCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <utility>
+#include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Independent execution context for the OpenMP-based parallelization.
+// \ingroup smp
+//
+// The ExecutionContext class provides the means to execute a given function with a specific
+// number of threads:
+
+   \code
+   blaze::DynamicMatrix<double> A( ... );
+   blaze::DynamicVector<double> x( ... ), y;
+
+   blaze::ExecutionContext ctx( 8 );  // Execution context with 8 threads
+
+   ctx.run( [&]{ y = A * x; } );  // Parallel execution with 8 threads
+   \endcode
+
+// In case of the OpenMP-based parallelization, the number of threads of the execution context
+// is applied to the calling thread only (via \c omp_set_num_threads()), i.e. concurrent parallel
+// regions started by several application threads are managed by the OpenMP runtime. The
+// previous number of threads of the calling thread is restored when the function returns.
+*/
+class ExecutionContext
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ExecutionContext( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   inline void   resize( size_t n );
+
+   template< typename Callable >
+   inline void run( Callable&& func );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class Binding***********************************************************************
+   /*!\brief RAII setting of the number of OpenMP threads of the calling thread.
+   */
+   class Binding
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Sets the number of OpenMP threads of the calling thread.
+      //
+      // \param threads The number of threads.
+      */
+      explicit inline Binding( size_t threads )
+         : previous_( omp_get_max_threads() )  // The previous number of threads
+      {
+         omp_set_num_threads( threads );
+      }
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Restores the previous number of OpenMP threads of the calling thread.
+      */
+      inline ~Binding() {
+         omp_set_num_threads( previous_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      int previous_;  //!< The previous number of threads of the calling thread.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t threads_;  //!< The number of threads of the execution context.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ExecutionContext class.
+//
+// \param n The number of threads of the execution context \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This constructor creates an execution context with \a n threads. In case the given number of
+// threads is 0, a \a std::invalid_argument exception is thrown.
+*/
+inline ExecutionContext::ExecutionContext( size_t n )
+   : threads_( n )  // The number of threads of the execution context
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads of the execution context.
+//
+// \return The number of threads of the execution context.
+*/
+inline size_t ExecutionContext::size() const
+{
+   return threads_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the number of threads of the execution context.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the number of threads of the execution context. In case the given
+// number of threads is 0, a \a std::invalid_argument exception is thrown.
+*/
+inline void ExecutionContext::resize( size_t n )
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   threads_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given function within the execution context.
+//
+// \param func The function to be executed.
+// \return void
+//
+// This function executes the given function in the calling thread with the number of threads
+// of the execution context. The previous number of threads of the calling thread is restored
+// when the function returns, even in case the function throws an exception.
+*/
+template< typename Callable >  // Type of the function
+inline void ExecutionContext::run( Callable&& func )
+{
+   const Binding binding( threads_ );
+   std::forward<Callable>( func )();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
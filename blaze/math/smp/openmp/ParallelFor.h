@@ -0,0 +1,127 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/ParallelFor.h
+//  \brief Header file for the OpenMP-based SMP parallel loop
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_OPENMP_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief OpenMP-based implementation of the SMP parallel loop.
+// \ingroup smp
+//
+// \param n The number of loop iterations.
+// \param func The loop body to be executed for each index \f$[0..n)\f$.
+// \return void
+//
+// This function executes the given loop body for all indices \f$[0..n)\f$ by means of the
+// OpenMP-based parallelization. The indices are dynamically distributed among the threads of
+// the active OpenMP team. Therefore the loop body must not depend on the execution order of
+// different indices. Each index is processed inside a serial section in order to prevent any
+// further parallelization of the operations performed by the loop body. In case the loop is
+// executed from within a serial or parallel section, all indices are processed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of independent operations. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename Callable >  // Type of the loop body
+void smpFor( size_t n, const Callable& func )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( isSerialSectionActive() || isParallelSectionActive() || n < 2UL ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         func( i );
+      }
+      return;
+   }
+
+   const int iterations( n );
+
+   // No explicit parallel section: Within the OpenMP region isParallelSectionActive() already
+   // returns true, whereas a parallel section of the master thread would prevent the evaluation
+   // of Blaze expressions within the loop body of the master thread.
+#pragma omp parallel for schedule(dynamic,1) shared( func )
+   for( int i=0; i<iterations; ++i ) {
+      BLAZE_SERIAL_SECTION {
+         func( i );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,19 +40,23 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/views/Submatrix.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Min.h>
@@ -64,10 +68,77 @@
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
 
+//=================================================================================================
+//
+//  PARTITIONING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the row and column partitions for a C++11/Boost thread-based SMP assignment.
+// \ingroup math
+//
+// \param lhs The target left-hand side dense matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param alignment The alignment of all block boundaries.
+// \param rows The resulting partition of the rows.
+// \param columns The resulting partition of the columns.
+// \return void
+//
+// This function splits the given matrices into blocks, which are scheduled as individual tasks.
+// In order to balance the load among the threads, the operation is decomposed into a multiple
+// of the number of threads (see the \c BLAZE_SMP_TASKS_PER_THREAD configuration), which are
+// dynamically claimed by the idle threads of the thread pool. In case either of the two operands
+// is a lower or upper triangular matrix, the matrices are partitioned along the major dimension
+// only and the block boundaries are weighted according to the number of elements in the
+// triangular part, such that all blocks cause approximately the same amount of work.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , bool SO1      // Storage order of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void createPartitions( const DenseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs,
+                       size_t alignment, Partition& rows, Partition& columns )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   UNUSED_PARAMETER( lhs );
+
+   constexpr bool lower( IsLower<MT1>::value || IsLower<MT2>::value );
+   constexpr bool upper( IsUpper<MT1>::value || IsUpper<MT2>::value );
+
+   const size_t tasks( TheThreadBackend::size() * SMP_TASKS_PER_THREAD );
+
+   if( lower != upper && SO1 == rowMajor ) {
+      rows    = createWeightedPartition( (~rhs).rows(), tasks, alignment, lower );
+      columns = createUniformPartition( (~rhs).columns(), 1UL, alignment );
+   }
+   else if( lower != upper ) {
+      rows    = createUniformPartition( (~rhs).rows(), 1UL, alignment );
+      columns = createWeightedPartition( (~rhs).columns(), tasks, alignment, upper );
+   }
+   else {
+      const ThreadMapping threads( createThreadMapping( tasks, ~rhs ) );
+      rows    = createUniformPartition( (~rhs).rows()   , threads.first , alignment );
+      columns = createUniformPartition( (~rhs).columns(), threads.second, alignment );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  PLAIN ASSIGNMENT
@@ -109,34 +180,18 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& r
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
-
-   const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
-
-   const size_t addon2     ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threads.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+   Partition rows, columns;
+   createPartitions( ~lhs, ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ), rows, columns );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i+1UL<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( rows[i] );
+      const size_t m  ( rows[i+1UL] - row );
 
-      if( row >= (~lhs).rows() )
-         continue;
-
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j+1UL<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~rhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+         const size_t column( columns[j] );
+         const size_t n     ( columns[j+1UL] - column );
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
@@ -190,30 +245,18 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>&
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
-
-   const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
-
-   const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~rhs).columns() / threads.second + addon2 );
+   Partition rows, columns;
+   createPartitions( ~lhs, ~rhs, 1UL, rows, columns );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i+1UL<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( rows[i] );
+      const size_t m  ( rows[i+1UL] - row );
 
-      if( row >= (~lhs).rows() )
-         continue;
-
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j+1UL<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~lhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+         const size_t column( columns[j] );
+         const size_t n     ( columns[j+1UL] - column );
 
          auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
          TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
@@ -355,34 +398,18 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   Partition rows, columns;
+   createPartitions( ~lhs, ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ), rows, columns );
 
-   const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
-
-   const size_t addon2     ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threads.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
-
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i+1UL<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+      const size_t row( rows[i] );
+      const size_t m  ( rows[i+1UL] - row );
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j+1UL<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~rhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+         const size_t column( columns[j] );
+         const size_t n     ( columns[j+1UL] - column );
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
@@ -436,30 +463,18 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   Partition rows, columns;
+   createPartitions( ~lhs, ~rhs, 1UL, rows, columns );
 
-   const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
-
-   const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~rhs).columns() / threads.second + addon2 );
-
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i+1UL<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+      const size_t row( rows[i] );
+      const size_t m  ( rows[i+1UL] - row );
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j+1UL<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~lhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+         const size_t column( columns[j] );
+         const size_t n     ( columns[j+1UL] - column );
 
          auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
          TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
@@ -602,34 +617,18 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   Partition rows, columns;
+   createPartitions( ~lhs, ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ), rows, columns );
 
-   const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
-
-   const size_t addon2     ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threads.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
-
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i+1UL<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+      const size_t row( rows[i] );
+      const size_t m  ( rows[i+1UL] - row );
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j+1UL<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~rhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+         const size_t column( columns[j] );
+         const size_t n     ( columns[j+1UL] - column );
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
@@ -683,30 +682,18 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   Partition rows, columns;
+   createPartitions( ~lhs, ~rhs, 1UL, rows, columns );
 
-   const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
-
-   const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~rhs).columns() / threads.second + addon2 );
-
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i+1UL<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+      const size_t row( rows[i] );
+      const size_t m  ( rows[i+1UL] - row );
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j+1UL<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~lhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+         const size_t column( columns[j] );
+         const size_t n     ( columns[j+1UL] - column );
 
          auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
          TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
@@ -850,34 +837,18 @@ void smpSchurAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   Partition rows, columns;
+   createPartitions( ~lhs, ~rhs, ( simdEnabled ? SIMDSIZE : 1UL ), rows, columns );
 
-   const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
-   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
-   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
-
-   const size_t addon2     ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare2( (~rhs).columns() / threads.second + addon2 );
-   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
-   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
-
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i+1UL<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+      const size_t row( rows[i] );
+      const size_t m  ( rows[i+1UL] - row );
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j+1UL<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~rhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+         const size_t column( columns[j] );
+         const size_t n     ( columns[j+1UL] - column );
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
@@ -931,30 +902,18 @@ void smpSchurAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,S
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   Partition rows, columns;
+   createPartitions( ~lhs, ~rhs, 1UL, rows, columns );
 
-   const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
-
-   const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~rhs).columns() / threads.second + addon2 );
-
-   for( size_t i=0UL; i<threads.first; ++i )
+   for( size_t i=0UL; i+1UL<rows.size(); ++i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
+      const size_t row( rows[i] );
+      const size_t m  ( rows[i+1UL] - row );
 
-      for( size_t j=0UL; j<threads.second; ++j )
+      for( size_t j=0UL; j+1UL<columns.size(); ++j )
       {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~lhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+         const size_t column( columns[j] );
+         const size_t n     ( columns[j+1UL] - column );
 
          auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
          TheThreadBackend::scheduleSchurAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
@@ -1099,6 +1058,163 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup math
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction
+// of a dense matrix. The matrix is split along its major dimension into several blocks, which
+// are reduced concurrently. The partial results of all blocks are subsequently combined by the
+// calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+ElementType_<MT> smpReduce_backend( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ET = ElementType_<MT>;
+
+   constexpr bool simdEnabled( MT::simdEnabled );
+
+   const bool dmAligned( (~dm).isAligned() );
+
+   const size_t M( (~dm).rows()    );
+   const size_t N( (~dm).columns() );
+
+   const Partition partition( createGuidedPartition( ( SO == rowMajor ? M : N ), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, 1UL ) );
+
+   std::vector<ET> partials( partition.size() - 1UL );
+
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
+   {
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
+
+      const size_t row   ( SO == rowMajor ? index : 0UL  );
+      const size_t column( SO == rowMajor ? 0UL   : index );
+      const size_t m     ( SO == rowMajor ? size  : M    );
+      const size_t n     ( SO == rowMajor ? N     : size );
+
+      if( simdEnabled && dmAligned ) {
+         TheThreadBackend::scheduleReduce( partials[i], submatrix<aligned>( ~dm, row, column, m, n ), op );
+      }
+      else {
+         TheThreadBackend::scheduleReduce( partials[i], submatrix<unaligned>( ~dm, row, column, m, n ), op );
+      }
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partials[0UL] );
+   for( size_t i=1UL; i<partials.size(); ++i ) {
+      redux = op( redux, partials[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default C++11/Boost thread-based SMP reduction of a dense matrix. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense matrix is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< Not< IsSMPAssignable<MT> >, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dmatreduce( ~dm, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense matrix.
+// \ingroup smp
+//
+// \param dm The dense matrix to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the C++11/Boost thread-based SMP reduction of a dense matrix. Due to the
+// explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense matrix is SMP-assignable. In case the reduction is requested from
+// within a serial or parallel section or in case the matrix is too small, the reduction is
+// performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename MT    // Type of the dense matrix
+        , bool SO        // Storage order of the dense matrix
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<MT>, ElementType_<MT> >
+   smpReduce( const DenseMatrix<MT,SO>& dm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT> );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~dm).canSMPAssign() ) {
+      return dmatreduce( ~dm, op );
+   }
+
+   ElementType_<MT> redux;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( ~dm, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
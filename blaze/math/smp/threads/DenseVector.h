@@ -40,12 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/SMPAssignable.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/Partition.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -107,20 +109,13 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
@@ -173,18 +168,13 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
       auto target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -322,20 +312,13 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
@@ -388,18 +371,13 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
       auto target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -538,20 +516,13 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
@@ -604,18 +575,13 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
       auto target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -755,20 +721,13 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
@@ -821,18 +780,13 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, 1UL ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
       auto target( subvector<unaligned>( ~lhs, index, size ) );
       TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -972,20 +926,13 @@ void smpDivAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
-   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const Partition partition( createGuidedPartition( (~lhs).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
    {
-      const size_t index( i*sizePerThread );
-
-      if( index >= (~lhs).size() )
-         continue;
-
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
@@ -1097,6 +1044,155 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP reduction
+// of a dense vector. The vector is split into several blocks, which are reduced concurrently.
+// The partial results of all blocks are subsequently combined by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+ElementType_<VT> smpReduce_backend( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using ET = ElementType_<VT>;
+
+   constexpr bool simdEnabled( VT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const bool dvAligned( (~dv).isAligned() );
+
+   const Partition partition( createGuidedPartition( (~dv).size(), TheThreadBackend::size(),
+                                                     SMP_TASKS_PER_THREAD, ( simdEnabled ? SIMDSIZE : 1UL ) ) );
+
+   std::vector<ET> partials( partition.size() - 1UL );
+
+   for( size_t i=0UL; i+1UL<partition.size(); ++i )
+   {
+      const size_t index( partition[i] );
+      const size_t size ( partition[i+1UL] - index );
+
+      if( simdEnabled && dvAligned ) {
+         TheThreadBackend::scheduleReduce( partials[i], subvector<aligned>( ~dv, index, size ), op );
+      }
+      else {
+         TheThreadBackend::scheduleReduce( partials[i], subvector<unaligned>( ~dv, index, size ), op );
+      }
+   }
+
+   TheThreadBackend::wait();
+
+   ET redux( partials[0UL] );
+   for( size_t i=1UL; i<partials.size(); ++i ) {
+      redux = op( redux, partials[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the default C++11/Boost thread-based SMP reduction of a dense vector.
+// Due to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case the dense vector is not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< Not< IsSMPAssignable<VT> >, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP reduction of a dense vector.
+// \ingroup smp
+//
+// \param dv The dense vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function performs the C++11/Boost thread-based SMP reduction of a dense vector. Due to
+// the explicit application of the SFINAE principle, this function can only be selected by the
+// compiler in case the dense vector is SMP-assignable. In case the reduction is requested from
+// within a serial or parallel section or in case the vector is too small, the reduction is
+// performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// reduce() function.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag of the dense vector
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< IsSMPAssignable<VT>, ElementType_<VT> >
+   smpReduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<VT> );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || !(~dv).canSMPAssign() ) {
+      return dvecreduce( ~dv, op );
+   }
+
+   ElementType_<VT> redux{};
+
+   BLAZE_PARALLEL_SECTION
+   {
+      redux = smpReduce_backend( ~dv, op );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
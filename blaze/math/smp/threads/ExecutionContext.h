@@ -0,0 +1,259 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ExecutionContext.h
+//  \brief Header file for the C++11/Boost thread-based execution context
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_EXECUTIONCONTEXT_H_
+#define _BLAZE_MATH_SMP_THREADS_EXECUTIONCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Independent execution context for the C++11/Boost thread-based parallelization.
+// \ingroup smp
+//
+// By default, all application threads share the single, global thread pool of the \b Blaze
+// library. In case several application threads execute parallel operations concurrently, their
+// tasks are interleaved in the same task queue and each thread has to wait for the completion
+// of the tasks of all other threads. The ExecutionContext class provides an independent thread
+// pool, which can be bound to an application thread for the execution of a given function:
+
+   \code
+   blaze::DynamicMatrix<double> A( ... );
+   blaze::DynamicVector<double> x( ... ), y;
+
+   blaze::ExecutionContext ctx( 8 );  // Execution context with 8 threads
+
+   ctx.run( [&]{ y = A * x; } );  // Parallel execution with the 8 threads of the context
+   \endcode
+
+// All parallel operations executed within the given function are exclusively executed by the
+// threads of the execution context and waiting for their completion does not depend on the
+// operations of any other application thread. Also within the function, getNumThreads() returns
+// the number of threads of the execution context and setNumThreads() resizes the thread pool of
+// the execution context. Execution contexts can be reused for an arbitrary number of functions.
+// They must however not be used by several application threads at the same time.
+*/
+class ExecutionContext
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Pool = TheThreadBackend::Pool;  //!< Type of the thread pool of the execution context.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ExecutionContext( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+   inline void   resize( size_t n );
+
+   template< typename Callable >
+   inline void run( Callable&& func );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private class Binding***********************************************************************
+   /*!\brief RAII binding of a thread pool to the calling thread.
+   */
+   class Binding
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Binds the given thread pool to the calling thread.
+      //
+      // \param pool The thread pool to be bound.
+      */
+      explicit inline Binding( Pool& pool )
+         : previous_( TheThreadBackend::bind( &pool ) )  // The previously bound thread pool
+      {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Restores the previous binding of the calling thread.
+      */
+      inline ~Binding() {
+         TheThreadBackend::bind( previous_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      Pool* previous_;  //!< The thread pool previously bound to the calling thread.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Pool pool_;  //!< The thread pool of the execution context.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ExecutionContext class.
+//
+// \param n The number of threads of the execution context \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This constructor creates an execution context with \a n threads. In case the given number of
+// threads is 0, a \a std::invalid_argument exception is thrown.
+*/
+inline ExecutionContext::ExecutionContext( size_t n )
+   : pool_( n, SMP_SPIN_COUNT )  // The thread pool of the execution context
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads of the execution context.
+//
+// \return The number of threads of the execution context.
+*/
+inline size_t ExecutionContext::size() const
+{
+   return pool_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the number of threads of the execution context.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the number of threads of the execution context. In case the given
+// number of threads is 0, a \a std::invalid_argument exception is thrown.
+*/
+inline void ExecutionContext::resize( size_t n )
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   pool_.resize( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given function within the execution context.
+//
+// \param func The function to be executed.
+// \return void
+//
+// This function executes the given function in the calling thread. All parallel operations
+// started by the function are executed by the threads of the execution context. The previous
+// binding of the calling thread is restored when the function returns, even in case the
+// function throws an exception.
+*/
+template< typename Callable >  // Type of the function
+inline void ExecutionContext::run( Callable&& func )
+{
+   const Binding binding( pool_ );
+   std::forward<Callable>( func )();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -52,6 +52,7 @@
 
 #include <cstdlib>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
@@ -86,6 +87,10 @@ template< typename TT    // Type of the encapsulated thread
 class ThreadBackend
 {
  public:
+   //**Type definitions****************************************************************************
+   using Pool = ThreadPool<TT,MT,LT,CT>;  //!< Type of the thread pool.
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -95,6 +100,13 @@ class ThreadBackend
    //@}
    //**********************************************************************************************
 
+   //**Context functions***************************************************************************
+   /*!\name Context functions */
+   //@{
+   static inline Pool* bind( Pool* pool ) noexcept;
+   //@}
+   //**********************************************************************************************
+
    //**Thread execution functions******************************************************************
    /*!\name Thread execution functions */
    //@{
@@ -115,6 +127,12 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleDivAssign( Target& target, const Source& source );
+
+   template< typename Target, typename Source, typename OP >
+   static inline void scheduleReduce( Target& target, const Source& source, OP op );
+
+   template< typename Callable >
+   static inline void scheduleLoop( const Callable& func, size_t begin, size_t end );
    //@}
    //**********************************************************************************************
 
@@ -365,6 +383,100 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Reducer***********************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a reduction.
+   */
+   template< typename Target    // Type of the target value
+           , typename Source    // Type of the source operand
+           , typename OP >      // Type of the reduction operation
+   struct Reducer
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Reducer class template.
+      //
+      // \param target The target value the result of the reduction is assigned to.
+      // \param source The source operand to be reduced.
+      // \param op The reduction operation.
+      */
+      explicit inline Reducer( Target& target, const Source& source, OP op )
+         : target_( target )  // The target value
+         , source_( source )  // The source operand
+         , op_    ( op     )  // The reduction operation
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the reduction of the source operand.
+      //
+      // \return void
+      //
+      // The reduction is performed inside a serial section in order to prevent any further
+      // parallelization of the reduction of the (already partitioned) source operand.
+      */
+      inline void operator()() {
+         BLAZE_SERIAL_SECTION {
+            target_ = reduce( source_, op_ );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target&      target_;  //!< The target value.
+      const Source source_;  //!< The source operand.
+      OP           op_;      //!< The reduction operation.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Source );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Looper************************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a range of loop iterations.
+   */
+   template< typename Callable >  // Type of the loop body
+   struct Looper
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Looper class template.
+      //
+      // \param func The loop body to be executed for each index.
+      // \param begin The first index of the range of loop iterations.
+      // \param end The index one past the last index of the range of loop iterations.
+      */
+      explicit inline Looper( const Callable& func, size_t begin, size_t end )
+         : func_ ( func  )  // The loop body
+         , begin_( begin )  // The first index of the range
+         , end_  ( end   )  // The index one past the last index of the range
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the loop body for all indices of the range.
+      //
+      // \return void
+      //
+      // The loop iterations are executed inside a serial section in order to prevent any further
+      // parallelization of the operations performed by the loop body.
+      */
+      inline void operator()() {
+         BLAZE_SERIAL_SECTION {
+            for( size_t i=begin_; i<end_; ++i ) {
+               func_( i );
+            }
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const Callable& func_;   //!< The loop body.
+      size_t          begin_;  //!< The first index of the range of loop iterations.
+      size_t          end_;    //!< The index one past the last index of the range.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
@@ -372,15 +484,27 @@ class ThreadBackend
    //@}
    //**********************************************************************************************
 
+   //**Context functions***************************************************************************
+   /*!\name Context functions */
+   //@{
+   static inline Pool& pool() noexcept;
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static Pool threadpool_;  //!< The pool of active threads of the backend system.
+                             /*!< It is initialized with the number of threads specified via
+                                  the environment variable \c BLAZE_NUM_THREADS. However, it
+                                  can be explicitly resized to arbitrary numbers of threads.
+                                  The spin count of the thread pool is given by
+                                  \c BLAZE_SMP_SPIN_COUNT. */
+
+   static thread_local Pool* context_;  //!< The thread pool bound to the calling thread.
+                                        /*!< In case no thread pool is bound to the calling
+                                             thread (see the ExecutionContext class), all
+                                             tasks are scheduled to the global thread pool. */
    //@}
    //**********************************************************************************************
 };
@@ -399,7 +523,10 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), SMP_SPIN_COUNT );
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local ThreadPool<TT,MT,LT,CT>* ThreadBackend<TT,MT,LT,CT>::context_ = nullptr;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -424,7 +551,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 {
-   return threadpool_.size();
+   return pool().size();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -452,7 +579,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 {
-   return threadpool_.resize( n, block );
+   return pool().resize( n, block );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -472,7 +599,62 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   pool().wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONTEXT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Binds the given thread pool to the calling thread.
+//
+// \param pool The thread pool to be bound to the calling thread (\c nullptr for the global pool).
+// \return The thread pool previously bound to the calling thread.
+//
+// This function binds the given thread pool to the calling thread. All subsequent operations of
+// the backend system that are called by this thread (i.e. the scheduling of tasks, waiting for
+// their completion and querying or changing the number of threads) are redirected to the given
+// pool. Passing \c nullptr rebinds the calling thread to the global thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline ThreadPool<TT,MT,LT,CT>* ThreadBackend<TT,MT,LT,CT>::bind( Pool* pool ) noexcept
+{
+   Pool* previous( context_ );
+   context_ = pool;
+   return previous;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the thread pool bound to the calling thread.
+//
+// \return The thread pool bound to the calling thread.
+//
+// This function returns the thread pool that is bound to the calling thread. In case no thread
+// pool has been bound to the calling thread, the function returns the global thread pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline ThreadPool<TT,MT,LT,CT>& ThreadBackend<TT,MT,LT,CT>::pool() noexcept
+{
+   return ( context_ != nullptr )?( *context_ ):( threadpool_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -505,7 +687,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   pool().schedule( Assigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -530,7 +712,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   pool().schedule( AddAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -555,7 +737,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   pool().schedule( SubAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -580,7 +762,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleSchurAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SchurAssigner<Target,Source>( target, source ) );
+   pool().schedule( SchurAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -605,7 +787,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   pool().schedule( MultAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -630,7 +812,62 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleDivAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( DivAssigner<Target,Source>( target, source ) );
+   pool().schedule( DivAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a reduction of the given operand for execution.
+//
+// \param target The target value the result of the reduction is assigned to.
+// \param source The source operand to be reduced.
+// \param op The reduction operation.
+// \return void
+//
+// This function schedules the reduction of the given operand for execution. Note that the
+// target value must not be accessed before all scheduled tasks have been completed (see the
+// wait() function).
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Target    // Type of the target value
+        , typename Source    // Type of the source operand
+        , typename OP >      // Type of the reduction operation
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleReduce( Target& target, const Source& source, OP op )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   pool().schedule( Reducer<Target,Source,OP>( target, source, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a range of loop iterations for execution.
+//
+// \param func The loop body to be executed for each index.
+// \param begin The first index of the range of loop iterations.
+// \param end The index one past the last index of the range of loop iterations.
+// \return void
+//
+// This function schedules the execution of the given loop body for all indices of the range
+// \f$[begin..end)\f$. Note that the loop body is not copied, i.e. it must not be destroyed
+// before all scheduled tasks have been completed (see the wait() function).
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Callable >  // Type of the loop body
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleLoop( const Callable& func, size_t begin, size_t end )
+{
+   pool().schedule( Looper<Callable>( func, begin, end ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,603 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ArnoldiSolver.h
+//  \brief Header file for the thick-restart Arnoldi eigenvalue solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_ARNOLDISOLVER_H_
+#define _BLAZE_MATH_SOLVERS_ARNOLDISOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/QR.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatDMatMapExpr.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/geev.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/KrylovKernels.h>
+#include <blaze/math/solvers/KrylovSchurKernels.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/SpectrumFlag.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thick-restart Arnoldi solver for extremal eigenvalues of general operators.
+// \ingroup solvers
+//
+// The ArnoldiSolver class template computes a few eigenvalues at one end of the spectrum and
+// the according eigenvectors of a large, sparse general (i.e. non-symmetric) \a n-by-\a n
+// operator \a A. The operator can be any dense or sparse matrix (including adaptors) or a
+// matrix-free operator, i.e. a callable object that computes \f$ y = A*x \f$ via the signature
+// \c void(const DynamicVector<Type>& x, DynamicVector<Type>& y). The wanted part of the spectrum
+// is selected via the blaze::SpectrumFlag (by default the eigenvalues of largest magnitude).
+// Since the eigenvalues of a general real matrix can be complex, the eigenvalues and eigenvectors
+// are always returned as complex values:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnMajor;
+   using cplx = blaze::complex<double>;
+
+   CompressedMatrix<double> A( 10000UL, 10000UL );  // The general matrix
+   // ... Initialization
+
+   DynamicVector<cplx> w;                  // The resulting eigenvalues
+   DynamicMatrix<cplx,columnMajor> X;      // The resulting eigenvectors
+
+   blaze::ArnoldiSolver<double> solver( blaze::SolverControl( 100UL, 1E-10, 40UL ) );
+
+   // Computing the 5 eigenvalues of largest magnitude and the according eigenvectors of A
+   const blaze::SolverStatistics stats( solver.solve( A, w, X, 5UL ) );
+   \endcode
+
+// The eigenvalues are returned in the order of the SpectrumFlag (i.e. starting with the most
+// extremal eigenvalue) and the eigenvectors in the according columns of \a X. The eigenvectors
+// are normalized to unit length. The solver builds a Krylov subspace of the dimension given by
+// the \c restart parameter of the SolverControl (at least twice the number of requested
+// eigenvalues). The basis is stored in a single column-major matrix and is orthogonalized by
+// means of classical Gram-Schmidt with reorthogonalization (CGS2), i.e. by dense matrix/vector
+// multiplications. Sparse matrices are applied via the parallel sparse matrix/vector
+// multiplication. In case the wanted Ritz pairs did not yet converge, the decomposition is
+// restarted with an orthonormal basis of the wanted Ritz vectors (thick restart in the spirit
+// of the Krylov-Schur method). In case of a real operator, complex conjugate pairs of Ritz
+// values are always kept together, such that the restarted decomposition remains real. The
+// \c maxIterations parameter of the SolverControl limits the number of restarts. An eigenpair
+// \f$ (\theta,x) \f$ is considered converged as soon as the residual \f$ \|A*x-\theta*x\|_2 \f$
+// drops below the tolerance relative to the largest Ritz value in magnitude. The returned
+// statistics contain the number of restarts and the largest relative residual of the wanted
+// eigenpairs.
+//
+// For symmetric (Hermitian) operators the LanczosSolver should be preferred. Eigenvalues in
+// the interior of the spectrum or close to zero should be computed via a shift-invert operator
+// (see blaze::SpectrumFlag).
+//
+// \note A single ArnoldiSolver instance must not be used concurrently by several threads.
+*/
+template< typename Type >  // Data type of the vector elements
+class ArnoldiSolver
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                                     //!< Type of the vector elements.
+   using ValueType   = complex< UnderlyingElement_<Type> >;      //!< Type of the eigenvalues.
+   using VectorType  = DynamicVector<Type,columnVector>;         //!< Type of the internal work vectors.
+   using BasisType   = DynamicMatrix<Type,columnMajor>;          //!< Type of the Krylov basis.
+   using RitzType    = DynamicMatrix<ValueType,columnMajor>;     //!< Type of the Ritz vectors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ArnoldiSolver( const SolverControl& control = SolverControl() );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline SolverControl&       control() noexcept;
+   inline const SolverControl& control() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename MT1, bool SO1, typename VT, typename MT2, bool SO2 >
+   inline SolverStatistics solve( const Matrix<MT1,SO1>& A, DenseVector<VT,columnVector>& w,
+                                  DenseMatrix<MT2,SO2>& X, size_t nev,
+                                  SpectrumFlag spectrum = largestMagnitude );
+
+   template< typename OP, typename VT1, typename VT2, typename MT, bool SO >
+   SolverStatistics solve( const OP& A, const DenseVector<VT1,columnVector>& x0,
+                           DenseVector<VT2,columnVector>& w, DenseMatrix<MT,SO>& X,
+                           size_t nev, SpectrumFlag spectrum = largestMagnitude );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SolverControl            control_;  //!< The termination criteria of the solver.
+   VectorType               x_;        //!< The random start vector.
+   VectorType               v_;        //!< The current basis vector.
+   VectorType               w_;        //!< The new basis vector.
+   VectorType               h_;        //!< The orthogonalization coefficients.
+   VectorType               g_;        //!< The coefficients of the reorthogonalization.
+   BasisType                V_;        //!< The Krylov basis.
+   BasisType                H_;        //!< The projected upper Hessenberg matrix.
+   BasisType                T_;        //!< Copy of the projected matrix.
+   BasisType                Z_;        //!< The kept Ritz vectors of the projected matrix.
+   BasisType                Q_;        //!< The orthonormal basis of the kept Ritz vectors.
+   BasisType                R_;        //!< The triangular factor of the kept Ritz vectors.
+   BasisType                S_;        //!< The restarted projected matrix.
+   BasisType                W_;        //!< The compressed Krylov basis.
+   RitzType                 Y_;        //!< The eigenvectors of the projected matrix.
+   RitzType                 P_;        //!< The wanted eigenvectors of the projected matrix.
+   DynamicVector<ValueType> theta_;    //!< The Ritz values.
+   LAPACKWorkspace          ws_;       //!< The workspace of the projected eigenvalue problem.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for ArnoldiSolver.
+//
+// \param control The termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline ArnoldiSolver<Type>::ArnoldiSolver( const SolverControl& control )
+   : control_( control )  // The termination criteria of the solver
+   , x_      ()           // The random start vector
+   , v_      ()           // The current basis vector
+   , w_      ()           // The new basis vector
+   , h_      ()           // The orthogonalization coefficients
+   , g_      ()           // The coefficients of the reorthogonalization
+   , V_      ()           // The Krylov basis
+   , H_      ()           // The projected upper Hessenberg matrix
+   , T_      ()           // Copy of the projected matrix
+   , Z_      ()           // The kept Ritz vectors of the projected matrix
+   , Q_      ()           // The orthonormal basis of the kept Ritz vectors
+   , R_      ()           // The triangular factor of the kept Ritz vectors
+   , S_      ()           // The restarted projected matrix
+   , W_      ()           // The compressed Krylov basis
+   , Y_      ()           // The eigenvectors of the projected matrix
+   , P_      ()           // The wanted eigenvectors of the projected matrix
+   , theta_  ()           // The Ritz values
+   , ws_     ()           // The workspace of the projected eigenvalue problem
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline SolverControl& ArnoldiSolver<Type>::control() noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline const SolverControl& ArnoldiSolver<Type>::control() const noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selects the Ritz vectors kept during the restart of a real Arnoldi decomposition.
+// \ingroup solvers
+//
+// \param Y The eigenvectors of the projected matrix.
+// \param theta The Ritz values.
+// \param order The indices of the Ritz values, starting with the most wanted Ritz value.
+// \param k The requested number of kept Ritz vectors.
+// \param Z The resulting real basis of the kept Ritz vectors.
+// \return void
+//
+// Complex conjugate pairs of Ritz vectors are represented by their real and imaginary parts,
+// which span the same real invariant subspace. Pairs are never split, i.e. the resulting number
+// of kept vectors may differ from \a k by one.
+*/
+template< typename Type    // Data type of the Krylov basis
+        , typename CT >    // Complex data type of the Ritz vectors
+EnableIf_< IsBuiltin<Type> >
+   arnoldiRestartBasis( const DynamicMatrix<CT,columnMajor>& Y, const DynamicVector<CT,columnVector>& theta,
+                        const std::vector<size_t>& order, size_t k, DynamicMatrix<Type,columnMajor>& Z )
+{
+   const size_t m( Y.rows() );
+
+   std::vector<bool> kept( m, false );
+   size_t l( 0UL );
+
+   for( size_t i=0UL; l<k; ++i )
+   {
+      const size_t j( order[i] );
+
+      if( kept[j] ) continue;
+
+      if( imag( theta[j] ) == 0 ) {
+         kept[j] = true;
+         ++l;
+      }
+      else {
+         const size_t p( imag( theta[j] ) > 0 ? j+1UL : j-1UL );
+         if( l+2UL > m-1UL ) break;
+         kept[j] = kept[p] = true;
+         l += 2UL;
+      }
+   }
+
+   Z.resize( m, l, false );
+   l = 0UL;
+
+   for( size_t j=0UL; j<m; ++j )
+   {
+      if( !kept[j] || imag( theta[j] ) < 0 ) continue;
+
+      column( Z, l++ ) = real( column( Y, j ) );
+
+      if( imag( theta[j] ) > 0 ) {
+         column( Z, l++ ) = imag( column( Y, j ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selects the Ritz vectors kept during the restart of a complex Arnoldi decomposition.
+// \ingroup solvers
+//
+// \param Y The eigenvectors of the projected matrix.
+// \param theta The Ritz values.
+// \param order The indices of the Ritz values, starting with the most wanted Ritz value.
+// \param k The number of kept Ritz vectors.
+// \param Z The resulting basis of the kept Ritz vectors.
+// \return void
+*/
+template< typename Type    // Data type of the Krylov basis
+        , typename CT >    // Complex data type of the Ritz vectors
+EnableIf_< IsComplex<Type> >
+   arnoldiRestartBasis( const DynamicMatrix<CT,columnMajor>& Y, const DynamicVector<CT,columnVector>& /*theta*/,
+                        const std::vector<size_t>& order, size_t k, DynamicMatrix<Type,columnMajor>& Z )
+{
+   Z.resize( Y.rows(), k, false );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      column( Z, i ) = column( Y, order[i] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Ritz vectors of a real Arnoldi decomposition.
+// \ingroup solvers
+//
+// \param V The Krylov basis.
+// \param Y The selected eigenvectors of the projected matrix.
+// \param X The resulting complex Ritz vectors.
+// \return void
+*/
+template< typename MT1    // Type of the Krylov basis
+        , typename MT2    // Type of the selected eigenvectors
+        , typename MT3    // Type of the matrix of Ritz vectors
+        , bool SO >       // Storage order of the matrix of Ritz vectors
+EnableIf_< IsBuiltin< ElementType_<MT1> > >
+   arnoldiRitzVectors( const DenseMatrix<MT1,columnMajor>& V, const DenseMatrix<MT2,columnMajor>& Y,
+                       DenseMatrix<MT3,SO>& X )
+{
+   using BT = ElementType_<MT1>;
+
+   const DynamicMatrix<BT,columnMajor> Xr( ~V * real( ~Y ) );
+   const DynamicMatrix<BT,columnMajor> Xi( ~V * imag( ~Y ) );
+
+   ~X = map( Xr, Xi, []( BT re, BT im ){ return complex<BT>( re, im ); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Ritz vectors of a complex Arnoldi decomposition.
+// \ingroup solvers
+//
+// \param V The Krylov basis.
+// \param Y The selected eigenvectors of the projected matrix.
+// \param X The resulting Ritz vectors.
+// \return void
+*/
+template< typename MT1    // Type of the Krylov basis
+        , typename MT2    // Type of the selected eigenvectors
+        , typename MT3    // Type of the matrix of Ritz vectors
+        , bool SO >       // Storage order of the matrix of Ritz vectors
+EnableIf_< IsComplex< ElementType_<MT1> > >
+   arnoldiRitzVectors( const DenseMatrix<MT1,columnMajor>& V, const DenseMatrix<MT2,columnMajor>& Y,
+                       DenseMatrix<MT3,SO>& X )
+{
+   ~X = ~V * ~Y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes extremal eigenpairs of the given general matrix.
+//
+// \param A The general matrix.
+// \param w The resulting complex eigenvalues.
+// \param X The resulting complex eigenvectors (one per column).
+// \param nev The number of requested eigenpairs.
+// \param spectrum The wanted part of the spectrum.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the \a nev eigenvalues of the given matrix at the end of the spectrum
+// selected by \a spectrum and the according eigenvectors, starting from a random start vector.
+// In case the given matrix is not a square matrix or \a nev is either zero or larger than the
+// size of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename MT1     // Type of the matrix
+        , bool SO1         // Storage order of the matrix
+        , typename VT      // Type of the vector of eigenvalues
+        , typename MT2     // Type of the matrix of eigenvectors
+        , bool SO2 >       // Storage order of the matrix of eigenvectors
+inline SolverStatistics
+   ArnoldiSolver<Type>::solve( const Matrix<MT1,SO1>& A, DenseVector<VT,columnVector>& w,
+                               DenseMatrix<MT2,SO2>& X, size_t nev, SpectrumFlag spectrum )
+{
+   x_.resize( (~A).columns(), false );
+   randomize( x_ );
+
+   return solve( ~A, x_, w, X, nev, spectrum );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes extremal eigenpairs of the given general operator.
+//
+// \param A The general operator.
+// \param x0 The start vector.
+// \param w The resulting complex eigenvalues.
+// \param X The resulting complex eigenvectors (one per column).
+// \param nev The number of requested eigenpairs.
+// \param spectrum The wanted part of the spectrum.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Invalid start vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the \a nev eigenvalues of the given operator at the end of the spectrum
+// selected by \a spectrum and the according eigenvectors, using \a x0 as start vector of the
+// Krylov subspace. The size of the operator is given by the size of the start vector. In case
+// the given system matrix is not a square matrix, the size of the system matrix and the start
+// vector don't match, the start vector is zero, or \a nev is either zero or larger than the size
+// of the operator, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the operator
+        , typename VT1     // Type of the start vector
+        , typename VT2     // Type of the vector of eigenvalues
+        , typename MT      // Type of the matrix of eigenvectors
+        , bool SO >        // Storage order of the matrix of eigenvectors
+SolverStatistics
+   ArnoldiSolver<Type>::solve( const OP& A, const DenseVector<VT1,columnVector>& x0,
+                               DenseVector<VT2,columnVector>& w, DenseMatrix<MT,SO>& X,
+                               size_t nev, SpectrumFlag spectrum )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+
+   const size_t n( (~x0).size() );
+
+   checkKrylovOperator( A, n );
+
+   const size_t m( krylovSchurDimension( n, nev, control_.restart ) );
+
+   V_.resize( n, m+1UL, false );
+   H_.resize( m+1UL, m, false );
+   h_.resize( m+1UL, false );
+   g_.resize( m+1UL, false );
+   reset( H_ );
+
+   krylovSchurStart( ~x0, V_, v_ );
+
+   SolverStatistics stats{ 0UL, 0.0, false };
+   std::vector<size_t> order;
+   size_t k( 0UL );
+
+   while( true )
+   {
+      krylovSchurExpand( A, V_, H_, k, m, v_, w_, h_, g_ );
+
+      // Computation of the Ritz pairs
+      T_ = submatrix( H_, 0UL, 0UL, m, m );
+      geev( T_, theta_, Y_, ws_ );
+      order = sortRitzValues( theta_, spectrum );
+
+      // Convergence check of the wanted Ritz pairs
+      const Type beta( H_(m,m-1UL) );
+
+      double anorm( 0.0 );
+      for( size_t i=0UL; i<m; ++i ) {
+         anorm = max( anorm, static_cast<double>( abs( theta_[i] ) ) );
+      }
+
+      double residual( 0.0 );
+      for( size_t i=0UL; i<nev; ++i ) {
+         residual = max( residual, static_cast<double>( abs( beta ) * abs( Y_(m-1UL,order[i]) ) ) );
+      }
+
+      stats.residual  = ( anorm > 0.0 ? residual / anorm : residual );
+      stats.converged = ( stats.residual <= control_.tolerance );
+
+      if( stats.converged || stats.iterations >= control_.maxIterations ) break;
+
+      ++stats.iterations;
+
+      // Thick restart with an orthonormal basis of the wanted Ritz vectors
+      arnoldiRestartBasis( Y_, theta_, order, min( nev + ( m - nev ) / 2UL, m - 1UL ), Z_ );
+      qr( Z_, Q_, R_, ws_ );
+      k = Q_.columns();
+
+      S_ = ctrans( Q_ ) * submatrix( H_, 0UL, 0UL, m, m ) * Q_;
+
+      krylovSchurRotate( V_, Q_, W_ );
+
+      reset( H_ );
+      submatrix( H_, 0UL, 0UL, k, k ) = S_;
+      for( size_t i=0UL; i<k; ++i ) {
+         H_(k,i) = beta * Q_(m-1UL,i);
+      }
+   }
+
+   // Computation of the wanted eigenpairs
+   resize( ~w, nev, false );
+   P_.resize( m, nev, false );
+
+   for( size_t i=0UL; i<nev; ++i ) {
+      (~w)[i] = theta_[order[i]];
+      column( P_, i ) = column( Y_, order[i] );
+   }
+
+   resize( ~X, n, nev, false );
+   arnoldiRitzVectors( submatrix( V_, 0UL, 0UL, n, m ), P_, ~X );
+
+   return stats;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
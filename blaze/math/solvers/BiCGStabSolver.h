@@ -0,0 +1,488 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGStabSolver.h
+//  \brief Header file for the BiCGStab solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTABSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTABSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/KrylovKernels.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Stabilized biconjugate gradient solver for general systems.
+// \ingroup solvers
+//
+// The BiCGStabSolver class template implements the (right-preconditioned) BiCGStab method for
+// the solution of the linear system \f$ A*x=b \f$, where \a A is a general (i.e. not necessarily
+// symmetric) non-singular \a n-by-\a n matrix. The system operator can be any dense or sparse
+// matrix (including adaptors) or a matrix-free operator, i.e. a callable object that computes
+// \f$ y = A*x \f$ via the signature \c void(const DynamicVector<Type>& x, DynamicVector<Type>& y).
+// The optional preconditioner is a callable object computing \f$ z = M^{-1}*r \f$ via the
+// signature \c void(const DynamicVector<Type>& r, DynamicVector<Type>& z). The given vector \a x
+// is used as initial guess:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );  // The non-singular system matrix
+   DynamicVector<double> b( 1000UL );             // The right-hand side vector
+   DynamicVector<double> x( 1000UL, 0.0 );        // The initial guess
+   // ... Initialization
+
+   blaze::BiCGStabSolver<double> solver( blaze::SolverControl( 500UL, 1E-10 ) );
+
+   const blaze::SolverStatistics stats( solver.solve( A, b, x ) );
+   \endcode
+
+// All work vectors are owned by the solver and are reused for subsequent solves of systems of
+// the same size. The vector updates and inner products of each iteration are fused into five
+// passes over the work vectors, two of which are fused with the matrix/vector multiplications
+// in case of a row-major sparse matrix. For large systems, the fused kernels are executed in
+// parallel by means of the active SMP backend.
+//
+// \note A single BiCGStabSolver instance must not be used concurrently by several threads.
+*/
+template< typename Type >  // Data type of the vector elements
+class BiCGStabSolver
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                              //!< Type of the vector elements.
+   using VectorType  = DynamicVector<Type,columnVector>;  //!< Type of the internal work vectors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BiCGStabSolver( const SolverControl& control = SolverControl() );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline SolverControl&       control() noexcept;
+   inline const SolverControl& control() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2 >
+   inline SolverStatistics solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                  DenseVector<VT2,columnVector>& x );
+
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   inline SolverStatistics solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                  DenseVector<VT2,columnVector>& x, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   SolverStatistics solveBackend( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                  DenseVector<VT2,columnVector>& x, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SolverControl control_;  //!< The termination criteria of the solver.
+   VectorType    x_;        //!< The approximate solution.
+   VectorType    r_;        //!< The residual.
+   VectorType    rh_;       //!< The shadow residual.
+   VectorType    p_;        //!< The search direction.
+   VectorType    ph_;       //!< The preconditioned search direction.
+   VectorType    v_;        //!< The system operator applied to the search direction.
+   VectorType    s_;        //!< The intermediate residual.
+   VectorType    sh_;       //!< The preconditioned intermediate residual.
+   VectorType    t_;        //!< The system operator applied to the intermediate residual.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for BiCGStabSolver.
+//
+// \param control The termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline BiCGStabSolver<Type>::BiCGStabSolver( const SolverControl& control )
+   : control_( control )  // The termination criteria of the solver
+   , x_      ()           // The approximate solution
+   , r_      ()           // The residual
+   , rh_     ()           // The shadow residual
+   , p_      ()           // The search direction
+   , ph_     ()           // The preconditioned search direction
+   , v_      ()           // The system operator applied to the search direction
+   , s_      ()           // The intermediate residual
+   , sh_     ()           // The preconditioned intermediate residual
+   , t_      ()           // The system operator applied to the intermediate residual
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline SolverControl& BiCGStabSolver<Type>::control() noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline const SolverControl& BiCGStabSolver<Type>::control() const noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the BiCGStab method.
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function solves the linear system \f$ A*x=b \f$ via the BiCGStab method, using the given
+// vector \a x as initial guess. In case the given system matrix is not a square matrix or the
+// size of the system matrix and the vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the system operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the solution vector
+inline SolverStatistics
+   BiCGStabSolver<Type>::solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                DenseVector<VT2,columnVector>& x )
+{
+   return solveBackend( A, b, x, KrylovIdentity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the right-preconditioned BiCGStab method.
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param M The preconditioner.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function solves the linear system \f$ A*x=b \f$ via the right-preconditioned BiCGStab
+// method, using the given vector \a x as initial guess. The preconditioner \a M is a callable
+// object computing \f$ z = M^{-1}*r \f$. Due to the right preconditioning, the convergence is
+// measured in terms of the unpreconditioned residual. In case the given system matrix is not a
+// square matrix or the size of the system matrix and the vectors don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the system operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2     // Type of the solution vector
+        , typename PC >    // Type of the preconditioner
+inline SolverStatistics
+   BiCGStabSolver<Type>::solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                DenseVector<VT2,columnVector>& x, const PC& M )
+{
+   return solveBackend( A, b, x, M );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the (right-preconditioned) BiCGStab method.
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param M The preconditioner.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the system operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2     // Type of the solution vector
+        , typename PC >    // Type of the preconditioner
+SolverStatistics
+   BiCGStabSolver<Type>::solveBackend( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                       DenseVector<VT2,columnVector>& x, const PC& M )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   SolverStatistics stats{ 0UL, 0.0, true };
+
+   const double bnorm( initializeKrylov( A, b, x, x_, r_, v_ ) );
+
+   if( bnorm == 0.0 ) {
+      reset( ~x );
+      return stats;
+   }
+
+   const size_t n( (~b).size() );
+   const double threshold( control_.tolerance * bnorm );
+
+   p_.resize( n, false );
+   s_.resize( n, false );
+   t_.resize( n, false );
+   rh_ = r_;
+
+   Type rr( krylovDot( r_, r_ ) );
+   Type rho( rr ), rhoold( 1 ), alpha( 1 ), omega( 1 );
+
+   stats.converged = ( krylovSqrtNorm( rr ) <= threshold );
+
+   while( !stats.converged && stats.iterations < control_.maxIterations && rho != Type() )
+   {
+      if( stats.iterations == 0UL ) {
+         p_ = r_;
+      }
+      else {
+         bicgstabDirection( r_, ( rho / rhoold ) * ( alpha / omega ), omega, v_, p_ );
+      }
+
+      const VectorType& ph( preconditioned( M, p_, ph_ ) );
+      const Type rv( applyDot( A, ph, v_, rh_ ) );
+
+      if( rv == Type() ) break;
+
+      alpha = rho / rv;
+
+      const Type ss( bicgstabResidual( r_, alpha, v_, s_ ) );
+
+      if( krylovSqrtNorm( ss ) <= threshold ) {
+         krylovAxpy( alpha, ph, x_ );
+         rr = ss;
+         ++stats.iterations;
+         stats.converged = true;
+         break;
+      }
+
+      const VectorType& sh( preconditioned( M, s_, sh_ ) );
+
+      Type ts, tt;
+      applyDot2( A, sh, t_, s_, ts, tt );
+
+      if( tt == Type() ) break;
+
+      omega  = ts / tt;
+      rhoold = rho;
+
+      bicgstabUpdate( alpha, ph, omega, sh, s_, t_, rh_, x_, r_, rr, rho );
+      ++stats.iterations;
+
+      stats.converged = ( krylovSqrtNorm( rr ) <= threshold );
+
+      if( omega == Type() ) break;
+   }
+
+   stats.residual = krylovSqrtNorm( rr ) / bnorm;
+   ~x = x_;
+
+   return stats;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BiCGStab functions */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverStatistics bicgstab( const OP& A, const DenseVector<VT1,columnVector>& b,
+                           DenseVector<VT2,columnVector>& x, const SolverControl& control = SolverControl() );
+
+template< typename OP, typename VT1, typename VT2, typename PC >
+SolverStatistics bicgstab( const OP& A, const DenseVector<VT1,columnVector>& b,
+                           DenseVector<VT2,columnVector>& x, const PC& M,
+                           const SolverControl& control = SolverControl() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the BiCGStab method.
+// \ingroup solvers
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param control The termination criteria of the solver.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function is a shortcut for the solution of a single linear system via a temporary
+// BiCGStabSolver. In order to reuse the work vectors for several solves, a BiCGStabSolver
+// instance should be used instead.
+*/
+template< typename OP    // Type of the system operator
+        , typename VT1   // Type of the right-hand side vector
+        , typename VT2 > // Type of the solution vector
+SolverStatistics bicgstab( const OP& A, const DenseVector<VT1,columnVector>& b,
+                           DenseVector<VT2,columnVector>& x, const SolverControl& control )
+{
+   BiCGStabSolver< ElementType_<VT2> > solver( control );
+   return solver.solve( A, b, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the right-preconditioned BiCGStab method.
+// \ingroup solvers
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param M The preconditioner.
+// \param control The termination criteria of the solver.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function is a shortcut for the solution of a single linear system via a temporary
+// BiCGStabSolver. The preconditioner \a M is a callable object computing \f$ z = M^{-1}*r \f$.
+*/
+template< typename OP    // Type of the system operator
+        , typename VT1   // Type of the right-hand side vector
+        , typename VT2   // Type of the solution vector
+        , typename PC >  // Type of the preconditioner
+SolverStatistics bicgstab( const OP& A, const DenseVector<VT1,columnVector>& b,
+                           DenseVector<VT2,columnVector>& x, const PC& M, const SolverControl& control )
+{
+   BiCGStabSolver< ElementType_<VT2> > solver( control );
+   return solver.solve( A, b, x, M );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
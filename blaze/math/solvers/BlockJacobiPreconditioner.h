@@ -0,0 +1,326 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BlockJacobiPreconditioner.h
+//  \brief Header file for the block Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/BatchSolvers.h>
+#include <blaze/math/dense/MatrixBatch.h>
+#include <blaze/math/dense/VectorBatch.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/solvers/PreconditionerKernels.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Block Jacobi preconditioner.
+// \ingroup solvers
+//
+// The BlockJacobiPreconditioner class template represents the preconditioner \f$ M = D \f$,
+// where \a D is the block diagonal part of the system matrix consisting of \a B-by-\a B blocks
+// (in case the size of the matrix is not a multiple of \a B, the last block is smaller). The
+// diagonal blocks are stored in a MatrixBatch and are LU decomposed and solved by means of the
+// vectorized batch kernels. Therefore the preconditioner can only be used with the floating
+// point data types \c float and \c double. The block size should match the number of coupled
+// unknowns per node of the discretization (as for instance 3 for 3D elasticity):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::BlockJacobiPreconditioner<double,3UL> M( A );
+   blaze::cg( A, b, x, M );
+   \endcode
+
+// Note that the diagonal blocks are decomposed without pivoting (see the lu() function for
+// matrix batches). In case the values of the system matrix change, the preconditioner can be
+// updated via the compute() function.
+//
+// \note A single BlockJacobiPreconditioner instance must not be applied concurrently by several
+// threads.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Number of rows and columns of each diagonal block
+class BlockJacobiPreconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Data type of the preconditioner.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockJacobiPreconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline BlockJacobiPreconditioner( const Matrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\name Function call operator */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void operator()( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+
+   template< typename MT, bool SO >
+   void compute( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t                      size_;    //!< The number of rows and columns of the system matrix.
+   MatrixBatch<Type,B,B>       blocks_;  //!< The LU decomposed diagonal blocks.
+   mutable VectorBatch<Type,B> work_;    //!< The work vectors for the application.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( B > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockJacobiPreconditioner.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Number of rows and columns of each diagonal block
+inline BlockJacobiPreconditioner<Type,B>::BlockJacobiPreconditioner()
+   : size_  ( 0UL )  // The number of rows and columns of the system matrix
+   , blocks_()       // The LU decomposed diagonal blocks
+   , work_  ()       // The work vectors for the application
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the block Jacobi preconditioner of the given matrix.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Number of rows and columns of each diagonal block
+template< typename MT    // Type of the system matrix
+        , bool SO >      // Storage order of the system matrix
+inline BlockJacobiPreconditioner<Type,B>::BlockJacobiPreconditioner( const Matrix<MT,SO>& A )
+   : size_  ( 0UL )  // The number of rows and columns of the system matrix
+   , blocks_()       // The LU decomposed diagonal blocks
+   , work_  ()       // The work vectors for the application
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = D^{-1}*r \f$).
+//
+// \param r The input vector.
+// \param z The resulting preconditioned vector.
+// \return void
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// The preconditioned vector \a z is resized to the size of the preconditioner. It is allowed
+// to pass the same vector as \a r and \a z.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Number of rows and columns of each diagonal block
+template< typename VT1   // Type of the input vector
+        , typename VT2 > // Type of the preconditioned vector
+inline void BlockJacobiPreconditioner<Type,B>::operator()( const DenseVector<VT1,columnVector>& r,
+                                                           DenseVector<VT2,columnVector>& z ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   preparePreconditioner( size_, r, z );
+
+   const size_t blocks( blocks_.size() );
+
+   for( size_t k=0UL; k<blocks; ++k ) {
+      const size_t jend( min( B, size_-k*B ) );
+      for( size_t j=0UL; j<jend; ++j ) {
+         work_(k,j) = (~r)[k*B+j];
+      }
+   }
+
+   luSolve( blocks_, work_ );
+
+   for( size_t k=0UL; k<blocks; ++k ) {
+      const size_t jend( min( B, size_-k*B ) );
+      for( size_t j=0UL; j<jend; ++j ) {
+         (~z)[k*B+j] = work_(k,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioned system matrix.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Number of rows and columns of each diagonal block
+inline size_t BlockJacobiPreconditioner<Type,B>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the block Jacobi preconditioner of the given matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function extracts and LU decomposes the diagonal blocks of the given dense or sparse
+// matrix. In case the given matrix is not a square matrix, a \a std::invalid_argument exception
+// is thrown. In case any of the diagonal blocks cannot be decomposed without pivoting, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the preconditioner
+        , size_t B >     // Number of rows and columns of each diagonal block
+template< typename MT    // Type of the system matrix
+        , bool SO >      // Storage order of the system matrix
+void BlockJacobiPreconditioner<Type,B>::compute( const Matrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_<MT> C( ~A );  // Evaluation of the system matrix
+
+   const size_t n( C.rows() );
+   const size_t blocks( ( n + B - 1UL ) / B );
+
+   MatrixBatch<Type,B,B> tmp( blocks, Type(0) );
+
+   for( size_t k=0UL; k<blocks; ++k ) {
+      for( size_t i=0UL; i<B; ++i ) {
+         if( k*B+i >= n ) {
+            tmp(k,i,i) = Type(1);
+            continue;
+         }
+         const size_t jend( min( B, n-k*B ) );
+         for( size_t j=0UL; j<jend; ++j ) {
+            tmp(k,i,j) = C(k*B+i,k*B+j);
+         }
+      }
+   }
+
+   lu( tmp );
+
+   size_   = n;
+   blocks_ = std::move( tmp );
+   work_   = VectorBatch<Type,B>( blocks, Type(0) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
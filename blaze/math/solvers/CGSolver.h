@@ -0,0 +1,467 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CGSolver.h
+//  \brief Header file for the conjugate gradient solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CGSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_CGSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/KrylovKernels.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conjugate gradient solver for symmetric (Hermitian) positive definite systems.
+// \ingroup solvers
+//
+// The CGSolver class template implements the (preconditioned) conjugate gradient method for the
+// solution of the linear system \f$ A*x=b \f$, where \a A is a symmetric (or Hermitian) positive
+// definite \a n-by-\a n matrix. The system operator can be any dense or sparse matrix (including
+// adaptors such as the SymmetricMatrix) or a matrix-free operator, i.e. a callable object that
+// computes \f$ y = A*x \f$ via the signature \c void(const DynamicVector<Type>& x,
+// DynamicVector<Type>& y). The optional preconditioner is a callable object computing
+// \f$ z = M^{-1}*r \f$ via the signature \c void(const DynamicVector<Type>& r,
+// DynamicVector<Type>& z). The given vector \a x is used as initial guess:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );  // The positive definite system matrix
+   DynamicVector<double> b( 1000UL );             // The right-hand side vector
+   DynamicVector<double> x( 1000UL, 0.0 );        // The initial guess
+   // ... Initialization
+
+   blaze::CGSolver<double> solver( blaze::SolverControl( 500UL, 1E-10 ) );
+
+   const blaze::SolverStatistics stats( solver.solve( A, b, x ) );
+   \endcode
+
+// All work vectors are owned by the solver and are reused for subsequent solves of systems of
+// the same size. The vector updates and inner products of each iteration are fused into three
+// passes over the work vectors (one of them fused with the matrix/vector multiplication in case
+// of a row-major sparse matrix), which considerably reduces the memory traffic in comparison to
+// a straightforward implementation based on separate \c dot(), \c axpy and \c A*x operations.
+// For large systems, the fused kernels are executed in parallel by means of the active SMP
+// backend.
+//
+// \note A single CGSolver instance must not be used concurrently by several threads.
+*/
+template< typename Type >  // Data type of the vector elements
+class CGSolver
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                              //!< Type of the vector elements.
+   using VectorType  = DynamicVector<Type,columnVector>;  //!< Type of the internal work vectors.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CGSolver( const SolverControl& control = SolverControl() );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline SolverControl&       control() noexcept;
+   inline const SolverControl& control() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2 >
+   SolverStatistics solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                           DenseVector<VT2,columnVector>& x );
+
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   SolverStatistics solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                           DenseVector<VT2,columnVector>& x, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SolverControl control_;  //!< The termination criteria of the solver.
+   VectorType    x_;        //!< The approximate solution.
+   VectorType    r_;        //!< The residual.
+   VectorType    z_;        //!< The preconditioned residual.
+   VectorType    p_;        //!< The search direction.
+   VectorType    q_;        //!< The system operator applied to the search direction.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for CGSolver.
+//
+// \param control The termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline CGSolver<Type>::CGSolver( const SolverControl& control )
+   : control_( control )  // The termination criteria of the solver
+   , x_      ()           // The approximate solution
+   , r_      ()           // The residual
+   , z_      ()           // The preconditioned residual
+   , p_      ()           // The search direction
+   , q_      ()           // The system operator applied to the search direction
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline SolverControl& CGSolver<Type>::control() noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline const SolverControl& CGSolver<Type>::control() const noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the conjugate gradient method.
+//
+// \param A The symmetric (Hermitian) positive definite system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function solves the linear system \f$ A*x=b \f$ via the conjugate gradient method,
+// using the given vector \a x as initial guess. In case the given system matrix is not a square
+// matrix or the size of the system matrix and the vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the system operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the solution vector
+SolverStatistics CGSolver<Type>::solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                        DenseVector<VT2,columnVector>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   SolverStatistics stats{ 0UL, 0.0, true };
+
+   const double bnorm( initializeKrylov( A, b, x, x_, r_, q_ ) );
+
+   if( bnorm == 0.0 ) {
+      reset( ~x );
+      return stats;
+   }
+
+   const double threshold( control_.tolerance * bnorm );
+
+   p_ = r_;
+
+   Type rr( krylovDot( r_, r_ ) );
+   stats.converged = ( krylovSqrtNorm( rr ) <= threshold );
+
+   while( !stats.converged && stats.iterations < control_.maxIterations )
+   {
+      const Type pq( applyDot( A, p_, q_, p_ ) );
+
+      if( pq == Type() ) break;
+
+      const Type rrnew( cgUpdate( rr / pq, p_, q_, x_, r_ ) );
+      ++stats.iterations;
+
+      if( krylovSqrtNorm( rrnew ) <= threshold ) {
+         rr = rrnew;
+         stats.converged = true;
+         break;
+      }
+
+      cgDirection( r_, rrnew / rr, p_ );
+      rr = rrnew;
+   }
+
+   stats.residual = krylovSqrtNorm( rr ) / bnorm;
+   ~x = x_;
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the preconditioned conjugate gradient method.
+//
+// \param A The symmetric (Hermitian) positive definite system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param M The symmetric (Hermitian) positive definite preconditioner.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function solves the linear system \f$ A*x=b \f$ via the preconditioned conjugate
+// gradient method, using the given vector \a x as initial guess. The preconditioner \a M is
+// a callable object computing \f$ z = M^{-1}*r \f$. In case the given system matrix is not a
+// square matrix or the size of the system matrix and the vectors don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the system operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2     // Type of the solution vector
+        , typename PC >    // Type of the preconditioner
+SolverStatistics CGSolver<Type>::solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                        DenseVector<VT2,columnVector>& x, const PC& M )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   SolverStatistics stats{ 0UL, 0.0, true };
+
+   const double bnorm( initializeKrylov( A, b, x, x_, r_, q_ ) );
+
+   if( bnorm == 0.0 ) {
+      reset( ~x );
+      return stats;
+   }
+
+   const double threshold( control_.tolerance * bnorm );
+
+   applyPreconditioner( M, r_, z_ );
+   p_ = z_;
+
+   Type rr, rz;
+   krylovDot2( r_, r_, z_, rr, rz );
+   stats.converged = ( krylovSqrtNorm( rr ) <= threshold );
+
+   while( !stats.converged && stats.iterations < control_.maxIterations )
+   {
+      const Type pq( applyDot( A, p_, q_, p_ ) );
+
+      if( pq == Type() || rz == Type() ) break;
+
+      rr = cgUpdate( rz / pq, p_, q_, x_, r_ );
+      ++stats.iterations;
+
+      if( krylovSqrtNorm( rr ) <= threshold ) {
+         stats.converged = true;
+         break;
+      }
+
+      applyPreconditioner( M, r_, z_ );
+
+      const Type rznew( krylovDot( r_, z_ ) );
+      cgDirection( z_, rznew / rz, p_ );
+      rz = rznew;
+   }
+
+   stats.residual = krylovSqrtNorm( rr ) / bnorm;
+   ~x = x_;
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CG functions */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverStatistics cg( const OP& A, const DenseVector<VT1,columnVector>& b,
+                     DenseVector<VT2,columnVector>& x, const SolverControl& control = SolverControl() );
+
+template< typename OP, typename VT1, typename VT2, typename PC >
+SolverStatistics cg( const OP& A, const DenseVector<VT1,columnVector>& b,
+                     DenseVector<VT2,columnVector>& x, const PC& M,
+                     const SolverControl& control = SolverControl() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) positive definite system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param control The termination criteria of the solver.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function is a shortcut for the solution of a single linear system via a temporary
+// CGSolver. In order to reuse the work vectors for several solves, a CGSolver instance should
+// be used instead.
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::cg( A, b, x );                                 // Default termination criteria
+   blaze::cg( A, b, x, blaze::SolverControl( 100UL ) );  // At most 100 iterations
+   \endcode
+*/
+template< typename OP    // Type of the system operator
+        , typename VT1   // Type of the right-hand side vector
+        , typename VT2 > // Type of the solution vector
+SolverStatistics cg( const OP& A, const DenseVector<VT1,columnVector>& b,
+                     DenseVector<VT2,columnVector>& x, const SolverControl& control )
+{
+   CGSolver< ElementType_<VT2> > solver( control );
+   return solver.solve( A, b, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the preconditioned conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) positive definite system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param M The symmetric (Hermitian) positive definite preconditioner.
+// \param control The termination criteria of the solver.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function is a shortcut for the solution of a single linear system via a temporary
+// CGSolver. The preconditioner \a M is a callable object computing \f$ z = M^{-1}*r \f$.
+*/
+template< typename OP    // Type of the system operator
+        , typename VT1   // Type of the right-hand side vector
+        , typename VT2   // Type of the solution vector
+        , typename PC >  // Type of the preconditioner
+SolverStatistics cg( const OP& A, const DenseVector<VT1,columnVector>& b,
+                     DenseVector<VT2,columnVector>& x, const PC& M, const SolverControl& control )
+{
+   CGSolver< ElementType_<VT2> > solver( control );
+   return solver.solve( A, b, x, M );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,569 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRESSolver.h
+//  \brief Header file for the restarted GMRES solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRESSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_GMRESSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/KrylovKernels.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Restarted GMRES solver for general systems.
+// \ingroup solvers
+//
+// The GMRESSolver class template implements the restarted, right-preconditioned GMRES(m) method
+// for the solution of the linear system \f$ A*x=b \f$, where \a A is a general non-singular
+// \a n-by-\a n matrix. The system operator can be any dense or sparse matrix (including adaptors)
+// or a matrix-free operator, i.e. a callable object that computes \f$ y = A*x \f$ via the
+// signature \c void(const DynamicVector<Type>& x, DynamicVector<Type>& y). The optional
+// preconditioner is a callable object computing \f$ z = M^{-1}*r \f$ via the signature
+// \c void(const DynamicVector<Type>& r, DynamicVector<Type>& z). The given vector \a x is used
+// as initial guess. The restart length \a m is specified via the \c restart parameter of the
+// SolverControl:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );  // The non-singular system matrix
+   DynamicVector<double> b( 1000UL );             // The right-hand side vector
+   DynamicVector<double> x( 1000UL, 0.0 );        // The initial guess
+   // ... Initialization
+
+   blaze::GMRESSolver<double> solver( blaze::SolverControl( 500UL, 1E-10, 40UL ) );
+
+   const blaze::SolverStatistics stats( solver.solve( A, b, x ) );
+   \endcode
+
+// The Krylov basis is stored column-wise in a single column-major matrix, which is reused for
+// subsequent solves. The basis is orthogonalized by means of classical Gram-Schmidt with
+// reorthogonalization (CGS2), which in contrast to the modified Gram-Schmidt process replaces
+// the \a j inner products and vector updates of each iteration by two matrix/vector
+// multiplications with the basis and is therefore considerably more efficient. The least
+// squares problem is solved via Givens rotations, i.e. the residual norm is available in each
+// iteration without additional cost. At the end of each cycle, the true residual is recomputed.
+//
+// \note A single GMRESSolver instance must not be used concurrently by several threads.
+*/
+template< typename Type >  // Data type of the vector elements
+class GMRESSolver
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                              //!< Type of the vector elements.
+   using VectorType  = DynamicVector<Type,columnVector>;  //!< Type of the internal work vectors.
+   using BasisType   = DynamicMatrix<Type,columnMajor>;   //!< Type of the Krylov basis.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline GMRESSolver( const SolverControl& control = SolverControl() );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline SolverControl&       control() noexcept;
+   inline const SolverControl& control() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2 >
+   inline SolverStatistics solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                  DenseVector<VT2,columnVector>& x );
+
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   inline SolverStatistics solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                  DenseVector<VT2,columnVector>& x, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2, typename PC >
+   SolverStatistics solveBackend( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                  DenseVector<VT2,columnVector>& x, const PC& M );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SolverControl control_;  //!< The termination criteria of the solver.
+   VectorType    x_;        //!< The approximate solution.
+   VectorType    r_;        //!< The residual.
+   VectorType    v_;        //!< The current basis vector.
+   VectorType    z_;        //!< The preconditioned basis vector.
+   VectorType    w_;        //!< The new basis vector.
+   BasisType     V_;        //!< The Krylov basis.
+   BasisType     H_;        //!< The upper Hessenberg matrix.
+   VectorType    h_;        //!< The coefficients of the reorthogonalization.
+   VectorType    g_;        //!< The right-hand side of the least squares problem.
+   VectorType    c_;        //!< The cosines of the Givens rotations.
+   VectorType    s_;        //!< The sines of the Givens rotations.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for GMRESSolver.
+//
+// \param control The termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline GMRESSolver<Type>::GMRESSolver( const SolverControl& control )
+   : control_( control )  // The termination criteria of the solver
+   , x_      ()           // The approximate solution
+   , r_      ()           // The residual
+   , v_      ()           // The current basis vector
+   , z_      ()           // The preconditioned basis vector
+   , w_      ()           // The new basis vector
+   , V_      ()           // The Krylov basis
+   , H_      ()           // The upper Hessenberg matrix
+   , h_      ()           // The coefficients of the reorthogonalization
+   , g_      ()           // The right-hand side of the least squares problem
+   , c_      ()           // The cosines of the Givens rotations
+   , s_      ()           // The sines of the Givens rotations
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline SolverControl& GMRESSolver<Type>::control() noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline const SolverControl& GMRESSolver<Type>::control() const noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the restarted GMRES method.
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function solves the linear system \f$ A*x=b \f$ via the restarted GMRES method, using
+// the given vector \a x as initial guess. In case the given system matrix is not a square
+// matrix or the size of the system matrix and the vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the system operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the solution vector
+inline SolverStatistics
+   GMRESSolver<Type>::solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                             DenseVector<VT2,columnVector>& x )
+{
+   return solveBackend( A, b, x, KrylovIdentity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the right-preconditioned restarted GMRES method.
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param M The preconditioner.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function solves the linear system \f$ A*x=b \f$ via the right-preconditioned restarted
+// GMRES method, using the given vector \a x as initial guess. The preconditioner \a M is a
+// callable object computing \f$ z = M^{-1}*r \f$. Due to the right preconditioning, the
+// convergence is measured in terms of the unpreconditioned residual. In case the given system
+// matrix is not a square matrix or the size of the system matrix and the vectors don't match,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the system operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2     // Type of the solution vector
+        , typename PC >    // Type of the preconditioner
+inline SolverStatistics
+   GMRESSolver<Type>::solve( const OP& A, const DenseVector<VT1,columnVector>& b,
+                             DenseVector<VT2,columnVector>& x, const PC& M )
+{
+   return solveBackend( A, b, x, M );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the (right-preconditioned) restarted GMRES method.
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param M The preconditioner.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the system operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2     // Type of the solution vector
+        , typename PC >    // Type of the preconditioner
+SolverStatistics
+   GMRESSolver<Type>::solveBackend( const OP& A, const DenseVector<VT1,columnVector>& b,
+                                    DenseVector<VT2,columnVector>& x, const PC& M )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   using BT = UnderlyingElement_<Type>;
+
+   SolverStatistics stats{ 0UL, 0.0, true };
+
+   const double bnorm( initializeKrylov( A, b, x, x_, r_, w_ ) );
+
+   if( bnorm == 0.0 ) {
+      reset( ~x );
+      return stats;
+   }
+
+   const size_t n( (~b).size() );
+   const size_t m( max( min( control_.restart, n ), 1UL ) );
+   const double threshold( control_.tolerance * bnorm );
+
+   V_.resize( n, m+1UL, false );
+   H_.resize( m+1UL, m, false );
+   h_.resize( m+1UL, false );
+   g_.resize( m+1UL, false );
+   c_.resize( m, false );
+   s_.resize( m, false );
+
+   double beta( krylovNorm( r_ ) );
+   stats.converged = ( beta <= threshold );
+
+   while( !stats.converged && stats.iterations < control_.maxIterations )
+   {
+      // Initialization of the Krylov basis
+      column( V_, 0UL ) = r_ * ( Type( 1 ) / Type( beta ) );
+      reset( g_ );
+      g_[0UL] = Type( beta );
+
+      // Arnoldi process
+      size_t k( 0UL );
+      bool breakdown( false );
+
+      while( k < m && stats.iterations < control_.maxIterations )
+      {
+         const size_t j( k++ );
+
+         v_ = column( V_, j );
+         applyOperator( A, preconditioned( M, v_, z_ ), w_ );
+
+         // Orthogonalization via classical Gram-Schmidt with reorthogonalization
+         auto Vj( submatrix( V_, 0UL, 0UL, n, j+1UL ) );
+         auto Hj( subvector( column( H_, j ), 0UL, j+1UL ) );
+         auto hj( subvector( h_, 0UL, j+1UL ) );
+
+         Hj  = ctrans( Vj ) * w_;
+         w_ -= Vj * Hj;
+         hj  = ctrans( Vj ) * w_;
+         w_ -= Vj * hj;
+         Hj += hj;
+
+         const double hnorm( krylovNorm( w_ ) );
+         H_(j+1UL,j) = Type( hnorm );
+
+         if( hnorm != 0.0 ) {
+            column( V_, j+1UL ) = w_ * ( Type( 1 ) / Type( hnorm ) );
+         }
+
+         // Application of the previous Givens rotations
+         for( size_t i=0UL; i<j; ++i ) {
+            const Type tmp( c_[i]*H_(i,j) + s_[i]*H_(i+1UL,j) );
+            H_(i+1UL,j) = c_[i]*H_(i+1UL,j) - conj( s_[i] )*H_(i,j);
+            H_(i,j) = tmp;
+         }
+
+         // Computation and application of the new Givens rotation
+         const BT a( abs( H_(j,j) ) );
+         const BT rho( std::sqrt( a*a + BT( hnorm*hnorm ) ) );
+
+         if( a == BT() ) {
+            c_[j] = Type();
+            s_[j] = Type( 1 );
+            H_(j,j) = Type( hnorm );
+         }
+         else {
+            const Type alpha( H_(j,j) / a );
+            c_[j] = Type( a / rho );
+            s_[j] = alpha * BT( hnorm / rho );
+            H_(j,j) = alpha * rho;
+         }
+
+         H_(j+1UL,j) = Type();
+         g_[j+1UL] = -conj( s_[j] ) * g_[j];
+         g_[j] = c_[j] * g_[j];
+
+         ++stats.iterations;
+
+         if( abs( g_[j+1UL] ) <= threshold ) break;
+
+         if( hnorm == 0.0 ) {
+            breakdown = true;
+            break;
+         }
+      }
+
+      // Solution of the least squares problem via backward substitution
+      for( size_t i=k; i-- > 0UL; )
+      {
+         if( H_(i,i) == Type() ) {
+            breakdown = true;
+            k = 0UL;
+            break;
+         }
+
+         Type tmp( g_[i] );
+         for( size_t l=i+1UL; l<k; ++l ) {
+            tmp -= H_(i,l) * g_[l];
+         }
+         g_[i] = tmp / H_(i,i);
+      }
+
+      if( k == 0UL ) break;
+
+      // Update of the approximate solution and recomputation of the residual
+      w_ = submatrix( V_, 0UL, 0UL, n, k ) * subvector( g_, 0UL, k );
+      krylovAxpy( Type( 1 ), preconditioned( M, w_, z_ ), x_ );
+
+      applyOperator( A, x_, w_ );
+      r_ = ~b;
+      r_ -= w_;
+
+      beta = krylovNorm( r_ );
+      stats.converged = ( beta <= threshold );
+
+      if( breakdown ) break;
+   }
+
+   stats.residual = beta / bnorm;
+   ~x = x_;
+
+   return stats;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name GMRES functions */
+//@{
+template< typename OP, typename VT1, typename VT2 >
+SolverStatistics gmres( const OP& A, const DenseVector<VT1,columnVector>& b,
+                        DenseVector<VT2,columnVector>& x, const SolverControl& control = SolverControl() );
+
+template< typename OP, typename VT1, typename VT2, typename PC >
+SolverStatistics gmres( const OP& A, const DenseVector<VT1,columnVector>& b,
+                        DenseVector<VT2,columnVector>& x, const PC& M,
+                        const SolverControl& control = SolverControl() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the restarted GMRES method.
+// \ingroup solvers
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param control The termination criteria of the solver.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function is a shortcut for the solution of a single linear system via a temporary
+// GMRESSolver. In order to reuse the Krylov basis and the work vectors for several solves,
+// a GMRESSolver instance should be used instead.
+*/
+template< typename OP    // Type of the system operator
+        , typename VT1   // Type of the right-hand side vector
+        , typename VT2 > // Type of the solution vector
+SolverStatistics gmres( const OP& A, const DenseVector<VT1,columnVector>& b,
+                        DenseVector<VT2,columnVector>& x, const SolverControl& control )
+{
+   GMRESSolver< ElementType_<VT2> > solver( control );
+   return solver.solve( A, b, x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the linear system \f$ A*x=b \f$ via the right-preconditioned restarted GMRES method.
+// \ingroup solvers
+//
+// \param A The non-singular system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess and resulting approximate solution.
+// \param M The preconditioner.
+// \param control The termination criteria of the solver.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function is a shortcut for the solution of a single linear system via a temporary
+// GMRESSolver. The preconditioner \a M is a callable object computing \f$ z = M^{-1}*r \f$.
+*/
+template< typename OP    // Type of the system operator
+        , typename VT1   // Type of the right-hand side vector
+        , typename VT2   // Type of the solution vector
+        , typename PC >  // Type of the preconditioner
+SolverStatistics gmres( const OP& A, const DenseVector<VT1,columnVector>& b,
+                        DenseVector<VT2,columnVector>& x, const PC& M, const SolverControl& control )
+{
+   GMRESSolver< ElementType_<VT2> > solver( control );
+   return solver.solve( A, b, x, M );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,460 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IC0Preconditioner.h
+//  \brief Header file for the incomplete Cholesky preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/solvers/PreconditionerKernels.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky preconditioner without fill-in (IC(0)).
+// \ingroup solvers
+//
+// The IC0Preconditioner class template represents the incomplete Cholesky decomposition
+// \f$ M = L*L^H \approx A \f$ of a symmetric (Hermitian) positive definite sparse matrix, where
+// the lower triangular factor \a L has the same sparsity pattern as the lower part of \a A. Only
+// the lower part of the system matrix is accessed, i.e. it is possible to use both a general
+// CompressedMatrix and a SymmetricMatrix or HermitianMatrix adaptor. The factor \a L and its
+// conjugate transpose are stored as row-major compressed matrices, the application
+// \f$ z = L^{-H}*L^{-1}*r \f$ consists of a level-scheduled forward and backward substitution
+// (see the LevelSchedule class). The preconditioner is meant for the conjugate gradient method:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::IC0Preconditioner<double> M( A );
+   blaze::cg( A, b, x, M );
+   \endcode
+
+// Analogous to the ILU0Preconditioner, the computation is split into the symbolic compute()
+// function and the numeric factorize() function, which can be used to cheaply update the
+// preconditioner for a matrix with the same sparsity pattern. Note that the incomplete Cholesky
+// decomposition of a general positive definite matrix may break down. It is guaranteed to exist
+// for instance for M-matrices and diagonally dominant matrices with positive diagonal.
+*/
+template< typename Type >  // Data type of the preconditioner
+class IC0Preconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Data type of the preconditioner.
+   using MatrixType  = CompressedMatrix<Type,rowMajor>;  //!< Type of the factor storage.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline IC0Preconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline IC0Preconditioner( const SparseMatrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\name Function call operator */
+   //@{
+   template< typename VT1, typename VT2 >
+   void operator()( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t            size  () const noexcept;
+   inline const MatrixType& factor() const noexcept;
+
+   template< typename MT, bool SO >
+   void compute( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void decompose();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType                       L_;        //!< The incomplete lower Cholesky factor.
+   MatrixType                       U_;        //!< The conjugate transpose of the lower factor.
+   DynamicVector<Type,columnVector> inverse_;  //!< The inverted diagonal of the lower factor.
+   LevelSchedule                    lower_;    //!< The schedule of the forward substitution.
+   LevelSchedule                    upper_;    //!< The schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for IC0Preconditioner.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline IC0Preconditioner<Type>::IC0Preconditioner()
+   : L_      ()  // The incomplete lower Cholesky factor
+   , U_      ()  // The conjugate transpose of the lower factor
+   , inverse_()  // The inverted diagonal of the lower factor
+   , lower_  ()  // The schedule of the forward substitution
+   , upper_  ()  // The schedule of the backward substitution
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the IC(0) preconditioner of the given sparse matrix.
+//
+// \param A The symmetric (Hermitian) positive definite sparse system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline IC0Preconditioner<Type>::IC0Preconditioner( const SparseMatrix<MT,SO>& A )
+   : L_      ()  // The incomplete lower Cholesky factor
+   , U_      ()  // The conjugate transpose of the lower factor
+   , inverse_()  // The inverted diagonal of the lower factor
+   , lower_  ()  // The schedule of the forward substitution
+   , upper_  ()  // The schedule of the backward substitution
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = L^{-H}*L^{-1}*r \f$).
+//
+// \param r The input vector.
+// \param z The resulting preconditioned vector.
+// \return void
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// The preconditioned vector \a z is resized to the size of the preconditioner. It is allowed
+// to pass the same vector as \a r and \a z.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the input vector
+        , typename VT2 >   // Type of the preconditioned vector
+void IC0Preconditioner<Type>::operator()( const DenseVector<VT1,columnVector>& r,
+                                          DenseVector<VT2,columnVector>& z ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   preparePreconditioner( L_.rows(), r, z );
+
+   const VT1& x( ~r );
+   VT2& y( ~z );
+
+   lower_.execute( [this,&x,&y]( size_t i )
+   {
+      const auto diagonal( L_.end(i) - 1L );
+      Type sum( x[i] );
+      for( auto element=L_.begin(i); element!=diagonal; ++element ) {
+         sum -= element->value() * y[element->index()];
+      }
+      y[i] = sum * inverse_[i];
+   } );
+
+   upper_.execute( [this,&y]( size_t i )
+   {
+      Type sum( y[i] );
+      for( auto element=U_.begin(i)+1L; element!=U_.end(i); ++element ) {
+         sum -= element->value() * y[element->index()];
+      }
+      y[i] = sum * inverse_[i];
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioned system matrix.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t IC0Preconditioner<Type>::size() const noexcept
+{
+   return L_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the incomplete lower Cholesky factor.
+//
+// \return The incomplete lower Cholesky factor.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const typename IC0Preconditioner<Type>::MatrixType&
+   IC0Preconditioner<Type>::factor() const noexcept
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the IC(0) preconditioner of the given sparse matrix.
+//
+// \param A The symmetric (Hermitian) positive definite sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+//
+// This function performs both the symbolic and the numeric phase of the computation of the
+// preconditioner: It copies the sparsity pattern of the lower part of the given matrix, computes
+// the schedules of the triangular substitutions, and computes the incomplete decomposition. In
+// case the given matrix is not a square matrix, any of its diagonal elements is not contained in
+// its sparsity pattern, or the decomposition breaks down due to a non-positive pivot, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void IC0Preconditioner<Type>::compute( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   copyPattern( ~A, L_, true );
+
+   const size_t n( L_.rows() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( L_.begin(i) == L_.end(i) || ( L_.end(i) - 1L )->index() != i ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Missing diagonal element" );
+      }
+   }
+
+   std::vector<size_t> nonzeros( n, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=L_.begin(i); element!=L_.end(i); ++element ) {
+         ++nonzeros[element->index()];
+      }
+   }
+
+   U_ = MatrixType( n, n, nonzeros );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=L_.begin(i); element!=L_.end(i); ++element ) {
+         U_.append( element->index(), i, Type() );
+      }
+   }
+
+   lower_.analyzeLower( L_ );
+   upper_.analyzeUpper( U_ );
+   decompose();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recomputes the numeric decomposition for a sparse matrix with the same sparsity pattern.
+//
+// \param A The symmetric (Hermitian) positive definite sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+//
+// This function recomputes the incomplete decomposition for the given matrix by reusing the
+// storage of the factor and the schedules of the triangular substitutions. Therefore the
+// sparsity pattern of the lower part of the given matrix is required to be identical to the
+// pattern of the matrix passed to the last call of the compute() function. Otherwise or in case
+// the decomposition breaks down, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void IC0Preconditioner<Type>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   copyValues( ~A, L_, true );
+   decompose();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the incomplete Cholesky decomposition in place of the copied lower part.
+//
+// \return void
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the IC(0) decomposition row by row, restricting all updates to the
+// existing sparsity pattern, and subsequently updates the conjugate transpose of the factor.
+*/
+template< typename Type >  // Data type of the preconditioner
+void IC0Preconditioner<Type>::decompose()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( L_.rows() );
+
+   std::vector<size_t> position( n, n );
+
+   inverse_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto begin   ( L_.begin(i) );
+      const auto diagonal( L_.end(i) - 1L );
+
+      for( auto element=begin; element!=diagonal; ++element ) {
+         position[element->index()] = element - begin;
+      }
+
+      auto pivot( real( diagonal->value() ) );
+
+      for( auto element=begin; element!=diagonal; ++element )
+      {
+         const size_t k( element->index() );
+
+         Type sum( element->value() );
+
+         for( auto lower=L_.begin(k); lower!=L_.end(k)-1L; ++lower ) {
+            const size_t pos( position[lower->index()] );
+            if( pos != n ) {
+               sum -= begin[pos].value() * conj( lower->value() );
+            }
+         }
+
+         element->value() = sum * inverse_[k];
+         pivot -= real( element->value() * conj( element->value() ) );
+      }
+
+      for( auto element=begin; element!=diagonal; ++element ) {
+         position[element->index()] = n;
+      }
+
+      if( !( pivot > decltype( pivot )() ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of non-positive-definite matrix failed" );
+      }
+
+      diagonal->value() = Type( std::sqrt( pivot ) );
+      inverse_[i] = Type(1) / diagonal->value();
+   }
+
+   std::vector<size_t> offset( n, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=L_.begin(i); element!=L_.end(i); ++element ) {
+         const size_t j( element->index() );
+         U_.begin(j)[offset[j]++].value() = conj( element->value() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
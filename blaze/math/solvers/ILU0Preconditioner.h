@@ -0,0 +1,439 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILU0Preconditioner.h
+//  \brief Header file for the incomplete LU preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/solvers/PreconditionerKernels.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner without fill-in (ILU(0)).
+// \ingroup solvers
+//
+// The ILU0Preconditioner class template represents the incomplete LU decomposition
+// \f$ M = L*U \approx A \f$ of a square sparse matrix, where the lower unitriangular factor
+// \a L and the upper triangular factor \a U have the same sparsity pattern as the lower and
+// upper part of \a A, respectively. Both factors are stored in a single row-major compressed
+// matrix. The application \f$ z = U^{-1}*L^{-1}*r \f$ consists of a forward and a backward
+// substitution, which are level-scheduled (see the LevelSchedule class) and for large levels
+// executed in parallel. The preconditioner is primarily meant for non-symmetric systems:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::ILU0Preconditioner<double> M( A );
+   blaze::gmres( A, b, x, M );
+   \endcode
+
+// The computation of the preconditioner is split into a symbolic and a numeric phase. The
+// compute() function copies the sparsity pattern of the given matrix and analyzes the
+// dependencies of the triangular substitutions. The factorize() function only recomputes the
+// numeric decomposition of a matrix with the same sparsity pattern and can be used to cheaply
+// update the preconditioner in case only the values of the system matrix change (as for
+// instance in a Newton or time stepping scheme):
+
+   \code
+   blaze::ILU0Preconditioner<double> M( A );  // Symbolic and numeric phase
+
+   for( ... ) {
+      // ... Updating the values of A
+      M.factorize( A );  // Numeric phase only
+      blaze::gmres( A, b, x, M );
+   }
+   \endcode
+
+// Note that the system matrix is required to contain all diagonal elements. The decomposition
+// is performed without pivoting, which is guaranteed to succeed for instance for M-matrices
+// and diagonally dominant matrices.
+*/
+template< typename Type >  // Data type of the preconditioner
+class ILU0Preconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Data type of the preconditioner.
+   using MatrixType  = CompressedMatrix<Type,rowMajor>;  //!< Type of the factor storage.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ILU0Preconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline ILU0Preconditioner( const SparseMatrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\name Function call operator */
+   //@{
+   template< typename VT1, typename VT2 >
+   void operator()( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t            size   () const noexcept;
+   inline const MatrixType& factors() const noexcept;
+
+   template< typename MT, bool SO >
+   void compute( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void decompose();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType                       LU_;        //!< The incomplete LU factors.
+   std::vector<size_t>              diagonal_;  //!< The positions of the diagonal elements.
+   DynamicVector<Type,columnVector> inverse_;   //!< The inverted diagonal of the upper factor.
+   LevelSchedule                    lower_;     //!< The schedule of the forward substitution.
+   LevelSchedule                    upper_;     //!< The schedule of the backward substitution.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for ILU0Preconditioner.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline ILU0Preconditioner<Type>::ILU0Preconditioner()
+   : LU_      ()  // The incomplete LU factors
+   , diagonal_()  // The positions of the diagonal elements
+   , inverse_ ()  // The inverted diagonal of the upper factor
+   , lower_   ()  // The schedule of the forward substitution
+   , upper_   ()  // The schedule of the backward substitution
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the ILU(0) preconditioner of the given sparse matrix.
+//
+// \param A The square sparse system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline ILU0Preconditioner<Type>::ILU0Preconditioner( const SparseMatrix<MT,SO>& A )
+   : LU_      ()  // The incomplete LU factors
+   , diagonal_()  // The positions of the diagonal elements
+   , inverse_ ()  // The inverted diagonal of the upper factor
+   , lower_   ()  // The schedule of the forward substitution
+   , upper_   ()  // The schedule of the backward substitution
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = U^{-1}*L^{-1}*r \f$).
+//
+// \param r The input vector.
+// \param z The resulting preconditioned vector.
+// \return void
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// The preconditioned vector \a z is resized to the size of the preconditioner. It is allowed
+// to pass the same vector as \a r and \a z.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the input vector
+        , typename VT2 >   // Type of the preconditioned vector
+void ILU0Preconditioner<Type>::operator()( const DenseVector<VT1,columnVector>& r,
+                                           DenseVector<VT2,columnVector>& z ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   preparePreconditioner( LU_.rows(), r, z );
+
+   const VT1& x( ~r );
+   VT2& y( ~z );
+
+   lower_.execute( [this,&x,&y]( size_t i )
+   {
+      const auto diagonal( LU_.begin(i) + diagonal_[i] );
+      Type sum( x[i] );
+      for( auto element=LU_.begin(i); element!=diagonal; ++element ) {
+         sum -= element->value() * y[element->index()];
+      }
+      y[i] = sum;
+   } );
+
+   upper_.execute( [this,&y]( size_t i )
+   {
+      Type sum( y[i] );
+      for( auto element=LU_.begin(i)+diagonal_[i]+1UL; element!=LU_.end(i); ++element ) {
+         sum -= element->value() * y[element->index()];
+      }
+      y[i] = sum * inverse_[i];
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioned system matrix.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t ILU0Preconditioner<Type>::size() const noexcept
+{
+   return LU_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the incomplete LU factors.
+//
+// \return The incomplete LU factors.
+//
+// This function returns both incomplete factors stored in a single compressed matrix: The
+// strictly lower part contains the lower unitriangular factor \a L (without its unit diagonal),
+// the upper part (including the diagonal) contains the upper triangular factor \a U.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const typename ILU0Preconditioner<Type>::MatrixType&
+   ILU0Preconditioner<Type>::factors() const noexcept
+{
+   return LU_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the ILU(0) preconditioner of the given sparse matrix.
+//
+// \param A The square sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function performs both the symbolic and the numeric phase of the computation of the
+// preconditioner: It copies the sparsity pattern of the given matrix, computes the schedules
+// of the triangular substitutions, and computes the incomplete decomposition. In case the given
+// matrix is not a square matrix or any of its diagonal elements is not contained in its sparsity
+// pattern, a \a std::invalid_argument exception is thrown. In case a zero pivot is encountered,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void ILU0Preconditioner<Type>::compute( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   copyPattern( ~A, LU_, false );
+   findDiagonal( LU_, diagonal_ );
+   lower_.analyzeLower( LU_ );
+   upper_.analyzeUpper( LU_ );
+   decompose();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recomputes the numeric decomposition for a sparse matrix with the same sparsity pattern.
+//
+// \param A The square sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function recomputes the incomplete decomposition for the given matrix by reusing the
+// storage of the factors and the schedules of the triangular substitutions. Therefore the
+// sparsity pattern of the given matrix is required to be identical to the pattern of the matrix
+// passed to the last call of the compute() function. Otherwise a \a std::invalid_argument
+// exception is thrown. In case a zero pivot is encountered, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void ILU0Preconditioner<Type>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   copyValues( ~A, LU_, false );
+   decompose();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the incomplete LU decomposition in place of the copied system matrix.
+//
+// \return void
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the ILU(0) decomposition row by row (IKJ variant), restricting all
+// updates to the existing sparsity pattern.
+*/
+template< typename Type >  // Data type of the preconditioner
+void ILU0Preconditioner<Type>::decompose()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( LU_.rows() );
+
+   std::vector<size_t> position( n, n );
+
+   inverse_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto begin   ( LU_.begin(i) );
+      const auto end     ( LU_.end(i) );
+      const auto diagonal( begin + diagonal_[i] );
+
+      for( auto element=begin; element!=end; ++element ) {
+         position[element->index()] = element - begin;
+      }
+
+      for( auto element=begin; element!=diagonal; ++element )
+      {
+         const size_t k( element->index() );
+
+         element->value() *= inverse_[k];
+
+         for( auto upper=LU_.begin(k)+diagonal_[k]+1UL; upper!=LU_.end(k); ++upper ) {
+            const size_t pos( position[upper->index()] );
+            if( pos != n ) {
+               begin[pos].value() -= element->value() * upper->value();
+            }
+         }
+      }
+
+      for( auto element=begin; element!=end; ++element ) {
+         position[element->index()] = n;
+      }
+
+      if( isDefault( diagonal->value() ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Decomposition of singular matrix failed" );
+      }
+
+      inverse_[i] = Type(1) / diagonal->value();
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,278 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/JacobiPreconditioner.h
+//  \brief Header file for the Jacobi preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_JACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/PreconditionerKernels.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Point Jacobi (diagonal) preconditioner.
+// \ingroup solvers
+//
+// The JacobiPreconditioner class template represents the preconditioner \f$ M = D \f$, where
+// \a D is the diagonal of the system matrix. Its application \f$ z = D^{-1}*r \f$ is a single
+// vectorized (and for large vectors parallel) componentwise multiplication with the inverted
+// diagonal. The preconditioner can be used with all iterative solvers of \b Blaze:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::JacobiPreconditioner<double> M( A );
+   blaze::cg( A, b, x, M );
+   \endcode
+
+// In case the values of the system matrix change, the preconditioner can be updated via the
+// compute() function.
+*/
+template< typename Type >  // Data type of the preconditioner
+class JacobiPreconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Data type of the preconditioner.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline JacobiPreconditioner();
+
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\name Function call operator */
+   //@{
+   template< typename VT1, typename VT2 >
+   inline void operator()( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+
+   template< typename MT, bool SO >
+   void compute( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type,columnVector> inverse_;  //!< The inverted diagonal of the system matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for JacobiPreconditioner.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline JacobiPreconditioner<Type>::JacobiPreconditioner()
+   : inverse_()  // The inverted diagonal of the system matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the Jacobi preconditioner of the given matrix.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of zero diagonal element failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const Matrix<MT,SO>& A )
+   : inverse_()  // The inverted diagonal of the system matrix
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = D^{-1}*r \f$).
+//
+// \param r The input vector.
+// \param z The resulting preconditioned vector.
+// \return void
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// The preconditioned vector \a z is resized to the size of the preconditioner. It is allowed
+// to pass the same vector as \a r and \a z.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the input vector
+        , typename VT2 >   // Type of the preconditioned vector
+inline void JacobiPreconditioner<Type>::operator()( const DenseVector<VT1,columnVector>& r,
+                                                    DenseVector<VT2,columnVector>& z ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   preparePreconditioner( inverse_.size(), r, z );
+
+   ~z = inverse_ * (~r);
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioned system matrix.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t JacobiPreconditioner<Type>::size() const noexcept
+{
+   return inverse_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Jacobi preconditioner of the given matrix.
+//
+// \param A The square system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of zero diagonal element failed.
+//
+// This function computes the inverted diagonal of the given dense or sparse matrix. In case
+// the given matrix is not a square matrix, a \a std::invalid_argument exception is thrown. In
+// case the matrix contains a zero diagonal element, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void JacobiPreconditioner<Type>::compute( const Matrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_<MT> B( ~A );  // Evaluation of the system matrix
+
+   const size_t n( B.rows() );
+
+   inverse_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Type diagonal( B(i,i) );
+
+      if( isDefault( diagonal ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of zero diagonal element failed" );
+      }
+
+      inverse_[i] = Type(1) / diagonal;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1056 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/KrylovKernels.h
+//  \brief Header file for the fused vector kernels of the Krylov subspace solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KRYLOVKERNELS_H_
+#define _BLAZE_MATH_SOLVERS_KRYLOVKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS KRYLOVPACKET
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the vectorized Krylov kernels.
+// \ingroup solvers
+//
+// This type trait evaluates to \a true in case the fused vector kernels of the Krylov solvers
+// can be vectorized for the given data type. This requires padded dense vectors (since the
+// kernels process the padding elements of the internal work vectors) and a real data type for
+// which SIMD addition, subtraction, and multiplication are available.
+*/
+template< typename Type >  // Data type of the vector elements
+struct UseVectorizedKrylovKernel
+   : public BoolConstant< usePadding &&
+                          IsVectorizable<Type>::value &&
+                          !IsComplex<Type>::value &&
+                          HasSIMDAdd<Type,Type>::value &&
+                          HasSIMDSub<Type,Type>::value &&
+                          HasSIMDMult<Type,Type>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packet of vector elements processed by a single step of a fused Krylov kernel.
+// \ingroup solvers
+//
+// The KrylovPacket class template abstracts the SIMD operations of the fused Krylov kernels.
+// In case the kernels can be vectorized, a packet consists of a single SIMD vector, else it
+// consists of a single (possibly complex) vector element.
+*/
+template< typename Type  // Data type of the vector elements
+        , bool = UseVectorizedKrylovKernel<Type>::value >
+struct KrylovPacket
+{
+   //**Type definitions****************************************************************************
+   using ValueType = Type;  //!< Type of a single packet.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t { size = 1UL };  //!< The number of vector elements per packet.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE ValueType load ( const Type* p ) noexcept { return *p; }
+   static BLAZE_ALWAYS_INLINE void      store( Type* p, const ValueType& v ) noexcept { *p = v; }
+   static BLAZE_ALWAYS_INLINE ValueType set  ( Type v ) noexcept { return v; }
+   static BLAZE_ALWAYS_INLINE Type      sum  ( const ValueType& v ) noexcept { return v; }
+
+   static BLAZE_ALWAYS_INLINE ValueType dot( const ValueType& a, const ValueType& b ) noexcept {
+      return conj( a ) * b;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the KrylovPacket class template for vectorizable data types.
+// \ingroup solvers
+*/
+template< typename Type >  // Data type of the vector elements
+struct KrylovPacket<Type,true>
+{
+   //**Type definitions****************************************************************************
+   using ValueType = SIMDTrait_<Type>;  //!< Type of a single packet.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t { size = SIMDTrait<Type>::size };  //!< The number of vector elements per packet.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static BLAZE_ALWAYS_INLINE ValueType load ( const Type* p ) noexcept { return loada( p ); }
+   static BLAZE_ALWAYS_INLINE void      store( Type* p, const ValueType& v ) noexcept { storea( p, v ); }
+   static BLAZE_ALWAYS_INLINE ValueType set  ( Type v ) noexcept { return blaze::set( v ); }
+   static BLAZE_ALWAYS_INLINE Type      sum  ( const ValueType& v ) noexcept { return blaze::sum( v ); }
+
+   static BLAZE_ALWAYS_INLINE ValueType dot( const ValueType& a, const ValueType& b ) noexcept {
+      return a * b;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL DRIVERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The number of vector elements processed by a single block of a parallel Krylov kernel.
+// \ingroup solvers
+*/
+constexpr size_t krylovBlockSize = 8192UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the end of the index range processed by the fused Krylov kernels.
+// \ingroup solvers
+//
+// \param n The size of the vectors.
+// \return The size of the vectors rounded up to the next multiple of the packet size.
+*/
+template< typename Type >  // Data type of the vector elements
+inline size_t krylovEnd( size_t n ) noexcept
+{
+   return ( KrylovPacket<Type>::size > 1UL ? nextMultiple<size_t>( n, KrylovPacket<Type>::size ) : n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given fused kernel to the index range \f$ [0..n) \f$.
+// \ingroup solvers
+//
+// \param n The size of the vectors.
+// \param kernel The fused kernel to be applied to each block of the index range.
+// \return void
+//
+// This function applies the given kernel to the index range \f$ [0..n) \f$ of the Krylov work
+// vectors. In case \a n is larger or equal to the SMP_DVECASSIGN_THRESHOLD, the range is split
+// into blocks that are processed in parallel by means of the active SMP backend.
+*/
+template< typename Type      // Data type of the vector elements
+        , typename Kernel >  // Type of the fused kernel
+void krylovFor( size_t n, const Kernel& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t end( krylovEnd<Type>( n ) );
+
+   if( n < SMP_DVECASSIGN_THRESHOLD || end <= krylovBlockSize ) {
+      kernel( 0UL, end );
+      return;
+   }
+
+   const size_t blocks( ( end + krylovBlockSize - 1UL ) / krylovBlockSize );
+
+   smpFor( blocks, [&]( size_t block ) {
+      kernel( block*krylovBlockSize, min( end, (block+1UL)*krylovBlockSize ) );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given fused reduction kernel to the index range \f$ [0..n) \f$.
+// \ingroup solvers
+//
+// \param n The size of the vectors.
+// \param sums The resulting \a K reductions.
+// \param kernel The fused reduction kernel to be applied to each block of the index range.
+// \return void
+//
+// This function applies the given kernel to the index range \f$ [0..n) \f$ of the Krylov work
+// vectors. The kernel adds its \a K partial reductions to the given array of accumulators. In
+// case \a n is larger or equal to the SMP_DVECASSIGN_THRESHOLD, the range is split into blocks
+// that are processed in parallel by means of the active SMP backend. The partial reductions
+// of the blocks are combined in a fixed order, i.e. the result does not depend on the number
+// of threads.
+*/
+template< typename Type      // Data type of the vector elements
+        , size_t K           // Number of reductions
+        , typename Kernel >  // Type of the fused reduction kernel
+void krylovReduce( size_t n, Type (&sums)[K], const Kernel& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t end( krylovEnd<Type>( n ) );
+
+   for( size_t k=0UL; k<K; ++k ) {
+      sums[k] = Type();
+   }
+
+   if( n < SMP_DVECASSIGN_THRESHOLD || end <= krylovBlockSize ) {
+      kernel( 0UL, end, sums );
+      return;
+   }
+
+   const size_t blocks( ( end + krylovBlockSize - 1UL ) / krylovBlockSize );
+   std::vector<Type> partial( blocks*K, Type() );
+
+   smpFor( blocks, [&]( size_t block ) {
+      kernel( block*krylovBlockSize, min( end, (block+1UL)*krylovBlockSize ), &partial[block*K] );
+   } );
+
+   for( size_t block=0UL; block<blocks; ++block ) {
+      for( size_t k=0UL; k<K; ++k ) {
+         sums[k] += partial[block*K+k];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATOR APPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the selection of the fused sparse matrix/vector multiplication.
+// \ingroup solvers
+//
+// This type trait evaluates to \a true in case the given operator is a row-major sparse matrix
+// that provides direct access to its rows (i.e. a CompressedMatrix or an adaptor/view of it).
+*/
+template< typename OP >  // Type of the operator
+struct UseFusedKrylovSpMV
+   : public And< IsSparseMatrix<OP>, IsRowMajorMatrix<OP>, Not< IsExpression<OP> > >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given matrix to the vector \a x (\f$ y = A \cdot x \f$).
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param x The input vector.
+// \param y The resulting vector.
+// \return void
+*/
+template< typename OP      // Type of the operator
+        , typename Type >  // Data type of the vector elements
+inline EnableIf_< IsMatrix<OP> >
+   applyOperator( const OP& A, const DynamicVector<Type,columnVector>& x,
+                  DynamicVector<Type,columnVector>& y )
+{
+   y = A * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given matrix-free operator to the vector \a x (\f$ y = A(x) \f$).
+// \ingroup solvers
+//
+// \param op The matrix-free operator.
+// \param x The input vector.
+// \param y The resulting vector.
+// \return void
+// \exception std::invalid_argument Invalid size of the resulting vector.
+*/
+template< typename OP      // Type of the operator
+        , typename Type >  // Data type of the vector elements
+inline DisableIf_< IsMatrix<OP> >
+   applyOperator( const OP& op, const DynamicVector<Type,columnVector>& x,
+                  DynamicVector<Type,columnVector>& y )
+{
+   op( x, y );
+
+   if( y.size() != x.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid result of matrix-free operator" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the dimensions of the given system matrix.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param n The size of the right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid system matrix.
+*/
+template< typename OP >  // Type of the operator
+inline EnableIf_< IsMatrix<OP> > checkKrylovOperator( const OP& A, size_t n )
+{
+   if( A.rows() != n || A.columns() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid system matrix provided" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the dimensions of the given matrix-free operator.
+// \ingroup solvers
+//
+// \return void
+//
+// The dimensions of matrix-free operators cannot be checked in advance. Instead, the size of
+// the result of each operator application is checked.
+*/
+template< typename OP >  // Type of the operator
+inline DisableIf_< IsMatrix<OP> > checkKrylovOperator( const OP& /*op*/, size_t /*n*/ ) noexcept
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given preconditioner to the vector \a r (\f$ z = M^{-1} \cdot r \f$).
+// \ingroup solvers
+//
+// \param M The preconditioner.
+// \param r The input vector.
+// \param z The preconditioned vector.
+// \return void
+// \exception std::invalid_argument Invalid size of the preconditioned vector.
+*/
+template< typename PC      // Type of the preconditioner
+        , typename Type >  // Data type of the vector elements
+inline void applyPreconditioner( const PC& M, const DynamicVector<Type,columnVector>& r,
+                                 DynamicVector<Type,columnVector>& z )
+{
+   M( r, z );
+
+   if( z.size() != r.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid result of preconditioner" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Placeholder for the identity preconditioner of the Krylov solvers.
+// \ingroup solvers
+*/
+struct KrylovIdentity
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the preconditioned vector \f$ z = M^{-1} \cdot r \f$.
+// \ingroup solvers
+//
+// \param M The preconditioner.
+// \param r The input vector.
+// \param z The work vector for the preconditioned vector.
+// \return Reference to the preconditioned vector.
+*/
+template< typename PC      // Type of the preconditioner
+        , typename Type >  // Data type of the vector elements
+inline const DynamicVector<Type,columnVector>&
+   preconditioned( const PC& M, const DynamicVector<Type,columnVector>& r,
+                   DynamicVector<Type,columnVector>& z )
+{
+   applyPreconditioner( M, r, z );
+   return z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the preconditioned vector in case no preconditioner is used.
+// \ingroup solvers
+//
+// \param r The input vector.
+// \return Reference to the unmodified input vector.
+//
+// In case no preconditioner is used, the input vector is returned without copying it to the
+// work vector for the preconditioned vector.
+*/
+template< typename Type >  // Data type of the vector elements
+inline const DynamicVector<Type,columnVector>&
+   preconditioned( const KrylovIdentity& /*M*/, const DynamicVector<Type,columnVector>& r,
+                   DynamicVector<Type,columnVector>& /*z*/ ) noexcept
+{
+   return r;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner product \f$ a^H \cdot b \f$ of two Krylov work vectors.
+// \ingroup solvers
+//
+// \param a The left-hand side vector.
+// \param b The right-hand side vector.
+// \return The inner product \f$ a^H \cdot b \f$.
+*/
+template< typename Type >  // Data type of the vector elements
+Type krylovDot( const DynamicVector<Type,columnVector>& a, const DynamicVector<Type,columnVector>& b )
+{
+   using PT = KrylovPacket<Type>;
+
+   const Type* ap( a.data() );
+   const Type* bp( b.data() );
+
+   Type sums[1];
+   krylovReduce( a.size(), sums, [ap,bp]( size_t begin, size_t end, Type* s )
+   {
+      typename PT::ValueType acc( PT::set( Type() ) );
+      for( size_t i=begin; i<end; i+=PT::size ) {
+         acc = acc + PT::dot( PT::load( ap+i ), PT::load( bp+i ) );
+      }
+      s[0] += PT::sum( acc );
+   } );
+
+   return sums[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Euclidean norm of a vector from its squared norm \f$ a^H \cdot a \f$.
+// \ingroup solvers
+//
+// \param aa The squared norm of the vector.
+// \return The Euclidean norm of the vector.
+*/
+template< typename Type >  // Data type of the vector elements
+inline double krylovSqrtNorm( const Type& aa )
+{
+   return std::sqrt( static_cast<double>( real( aa ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Euclidean norm of a Krylov work vector.
+// \ingroup solvers
+//
+// \param a The given vector.
+// \return The Euclidean norm \f$ \|a\|_2 \f$.
+*/
+template< typename Type >  // Data type of the vector elements
+inline double krylovNorm( const DynamicVector<Type,columnVector>& a )
+{
+   return krylovSqrtNorm( krylovDot( a, a ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the two inner products \f$ w^H \cdot a \f$ and \f$ w^H \cdot b \f$ in a single pass.
+// \ingroup solvers
+//
+// \param w The common left-hand side vector.
+// \param a The first right-hand side vector.
+// \param b The second right-hand side vector.
+// \param wa The resulting inner product \f$ w^H \cdot a \f$.
+// \param wb The resulting inner product \f$ w^H \cdot b \f$.
+// \return void
+*/
+template< typename Type >  // Data type of the vector elements
+void krylovDot2( const DynamicVector<Type,columnVector>& w, const DynamicVector<Type,columnVector>& a,
+                 const DynamicVector<Type,columnVector>& b, Type& wa, Type& wb )
+{
+   using PT = KrylovPacket<Type>;
+
+   const Type* wp( w.data() );
+   const Type* ap( a.data() );
+   const Type* bp( b.data() );
+
+   Type sums[2];
+   krylovReduce( w.size(), sums, [wp,ap,bp]( size_t begin, size_t end, Type* s )
+   {
+      typename PT::ValueType acc1( PT::set( Type() ) );
+      typename PT::ValueType acc2( PT::set( Type() ) );
+      for( size_t i=begin; i<end; i+=PT::size ) {
+         const typename PT::ValueType wi( PT::load( wp+i ) );
+         acc1 = acc1 + PT::dot( wi, PT::load( ap+i ) );
+         acc2 = acc2 + PT::dot( wi, PT::load( bp+i ) );
+      }
+      s[0] += PT::sum( acc1 );
+      s[1] += PT::sum( acc2 );
+   } );
+
+   wa = sums[0];
+   wb = sums[1];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ y = A \cdot x \f$ and the inner product \f$ w^H \cdot y \f$.
+// \ingroup solvers
+//
+// \param A The system operator.
+// \param x The input vector.
+// \param y The resulting vector.
+// \param w The left-hand side vector of the inner product.
+// \return The inner product \f$ w^H \cdot y \f$.
+//
+// This function is the default implementation for dense matrices and matrix-free operators,
+// which computes the operator application and the inner product in two separate passes.
+*/
+template< typename OP      // Type of the operator
+        , typename Type >  // Data type of the vector elements
+inline DisableIf_< UseFusedKrylovSpMV<OP>, Type >
+   applyDot( const OP& A, const DynamicVector<Type,columnVector>& x,
+             DynamicVector<Type,columnVector>& y, const DynamicVector<Type,columnVector>& w )
+{
+   applyOperator( A, x, y );
+   return krylovDot( w, y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ y = A \cdot x \f$ and the inner product \f$ w^H \cdot y \f$ in a single pass.
+// \ingroup solvers
+//
+// \param A The row-major sparse system matrix.
+// \param x The input vector.
+// \param y The resulting vector.
+// \param w The left-hand side vector of the inner product.
+// \return The inner product \f$ w^H \cdot y \f$.
+//
+// This function computes the sparse matrix/vector multiplication row by row and accumulates
+// the inner product while the resulting elements are still in registers.
+*/
+template< typename OP      // Type of the operator
+        , typename Type >  // Data type of the vector elements
+inline EnableIf_< UseFusedKrylovSpMV<OP>, Type >
+   applyDot( const OP& A, const DynamicVector<Type,columnVector>& x,
+             DynamicVector<Type,columnVector>& y, const DynamicVector<Type,columnVector>& w )
+{
+   const size_t n( x.size() );
+
+   const Type* xp( x.data() );
+   const Type* wp( w.data() );
+   Type* yp( y.data() );
+
+   Type sums[1];
+   krylovReduce( n, sums, [&A,n,xp,wp,yp]( size_t begin, size_t end, Type* s )
+   {
+      Type acc{};
+      for( size_t i=begin; i<min( end, n ); ++i ) {
+         Type tmp{};
+         const auto rend( A.end(i) );
+         for( auto element=A.begin(i); element!=rend; ++element ) {
+            tmp += element->value() * xp[element->index()];
+         }
+         yp[i] = tmp;
+         acc += conj( wp[i] ) * tmp;
+      }
+      s[0] += acc;
+   } );
+
+   return sums[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ y = A \cdot x \f$ and the inner products \f$ y^H \cdot u \f$ and
+//        \f$ y^H \cdot y \f$.
+// \ingroup solvers
+//
+// \param A The system operator.
+// \param x The input vector.
+// \param y The resulting vector.
+// \param u The right-hand side vector of the first inner product.
+// \param yu The resulting inner product \f$ y^H \cdot u \f$.
+// \param yy The resulting inner product \f$ y^H \cdot y \f$.
+// \return void
+//
+// This function is the default implementation for dense matrices and matrix-free operators,
+// which computes the operator application and the inner products in two separate passes.
+*/
+template< typename OP      // Type of the operator
+        , typename Type >  // Data type of the vector elements
+inline DisableIf_< UseFusedKrylovSpMV<OP> >
+   applyDot2( const OP& A, const DynamicVector<Type,columnVector>& x,
+              DynamicVector<Type,columnVector>& y, const DynamicVector<Type,columnVector>& u,
+              Type& yu, Type& yy )
+{
+   applyOperator( A, x, y );
+   krylovDot2( y, u, y, yu, yy );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ y = A \cdot x \f$ and the inner products \f$ y^H \cdot u \f$ and
+//        \f$ y^H \cdot y \f$ in a single pass.
+// \ingroup solvers
+//
+// \param A The row-major sparse system matrix.
+// \param x The input vector.
+// \param y The resulting vector.
+// \param u The right-hand side vector of the first inner product.
+// \param yu The resulting inner product \f$ y^H \cdot u \f$.
+// \param yy The resulting inner product \f$ y^H \cdot y \f$.
+// \return void
+*/
+template< typename OP      // Type of the operator
+        , typename Type >  // Data type of the vector elements
+inline EnableIf_< UseFusedKrylovSpMV<OP> >
+   applyDot2( const OP& A, const DynamicVector<Type,columnVector>& x,
+              DynamicVector<Type,columnVector>& y, const DynamicVector<Type,columnVector>& u,
+              Type& yu, Type& yy )
+{
+   const size_t n( x.size() );
+
+   const Type* xp( x.data() );
+   const Type* up( u.data() );
+   Type* yp( y.data() );
+
+   Type sums[2];
+   krylovReduce( n, sums, [&A,n,xp,up,yp]( size_t begin, size_t end, Type* s )
+   {
+      Type acc1{}, acc2{};
+      for( size_t i=begin; i<min( end, n ); ++i ) {
+         Type tmp{};
+         const auto rend( A.end(i) );
+         for( auto element=A.begin(i); element!=rend; ++element ) {
+            tmp += element->value() * xp[element->index()];
+         }
+         yp[i] = tmp;
+         acc1 += conj( tmp ) * up[i];
+         acc2 += conj( tmp ) * tmp;
+      }
+      s[0] += acc1;
+      s[1] += acc2;
+   } );
+
+   yu = sums[0];
+   yy = sums[1];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused CG update \f$ x += \alpha p; r -= \alpha q \f$, returning \f$ r^H \cdot r \f$.
+// \ingroup solvers
+//
+// \param alpha The step length.
+// \param p The search direction.
+// \param q The operator applied to the search direction.
+// \param x The approximate solution to be updated.
+// \param r The residual to be updated.
+// \return The squared norm of the updated residual.
+*/
+template< typename Type >  // Data type of the vector elements
+Type cgUpdate( Type alpha, const DynamicVector<Type,columnVector>& p,
+               const DynamicVector<Type,columnVector>& q, DynamicVector<Type,columnVector>& x,
+               DynamicVector<Type,columnVector>& r )
+{
+   using PT = KrylovPacket<Type>;
+
+   const Type* pp( p.data() );
+   const Type* qp( q.data() );
+   Type* xp( x.data() );
+   Type* rp( r.data() );
+
+   Type sums[1];
+   krylovReduce( x.size(), sums, [alpha,pp,qp,xp,rp]( size_t begin, size_t end, Type* s )
+   {
+      const typename PT::ValueType a( PT::set( alpha ) );
+      typename PT::ValueType acc( PT::set( Type() ) );
+      for( size_t i=begin; i<end; i+=PT::size ) {
+         const typename PT::ValueType ri( PT::load( rp+i ) - a * PT::load( qp+i ) );
+         PT::store( xp+i, PT::load( xp+i ) + a * PT::load( pp+i ) );
+         PT::store( rp+i, ri );
+         acc = acc + PT::dot( ri, ri );
+      }
+      s[0] += PT::sum( acc );
+   } );
+
+   return sums[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused search direction update \f$ p = z + \beta p \f$.
+// \ingroup solvers
+//
+// \param z The (preconditioned) residual.
+// \param beta The scaling factor of the previous search direction.
+// \param p The search direction to be updated.
+// \return void
+*/
+template< typename Type >  // Data type of the vector elements
+void cgDirection( const DynamicVector<Type,columnVector>& z, Type beta,
+                  DynamicVector<Type,columnVector>& p )
+{
+   using PT = KrylovPacket<Type>;
+
+   const Type* zp( z.data() );
+   Type* pp( p.data() );
+
+   krylovFor<Type>( p.size(), [beta,zp,pp]( size_t begin, size_t end )
+   {
+      const typename PT::ValueType b( PT::set( beta ) );
+      for( size_t i=begin; i<end; i+=PT::size ) {
+         PT::store( pp+i, PT::load( zp+i ) + b * PT::load( pp+i ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused BiCGStab search direction update \f$ p = r + \beta (p - \omega v) \f$.
+// \ingroup solvers
+//
+// \param r The residual.
+// \param beta The scaling factor of the previous search direction.
+// \param omega The stabilization parameter of the previous iteration.
+// \param v The operator applied to the previous search direction.
+// \param p The search direction to be updated.
+// \return void
+*/
+template< typename Type >  // Data type of the vector elements
+void bicgstabDirection( const DynamicVector<Type,columnVector>& r, Type beta, Type omega,
+                        const DynamicVector<Type,columnVector>& v, DynamicVector<Type,columnVector>& p )
+{
+   using PT = KrylovPacket<Type>;
+
+   const Type* rp( r.data() );
+   const Type* vp( v.data() );
+   Type* pp( p.data() );
+
+   krylovFor<Type>( p.size(), [beta,omega,rp,vp,pp]( size_t begin, size_t end )
+   {
+      const typename PT::ValueType b( PT::set( beta ) );
+      const typename PT::ValueType w( PT::set( omega ) );
+      for( size_t i=begin; i<end; i+=PT::size ) {
+         PT::store( pp+i, PT::load( rp+i ) + b * ( PT::load( pp+i ) - w * PT::load( vp+i ) ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused BiCGStab intermediate residual \f$ s = r - \alpha v \f$, returning \f$ s^H \cdot s \f$.
+// \ingroup solvers
+//
+// \param r The residual.
+// \param alpha The step length.
+// \param v The operator applied to the search direction.
+// \param s The resulting intermediate residual.
+// \return The squared norm of the intermediate residual.
+*/
+template< typename Type >  // Data type of the vector elements
+Type bicgstabResidual( const DynamicVector<Type,columnVector>& r, Type alpha,
+                       const DynamicVector<Type,columnVector>& v, DynamicVector<Type,columnVector>& s )
+{
+   using PT = KrylovPacket<Type>;
+
+   const Type* rp( r.data() );
+   const Type* vp( v.data() );
+   Type* sp( s.data() );
+
+   Type sums[1];
+   krylovReduce( s.size(), sums, [alpha,rp,vp,sp]( size_t begin, size_t end, Type* acc )
+   {
+      const typename PT::ValueType a( PT::set( alpha ) );
+      typename PT::ValueType ss( PT::set( Type() ) );
+      for( size_t i=begin; i<end; i+=PT::size ) {
+         const typename PT::ValueType si( PT::load( rp+i ) - a * PT::load( vp+i ) );
+         PT::store( sp+i, si );
+         ss = ss + PT::dot( si, si );
+      }
+      acc[0] += PT::sum( ss );
+   } );
+
+   return sums[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused BiCGStab update \f$ x += \alpha \hat{p} + \omega \hat{s}; r = s - \omega t \f$.
+// \ingroup solvers
+//
+// \param alpha The step length.
+// \param p The (preconditioned) search direction.
+// \param omega The stabilization parameter.
+// \param sh The (preconditioned) intermediate residual.
+// \param s The intermediate residual.
+// \param t The operator applied to the (preconditioned) intermediate residual.
+// \param rh The shadow residual.
+// \param x The approximate solution to be updated.
+// \param r The resulting residual.
+// \param rr The resulting squared norm \f$ r^H \cdot r \f$ of the residual.
+// \param rhr The resulting inner product \f$ \hat{r}^H \cdot r \f$.
+// \return void
+*/
+template< typename Type >  // Data type of the vector elements
+void bicgstabUpdate( Type alpha, const DynamicVector<Type,columnVector>& p, Type omega,
+                     const DynamicVector<Type,columnVector>& sh, const DynamicVector<Type,columnVector>& s,
+                     const DynamicVector<Type,columnVector>& t, const DynamicVector<Type,columnVector>& rh,
+                     DynamicVector<Type,columnVector>& x, DynamicVector<Type,columnVector>& r,
+                     Type& rr, Type& rhr )
+{
+   using PT = KrylovPacket<Type>;
+
+   const Type* pp ( p.data()  );
+   const Type* shp( sh.data() );
+   const Type* sp ( s.data()  );
+   const Type* tp ( t.data()  );
+   const Type* rhp( rh.data() );
+   Type* xp( x.data() );
+   Type* rp( r.data() );
+
+   Type sums[2];
+   krylovReduce( x.size(), sums, [=]( size_t begin, size_t end, Type* acc )
+   {
+      const typename PT::ValueType a( PT::set( alpha ) );
+      const typename PT::ValueType w( PT::set( omega ) );
+      typename PT::ValueType acc1( PT::set( Type() ) );
+      typename PT::ValueType acc2( PT::set( Type() ) );
+      for( size_t i=begin; i<end; i+=PT::size ) {
+         PT::store( xp+i, PT::load( xp+i ) + a * PT::load( pp+i ) + w * PT::load( shp+i ) );
+         const typename PT::ValueType ri( PT::load( sp+i ) - w * PT::load( tp+i ) );
+         PT::store( rp+i, ri );
+         acc1 = acc1 + PT::dot( ri, ri );
+         acc2 = acc2 + PT::dot( PT::load( rhp+i ), ri );
+      }
+      acc[0] += PT::sum( acc1 );
+      acc[1] += PT::sum( acc2 );
+   } );
+
+   rr  = sums[0];
+   rhr = sums[1];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused vector update \f$ x += \alpha p \f$.
+// \ingroup solvers
+//
+// \param alpha The scaling factor.
+// \param p The update direction.
+// \param x The vector to be updated.
+// \return void
+*/
+template< typename Type >  // Data type of the vector elements
+void krylovAxpy( Type alpha, const DynamicVector<Type,columnVector>& p, DynamicVector<Type,columnVector>& x )
+{
+   using PT = KrylovPacket<Type>;
+
+   const Type* pp( p.data() );
+   Type* xp( x.data() );
+
+   krylovFor<Type>( x.size(), [alpha,pp,xp]( size_t begin, size_t end )
+   {
+      const typename PT::ValueType a( PT::set( alpha ) );
+      for( size_t i=begin; i<end; i+=PT::size ) {
+         PT::store( xp+i, PT::load( xp+i ) + a * PT::load( pp+i ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the internal work vectors and residual of a Krylov solver.
+// \ingroup solvers
+//
+// \param A The system operator.
+// \param b The right-hand side vector.
+// \param x The initial guess.
+// \param xs The internal copy of the approximate solution.
+// \param r The resulting initial residual \f$ r = b - A \cdot x \f$.
+// \param tmp An auxiliary work vector.
+// \return The Euclidean norm of the right-hand side vector.
+// \exception std::invalid_argument Invalid system size.
+*/
+template< typename OP      // Type of the operator
+        , typename VT1     // Type of the right-hand side vector
+        , typename VT2     // Type of the initial guess
+        , typename Type >  // Data type of the vector elements
+double initializeKrylov( const OP& A, const DenseVector<VT1,columnVector>& b,
+                         const DenseVector<VT2,columnVector>& x, DynamicVector<Type,columnVector>& xs,
+                         DynamicVector<Type,columnVector>& r, DynamicVector<Type,columnVector>& tmp )
+{
+   const size_t n( (~b).size() );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector sizes" );
+   }
+
+   checkKrylovOperator( A, n );
+
+   xs = ~x;
+   r  = ~b;
+   tmp.resize( n, false );
+
+   const double bnorm( krylovNorm( r ) );
+
+   if( bnorm != 0.0 ) {
+      applyOperator( A, xs, tmp );
+      r -= tmp;
+   }
+
+   return bnorm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,318 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/KrylovSchurKernels.h
+//  \brief Kernels of the thick-restart Krylov-Schur eigenvalue solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_KRYLOVSCHURKERNELS_H_
+#define _BLAZE_MATH_SOLVERS_KRYLOVSCHURKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/KrylovKernels.h>
+#include <blaze/math/SpectrumFlag.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KRYLOV-SCHUR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the dimension of the Krylov subspace of the Krylov-Schur eigenvalue solvers.
+// \ingroup solvers
+//
+// \param n The size of the operator.
+// \param nev The number of requested eigenvalues.
+// \param restart The requested maximum dimension of the Krylov subspace.
+// \return The dimension of the Krylov subspace.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+//
+// The dimension of the Krylov subspace is at least twice the number of requested eigenvalues
+// in order to guarantee a reasonable number of new basis vectors per restart cycle.
+*/
+inline size_t krylovSchurDimension( size_t n, size_t nev, size_t restart )
+{
+   if( nev == 0UL || nev > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of eigenvalues requested" );
+   }
+
+   return min( max( restart, 2UL*nev ), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Orthogonalizes the vector \a w against the first \a j columns of the Krylov basis.
+// \ingroup solvers
+//
+// \param V The Krylov basis.
+// \param j The number of basis vectors to orthogonalize against.
+// \param w The vector to be orthogonalized.
+// \param h The resulting orthogonalization coefficients (the first \a j elements).
+// \param g Work vector for the coefficients of the reorthogonalization.
+// \return The Euclidean norm of the orthogonalized vector.
+//
+// The orthogonalization is performed by means of classical Gram-Schmidt with reorthogonalization
+// (CGS2), i.e. by two pairs of matrix/vector multiplications with the Krylov basis.
+*/
+template< typename Type >  // Data type of the vector elements
+double krylovSchurOrthogonalize( const DynamicMatrix<Type,columnMajor>& V, size_t j,
+                                 DynamicVector<Type,columnVector>& w,
+                                 DynamicVector<Type,columnVector>& h,
+                                 DynamicVector<Type,columnVector>& g )
+{
+   const auto Vj( submatrix( V, 0UL, 0UL, V.rows(), j ) );
+   auto hj( subvector( h, 0UL, j ) );
+   auto gj( subvector( g, 0UL, j ) );
+
+   hj  = ctrans( Vj ) * w;
+   w  -= Vj * hj;
+   gj  = ctrans( Vj ) * w;
+   w  -= Vj * gj;
+   hj += gj;
+
+   return krylovNorm( w );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes the Krylov basis with the normalized start vector.
+// \ingroup solvers
+//
+// \param x0 The start vector.
+// \param V The Krylov basis.
+// \param v Work vector.
+// \return void
+// \exception std::invalid_argument Invalid start vector provided.
+*/
+template< typename VT      // Type of the start vector
+        , typename Type >  // Data type of the vector elements
+void krylovSchurStart( const DenseVector<VT,columnVector>& x0, DynamicMatrix<Type,columnMajor>& V,
+                       DynamicVector<Type,columnVector>& v )
+{
+   v = ~x0;
+
+   const double norm( krylovNorm( v ) );
+
+   if( norm == 0.0 ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid start vector provided" );
+   }
+
+   column( V, 0UL ) = v * ( Type( 1 ) / Type( norm ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Expands the Krylov decomposition \f$ A V_k = V_{k+1} H_k \f$ to the dimension \a m.
+// \ingroup solvers
+//
+// \param A The operator.
+// \param V The Krylov basis (\a n-by-(\a m+1)).
+// \param H The projected matrix ((\a m+1)-by-\a m).
+// \param k The current dimension of the Krylov decomposition.
+// \param m The target dimension of the Krylov decomposition.
+// \param v Work vector for the current basis vector.
+// \param w Work vector for the new basis vector.
+// \param h Work vector for the orthogonalization coefficients.
+// \param g Work vector for the coefficients of the reorthogonalization.
+// \return void
+//
+// This function performs the Arnoldi process for the columns \a k to \a m-1 of the projected
+// matrix \a H, which is expected to be zero in these columns. The operator is applied via
+// applyOperator(), i.e. sparse matrices are multiplied in parallel, and the new basis vector
+// is orthogonalized against the complete basis via CGS2. In case the Krylov subspace becomes
+// invariant, the process is continued with a random vector that is orthogonal to the current
+// basis and the according subdiagonal element of \a H is set to zero.
+*/
+template< typename OP      // Type of the operator
+        , typename Type >  // Data type of the vector elements
+void krylovSchurExpand( const OP& A, DynamicMatrix<Type,columnMajor>& V,
+                        DynamicMatrix<Type,columnMajor>& H, size_t k, size_t m,
+                        DynamicVector<Type,columnVector>& v, DynamicVector<Type,columnVector>& w,
+                        DynamicVector<Type,columnVector>& h, DynamicVector<Type,columnVector>& g )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using BT = UnderlyingElement_<Type>;
+
+   const size_t n( V.rows() );
+   const double eps( std::numeric_limits<BT>::epsilon() );
+
+   for( size_t j=k; j<m; ++j )
+   {
+      v = column( V, j );
+      applyOperator( A, v, w );
+
+      const double beta( krylovSchurOrthogonalize( V, j+1UL, w, h, g ) );
+
+      double hh( 0.0 );
+      for( size_t i=0UL; i<=j; ++i ) {
+         H(i,j) = h[i];
+         hh += static_cast<double>( real( conj( h[i] ) * h[i] ) );
+      }
+
+      if( j+1UL == n ) {
+         H(n,j) = Type();
+         reset( column( V, n ) );
+      }
+      else if( beta > eps * std::sqrt( hh + beta*beta ) ) {
+         H(j+1UL,j) = Type( beta );
+         column( V, j+1UL ) = w * ( Type( 1 ) / Type( beta ) );
+      }
+      else {
+         H(j+1UL,j) = Type();
+
+         double norm( 0.0 );
+         while( norm == 0.0 ) {
+            randomize( w );
+            norm = krylovSchurOrthogonalize( V, j+1UL, w, h, g );
+         }
+
+         column( V, j+1UL ) = w * ( Type( 1 ) / Type( norm ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sorts the given Ritz values according to the wanted part of the spectrum.
+// \ingroup solvers
+//
+// \param theta The Ritz values.
+// \param spectrum The wanted part of the spectrum.
+// \return The indices of the Ritz values, starting with the most wanted Ritz value.
+*/
+template< typename VT >  // Type of the vector of Ritz values
+std::vector<size_t> sortRitzValues( const VT& theta, SpectrumFlag spectrum )
+{
+   std::vector<size_t> order( theta.size() );
+
+   for( size_t i=0UL; i<order.size(); ++i ) {
+      order[i] = i;
+   }
+
+   if( spectrum == largestAlgebraic ) {
+      std::stable_sort( order.begin(), order.end(), [&theta]( size_t a, size_t b ) {
+         return real( theta[b] ) < real( theta[a] );
+      } );
+   }
+   else if( spectrum == smallestAlgebraic ) {
+      std::stable_sort( order.begin(), order.end(), [&theta]( size_t a, size_t b ) {
+         return real( theta[a] ) < real( theta[b] );
+      } );
+   }
+   else {
+      std::stable_sort( order.begin(), order.end(), [&theta]( size_t a, size_t b ) {
+         return abs( theta[b] ) < abs( theta[a] );
+      } );
+   }
+
+   return order;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compresses the Krylov basis to the subspace spanned by the columns of \a Q.
+// \ingroup solvers
+//
+// \param V The Krylov basis (\a n-by-(\a m+1)).
+// \param Q The orthonormal \a m-by-\a k basis of the kept subspace.
+// \param W Work matrix.
+// \return void
+//
+// This function replaces the first \a k columns of the Krylov basis by \f$ V_m Q \f$ and moves
+// the last basis vector \f$ v_{m+1} \f$ to column \a k. The multiplication is performed as a
+// single dense matrix/matrix multiplication.
+*/
+template< typename Type >  // Data type of the vector elements
+void krylovSchurRotate( DynamicMatrix<Type,columnMajor>& V, const DynamicMatrix<Type,columnMajor>& Q,
+                        DynamicMatrix<Type,columnMajor>& W )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( V.rows() );
+   const size_t m( Q.rows() );
+   const size_t k( Q.columns() );
+
+   W = submatrix( V, 0UL, 0UL, n, m ) * Q;
+   submatrix( V, 0UL, 0UL, n, k ) = W;
+   column( V, k ) = column( V, m );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
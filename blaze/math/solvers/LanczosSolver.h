@@ -0,0 +1,523 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LanczosSolver.h
+//  \brief Header file for the thick-restart Lanczos eigenvalue solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SOLVERS_LANCZOSSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_LANCZOSSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/lapack/heevd.h>
+#include <blaze/math/lapack/syevd.h>
+#include <blaze/math/lapack/Workspace.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/KrylovKernels.h>
+#include <blaze/math/solvers/KrylovSchurKernels.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/SpectrumFlag.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Thick-restart Lanczos solver for extremal eigenvalues of symmetric/Hermitian operators.
+// \ingroup solvers
+//
+// The LanczosSolver class template computes a few eigenvalues at one end of the spectrum and
+// the according eigenvectors of a large, sparse symmetric (Hermitian) \a n-by-\a n operator
+// \a A. The operator can be any dense or sparse matrix (including adaptors) or a matrix-free
+// operator, i.e. a callable object that computes \f$ y = A*x \f$ via the signature
+// \c void(const DynamicVector<Type>& x, DynamicVector<Type>& y). The wanted part of the
+// spectrum is selected via the blaze::SpectrumFlag (by default the largest eigenvalues):
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnMajor;
+
+   CompressedMatrix<double> A( 10000UL, 10000UL );  // The symmetric matrix
+   // ... Initialization
+
+   DynamicVector<double> w;                  // The resulting eigenvalues
+   DynamicMatrix<double,columnMajor> X;      // The resulting eigenvectors
+
+   blaze::LanczosSolver<double> solver( blaze::SolverControl( 100UL, 1E-10, 40UL ) );
+
+   // Computing the 5 smallest eigenvalues and eigenvectors of A
+   const blaze::SolverStatistics stats( solver.solve( A, w, X, 5UL, blaze::smallestAlgebraic ) );
+   \endcode
+
+// The eigenvalues are returned in the order of the SpectrumFlag (i.e. starting with the most
+// extremal eigenvalue) and the eigenvectors in the according columns of \a X. The solver builds
+// a Krylov subspace of the dimension given by the \c restart parameter of the SolverControl (at
+// least twice the number of requested eigenvalues). The basis is stored in a single column-major
+// matrix and is fully reorthogonalized by means of classical Gram-Schmidt with
+// reorthogonalization (CGS2), i.e. by dense matrix/vector multiplications, which avoids the
+// spurious eigenvalue copies of the plain Lanczos process. Sparse matrices are applied via the
+// parallel sparse matrix/vector multiplication. In case the wanted Ritz pairs did not yet
+// converge, the decomposition is restarted with the wanted Ritz vectors (thick restart in the
+// spirit of the Krylov-Schur method), which is performed via a single dense matrix/matrix
+// multiplication. The \c maxIterations parameter of the SolverControl limits the number of
+// restarts. An eigenpair \f$ (\theta,x) \f$ is considered converged as soon as the residual
+// \f$ \|A*x-\theta*x\|_2 \f$ drops below the tolerance relative to the largest Ritz value in
+// magnitude. The returned statistics contain the number of restarts and the largest relative
+// residual of the wanted eigenpairs.
+//
+// The Lanczos method is most efficient for well separated eigenvalues at the ends of the
+// spectrum. Eigenvalues in the interior of the spectrum or clustered eigenvalues near zero
+// should be computed via a shift-invert operator (see blaze::SpectrumFlag). Since the Krylov
+// subspace of a single start vector contains only a single direction of each eigenspace, the
+// multiplicity of multiple eigenvalues is in general not revealed.
+//
+// \note A single LanczosSolver instance must not be used concurrently by several threads.
+*/
+template< typename Type >  // Data type of the vector elements
+class LanczosSolver
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                              //!< Type of the vector elements.
+   using ValueType   = UnderlyingElement_<Type>;          //!< Type of the eigenvalues.
+   using VectorType  = DynamicVector<Type,columnVector>;  //!< Type of the internal work vectors.
+   using BasisType   = DynamicMatrix<Type,columnMajor>;   //!< Type of the Krylov basis.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LanczosSolver( const SolverControl& control = SolverControl() );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline SolverControl&       control() noexcept;
+   inline const SolverControl& control() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Solver functions****************************************************************************
+   /*!\name Solver functions */
+   //@{
+   template< typename MT1, bool SO1, typename VT, typename MT2, bool SO2 >
+   inline SolverStatistics solve( const Matrix<MT1,SO1>& A, DenseVector<VT,columnVector>& w,
+                                  DenseMatrix<MT2,SO2>& X, size_t nev,
+                                  SpectrumFlag spectrum = largestAlgebraic );
+
+   template< typename OP, typename VT1, typename VT2, typename MT, bool SO >
+   SolverStatistics solve( const OP& A, const DenseVector<VT1,columnVector>& x0,
+                           DenseVector<VT2,columnVector>& w, DenseMatrix<MT,SO>& X,
+                           size_t nev, SpectrumFlag spectrum = largestAlgebraic );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SolverControl            control_;  //!< The termination criteria of the solver.
+   VectorType               x_;        //!< The random start vector.
+   VectorType               v_;        //!< The current basis vector.
+   VectorType               w_;        //!< The new basis vector.
+   VectorType               h_;        //!< The orthogonalization coefficients.
+   VectorType               g_;        //!< The coefficients of the reorthogonalization.
+   BasisType                V_;        //!< The Krylov basis.
+   BasisType                H_;        //!< The projected matrix.
+   BasisType                T_;        //!< The eigenvectors of the projected matrix.
+   BasisType                Q_;        //!< The kept eigenvectors of the projected matrix.
+   BasisType                W_;        //!< The compressed Krylov basis.
+   DynamicVector<ValueType> theta_;    //!< The Ritz values.
+   LAPACKWorkspace          ws_;       //!< The workspace of the projected eigenvalue problem.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for LanczosSolver.
+//
+// \param control The termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline LanczosSolver<Type>::LanczosSolver( const SolverControl& control )
+   : control_( control )  // The termination criteria of the solver
+   , x_      ()           // The random start vector
+   , v_      ()           // The current basis vector
+   , w_      ()           // The new basis vector
+   , h_      ()           // The orthogonalization coefficients
+   , g_      ()           // The coefficients of the reorthogonalization
+   , V_      ()           // The Krylov basis
+   , H_      ()           // The projected matrix
+   , T_      ()           // The eigenvectors of the projected matrix
+   , Q_      ()           // The kept eigenvectors of the projected matrix
+   , W_      ()           // The compressed Krylov basis
+   , theta_  ()           // The Ritz values
+   , ws_     ()           // The workspace of the projected eigenvalue problem
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline SolverControl& LanczosSolver<Type>::control() noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the termination criteria of the solver.
+//
+// \return Reference to the termination criteria of the solver.
+*/
+template< typename Type >  // Data type of the vector elements
+inline const SolverControl& LanczosSolver<Type>::control() const noexcept
+{
+   return control_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the eigenvalues and eigenvectors of the real symmetric projected matrix.
+// \ingroup solvers
+//
+// \param T The projected matrix and the resulting eigenvectors.
+// \param theta The resulting eigenvalues in ascending order.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+*/
+template< typename MT    // Type of the projected matrix
+        , typename VT >  // Type of the vector of eigenvalues
+inline EnableIf_< IsBuiltin< ElementType_<MT> > >
+   lanczosEigen( MT& T, VT& theta, LAPACKWorkspace& ws )
+{
+   syevd( T, theta, 'V', 'L', ws );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the eigenvalues and eigenvectors of the complex Hermitian projected matrix.
+// \ingroup solvers
+//
+// \param T The projected matrix and the resulting eigenvectors.
+// \param theta The resulting eigenvalues in ascending order.
+// \param ws The workspace for the auxiliary memory of the LAPACK function.
+// \return void
+*/
+template< typename MT    // Type of the projected matrix
+        , typename VT >  // Type of the vector of eigenvalues
+inline EnableIf_< IsComplex< ElementType_<MT> > >
+   lanczosEigen( MT& T, VT& theta, LAPACKWorkspace& ws )
+{
+   heevd( T, theta, 'V', 'L', ws );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes extremal eigenpairs of the given symmetric (Hermitian) matrix.
+//
+// \param A The symmetric (Hermitian) matrix.
+// \param w The resulting eigenvalues.
+// \param X The resulting eigenvectors (one per column).
+// \param nev The number of requested eigenpairs.
+// \param spectrum The wanted part of the spectrum.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the \a nev eigenvalues of the given matrix at the end of the spectrum
+// selected by \a spectrum and the according eigenvectors, starting from a random start vector.
+// In case the given matrix is not a square matrix or \a nev is either zero or larger than the
+// size of the matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename MT1     // Type of the matrix
+        , bool SO1         // Storage order of the matrix
+        , typename VT      // Type of the vector of eigenvalues
+        , typename MT2     // Type of the matrix of eigenvectors
+        , bool SO2 >       // Storage order of the matrix of eigenvectors
+inline SolverStatistics
+   LanczosSolver<Type>::solve( const Matrix<MT1,SO1>& A, DenseVector<VT,columnVector>& w,
+                               DenseMatrix<MT2,SO2>& X, size_t nev, SpectrumFlag spectrum )
+{
+   x_.resize( (~A).columns(), false );
+   randomize( x_ );
+
+   return solve( ~A, x_, w, X, nev, spectrum );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes extremal eigenpairs of the given symmetric (Hermitian) operator.
+//
+// \param A The symmetric (Hermitian) operator.
+// \param x0 The start vector.
+// \param w The resulting eigenvalues.
+// \param X The resulting eigenvectors (one per column).
+// \param nev The number of requested eigenpairs.
+// \param spectrum The wanted part of the spectrum.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Invalid start vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes the \a nev eigenvalues of the given operator at the end of the spectrum
+// selected by \a spectrum and the according eigenvectors, using \a x0 as start vector of the
+// Krylov subspace. The size of the operator is given by the size of the start vector. In case
+// the given system matrix is not a square matrix, the size of the system matrix and the start
+// vector don't match, the start vector is zero, or \a nev is either zero or larger than the size
+// of the operator, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the vector elements
+template< typename OP      // Type of the operator
+        , typename VT1     // Type of the start vector
+        , typename VT2     // Type of the vector of eigenvalues
+        , typename MT      // Type of the matrix of eigenvectors
+        , bool SO >        // Storage order of the matrix of eigenvectors
+SolverStatistics
+   LanczosSolver<Type>::solve( const OP& A, const DenseVector<VT1,columnVector>& x0,
+                               DenseVector<VT2,columnVector>& w, DenseMatrix<MT,SO>& X,
+                               size_t nev, SpectrumFlag spectrum )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+
+   const size_t n( (~x0).size() );
+
+   checkKrylovOperator( A, n );
+
+   const size_t m( krylovSchurDimension( n, nev, control_.restart ) );
+
+   V_.resize( n, m+1UL, false );
+   H_.resize( m+1UL, m, false );
+   h_.resize( m+1UL, false );
+   g_.resize( m+1UL, false );
+   reset( H_ );
+
+   krylovSchurStart( ~x0, V_, v_ );
+
+   SolverStatistics stats{ 0UL, 0.0, false };
+   std::vector<size_t> order;
+   size_t k( 0UL );
+
+   while( true )
+   {
+      krylovSchurExpand( A, V_, H_, k, m, v_, w_, h_, g_ );
+
+      // Computation of the Ritz pairs
+      T_ = submatrix( H_, 0UL, 0UL, m, m );
+      lanczosEigen( T_, theta_, ws_ );
+      order = sortRitzValues( theta_, spectrum );
+
+      // Convergence check of the wanted Ritz pairs
+      const Type beta( H_(m,m-1UL) );
+      const double anorm( max( abs( theta_[0UL] ), abs( theta_[m-1UL] ) ) );
+
+      double residual( 0.0 );
+      for( size_t i=0UL; i<nev; ++i ) {
+         residual = max( residual, static_cast<double>( abs( beta * T_(m-1UL,order[i]) ) ) );
+      }
+
+      stats.residual  = ( anorm > 0.0 ? residual / anorm : residual );
+      stats.converged = ( stats.residual <= control_.tolerance );
+
+      if( stats.converged || stats.iterations >= control_.maxIterations ) break;
+
+      ++stats.iterations;
+
+      // Thick restart with the wanted Ritz vectors
+      k = min( nev + ( m - nev ) / 2UL, m - 1UL );
+
+      Q_.resize( m, k, false );
+      for( size_t i=0UL; i<k; ++i ) {
+         column( Q_, i ) = column( T_, order[i] );
+      }
+
+      krylovSchurRotate( V_, Q_, W_ );
+
+      reset( H_ );
+      for( size_t i=0UL; i<k; ++i ) {
+         H_(i,i) = Type( theta_[order[i]] );
+         H_(k,i) = beta * Q_(m-1UL,i);
+      }
+   }
+
+   // Computation of the wanted eigenpairs
+   resize( ~w, nev, false );
+   Q_.resize( m, nev, false );
+
+   for( size_t i=0UL; i<nev; ++i ) {
+      (~w)[i] = theta_[order[i]];
+      column( Q_, i ) = column( T_, order[i] );
+   }
+
+   resize( ~X, n, nev, false );
+   ~X = submatrix( V_, 0UL, 0UL, n, m ) * Q_;
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes extremal eigenpairs of the given symmetric (Hermitian) matrix.
+// \ingroup solvers
+//
+// \param A The symmetric (Hermitian) matrix.
+// \param w The resulting eigenvalues.
+// \param X The resulting eigenvectors (one per column).
+// \param nev The number of requested eigenpairs.
+// \param spectrum The wanted part of the spectrum.
+// \param control The termination criteria of the solver.
+// \return The statistics of the solver run.
+// \exception std::invalid_argument Invalid system matrix provided.
+// \exception std::invalid_argument Invalid number of eigenvalues requested.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function is a shortcut for the computation of extremal eigenpairs via a temporary
+// LanczosSolver. In order to reuse the Krylov basis and the work vectors for several
+// computations, a LanczosSolver instance should be used instead.
+*/
+template< typename MT1   // Type of the matrix
+        , bool SO1       // Storage order of the matrix
+        , typename VT    // Type of the vector of eigenvalues
+        , typename MT2   // Type of the matrix of eigenvectors
+        , bool SO2 >     // Storage order of the matrix of eigenvectors
+SolverStatistics lanczos( const Matrix<MT1,SO1>& A, DenseVector<VT,columnVector>& w,
+                          DenseMatrix<MT2,SO2>& X, size_t nev,
+                          SpectrumFlag spectrum = largestAlgebraic,
+                          const SolverControl& control = SolverControl() )
+{
+   LanczosSolver< ElementType_<MT2> > solver( control );
+   return solver.solve( ~A, w, X, nev, spectrum );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,470 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/LevelSchedule.h
+//  \brief Header file for the level schedule of sparse triangular solves
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LEVELSCHEDULE_H_
+#define _BLAZE_MATH_SOLVERS_LEVELSCHEDULE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level schedule of a sparse triangular solve.
+// \ingroup solvers
+//
+// The LevelSchedule class represents the dependency analysis of a sparse forward or backward
+// substitution. The rows of a row-major sparse triangular matrix are partitioned into levels
+// such that all rows of a level only depend on rows of previous levels. Therefore all rows of
+// a level can be processed concurrently. The schedule is computed once for a given sparsity
+// pattern via the analyzeLower() or analyzeUpper() function and can be reused for any number
+// of triangular solves with the same pattern:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> L;  // Lower triangular matrix
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::LevelSchedule schedule;
+   schedule.analyzeLower( L );
+
+   schedule.execute( [&]( size_t i ) {
+      double sum( b[i] );
+      for( auto element=L.begin(i); element!=L.end(i) && element->index()<i; ++element )
+         sum -= element->value() * x[element->index()];
+      x[i] = sum / L(i,i);
+   } );
+   \endcode
+
+// For the analysis only the strictly lower (analyzeLower()) or strictly upper (analyzeUpper())
+// part of each row is considered, i.e. the given matrix may also contain elements of the other
+// triangular part, as for instance a matrix containing both factors of an incomplete LU
+// decomposition. Levels containing at least SMP_SMATTRSV_THRESHOLD rows are processed in
+// parallel by means of the active SMP backend, all other levels are processed serially. In case
+// no level is large enough (or no SMP backend is active), all rows are processed in their natural
+// order instead, which is a valid order for the substitution and provides a better data locality
+// than the level by level processing.
+*/
+class LevelSchedule
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline LevelSchedule();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size  () const noexcept;
+   inline size_t levels() const noexcept;
+   inline size_t size  ( size_t level ) const;
+   inline void   clear ();
+   //@}
+   //**********************************************************************************************
+
+   //**Analysis functions**************************************************************************
+   /*!\name Analysis functions */
+   //@{
+   template< typename MT >
+   inline void analyzeLower( const SparseMatrix<MT,false>& A );
+
+   template< typename MT >
+   inline void analyzeUpper( const SparseMatrix<MT,false>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Execution functions*************************************************************************
+   /*!\name Execution functions */
+   //@{
+   template< typename Kernel >
+   inline void execute( const Kernel& kernel ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void sort( const std::vector<size_t>& level, size_t levels );
+
+   inline bool isParallel() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> begin_;    //!< The index of the first row of each level.
+   std::vector<size_t> rows_;     //!< The rows of all levels in the order of execution.
+   size_t              maxSize_;  //!< The number of rows of the largest level.
+   bool                upper_;    //!< \a true in case of a backward substitution.
+   //@}
+   //**********************************************************************************************
+
+   //**Private class constants*********************************************************************
+   //! The number of rows of a level processed by a single thread at once.
+   enum : size_t { chunkSize = 256UL };
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LevelSchedule.
+*/
+inline LevelSchedule::LevelSchedule()
+   : begin_  ( 1UL, 0UL )  // The index of the first row of each level
+   , rows_   ()            // The rows of all levels in the order of execution
+   , maxSize_( 0UL )       // The number of rows of the largest level
+   , upper_  ( false )     // true in case of a backward substitution
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total number of rows of the schedule.
+//
+// \return The total number of rows.
+*/
+inline size_t LevelSchedule::size() const noexcept
+{
+   return rows_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of the schedule.
+//
+// \return The number of levels.
+//
+// The number of levels corresponds to the length of the critical path of the triangular solve.
+*/
+inline size_t LevelSchedule::levels() const noexcept
+{
+   return begin_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the given level.
+//
+// \param level The index of the level.
+// \return The number of rows of the level.
+*/
+inline size_t LevelSchedule::size( size_t level ) const
+{
+   BLAZE_USER_ASSERT( level < levels(), "Invalid level access index" );
+   return begin_[level+1UL] - begin_[level];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the schedule to an empty schedule.
+//
+// \return void
+*/
+inline void LevelSchedule::clear()
+{
+   begin_.assign( 1UL, 0UL );
+   rows_.clear();
+   maxSize_ = 0UL;
+   upper_   = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sorting the rows according to their levels.
+//
+// \param level The level of each row.
+// \param levels The total number of levels.
+// \return void
+//
+// The rows are sorted by means of a counting sort, i.e. the rows of a level retain their
+// ascending order.
+*/
+inline void LevelSchedule::sort( const std::vector<size_t>& level, size_t levels )
+{
+   const size_t n( level.size() );
+
+   begin_.assign( levels+1UL, 0UL );
+   rows_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ++begin_[level[i]+1UL];
+   }
+
+   maxSize_ = 0UL;
+
+   for( size_t l=0UL; l<levels; ++l ) {
+      maxSize_ = max( maxSize_, begin_[l+1UL] );
+      begin_[l+1UL] += begin_[l];
+   }
+
+   std::vector<size_t> pos( begin_.begin(), begin_.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      rows_[pos[level[i]]++] = i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether any level of the schedule can be processed in parallel.
+//
+// \return \a true in case at least one level is processed in parallel, \a false if not.
+*/
+inline bool LevelSchedule::isParallel() const
+{
+   return getNumThreads() > 1UL && !isSerialSectionActive() &&
+          maxSize_ >= SMP_SMATTRSV_THRESHOLD && maxSize_ > chunkSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ANALYSIS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the schedule of a forward substitution with the given matrix.
+//
+// \param A The row-major sparse matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the level schedule of a forward substitution with the lower part of
+// the given matrix, i.e. row \a i depends on all rows \a j < \a i with a non-zero element
+// \f$ A(i,j) \f$. In case the given matrix is not a square matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the row-major sparse matrix
+inline void LevelSchedule::analyzeLower( const SparseMatrix<MT,false>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_<MT> B( ~A );  // Evaluation of the sparse matrix operand
+
+   const size_t n( B.rows() );
+
+   std::vector<size_t> level( n, 0UL );
+   size_t levels( n > 0UL ? 1UL : 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      size_t l( 0UL );
+      for( auto element=B.begin(i); element!=B.end(i) && element->index()<i; ++element ) {
+         l = max( l, level[element->index()]+1UL );
+      }
+      level[i] = l;
+      levels = max( levels, l+1UL );
+   }
+
+   sort( level, levels );
+   upper_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the schedule of a backward substitution with the given matrix.
+//
+// \param A The row-major sparse matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the level schedule of a backward substitution with the upper part of
+// the given matrix, i.e. row \a i depends on all rows \a j > \a i with a non-zero element
+// \f$ A(i,j) \f$. In case the given matrix is not a square matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the row-major sparse matrix
+inline void LevelSchedule::analyzeUpper( const SparseMatrix<MT,false>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_<MT> B( ~A );  // Evaluation of the sparse matrix operand
+
+   const size_t n( B.rows() );
+
+   std::vector<size_t> level( n, 0UL );
+   size_t levels( n > 0UL ? 1UL : 0UL );
+
+   for( size_t i=n; i-- > 0UL; ) {
+      size_t l( 0UL );
+      for( auto element=B.begin(i); element!=B.end(i); ++element ) {
+         if( element->index() > i )
+            l = max( l, level[element->index()]+1UL );
+      }
+      level[i] = l;
+      levels = max( levels, l+1UL );
+   }
+
+   sort( level, levels );
+   upper_ = true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Executes the given kernel for all rows of the schedule.
+//
+// \param kernel The kernel to be executed for each row.
+// \return void
+//
+// This function executes the given kernel for all rows of the schedule in the order of their
+// levels. The kernel is called with the index of a single row and is required to be thread-safe
+// for rows of the same level. Levels containing at least SMP_SMATTRSV_THRESHOLD rows are
+// processed in parallel, all other levels are processed serially. In case no level can be
+// processed in parallel, the rows are processed in their natural order.
+*/
+template< typename Kernel >  // Type of the row kernel
+inline void LevelSchedule::execute( const Kernel& kernel ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isParallel() )
+   {
+      const size_t n( rows_.size() );
+
+      if( upper_ ) {
+         for( size_t i=n; i-- > 0UL; ) {
+            kernel( i );
+         }
+      }
+      else {
+         for( size_t i=0UL; i<n; ++i ) {
+            kernel( i );
+         }
+      }
+      return;
+   }
+
+   const size_t* const rows( rows_.data() );
+
+   for( size_t l=0UL; l<levels(); ++l )
+   {
+      const size_t begin( begin_[l]     );
+      const size_t end  ( begin_[l+1UL] );
+
+      if( end - begin < SMP_SMATTRSV_THRESHOLD || end - begin <= chunkSize ) {
+         for( size_t k=begin; k<end; ++k ) {
+            kernel( rows[k] );
+         }
+         continue;
+      }
+
+      const size_t chunks( ( end - begin + chunkSize - 1UL ) / chunkSize );
+
+      smpFor( chunks, [&]( size_t chunk )
+      {
+         const size_t kbegin( begin + chunk*chunkSize );
+         const size_t kend  ( min( end, kbegin+chunkSize ) );
+         for( size_t k=kbegin; k<kend; ++k ) {
+            kernel( rows[k] );
+         }
+      } );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,281 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/PreconditionerKernels.h
+//  \brief Header file for the internal kernels of the preconditioners
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_PRECONDITIONERKERNELS_H_
+#define _BLAZE_MATH_SOLVERS_PRECONDITIONERKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSITY PATTERN FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the given row-major sparse matrix into the storage of a preconditioner.
+// \ingroup solvers
+//
+// \param A The row-major sparse matrix to be copied.
+// \param F The resulting factor storage.
+// \param lower \a true in case only the lower part (including the diagonal) is copied.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function copies both the sparsity pattern and the values of the given matrix. In case
+// \a lower is \a true, all elements above the diagonal are omitted.
+*/
+template< typename MT      // Type of the sparse matrix
+        , typename Type >  // Data type of the factor storage
+void copyPattern( const SparseMatrix<MT,false>& A, CompressedMatrix<Type,rowMajor>& F, bool lower )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_<MT> B( ~A );  // Evaluation of the sparse matrix operand
+
+   const size_t n( B.rows() );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=B.begin(i); element!=B.end(i) && ( !lower || element->index() <= i ); ++element ) {
+         ++nonzeros;
+      }
+   }
+
+   F.reset();
+   F.resize( n, n, false );
+   F.reserve( nonzeros );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=B.begin(i); element!=B.end(i) && ( !lower || element->index() <= i ); ++element ) {
+         F.append( i, element->index(), element->value() );
+      }
+      F.finalize( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the given column-major sparse matrix into the storage of a preconditioner.
+// \ingroup solvers
+//
+// \param A The column-major sparse matrix to be copied.
+// \param F The resulting factor storage.
+// \param lower \a true in case only the lower part (including the diagonal) is copied.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+*/
+template< typename MT      // Type of the sparse matrix
+        , typename Type >  // Data type of the factor storage
+void copyPattern( const SparseMatrix<MT,true>& A, CompressedMatrix<Type,rowMajor>& F, bool lower )
+{
+   const CompressedMatrix< ElementType_<MT>, rowMajor > B( ~A );
+   copyPattern( B, F, lower );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the values of the given row-major sparse matrix into the storage of a
+//        preconditioner with a fixed sparsity pattern.
+// \ingroup solvers
+//
+// \param A The row-major sparse matrix to be copied.
+// \param F The factor storage with fixed sparsity pattern.
+// \param lower \a true in case only the lower part (including the diagonal) is copied.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern.
+//
+// This function copies the values of the given matrix into the existing sparsity pattern of
+// \a F. In case the (lower) sparsity pattern of the matrix doesn't match the pattern of \a F,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT      // Type of the sparse matrix
+        , typename Type >  // Data type of the factor storage
+void copyValues( const SparseMatrix<MT,false>& A, CompressedMatrix<Type,rowMajor>& F, bool lower )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).rows() != F.rows() || (~A).columns() != F.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern" );
+   }
+
+   CompositeType_<MT> B( ~A );  // Evaluation of the sparse matrix operand
+
+   for( size_t i=0UL; i<F.rows(); ++i )
+   {
+      auto factor( F.begin(i) );
+      const auto fend( F.end(i) );
+
+      for( auto element=B.begin(i); element!=B.end(i) && ( !lower || element->index() <= i ); ++element, ++factor ) {
+         if( factor == fend || factor->index() != element->index() ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern" );
+         }
+         factor->value() = element->value();
+      }
+
+      if( factor != fend ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the values of the given column-major sparse matrix into the storage of a
+//        preconditioner with a fixed sparsity pattern.
+// \ingroup solvers
+//
+// \param A The column-major sparse matrix to be copied.
+// \param F The factor storage with fixed sparsity pattern.
+// \param lower \a true in case only the lower part (including the diagonal) is copied.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern.
+*/
+template< typename MT      // Type of the sparse matrix
+        , typename Type >  // Data type of the factor storage
+void copyValues( const SparseMatrix<MT,true>& A, CompressedMatrix<Type,rowMajor>& F, bool lower )
+{
+   const CompressedMatrix< ElementType_<MT>, rowMajor > B( ~A );
+   copyValues( B, F, lower );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the position of the diagonal element within each row of the given matrix.
+// \ingroup solvers
+//
+// \param F The row-major factor storage.
+// \param diagonal The resulting offsets of the diagonal elements from the beginning of the rows.
+// \return void
+// \exception std::invalid_argument Missing diagonal element.
+//
+// In case any row of the given matrix doesn't contain its diagonal element, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the factor storage
+void findDiagonal( const CompressedMatrix<Type,rowMajor>& F, std::vector<size_t>& diagonal )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   diagonal.resize( F.rows() );
+
+   for( size_t i=0UL; i<F.rows(); ++i )
+   {
+      const auto element( F.lowerBound( i, i ) );
+
+      if( element == F.end(i) || element->index() != i ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Missing diagonal element" );
+      }
+
+      diagonal[i] = element - F.begin(i);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  APPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Prepares the application of a preconditioner of the given size.
+// \ingroup solvers
+//
+// \param n The size of the preconditioner.
+// \param r The input vector.
+// \param z The preconditioned vector.
+// \return void
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// This function checks the size of the input vector and resizes the preconditioned vector to
+// the size of the preconditioner. In case the size of the input vector doesn't match the size
+// of the preconditioner, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1    // Type of the input vector
+        , typename VT2 >  // Type of the preconditioned vector
+inline void preparePreconditioner( size_t n, const DenseVector<VT1,columnVector>& r,
+                                   DenseVector<VT2,columnVector>& z )
+{
+   if( (~r).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector sizes" );
+   }
+
+   resize( ~z, n, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
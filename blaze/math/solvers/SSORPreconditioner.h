@@ -0,0 +1,407 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SSORPreconditioner.h
+//  \brief Header file for the symmetric successive over-relaxation preconditioner
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/solvers/PreconditionerKernels.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symmetric successive over-relaxation (SSOR) preconditioner.
+// \ingroup solvers
+//
+// The SSORPreconditioner class template represents the preconditioner
+
+          \f[ M = \frac{1}{\omega (2-\omega)} (D + \omega L) D^{-1} (D + \omega U), \f]
+
+// where \a D, \a L, and \a U are the diagonal, the strictly lower, and the strictly upper part
+// of the system matrix \a A and \f$ \omega \in (0,2) \f$ is the relaxation parameter. For
+// \f$ \omega = 1 \f$ the preconditioner corresponds to the symmetric Gauss-Seidel method. In
+// contrast to an incomplete decomposition, the computation of the preconditioner is cheap
+// (it only copies the system matrix), the application consists of a level-scheduled forward and
+// backward sweep (see the LevelSchedule class). For a symmetric (Hermitian) positive definite
+// system matrix the preconditioner is symmetric positive definite and can be used with the
+// conjugate gradient method:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> b, x;
+   // ... Resizing and initialization
+
+   blaze::SSORPreconditioner<double> M( A, 1.5 );
+   blaze::cg( A, b, x, M );
+   \endcode
+
+// Analogous to the incomplete decompositions, the sparsity pattern of the system matrix is
+// analyzed by the compute() function, whereas the factorize() function only updates the values
+// of a matrix with the same sparsity pattern.
+*/
+template< typename Type >  // Data type of the preconditioner
+class SSORPreconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Data type of the preconditioner.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SSORPreconditioner( double omega = 1.0 );
+
+   template< typename MT, bool SO >
+   explicit inline SSORPreconditioner( const SparseMatrix<MT,SO>& A, double omega = 1.0 );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\name Function call operator */
+   //@{
+   template< typename VT1, typename VT2 >
+   void operator()( const DenseVector<VT1,columnVector>& r, DenseVector<VT2,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size () const noexcept;
+   inline double omega() const noexcept;
+
+   template< typename MT, bool SO >
+   void compute( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void invertDiagonal();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   double                           omega_;     //!< The relaxation parameter.
+   CompressedMatrix<Type,rowMajor>  A_;         //!< The copy of the system matrix.
+   std::vector<size_t>              diagonal_;  //!< The positions of the diagonal elements.
+   DynamicVector<Type,columnVector> inverse_;   //!< The inverted diagonal of the system matrix.
+   LevelSchedule                    lower_;     //!< The schedule of the forward sweep.
+   LevelSchedule                    upper_;     //!< The schedule of the backward sweep.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for SSORPreconditioner.
+//
+// \param omega The relaxation parameter \f$ \omega \in (0,2) \f$.
+// \exception std::invalid_argument Invalid relaxation parameter.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline SSORPreconditioner<Type>::SSORPreconditioner( double omega )
+   : omega_   ( omega )  // The relaxation parameter
+   , A_       ()         // The copy of the system matrix
+   , diagonal_()         // The positions of the diagonal elements
+   , inverse_ ()         // The inverted diagonal of the system matrix
+   , lower_   ()         // The schedule of the forward sweep
+   , upper_   ()         // The schedule of the backward sweep
+{
+   if( !( omega > 0.0 && omega < 2.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid relaxation parameter" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the SSOR preconditioner of the given sparse matrix.
+//
+// \param A The square sparse system matrix.
+// \param omega The relaxation parameter \f$ \omega \in (0,2) \f$.
+// \exception std::invalid_argument Invalid relaxation parameter.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Inversion of zero diagonal element failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline SSORPreconditioner<Type>::SSORPreconditioner( const SparseMatrix<MT,SO>& A, double omega )
+   : omega_   ( omega )  // The relaxation parameter
+   , A_       ()         // The copy of the system matrix
+   , diagonal_()         // The positions of the diagonal elements
+   , inverse_ ()         // The inverted diagonal of the system matrix
+   , lower_   ()         // The schedule of the forward sweep
+   , upper_   ()         // The schedule of the backward sweep
+{
+   if( !( omega > 0.0 && omega < 2.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid relaxation parameter" );
+   }
+
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the preconditioner to the given vector (\f$ z = M^{-1}*r \f$).
+//
+// \param r The input vector.
+// \param z The resulting preconditioned vector.
+// \return void
+// \exception std::invalid_argument Invalid vector sizes.
+//
+// The preconditioned vector \a z is resized to the size of the preconditioner. It is allowed
+// to pass the same vector as \a r and \a z.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the input vector
+        , typename VT2 >   // Type of the preconditioned vector
+void SSORPreconditioner<Type>::operator()( const DenseVector<VT1,columnVector>& r,
+                                           DenseVector<VT2,columnVector>& z ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   preparePreconditioner( A_.rows(), r, z );
+
+   const VT1& x( ~r );
+   VT2& y( ~z );
+
+   const Type omega( omega_ );
+   const Type scale( omega_ * ( 2.0 - omega_ ) );
+
+   lower_.execute( [this,&x,&y,omega,scale]( size_t i )
+   {
+      const auto diagonal( A_.begin(i) + diagonal_[i] );
+      Type sum{};
+      for( auto element=A_.begin(i); element!=diagonal; ++element ) {
+         sum += element->value() * y[element->index()];
+      }
+      y[i] = ( scale * x[i] - omega * sum ) * inverse_[i];
+   } );
+
+   upper_.execute( [this,&y,omega]( size_t i )
+   {
+      Type sum{};
+      for( auto element=A_.begin(i)+diagonal_[i]+1UL; element!=A_.end(i); ++element ) {
+         sum += element->value() * y[element->index()];
+      }
+      y[i] -= omega * inverse_[i] * sum;
+   } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the preconditioner.
+//
+// \return The number of rows and columns of the preconditioned system matrix.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t SSORPreconditioner<Type>::size() const noexcept
+{
+   return A_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relaxation parameter of the preconditioner.
+//
+// \return The relaxation parameter.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline double SSORPreconditioner<Type>::omega() const noexcept
+{
+   return omega_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the SSOR preconditioner of the given sparse matrix.
+//
+// \param A The square sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element.
+// \exception std::runtime_error Inversion of zero diagonal element failed.
+//
+// This function copies the given matrix and computes the schedules of the forward and backward
+// sweeps. In case the given matrix is not a square matrix or any of its diagonal elements is not
+// contained in its sparsity pattern, a \a std::invalid_argument exception is thrown. In case any
+// diagonal element is zero, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void SSORPreconditioner<Type>::compute( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   copyPattern( ~A, A_, false );
+   findDiagonal( A_, diagonal_ );
+   lower_.analyzeLower( A_ );
+   upper_.analyzeUpper( A_ );
+   invertDiagonal();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updates the values of the preconditioner for a sparse matrix with the same sparsity
+//        pattern.
+//
+// \param A The square sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern.
+// \exception std::runtime_error Inversion of zero diagonal element failed.
+//
+// This function copies the values of the given matrix by reusing the storage and the schedules
+// of the sweeps. Therefore the sparsity pattern of the given matrix is required to be identical
+// to the pattern of the matrix passed to the last call of the compute() function. Otherwise a
+// \a std::invalid_argument exception is thrown. In case any diagonal element is zero, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void SSORPreconditioner<Type>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   copyValues( ~A, A_, false );
+   invertDiagonal();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inverts the diagonal elements of the copied system matrix.
+//
+// \return void
+// \exception std::runtime_error Inversion of zero diagonal element failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+void SSORPreconditioner<Type>::invertDiagonal()
+{
+   const size_t n( A_.rows() );
+
+   inverse_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Type diagonal( A_.begin(i)[diagonal_[i]].value() );
+
+      if( isDefault( diagonal ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of zero diagonal element failed" );
+      }
+
+      inverse_[i] = Type(1) / diagonal;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
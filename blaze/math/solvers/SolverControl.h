@@ -0,0 +1,130 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SolverControl.h
+//  \brief Header file for the control and statistics of the iterative solvers
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SOLVERCONTROL_H_
+#define _BLAZE_MATH_SOLVERS_SOLVERCONTROL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SOLVERCONTROL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Termination criteria of the iterative solvers.
+// \ingroup solvers
+//
+// The SolverControl class bundles the parameters that control the iterative solvers of \b Blaze
+// (see for instance the CGSolver, BiCGStabSolver, and GMRESSolver class templates). An iterative
+// solver terminates successfully as soon as the relative residual \f$ \|b-A*x\|_2 / \|b\|_2 \f$
+// drops below the given tolerance. In case the solver did not converge within the maximum number
+// of iterations, it terminates unsuccessfully. The restart length is only used by the restarted
+// GMRES solver and specifies the maximum dimension of the Krylov subspace before a restart:
+
+   \code
+   blaze::SolverControl control( 500UL, 1E-10 );  // At most 500 iterations, tolerance 1E-10
+   control.restart = 50UL;                        // Restart GMRES after 50 iterations
+   \endcode
+*/
+struct SolverControl
+{
+   //**Constructor*********************************************************************************
+   /*!\brief The constructor for SolverControl.
+   //
+   // \param maxIter The maximum number of iterations.
+   // \param tol The tolerance for the relative residual.
+   // \param length The restart length of the GMRES solver.
+   */
+   explicit inline SolverControl( size_t maxIter = 1000UL, double tol = 1E-8,
+                                  size_t length = 30UL ) noexcept
+      : maxIterations( maxIter )  // The maximum number of iterations
+      , tolerance    ( tol     )  // The tolerance for the relative residual
+      , restart      ( length  )  // The restart length of the GMRES solver
+   {}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   size_t maxIterations;  //!< The maximum number of iterations.
+   double tolerance;      //!< The tolerance for the relative residual.
+   size_t restart;        //!< The restart length of the GMRES solver.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SOLVERSTATISTICS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Result of a single run of an iterative solver.
+// \ingroup solvers
+//
+// The SolverStatistics class is returned by all iterative solvers of \b Blaze. It contains the
+// number of performed iterations, the final relative residual \f$ \|b-A*x\|_2 / \|b\|_2 \f$, and
+// a flag indicating whether the solver converged with respect to the given SolverControl:
+
+   \code
+   const blaze::SolverStatistics stats( blaze::cg( A, b, x ) );
+
+   if( !stats.converged ) {
+      std::cerr << " CG failed to converge (residual " << stats.residual << ")\n";
+   }
+   \endcode
+*/
+struct SolverStatistics
+{
+   size_t iterations;  //!< The number of performed iterations.
+   double residual;    //!< The final relative residual.
+   bool   converged;   //!< \a true in case the solver converged, \a false if not.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
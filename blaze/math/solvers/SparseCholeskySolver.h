@@ -0,0 +1,1367 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SparseCholeskySolver.h
+//  \brief Header file for the supernodal sparse Cholesky solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SPARSECHOLESKYSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_SPARSECHOLESKYSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/lapack/clapack/potrf.h>
+#include <blaze/math/lapack/native/trsm.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/Reordering.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal direct solver for sparse symmetric (Hermitian) positive definite systems.
+// \ingroup solvers
+//
+// The SparseCholeskySolver class template solves the linear system \f$ A*x=b \f$ (or
+// \f$ A*X=B \f$ for multiple right-hand sides) for a sparse symmetric (Hermitian) positive
+// definite matrix \a A by means of the Cholesky decomposition \f$ P*A*P^T = L*L^H \f$. Only the
+// lower part of the system matrix is accessed, i.e. it is possible to use both a general
+// CompressedMatrix and a SymmetricMatrix or HermitianMatrix adaptor:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A;
+   blaze::DynamicVector<double> x, b;
+   blaze::DynamicMatrix<double> X, B;
+   // ... Resizing and initialization
+
+   blaze::SparseCholeskySolver<double> solver( A );  // Symbolic and numeric decomposition
+
+   solver.solve( b, x );  // Solving a single right-hand side
+   solver.solve( B, X );  // Solving multiple right-hand sides (one per column of B)
+   \endcode
+
+// The decomposition consists of two phases. The symbolic analyze() function computes a
+// fill-reducing ordering (by default the approximate minimum degree ordering, see blaze::amd()),
+// the elimination tree and its postordering, and the sparsity pattern of the factor \a L. Columns
+// of \a L with (nearly) identical sparsity patterns are grouped into supernodes, which are stored
+// as dense column-major blocks. The numeric factorize() function computes the values of \a L
+// supernode by supernode: The updates from previous supernodes are computed by the vectorized
+// dense matrix multiplication kernels, the diagonal block is decomposed by the blocked dense
+// Cholesky decomposition and the remaining rows by a dense triangular solve. Supernodes in
+// independent subtrees of the elimination tree are decomposed in parallel by means of the active
+// shared memory parallelization, in case the corresponding level of the tree comprises at least
+// SMP_SMATLLH_THRESHOLD factor elements. Since the symbolic phase is independent of the values of
+// the system matrix, a matrix with the same sparsity pattern can be decomposed by factorize()
+// alone:
+
+   \code
+   blaze::SparseCholeskySolver<double> solver;
+   solver.analyze( A );  // Symbolic analysis only
+
+   for( ... ) {
+      // ... Updating the values of A
+      solver.factorize( A );  // Numeric decomposition only
+      solver.solve( b, x );
+   }
+   \endcode
+
+// Note that the solve() functions must only be used after a successful numeric decomposition.
+*/
+template< typename Type >  // Data type of the factor
+class SparseCholeskySolver
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Data type of the factor.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SparseCholeskySolver();
+
+   template< typename MT, bool SO >
+   explicit inline SparseCholeskySolver( const SparseMatrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void solve( const DenseVector<VT1,columnVector>& b, DenseVector<VT2,columnVector>& x ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void solve( const DenseMatrix<MT1,SO1>& B, DenseMatrix<MT2,SO2>& X ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                     size       () const noexcept;
+   inline size_t                     nonZeros   () const noexcept;
+   inline size_t                     supernodes () const noexcept;
+   inline const std::vector<size_t>& permutation() const noexcept;
+
+   template< typename MT, bool SO >
+   void compute( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using BlockType     = CustomMatrix<Type,unaligned,unpadded,columnMajor>;  //!< Type of a supernode view.
+   using TransposeType = CustomMatrix<Type,unaligned,unpadded,rowMajor>;     //!< Type of a transposed supernode view.
+   using ColumnType    = CustomVector<Type,unaligned,unpadded,columnVector>; //!< Type of a supernode column view.
+   using WorkspaceType = DynamicMatrix<Type,columnMajor>;                    //!< Type of the update workspace.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO, typename Callable >
+   static void traverse( const SparseMatrix<MT,SO>& A, Callable func );
+
+   template< typename MT, bool SO >
+   void lowerPattern( const SparseMatrix<MT,SO>& A, std::vector<size_t>& begin,
+                      std::vector<size_t>& indices ) const;
+
+   void eliminationTree( const std::vector<size_t>& begin, const std::vector<size_t>& indices,
+                         std::vector<size_t>& parent ) const;
+
+   void partition( const std::vector<size_t>& parent, const std::vector<size_t>& counts );
+
+   void structure( const std::vector<size_t>& begin, const std::vector<size_t>& indices,
+                   const std::vector<size_t>& parent, std::vector<size_t>& snode );
+
+   void schedule( const std::vector<size_t>& snode );
+
+   bool isParallel() const;
+
+   bool decompose( size_t J, WorkspaceType& W, std::vector<size_t>& rel );
+
+   static void solvePanel( Type* LJ, size_t w, size_t m );
+
+   void substitute( Type* Y, size_t k, size_t ldy ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> perm_;         //!< The fill-reducing permutation.
+   std::vector<size_t> iperm_;        //!< The inverse of the fill-reducing permutation.
+   std::vector<size_t> first_;        //!< The first column of each supernode.
+   std::vector<size_t> rowBegin_;     //!< The begin of the row indices of each supernode.
+   std::vector<size_t> rows_;         //!< The row indices of all supernodes.
+   std::vector<size_t> valueBegin_;   //!< The begin of the dense block of each supernode.
+   std::vector<size_t> updateBegin_;  //!< The begin of the updates of each supernode.
+   std::vector<size_t> sources_;      //!< The updating supernode of each update.
+   std::vector<size_t> offsets_;      //!< The first updating row within the updating supernode.
+   std::vector<size_t> levelBegin_;   //!< The begin of each level of the supernodal tree.
+   std::vector<size_t> levels_;       //!< The supernodes sorted by their levels.
+   std::vector<size_t> begin_;        //!< The begin of each row of the lower part of A.
+   std::vector<size_t> indices_;      //!< The column indices of the lower part of A.
+   std::vector<size_t> targets_;      //!< The position of each element of A within the factor.
+   size_t              nonZeros_;     //!< The number of non-zero elements of the factor.
+   size_t              maxWork_;      //!< The number of elements of the largest parallel level.
+
+   DynamicVector<Type,columnVector> values_;  //!< The dense blocks of all supernodes.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseCholeskySolver.
+*/
+template< typename Type >  // Data type of the factor
+inline SparseCholeskySolver<Type>::SparseCholeskySolver()
+   : perm_       ()           // The fill-reducing permutation
+   , iperm_      ()           // The inverse of the fill-reducing permutation
+   , first_      ( 1UL, 0UL ) // The first column of each supernode
+   , rowBegin_   ( 1UL, 0UL ) // The begin of the row indices of each supernode
+   , rows_       ()           // The row indices of all supernodes
+   , valueBegin_ ( 1UL, 0UL ) // The begin of the dense block of each supernode
+   , updateBegin_( 1UL, 0UL ) // The begin of the updates of each supernode
+   , sources_    ()           // The updating supernode of each update
+   , offsets_    ()           // The first updating row within the updating supernode
+   , levelBegin_ ( 1UL, 0UL ) // The begin of each level of the supernodal tree
+   , levels_     ()           // The supernodes sorted by their levels
+   , begin_      ( 1UL, 0UL ) // The begin of each row of the lower part of A
+   , indices_    ()           // The column indices of the lower part of A
+   , targets_    ()           // The position of each element of A within the factor
+   , nonZeros_   ( 0UL )      // The number of non-zero elements of the factor
+   , maxWork_    ( 0UL )      // The number of elements of the largest parallel level
+   , values_     ()           // The dense blocks of all supernodes
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the Cholesky decomposition of the given sparse matrix.
+//
+// \param A The symmetric (Hermitian) positive definite sparse system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline SparseCholeskySolver<Type>::SparseCholeskySolver( const SparseMatrix<MT,SO>& A )
+   : SparseCholeskySolver()
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the linear system for a single right-hand side (\f$ x = A^{-1}*b \f$).
+//
+// \param b The right-hand side vector.
+// \param x The resulting solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// The solution vector \a x is resized to the size of the system matrix. It is allowed to pass
+// the same vector as \a b and \a x. In case the size of the right-hand side vector doesn't match
+// the size of the system matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the factor
+template< typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the solution vector
+void SparseCholeskySolver<Type>::solve( const DenseVector<VT1,columnVector>& b,
+                                        DenseVector<VT2,columnVector>& x ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~b).size() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   const size_t n( size() );
+
+   DynamicVector<Type,columnVector> y( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      y[i] = (~b)[perm_[i]];
+   }
+
+   substitute( y.data(), 1UL, n );
+
+   resize( ~x, n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      (~x)[perm_[i]] = y[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the linear system for multiple right-hand sides (\f$ X = A^{-1}*B \f$).
+//
+// \param B The right-hand side matrix (one right-hand side per column).
+// \param X The resulting solution matrix.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// The solution matrix \a X is resized to the size of the right-hand side matrix. It is allowed
+// to pass the same matrix as \a B and \a X. All right-hand sides are processed within a single
+// forward and backward substitution. In case the number of rows of the right-hand side matrix
+// doesn't match the size of the system matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT1     // Type of the right-hand side matrix
+        , bool SO1         // Storage order of the right-hand side matrix
+        , typename MT2     // Type of the solution matrix
+        , bool SO2 >       // Storage order of the solution matrix
+void SparseCholeskySolver<Type>::solve( const DenseMatrix<MT1,SO1>& B,
+                                        DenseMatrix<MT2,SO2>& X ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~B).rows() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   const size_t n( size() );
+   const size_t k( (~B).columns() );
+
+   WorkspaceType Y( n, k );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<k; ++j ) {
+         Y(i,j) = (~B)(perm_[i],j);
+      }
+   }
+
+   substitute( Y.data(), k, Y.spacing() );
+
+   resize( ~X, n, k, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<k; ++j ) {
+         (~X)(perm_[i],j) = Y(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the system matrix.
+//
+// \return The number of rows and columns of the system matrix.
+*/
+template< typename Type >  // Data type of the factor
+inline size_t SparseCholeskySolver<Type>::size() const noexcept
+{
+   return perm_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the Cholesky factor.
+//
+// \return The number of stored elements of the lower factor \a L (including the diagonal).
+//
+// Note that due to the amalgamation of supernodes the stored elements may contain a small
+// number of explicit zeros.
+*/
+template< typename Type >  // Data type of the factor
+inline size_t SparseCholeskySolver<Type>::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes of the Cholesky factor.
+//
+// \return The number of supernodes.
+*/
+template< typename Type >  // Data type of the factor
+inline size_t SparseCholeskySolver<Type>::supernodes() const noexcept
+{
+   return first_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill-reducing permutation of the decomposition.
+//
+// \return The permutation vector \a p of the decomposition \f$ P*A*P^T = L*L^H \f$.
+//
+// The \a i-th row and column of the decomposed matrix correspond to the <tt>p[i]</tt>-th row
+// and column of the system matrix (see blaze::permute()).
+*/
+template< typename Type >  // Data type of the factor
+inline const std::vector<size_t>& SparseCholeskySolver<Type>::permutation() const noexcept
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Cholesky decomposition of the given sparse matrix.
+//
+// \param A The symmetric (Hermitian) positive definite sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+//
+// This function performs both the symbolic and the numeric phase of the decomposition based on
+// the approximate minimum degree ordering of the given matrix. In case the given matrix is not a
+// square matrix or in case it is not positive definite, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void SparseCholeskySolver<Type>::compute( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   analyze( ~A );
+   factorize( ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix based on the approximate minimum degree ordering.
+//
+// \param A The symmetric (Hermitian) sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the approximate minimum degree ordering of the given matrix (see
+// blaze::amd()) and performs the symbolic analysis for the resulting ordering. In case the given
+// matrix is not a square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void SparseCholeskySolver<Type>::analyze( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   analyze( ~A, amd( ~A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse matrix based on the given ordering.
+//
+// \param A The symmetric (Hermitian) sparse system matrix.
+// \param perm The fill-reducing permutation vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function performs the symbolic analysis of the decomposition of the given matrix for
+// the given permutation (as for instance computed by blaze::amd() or blaze::rcm()). Within the
+// given ordering, the elimination tree is postordered, which does not change the sparsity of the
+// factor, but keeps the columns of each subtree contiguous. Subsequently the sparsity pattern of
+// the factor is partitioned into supernodes: A column is merged into the supernode of its only
+// child in case both have identical sparsity patterns (fundamental supernodes) or in case the
+// number of explicit zeros introduced by the merge is small. In case the given matrix is not a
+// square matrix or the permutation vector is invalid, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void SparseCholeskySolver<Type>::analyze( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   std::vector<size_t> begin, indices, parent, snode;
+
+   // Computation of the postordering of the elimination tree for the given ordering
+   iperm_ = invertPermutation( perm, n );
+   perm_  = perm;
+   lowerPattern( ~A, begin, indices );
+   eliminationTree( begin, indices, parent );
+
+   std::vector<size_t> head( n, n ), next( n, n ), stack;
+
+   for( size_t j=n; j-- > 0UL; ) {
+      if( parent[j] != n ) {
+         next[j] = head[parent[j]];
+         head[parent[j]] = j;
+      }
+   }
+
+   perm_.clear();
+   perm_.reserve( n );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      if( parent[j] != n ) continue;
+
+      stack.push_back( j );
+
+      while( !stack.empty() ) {
+         const size_t k( stack.back() );
+         if( head[k] != n ) {
+            stack.push_back( head[k] );
+            head[k] = next[head[k]];
+         }
+         else {
+            stack.pop_back();
+            perm_.push_back( perm[k] );
+         }
+      }
+   }
+
+   // Computation of the elimination tree and the column counts for the postordering
+   iperm_ = invertPermutation( perm_, n );
+   lowerPattern( ~A, begin, indices );
+   eliminationTree( begin, indices, parent );
+
+   std::vector<size_t> counts( n, 1UL ), mark( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      mark[i] = i;
+      for( size_t k=begin[i]; k<begin[i+1UL]; ++k ) {
+         for( size_t j=indices[k]; mark[j]!=i; j=parent[j] ) {
+            mark[j] = i;
+            ++counts[j];
+         }
+      }
+   }
+
+   partition( parent, counts );
+   structure( begin, indices, parent, snode );
+   schedule( snode );
+
+   // Computation of the position of each element of the lower part of A within the factor.
+   // The elements are stored row-wise, independent of the storage order of A, such that the
+   // numeric decomposition accepts matrices of both storage orders.
+   begin_.assign( n+1UL, 0UL );
+
+   traverse( ~A, [this]( size_t major, size_t minor, const auto& ) {
+      ++begin_[( SO ? minor : major )+1UL];
+   } );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      begin_[k+1UL] += begin_[k];
+   }
+
+   indices_.resize( begin_[n] );
+   targets_.resize( begin_[n] );
+
+   std::vector<size_t> cursor( begin_.begin(), begin_.end()-1L );
+
+   traverse( ~A, [this,&snode,&cursor]( size_t major, size_t minor, const auto& )
+   {
+      const size_t row   ( SO ? minor : major );
+      const size_t column( SO ? major : minor );
+
+      size_t i( iperm_[row] );
+      size_t j( iperm_[column] );
+      if( i < j ) std::swap( i, j );
+
+      const size_t J( snode[j] );
+      const auto rows( rows_.begin() + rowBegin_[J] );
+      const size_t m( rowBegin_[J+1UL] - rowBegin_[J] );
+      const size_t pos( std::lower_bound( rows, rows+m, i ) - rows );
+
+      indices_[cursor[row]] = column;
+      targets_[cursor[row]] = valueBegin_[J] + ( j - first_[J] )*m + pos;
+      ++cursor[row];
+   } );
+
+   values_.resize( valueBegin_.back(), false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric decomposition of a sparse matrix with the analyzed sparsity pattern.
+//
+// \param A The symmetric (Hermitian) positive definite sparse system matrix.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern.
+// \exception std::invalid_argument Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the values of the Cholesky factor for the given matrix by reusing the
+// symbolic analysis of the last call to the analyze() function. Therefore the sparsity pattern
+// of the lower part of the given matrix is required to be identical to the pattern of the
+// analyzed matrix. Otherwise or in case the given matrix is not positive definite, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+void SparseCholeskySolver<Type>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).rows() != size() || (~A).columns() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern" );
+   }
+
+   reset( values_ );
+
+   std::vector<size_t> next( begin_.begin(), begin_.end()-1L );
+
+   traverse( ~A, [this,&next]( size_t major, size_t minor, const auto& value )
+   {
+      const size_t row   ( SO ? minor : major );
+      const size_t column( SO ? major : minor );
+      const size_t pos   ( next[row]++ );
+
+      if( pos >= begin_[row+1UL] || indices_[pos] != column ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern" );
+      }
+
+      if( iperm_[row] < iperm_[column] )
+         values_[targets_[pos]] = conj( value );
+      else
+         values_[targets_[pos]] = value;
+   } );
+
+   for( size_t i=0UL; i<size(); ++i ) {
+      if( next[i] != begin_[i+1UL] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern" );
+      }
+   }
+
+   WorkspaceType W;
+   std::vector<size_t> rel;
+
+   if( !isParallel() )
+   {
+      for( size_t J=0UL; J<supernodes(); ++J ) {
+         if( !decompose( J, W, rel ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of non-positive-definite matrix failed" );
+         }
+      }
+      return;
+   }
+
+   std::vector<unsigned char> success;
+
+   for( size_t l=0UL; l+1UL<levelBegin_.size(); ++l )
+   {
+      const size_t begin( levelBegin_[l]     );
+      const size_t end  ( levelBegin_[l+1UL] );
+
+      size_t work( 0UL );
+
+      for( size_t k=begin; k<end; ++k ) {
+         const size_t J( levels_[k] );
+         work += valueBegin_[J+1UL] - valueBegin_[J];
+      }
+
+      if( end - begin < 2UL || work < SMP_SMATLLH_THRESHOLD ) {
+         for( size_t k=begin; k<end; ++k ) {
+            if( !decompose( levels_[k], W, rel ) ) {
+               BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of non-positive-definite matrix failed" );
+            }
+         }
+         continue;
+      }
+
+      success.assign( end - begin, 0U );
+
+      smpFor( end - begin, [this,begin,&success]( size_t k )
+      {
+         WorkspaceType workspace;
+         std::vector<size_t> indices;
+
+         success[k] = decompose( levels_[begin+k], workspace, indices );
+      } );
+
+      if( std::find( success.begin(), success.end(), 0U ) != success.end() ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Decomposition of non-positive-definite matrix failed" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Traverses all elements of the lower part of the given sparse matrix.
+//
+// \param A The sparse matrix.
+// \param func The function to be called for each element.
+// \return void
+//
+// This function calls the given function for each element of the lower part of the given matrix
+// (including the diagonal) with the index of the row/column of the element (depending on the
+// storage order), the index of the element within the row/column, and the value of the element.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the sparse matrix
+        , bool SO          // Storage order of the sparse matrix
+        , typename Callable >  // Type of the function
+void SparseCholeskySolver<Type>::traverse( const SparseMatrix<MT,SO>& A, Callable func )
+{
+   const size_t n( SO ? (~A).columns() : (~A).rows() );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( auto element=(~A).begin(k); element!=(~A).end(k); ++element ) {
+         if( SO ? element->index() >= k : element->index() <= k ) {
+            func( k, element->index(), element->value() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the strictly lower part of the sparsity pattern of the permuted matrix.
+//
+// \param A The sparse system matrix.
+// \param begin The begin of each row of the resulting pattern.
+// \param indices The column indices of the resulting pattern.
+// \return void
+//
+// This function computes the sparsity pattern of the strictly lower part of \f$ P*A*P^T \f$ for
+// the current permutation in compressed row storage. Since only the lower part of \a A is
+// accessed, each element \f$ A(i,j) \f$ is mapped to the lower part of the permuted matrix. The
+// column indices of each row are sorted in ascending order.
+*/
+template< typename Type >  // Data type of the factor
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseCholeskySolver<Type>::lowerPattern( const SparseMatrix<MT,SO>& A, std::vector<size_t>& begin,
+                                               std::vector<size_t>& indices ) const
+{
+   const size_t n( size() );
+
+   std::vector<size_t> cbegin( n+1UL, 0UL ), cindices;
+
+   // Computation of the pattern in compressed column storage
+   traverse( ~A, [this,&cbegin]( size_t major, size_t minor, const auto& ) {
+      if( major != minor ) {
+         ++cbegin[min( iperm_[major], iperm_[minor] )+1UL];
+      }
+   } );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      cbegin[j+1UL] += cbegin[j];
+   }
+
+   cindices.resize( cbegin[n] );
+   std::vector<size_t> pos( cbegin.begin(), cbegin.end()-1L );
+
+   traverse( ~A, [this,&cindices,&pos]( size_t major, size_t minor, const auto& ) {
+      if( major != minor ) {
+         const size_t i( iperm_[major] );
+         const size_t j( iperm_[minor] );
+         cindices[pos[min( i, j )]++] = max( i, j );
+      }
+   } );
+
+   // Transposition into the sorted compressed row storage
+   begin.assign( n+1UL, 0UL );
+   indices.resize( cbegin[n] );
+
+   for( size_t k=0UL; k<cbegin[n]; ++k ) {
+      ++begin[cindices[k]+1UL];
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      begin[i+1UL] += begin[i];
+   }
+
+   pos.assign( begin.begin(), begin.end()-1L );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t k=cbegin[j]; k<cbegin[j+1UL]; ++k ) {
+         indices[pos[cindices[k]]++] = j;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the elimination tree of the permuted matrix.
+//
+// \param begin The begin of each row of the strictly lower pattern.
+// \param indices The column indices of the strictly lower pattern.
+// \param parent The resulting parent of each column (\a n for the roots).
+// \return void
+//
+// This function computes the elimination tree by means of Liu's algorithm with path compression.
+*/
+template< typename Type >  // Data type of the factor
+void SparseCholeskySolver<Type>::eliminationTree( const std::vector<size_t>& begin,
+                                                  const std::vector<size_t>& indices,
+                                                  std::vector<size_t>& parent ) const
+{
+   const size_t n( size() );
+
+   std::vector<size_t> ancestor( n, n );
+
+   parent.assign( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t k=begin[i]; k<begin[i+1UL]; ++k ) {
+         for( size_t j=indices[k], next; j<i; j=next ) {
+            next = ancestor[j];
+            ancestor[j] = i;
+            if( next == n ) parent[j] = i;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Partitions the columns of the factor into supernodes.
+//
+// \param parent The elimination tree of the postordered matrix.
+// \param counts The number of non-zero elements of each column of the factor.
+// \return void
+//
+// This function partitions the columns of the factor into chains of consecutive columns, where
+// each column is the parent of its predecessor. Since the pattern of a column is contained in
+// the pattern of its parent, the pattern of a supernode is given by the pattern of its last
+// column. A column is merged with its child in case their patterns are identical. Additionally,
+// small supernodes are amalgamated as long as the fraction of explicit zeros stays small.
+*/
+template< typename Type >  // Data type of the factor
+void SparseCholeskySolver<Type>::partition( const std::vector<size_t>& parent,
+                                            const std::vector<size_t>& counts )
+{
+   const size_t n( size() );
+
+   std::vector<size_t> children( n+1UL, 0UL );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      ++children[parent[j]];
+   }
+
+   first_.assign( 1UL, 0UL );
+
+   size_t f( 0UL );
+   size_t nonzeros( n > 0UL ? counts[0] : 0UL );
+
+   for( size_t j=1UL; j<n; ++j )
+   {
+      const size_t w( j - f + 1UL );
+      const size_t m( w - 1UL + counts[j] );
+      const size_t stored( w*m - ( w*(w-1UL) )/2UL );
+      const double zeros( double( stored - nonzeros - counts[j] ) / stored );
+
+      const bool merge( parent[j-1UL] == j &&
+                        ( ( children[j] == 1UL && counts[j-1UL] == counts[j] + 1UL ) ||
+                          w <= 4UL || ( w <= 16UL && zeros < 0.8 ) ||
+                          ( w <= 48UL && zeros < 0.1 ) || zeros < 0.05 ) );
+
+      if( merge ) {
+         nonzeros += counts[j];
+      }
+      else {
+         first_.push_back( j );
+         f = j;
+         nonzeros = counts[j];
+      }
+   }
+
+   if( n > 0UL ) {
+      first_.push_back( n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the row indices and the storage layout of all supernodes.
+//
+// \param begin The begin of each row of the strictly lower pattern.
+// \param indices The column indices of the strictly lower pattern.
+// \param parent The elimination tree of the postordered matrix.
+// \param snode The resulting supernode of each column.
+// \return void
+//
+// The row indices of a supernode are given by its columns and the union of the rows below its
+// columns of all its columns within the permuted matrix and all its child supernodes.
+*/
+template< typename Type >  // Data type of the factor
+void SparseCholeskySolver<Type>::structure( const std::vector<size_t>& begin,
+                                            const std::vector<size_t>& indices,
+                                            const std::vector<size_t>& parent,
+                                            std::vector<size_t>& snode )
+{
+   const size_t n( size() );
+   const size_t N( supernodes() );
+
+   snode.resize( n );
+
+   for( size_t J=0UL; J<N; ++J ) {
+      for( size_t j=first_[J]; j<first_[J+1UL]; ++j ) {
+         snode[j] = J;
+      }
+   }
+
+   // Computation of the lists of child supernodes
+   std::vector<size_t> head( N, N ), next( N, N );
+
+   for( size_t J=N; J-- > 0UL; ) {
+      const size_t p( parent[first_[J+1UL]-1UL] );
+      if( p != n ) {
+         next[J] = head[snode[p]];
+         head[snode[p]] = J;
+      }
+   }
+
+   // Computation of the pattern in compressed column storage
+   std::vector<size_t> cbegin( n+1UL, 0UL ), cindices( indices.size() );
+
+   for( size_t k=0UL; k<indices.size(); ++k ) {
+      ++cbegin[indices[k]+1UL];
+   }
+
+   for( size_t j=0UL; j<n; ++j ) {
+      cbegin[j+1UL] += cbegin[j];
+   }
+
+   std::vector<size_t> pos( cbegin.begin(), cbegin.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t k=begin[i]; k<begin[i+1UL]; ++k ) {
+         cindices[pos[indices[k]]++] = i;
+      }
+   }
+
+   // Computation of the row indices of all supernodes
+   std::vector<size_t> mark( n, N );
+
+   rowBegin_.assign( 1UL, 0UL );
+   valueBegin_.assign( 1UL, 0UL );
+   rows_.clear();
+   nonZeros_ = 0UL;
+
+   for( size_t J=0UL; J<N; ++J )
+   {
+      const size_t f( first_[J] );
+      const size_t l( first_[J+1UL] );
+
+      for( size_t j=f; j<l; ++j ) {
+         rows_.push_back( j );
+         mark[j] = J;
+      }
+
+      const size_t below( rows_.size() );
+
+      for( size_t j=f; j<l; ++j ) {
+         for( size_t k=cbegin[j]; k<cbegin[j+1UL]; ++k ) {
+            if( mark[cindices[k]] != J ) {
+               mark[cindices[k]] = J;
+               rows_.push_back( cindices[k] );
+            }
+         }
+      }
+
+      for( size_t K=head[J]; K!=N; K=next[K] ) {
+         for( size_t k=rowBegin_[K]+first_[K+1UL]-first_[K]; k<rowBegin_[K+1UL]; ++k ) {
+            if( mark[rows_[k]] != J ) {
+               mark[rows_[k]] = J;
+               rows_.push_back( rows_[k] );
+            }
+         }
+      }
+
+      std::sort( rows_.begin()+below, rows_.end() );
+
+      const size_t w( l - f );
+      const size_t m( rows_.size() - rowBegin_.back() );
+
+      rowBegin_.push_back( rows_.size() );
+      valueBegin_.push_back( valueBegin_.back() + m*w );
+      nonZeros_ += w*m - ( w*(w-1UL) )/2UL;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the updates between the supernodes and the level schedule of the decomposition.
+//
+// \param snode The supernode of each column.
+// \return void
+//
+// Supernode \a K updates supernode \a J in case \a K contains a row within the columns of \a J.
+// The rows of \a K are sorted and the columns of each supernode are contiguous, therefore the
+// rows updating \a J form a contiguous range, which is represented by its first row. Each
+// supernode is assigned to the level following the maximum level of all its updating supernodes,
+// i.e. all supernodes of a level can be decomposed concurrently.
+*/
+template< typename Type >  // Data type of the factor
+void SparseCholeskySolver<Type>::schedule( const std::vector<size_t>& snode )
+{
+   const size_t N( supernodes() );
+
+   updateBegin_.assign( N+1UL, 0UL );
+
+   for( size_t K=0UL; K<N; ++K ) {
+      for( size_t k=rowBegin_[K]+first_[K+1UL]-first_[K]; k<rowBegin_[K+1UL]; ) {
+         const size_t J( snode[rows_[k]] );
+         ++updateBegin_[J+1UL];
+         while( k < rowBegin_[K+1UL] && rows_[k] < first_[J+1UL] ) ++k;
+      }
+   }
+
+   for( size_t J=0UL; J<N; ++J ) {
+      updateBegin_[J+1UL] += updateBegin_[J];
+   }
+
+   sources_.resize( updateBegin_[N] );
+   offsets_.resize( updateBegin_[N] );
+
+   std::vector<size_t> pos( updateBegin_.begin(), updateBegin_.end()-1L );
+
+   for( size_t K=0UL; K<N; ++K ) {
+      for( size_t k=rowBegin_[K]+first_[K+1UL]-first_[K]; k<rowBegin_[K+1UL]; ) {
+         const size_t J( snode[rows_[k]] );
+         sources_[pos[J]] = K;
+         offsets_[pos[J]] = k - rowBegin_[K];
+         ++pos[J];
+         while( k < rowBegin_[K+1UL] && rows_[k] < first_[J+1UL] ) ++k;
+      }
+   }
+
+   // Computation of the levels of all supernodes
+   std::vector<size_t> level( N, 0UL );
+   size_t levels( N > 0UL ? 1UL : 0UL );
+
+   for( size_t J=0UL; J<N; ++J ) {
+      for( size_t u=updateBegin_[J]; u<updateBegin_[J+1UL]; ++u ) {
+         level[J] = max( level[J], level[sources_[u]]+1UL );
+      }
+      levels = max( levels, level[J]+1UL );
+   }
+
+   levelBegin_.assign( levels+1UL, 0UL );
+   levels_.resize( N );
+
+   std::vector<size_t> work( levels, 0UL );
+
+   for( size_t J=0UL; J<N; ++J ) {
+      ++levelBegin_[level[J]+1UL];
+      work[level[J]] += valueBegin_[J+1UL] - valueBegin_[J];
+   }
+
+   maxWork_ = 0UL;
+
+   for( size_t l=0UL; l<levels; ++l ) {
+      if( levelBegin_[l+1UL] > 1UL ) {
+         maxWork_ = max( maxWork_, work[l] );
+      }
+      levelBegin_[l+1UL] += levelBegin_[l];
+   }
+
+   pos.assign( levelBegin_.begin(), levelBegin_.end()-1L );
+
+   for( size_t J=0UL; J<N; ++J ) {
+      levels_[pos[level[J]]++] = J;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether any level of the decomposition can be processed in parallel.
+//
+// \return \a true in case at least one level is processed in parallel, \a false if not.
+*/
+template< typename Type >  // Data type of the factor
+bool SparseCholeskySolver<Type>::isParallel() const
+{
+   return getNumThreads() > 1UL && !isSerialSectionActive() && !isParallelSectionActive() &&
+          maxWork_ >= SMP_SMATLLH_THRESHOLD;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric decomposition of a single supernode.
+//
+// \param J The index of the supernode.
+// \param W The workspace for the dense updates.
+// \param rel The workspace for the relative row indices of the updates.
+// \return \a true in case of success, \a false in case of a non-positive pivot.
+//
+// This function applies the updates of all previous supernodes to supernode \a J and decomposes
+// it. Each update \f$ L_{K,2}*L_{K,1}^H \f$ is computed by a dense matrix multiplication and is
+// subsequently subtracted from the corresponding rows and columns of \a J. Afterwards the diagonal
+// block is decomposed by the dense Cholesky decomposition and the remaining rows are computed by
+// a dense triangular solve. The function is thread-safe for supernodes of the same level.
+*/
+template< typename Type >  // Data type of the factor
+bool SparseCholeskySolver<Type>::decompose( size_t J, WorkspaceType& W, std::vector<size_t>& rel )
+{
+   const size_t f( first_[J] );
+   const size_t w( first_[J+1UL] - f );
+   const size_t m( rowBegin_[J+1UL] - rowBegin_[J] );
+
+   Type* const LJ( values_.data() + valueBegin_[J] );
+   const size_t* const rowsJ( rows_.data() + rowBegin_[J] );
+
+   for( size_t u=updateBegin_[J]; u<updateBegin_[J+1UL]; ++u )
+   {
+      const size_t K ( sources_[u] );
+      const size_t p ( offsets_[u] );
+      const size_t wK( first_[K+1UL] - first_[K] );
+      const size_t mK( rowBegin_[K+1UL] - rowBegin_[K] );
+
+      Type* const LK( values_.data() + valueBegin_[K] );
+      const size_t* const rowsK( rows_.data() + rowBegin_[K] );
+
+      size_t q( p );
+      while( q < mK && rowsK[q] < f+w ) ++q;
+
+      const BlockType     L1( LK+p, mK-p, wK, mK );
+      const TransposeType L2( LK+p, wK, q-p, mK );
+
+      if( IsComplex<Type>::value )
+         W = L1 * conj( L2 );
+      else
+         W = L1 * L2;
+
+      rel.resize( mK-p );
+
+      for( size_t t=0UL, r=0UL; t<mK-p; ++t ) {
+         while( rowsJ[r] != rowsK[p+t] ) ++r;
+         rel[t] = r;
+      }
+
+      for( size_t c=0UL; c<q-p; ++c ) {
+         Type* const column( LJ + rel[c]*m );
+         for( size_t t=c; t<mK-p; ++t ) {
+            column[rel[t]] -= W(t,c);
+         }
+      }
+   }
+
+   int info( 0 );
+   potrf( 'L', int( w ), LJ, int( m ), &info );
+
+   if( info != 0 ) {
+      return false;
+   }
+
+   solvePanel( LJ, w, m );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the rows of a supernode below its diagonal block.
+//
+// \param LJ Pointer to the first element of the decomposed supernode.
+// \param w The number of columns of the supernode.
+// \param m The number of rows of the supernode.
+// \return void
+//
+// This function solves \f$ L_{21}*L_{11}^H = A_{21} \f$ for the rows of the supernode below the
+// decomposed diagonal block \f$ L_{11} \f$. In contrast to a general triangular solve, the
+// columns of the column-major block are processed as contiguous vectors: Within a block of
+// LAPACK_BLOCK_SIZE columns, each column is scaled and subtracted from the following columns,
+// the remaining columns are updated by a dense matrix multiplication.
+*/
+template< typename Type >  // Data type of the factor
+void SparseCholeskySolver<Type>::solvePanel( Type* LJ, size_t w, size_t m )
+{
+   if( m == w ) return;
+
+   for( size_t jj=0UL; jj<w; jj+=LAPACK_BLOCK_SIZE )
+   {
+      const size_t jb( min( LAPACK_BLOCK_SIZE, w-jj ) );
+
+      for( size_t j=jj; j<jj+jb; ++j )
+      {
+         ColumnType xj( LJ+j*m+w, m-w );
+         xj *= Type(1) / LJ[j*m+j];
+
+         for( size_t i=j+1UL; i<jj+jb; ++i ) {
+            ColumnType xi( LJ+i*m+w, m-w );
+            xi -= conj( LJ[j*m+i] ) * xj;
+         }
+      }
+
+      if( jj+jb == w ) continue;
+
+      BlockType       X2( LJ+(jj+jb)*m+w, m-w, w-jj-jb, m );
+      const BlockType X1( LJ+jj*m+w, m-w, jb, m );
+      const BlockType L ( LJ+jj*m+jj+jb, w-jj-jb, jb, m );
+
+      X2 -= X1 * ctrans( L );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Forward and backward substitution with the Cholesky factor.
+//
+// \param Y Pointer to the first element of the column-major right-hand side matrix.
+// \param k The number of right-hand sides.
+// \param ldy The total number of elements between two columns of \a Y.
+// \return void
+//
+// This function overwrites the permuted right-hand sides \a Y with the solution of the system
+// \f$ L*L^H*Y = Y \f$. For each supernode, the diagonal block is solved by a dense triangular
+// solve and the remaining rows are updated by a dense matrix multiplication.
+*/
+template< typename Type >  // Data type of the factor
+void SparseCholeskySolver<Type>::substitute( Type* Y, size_t k, size_t ldy ) const
+{
+   const size_t N( supernodes() );
+
+   WorkspaceType T;
+
+   // Forward substitution (L*Z = Y)
+   for( size_t J=0UL; J<N; ++J )
+   {
+      const size_t f( first_[J] );
+      const size_t w( first_[J+1UL] - f );
+      const size_t m( rowBegin_[J+1UL] - rowBegin_[J] );
+
+      const Type* const LJ( values_.data() + valueBegin_[J] );
+      const size_t* const rowsJ( rows_.data() + rowBegin_[J] );
+
+      trsmKernel<columnMajor,columnMajor>( true, false, false, w, k, LJ, m, Y+f, ldy );
+
+      if( m == w ) continue;
+
+      const BlockType L21( const_cast<Type*>( LJ )+w, m-w, w, m );
+      const BlockType Y1 ( Y+f, w, k, ldy );
+
+      T = L21 * Y1;
+
+      for( size_t j=0UL; j<k; ++j ) {
+         for( size_t i=0UL; i<m-w; ++i ) {
+            Y[rowsJ[w+i]+j*ldy] -= T(i,j);
+         }
+      }
+   }
+
+   // Backward substitution (L^H*Y = Z)
+   for( size_t J=N; J-- > 0UL; )
+   {
+      const size_t f( first_[J] );
+      const size_t w( first_[J+1UL] - f );
+      const size_t m( rowBegin_[J+1UL] - rowBegin_[J] );
+
+      const Type* const LJ( values_.data() + valueBegin_[J] );
+      const size_t* const rowsJ( rows_.data() + rowBegin_[J] );
+
+      if( m > w )
+      {
+         T.resize( m-w, k, false );
+
+         for( size_t j=0UL; j<k; ++j ) {
+            for( size_t i=0UL; i<m-w; ++i ) {
+               T(i,j) = Y[rowsJ[w+i]+j*ldy];
+            }
+         }
+
+         const BlockType L21( const_cast<Type*>( LJ )+w, m-w, w, m );
+         BlockType Y1( Y+f, w, k, ldy );
+
+         Y1 -= ctrans( L21 ) * T;
+      }
+
+      trsmKernel<rowMajor,columnMajor>( false, false, true, w, k, LJ, m, Y+f, ldy );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
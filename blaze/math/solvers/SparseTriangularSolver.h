@@ -0,0 +1,605 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SparseTriangularSolver.h
+//  \brief Header file for the level-scheduled sparse triangular solver
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SPARSETRIANGULARSOLVER_H_
+#define _BLAZE_MATH_SOLVERS_SPARSETRIANGULARSOLVER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/LevelSchedule.h>
+#include <blaze/math/solvers/PreconditionerKernels.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUniTriangular.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level-scheduled solver for sparse triangular systems of equations.
+// \ingroup solvers
+//
+// The SparseTriangularSolver class template solves the linear system \f$ A*x=b \f$ (or
+// \f$ A*X=B \f$ for multiple right-hand sides) for a sparse lower or upper triangular matrix
+// \a A by means of a forward or backward substitution. The triangular matrix can be given as
+// a blaze::LowerMatrix, blaze::UniLowerMatrix, blaze::UpperMatrix, or blaze::UniUpperMatrix
+// adapting a sparse matrix, or as any other sparse matrix expression with a compile time lower
+// or upper triangular property (as for instance a decllow() or declupp() expression):
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::DynamicVector<double> x, b;
+   blaze::DynamicMatrix<double> X, B;
+   // ... Resizing and initialization
+
+   blaze::SparseTriangularSolver<double> solver( L );  // Analysis of the triangular matrix
+
+   solver.solve( b, x );  // Solving a single right-hand side
+   solver.solve( B, X );  // Solving multiple right-hand sides (one per column of B)
+   \endcode
+
+// The construction of the solver (or a call to the compute() function) copies the triangular
+// matrix and analyzes the dependencies between its rows (see the LevelSchedule class). This
+// analysis is performed only once and reused for all subsequent solves. The rows within a level
+// of the schedule are independent of each other and are processed in parallel by means of the
+// active shared memory parallelization in case the level contains at least
+// SMP_SMATTRSV_THRESHOLD rows. In case only the values of the triangular matrix change, the
+// update() function replaces the values without repeating the analysis:
+
+   \code
+   for( ... ) {
+      // ... Updating the values of L
+      solver.update( L );  // Numeric update only
+      solver.solve( b, x );
+   }
+   \endcode
+
+// Note that the diagonal elements of a (non-unitriangular) matrix are required to be non-zero.
+// Strictly triangular matrices cannot be used since they are always singular.
+*/
+template< typename Type >  // Data type of the triangular matrix
+class SparseTriangularSolver
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                             //!< Data type of the triangular matrix.
+   using MatrixType  = CompressedMatrix<Type,rowMajor>;  //!< Type of the matrix storage.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SparseTriangularSolver();
+
+   template< typename MT, bool SO >
+   explicit inline SparseTriangularSolver( const SparseMatrix<MT,SO>& A );
+
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Solve functions*****************************************************************************
+   /*!\name Solve functions */
+   //@{
+   template< typename VT1, typename VT2 >
+   void solve( const DenseVector<VT1,columnVector>& b, DenseVector<VT2,columnVector>& x ) const;
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   void solve( const DenseMatrix<MT1,SO1>& B, DenseMatrix<MT2,SO2>& X ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t               size    () const noexcept;
+   inline bool                 isLower () const noexcept;
+   inline bool                 isUpper () const noexcept;
+   inline const MatrixType&    matrix  () const noexcept;
+   inline const LevelSchedule& schedule() const noexcept;
+
+   template< typename MT, bool SO >
+   void compute( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void update( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void invertDiagonal();
+
+   template< typename VT >
+   void substitute( DenseVector<VT,columnVector>& x ) const;
+
+   template< typename MT >
+   void substitute( DenseMatrix<MT,rowMajor>& X ) const;
+
+   template< typename MT >
+   void substitute( DenseMatrix<MT,columnMajor>& X ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MatrixType                       A_;         //!< The copy of the triangular matrix.
+   DynamicVector<Type,columnVector> inverse_;   //!< The inverted diagonal of the matrix.
+   LevelSchedule                    schedule_;  //!< The schedule of the substitution.
+   bool                             upper_;     //!< \a true in case of an upper triangular matrix.
+   bool                             unit_;      //!< \a true in case of a unitriangular matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseTriangularSolver.
+*/
+template< typename Type >  // Data type of the triangular matrix
+inline SparseTriangularSolver<Type>::SparseTriangularSolver()
+   : A_       ()         // The copy of the triangular matrix
+   , inverse_ ()         // The inverted diagonal of the matrix
+   , schedule_()         // The schedule of the substitution
+   , upper_   ( false )  // true in case of an upper triangular matrix
+   , unit_    ( false )  // true in case of a unitriangular matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructs the solver for the given sparse triangular matrix.
+//
+// \param A The sparse lower or upper triangular matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename Type >  // Data type of the triangular matrix
+template< typename MT      // Type of the triangular matrix
+        , bool SO >        // Storage order of the triangular matrix
+inline SparseTriangularSolver<Type>::SparseTriangularSolver( const SparseMatrix<MT,SO>& A )
+   : A_       ()         // The copy of the triangular matrix
+   , inverse_ ()         // The inverted diagonal of the matrix
+   , schedule_()         // The schedule of the substitution
+   , upper_   ( false )  // true in case of an upper triangular matrix
+   , unit_    ( false )  // true in case of a unitriangular matrix
+{
+   compute( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solves the triangular system for a single right-hand side (\f$ x = A^{-1}*b \f$).
+//
+// \param b The right-hand side vector.
+// \param x The resulting solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// The solution vector \a x is resized to the size of the triangular matrix. It is allowed to
+// pass the same vector as \a b and \a x. In case the size of the right-hand side vector doesn't
+// match the size of the triangular matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the triangular matrix
+template< typename VT1     // Type of the right-hand side vector
+        , typename VT2 >   // Type of the solution vector
+void SparseTriangularSolver<Type>::solve( const DenseVector<VT1,columnVector>& b,
+                                          DenseVector<VT2,columnVector>& x ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~b).size() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   resize( ~x, size(), false );
+   ~x = ~b;
+
+   substitute( ~x );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the triangular system for multiple right-hand sides (\f$ X = A^{-1}*B \f$).
+//
+// \param B The right-hand side matrix (one right-hand side per column).
+// \param X The resulting solution matrix.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// The solution matrix \a X is resized to the size of the right-hand side matrix. It is allowed
+// to pass the same matrix as \a B and \a X. For a row-major solution matrix all right-hand sides
+// are processed within a single substitution, for a column-major solution matrix the columns are
+// processed one after another. In case the number of rows of the right-hand side matrix doesn't
+// match the size of the triangular matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the triangular matrix
+template< typename MT1     // Type of the right-hand side matrix
+        , bool SO1         // Storage order of the right-hand side matrix
+        , typename MT2     // Type of the solution matrix
+        , bool SO2 >       // Storage order of the solution matrix
+void SparseTriangularSolver<Type>::solve( const DenseMatrix<MT1,SO1>& B,
+                                          DenseMatrix<MT2,SO2>& X ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~B).rows() != size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   resize( ~X, (~B).rows(), (~B).columns(), false );
+   ~X = ~B;
+
+   substitute( ~X );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the triangular matrix.
+//
+// \return The number of rows and columns of the triangular matrix.
+*/
+template< typename Type >  // Data type of the triangular matrix
+inline size_t SparseTriangularSolver<Type>::size() const noexcept
+{
+   return A_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the solver performs a forward substitution with a lower triangular matrix.
+//
+// \return \a true in case of a lower triangular matrix, \a false if not.
+*/
+template< typename Type >  // Data type of the triangular matrix
+inline bool SparseTriangularSolver<Type>::isLower() const noexcept
+{
+   return !upper_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the solver performs a backward substitution with an upper triangular matrix.
+//
+// \return \a true in case of an upper triangular matrix, \a false if not.
+*/
+template< typename Type >  // Data type of the triangular matrix
+inline bool SparseTriangularSolver<Type>::isUpper() const noexcept
+{
+   return upper_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the row-major copy of the triangular matrix.
+//
+// \return The copy of the triangular matrix.
+*/
+template< typename Type >  // Data type of the triangular matrix
+inline const typename SparseTriangularSolver<Type>::MatrixType&
+   SparseTriangularSolver<Type>::matrix() const noexcept
+{
+   return A_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the level schedule of the substitution.
+//
+// \return The level schedule of the forward or backward substitution.
+*/
+template< typename Type >  // Data type of the triangular matrix
+inline const LevelSchedule& SparseTriangularSolver<Type>::schedule() const noexcept
+{
+   return schedule_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Analyzes the given sparse triangular matrix.
+//
+// \param A The sparse lower or upper triangular matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function copies the given triangular matrix and computes the level schedule of the
+// forward (lower triangular matrix) or backward (upper triangular matrix) substitution. In case
+// the given matrix is not a square matrix, a \a std::invalid_argument exception is thrown. In
+// case a diagonal element of a non-unitriangular matrix is zero, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the triangular matrix
+template< typename MT      // Type of the triangular matrix
+        , bool SO >        // Storage order of the triangular matrix
+void SparseTriangularSolver<Type>::compute( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   BLAZE_FUNCTION_TRACE;
+
+   upper_ = !IsLower<MT>::value;
+   unit_  = IsUniTriangular<MT>::value;
+
+   copyPattern( ~A, A_, !upper_ );
+
+   if( upper_ )
+      schedule_.analyzeUpper( A_ );
+   else
+      schedule_.analyzeLower( A_ );
+
+   invertDiagonal();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Updates the values of the triangular matrix for a matrix with the same sparsity pattern.
+//
+// \param A The sparse lower or upper triangular matrix.
+// \return void
+// \exception std::invalid_argument Invalid sparsity pattern.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function replaces the values of the copied triangular matrix by reusing its storage and
+// the level schedule of the substitution. Therefore the given matrix is required to be of the
+// same triangular kind and to have the identical sparsity pattern as the matrix passed to the
+// last call of the compute() function. Otherwise a \a std::invalid_argument exception is thrown.
+// In case a diagonal element of a non-unitriangular matrix is zero, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the triangular matrix
+template< typename MT      // Type of the triangular matrix
+        , bool SO >        // Storage order of the triangular matrix
+void SparseTriangularSolver<Type>::update( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   BLAZE_FUNCTION_TRACE;
+
+   if( ( upper_ && !IsUpper<MT>::value ) || ( !upper_ && !IsLower<MT>::value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern" );
+   }
+
+   unit_ = IsUniTriangular<MT>::value;
+
+   copyValues( ~A, A_, !upper_ );
+   invertDiagonal();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inverts the diagonal elements of the copied triangular matrix.
+//
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// In case of a unitriangular matrix the diagonal elements are not accessed.
+*/
+template< typename Type >  // Data type of the triangular matrix
+void SparseTriangularSolver<Type>::invertDiagonal()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( unit_ ) {
+      inverse_.clear();
+      return;
+   }
+
+   const size_t n( A_.rows() );
+
+   inverse_.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto element( A_.find( i, i ) );
+
+      if( element == A_.end(i) || isDefault( element->value() ) ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+      }
+
+      inverse_[i] = Type(1) / element->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs the substitution in place of the given vector.
+//
+// \param x The right-hand side vector, overwritten by the solution.
+// \return void
+*/
+template< typename Type >  // Data type of the triangular matrix
+template< typename VT >    // Type of the vector
+void SparseTriangularSolver<Type>::substitute( DenseVector<VT,columnVector>& x ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_<VT>;
+
+   VT& y( ~x );
+
+   schedule_.execute( [this,&y]( size_t i )
+   {
+      const auto begin( upper_ ? A_.upperBound(i,i) : A_.begin(i) );
+      const auto end  ( upper_ ? A_.end(i) : A_.lowerBound(i,i) );
+
+      ET sum( y[i] );
+      for( auto element=begin; element!=end; ++element ) {
+         sum -= element->value() * y[element->index()];
+      }
+      y[i] = unit_ ? sum : sum * inverse_[i];
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs the substitution in place of the given row-major matrix.
+//
+// \param X The right-hand side matrix, overwritten by the solution.
+// \return void
+//
+// All right-hand sides are processed within a single substitution, i.e. each row of the
+// triangular matrix is traversed only once.
+*/
+template< typename Type >  // Data type of the triangular matrix
+template< typename MT >    // Type of the matrix
+void SparseTriangularSolver<Type>::substitute( DenseMatrix<MT,rowMajor>& X ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   MT& Y( ~X );
+
+   const size_t m( Y.columns() );
+
+   schedule_.execute( [this,&Y,m]( size_t i )
+   {
+      const auto begin( upper_ ? A_.upperBound(i,i) : A_.begin(i) );
+      const auto end  ( upper_ ? A_.end(i) : A_.lowerBound(i,i) );
+
+      for( auto element=begin; element!=end; ++element ) {
+         const size_t j( element->index() );
+         for( size_t k=0UL; k<m; ++k ) {
+            Y(i,k) -= element->value() * Y(j,k);
+         }
+      }
+
+      if( !unit_ ) {
+         for( size_t k=0UL; k<m; ++k ) {
+            Y(i,k) *= inverse_[i];
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs the substitution in place of the given column-major matrix.
+//
+// \param X The right-hand side matrix, overwritten by the solution.
+// \return void
+//
+// The columns of the matrix are processed one after another.
+*/
+template< typename Type >  // Data type of the triangular matrix
+template< typename MT >    // Type of the matrix
+void SparseTriangularSolver<Type>::substitute( DenseMatrix<MT,columnMajor>& X ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t k=0UL; k<(~X).columns(); ++k ) {
+      auto x( column( ~X, k ) );
+      substitute( x );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
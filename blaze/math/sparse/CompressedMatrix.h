@@ -575,11 +575,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                                                 // The current number of rows of the compressed matrix
+   , n_       ( n )                                                 // The current number of columns of the compressed matrix
+   , capacity_( m )                                                 // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*m+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                                       // Pointers one past the last non-zero element of each row
 {
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = nullptr;
@@ -599,13 +599,13 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
-   , capacity_( m )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                                                 // The current number of rows of the compressed matrix
+   , n_       ( n )                                                 // The current number of columns of the compressed matrix
+   , capacity_( m )                                                 // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*m+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m+1UL) )                                       // Pointers one past the last non-zero element of each row
 {
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
    for( size_t i=1UL; i<(2UL*m_+1UL); ++i )
       begin_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
@@ -627,11 +627,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the compressed matrix
-   , n_       ( n )                      // The current number of columns of the compressed matrix
-   , capacity_( m )                      // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( m )                                                  // The current number of rows of the compressed matrix
+   , n_       ( n )                                                  // The current number of columns of the compressed matrix
+   , capacity_( m )                                                  // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*m_+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m_+1UL) )                                       // Pointers one past the last non-zero element of each row
 {
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
 
@@ -639,7 +639,7 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
    for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
       newCapacity += *it;
 
-   begin_[0UL] = end_[0UL] = allocate<Element>( newCapacity );
+   begin_[0UL] = end_[0UL] = allocate<Element>( newCapacity, sparseMatrixMemory );
    for( size_t i=0UL; i<m_; ++i ) {
       begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
    }
@@ -655,15 +655,15 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
-   : m_       ( sm.m_ )                  // The current number of rows of the compressed matrix
-   , n_       ( sm.n_ )                  // The current number of columns of the compressed matrix
-   , capacity_( sm.m_ )                  // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( sm.m_ )                                              // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )                                              // The current number of columns of the compressed matrix
+   , capacity_( sm.m_ )                                              // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*m_+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each row
+   , end_  ( begin_+(m_+1UL) )                                       // Pointers one past the last non-zero element of each row
 {
    const size_t nonzeros( sm.nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
    for( size_t i=0UL; i<m_; ++i ) {
       end_[i] = castDown( std::copy( sm.begin(i), sm.end(i), castUp( begin_[i] ) ) );
       begin_[i+1UL] = end_[i];
@@ -706,11 +706,11 @@ template< typename Type  // Data type of the matrix
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the compressed matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the compressed matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( (~dm).rows() )                                          // The current number of rows of the compressed matrix
+   , n_       ( (~dm).columns() )                                       // The current number of columns of the compressed matrix
+   , capacity_( m_ )                                                    // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*m_+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                                       // Pointers one past the last non-zero element of each row
 {
    using blaze::assign;
 
@@ -732,17 +732,17 @@ template< typename Type  // Data type of the matrix
 template< typename MT    // Type of the foreign compressed matrix
         , bool SO2 >     // Storage order of the foreign compressed matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the compressed matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the compressed matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( (~sm).rows() )                                          // The current number of rows of the compressed matrix
+   , n_       ( (~sm).columns() )                                       // The current number of columns of the compressed matrix
+   , capacity_( m_ )                                                    // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*m_+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                                       // Pointers one past the last non-zero element of each row
 {
    using blaze::assign;
 
    const size_t nonzeros( (~sm).nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
    for( size_t i=0UL; i<m_; ++i )
       begin_[i+1UL] = end_[i] = begin_[0UL];
    end_[m_] = begin_[0UL]+nonzeros;
@@ -769,7 +769,7 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
-      delete[] begin_;
+      deallocate( begin_ );
    }
 }
 //*************************************************************************************************
@@ -1053,10 +1053,10 @@ inline CompressedMatrix<Type,SO>&
 
    if( rhs.m_ > capacity_ || nonzeros > capacity() )
    {
-      Iterator* newBegin( new Iterator[2UL*rhs.m_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*rhs.m_+2UL, sparseMatrixMemory ) );
       Iterator* newEnd  ( newBegin+(rhs.m_+1UL) );
 
-      newBegin[0UL] = allocate<Element>( nonzeros );
+      newBegin[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
       for( size_t i=0UL; i<rhs.m_; ++i ) {
          newEnd[i] = castDown( std::copy( rhs.begin_[i], rhs.end_[i], castUp( newBegin[i] ) ) );
          newBegin[i+1UL] = newEnd[i];
@@ -1069,7 +1069,7 @@ inline CompressedMatrix<Type,SO>&
 
       if( newBegin != nullptr ) {
          deallocate( newBegin[0UL] );
-         delete[] newBegin;
+         deallocate( newBegin );
       }
    }
    else {
@@ -1100,7 +1100,7 @@ inline CompressedMatrix<Type,SO>&
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
-      delete[] begin_;
+      deallocate( begin_ );
    }
 
    m_        = rhs.m_;
@@ -1599,7 +1599,7 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 
    if( begin_ == nullptr )
    {
-      begin_ = new Iterator[2UL*m+2UL];
+      begin_ = allocate<Iterator>( 2UL*m+2UL, sparseMatrixMemory );
       end_   = begin_+m+1UL;
 
       for( size_t i=0UL; i<2UL*m+2UL; ++i ) {
@@ -1610,7 +1610,7 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    }
    else if( m > capacity_ )
    {
-      Iterator* newBegin( new Iterator[2UL*m+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*m+2UL, sparseMatrixMemory ) );
       Iterator* newEnd  ( newBegin+m+1UL );
 
       newBegin[0UL] = begin_[0UL];
@@ -1633,7 +1633,7 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       newEnd[m] = end_[m_];
 
       std::swap( newBegin, begin_ );
-      delete[] newBegin;
+      deallocate( newBegin );
       end_ = newEnd;
       capacity_ = m;
    }
@@ -1727,10 +1727,10 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
       const size_t newCapacity( begin_[m_] - begin_[0UL] + additional );
       BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
 
-      Iterator* newBegin( new Iterator[2UL*m_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*m_+2UL, sparseMatrixMemory ) );
       Iterator* newEnd  ( newBegin+m_+1UL );
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate<Element>( newCapacity, sparseMatrixMemory );
       newEnd  [m_ ] = newBegin[0UL]+newCapacity;
 
       for( size_t k=0UL; k<i; ++k ) {
@@ -1748,7 +1748,7 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 
       std::swap( newBegin, begin_ );
       deallocate( newBegin[0UL] );
-      delete[] newBegin;
+      deallocate( newBegin );
       end_ = newEnd;
       capacity_ = m_;
    }
@@ -1882,10 +1882,10 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 {
-   Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+   Iterator* newBegin = allocate<Iterator>( 2UL*capacity_+2UL, sparseMatrixMemory );
    Iterator* newEnd   = newBegin+capacity_+1UL;
 
-   newBegin[0UL] = allocate<Element>( nonzeros );
+   newBegin[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
 
    for( size_t k=0UL; k<m_; ++k ) {
       BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row pointers" );
@@ -1900,7 +1900,7 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 
    if( newBegin != nullptr ) {
       deallocate( newBegin[0UL] );
-      delete[] newBegin;
+      deallocate( newBegin );
    }
 }
 //*************************************************************************************************
@@ -2052,10 +2052,10 @@ typename CompressedMatrix<Type,SO>::Iterator
    else {
       size_t newCapacity( extendCapacity() );
 
-      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+      Iterator* newBegin = allocate<Iterator>( 2UL*capacity_+2UL, sparseMatrixMemory );
       Iterator* newEnd   = newBegin+capacity_+1UL;
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate<Element>( newCapacity, sparseMatrixMemory );
 
       for( size_t k=0UL; k<i; ++k ) {
          const size_t nonzeros( end_[k] - begin_[k] );
@@ -2082,7 +2082,7 @@ typename CompressedMatrix<Type,SO>::Iterator
       std::swap( newBegin, begin_ );
       end_ = newEnd;
       deallocate( newBegin[0UL] );
-      delete[] newBegin;
+      deallocate( newBegin );
 
       return tmp;
    }
@@ -3355,11 +3355,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 */
 template< typename Type >  // Data type of the matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( m )                                                 // The current number of rows of the compressed matrix
+   , n_       ( n )                                                 // The current number of columns of the compressed matrix
+   , capacity_( n )                                                 // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*n+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                                       // Pointers one past the last non-zero element of each column
 {
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = nullptr;
@@ -3380,13 +3380,13 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
-   , capacity_( n )                     // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( m )                                                 // The current number of rows of the compressed matrix
+   , n_       ( n )                                                 // The current number of columns of the compressed matrix
+   , capacity_( n )                                                 // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*n+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n+1UL) )                                       // Pointers one past the last non-zero element of each column
 {
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
    for( size_t j=1UL; j<(2UL*n_+1UL); ++j )
       begin_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
@@ -3408,11 +3408,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 */
 template< typename Type >  // Data type of the matrix
 CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the compressed matrix
-   , n_       ( n )                      // The current number of columns of the compressed matrix
-   , capacity_( n )                      // The current capacity of the pointer array
-   , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_  ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( m )                                                  // The current number of rows of the compressed matrix
+   , n_       ( n )                                                  // The current number of columns of the compressed matrix
+   , capacity_( n )                                                  // The current capacity of the pointer array
+   , begin_( allocate<Iterator>( 2UL*n_+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each column
+   , end_  ( begin_+(n_+1UL) )                                       // Pointers one past the last non-zero element of each column
 {
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
 
@@ -3420,7 +3420,7 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
    for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
       newCapacity += *it;
 
-   begin_[0UL] = end_[0UL] = allocate<Element>( newCapacity );
+   begin_[0UL] = end_[0UL] = allocate<Element>( newCapacity, sparseMatrixMemory );
    for( size_t j=0UL; j<n_; ++j ) {
       begin_[j+1UL] = end_[j+1UL] = begin_[j] + nonzeros[j];
    }
@@ -3437,15 +3437,15 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 */
 template< typename Type >  // Data type of the matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
-   : m_       ( sm.m_ )                     // The current number of rows of the compressed matrix
-   , n_       ( sm.n_ )                     // The current number of columns of the compressed matrix
-   , capacity_( sm.n_ )                     // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( sm.m_ )                                                 // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )                                                 // The current number of columns of the compressed matrix
+   , capacity_( sm.n_ )                                                 // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*n_+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                                       // Pointers one past the last non-zero element of each column
 {
    const size_t nonzeros( sm.nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
    for( size_t j=0UL; j<n_; ++j ) {
       end_[j] = castDown( std::copy( sm.begin(j), sm.end(j), castUp( begin_[j] ) ) );
       begin_[j+1UL] = end_[j];
@@ -3490,11 +3490,11 @@ template< typename Type >  // Data type of the matrix
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the compressed matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the compressed matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( (~dm).rows() )                                          // The current number of rows of the compressed matrix
+   , n_       ( (~dm).columns() )                                       // The current number of columns of the compressed matrix
+   , capacity_( n_ )                                                    // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*n_+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                                       // Pointers one past the last non-zero element of each column
 {
    using blaze::assign;
 
@@ -3517,17 +3517,17 @@ template< typename Type >  // Data type of the matrix
 template< typename MT      // Type of the foreign compressed matrix
         , bool SO >        // Storage order of the foreign compressed matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the compressed matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the compressed matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( (~sm).rows() )                                          // The current number of rows of the compressed matrix
+   , n_       ( (~sm).columns() )                                       // The current number of columns of the compressed matrix
+   , capacity_( n_ )                                                    // The current capacity of the pointer array
+   , begin_   ( allocate<Iterator>( 2UL*n_+2UL, sparseMatrixMemory ) )  // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                                       // Pointers one past the last non-zero element of each column
 {
    using blaze::assign;
 
    const size_t nonzeros( (~sm).nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
+   begin_[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
    for( size_t j=0UL; j<n_; ++j )
       begin_[j+1UL] = end_[j] = begin_[0UL];
    end_[n_] = begin_[0UL]+nonzeros;
@@ -3555,7 +3555,7 @@ inline CompressedMatrix<Type,true>::~CompressedMatrix()
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
-      delete[] begin_;
+      deallocate( begin_ );
    }
 }
 /*! \endcond */
@@ -3820,10 +3820,10 @@ inline CompressedMatrix<Type,true>&
 
    if( rhs.n_ > capacity_ || nonzeros > capacity() )
    {
-      Iterator* newBegin( new Iterator[2UL*rhs.n_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*rhs.n_+2UL, sparseMatrixMemory ) );
       Iterator* newEnd  ( newBegin+(rhs.n_+1UL) );
 
-      newBegin[0UL] = allocate<Element>( nonzeros );
+      newBegin[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
       for( size_t j=0UL; j<rhs.n_; ++j ) {
          newEnd[j] = castDown( std::copy( rhs.begin_[j], rhs.end_[j], castUp( newBegin[j] ) ) );
          newBegin[j+1UL] = newEnd[j];
@@ -3836,7 +3836,7 @@ inline CompressedMatrix<Type,true>&
 
       if( newBegin != nullptr ) {
          deallocate( newBegin[0UL] );
-         delete[] newBegin;
+         deallocate( newBegin );
       }
    }
    else {
@@ -3868,7 +3868,7 @@ inline CompressedMatrix<Type,true>&
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
-      delete[] begin_;
+      deallocate( begin_ );
    }
 
    m_        = rhs.m_;
@@ -4373,7 +4373,7 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 
    if( begin_ == nullptr )
    {
-      begin_ = new Iterator[2UL*n+2UL];
+      begin_ = allocate<Iterator>( 2UL*n+2UL, sparseMatrixMemory );
       end_   = begin_+n+1UL;
 
       for( size_t j=0UL; j<2UL*n+2UL; ++j ) {
@@ -4384,7 +4384,7 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    }
    else if( n > capacity_ )
    {
-      Iterator* newBegin( new Iterator[2UL*n+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*n+2UL, sparseMatrixMemory ) );
       Iterator* newEnd  ( newBegin+n+1UL );
 
       newBegin[0UL] = begin_[0UL];
@@ -4407,7 +4407,7 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       newEnd[n] = end_[n_];
 
       std::swap( newBegin, begin_ );
-      delete[] newBegin;
+      deallocate( newBegin );
       end_ = newEnd;
       capacity_ = n;
    }
@@ -4500,10 +4500,10 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
       const size_t newCapacity( begin_[n_] - begin_[0UL] + additional );
       BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
 
-      Iterator* newBegin( new Iterator[2UL*n_+2UL] );
+      Iterator* newBegin( allocate<Iterator>( 2UL*n_+2UL, sparseMatrixMemory ) );
       Iterator* newEnd  ( newBegin+n_+1UL );
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate<Element>( newCapacity, sparseMatrixMemory );
       newEnd  [n_ ] = newBegin[0UL]+newCapacity;
 
       for( size_t k=0UL; k<j; ++k ) {
@@ -4521,7 +4521,7 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 
       std::swap( newBegin, begin_ );
       deallocate( newBegin[0UL] );
-      delete[] newBegin;
+      deallocate( newBegin );
       end_ = newEnd;
       capacity_ = n_;
    }
@@ -4659,10 +4659,10 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const noexcept
 template< typename Type >  // Data type of the matrix
 void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 {
-   Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+   Iterator* newBegin = allocate<Iterator>( 2UL*capacity_+2UL, sparseMatrixMemory );
    Iterator* newEnd   = newBegin+capacity_+1UL;
 
-   newBegin[0UL] = allocate<Element>( nonzeros );
+   newBegin[0UL] = allocate<Element>( nonzeros, sparseMatrixMemory );
 
    for( size_t k=0UL; k<n_; ++k ) {
       BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid column pointers" );
@@ -4677,7 +4677,7 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 
    if( newBegin != nullptr ) {
       deallocate( newBegin[0UL] );
-      delete[] newBegin;
+      deallocate( newBegin );
    }
 }
 /*! \endcond */
@@ -4830,10 +4830,10 @@ typename CompressedMatrix<Type,true>::Iterator
    else {
       size_t newCapacity( extendCapacity() );
 
-      Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
+      Iterator* newBegin = allocate<Iterator>( 2UL*capacity_+2UL, sparseMatrixMemory );
       Iterator* newEnd   = newBegin+capacity_+1UL;
 
-      newBegin[0UL] = allocate<Element>( newCapacity );
+      newBegin[0UL] = allocate<Element>( newCapacity, sparseMatrixMemory );
 
       for( size_t k=0UL; k<j; ++k ) {
          const size_t nonzeros( end_[k] - begin_[k] );
@@ -4860,7 +4860,7 @@ typename CompressedMatrix<Type,true>::Iterator
       std::swap( newBegin, begin_ );
       end_ = newEnd;
       deallocate( newBegin[0UL] );
-      delete[] newBegin;
+      deallocate( newBegin );
 
       return tmp;
    }
@@ -553,10 +553,10 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n ) noexcept
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
-   : size_    ( n )                               // The current size/dimension of the compressed vector
-   , capacity_( nonzeros )                        // The maximum capacity of the compressed vector
-   , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
+   : size_    ( n )                                                   // The current size/dimension of the compressed vector
+   , capacity_( nonzeros )                                            // The maximum capacity of the compressed vector
+   , begin_   ( allocate<Element>( capacity_, sparseVectorMemory ) )  // Pointer to the first non-zero element of the compressed vector
+   , end_     ( begin_ )                                              // Pointer to the last non-zero element of the compressed vector
 {}
 //*************************************************************************************************
 
@@ -572,10 +572,10 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
-   : size_    ( sv.size_ )                        // The current size/dimension of the compressed vector
-   , capacity_( sv.nonZeros() )                   // The maximum capacity of the compressed vector
-   , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( begin_+capacity_ )                // Pointer to the last non-zero element of the compressed vector
+   : size_    ( sv.size_ )                                            // The current size/dimension of the compressed vector
+   , capacity_( sv.nonZeros() )                                       // The maximum capacity of the compressed vector
+   , begin_   ( allocate<Element>( capacity_, sparseVectorMemory ) )  // Pointer to the first non-zero element of the compressed vector
+   , end_     ( begin_+capacity_ )                                    // Pointer to the last non-zero element of the compressed vector
 {
    std::copy( sv.begin_, sv.end_, castUp( begin_ ) );
 }
@@ -632,10 +632,10 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the foreign sparse vector
 inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
-   : size_    ( (~sv).size() )                    // The current size/dimension of the compressed vector
-   , capacity_( (~sv).nonZeros() )                // The maximum capacity of the compressed vector
-   , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
+   : size_    ( (~sv).size() )                                        // The current size/dimension of the compressed vector
+   , capacity_( (~sv).nonZeros() )                                    // The maximum capacity of the compressed vector
+   , begin_   ( allocate<Element>( capacity_, sparseVectorMemory ) )  // Pointer to the first non-zero element of the compressed vector
+   , end_     ( begin_ )                                              // Pointer to the last non-zero element of the compressed vector
 {
    using blaze::assign;
    assign( *this, ~sv );
@@ -882,7 +882,7 @@ inline CompressedVector<Type,TF>&
    const size_t nonzeros( rhs.nonZeros() );
 
    if( nonzeros > capacity_ ) {
-      Iterator newBegin( allocate<Element>( nonzeros ) );
+      Iterator newBegin( allocate<Element>( nonzeros, sparseVectorMemory ) );
       end_ = castDown( std::copy( rhs.begin_, rhs.end_, castUp( newBegin ) ) );
       std::swap( begin_, newBegin );
       deallocate( newBegin );
@@ -1381,7 +1381,7 @@ void CompressedVector<Type,TF>::reserve( size_t n )
       const size_t newCapacity( n );
 
       // Allocating a new data and index array
-      Iterator newBegin  = allocate<Element>( newCapacity );
+      Iterator newBegin  = allocate<Element>( newCapacity, sparseVectorMemory );
 
       // Replacing the old data and index array
       end_ = castDown( transfer( begin_, end_, castUp( newBegin ) ) );
@@ -1585,7 +1585,7 @@ typename CompressedVector<Type,TF>::Iterator
    else {
       size_t newCapacity( extendCapacity() );
 
-      Iterator newBegin = allocate<Element>( newCapacity );
+      Iterator newBegin = allocate<Element>( newCapacity, sparseVectorMemory );
       Iterator tmp = castDown( std::move( begin_, pos, castUp( newBegin ) ) );
       tmp->value_ = value;
       tmp->index_ = index;
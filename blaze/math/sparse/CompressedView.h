@@ -0,0 +1,1283 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedView.h
+//  \brief Implementation of a read-only view on a compressed sparse matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDVIEW_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDVIEW_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_view CompressedView
+// \ingroup sparse_matrix
+*/
+/*!\brief Read-only view on a sparse matrix in compressed row or column storage format.
+// \ingroup compressed_view
+//
+// The CompressedView class template represents an immutable sparse matrix, whose non-zero
+// elements are stored in externally managed arrays in the compressed sparse row (CSR) or
+// compressed sparse column (CSC) format. The type of the elements and the storage order of the
+// matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class CompressedView;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompressedView can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//
+// In case of a row-major view, the non-zero elements of row \a i are given by the column
+// indices and values in the range \f$ [pointers[i]..pointers[i+1]) \f$ of the \a indices and
+// \a values arrays. In case of a column-major view, the arrays are interpreted column-wise.
+// Within each row/column the indices must be strictly ascending. As in case of CustomMatrix,
+// the view does not take responsibility for the given arrays, which must remain valid for the
+// lifetime of the view:
+
+   \code
+   using blaze::CompressedView;
+   using blaze::rowMajor;
+
+   // 3x4 matrix with the non-zero elements (0,1), (0,3), and (2,2)
+   const size_t pointers[] = { 0, 2, 2, 3 };
+   const size_t indices [] = { 1, 3, 2 };
+   const double values  [] = { 1.0, 2.0, 3.0 };
+
+   CompressedView<double,rowMajor> A( 3UL, 4UL, pointers, indices, values );
+   \endcode
+
+// It is not possible to insert, erase or modify the elements of the view. However, it can be
+// used as operand in all sparse matrix expressions:
+
+   \code
+   blaze::DynamicVector<double> x( 4UL ), y;
+   blaze::CompressedMatrix<double> B;
+
+   y = A * x;           // Sparse matrix/dense vector multiplication
+   B = A * trans( A );  // Sparse matrix/sparse matrix multiplication
+   \endcode
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class CompressedView
+   : public SparseMatrix< CompressedView<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = CompressedView<Type,SO>;     //!< Type of this CompressedView instance.
+   using BaseType       = SparseMatrix<This,SO>;       //!< Base type of this CompressedView instance.
+   using ResultType     = CompressedMatrix<Type,SO>;   //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,!SO>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                        //!< Type of the view elements.
+   using ReturnType     = const Type&;                 //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                 //!< Data type for composite expression templates.
+   using Reference      = const Type&;                 //!< Reference to a view element.
+   using ConstReference = const Type&;                 //!< Reference to a constant view element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedView with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompressedView<NewType,SO>;  //!< The type of the other CompressedView.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of the compressed view.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the compressed view.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                          //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                       //!< Pointer return type.
+      using ReferenceType    = ValueType&;                       //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : value_( nullptr )  // Pointer to the current value
+         , index_( nullptr )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the initial value.
+      // \param index Pointer to the initial index.
+      */
+      inline ConstIterator( const Type* value, const size_t* index ) noexcept
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         ++value_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         return ConstIterator( value_++, index_++ );
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() noexcept {
+         --value_;
+         --index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) noexcept {
+         return ConstIterator( value_--, index_-- );
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) noexcept {
+         value_ += inc;
+         index_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) noexcept {
+         value_ -= dec;
+         index_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Element operator*() const {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const noexcept {
+         return index_ < rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const noexcept {
+         return index_ > rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const noexcept {
+         return index_ <= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const noexcept {
+         return index_ >= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) noexcept {
+         return ConstIterator( it.value_ + inc, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) noexcept {
+         return ConstIterator( it.value_ + inc, it.index_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) noexcept {
+         return ConstIterator( it.value_ - dec, it.index_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*   value_;  //!< Pointer to the current value.
+      const size_t* index_;  //!< Pointer to the current index.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompressedView() noexcept;
+   explicit inline CompressedView( size_t m, size_t n, const size_t* pointers,
+                                   const size_t* indices, const Type* values );
+
+   // No explicitly declared copy constructor.
+   // No explicitly declared move constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   // No explicitly declared move assignment operator.
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   clear() noexcept;
+   inline void   swap( CompressedView& m ) noexcept;
+
+   inline void reset( size_t m, size_t n, const size_t* pointers,
+                      const size_t* indices, const Type* values );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                //!< The current number of rows of the view.
+   size_t n_;                //!< The current number of columns of the view.
+   const size_t* pointers_;  //!< The offsets of the first element of each row/column.
+   const size_t* indices_;   //!< The column/row indices of the non-zero elements.
+   const Type* values_;      //!< The values of the non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO >
+const Type CompressedView<Type,SO>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedView.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompressedView<Type,SO>::CompressedView() noexcept
+   : m_       ( 0UL )      // The current number of rows of the view
+   , n_       ( 0UL )      // The current number of columns of the view
+   , pointers_( nullptr )  // The offsets of the first element of each row/column
+   , indices_ ( nullptr )  // The column/row indices of the non-zero elements
+   , values_  ( nullptr )  // The values of the non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed view of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param pointers The offsets of the first element of each row/column (\a m+1 or \a n+1 entries).
+// \param indices The column/row indices of the non-zero elements.
+// \param values The values of the non-zero elements.
+// \exception std::invalid_argument Invalid setup of compressed view.
+//
+// This constructor creates a view on the given arrays in the CSR (row-major) or CSC
+// (column-major) format. In case the array of pointers is not given or in case the arrays of
+// indices and values are not given despite non-zero elements, a \a std::invalid_argument
+// exception is thrown.
+//
+// \note The view does not take responsibility for the given arrays!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompressedView<Type,SO>::CompressedView( size_t m, size_t n, const size_t* pointers,
+                                                const size_t* indices, const Type* values )
+   : CompressedView()  // Delegation to the default constructor
+{
+   reset( m, n, pointers, indices, values );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the elements of the compressed view.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstReference
+   CompressedView<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid compressed view row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid compressed view column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos != end( SO ? j : i ) )
+      return pos->value();
+   else
+      return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the elements of the compressed view.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstReference
+   CompressedView<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstIterator
+   CompressedView<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid compressed view row/column access index" );
+   return ConstIterator( values_ + pointers_[i], indices_ + pointers_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstIterator
+   CompressedView<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstIterator
+   CompressedView<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid compressed view row/column access index" );
+   return ConstIterator( values_ + pointers_[i+1UL], indices_ + pointers_[i+1UL] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstIterator
+   CompressedView<Type,SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the compressed view.
+//
+// \return The number of rows of the compressed view.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedView<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the compressed view.
+//
+// \return The number of columns of the compressed view.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedView<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the compressed view.
+//
+// \return The capacity of the compressed view.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedView<Type,SO>::capacity() const noexcept
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedView<Type,SO>::capacity( size_t i ) const noexcept
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the compressed view.
+//
+// \return The number of non-zero elements in the compressed view.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedView<Type,SO>::nonZeros() const
+{
+   if( pointers_ == nullptr )
+      return 0UL;
+   return pointers_[SO ? n_ : m_] - pointers_[0UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedView<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < ( SO ? n_ : m_ ), "Invalid compressed view row/column access index" );
+   return pointers_[i+1UL] - pointers_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the compressed view.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed view is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedView<Type,SO>::clear() noexcept
+{
+   m_        = 0UL;
+   n_        = 0UL;
+   pointers_ = nullptr;
+   indices_  = nullptr;
+   values_   = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed views.
+//
+// \param m The compressed view to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedView<Type,SO>::swap( CompressedView& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_       , m.m_        );
+   swap( n_       , m.n_        );
+   swap( pointers_, m.pointers_ );
+   swap( indices_ , m.indices_  );
+   swap( values_  , m.values_   );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the compressed view to the given arrays.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param pointers The offsets of the first element of each row/column (\a m+1 or \a n+1 entries).
+// \param indices The column/row indices of the non-zero elements.
+// \param values The values of the non-zero elements.
+// \return void
+// \exception std::invalid_argument Invalid setup of compressed view.
+//
+// This function resets the compressed view to the given arrays in the CSR (row-major) or CSC
+// (column-major) format. In case the array of pointers is not given or in case the arrays of
+// indices and values are not given despite non-zero elements, a \a std::invalid_argument
+// exception is thrown.
+//
+// \note The view does not take responsibility for the given arrays!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedView<Type,SO>::reset( size_t m, size_t n, const size_t* pointers,
+                                            const size_t* indices, const Type* values )
+{
+   if( pointers == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of pointers" );
+   }
+
+   if( pointers[SO ? n : m] != pointers[0UL] && ( indices == nullptr || values == nullptr ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
+   }
+
+   m_        = m;
+   n_        = n;
+   pointers_ = pointers;
+   indices_  = indices;
+   values_   = values;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstIterator
+   CompressedView<Type,SO>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   const ConstIterator last( end( SO ? j : i ) );
+
+   if( pos != last && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else
+      return last;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstIterator
+   CompressedView<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid compressed view row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid compressed view column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t* const pos( std::lower_bound( indices_ + pointers_[k], indices_ + pointers_[k+1UL],
+                                              SO ? i : j ) );
+
+   return ConstIterator( values_ + ( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompressedView<Type,SO>::ConstIterator
+   CompressedView<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid compressed view row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid compressed view column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t* const pos( std::upper_bound( indices_ + pointers_[k], indices_ + pointers_[k+1UL],
+                                              SO ? i : j ) );
+
+   return ConstIterator( values_ + ( pos - indices_ ), pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the view can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this view, \a false if not.
+//
+// This function returns whether the given address can alias with the view. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedView<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the view is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this view, \a false if not.
+//
+// This function returns whether the given address is aliased with the view. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedView<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the view can be used in SMP assignments.
+//
+// \return \a true in case the view can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the view can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the view).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool CompressedView<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDVIEW OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompressedView operators */
+//@{
+template< typename Type, bool SO >
+inline void clear( CompressedView<Type,SO>& m ) noexcept;
+
+template< bool RF, typename Type, bool SO >
+inline bool isDefault( const CompressedView<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isIntact( const CompressedView<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( CompressedView<Type,SO>& a, CompressedView<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed view.
+// \ingroup compressed_view
+//
+// \param m The view to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( CompressedView<Type,SO>& m ) noexcept
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed view is in default state.
+// \ingroup compressed_view
+//
+// \param m The view to be tested for its default state.
+// \return \a true in case the given view's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compressed view is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const CompressedView<Type,SO>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compressed view are intact.
+// \ingroup compressed_view
+//
+// \param m The compressed view to be tested.
+// \return \a true in case the given view's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compressed view are intact, i.e. if the
+// row/column pointers are ascending and if the indices of each row/column are strictly ascending
+// and within the bounds of the matrix. Since this check touches all indices of the view, it can
+// be used to validate views on untrusted data (e.g. views on memory-mapped files):
+
+   \code
+   blaze::CompressedView<double> A;
+   // ... Initialization
+   if( isIntact( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const CompressedView<Type,SO>& m )
+{
+   using ConstIterator = typename CompressedView<Type,SO>::ConstIterator;
+
+   const size_t M( SO ? m.columns() : m.rows() );
+   const size_t N( SO ? m.rows() : m.columns() );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      if( m.begin(i) > m.end(i) )
+         return false;
+
+      size_t bound( 0UL );
+      for( ConstIterator element=m.begin(i); element!=m.end(i); ++element ) {
+         if( element->index() < bound || element->index() >= N )
+            return false;
+         bound = element->index() + 1UL;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed views.
+// \ingroup compressed_view
+//
+// \param a The first view to be swapped.
+// \param b The second view to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( CompressedView<Type,SO>& a, CompressedView<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct SubmatrixTrait< CompressedView<T,SO> >
+{
+   using Type = CompressedMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct RowTrait< CompressedView<T,SO> >
+{
+   using Type = CompressedVector<T,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct ColumnTrait< CompressedView<T,SO> >
+{
+   using Type = CompressedVector<T,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
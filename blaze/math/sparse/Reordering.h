@@ -0,0 +1,737 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Reordering.h
+//  \brief Header file for the fill-reducing and bandwidth-reducing sparse matrix reorderings
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_REORDERING_H_
+#define _BLAZE_MATH_SPARSE_REORDERING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the adjacency graph of the symmetrized sparsity pattern of a square matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix.
+// \param xadj The resulting offsets of the adjacency lists (of size \a n+1).
+// \param adj The resulting concatenated adjacency lists.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the adjacency graph of the sparsity pattern of \f$ A + A^T \f$ without
+// the diagonal. The adjacency list of vertex \a i is given by the range
+// [\a adj[\a xadj[i]], \a adj[\a xadj[i+1]]) and is sorted in ascending order. Note that the
+// graph is independent of the storage order of the given matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+void adjacencyGraph( const SparseMatrix<MT,SO>& A, std::vector<size_t>& xadj, std::vector<size_t>& adj )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_<MT> B( ~A );  // Evaluation of the sparse matrix operand
+
+   const size_t n( B.rows() );
+
+   xadj.assign( n+1UL, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=B.begin(i); element!=B.end(i); ++element ) {
+         if( element->index() != i ) {
+            ++xadj[i+1UL];
+            ++xadj[element->index()+1UL];
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      xadj[i+1UL] += xadj[i];
+   }
+
+   std::vector<size_t> pos( xadj.begin(), xadj.end()-1 );
+   adj.resize( xadj[n] );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=B.begin(i); element!=B.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( j != i ) {
+            adj[pos[i]++] = j;
+            adj[pos[j]++] = i;
+         }
+      }
+   }
+
+   // Sorting the adjacency lists and removing the duplicates of symmetric elements
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto begin( adj.begin()+xadj[i] );
+      const auto end  ( adj.begin()+xadj[i+1UL] );
+
+      std::sort( begin, end );
+      const auto last( std::unique( begin, end ) );
+
+      xadj[i] = nonzeros;
+      nonzeros = std::copy( begin, last, adj.begin()+nonzeros ) - adj.begin();
+   }
+
+   xadj[n] = nonzeros;
+   adj.resize( nonzeros );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inverse of the given permutation.
+// \ingroup sparse_matrix
+//
+// \param perm The permutation vector.
+// \param n The expected size of the permutation.
+// \return The inverse permutation vector.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// In case the given vector is not a permutation of the indices \f$ [0..n) \f$, a
+// \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> invertPermutation( const std::vector<size_t>& perm, size_t n )
+{
+   if( perm.size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+   }
+
+   std::vector<size_t> iperm( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( perm[i] >= n || iperm[perm[i]] != n ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation vector provided" );
+      }
+      iperm[perm[i]] = i;
+   }
+
+   return iperm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Breadth-first search for the level structure rooted at the given vertex.
+// \ingroup sparse_matrix
+//
+// \param root The root vertex of the level structure.
+// \param xadj The offsets of the adjacency lists.
+// \param adj The concatenated adjacency lists.
+// \param stamp The marker array of the vertices.
+// \param tag The unique marker of this search.
+// \param queue The resulting vertices of the connected component in breadth-first order.
+// \param last The resulting position of the first vertex of the last level within \a queue.
+// \return The number of levels of the level structure (i.e. the eccentricity of \a root plus 1).
+*/
+inline size_t levelStructure( size_t root, const std::vector<size_t>& xadj, const std::vector<size_t>& adj,
+                              std::vector<size_t>& stamp, size_t tag, std::vector<size_t>& queue,
+                              size_t& last )
+{
+   queue.clear();
+   queue.push_back( root );
+   stamp[root] = tag;
+
+   size_t levels( 0UL );
+   size_t begin( 0UL );
+
+   while( begin < queue.size() )
+   {
+      const size_t end( queue.size() );
+      last = begin;
+      ++levels;
+
+      for( size_t k=begin; k<end; ++k ) {
+         const size_t v( queue[k] );
+         for( size_t l=xadj[v]; l<xadj[v+1UL]; ++l ) {
+            if( stamp[adj[l]] != tag ) {
+               stamp[adj[l]] = tag;
+               queue.push_back( adj[l] );
+            }
+         }
+      }
+
+      begin = end;
+   }
+
+   return levels;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Reordering functions */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+std::vector<size_t> amd( const SparseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+CompressedMatrix< ElementType_<MT>, SO > permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+template< typename VT, bool TF >
+DynamicVector< ElementType_<VT>, TF > permute( const DenseVector<VT,TF>& x, const std::vector<size_t>& perm );
+
+template< typename VT, bool TF >
+DynamicVector< ElementType_<VT>, TF > ipermute( const DenseVector<VT,TF>& x, const std::vector<size_t>& perm );
+
+template< typename MT, bool SO >
+size_t bandwidth( const SparseMatrix<MT,SO>& A );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the reverse Cuthill-McKee ordering of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix.
+// \return The permutation vector of the reverse Cuthill-McKee ordering.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the reverse Cuthill-McKee (RCM) ordering of the given square sparse
+// matrix, which reduces the bandwidth and the profile of the matrix. The ordering is based on
+// the sparsity pattern of \f$ A + A^T \f$, i.e. the matrix is not required to be structurally
+// symmetric. Each connected component is traversed in breadth-first order starting at a
+// pseudo-peripheral vertex (determined via the algorithm by George and Liu), where the
+// neighbors of a vertex are visited in the order of ascending degree. The resulting permutation
+// vector \a perm specifies the new order of the rows and columns, i.e. row/column \a i of the
+// reordered matrix corresponds to row/column \a perm[i] of the given matrix (see the permute()
+// function):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> perm( rcm( A ) );
+
+   const blaze::CompressedMatrix<double> B( permute( A, perm ) );  // B = P * A * P^T
+   const blaze::DynamicVector<double> z( permute( x, perm ) );      // z = P * x
+
+   y = ipermute( B * z, perm );  // y = P^T * B * P * x = A * x
+   \endcode
+
+// The reduced bandwidth improves the data locality of the sparse matrix/vector multiplication,
+// since consecutive rows access neighboring elements of the right-hand side vector. In case
+// the given matrix is not a square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::vector<size_t> xadj, adj;
+   adjacencyGraph( ~A, xadj, adj );
+
+   const size_t n( xadj.size() - 1UL );
+
+   const auto degree = [&xadj]( size_t v ) {
+      return xadj[v+1UL] - xadj[v];
+   };
+
+   const auto less = [&degree]( size_t v1, size_t v2 ) {
+      return degree( v1 ) < degree( v2 ) || ( degree( v1 ) == degree( v2 ) && v1 < v2 );
+   };
+
+   std::vector<size_t> perm;
+   perm.reserve( n );
+
+   std::vector<size_t> stamp( n, 0UL );
+   std::vector<bool> visited( n, false );
+   std::vector<size_t> queue;
+   queue.reserve( n );
+
+   size_t tag( 0UL );
+
+   for( size_t start=0UL; start<n; ++start )
+   {
+      if( visited[start] ) continue;
+
+      // Computation of a pseudo-peripheral root vertex of the connected component
+      size_t root( start );
+      size_t last( 0UL );
+      size_t levels( levelStructure( root, xadj, adj, stamp, ++tag, queue, last ) );
+
+      for( size_t v : queue ) {
+         if( less( v, root ) ) root = v;
+      }
+
+      if( root != start ) {
+         levels = levelStructure( root, xadj, adj, stamp, ++tag, queue, last );
+      }
+
+      while( true )
+      {
+         size_t candidate( queue[last] );
+         for( size_t k=last+1UL; k<queue.size(); ++k ) {
+            if( less( queue[k], candidate ) ) candidate = queue[k];
+         }
+
+         size_t clast( 0UL );
+         const size_t clevels( levelStructure( candidate, xadj, adj, stamp, ++tag, queue, clast ) );
+
+         if( clevels <= levels ) break;
+
+         root   = candidate;
+         levels = clevels;
+         last   = clast;
+      }
+
+      // Cuthill-McKee traversal of the connected component
+      size_t begin( perm.size() );
+      perm.push_back( root );
+      visited[root] = true;
+
+      while( begin < perm.size() )
+      {
+         const size_t v( perm[begin++] );
+         const size_t first( perm.size() );
+
+         for( size_t l=xadj[v]; l<xadj[v+1UL]; ++l ) {
+            if( !visited[adj[l]] ) {
+               visited[adj[l]] = true;
+               perm.push_back( adj[l] );
+            }
+         }
+
+         std::sort( perm.begin()+first, perm.end(), less );
+      }
+   }
+
+   std::reverse( perm.begin(), perm.end() );
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the approximate minimum degree ordering of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix.
+// \return The permutation vector of the approximate minimum degree ordering.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes an approximate minimum degree (AMD) ordering of the given square
+// sparse matrix, which reduces the fill-in of a subsequent Cholesky or LU decomposition. The
+// ordering is based on the sparsity pattern of \f$ A + A^T \f$, i.e. the matrix is not
+// required to be structurally symmetric. The elimination is simulated by means of a quotient
+// graph, in which every eliminated vertex is represented by an element (i.e. a clique of its
+// uneliminated neighbors). In every step the vertex with the smallest approximate external
+// degree is eliminated, where the degrees are updated by means of the upper bounds by Amestoy,
+// Davis, and Duff. Elements that are covered by a new element are absorbed. The resulting
+// permutation vector \a perm specifies the elimination order, i.e. row/column \a i of the
+// reordered matrix corresponds to row/column \a perm[i] of the given matrix (see the permute()
+// function):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> perm( amd( A ) );
+   const blaze::CompressedMatrix<double> B( permute( A, perm ) );  // B = P * A * P^T
+   \endcode
+
+// Note that in contrast to the reference implementation of AMD no detection of indistinguishable
+// vertices (supervariables) and no special treatment of dense rows is performed. In case the
+// given matrix is not a square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> amd( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   std::vector<size_t> xadj, adj;
+   adjacencyGraph( ~A, xadj, adj );
+
+   const size_t n( xadj.size() - 1UL );
+
+   enum : unsigned char { variable = 0U, element = 1U, absorbed = 2U };
+
+   std::vector< std::vector<size_t> > variables( n );  // Adjacent variables of each variable
+   std::vector< std::vector<size_t> > elements ( n );  // Adjacent elements of each variable
+   std::vector< std::vector<size_t> > members  ( n );  // Variables of each element
+
+   std::vector<unsigned char> status( n, variable );
+   std::vector<size_t> degree( n );
+
+   // Initialization of the quotient graph and the degree lists
+   std::vector<size_t> head( n+1UL, n ), next( n, n ), prev( n, n );
+
+   const auto insert = [&]( size_t v ) {
+      const size_t d( degree[v] );
+      prev[v] = n;
+      next[v] = head[d];
+      if( head[d] != n ) prev[head[d]] = v;
+      head[d] = v;
+   };
+
+   const auto remove = [&]( size_t v ) {
+      if( prev[v] != n ) next[prev[v]] = next[v];
+      else head[degree[v]] = next[v];
+      if( next[v] != n ) prev[next[v]] = prev[v];
+   };
+
+   for( size_t i=n; i-- > 0UL; ) {
+      variables[i].assign( adj.begin()+xadj[i], adj.begin()+xadj[i+1UL] );
+      degree[i] = variables[i].size();
+      insert( i );
+   }
+
+   std::vector<size_t>().swap( adj );
+   std::vector<size_t>().swap( xadj );
+
+   std::vector<size_t> stamp( n, 0UL ), wstamp( n, 0UL ), weight( n, 0UL );
+   std::vector<size_t> perm;
+   perm.reserve( n );
+
+   size_t mindeg( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      // Selection of the pivot with minimum approximate degree
+      while( head[mindeg] == n ) ++mindeg;
+
+      const size_t p( head[mindeg] );
+      remove( p );
+      perm.push_back( p );
+      status[p] = element;
+
+      // Construction of the new element and absorption of the adjacent elements
+      const size_t tag( k+1UL );
+      stamp[p] = tag;
+
+      std::vector<size_t>& Lp( members[p] );
+      Lp.clear();
+
+      for( size_t i : variables[p] ) {
+         if( status[i] == variable && stamp[i] != tag ) {
+            stamp[i] = tag;
+            Lp.push_back( i );
+         }
+      }
+
+      for( size_t e : elements[p] ) {
+         if( status[e] != element ) continue;
+         for( size_t i : members[e] ) {
+            if( status[i] == variable && stamp[i] != tag ) {
+               stamp[i] = tag;
+               Lp.push_back( i );
+            }
+         }
+         status[e] = absorbed;
+         std::vector<size_t>().swap( members[e] );
+      }
+
+      std::vector<size_t>().swap( variables[p] );
+      std::vector<size_t>().swap( elements[p] );
+
+      // Computation of the external degrees |Le \ Lp| of all elements adjacent to Lp
+      for( size_t i : Lp )
+      {
+         remove( i );
+
+         for( size_t e : elements[i] ) {
+            if( status[e] != element ) continue;
+            if( wstamp[e] != tag ) {
+               wstamp[e] = tag;
+               weight[e] = members[e].size();
+            }
+            --weight[e];
+         }
+      }
+
+      // Update of the adjacency lists and the approximate degrees of all variables in Lp
+      const size_t remaining( n - k - 1UL );
+      const size_t lpsize( Lp.size() );
+
+      for( size_t i : Lp )
+      {
+         std::vector<size_t>& Ei( elements[i] );
+         std::vector<size_t>& Ai( variables[i] );
+
+         size_t external( 0UL );
+         size_t count( 0UL );
+
+         for( size_t e : Ei ) {
+            if( status[e] != element ) continue;
+            if( weight[e] == 0UL ) {  // Aggressive absorption
+               status[e] = absorbed;
+               std::vector<size_t>().swap( members[e] );
+               continue;
+            }
+            external += weight[e];
+            Ei[count++] = e;
+         }
+
+         Ei.resize( count );
+         Ei.push_back( p );
+
+         count = 0UL;
+         for( size_t j : Ai ) {
+            if( status[j] == variable && stamp[j] != tag ) {
+               Ai[count++] = j;
+            }
+         }
+         Ai.resize( count );
+
+         degree[i] = min( remaining - 1UL, degree[i] + lpsize - 1UL, count + lpsize - 1UL + external );
+         insert( i );
+         mindeg = min( mindeg, degree[i] );
+      }
+   }
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of the given square sparse matrix (\f$ B = P*A*P^T \f$).
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix to be permuted.
+// \param perm The permutation vector.
+// \return The permuted sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function returns the symmetric permutation \f$ B = P*A*P^T \f$ of the given square
+// sparse matrix, i.e. \f$ B(i,j) = A(perm[i],perm[j]) \f$. The permuted matrix is assembled
+// in two linear passes over the elements without any sorting. In case the given matrix is not
+// a square matrix or \a perm is not a permutation of the row indices of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+CompressedMatrix< ElementType_<MT>, SO >
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+   const std::vector<size_t> iperm( invertPermutation( perm, n ) );
+
+   CompositeType_<MT> B( ~A );  // Evaluation of the sparse matrix operand
+
+   // Assembling the permuted matrix with the opposite storage order, such that the elements
+   // of each row/column are appended in ascending order of their indices
+   std::vector<size_t> nonzeros( n, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=B.begin(i); element!=B.end(i); ++element ) {
+         ++nonzeros[iperm[element->index()]];
+      }
+   }
+
+   CompressedMatrix< ElementType_<MT>, !SO > tmp( n, n, nonzeros );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t k( perm[i] );
+      for( auto element=B.begin(k); element!=B.end(k); ++element ) {
+         if( SO ) tmp.append( iperm[element->index()], i, element->value() );
+         else     tmp.append( i, iperm[element->index()], element->value() );
+      }
+   }
+
+   return CompressedMatrix< ElementType_<MT>, SO >( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the given dense vector (\f$ y = P*x \f$).
+// \ingroup sparse_matrix
+//
+// \param x The dense vector to be permuted.
+// \param perm The permutation vector.
+// \return The permuted dense vector.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function returns the permuted dense vector \f$ y = P*x \f$, i.e. \f$ y[i] = x[perm[i]] \f$.
+// It transfers a vector into the ordering of a matrix permuted via permute(). In case \a perm
+// is not a permutation of the indices of the vector, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DynamicVector< ElementType_<VT>, TF >
+   permute( const DenseVector<VT,TF>& x, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( (~x).size() );
+   invertPermutation( perm, n );
+
+   CompositeType_<VT> v( ~x );  // Evaluation of the dense vector operand
+
+   DynamicVector< ElementType_<VT>, TF > y( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      y[i] = v[perm[i]];
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inverse permutation of the given dense vector (\f$ y = P^T*x \f$).
+// \ingroup sparse_matrix
+//
+// \param x The dense vector to be permuted.
+// \param perm The permutation vector.
+// \return The permuted dense vector.
+// \exception std::invalid_argument Invalid permutation vector provided.
+//
+// This function returns the inversely permuted dense vector \f$ y = P^T*x \f$, i.e.
+// \f$ y[perm[i]] = x[i] \f$. It transfers a vector from the ordering of a matrix permuted via
+// permute() back into the original ordering. In case \a perm is not a permutation of the
+// indices of the vector, a \a std::invalid_argument exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DynamicVector< ElementType_<VT>, TF >
+   ipermute( const DenseVector<VT,TF>& x, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t n( (~x).size() );
+   invertPermutation( perm, n );
+
+   CompositeType_<VT> v( ~x );  // Evaluation of the dense vector operand
+
+   DynamicVector< ElementType_<VT>, TF > y( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      y[perm[i]] = v[i];
+   }
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The sparse matrix.
+// \return The maximum distance \f$ |i-j| \f$ of a non-zero element \f$ A(i,j) \f$ to the diagonal.
+//
+// This function returns the bandwidth of the given sparse matrix, i.e. the maximum distance
+// of any non-zero element to the diagonal. It can be used to assess the effect of a reordering
+// via the rcm() function.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+size_t bandwidth( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_<MT> B( ~A );  // Evaluation of the sparse matrix operand
+
+   const size_t n( SO ? B.columns() : B.rows() );
+
+   size_t width( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=B.begin(i); element!=B.end(i); ++element ) {
+         const size_t j( element->index() );
+         width = max( width, ( i > j ? i - j : j - i ) );
+      }
+   }
+
+   return width;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/config/SMP.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 
@@ -123,4 +125,48 @@
 #endif
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//  SMP SCHEDULING CONFIGURATION
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*!\brief Over-decomposition factor of the thread-based shared-memory parallelization.
+// \ingroup system
+//
+// This value specifies the number of tasks per thread the C++11 and Boost thread-based SMP
+// assignments split their work into (see the \c BLAZE_SMP_TASKS_PER_THREAD setting in the
+// <tt>./blaze/config/SMP.h</tt> configuration file).
+*/
+constexpr size_t SMP_TASKS_PER_THREAD = BLAZE_SMP_TASKS_PER_THREAD;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Spin count of the thread-based shared-memory parallelization.
+// \ingroup system
+//
+// This value specifies the number of polling iterations of the C++11 and Boost thread-based
+// parallelization before an idle thread blocks (see the \c BLAZE_SMP_SPIN_COUNT setting in the
+// <tt>./blaze/config/SMP.h</tt> configuration file).
+*/
+constexpr size_t SMP_SPIN_COUNT = BLAZE_SMP_SPIN_COUNT;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( SMP_TASKS_PER_THREAD > 0UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
 #endif
@@ -622,6 +622,63 @@ constexpr size_t SMP_DMATSCALARMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP row-wise/column-wise dense matrix reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DMATREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a row-wise or column-wise reduction of a dense matrix
+// can be executed in parallel. In case the number of elements of the reduced matrix is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched small matrix operation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_MATRIXBATCH_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a batched operation on many small matrices can be
+// executed in parallel. In case the number of matrices in the batch is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of matrices is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_MATRIXBATCH_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATTRSV_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a level of a level-scheduled sparse triangular solve
+// can be executed in parallel. In case the number of rows of a level is larger or equal to this
+// threshold, the rows of the level are processed in parallel. If the number of rows is below
+// this threshold the level is processed single-threaded.
+*/
+constexpr size_t SMP_SMATTRSV_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse Cholesky decomposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATLLH_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a level of the supernodal elimination tree of a sparse
+// Cholesky decomposition can be decomposed in parallel. In case the total number of factor
+// elements of all supernodes of a level is larger or equal to this threshold, the supernodes of
+// the level are decomposed in parallel. If the number of elements is below this threshold the
+// level is processed single-threaded.
+*/
+constexpr size_t SMP_SMATLLH_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/row-major dense matrix addition threshold.
 // \ingroup config
@@ -966,6 +1023,10 @@ constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSM
 constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD );
 constexpr size_t SMP_DMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     );
 constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD );
+constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_MATRIXBATCH_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_MATRIXBATCH_DEBUG_THRESHOLD    : BLAZE_SMP_MATRIXBATCH_THRESHOLD    );
+constexpr size_t SMP_SMATTRSV_THRESHOLD       = ( BLAZE_DEBUG_MODE ? SMP_SMATTRSV_DEBUG_THRESHOLD       : BLAZE_SMP_SMATTRSV_THRESHOLD       );
+constexpr size_t SMP_SMATLLH_THRESHOLD        = ( BLAZE_DEBUG_MODE ? SMP_SMATLLH_DEBUG_THRESHOLD        : BLAZE_SMP_SMATLLH_THRESHOLD        );
 constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    );
 constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   );
 constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    );
@@ -1040,6 +1101,10 @@ BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_MATRIXBATCH_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRSV_THRESHOLD       >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATLLH_THRESHOLD        >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
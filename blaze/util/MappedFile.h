@@ -0,0 +1,527 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MappedFile.h
+//  \brief Header file for the MappedFile class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_MAPPEDFILE_H_
+#define _BLAZE_UTIL_MAPPEDFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <string>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ENUMERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access modes of a memory-mapped file.
+// \ingroup util
+*/
+enum MappingMode
+{
+   readOnly  = 0,  //!< The file is mapped for reading only.
+   readWrite = 1   //!< The file is mapped for reading and writing.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access pattern hints for memory-mapped files.
+// \ingroup util
+//
+// The access advices are forwarded to the operating system (see \c madvise()) in order to
+// adapt the read-ahead and caching strategy for a memory-mapped file.
+*/
+enum AccessAdvice
+{
+   normalAccess     = 0,  //!< No special treatment.
+   sequentialAccess = 1,  //!< The pages are accessed in sequential order.
+   randomAccess     = 2,  //!< The pages are accessed in random order.
+   willNeedAccess   = 3,  //!< The pages will be accessed soon and should be prefetched.
+   dontNeedAccess   = 4   //!< The pages will not be accessed in the near future.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII wrapper for a memory-mapped file.
+// \ingroup util
+//
+// The MappedFile class maps the content of a file into the address space of the process. The
+// mapping starts at a page boundary and is released on destruction of the MappedFile object.
+// A file can either be mapped read-only or read-write. In the latter case all modifications
+// of the mapped memory are written back to the file:
+
+   \code
+   blaze::MappedFile file( "data.bin", 1048576UL );  // Creates a file of 1 MiB
+
+   file.data()[0] = 1;
+   file.flush();
+   \endcode
+
+// Memory-mapped files are only available on POSIX systems. On all other systems the constructors
+// throw a \a std::runtime_error exception.
+*/
+class MappedFile : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedFile() noexcept;
+   explicit inline MappedFile( const std::string& filename, MappingMode mode = readOnly );
+   explicit inline MappedFile( const std::string& filename, size_t size );
+            inline MappedFile( MappedFile&& file ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedFile();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MappedFile& operator=( MappedFile&& file ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline byte_t*     data() const noexcept;
+   inline size_t      size() const noexcept;
+   inline MappingMode mode() const noexcept;
+   inline bool        isMapped() const noexcept;
+   inline void        advise( AccessAdvice advice );
+   inline void        advise( AccessAdvice advice, size_t offset, size_t length );
+   inline void        flush();
+   inline void        close() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void map( const std::string& filename, MappingMode mode, size_t size, bool create );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t*     data_;  //!< The first byte of the mapping.
+   size_t      size_;  //!< The size of the mapping in bytes.
+   MappingMode mode_;  //!< The access mode of the mapping.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MappedFile.
+//
+// The default constructor creates an empty MappedFile that doesn't refer to any file.
+*/
+inline MappedFile::MappedFile() noexcept
+   : data_( nullptr )   // The first byte of the mapping
+   , size_( 0UL )       // The size of the mapping in bytes
+   , mode_( readOnly )  // The access mode of the mapping
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Mapping an existing file.
+//
+// \param filename The name of the file to be mapped.
+// \param mode The access mode of the mapping (\a readOnly or \a readWrite).
+// \exception std::runtime_error Mapping the file failed.
+//
+// This constructor maps the entire content of the given, existing file. In case the file does
+// not exist, cannot be opened in the requested mode, or cannot be mapped, a \a std::runtime_error
+// exception is thrown.
+*/
+inline MappedFile::MappedFile( const std::string& filename, MappingMode mode )
+   : MappedFile()  // Creating an empty mapping
+{
+   map( filename, mode, 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating and mapping a file of the given size.
+//
+// \param filename The name of the file to be created.
+// \param size The size of the file in bytes.
+// \exception std::runtime_error Creating or mapping the file failed.
+//
+// This constructor creates a file of the given size (or resizes an existing file to the given
+// size) and maps it for reading and writing. The content of a newly created file is zero. In
+// case the file cannot be created or mapped, a \a std::runtime_error exception is thrown.
+*/
+inline MappedFile::MappedFile( const std::string& filename, size_t size )
+   : MappedFile()  // Creating an empty mapping
+{
+   map( filename, readWrite, size, true );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MappedFile.
+//
+// \param file The mapped file to be moved into this instance.
+*/
+inline MappedFile::MappedFile( MappedFile&& file ) noexcept
+   : data_( file.data_ )  // The first byte of the mapping
+   , size_( file.size_ )  // The size of the mapping in bytes
+   , mode_( file.mode_ )  // The access mode of the mapping
+{
+   file.data_ = nullptr;
+   file.size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MappedFile.
+//
+// The destructor releases the mapping. Note that the modifications of a read-write mapping are
+// written back to the file by the operating system, but not necessarily synchronously.
+*/
+inline MappedFile::~MappedFile()
+{
+   close();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MappedFile.
+//
+// \param file The mapped file to be moved into this instance.
+// \return Reference to the assigned mapped file.
+*/
+inline MappedFile& MappedFile::operator=( MappedFile&& file ) noexcept
+{
+   if( &file != this ) {
+      close();
+      data_ = file.data_;
+      size_ = file.size_;
+      mode_ = file.mode_;
+      file.data_ = nullptr;
+      file.size_ = 0UL;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapping.
+//
+// \return Pointer to the first byte of the mapping (\a nullptr for an empty mapping).
+//
+// The returned pointer is aligned to a page boundary. Note that the memory of a read-only
+// mapping must not be modified.
+*/
+inline byte_t* MappedFile::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapping.
+//
+// \return The size of the mapping in bytes.
+*/
+inline size_t MappedFile::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the access mode of the mapping.
+//
+// \return The access mode of the mapping.
+*/
+inline MappingMode MappedFile::mode() const noexcept
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the MappedFile refers to a file.
+//
+// \return \a true in case a file is mapped, \a false if not.
+*/
+inline bool MappedFile::isMapped() const noexcept
+{
+   return data_ != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advising the operating system about the access pattern of the entire mapping.
+//
+// \param advice The expected access pattern.
+// \return void
+// \exception std::runtime_error Invalid advice.
+*/
+inline void MappedFile::advise( AccessAdvice advice )
+{
+   advise( advice, 0UL, size_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Advising the operating system about the access pattern of a part of the mapping.
+//
+// \param advice The expected access pattern.
+// \param offset The offset of the first byte of the advised range.
+// \param length The number of bytes of the advised range.
+// \return void
+// \exception std::invalid_argument Invalid range specification.
+// \exception std::runtime_error Invalid advice.
+//
+// This function forwards the given access pattern for the specified range to the operating
+// system. The range is extended to page boundaries. Typical use cases are the prefetch of the
+// next block of a matrix via \a willNeedAccess and the release of already processed blocks
+// via \a dontNeedAccess. In case the range exceeds the mapping, a \a std::invalid_argument
+// exception is thrown.
+*/
+inline void MappedFile::advise( AccessAdvice advice, size_t offset, size_t length )
+{
+   if( offset > size_ || length > size_ - offset ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid mapping range" );
+   }
+
+   if( length == 0UL )
+      return;
+
+#if defined(__unix__) || defined(__APPLE__)
+   const size_t pagesize( static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) ) );
+   const size_t first( offset - offset % pagesize );
+
+   int flag( 0 );
+
+   switch( advice ) {
+      case sequentialAccess: flag = MADV_SEQUENTIAL; break;
+      case randomAccess    : flag = MADV_RANDOM;     break;
+      case willNeedAccess  : flag = MADV_WILLNEED;   break;
+      case dontNeedAccess  : flag = MADV_DONTNEED;   break;
+      default              : flag = MADV_NORMAL;     break;
+   }
+
+   if( ::madvise( data_ + first, offset + length - first, flag ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid mapping advice" );
+   }
+#else
+   UNUSED_PARAMETER( advice );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Synchronously writing all modifications of the mapping back to the file.
+//
+// \return void
+// \exception std::runtime_error Synchronization failed.
+*/
+inline void MappedFile::flush()
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( data_ != nullptr && mode_ == readWrite && ::msync( data_, size_, MS_SYNC ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Synchronization of mapped file failed" );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releasing the mapping.
+//
+// \return void
+*/
+inline void MappedFile::close() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+   if( data_ != nullptr ) {
+      ::munmap( data_, size_ );
+   }
+#endif
+
+   data_ = nullptr;
+   size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Opening and mapping the given file.
+//
+// \param filename The name of the file to be mapped.
+// \param mode The access mode of the mapping.
+// \param size The size of a created file in bytes.
+// \param create \a true in case the file should be created, \a false if not.
+// \return void
+// \exception std::runtime_error Mapping the file failed.
+*/
+inline void MappedFile::map( const std::string& filename, MappingMode mode, size_t size, bool create )
+{
+#if defined(__unix__) || defined(__APPLE__)
+   const int flags( ( mode == readWrite )?( create ? ( O_RDWR | O_CREAT ) : O_RDWR ):( O_RDONLY ) );
+   const int fd( ::open( filename.c_str(), flags, 0644 ) );
+
+   if( fd < 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Opening file failed" );
+   }
+
+   if( create && ::ftruncate( fd, static_cast<off_t>( size ) ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "Resizing file failed" );
+   }
+
+   if( !create ) {
+      struct stat info;
+      if( ::fstat( fd, &info ) != 0 ) {
+         ::close( fd );
+         BLAZE_THROW_RUNTIME_ERROR( "Querying file size failed" );
+      }
+      size = static_cast<size_t>( info.st_size );
+   }
+
+   if( size == 0UL ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "Mapping of empty file" );
+   }
+
+   const int protection( ( mode == readWrite )?( PROT_READ | PROT_WRITE ):( PROT_READ ) );
+   void* const address( ::mmap( nullptr, size, protection, MAP_SHARED, fd, 0 ) );
+
+   ::close( fd );
+
+   if( address == MAP_FAILED ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Mapping file failed" );
+   }
+
+   data_ = static_cast<byte_t*>( address );
+   size_ = size;
+   mode_ = mode;
+#else
+   UNUSED_PARAMETER( filename, mode, size, create );
+   BLAZE_THROW_RUNTIME_ERROR( "Memory-mapped files are not supported" );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,15 +40,13 @@
 // Includes
 //*************************************************************************************************
 
-#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
-#  include <malloc.h>
-#endif
-#include <cstdlib>
 #include <new>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
-#include <blaze/util/Exception.h>
+#include <blaze/util/MemoryAccounting.h>
+#include <blaze/util/MemoryResource.h>
+#include <blaze/util/ScratchArena.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -62,6 +60,57 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Header in front of each memory block allocated by the allocate_backend() function.
+// \ingroup util
+//
+// The header stores the memory resource a memory block was allocated from, which guarantees
+// that each block is returned to the according resource, independent of the resource that is
+// installed at the time of the deallocation.
+*/
+struct AllocationHeader
+{
+   MemoryResource* resource;   //!< The memory resource of the memory block.
+   size_t          size;       //!< The total number of allocated bytes.
+   size_t          alignment;  //!< The alignment of the memory block.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the size of the allocation header for the given alignment.
+// \ingroup util
+//
+// \param alignment The alignment of the memory block.
+// \return The size of the allocation header in bytes.
+*/
+constexpr size_t allocationHeaderSize( size_t alignment ) noexcept
+{
+   return ( sizeof(AllocationHeader) + alignment - 1UL ) / alignment * alignment;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the alignment of an allocation for the given minimum alignment.
+// \ingroup util
+//
+// \param alignment The minimum alignment of the data type.
+// \return The alignment of the allocation (at least the size of a pointer).
+*/
+constexpr size_t allocationAlignment( size_t alignment ) noexcept
+{
+   return ( alignment < sizeof(void*) ) ? sizeof(void*) : alignment;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Backend implementation for aligned array allocation.
@@ -69,30 +118,38 @@ namespace blaze {
 //
 // \param size The number of bytes to be allocated.
 // \param alignment The required minimum alignment.
+// \param category The memory category of the allocation.
 // \return Byte pointer to the first element of the aligned array.
 // \exception std::bad_alloc Allocation failed.
 //
 // This function provides the functionality to allocate memory based on the given alignment
-// restrictions. For that purpose it uses the according system-specific memory allocation
-// functions.
+// restrictions. Within an active ScratchScope the memory is taken from the scratch arena of
+// the calling thread. Otherwise it is requested from the currently installed memory resource
+// (see getMemoryResource()). In case the memory accounting is enabled, the allocation is
+// recorded for the given memory category.
 */
-inline byte_t* allocate_backend( size_t size, size_t alignment )
+inline byte_t* allocate_backend( size_t size, size_t alignment,
+                                 MemoryCategory category = generalMemory )
 {
-   void* raw( nullptr );
-
-#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR)
-   raw = _aligned_malloc( size, alignment );
-   if( raw == nullptr ) {
-#elif defined(__MINGW32__)
-   raw = __mingw_aligned_malloc( size, alignment );
-   if( raw == nullptr ) {
-#else
-   if( posix_memalign( &raw, alignment, size ) ) {
-#endif
-      BLAZE_THROW_BAD_ALLOC;
+   if( byte_t* const scratch = ScratchArena::allocate( size, alignment ) ) {
+      MemoryAccounting::recordAllocation( size, category );
+      return scratch;
    }
 
-   return reinterpret_cast<byte_t*>( raw );
+   MemoryResource* const resource( getMemoryResource() );
+   const size_t headersize( allocationHeaderSize( alignment ) );
+
+   byte_t* const raw( resource->allocate( size+headersize, alignment ) );
+   byte_t* const address( raw + headersize );
+
+   AllocationHeader* const header( reinterpret_cast<AllocationHeader*>( address ) - 1 );
+   header->resource  = resource;
+   header->size      = size+headersize;
+   header->alignment = alignment;
+
+   MemoryAccounting::recordAllocation( size, category );
+
+   return address;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -107,17 +164,28 @@ inline byte_t* allocate_backend( size_t size, size_t alignment )
 // \return void
 //
 // This function deallocates the given memory that was previously allocated via the allocate()
-// function. For that purpose it uses the according system-specific memory deallocation functions.
+// function. Memory that was taken from a scratch arena is returned to the according arena, all
+// other memory is returned to the memory resource it was allocated from.
 */
 inline void deallocate_backend( const void* address ) noexcept
 {
-#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR)
-   _aligned_free( const_cast<void*>( address ) );
-#elif defined(__MINGW32__)
-   __mingw_aligned_free( const_cast<void*>( address ) );
-#else
-   free( const_cast<void*>( address ) );
-#endif
+   size_t bytes( 0UL );
+
+   if( ScratchArena::deallocate( address, bytes ) ) {
+      MemoryAccounting::recordDeallocation( bytes );
+      return;
+   }
+
+   byte_t* const block( const_cast<byte_t*>( reinterpret_cast<const byte_t*>( address ) ) );
+   const AllocationHeader* const header( reinterpret_cast<const AllocationHeader*>( block ) - 1 );
+
+   MemoryResource* const resource( header->resource );
+   const size_t size     ( header->size );
+   const size_t alignment( header->alignment );
+
+   MemoryAccounting::recordDeallocation( size - allocationHeaderSize( alignment ) );
+
+   resource->deallocate( block - allocationHeaderSize( alignment ), size, alignment );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -136,6 +204,7 @@ inline void deallocate_backend( const void* address ) noexcept
 // \ingroup util
 //
 // \param size The number of elements of the given type to allocate.
+// \param category The memory category of the allocation (see getMemoryStatistics()).
 // \return Pointer to the first element of the aligned array.
 // \exception std::bad_alloc Allocation failed.
 //
@@ -152,14 +221,11 @@ inline void deallocate_backend( const void* address ) noexcept
    \endcode
 */
 template< typename T >
-EnableIf_< IsBuiltin<T>, T* > allocate( size_t size )
+EnableIf_< IsBuiltin<T>, T* > allocate( size_t size, MemoryCategory category = generalMemory )
 {
-   const size_t alignment( AlignmentOf<T>::value );
+   const size_t alignment( allocationAlignment( AlignmentOf<T>::value ) );
 
-   if( alignment >= 8UL ) {
-      return reinterpret_cast<T*>( allocate_backend( size*sizeof(T), alignment ) );
-   }
-   else return ::new T[size];
+   return reinterpret_cast<T*>( allocate_backend( size*sizeof(T), alignment, category ) );
 }
 //*************************************************************************************************
 
@@ -169,6 +235,7 @@ EnableIf_< IsBuiltin<T>, T* > allocate( size_t size )
 // \ingroup util
 //
 // \param size The number of elements of the given type to allocate.
+// \param category The memory category of the allocation (see getMemoryStatistics()).
 // \return Pointer to the first element of the aligned array.
 // \exception std::bad_alloc Allocation failed.
 //
@@ -181,37 +248,33 @@ EnableIf_< IsBuiltin<T>, T* > allocate( size_t size )
 // constructed are destroyed in reverse order and the allocated memory is deallocated again.
 */
 template< typename T >
-DisableIf_< IsBuiltin<T>, T* > allocate( size_t size )
+DisableIf_< IsBuiltin<T>, T* > allocate( size_t size, MemoryCategory category = generalMemory )
 {
-   const size_t alignment ( AlignmentOf<T>::value );
+   const size_t alignment ( allocationAlignment( AlignmentOf<T>::value ) );
    const size_t headersize( ( sizeof(size_t) < alignment ) ? ( alignment ) : ( sizeof( size_t ) ) );
 
    BLAZE_INTERNAL_ASSERT( headersize >= alignment      , "Invalid header size detected" );
    BLAZE_INTERNAL_ASSERT( headersize % alignment == 0UL, "Invalid header size detected" );
 
-   if( alignment >= 8UL )
-   {
-      byte_t* const raw( allocate_backend( size*sizeof(T)+headersize, alignment ) );
-
-      *reinterpret_cast<size_t*>( raw ) = size;
+   byte_t* const raw( allocate_backend( size*sizeof(T)+headersize, alignment, category ) );
 
-      T* const address( reinterpret_cast<T*>( raw + headersize ) );
-      size_t i( 0UL );
+   *reinterpret_cast<size_t*>( raw ) = size;
 
-      try {
-         for( ; i<size; ++i )
-            ::new (address+i) T();
-      }
-      catch( ... ) {
-         while( i != 0UL )
-            address[--i].~T();
-         deallocate_backend( raw );
-         throw;
-      }
+   T* const address( reinterpret_cast<T*>( raw + headersize ) );
+   size_t i( 0UL );
 
-      return address;
+   try {
+      for( ; i<size; ++i )
+         ::new (address+i) T();
    }
-   else return ::new T[size];
+   catch( ... ) {
+      while( i != 0UL )
+         address[--i].~T();
+      deallocate_backend( raw );
+      throw;
+   }
+
+   return address;
 }
 //*************************************************************************************************
 
@@ -232,12 +295,7 @@ EnableIf_< IsBuiltin<T> > deallocate( T* address ) noexcept
    if( address == nullptr )
       return;
 
-   const size_t alignment( AlignmentOf<T>::value );
-
-   if( alignment >= 8UL ) {
-      deallocate_backend( address );
-   }
-   else delete[] address;
+   deallocate_backend( address );
 }
 //*************************************************************************************************
 
@@ -258,23 +316,19 @@ DisableIf_< IsBuiltin<T> > deallocate( T* address )
    if( address == nullptr )
       return;
 
-   const size_t alignment ( AlignmentOf<T>::value );
+   const size_t alignment ( allocationAlignment( AlignmentOf<T>::value ) );
    const size_t headersize( ( sizeof(size_t) < alignment ) ? ( alignment ) : ( sizeof( size_t ) ) );
 
    BLAZE_INTERNAL_ASSERT( headersize >= alignment      , "Invalid header size detected" );
    BLAZE_INTERNAL_ASSERT( headersize % alignment == 0UL, "Invalid header size detected" );
 
-   if( alignment >= 8UL )
-   {
-      const byte_t* const raw = reinterpret_cast<byte_t*>( address ) - headersize;
+   const byte_t* const raw = reinterpret_cast<byte_t*>( address ) - headersize;
 
-      const size_t size( *reinterpret_cast<const size_t*>( raw ) );
-      for( size_t i=0UL; i<size; ++i )
-         address[i].~T();
+   const size_t size( *reinterpret_cast<const size_t*>( raw ) );
+   for( size_t i=0UL; i<size; ++i )
+      address[i].~T();
 
-      deallocate_backend( raw );
-   }
-   else delete[] address;
+   deallocate_backend( raw );
 }
 //*************************************************************************************************
 
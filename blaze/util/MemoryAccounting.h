@@ -0,0 +1,550 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryAccounting.h
+//  \brief Header file for the memory accounting
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_UTIL_MEMORYACCOUNTING_H_
+#define _BLAZE_UTIL_MEMORYACCOUNTING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <atomic>
+#include <ostream>
+#include <blaze/system/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MEMORY CATEGORIES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Categories of the memory accounting.
+// \ingroup util
+//
+// The memory categories distinguish the allocations of the different \b Blaze data structures
+// in the memory accounting (see getMemoryStatistics()). Note that the temporaries created during
+// the evaluation of expressions are accounted to the category of their data structure (as for
+// instance DynamicMatrix for the temporary of a dense matrix multiplication).
+*/
+enum MemoryCategory
+{
+   generalMemory      = 0,  //!< Allocations of all other data structures.
+   denseVectorMemory  = 1,  //!< Allocations of DynamicVector.
+   denseMatrixMemory  = 2,  //!< Allocations of DynamicMatrix.
+   sparseVectorMemory = 3,  //!< Allocations of CompressedVector.
+   sparseMatrixMemory = 4,  //!< Allocations of CompressedMatrix.
+   memoryCategories   = 5   //!< The total number of memory categories.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STRUCT MEMORYSTATISTICS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Statistics of the memory accounting.
+// \ingroup util
+//
+// The MemoryStatistics struct represents the state of the memory accounting at a given point in
+// time (see getMemoryStatistics()) or the memory activity within the lifetime of a MemorySnapshot.
+*/
+struct MemoryStatistics
+{
+   size_t currentBytes;      //!< The number of bytes currently in use.
+   size_t peakBytes;         //!< The maximum number of bytes in use at the same time.
+   size_t allocations;       //!< The number of allocations.
+   size_t deallocations;     //!< The number of deallocations.
+   size_t allocatedBytes;    //!< The total number of allocated bytes.
+   size_t deallocatedBytes;  //!< The total number of deallocated bytes.
+   std::array<size_t,memoryCategories> categoryAllocations;  //!< The allocations per category.
+   std::array<size_t,memoryCategories> categoryBytes;        //!< The allocated bytes per category.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for the MemoryStatistics struct.
+// \ingroup util
+//
+// \param os Reference to the output stream.
+// \param stats The memory statistics to be printed.
+// \return Reference to the output stream.
+*/
+inline std::ostream& operator<<( std::ostream& os, const MemoryStatistics& stats )
+{
+   static const char* const names[memoryCategories] = {
+      "General", "DynamicVector", "DynamicMatrix", "CompressedVector", "CompressedMatrix"
+   };
+
+   os << " Current bytes  : " << stats.currentBytes << "\n"
+      << " Peak bytes     : " << stats.peakBytes << "\n"
+      << " Allocations    : " << stats.allocations << " (" << stats.allocatedBytes << " bytes)\n"
+      << " Deallocations  : " << stats.deallocations << " (" << stats.deallocatedBytes << " bytes)\n";
+
+   for( size_t i=0UL; i<memoryCategories; ++i ) {
+      os << "   " << names[i] << ": " << stats.categoryAllocations[i]
+         << " (" << stats.categoryBytes[i] << " bytes)\n";
+   }
+
+   return os;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MEMORYACCOUNTING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Global counters of the memory accounting.
+// \ingroup util
+//
+// The MemoryAccounting class holds the atomic counters of the memory accounting. All functions
+// are no-ops in case the memory accounting is disabled (see the BLAZE_USE_MEMORY_ACCOUNTING
+// configuration switch).
+*/
+class MemoryAccounting
+{
+ public:
+   //**Recording functions*************************************************************************
+   /*!\name Recording functions */
+   //@{
+   static inline void recordAllocation  ( size_t bytes, MemoryCategory category ) noexcept;
+   static inline void recordDeallocation( size_t bytes ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Query functions*****************************************************************************
+   /*!\name Query functions */
+   //@{
+   static inline MemoryStatistics statistics() noexcept;
+   static inline size_t           beginScope() noexcept;
+   static inline size_t           endScope( size_t previous ) noexcept;
+   static inline size_t           scopePeak() noexcept;
+   static inline void             resetPeak() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief The set of atomic counters. */
+   struct Counters
+   {
+      std::atomic<size_t> current;           //!< The number of bytes currently in use.
+      std::atomic<size_t> peak;              //!< The global peak of bytes in use.
+      std::atomic<size_t> scopePeak;         //!< The peak of the innermost snapshot.
+      std::atomic<size_t> allocations;       //!< The number of allocations.
+      std::atomic<size_t> deallocations;     //!< The number of deallocations.
+      std::atomic<size_t> allocatedBytes;    //!< The total number of allocated bytes.
+      std::atomic<size_t> deallocatedBytes;  //!< The total number of deallocated bytes.
+      std::array<std::atomic<size_t>,memoryCategories> categoryAllocations;  //!< Allocations per category.
+      std::array<std::atomic<size_t>,memoryCategories> categoryBytes;        //!< Bytes per category.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline Counters& counters() noexcept;
+   static inline void      updateMax( std::atomic<size_t>& value, size_t candidate ) noexcept;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records an allocation of the given number of bytes.
+//
+// \param bytes The number of allocated bytes.
+// \param category The memory category of the allocation.
+// \return void
+*/
+inline void MemoryAccounting::recordAllocation( size_t bytes, MemoryCategory category ) noexcept
+{
+   if( !memoryAccounting )
+      return;
+
+   Counters& c( counters() );
+
+   const size_t current( c.current.fetch_add( bytes, std::memory_order_relaxed ) + bytes );
+   updateMax( c.peak, current );
+   updateMax( c.scopePeak, current );
+
+   c.allocations.fetch_add( 1UL, std::memory_order_relaxed );
+   c.allocatedBytes.fetch_add( bytes, std::memory_order_relaxed );
+   c.categoryAllocations[category].fetch_add( 1UL, std::memory_order_relaxed );
+   c.categoryBytes[category].fetch_add( bytes, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records a deallocation of the given number of bytes.
+//
+// \param bytes The number of deallocated bytes.
+// \return void
+*/
+inline void MemoryAccounting::recordDeallocation( size_t bytes ) noexcept
+{
+   if( !memoryAccounting )
+      return;
+
+   Counters& c( counters() );
+
+   c.current.fetch_sub( bytes, std::memory_order_relaxed );
+   c.deallocations.fetch_add( 1UL, std::memory_order_relaxed );
+   c.deallocatedBytes.fetch_add( bytes, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current state of all counters.
+//
+// \return The current memory statistics.
+*/
+inline MemoryStatistics MemoryAccounting::statistics() noexcept
+{
+   MemoryStatistics stats{};
+
+   if( !memoryAccounting )
+      return stats;
+
+   const Counters& c( counters() );
+
+   stats.currentBytes     = c.current.load( std::memory_order_relaxed );
+   stats.peakBytes        = c.peak.load( std::memory_order_relaxed );
+   stats.allocations      = c.allocations.load( std::memory_order_relaxed );
+   stats.deallocations    = c.deallocations.load( std::memory_order_relaxed );
+   stats.allocatedBytes   = c.allocatedBytes.load( std::memory_order_relaxed );
+   stats.deallocatedBytes = c.deallocatedBytes.load( std::memory_order_relaxed );
+
+   for( size_t i=0UL; i<memoryCategories; ++i ) {
+      stats.categoryAllocations[i] = c.categoryAllocations[i].load( std::memory_order_relaxed );
+      stats.categoryBytes[i]       = c.categoryBytes[i].load( std::memory_order_relaxed );
+   }
+
+   return stats;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Starts the peak tracking of a new snapshot.
+//
+// \return The peak of the enclosing snapshot.
+*/
+inline size_t MemoryAccounting::beginScope() noexcept
+{
+   if( !memoryAccounting )
+      return 0UL;
+
+   Counters& c( counters() );
+   return c.scopePeak.exchange( c.current.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Ends the peak tracking of a snapshot.
+//
+// \param previous The peak of the enclosing snapshot (as returned by beginScope()).
+// \return The peak of the ended snapshot.
+//
+// The peak of the enclosing snapshot is restored, taking the peak of the ended snapshot into
+// account.
+*/
+inline size_t MemoryAccounting::endScope( size_t previous ) noexcept
+{
+   if( !memoryAccounting )
+      return 0UL;
+
+   Counters& c( counters() );
+   const size_t peak( c.scopePeak.load( std::memory_order_relaxed ) );
+   c.scopePeak.store( ( previous < peak ) ? peak : previous, std::memory_order_relaxed );
+   return peak;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the peak of the innermost snapshot.
+//
+// \return The peak of the innermost snapshot.
+*/
+inline size_t MemoryAccounting::scopePeak() noexcept
+{
+   if( !memoryAccounting )
+      return 0UL;
+
+   return counters().scopePeak.load( std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the global peak to the number of bytes currently in use.
+//
+// \return void
+*/
+inline void MemoryAccounting::resetPeak() noexcept
+{
+   if( !memoryAccounting )
+      return;
+
+   Counters& c( counters() );
+   c.peak.store( c.current.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the global set of counters.
+//
+// \return Reference to the counters.
+//
+// The counters are intentionally never destroyed, since memory might be released during the
+// destruction of static objects.
+*/
+inline MemoryAccounting::Counters& MemoryAccounting::counters() noexcept
+{
+   static Counters* const c = new Counters();
+   return *c;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Atomically raises the given value to the given candidate.
+//
+// \param value The value to be updated.
+// \param candidate The candidate for the new maximum.
+// \return void
+*/
+inline void MemoryAccounting::updateMax( std::atomic<size_t>& value, size_t candidate ) noexcept
+{
+   size_t old( value.load( std::memory_order_relaxed ) );
+   while( old < candidate &&
+          !value.compare_exchange_weak( old, candidate, std::memory_order_relaxed ) ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current state of the memory accounting.
+// \ingroup util
+//
+// \return The current memory statistics.
+//
+// This function returns the current state of the memory accounting of all \b Blaze data
+// structures and temporaries of all threads:
+
+   \code
+   #define BLAZE_USE_MEMORY_ACCOUNTING 1
+   #include <blaze/Blaze.h>
+
+   // ... Computation
+
+   const blaze::MemoryStatistics stats( blaze::getMemoryStatistics() );
+   std::cout << "Peak memory usage: " << stats.peakBytes << " bytes\n";
+   \endcode
+
+// In case the memory accounting is disabled (see the BLAZE_USE_MEMORY_ACCOUNTING configuration
+// switch), all counters are zero.
+*/
+inline MemoryStatistics getMemoryStatistics() noexcept
+{
+   return MemoryAccounting::statistics();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the peak memory usage to the number of bytes currently in use.
+// \ingroup util
+//
+// \return void
+*/
+inline void resetPeakMemory() noexcept
+{
+   MemoryAccounting::resetPeak();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MEMORYSNAPSHOT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Snapshot of the memory activity within a scope.
+// \ingroup util
+//
+// The MemorySnapshot class records the memory activity within its lifetime. The statistics()
+// function returns the number of allocations and deallocations and the number of allocated and
+// deallocated bytes since the construction of the snapshot, the number of bytes currently in use
+// and the peak number of bytes in use since the construction:
+
+   \code
+   {
+      blaze::MemorySnapshot snapshot;
+
+      C = A * B + D;
+
+      const blaze::MemoryStatistics stats( snapshot.statistics() );
+      if( stats.allocations > 0UL ) {
+         std::cerr << "Unexpected temporaries:\n" << stats;
+      }
+   }
+   \endcode
+
+// Snapshots can be nested. Note that the memory accounting is global, i.e. the activity of
+// all threads is recorded, and that snapshots have to be destroyed in reverse order of their
+// construction. In case the memory accounting is disabled (see the BLAZE_USE_MEMORY_ACCOUNTING
+// configuration switch), all counters are zero.
+*/
+class MemorySnapshot : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MemorySnapshot() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemorySnapshot();
+   //@}
+   //**********************************************************************************************
+
+   //**Query functions*****************************************************************************
+   /*!\name Query functions */
+   //@{
+   inline MemoryStatistics statistics() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MemoryStatistics start_;     //!< The memory statistics at the construction of the snapshot.
+   size_t           previous_;  //!< The peak of the enclosing snapshot.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the MemorySnapshot class.
+*/
+inline MemorySnapshot::MemorySnapshot() noexcept
+   : start_   ( MemoryAccounting::statistics() )  // The memory statistics at construction
+   , previous_( MemoryAccounting::beginScope() )  // The peak of the enclosing snapshot
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the MemorySnapshot class.
+*/
+inline MemorySnapshot::~MemorySnapshot()
+{
+   MemoryAccounting::endScope( previous_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the memory activity since the construction of the snapshot.
+//
+// \return The memory statistics of the snapshot.
+*/
+inline MemoryStatistics MemorySnapshot::statistics() const noexcept
+{
+   MemoryStatistics stats( MemoryAccounting::statistics() );
+
+   stats.peakBytes         = MemoryAccounting::scopePeak();
+   stats.allocations      -= start_.allocations;
+   stats.deallocations    -= start_.deallocations;
+   stats.allocatedBytes   -= start_.allocatedBytes;
+   stats.deallocatedBytes -= start_.deallocatedBytes;
+
+   for( size_t i=0UL; i<memoryCategories; ++i ) {
+      stats.categoryAllocations[i] -= start_.categoryAllocations[i];
+      stats.categoryBytes[i]       -= start_.categoryBytes[i];
+   }
+
+   return stats;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
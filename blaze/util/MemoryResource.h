@@ -0,0 +1,592 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryResource.h
+//  \brief Header file for the memory resource interface and the global allocator hook
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MEMORYRESOURCE_H_
+#define _BLAZE_UTIL_MEMORYRESOURCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR) || defined(__MINGW32__)
+#  include <malloc.h>
+#endif
+#if defined(__linux__)
+#  include <sys/mman.h>
+#endif
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <blaze/system/Memory.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS MEMORYRESOURCE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base class for all memory resources.
+// \ingroup util
+//
+// The MemoryResource class represents the interface of all memory resources that can be used
+// to provide the memory of all \b Blaze data structures (as for instance DynamicVector,
+// DynamicMatrix, CompressedVector and CompressedMatrix) and of all temporaries created during
+// the evaluation of expressions. A memory resource has to implement the allocate() and the
+// deallocate() functions:
+
+   \code
+   class NumaResource : public blaze::MemoryResource
+   {
+    public:
+      blaze::byte_t* allocate( size_t size, size_t alignment ) override;
+      void deallocate( blaze::byte_t* address, size_t size, size_t alignment ) noexcept override;
+   };
+   \endcode
+
+// The allocate() function is required to return memory of at least \a size bytes that is aligned
+// to the given \a alignment (which is always a power of two and at least <tt>sizeof(void*)</tt>).
+// In case the memory cannot be provided, a \a std::bad_alloc exception has to be thrown. The
+// deallocate() function is called with the same size and alignment that were used for the
+// allocation. A memory resource can be installed globally via setMemoryResource() or for the
+// calling thread via a MemoryResourceScope.
+*/
+class MemoryResource
+{
+ public:
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   virtual ~MemoryResource() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   virtual byte_t* allocate  ( size_t size, size_t alignment ) = 0;
+   virtual void    deallocate( byte_t* address, size_t size, size_t alignment ) noexcept = 0;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SYSTEMMEMORYRESOURCE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Huge page modes of the SystemMemoryResource class.
+// \ingroup util
+*/
+enum HugePageMode
+{
+   noHugePages          = 0,  //!< Huge pages are not used.
+   transparentHugePages = 1,  //!< Large allocations use transparent huge pages.
+   explicitHugePages    = 2   //!< Large allocations use explicitly reserved huge pages.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Memory resource based on the system-specific aligned allocation functions.
+// \ingroup util
+//
+// The SystemMemoryResource class is the default memory resource of \b Blaze. It requests the
+// memory via the according system-specific aligned memory allocation functions. On Linux systems
+// allocations of at least the given threshold are backed by huge pages in order to reduce the
+// number of TLB misses during the traversal of large vectors and matrices:
+//
+//  - \a noHugePages: Huge pages are not used.
+//  - \a transparentHugePages: Large allocations are mapped directly from the operating system,
+//    aligned to 2 MiB and marked as eligible for transparent huge pages via \c madvise().
+//  - \a explicitHugePages: Large allocations are taken from the explicitly reserved huge pages
+//    of the system (hugetlbfs). In case no huge pages are available, transparent huge pages are
+//    used instead.
+//
+// The default memory resource of \b Blaze uses the huge page mode and threshold specified by
+// the BLAZE_HUGE_PAGE_MODE and BLAZE_HUGE_PAGE_THRESHOLD configuration switches. A resource
+// with a different setting can be installed via setMemoryResource() or MemoryResourceScope:
+
+   \code
+   blaze::SystemMemoryResource resource( blaze::explicitHugePages, 4UL*1024UL*1024UL );
+   blaze::setMemoryResource( &resource );
+   \endcode
+*/
+class SystemMemoryResource : public MemoryResource
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline SystemMemoryResource( HugePageMode mode = static_cast<HugePageMode>( hugePageMode )
+                                       , size_t threshold = hugePageThreshold ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline byte_t* allocate  ( size_t size, size_t alignment ) override;
+   inline void    deallocate( byte_t* address, size_t size, size_t alignment ) noexcept override;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline HugePageMode mode() const noexcept;
+   inline size_t       threshold() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool useHugePages( size_t size ) const noexcept;
+
+   static inline byte_t* allocateHugePages  ( size_t size, bool hugetlbfs );
+   static inline void    deallocateHugePages( byte_t* address, size_t size ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const HugePageMode mode_;       //!< The huge page mode of the resource.
+   const size_t       threshold_;  //!< The minimum size of huge page allocations.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the SystemMemoryResource class.
+//
+// \param mode The huge page mode of the resource.
+// \param threshold The minimum size (in bytes) of an allocation to be backed by huge pages.
+*/
+inline SystemMemoryResource::SystemMemoryResource( HugePageMode mode, size_t threshold ) noexcept
+   : mode_     ( mode )       // The huge page mode of the resource
+   , threshold_( threshold )  // The minimum size of huge page allocations
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of aligned memory via the system-specific allocation functions.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Byte pointer to the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+*/
+inline byte_t* SystemMemoryResource::allocate( size_t size, size_t alignment )
+{
+   if( useHugePages( size ) ) {
+      return allocateHugePages( size, mode_ == explicitHugePages );
+   }
+
+   void* raw( nullptr );
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR)
+   raw = _aligned_malloc( size, alignment );
+   if( raw == nullptr ) {
+#elif defined(__MINGW32__)
+   raw = __mingw_aligned_malloc( size, alignment );
+   if( raw == nullptr ) {
+#else
+   if( posix_memalign( &raw, alignment, size ) ) {
+#endif
+      BLAZE_THROW_BAD_ALLOC;
+   }
+
+   return reinterpret_cast<byte_t*>( raw );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of aligned memory via the system-specific deallocation functions.
+//
+// \param address The address of the memory to be deallocated.
+// \param size The number of bytes that were allocated.
+// \param alignment The alignment of the allocation (unused).
+// \return void
+*/
+inline void SystemMemoryResource::deallocate( byte_t* address, size_t size, size_t alignment ) noexcept
+{
+   UNUSED_PARAMETER( alignment );
+
+   if( useHugePages( size ) ) {
+      deallocateHugePages( address, size );
+      return;
+   }
+
+#if defined(_MSC_VER) || defined(__MINGW64_VERSION_MAJOR)
+   _aligned_free( address );
+#elif defined(__MINGW32__)
+   __mingw_aligned_free( address );
+#else
+   free( address );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the huge page mode of the resource.
+//
+// \return The huge page mode.
+*/
+inline HugePageMode SystemMemoryResource::mode() const noexcept
+{
+   return mode_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the minimum size of an allocation to be backed by huge pages.
+//
+// \return The huge page threshold in bytes.
+*/
+inline size_t SystemMemoryResource::threshold() const noexcept
+{
+   return threshold_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether an allocation of the given size is backed by huge pages.
+//
+// \param size The number of bytes of the allocation.
+// \return \a true in case huge pages are used, \a false if not.
+*/
+inline bool SystemMemoryResource::useHugePages( size_t size ) const noexcept
+{
+#if defined(__linux__)
+   return mode_ != noHugePages && size >= threshold_;
+#else
+   UNUSED_PARAMETER( size );
+   return false;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocation of memory backed by huge pages.
+//
+// \param size The number of bytes to be allocated.
+// \param hugetlbfs \a true to first try explicitly reserved huge pages.
+// \return Byte pointer to the allocated memory (aligned to 2 MiB).
+// \exception std::bad_alloc Allocation failed.
+//
+// The size of the mapping is rounded up to the next multiple of the huge page size.
+*/
+inline byte_t* SystemMemoryResource::allocateHugePages( size_t size, bool hugetlbfs )
+{
+#if defined(__linux__)
+   const size_t bytes( ( size + hugePageSize - 1UL ) / hugePageSize * hugePageSize );
+
+#  if defined(MAP_HUGETLB)
+   if( hugetlbfs ) {
+      void* const raw( ::mmap( nullptr, bytes, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 ) );
+      if( raw != MAP_FAILED )
+         return reinterpret_cast<byte_t*>( raw );
+   }
+#  else
+   UNUSED_PARAMETER( hugetlbfs );
+#  endif
+
+   void* const raw( ::mmap( nullptr, bytes + hugePageSize, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) );
+
+   if( raw == MAP_FAILED ) {
+      BLAZE_THROW_BAD_ALLOC;
+   }
+
+   byte_t* const begin       ( reinterpret_cast<byte_t*>( raw ) );
+   byte_t* const alignedBegin( reinterpret_cast<byte_t*>(
+      ( reinterpret_cast<size_t>( begin ) + hugePageSize - 1UL ) / hugePageSize * hugePageSize ) );
+
+   if( alignedBegin != begin ) {
+      ::munmap( begin, static_cast<size_t>( alignedBegin - begin ) );
+   }
+   if( alignedBegin + bytes != begin + bytes + hugePageSize ) {
+      ::munmap( alignedBegin + bytes, static_cast<size_t>( begin + hugePageSize - alignedBegin ) );
+   }
+
+#  if defined(MADV_HUGEPAGE)
+   ::madvise( alignedBegin, bytes, MADV_HUGEPAGE );
+#  endif
+
+   return alignedBegin;
+#else
+   UNUSED_PARAMETER( size, hugetlbfs );
+   BLAZE_THROW_BAD_ALLOC;
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deallocation of memory backed by huge pages.
+//
+// \param address The address of the memory to be deallocated.
+// \param size The number of bytes that were allocated.
+// \return void
+*/
+inline void SystemMemoryResource::deallocateHugePages( byte_t* address, size_t size ) noexcept
+{
+#if defined(__linux__)
+   const size_t bytes( ( size + hugePageSize - 1UL ) / hugePageSize * hugePageSize );
+   ::munmap( address, bytes );
+#else
+   UNUSED_PARAMETER( address, size );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the system memory resource.
+// \ingroup util
+//
+// \return Pointer to the system memory resource.
+//
+// The system memory resource is intentionally never destroyed, since memory might be released
+// during the destruction of static objects.
+*/
+inline MemoryResource* systemMemoryResource() noexcept
+{
+   static SystemMemoryResource* const resource = new SystemMemoryResource();
+   return resource;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the globally installed memory resource.
+// \ingroup util
+//
+// \return Reference to the atomic pointer to the global memory resource.
+*/
+inline std::atomic<MemoryResource*>& globalMemoryResource() noexcept
+{
+   static std::atomic<MemoryResource*> resource( nullptr );
+   return resource;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the memory resource installed for the calling thread.
+// \ingroup util
+//
+// \return Reference to the pointer to the memory resource of the calling thread.
+*/
+inline MemoryResource*& threadMemoryResource() noexcept
+{
+   static thread_local MemoryResource* resource( nullptr );
+   return resource;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the memory resource that is currently used by the calling thread.
+// \ingroup util
+//
+// \return Pointer to the memory resource of the calling thread.
+//
+// This function returns the memory resource that is used for all allocations on the calling
+// thread. This is the resource installed via the innermost active MemoryResourceScope, the
+// globally installed resource (see setMemoryResource()), or the system memory resource, in
+// this order.
+*/
+inline MemoryResource* getMemoryResource() noexcept
+{
+   if( MemoryResource* const resource = threadMemoryResource() )
+      return resource;
+   if( MemoryResource* const resource = globalMemoryResource().load( std::memory_order_acquire ) )
+      return resource;
+   return systemMemoryResource();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Installs the given memory resource for all threads.
+// \ingroup util
+//
+// \param resource The memory resource to be installed (\a nullptr for the system resource).
+// \return The previously installed memory resource.
+//
+// This function installs the given memory resource as global allocator of \b Blaze. All
+// subsequent allocations of all threads (that don't use a MemoryResourceScope) are served by
+// the given resource:
+
+   \code
+   blaze::PoolMemoryResource pool( 1UL << 30 );  // Pre-reserving 1 GiB at startup
+   blaze::setMemoryResource( &pool );
+   \endcode
+
+// Memory is always returned to the resource it was allocated from, independent of the resource
+// that is installed at the time of the deallocation. Therefore the resource must outlive all
+// memory allocated from it.
+*/
+inline MemoryResource* setMemoryResource( MemoryResource* resource ) noexcept
+{
+   return globalMemoryResource().exchange( resource, std::memory_order_acq_rel );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MEMORYRESOURCESCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII scope for the installation of a memory resource on the calling thread.
+// \ingroup util
+//
+// Within the lifetime of a MemoryResourceScope all allocations of the calling thread are served
+// by the given memory resource:
+
+   \code
+   NumaResource local( node );
+
+   {
+      blaze::MemoryResourceScope scope( local );
+
+      blaze::DynamicMatrix<double> A( 1000UL, 1000UL );  // Allocated from 'local'
+      B = A * A;                                         // Temporaries allocated from 'local'
+   }
+   \endcode
+
+// Scopes can be nested. Data structures that are copied or moved keep the memory resource of
+// their memory: Moved data structures steal the memory of the source, copies allocate from the
+// currently installed resource. Note that the worker threads of the shared-memory parallelization
+// are not affected by the scope of the calling thread.
+*/
+class MemoryResourceScope : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MemoryResourceScope( MemoryResource& resource ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryResourceScope();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MemoryResource* previous_;  //!< The previously installed memory resource of the thread.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the MemoryResourceScope class.
+//
+// \param resource The memory resource to be installed for the calling thread.
+*/
+inline MemoryResourceScope::MemoryResourceScope( MemoryResource& resource ) noexcept
+   : previous_( threadMemoryResource() )  // The previously installed memory resource
+{
+   threadMemoryResource() = &resource;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the MemoryResourceScope class.
+*/
+inline MemoryResourceScope::~MemoryResourceScope()
+{
+   threadMemoryResource() = previous_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,319 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/PoolMemoryResource.h
+//  \brief Header file for the pre-reserved pool memory resource
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_POOLMEMORYRESOURCE_H_
+#define _BLAZE_UTIL_POOLMEMORYRESOURCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <mutex>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MemoryResource.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory resource based on a single, pre-reserved memory region.
+// \ingroup util
+//
+// The PoolMemoryResource class reserves a single memory region of the given capacity on
+// construction and serves all subsequent requests from this region. Thus after construction
+// the system allocator is never touched again. The memory is handed out in blocks of power of
+// two sizes. Released blocks are kept in one free list per block size and are reused for
+// subsequent requests of the same size class. In case the pool is exhausted, a \a std::bad_alloc
+// exception is thrown. All blocks are aligned to at least \a maxAlignment bytes, requests for
+// a larger alignment result in a \a std::bad_alloc exception. All operations are thread-safe.
+
+   \code
+   blaze::PoolMemoryResource pool( 512UL*1024UL*1024UL );  // Reserving 512 MiB at startup
+   blaze::setMemoryResource( &pool );                      // Installing the pool for all threads
+   \endcode
+
+// Note that the pool must outlive all memory that has been allocated from it.
+*/
+class PoolMemoryResource : public MemoryResource
+                         , private NonCopyable
+{
+ public:
+   //**Constants***********************************************************************************
+   /*!\brief The alignment of all memory blocks and the size of the smallest size class. */
+   static constexpr size_t maxAlignment = 64UL;
+
+   /*!\brief The number of size classes. */
+   static constexpr size_t sizeClasses = 8UL*sizeof(size_t);
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline PoolMemoryResource( size_t capacity );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~PoolMemoryResource();
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline byte_t* allocate  ( size_t size, size_t alignment ) override;
+   inline void    deallocate( byte_t* address, size_t size, size_t alignment ) noexcept override;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t capacity() const noexcept;
+   inline size_t used() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief A single element of the free lists of the pool. */
+   struct FreeBlock {
+      FreeBlock* next_;  //!< Pointer to the next free block of the same size class.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t sizeClass( size_t size ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   mutable std::mutex mutex_;  //!< Synchronization of all allocations and deallocations.
+   byte_t* begin_;             //!< The first byte of the reserved memory region.
+   byte_t* end_;               //!< The end of the memory region.
+   byte_t* top_;               //!< The first byte that has not been handed out yet.
+   size_t  used_;              //!< The number of bytes currently in use.
+   std::array<FreeBlock*,sizeClasses> free_;  //!< The free lists of all size classes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PoolMemoryResource class.
+//
+// \param capacity The capacity of the pool in bytes.
+// \exception std::bad_alloc Allocation failed.
+*/
+inline PoolMemoryResource::PoolMemoryResource( size_t capacity )
+   : mutex_()                                                 // Synchronization of all allocations
+   , begin_( systemMemoryResource()->allocate( capacity, maxAlignment ) )  // The reserved memory region
+   , end_  ( begin_+capacity )                                // The end of the memory region
+   , top_  ( begin_ )                                         // The first byte not handed out yet
+   , used_ ( 0UL )                                            // The number of bytes currently in use
+   , free_ ()                                                 // The free lists of all size classes
+{
+   free_.fill( nullptr );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the PoolMemoryResource class.
+*/
+inline PoolMemoryResource::~PoolMemoryResource()
+{
+   systemMemoryResource()->deallocate( begin_, capacity(), maxAlignment );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of memory from the pool.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Byte pointer to the allocated memory.
+// \exception std::bad_alloc Pool exhausted or unsupported alignment.
+*/
+inline byte_t* PoolMemoryResource::allocate( size_t size, size_t alignment )
+{
+   if( alignment > maxAlignment || size > capacity() ) {
+      BLAZE_THROW_BAD_ALLOC;
+   }
+
+   const size_t index( sizeClass( size ) );
+   const size_t bytes( maxAlignment << index );
+
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   if( FreeBlock* const block = free_[index] ) {
+      free_[index] = block->next_;
+      used_ += bytes;
+      return reinterpret_cast<byte_t*>( block );
+   }
+
+   if( bytes > static_cast<size_t>( end_ - top_ ) ) {
+      BLAZE_THROW_BAD_ALLOC;
+   }
+
+   byte_t* const address( top_ );
+   top_  += bytes;
+   used_ += bytes;
+
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the given memory to the pool.
+//
+// \param address The address of the memory to be deallocated.
+// \param size The number of bytes that were allocated.
+// \param alignment The alignment of the allocation (unused).
+// \return void
+*/
+inline void PoolMemoryResource::deallocate( byte_t* address, size_t size, size_t alignment ) noexcept
+{
+   UNUSED_PARAMETER( alignment );
+
+   BLAZE_INTERNAL_ASSERT( address >= begin_ && address < top_, "Invalid pool address detected" );
+
+   const size_t index( sizeClass( size ) );
+
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   FreeBlock* const block( reinterpret_cast<FreeBlock*>( address ) );
+   block->next_ = free_[index];
+   free_[index] = block;
+   used_ -= maxAlignment << index;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the capacity of the pool.
+//
+// \return The capacity of the pool in bytes.
+*/
+inline size_t PoolMemoryResource::capacity() const noexcept
+{
+   return static_cast<size_t>( end_ - begin_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes currently in use.
+//
+// \return The number of bytes currently handed out by the pool (rounded to the size classes).
+*/
+inline size_t PoolMemoryResource::used() const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+   return used_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the size class of the given number of bytes.
+//
+// \param size The number of bytes.
+// \return The index of the smallest size class that can hold the given number of bytes.
+*/
+inline size_t PoolMemoryResource::sizeClass( size_t size ) noexcept
+{
+   size_t index( 0UL );
+   while( ( maxAlignment << index ) < size ) {
+      ++index;
+   }
+   return index;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,582 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ScratchArena.h
+//  \brief Header file for the per-thread scratch arena
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SCRATCHARENA_H_
+#define _BLAZE_UTIL_SCRATCHARENA_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+#include <blaze/system/Memory.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Per-thread scratch arena for short-lived memory.
+// \ingroup util
+//
+// The ScratchArena class represents a contiguous, preallocated memory region of fixed capacity
+// (see the BLAZE_SCRATCH_ARENA_CAPACITY configuration switch), which is bound to a single thread
+// and serves the memory requests of the allocate() function within the lifetime of a ScratchScope.
+// Memory is handed out in a stack-like manner by bumping a top offset. Blocks that are released
+// on top of the stack are immediately reclaimed, blocks that are released out of order are reused
+// for subsequent requests of the same or a smaller size. Thus repeated evaluations that create
+// and destroy temporaries of the same size, for instance within a time-stepping loop, are served
+// without any call to the system allocator.
+//
+// Memory from the arena remains valid until it is released, independent of the lifetime of the
+// ScratchScope or the thread it was allocated by. Memory can be released by any thread. Arenas
+// are never destroyed, but are returned to a global pool on thread exit and reused by subsequent
+// threads.
+*/
+class ScratchArena : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief Header in front of each memory block of the arena. */
+   struct Header
+   {
+      Header*           prev;  //!< The header of the previous memory block.
+      size_t            top;   //!< The top offset before the allocation of the memory block.
+      size_t            size;  //!< The usable size of the memory block.
+      size_t            used;  //!< The number of bytes requested by the current allocation.
+      std::atomic<bool> free;  //!< Flag for released memory blocks.
+   };
+
+   /*!\brief Binding of a scratch arena to the calling thread. */
+   struct Binding
+   {
+      inline ~Binding() { if( arena != nullptr ) ScratchArena::release( arena ); }
+
+      ScratchArena* arena = nullptr;  //!< The scratch arena bound to the calling thread.
+      size_t        depth = 0UL;      //!< The number of active scratch scopes.
+   };
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   /*!\brief Maximum number of arenas and maximum number of reuse candidates per request. */
+   enum : size_t { maxArenas = 256UL, maxCandidates = 16UL };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   /*!\brief Global registry of all scratch arenas. */
+   struct Registry
+   {
+      std::mutex mutex;                                     //!< Synchronization of the pool.
+      std::array<std::atomic<ScratchArena*>,maxArenas> arenas;  //!< All created arenas.
+      std::atomic<size_t> count;                            //!< The number of created arenas.
+      std::vector<ScratchArena*> pool;                      //!< Currently unbound arenas.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   static inline byte_t* allocate( size_t size, size_t alignment ) noexcept;
+   static inline bool    deallocate( const void* address, size_t& size ) noexcept;
+   static inline bool    isActive() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ScratchArena( byte_t* begin, size_t capacity ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline byte_t* allocateBlock( size_t size, size_t alignment ) noexcept;
+   inline size_t  releaseBlock ( const void* address ) noexcept;
+   inline void    shrink() noexcept;
+   inline bool    owns( const void* address ) const noexcept;
+
+   static inline ScratchArena* acquire();
+   static inline void          release( ScratchArena* arena );
+   static inline Registry&     registry();
+   static inline Binding&      binding() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   byte_t* const begin_;  //!< The first byte of the arena.
+   byte_t* const end_;    //!< The end of the arena.
+   size_t        top_;    //!< The current top offset of the arena.
+   Header*       last_;   //!< The header of the topmost memory block.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class ScratchScope;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ScratchArena class.
+//
+// \param begin The first byte of the memory region of the arena.
+// \param capacity The capacity of the memory region.
+*/
+inline ScratchArena::ScratchArena( byte_t* begin, size_t capacity ) noexcept
+   : begin_( begin )             // The first byte of the arena
+   , end_  ( begin + capacity )  // The end of the arena
+   , top_  ( 0UL )               // The current top offset of the arena
+   , last_ ( nullptr )           // The header of the topmost memory block
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of memory from the scratch arena of the calling thread.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Pointer to the allocated memory, \a nullptr if the request cannot be served.
+//
+// This function allocates memory from the scratch arena of the calling thread in case a
+// ScratchScope is active. In case no scope is active or the arena is exhausted, the function
+// returns \a nullptr and the memory has to be requested from the system allocator.
+*/
+inline byte_t* ScratchArena::allocate( size_t size, size_t alignment ) noexcept
+{
+   if( scratchArenaCapacity == 0UL )
+      return nullptr;
+
+   Binding& b( binding() );
+
+   if( b.depth == 0UL || b.arena == nullptr )
+      return nullptr;
+
+   return b.arena->allocateBlock( size, alignment );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Release of memory that was allocated from a scratch arena.
+//
+// \param address The address of the memory to be released.
+// \param size Output parameter for the number of bytes of the released allocation.
+// \return \a true if the memory belongs to a scratch arena, \a false if not.
+//
+// This function releases the given memory in case it belongs to any scratch arena. In case the
+// memory does not belong to a scratch arena, the function returns \a false and the memory has
+// to be released via the system allocator.
+*/
+inline bool ScratchArena::deallocate( const void* address, size_t& size ) noexcept
+{
+   if( scratchArenaCapacity == 0UL )
+      return false;
+
+   Registry& r( registry() );
+   const size_t count( r.count.load( std::memory_order_acquire ) );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      ScratchArena* const arena( r.arenas[i].load( std::memory_order_acquire ) );
+      if( arena->owns( address ) ) {
+         size = arena->releaseBlock( address );
+         return true;
+      }
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether a ScratchScope is active on the calling thread.
+//
+// \return \a true in case a ScratchScope is active, \a false if not.
+*/
+inline bool ScratchArena::isActive() noexcept
+{
+   return scratchArenaCapacity != 0UL && binding().depth != 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocation of a memory block from the arena.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Pointer to the allocated memory, \a nullptr if the arena is exhausted.
+//
+// This function first tries to reuse a released memory block that is sufficiently large and
+// properly aligned. Otherwise a new memory block is placed on top of the arena.
+*/
+inline byte_t* ScratchArena::allocateBlock( size_t size, size_t alignment ) noexcept
+{
+   shrink();
+
+   size_t candidates( 0UL );
+
+   for( Header* block=last_; block!=nullptr && candidates<maxCandidates; block=block->prev, ++candidates )
+   {
+      byte_t* const address( reinterpret_cast<byte_t*>( block + 1 ) );
+
+      if( block->free.load( std::memory_order_acquire ) && block->size >= size &&
+          reinterpret_cast<size_t>( address ) % alignment == 0UL ) {
+         block->used = size;
+         block->free.store( false, std::memory_order_relaxed );
+         return address;
+      }
+   }
+
+   const size_t first( reinterpret_cast<size_t>( begin_ + top_ ) + sizeof(Header) );
+   const size_t alignedBegin( ( first + alignment - 1UL ) / alignment * alignment );
+   const size_t end( reinterpret_cast<size_t>( end_ ) );
+
+   if( alignedBegin > end || size > end - alignedBegin ) {
+      return nullptr;
+   }
+
+   byte_t* const address( reinterpret_cast<byte_t*>( alignedBegin ) );
+   Header* const block( ::new ( address - sizeof(Header) ) Header );
+
+   block->prev = last_;
+   block->top  = top_;
+   block->size = size;
+   block->used = size;
+   block->free.store( false, std::memory_order_relaxed );
+
+   last_ = block;
+   top_  = static_cast<size_t>( address + size - begin_ );
+
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Release of a memory block of the arena.
+//
+// \param address The address of the memory block.
+// \return The number of bytes requested by the released allocation.
+//
+// This function marks the given memory block as released. In case the calling thread owns the
+// arena, all released blocks on top of the arena are immediately reclaimed. Otherwise they are
+// reclaimed with the next allocation of the owning thread.
+*/
+inline size_t ScratchArena::releaseBlock( const void* address ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( owns( address ), "Invalid scratch arena address detected" );
+
+   Header* const block( reinterpret_cast<Header*>( const_cast<byte_t*>(
+      reinterpret_cast<const byte_t*>( address ) ) - sizeof(Header) ) );
+
+   BLAZE_INTERNAL_ASSERT( !block->free.load(), "Double release of scratch arena memory detected" );
+
+   const size_t used( block->used );
+
+   block->free.store( true, std::memory_order_release );
+
+   if( binding().arena == this ) {
+      shrink();
+   }
+
+   return used;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reclaims all released memory blocks on top of the arena.
+//
+// \return void
+*/
+inline void ScratchArena::shrink() noexcept
+{
+   while( last_ != nullptr && last_->free.load( std::memory_order_acquire ) ) {
+      top_  = last_->top;
+      last_ = last_->prev;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given address belongs to the arena.
+//
+// \param address The address to be checked.
+// \return \a true in case the address belongs to the arena, \a false if not.
+*/
+inline bool ScratchArena::owns( const void* address ) const noexcept
+{
+   const size_t value( reinterpret_cast<size_t>( address ) );
+   return value >= reinterpret_cast<size_t>( begin_ ) && value < reinterpret_cast<size_t>( end_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquires an unbound scratch arena.
+//
+// \return Pointer to the arena, \a nullptr if no arena can be provided.
+//
+// This function returns an arena from the pool of unbound arenas. In case the pool is empty,
+// a new arena is created. In case the maximum number of arenas is reached or the memory of a
+// new arena cannot be allocated, the function returns \a nullptr.
+*/
+inline ScratchArena* ScratchArena::acquire()
+{
+   Registry& r( registry() );
+   std::lock_guard<std::mutex> lock( r.mutex );
+
+   if( !r.pool.empty() ) {
+      ScratchArena* const arena( r.pool.back() );
+      r.pool.pop_back();
+      return arena;
+   }
+
+   const size_t count( r.count.load( std::memory_order_relaxed ) );
+
+   if( count == maxArenas )
+      return nullptr;
+
+   byte_t* const memory( static_cast<byte_t*>( std::malloc( scratchArenaCapacity ) ) );
+
+   if( memory == nullptr )
+      return nullptr;
+
+   ScratchArena* const arena( new ScratchArena( memory, scratchArenaCapacity ) );
+
+   r.arenas[count].store( arena, std::memory_order_relaxed );
+   r.count.store( count+1UL, std::memory_order_release );
+
+   return arena;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the given arena to the pool of unbound arenas.
+//
+// \param arena The arena to be returned.
+// \return void
+*/
+inline void ScratchArena::release( ScratchArena* arena )
+{
+   Registry& r( registry() );
+   std::lock_guard<std::mutex> lock( r.mutex );
+   r.pool.push_back( arena );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the global registry of all scratch arenas.
+//
+// \return Reference to the registry.
+//
+// The registry is intentionally never destroyed, since arena memory might be released during
+// the destruction of static objects.
+*/
+inline ScratchArena::Registry& ScratchArena::registry()
+{
+   static Registry* const r = new Registry();
+   return *r;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the arena binding of the calling thread.
+//
+// \return Reference to the binding of the calling thread.
+*/
+inline ScratchArena::Binding& ScratchArena::binding() noexcept
+{
+   static thread_local Binding b;
+   return b;
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SCRATCHSCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII scope for the allocation of temporaries from the per-thread scratch arena.
+// \ingroup util
+//
+// Within the lifetime of a ScratchScope all memory requested by the allocate() function on the
+// calling thread (i.e. by all \b Blaze data structures and by all temporaries that are created
+// during the evaluation of expressions) is taken from the scratch arena of the calling thread
+// instead of the system allocator:
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   blaze::DynamicVector<double> x, y;
+
+   for( size_t step=0UL; step<steps; ++step )
+   {
+      blaze::ScratchScope scope;
+
+      y = ( A * B ) * x;  // The temporary for A*B is taken from the scratch arena
+      x = eval( A * x ) + y;
+   }
+   \endcode
+
+// The capacity of each arena is specified via the BLAZE_SCRATCH_ARENA_CAPACITY configuration
+// switch. In case the arena of a thread is exhausted, memory is requested from the system
+// allocator. Scopes can be nested. Note that the memory of data structures that outlive the
+// scope remains valid, but is only reclaimed when the data structures are destroyed. Also note
+// that the worker threads of the shared-memory parallelization are not affected by the scope
+// of the calling thread.
+*/
+class ScratchScope : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ScratchScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ScratchScope();
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ScratchScope class.
+//
+// The first scope on a thread binds a scratch arena to the thread.
+*/
+inline ScratchScope::ScratchScope()
+{
+   if( scratchArenaCapacity == 0UL )
+      return;
+
+   ScratchArena::Binding& b( ScratchArena::binding() );
+
+   if( b.arena == nullptr ) {
+      b.arena = ScratchArena::acquire();
+   }
+
+   ++b.depth;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the ScratchScope class.
+*/
+inline ScratchScope::~ScratchScope()
+{
+   if( scratchArenaCapacity == 0UL )
+      return;
+
+   ScratchArena::Binding& b( ScratchArena::binding() );
+
+   BLAZE_INTERNAL_ASSERT( b.depth > 0UL, "Invalid scratch scope depth detected" );
+
+   --b.depth;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,9 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <vector>
+#include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
@@ -329,7 +331,7 @@ class ThreadPool
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, size_t spin=0UL );
    //@}
    //**********************************************************************************************
 
@@ -343,10 +345,11 @@ class ThreadPool
    //**Get functions*******************************************************************************
    /*!\name Get functions */
    //@{
-   inline bool   isEmpty() const;
-   inline size_t size()    const;
-   inline size_t active()  const;
-   inline size_t ready()   const;
+   inline bool   isEmpty()   const;
+   inline size_t size()      const;
+   inline size_t active()    const;
+   inline size_t ready()     const;
+   inline size_t spinCount() const;
    //@}
    //**********************************************************************************************
 
@@ -373,9 +376,56 @@ class ThreadPool
    //@{
    void createThread();
    bool executeTask();
+   bool spin( Lock& lock );
+   inline bool spinEnabled() const;
+
+   static inline void pause() noexcept;
    //@}
    //**********************************************************************************************
 
+   //**Private class Participation*****************************************************************
+   /*!\brief RAII participation of a waiting thread in the execution of the scheduled tasks.
+   //
+   // A thread executing a task within the wait() function is counted as active thread for the
+   // lifetime of the Participation object. Therefore a concurrent call to wait() in any other
+   // thread does not return before the task has been completed, even if the task throws.
+   */
+   class Participation
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Marks the calling thread as active and releases the given lock.
+      //
+      // \param pool The thread pool the calling thread is participating in.
+      // \param lock The acquired lock on the synchronization mutex.
+      */
+      explicit inline Participation( ThreadPool& pool, Lock& lock )
+         : pool_( pool )  // The thread pool the calling thread is participating in
+         , lock_( lock )  // The lock on the synchronization mutex
+      {
+         ++pool_.active_;
+         lock_.unlock();
+      }
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Reacquires the lock and marks the calling thread as inactive.
+      */
+      inline ~Participation() {
+         lock_.lock();
+         --pool_.active_;
+         pool_.waitForThread_.notify_all();
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ThreadPool& pool_;  //!< The thread pool the calling thread is participating in.
+      Lock&       lock_;  //!< The lock on the synchronization mutex.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -383,12 +433,19 @@ class ThreadPool
    volatile size_t expected_;  //!< Expected number of threads in the thread pool.
                                /*!< This number may differ from the total number of threads
                                     during a resize of the thread pool. */
-   volatile size_t active_;    //!< Number of currently active/busy threads.
-   Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
-   mutable Mutex mutex_;       //!< Synchronization mutex.
-   Condition waitForTask_;     //!< Wait condition for idle threads.
-   Condition waitForThread_;   //!< Wait condition for the thread management.
+   std::atomic<size_t> active_;  //!< Number of currently active/busy threads.
+   std::atomic<size_t> epoch_;   //!< Scheduling epoch.
+                                 /*!< The epoch is incremented with every scheduled task and
+                                      every reduction of the expected number of threads. */
+   const size_t spin_;           //!< Number of polling iterations before blocking.
+                                 /*!< In case the value is 0, idle threads and waiting callers
+                                      block immediately. */
+   const size_t cores_;          //!< Number of hardware threads available to the thread pool.
+   Threads threads_;             //!< The threads contained in the thread pool.
+   TaskQueue taskqueue_;         //!< Task queue for the scheduled tasks.
+   mutable Mutex mutex_;         //!< Synchronization mutex.
+   Condition waitForTask_;       //!< Wait condition for idle threads.
+   Condition waitForThread_;     //!< Wait condition for the thread management.
    //@}
    //**********************************************************************************************
 
@@ -413,18 +470,27 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param spin Number of polling iterations before an idle thread blocks.
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. Via the \a spin argument it is possible to enable
+// the hybrid spin-then-block mode of the thread pool: In case \a spin is larger than 0, idle
+// threads poll for new tasks for \a spin iterations before they block on a condition variable.
+// Additionally, the \a wait() function executes remaining tasks in the calling thread and polls
+// for the completion of all tasks before blocking. This considerably reduces the latency of
+// fine-grained parallel operations at the cost of busy CPU cores.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, size_t spin )
    : total_   ( 0UL )  // Total number of threads in the thread pool
    , expected_( 0UL )  // Expected number of threads in the thread pool
    , active_  ( 0UL )  // Number of currently active/busy threads
+   , epoch_   ( 0UL )  // Scheduling epoch
+   , spin_    ( spin ) // Number of polling iterations before blocking
+   , cores_   ( TT::hardware_concurrency() )  // Number of available hardware threads
    , threads_      ()  // The threads contained in the thread pool
    , taskqueue_    ()  // Task queue for the scheduled tasks
    , mutex_        ()  // Synchronization mutex
@@ -464,7 +530,8 @@ ThreadPool<TT,MT,LT,CT>::~ThreadPool()
    // Setting the expected number of threads
    expected_ = 0UL;
 
-   // Notifying all idle threads
+   // Notifying all idle and polling threads
+   ++epoch_;
    waitForTask_.notify_all();
 
    // Waiting for all threads to terminate
@@ -559,6 +626,25 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the number of polling iterations before an idle thread blocks.
+//
+// \return The spin count of the thread pool.
+//
+// In case the function returns 0, the thread pool operates in pure blocking mode. Otherwise
+// the thread pool operates in the hybrid spin-then-block mode.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadPool<TT,MT,LT,CT>::spinCount() const
+{
+   return spin_;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -588,6 +674,7 @@ void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
    Lock lock( mutex_ );
    taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
+   ++epoch_;
    waitForTask_.notify_one();
 }
 //*************************************************************************************************
@@ -667,6 +754,7 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
       // Removing threads from the pool
       else {
          expected_ = n;
+         ++epoch_;
          waitForTask_.notify_all();
 
          while( block && total_ != expected_ ) {
@@ -692,7 +780,11 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. In the hybrid
+// spin-then-block mode, the calling thread participates in the execution of the remaining
+// tasks and polls for the completion of the active tasks before it blocks. While executing
+// a task, the calling thread is counted as active thread, i.e. concurrent calls to wait() in
+// other threads also wait for the completion of this task.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -702,6 +794,23 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 {
    Lock lock( mutex_ );
 
+   if( spinEnabled() )
+   {
+      // Executing the remaining tasks in the calling thread
+      while( !taskqueue_.isEmpty() ) {
+         threadpool::Task task( taskqueue_.pop() );
+         const Participation participation( *this, lock );
+         task();
+      }
+
+      // Polling for the completion of the active tasks
+      lock.unlock();
+      for( size_t i=0UL; i<spin_ && active_ > 0UL; ++i ) {
+         pause();
+      }
+      lock.lock();
+   }
+
    while( !taskqueue_.isEmpty() || active_ > 0UL ) {
       waitForThread_.wait( lock );
    }
@@ -787,7 +896,9 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
             return false;
          }
 
-         waitForTask_.wait( lock );
+         if( !spin( lock ) ) {
+            waitForTask_.wait( lock );
+         }
          ++active_;
       }
 
@@ -802,6 +913,88 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Polling for a new task to be scheduled.
+//
+// \param lock The acquired lock on the synchronization mutex.
+// \return \a true in case the scheduling epoch has changed, \a false if not.
+//
+// This function is called by idle threads in the hybrid spin-then-block mode. It releases the
+// given lock and polls the scheduling epoch for the given number of spin iterations. The lock
+// is reacquired before the function returns. Since all notifications issued while polling are
+// lost, the epoch is not only incremented for every scheduled task, but also whenever the thread
+// pool is shrunk or destroyed. In this case the idle thread must not block, but terminate. In
+// case the hybrid mode is not enabled (see the spinEnabled() function), the function immediately
+// returns \a false.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool ThreadPool<TT,MT,LT,CT>::spin( Lock& lock )
+{
+   if( !spinEnabled() )
+      return false;
+
+   const size_t epoch( epoch_ );
+   bool scheduled( false );
+
+   lock.unlock();
+
+   for( size_t i=0UL; i<spin_ && !scheduled; ++i ) {
+      pause();
+      scheduled = ( epoch_.load( std::memory_order_relaxed ) != epoch );
+   }
+
+   lock.lock();
+
+   return scheduled || !taskqueue_.isEmpty();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the hybrid spin-then-block mode is enabled.
+//
+// \return \a true in case idle threads are allowed to poll, \a false if not.
+//
+// Polling is only enabled for a spin count larger than 0 and in case the threads of the thread
+// pool and the calling thread do not oversubscribe the available hardware threads. Otherwise
+// polling threads would steal the CPU time of the threads that are executing the tasks. This
+// function must only be called while the synchronization mutex is locked.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadPool<TT,MT,LT,CT>::spinEnabled() const
+{
+   return spin_ > 0UL && ( cores_ == 0UL || expected_ < cores_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pausing the calling thread within a polling loop.
+//
+// \return void
+//
+// This function emits a spin-wait hint to the processor (if available), which reduces the power
+// consumption and the impact on a sibling hyper-thread of a polling loop.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadPool<TT,MT,LT,CT>::pause() noexcept
+{
+#if BLAZE_SSE2_MODE
+   _mm_pause();
+#endif
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
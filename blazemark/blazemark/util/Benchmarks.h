@@ -43,6 +43,7 @@
 #include <cstring>
 #include <sstream>
 #include <stdexcept>
+#include <blaze/util/MemoryResource.h>
 #include <blazemark/system/Config.h>
 
 
@@ -137,6 +138,12 @@ struct Benchmarks
                             is available for a particular benchmark, the kernel is included in the
                             benchmark tests. In case the runEigen flag is set to \a false, the
                             Eigen kernel will be skipped.*/
+   ::blaze::HugePageMode hugePages;  //!< Huge page mode for the memory of the Blaze kernels.
+                                     /*!< The hugePages setting specifies whether the memory of
+                                          large vectors and matrices of the Blaze kernels is
+                                          backed by huge pages (see the SystemMemoryResource
+                                          class). The default is taken from the Blaze
+                                          configuration (BLAZE_HUGE_PAGE_MODE). */
    //@}
    //**********************************************************************************************
 };
@@ -166,6 +173,7 @@ inline Benchmarks::Benchmarks()
    , runFLENS    ( blazemark::runFLENS     )  // Flag value for the FLENS benchmark kernels
    , runMTL      ( blazemark::runMTL       )  // Flag value for the MTL benchmark kernels
    , runEigen    ( blazemark::runEigen     )  // Flag value for the Eigen benchmark kernels
+   , hugePages   ( static_cast< ::blaze::HugePageMode >( ::blaze::hugePageMode ) )  // Huge page mode
 {}
 //*************************************************************************************************
 
@@ -223,6 +231,9 @@ inline Benchmarks::Benchmarks()
 //   - \a -eigen: Activates the Eigen kernels.
 //   - \a -no-eigen: Deactivates the Eigen kernels.
 //   - \a -only-eigen: Activates the Eigen kernels and deactivates all other.
+//   - \a -hugepages: Uses transparent huge pages for large Blaze vectors and matrices.
+//   - \a -hugetlbfs: Uses explicitly reserved huge pages for large Blaze vectors and matrices.
+//   - \a -no-hugepages: Doesn't use huge pages for Blaze vectors and matrices.
 //
 // In case an unknown command line option is encountered, a \a std::invalid_argument exception
 // is thrown.
@@ -440,6 +451,15 @@ inline void parseCommandLineArguments( int argc, char** argv, Benchmarks& benchm
          benchmarks.runMTL       = false;
          benchmarks.runEigen     = true;
       }
+      else if( std::strcmp( argv[i], "-hugepages" ) == 0 ) {
+         benchmarks.hugePages = ::blaze::transparentHugePages;
+      }
+      else if( std::strcmp( argv[i], "-hugetlbfs" ) == 0 ) {
+         benchmarks.hugePages = ::blaze::explicitHugePages;
+      }
+      else if( std::strcmp( argv[i], "-no-hugepages" ) == 0 ) {
+         benchmarks.hugePages = ::blaze::noHugePages;
+      }
       else {
          std::ostringstream oss;
          oss << " Unknown command line argument: '" << argv[i] << "'";
@@ -66,7 +66,8 @@ namespace blaze {
 // \return Minimum runtime of the kernel function.
 //
 // This kernel function implements the conjugate gradient method by means of the Blaze
-// functionality.
+// functionality. The vector updates of each iteration are fused by means of deferred scopes
+// in order to reduce the number of passes over the vectors.
 */
 double cg( size_t N, size_t steps, size_t iterations )
 {
@@ -88,7 +89,7 @@ double cg( size_t N, size_t steps, size_t iterations )
 
    ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
    ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
-   element_t alpha, beta, delta;
+   element_t alpha, beta, delta, dh;
    ::blaze::timing::WcTimer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
@@ -116,11 +117,18 @@ double cg( size_t N, size_t steps, size_t iterations )
 
          for( size_t iteration=0UL; iteration<iterations; ++iteration )
          {
-            h = A * d;
-            alpha = delta / ( trans(d) * h );
-            x += alpha * d;
-            r += alpha * h;
-            beta = trans(r) * r;
+            {
+               ::blaze::DeferredScope scope;
+               scope.assign( h, A * d );
+               scope.dot( dh, d, h );
+            }
+            alpha = delta / dh;
+            {
+               ::blaze::DeferredScope scope;
+               scope.addAssign( x, alpha * d );
+               scope.addAssign( r, alpha * h );
+               scope.dot( beta, r, r );
+            }
             d = ( beta / delta ) * d - r;
             delta = beta;
          }
@@ -0,0 +1,138 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/GMRES.cpp
+//  \brief Source file for the Blaze restarted GMRES kernel
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/solvers/GMRESSolver.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/GMRES.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze restarted GMRES kernel.
+//
+// \param N The number of rows and columns of the 2D discretized grid.
+// \param steps The number of solving steps to perform.
+// \param iterations The number of iterations to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function solves the discretized two-dimensional convection-diffusion problem by
+// means of the blaze::GMRESSolver class with the default restart length of 30 iterations. The
+// convergence check of the solver is disabled in order to perform exactly the given number of
+// iterations in each step.
+*/
+double gmres( size_t N, size_t steps, size_t iterations )
+{
+   using ::blazemark::element_t;
+   using ::blaze::columnVector;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   const size_t NN( N*N );
+
+   std::vector<size_t> nnz( NN, 5UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i == 0UL || i == N-1UL ) --nnz[i*N+j];
+         if( j == 0UL || j == N-1UL ) --nnz[i*N+j];
+      }
+   }
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
+   ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN );
+   ::blaze::GMRESSolver<element_t> solver( ::blaze::SolverControl( iterations, 0.0 ) );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i > 0UL   ) A.append( i*N+j, (i-1UL)*N+j, -1.3 );  // Top neighbor
+         if( j > 0UL   ) A.append( i*N+j, i*N+j-1UL  , -1.3 );  // Left neighbor
+         A.append( i*N+j, i*N+j, 4.0 );
+         if( j < N-1UL ) A.append( i*N+j, i*N+j+1UL  , -0.7 );  // Right neighbor
+         if( i < N-1UL ) A.append( i*N+j, (i+1UL)*N+j, -0.7 );  // Bottom neighbor
+      }
+   }
+
+   init( b );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         reset( x );
+         solver.solve( A, b, x );
+      }
+      timer.end();
+
+      if( x.size() != NN )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'gmres': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
@@ -46,6 +46,7 @@
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/Infinity.h>
 #include <blaze/util/algorithms/Max.h>
+#include <blaze/util/MemoryResource.h>
 #include <blaze/util/Random.h>
 #include <blaze/util/Timing.h>
 #include <blazemark/armadillo/DMatTrans.h>
@@ -184,7 +185,8 @@ void dmattrans( std::vector<Run>& runs, Benchmarks benchmarks )
    }
 
    if( benchmarks.runBlaze ) {
-      std::cout << "   Blaze (Seconds):\n";
+      std::cout << "   Blaze" << ( benchmarks.hugePages != blaze::noHugePages ? " (huge pages)" : "" )
+                << " (Seconds):\n";
       for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
@@ -308,6 +310,9 @@ int main( int argc, char** argv )
       return EXIT_FAILURE;
    }
 
+   blaze::SystemMemoryResource memory( benchmarks.hugePages );
+   blaze::setMemoryResource( &memory );
+
    const std::string installPath( INSTALL_PATH );
    const std::string parameterFile( installPath + "/params/dmattrans.prm" );
    Parser<Run> parser;
@@ -47,6 +47,7 @@
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Infinity.h>
 #include <blaze/util/algorithms/Max.h>
+#include <blaze/util/MemoryResource.h>
 #include <blaze/util/Random.h>
 #include <blaze/util/Timing.h>
 #include <blazemark/armadillo/TDMatDVecMult.h>
@@ -238,7 +239,8 @@ void tdmatdvecmult( std::vector<Run>& runs, Benchmarks benchmarks )
 #endif
 
    if( benchmarks.runBlaze ) {
-      std::cout << "   Blaze [MFlop/s]:\n";
+      std::cout << "   Blaze" << ( benchmarks.hugePages != blaze::noHugePages ? " (huge pages)" : "" )
+                << " [MFlop/s]:\n";
       for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
          const size_t N    ( run->getSize()  );
          const size_t steps( run->getSteps() );
@@ -376,6 +378,9 @@ int main( int argc, char** argv )
       return EXIT_FAILURE;
    }
 
+   blaze::SystemMemoryResource memory( benchmarks.hugePages );
+   blaze::setMemoryResource( &memory );
+
    const std::string installPath( INSTALL_PATH );
    const std::string parameterFile( installPath + "/params/tdmatdvecmult.prm" );
    Parser<Run> parser;
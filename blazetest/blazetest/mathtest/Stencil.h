@@ -0,0 +1,152 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/Stencil.h
+//  \brief Header file for the finite difference stencil initialization of sparse matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_STENCIL_H_
+#define _BLAZETEST_MATHTEST_STENCIL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Coefficients of a finite difference stencil on a structured grid.
+//
+// The Stencil class template represents the coefficients of a seven-point finite difference
+// stencil on a three-dimensional structured grid. Two- and one-dimensional stencils set the
+// unused couplings to zero:
+
+   \code
+   // Five-point stencil of the two-dimensional Poisson problem
+   const blazetest::Stencil<double> poisson{ 4.0, -1.0, -1.0, -1.0, -1.0, 0.0, 0.0 };
+   \endcode
+*/
+template< typename Type >  // Data type of the coefficients
+struct Stencil
+{
+   Type center;  //!< The coefficient of the grid point itself.
+   Type west;    //!< The coupling to the previous grid point in x-direction.
+   Type east;    //!< The coupling to the next grid point in x-direction.
+   Type south;   //!< The coupling to the previous grid point in y-direction.
+   Type north;   //!< The coupling to the next grid point in y-direction.
+   Type bottom;  //!< The coupling to the previous grid point in z-direction.
+   Type top;     //!< The coupling to the next grid point in z-direction.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given row-major sparse matrix with a finite difference stencil.
+//
+// \param A The row-major sparse matrix to be initialized.
+// \param nx The number of grid points in x-direction.
+// \param ny The number of grid points in y-direction.
+// \param nz The number of grid points in z-direction.
+// \param stencil The coefficients of the stencil.
+// \return void
+//
+// This function initializes the given \f$ n \times n \f$ matrix, \f$ n = nx \cdot ny \cdot nz
+// \f$, with the given stencil on a \a nx-by-\a ny-by-\a nz grid, whose grid points are numbered
+// lexicographically with x as the fastest running index. Couplings with a default value are
+// not stored, which for instance allows to initialize the lower or upper part of a stencil
+// only. The matrix is expected to already have the according number of rows and columns.
+*/
+template< typename MT >  // Type of the sparse matrix
+void initializeStencil( MT& A, size_t nx, size_t ny, size_t nz,
+                        const Stencil< blaze::ElementType_<MT> >& stencil )
+{
+   using blaze::isDefault;
+
+   A.reset();
+   A.reserve( 7UL*nx*ny*nz );
+
+   for( size_t k=0UL; k<nz; ++k ) {
+      for( size_t j=0UL; j<ny; ++j ) {
+         for( size_t i=0UL; i<nx; ++i )
+         {
+            const size_t row( ( k*ny + j )*nx + i );
+
+            if( k > 0UL && !isDefault( stencil.bottom ) ) {
+               A.append( row, row-nx*ny, stencil.bottom );
+            }
+            if( j > 0UL && !isDefault( stencil.south ) ) {
+               A.append( row, row-nx, stencil.south );
+            }
+            if( i > 0UL && !isDefault( stencil.west ) ) {
+               A.append( row, row-1UL, stencil.west );
+            }
+
+            A.append( row, row, stencil.center );
+
+            if( i+1UL < nx && !isDefault( stencil.east ) ) {
+               A.append( row, row+1UL, stencil.east );
+            }
+            if( j+1UL < ny && !isDefault( stencil.north ) ) {
+               A.append( row, row+nx, stencil.north );
+            }
+            if( k+1UL < nz && !isDefault( stencil.top ) ) {
+               A.append( row, row+nx*ny, stencil.top );
+            }
+
+            A.finalize( row );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blazetest
+
+#endif
@@ -108,6 +108,7 @@ class UnalignedUnpaddedTest
    void testTranspose   ();
    void testCTranspose  ();
    void testIsDefault   ();
+   void testIsAligned   ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -103,7 +103,11 @@ class GeneralTest
    void testIsIdentity();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testReduce();
+   void testPartialReduce();
    void testTrace();
+   void testMultiplicationChain();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -88,6 +88,10 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testProd();
+   void testReduce();
+   void testDeferredScope();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -97,6 +101,12 @@ class OperationTest
 
    template< typename Type >
    void checkNonZeros( const Type& vector, size_t nonzeros ) const;
+
+   template< typename Type >
+   void checkPending( const Type& scope, size_t expectedSize ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expectedResult, const char* statement ) const;
    //@}
    //**********************************************************************************************
 
@@ -202,6 +212,67 @@ void OperationTest::checkNonZeros( const Type& vector, size_t expectedNonZeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the number of pending statements of the given deferred scope.
+//
+// \param scope The deferred scope to be checked.
+// \param expectedSize The expected number of pending statements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of pending statements of the given deferred scope. In case
+// the actual number of pending statements does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the deferred scope
+void OperationTest::checkPending( const Type& scope, size_t expectedSize ) const
+{
+   if( scope.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of pending statements\n"
+          << " Details:\n"
+          << "   Number of pending statements: " << scope.size() << "\n"
+          << "   Expected number             : " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a deferred evaluation.
+//
+// \param result The dense vector to be checked.
+// \param expectedResult The expected result.
+// \param statement Label of the evaluated statements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of a deferred evaluation with the result of the sequential
+// evaluation. In case the results differ, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the dense vector
+        , typename Type2 >  // Type of the expected result
+void OperationTest::checkResult( const Type1& result, const Type2& expectedResult,
+                                 const char* statement ) const
+{
+   for( size_t i=0UL; i<result.size(); ++i ) {
+      if( result[i] != expectedResult[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << statement << " failed\n"
+             << " Details:\n"
+             << "   Index: " << i << "\n"
+             << "   Result: " << result[i] << "\n"
+             << "   Expected result: " << expectedResult[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
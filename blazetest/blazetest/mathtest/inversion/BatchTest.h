@@ -0,0 +1,395 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/inversion/BatchTest.h
+//  \brief Header file for the batched small matrix inversion test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_INVERSION_BATCHTEST_H_
+#define _BLAZETEST_MATHTEST_INVERSION_BATCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/MatrixBatch.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace inversion {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all batched small matrix inversion tests.
+//
+// This class represents a test suite for the batched inversion and the batched LU and Cholesky
+// solvers of the MatrixBatch class template. The results of the batched kernels are checked by
+// means of the residuals of the individual matrices.
+*/
+class BatchTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BatchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testContainer();
+   void testSingular();
+
+   template< typename Type, size_t N >
+   void testRandom( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, size_t N >
+   void initialize( blaze::MatrixBatch<Type,N,N>& batch, bool positiveDefinite );
+
+   template< typename Type, size_t N >
+   void initialize( blaze::VectorBatch<Type,N>& batch );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batched kernels with \a n random \f$ N \times N \f$ matrices.
+//
+// \param n The number of matrices of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched inversion, the batched LU and Cholesky decompositions and the
+// batched solvers for \a n random \f$ N \times N \f$ matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type, size_t N >
+void BatchTest::testRandom( size_t n )
+{
+   using MatrixType = blaze::StaticMatrix<Type,N,N>;
+
+
+   //=====================================================================================
+   // Batched inversion
+   //=====================================================================================
+
+   {
+      test_ = "Batched matrix inversion";
+
+      blaze::MatrixBatch<Type,N,N> A( n );
+      initialize( A, false );
+      blaze::MatrixBatch<Type,N,N> B( A );
+
+      invert( B );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         if( !isIdentity( A.get(k) * B.get(k) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Matrix inversion failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size = " << n << ", matrix index = " << k << "\n"
+                << "   Initial matrix (A):\n" << A.get(k) << "\n"
+                << "   Result (B):\n" << B.get(k) << "\n"
+                << "   A * B =\n" << ( A.get(k) * B.get(k) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched LU decomposition and solution
+   //=====================================================================================
+
+   {
+      test_ = "Batched LU decomposition";
+
+      blaze::MatrixBatch<Type,N,N> A( n );
+      initialize( A, false );
+      blaze::MatrixBatch<Type,N,N> LU( A );
+
+      blaze::VectorBatch<Type,N> b( n );
+      initialize( b );
+      blaze::VectorBatch<Type,N> x( b );
+
+      lu( LU );
+      luSolve( LU, x );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         MatrixType L( LU.get(k) ), U( LU.get(k) );
+         for( size_t i=0UL; i<N; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               if( j >  i ) L(i,j) = Type(0);
+               if( j == i ) L(i,j) = Type(1);
+               if( j <  i ) U(i,j) = Type(0);
+            }
+         }
+
+         if( L * U != A.get(k) || A.get(k) * x.get(k) != b.get(k) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: LU decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size = " << n << ", matrix index = " << k << "\n"
+                << "   Initial matrix (A):\n" << A.get(k) << "\n"
+                << "   L * U =\n" << ( L * U ) << "\n"
+                << "   Right-hand side (b):\n" << b.get(k) << "\n"
+                << "   A * x =\n" << ( A.get(k) * x.get(k) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Batched linear system solution";
+
+      blaze::MatrixBatch<Type,N,N> A( n );
+      initialize( A, false );
+      blaze::MatrixBatch<Type,N,N> B( A );
+
+      blaze::VectorBatch<Type,N> b( n );
+      initialize( b );
+      blaze::VectorBatch<Type,N> x( b );
+
+      solve( B, x );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         if( B.get(k) != A.get(k) || A.get(k) * x.get(k) != b.get(k) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving the linear system failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size = " << n << ", matrix index = " << k << "\n"
+                << "   System matrix (A):\n" << A.get(k) << "\n"
+                << "   Right-hand side (b):\n" << b.get(k) << "\n"
+                << "   A * x =\n" << ( A.get(k) * x.get(k) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched Cholesky decomposition and solution
+   //=====================================================================================
+
+   {
+      test_ = "Batched Cholesky decomposition";
+
+      blaze::MatrixBatch<Type,N,N> A( n );
+      initialize( A, true );
+      blaze::MatrixBatch<Type,N,N> L( A );
+
+      blaze::VectorBatch<Type,N> b( n );
+      initialize( b );
+      blaze::VectorBatch<Type,N> x( b );
+
+      llh( L );
+      llhSolve( L, x );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         if( !isLower( L.get(k) ) || L.get(k) * trans( L.get(k) ) != A.get(k) || A.get(k) * x.get(k) != b.get(k) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Cholesky decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Batch size = " << n << ", matrix index = " << k << "\n"
+                << "   Initial matrix (A):\n" << A.get(k) << "\n"
+                << "   Result (L):\n" << L.get(k) << "\n"
+                << "   Right-hand side (b):\n" << b.get(k) << "\n"
+                << "   A * x =\n" << ( A.get(k) * x.get(k) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given batch with random matrices.
+//
+// \param batch The batch to be initialized.
+// \param positiveDefinite \a true for symmetric positive definite matrices.
+// \return void
+//
+// This function initializes all matrices of the given batch with random, diagonally dominant
+// (or symmetric positive definite) matrices.
+*/
+template< typename Type, size_t N >
+void BatchTest::initialize( blaze::MatrixBatch<Type,N,N>& batch, bool positiveDefinite )
+{
+   for( size_t k=0UL; k<batch.size(); ++k )
+   {
+      blaze::StaticMatrix<Type,N,N> A;
+      randomize( A, Type(-1), Type(1) );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         A(i,i) += Type( 2UL*N );
+      }
+
+      if( positiveDefinite ) {
+         A = A * trans( A );
+      }
+
+      batch.set( k, A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given batch with random vectors.
+//
+// \param batch The batch to be initialized.
+// \return void
+*/
+template< typename Type, size_t N >
+void BatchTest::initialize( blaze::VectorBatch<Type,N>& batch )
+{
+   for( size_t k=0UL; k<batch.size(); ++k )
+   {
+      blaze::StaticVector<Type,N> b;
+      randomize( b, Type(-1), Type(1) );
+      batch.set( k, b );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the batched small matrix inversion.
+//
+// \return void
+*/
+void runTest()
+{
+   BatchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the batched small matrix inversion test.
+*/
+#define RUN_INVERSION_BATCH_TEST \
+   blazetest::mathtest::inversion::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace inversion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,452 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/FactorizationTest.h
+//  \brief Header file for the LAPACK-based factorization classes test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_FACTORIZATIONTEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_FACTORIZATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LAPACK.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blazetest/system/LAPACK.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the LAPACK-based factorization classes.
+//
+// This class represents a test suite for the reusable factorization classes of the Blaze library
+// (blaze::LUFactorization, blaze::CholeskyFactorization, and blaze::QRFactorization). It checks
+// that a single factorization solves linear systems with several right-hand sides and that the
+// determinant and the estimate of the reciprocal condition number are computed correctly.
+*/
+class FactorizationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FactorizationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testLU();
+   template< typename Type > void testCholesky();
+   template< typename Type > void testQR();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, typename RT >
+   void checkRcond( RT rcond ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the LUFactorization class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the LUFactorization class template for both column-major
+// and row-major right-hand sides. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void FactorizationTest::testLU()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "LU factorization";
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( 13UL, 13UL );
+   blaze::DynamicVector<Type,blaze::columnVector> b( 13UL ), x;
+   blaze::DynamicMatrix<Type,blaze::rowMajor> B( 13UL, 5UL ), X;
+   blaze::DynamicMatrix<Type,blaze::columnMajor> C( 13UL, 5UL ), Y;
+
+   do {
+      randomize( A );
+   }
+   while( blaze::isDefault( det( A ) ) );
+
+   randomize( b );
+   randomize( B );
+   randomize( C );
+
+   blaze::LUFactorization<Type> lu( A );
+
+   x = lu.solve( b );
+   X = lu.solve( B );
+   Y = C;
+   lu.solveInPlace( Y );
+
+   if( ( A * x ) != b || ( A * X ) != B || ( A * Y ) != C ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the linear systems failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Result (x):\n" << x << "\n"
+          << "   Result (X):\n" << X << "\n"
+          << "   Result (Y):\n" << Y << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( !blaze::equal( lu.det(), det( A ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Computing the determinant failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Result: " << lu.det() << "\n"
+          << "   Expected result: " << det( A ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkRcond<Type>( lu.rcond() );
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CholeskyFactorization class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CholeskyFactorization class template for both
+// column-major and row-major right-hand sides. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void FactorizationTest::testCholesky()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using blaze::real;
+
+   test_ = "Cholesky factorization";
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> A( 13UL, 13UL ), S;
+   blaze::DynamicVector<Type,blaze::columnVector> b( 13UL ), x;
+   blaze::DynamicMatrix<Type,blaze::rowMajor> B( 13UL, 5UL ), X;
+
+   randomize( A );
+   S = A * ctrans( A );
+   for( size_t i=0UL; i<S.rows(); ++i ) {
+      S(i,i) += Type( 13 );
+   }
+
+   randomize( b );
+   randomize( B );
+
+   blaze::CholeskyFactorization<Type> llh( S );
+
+   x = b;
+   llh.solveInPlace( x );
+   X = llh.solve( B );
+
+   if( ( S * x ) != b || ( S * X ) != B ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the linear systems failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Result (x):\n" << x << "\n"
+          << "   Result (X):\n" << X << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // The determinant of a Hermitian matrix is real (the reference value may contain round-off)
+   if( !blaze::equal( real( llh.det() ), real( det( S ) ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Computing the determinant failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Result: " << llh.det() << "\n"
+          << "   Expected result: " << det( S ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkRcond<Type>( llh.rcond() );
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the QRFactorization class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the QRFactorization class template for square and
+// overdetermined systems. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void FactorizationTest::testQR()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "QR factorization";
+
+   //=====================================================================================
+   // Square systems
+   //=====================================================================================
+
+   {
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( 13UL, 13UL );
+      blaze::DynamicVector<Type,blaze::columnVector> b( 13UL ), x;
+      blaze::DynamicMatrix<Type,blaze::rowMajor> B( 13UL, 5UL ), X;
+
+      do {
+         randomize( A );
+      }
+      while( blaze::isDefault( det( A ) ) );
+
+      randomize( b );
+      randomize( B );
+
+      blaze::QRFactorization<Type> qr( A );
+
+      x = qr.solve( b );
+      X = qr.solve( B );
+
+      if( ( A * x ) != b || ( A * X ) != B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the square linear systems failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Result (X):\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( !blaze::equal( qr.det(), det( A ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Computing the determinant failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result: " << qr.det() << "\n"
+             << "   Expected result: " << det( A ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRcond<Type>( qr.rcond() );
+   }
+
+
+   //=====================================================================================
+   // Overdetermined systems
+   //=====================================================================================
+
+   {
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( 21UL, 13UL );
+      blaze::DynamicVector<Type,blaze::columnVector> b( 21UL ), x;
+      blaze::DynamicMatrix<Type,blaze::columnMajor> B( 21UL, 5UL ), X;
+
+      randomize( A );
+      randomize( b );
+      randomize( B );
+
+      blaze::QRFactorization<Type> qr( A );
+
+      x = b;
+      qr.solveInPlace( x );
+      X = qr.solve( B );
+
+      // The least squares solutions have to satisfy the normal equations
+      if( x.size() != 13UL || X.rows() != 13UL ||
+          ( ctrans( A ) * A * x ) != ( ctrans( A ) * b ) ||
+          ( ctrans( A ) * A * X ) != ( ctrans( A ) * B ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the overdetermined linear systems failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (x):\n" << x << "\n"
+             << "   Result (X):\n" << X << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given estimate of the reciprocal condition number.
+//
+// \param rcond The estimate of the reciprocal condition number to be checked.
+// \return void
+// \exception std::runtime_error Invalid condition estimate detected.
+//
+// This function checks that the given estimate of the reciprocal condition number of a
+// non-singular matrix lies within the range (0..1]. In case the estimate is out of range,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type, typename RT >
+void FactorizationTest::checkRcond( RT rcond ) const
+{
+   if( !( rcond > RT( 0 ) ) || rcond > RT( 1 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid condition estimate detected\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Reciprocal condition number: " << rcond << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the LAPACK-based factorization classes.
+//
+// \return void
+*/
+void runTest()
+{
+   FactorizationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the LAPACK factorization test.
+*/
+#define RUN_LAPACK_FACTORIZATION_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
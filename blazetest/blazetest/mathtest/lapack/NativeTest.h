@@ -0,0 +1,408 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/NativeTest.h
+//  \brief Header file for the native LU, Cholesky and triangular kernels test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_NATIVETEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_NATIVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LAPACK.h>
+#include <blaze/system/Blocking.h>
+#include <blazetest/system/LAPACK.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the native LU, Cholesky and triangular kernels.
+//
+// This class represents a test suite for the native, blocked kernels that replace the LAPACK
+// LU, Cholesky and triangular functions in case the LAPACK mode is disabled (see the
+// BLAZE_LAPACK_MODE switch). The results of the native kernels are compared to the results of
+// the LAPACK wrappers for matrices that span several blocks of size blaze::LAPACK_BLOCK_SIZE.
+*/
+class NativeTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testLU();
+   template< typename Type > void testCholesky();
+   template< typename Type > void testTriangular();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, typename MT >
+   void checkResult( const std::string& error, size_t n, const MT& result, const MT& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition, substitution and inversion kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the native getrf(), getrs() and getri() kernels to the according
+// LAPACK functions. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testLU()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Native LU kernels";
+
+   for( size_t n : { 1UL, 7UL, blaze::LAPACK_BLOCK_SIZE+3UL, 2UL*blaze::LAPACK_BLOCK_SIZE+5UL } )
+   {
+      const int N( n );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( n, n ), B( n, 3UL );
+      randomize( A );
+      randomize( B );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += Type( 2 );
+      }
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A1( A ), A2( A ), B1( B ), B2( B );
+      const std::unique_ptr<int[]> ipiv1( new int[n] );
+      const std::unique_ptr<int[]> ipiv2( new int[n] );
+      int info1( 0 ), info2( 0 );
+
+      blaze::getrf( N, N, A1.data(), A1.spacing(), ipiv1.get(), &info1 );
+      blaze::getrf_native( N, N, A2.data(), A2.spacing(), ipiv2.get(), &info2 );
+
+      if( info1 != 0 || info2 != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LU decomposition failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Size: " << n << "\n"
+             << "   LAPACK info: " << info1 << "\n"
+             << "   Native info: " << info2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( char trans : { 'N', 'T', 'C' } ) {
+         B1 = B;
+         B2 = B;
+         blaze::getrs( trans, N, 3, A1.data(), A1.spacing(), ipiv1.get(), B1.data(), B1.spacing(), &info1 );
+         blaze::getrs_native( trans, N, 3, A2.data(), A2.spacing(), ipiv2.get(), B2.data(), B2.spacing(), &info2 );
+         checkResult<Type>( "LU-based substitution failed", n, B2, B1 );
+      }
+
+      const int lwork( N*blaze::LAPACK_BLOCK_SIZE );
+      const std::unique_ptr<Type[]> work( new Type[lwork] );
+
+      blaze::getri( N, A1.data(), A1.spacing(), ipiv1.get(), work.get(), lwork, &info1 );
+      blaze::getri_native( N, A2.data(), A2.spacing(), ipiv2.get(), work.get(), lwork, &info2 );
+      checkResult<Type>( "LU-based inversion failed", n, A2, A1 );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native Cholesky decomposition, substitution and inversion kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the native potrf(), potrs() and potri() kernels to the according
+// LAPACK functions for both the lower and the upper part of a positive definite matrix. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testCholesky()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Native Cholesky kernels";
+
+   for( size_t n : { 1UL, 7UL, blaze::LAPACK_BLOCK_SIZE+3UL, 2UL*blaze::LAPACK_BLOCK_SIZE+5UL } )
+   {
+      const int N( n );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( n, n ), B( n, 3UL ), S;
+      randomize( A );
+      randomize( B );
+
+      S = A * ctrans( A );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         S(i,i) += Type( n );
+      }
+
+      for( char uplo : { 'L', 'U' } )
+      {
+         blaze::DynamicMatrix<Type,blaze::columnMajor> S1( S ), S2( S ), B1( B ), B2( B );
+         int info1( 0 ), info2( 0 );
+
+         blaze::potrf( uplo, N, S1.data(), S1.spacing(), &info1 );
+         blaze::potrf_native( uplo, N, S2.data(), S2.spacing(), &info2 );
+         checkResult<Type>( "Cholesky decomposition failed", n, S2, S1 );
+
+         blaze::potrs( uplo, N, 3, S1.data(), S1.spacing(), B1.data(), B1.spacing(), &info1 );
+         blaze::potrs_native( uplo, N, 3, S2.data(), S2.spacing(), B2.data(), B2.spacing(), &info2 );
+         checkResult<Type>( "Cholesky-based substitution failed", n, B2, B1 );
+
+         blaze::potri( uplo, N, S1.data(), S1.spacing(), &info1 );
+         blaze::potri_native( uplo, N, S2.data(), S2.spacing(), &info2 );
+         checkResult<Type>( "Cholesky-based inversion failed", n, S2, S1 );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the native triangular inversion and substitution kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the native trtri(), trtrs() and trsv() kernels to the according
+// LAPACK/BLAS functions for all combinations of lower/upper, transposed/non-transposed and
+// unitriangular/general triangular matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void NativeTest::testTriangular()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Native triangular kernels";
+
+   for( size_t n : { 1UL, 7UL, blaze::LAPACK_BLOCK_SIZE+3UL, 2UL*blaze::LAPACK_BLOCK_SIZE+5UL } )
+   {
+      const int N( n );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> A( n, n ), B( n, 3UL );
+      randomize( A );
+      randomize( B );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) += Type( 2 );
+      }
+
+      for( char uplo : { 'L', 'U' } ) {
+         for( char diag : { 'N', 'U' } )
+         {
+            blaze::DynamicMatrix<Type,blaze::columnMajor> A1( A ), A2( A );
+            int info1( 0 ), info2( 0 );
+
+            blaze::trtri( uplo, diag, N, A1.data(), A1.spacing(), &info1 );
+            blaze::trtri_native( uplo, diag, N, A2.data(), A2.spacing(), &info2 );
+            checkResult<Type>( "Triangular inversion failed", n, A2, A1 );
+
+            for( char trans : { 'N', 'T', 'C' } )
+            {
+               blaze::DynamicMatrix<Type,blaze::columnMajor> B1( B ), B2( B );
+
+               blaze::trtrs( uplo, trans, diag, N, 3, A.data(), A.spacing(), B1.data(), B1.spacing(), &info1 );
+               blaze::trtrs_native( uplo, trans, diag, N, 3, A.data(), A.spacing(), B2.data(), B2.spacing(), &info2 );
+               checkResult<Type>( "Triangular substitution failed", n, B2, B1 );
+
+               B1 = B;
+               B2 = B;
+
+               blaze::trsv( uplo, trans, diag, N, A.data(), A.spacing(), B1.data(), 1 );
+               blaze::trsv_native( uplo, trans, diag, N, A.data(), A.spacing(), B2.data(), 1 );
+               checkResult<Type>( "Triangular solve failed", n, B2, B1 );
+
+               for( int incX : { 2, -2 } )
+               {
+                  blaze::DynamicVector<Type,blaze::columnVector> x1( 2UL*n ), x2;
+                  randomize( x1 );
+                  x2 = x1;
+
+                  blaze::trsv( uplo, trans, diag, N, A.data(), A.spacing(), x1.data(), incX );
+                  blaze::trsv_native( uplo, trans, diag, N, A.data(), A.spacing(), x2.data(), incX );
+                  checkResult<Type>( "Strided triangular solve failed", n, x2, x1 );
+               }
+            }
+         }
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Comparison of the result of a native kernel with the according LAPACK result.
+//
+// \param error The error message in case of a mismatch.
+// \param n The number of rows/columns of the test matrix.
+// \param result The result of the native kernel.
+// \param expected The result of the LAPACK function.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+template< typename Type, typename MT >
+void NativeTest::checkResult( const std::string& error, size_t n,
+                              const MT& result, const MT& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Size: " << n << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native LU, Cholesky and triangular kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   NativeTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the native LAPACK kernels test.
+*/
+#define RUN_LAPACK_NATIVE_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,519 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/lapack/WorkspaceTest.h
+//  \brief Header file for the LAPACK workspace test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_LAPACK_WORKSPACETEST_H_
+#define _BLAZETEST_MATHTEST_LAPACK_WORKSPACETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/LAPACK.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blazetest/system/LAPACK.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace lapack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the LAPACK workspace functionality.
+//
+// This class represents a test suite for the reusable LAPACK workspace (blaze::LAPACKWorkspace)
+// of the Blaze library. It checks that the workspace variants of the decomposition, inversion,
+// eigenvalue, and singular value functions compute the same results as the variants without
+// workspace and that repeated calls for matrices of the same size don't enlarge the workspace.
+*/
+class WorkspaceTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit WorkspaceTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testDecomposition();
+   template< typename Type > void testInversion();
+   template< typename Type > void testEigen();
+   template< typename Type > void testSVD();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void checkCapacity( const blaze::LAPACKWorkspace& ws, size_t expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the decomposition functions with user-provided workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the QR, LQ, and LU decomposition functions with a reusable
+// workspace. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void WorkspaceTest::testDecomposition()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "QR, LQ, and LU decomposition with workspace";
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( 24UL, 17UL );
+   blaze::DynamicMatrix<Type,blaze::rowMajor> Q, R, L, U, P, Q2, R2;
+   blaze::LAPACKWorkspace ws;
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      randomize( A );
+
+      blaze::qr( A, Q, R, ws );
+      blaze::qr( A, Q2, R2 );
+
+      if( Q != Q2 || R != R2 || Q*R != A ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: QR decomposition with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (Q):\n" << Q << "\n"
+             << "   Expected result (Q):\n" << Q2 << "\n"
+             << "   Result (R):\n" << R << "\n"
+             << "   Expected result (R):\n" << R2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::lq( trans( A ), L, Q, ws );
+
+      if( L*Q != trans( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LQ decomposition with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (L):\n" << L << "\n"
+             << "   Result (Q):\n" << Q << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::lu( A, L, U, P, ws );
+
+      if( L*U*P != A ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LU decomposition with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (L):\n" << L << "\n"
+             << "   Result (U):\n" << U << "\n"
+             << "   Result (P):\n" << P << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( i == 0UL )
+         capacity = ws.capacity();
+      else
+         checkCapacity<Type>( ws, capacity );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the matrix inversion functions with user-provided workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the LU-based and LDLT/LDLH-based in-place matrix inversion
+// with a reusable workspace. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void WorkspaceTest::testInversion()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Matrix inversion with workspace";
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> A( 19UL, 19UL );
+   blaze::DynamicMatrix<Type,blaze::columnMajor> B;
+   blaze::LAPACKWorkspace ws;
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      do {
+         randomize( A );
+      }
+      while( blaze::isDefault( det( A ) ) );
+
+      B = A;
+      blaze::invert( B, ws );
+
+      if( !blaze::isIdentity( B * A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Matrix inversion with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << B << "\n"
+             << "   B * A = " << ( B * A ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      B = A + trans( A );
+      blaze::invert<blaze::byLDLT>( B, ws );
+
+      if( !blaze::isIdentity( B * ( A + trans( A ) ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LDLT-based matrix inversion with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( i == 0UL )
+         capacity = ws.capacity();
+      else
+         checkCapacity<Type>( ws, capacity );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the eigenvalue functions with user-provided workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the eigenvalue functions for general and symmetric/Hermitian
+// matrices with a reusable workspace. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void WorkspaceTest::testEigen()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using blaze::complex;
+
+   using RT = blaze::UnderlyingBuiltin_<Type>;
+   using HT = blaze::If_< blaze::IsComplex<Type>
+                        , blaze::HermitianMatrix< blaze::DynamicMatrix<Type,blaze::rowMajor> >
+                        , blaze::SymmetricMatrix< blaze::DynamicMatrix<Type,blaze::rowMajor> > >;
+
+   test_ = "Eigenvalue computation with workspace";
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> A( 16UL, 16UL );
+   blaze::DynamicVector<complex<RT>,blaze::columnVector> w1, w2;
+   blaze::DynamicMatrix<complex<RT>,blaze::rowMajor> V;
+   blaze::DynamicVector<RT,blaze::columnVector> w3, w4;
+   blaze::LAPACKWorkspace ws;
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      randomize( A );
+
+      blaze::eigen( A, w1, ws );
+      blaze::eigen( A, w2, V, ws );
+
+      if( w1 != w2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: General eigenvalue computation with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (without eigenvectors):\n" << w1 << "\n"
+             << "   Result (with eigenvectors):\n" << w2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const HT S( blaze::declherm( A * ctrans( A ) ) );
+
+      blaze::eigen( S, w3, ws );
+      blaze::eigen( S, w4 );
+
+      if( w3 != w4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric eigenvalue computation with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << w3 << "\n"
+             << "   Expected result:\n" << w4 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( i == 0UL )
+         capacity = ws.capacity();
+      else
+         checkCapacity<Type>( ws, capacity );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the singular value decomposition functions with user-provided workspace.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the singular value decomposition functions with a reusable
+// workspace. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void WorkspaceTest::testSVD()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   using RT = blaze::UnderlyingBuiltin_<Type>;
+
+   test_ = "Singular value decomposition with workspace";
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> A( 21UL, 13UL );
+   blaze::DynamicMatrix<Type,blaze::columnMajor> U, V;
+   blaze::DynamicVector<RT,blaze::columnVector> s1, s2;
+   blaze::LAPACKWorkspace ws;
+   size_t capacity( 0UL );
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      randomize( A );
+
+      blaze::svd( A, s1, ws );
+      blaze::svd( A, s2 );
+
+      if( s1 != s2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular value computation with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result:\n" << s1 << "\n"
+             << "   Expected result:\n" << s2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::svd( A, U, s1, V, ws );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> S( s1.size(), s1.size(), Type() );
+      for( size_t j=0UL; j<s1.size(); ++j ) {
+         S(j,j) = s1[j];
+      }
+
+      if( s1 != s2 || U * S * V != A ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Singular value decomposition with workspace failed\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Result (U):\n" << U << "\n"
+             << "   Result (s):\n" << s1 << "\n"
+             << "   Result (V):\n" << V << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( i == 0UL )
+         capacity = ws.capacity();
+      else
+         checkCapacity<Type>( ws, capacity );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given LAPACK workspace.
+//
+// \param ws The LAPACK workspace to be checked.
+// \param expected The expected capacity of the workspace.
+// \return void
+// \exception std::runtime_error Invalid workspace capacity detected.
+//
+// This function checks that the capacity of the given workspace didn't change, i.e. that
+// repeated calls for matrices of the same size didn't require any further memory allocation.
+// In case the capacity changed, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void WorkspaceTest::checkCapacity( const blaze::LAPACKWorkspace& ws, size_t expected ) const
+{
+   if( ws.capacity() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid workspace capacity detected\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Capacity: " << ws.capacity() << "\n"
+          << "   Expected capacity: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the LAPACK functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   WorkspaceTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the LAPACK workspace test.
+*/
+#define RUN_LAPACK_WORKSPACE_TEST \
+   blazetest::mathtest::lapack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace lapack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
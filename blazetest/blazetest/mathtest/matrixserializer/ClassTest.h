@@ -94,6 +94,7 @@ class ClassTest
    //@{
    void testEmptyMatrices ();
    void testRandomMatrices();
+   void testLargeMatrices ();
    void testFailures      ();
 
    template< size_t M, size_t N, typename MT >
@@ -0,0 +1,530 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/KrylovTest.h
+//  \brief Header file for the Krylov subspace solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_KRYLOVTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_KRYLOVTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/Stencil.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all Krylov subspace solver tests.
+//
+// This class represents a test suite for the CG, BiCGStab, and GMRES solvers. The solvers are
+// applied to the discretizations of a two-dimensional Poisson and a convection-diffusion problem,
+// given as dense matrices, sparse matrices, symmetric adaptors, and matrix-free operators. The
+// results are checked by means of the true residuals of the computed solutions.
+*/
+class KrylovTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KrylovTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSpecial();
+   void testErrors();
+
+   template< typename Type >
+   void testCG( size_t N, double tolerance );
+
+   template< typename Type >
+   void testBiCGStab( size_t N, double tolerance );
+
+   template< typename Type >
+   void testGMRES( size_t N, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& A, size_t N, double convection );
+
+   template< typename VT >
+   void initialize( VT& b );
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkResult( const blaze::SolverStatistics& stats, const MT& A, const VT1& b,
+                     const VT2& x, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the (preconditioned) CG solver.
+//
+// \param N The number of grid points per dimension.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the CG solver for the two-dimensional Poisson problem on a \a N-by-\a N
+// grid. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void KrylovTest::testCG( size_t N, double tolerance )
+{
+   const blaze::SolverControl control( 1000UL, tolerance );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( N*N, N*N );
+   initialize( A, N, 0.0 );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( N*N );
+   initialize( b );
+
+   {
+      test_ = "CG solver with row-major compressed matrix";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+      const blaze::SolverStatistics stats( cg( A, b, x, control ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+
+   {
+      test_ = "CG solver with column-major compressed matrix";
+
+      const blaze::CompressedMatrix<Type,blaze::columnMajor> B( A );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+      const blaze::SolverStatistics stats( cg( B, b, x, control ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+
+   {
+      test_ = "CG solver with dense matrix";
+
+      const blaze::DynamicMatrix<Type,blaze::rowMajor> B( A );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+      const blaze::SolverStatistics stats( cg( B, b, x, control ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+
+   {
+      test_ = "CG solver with symmetric compressed matrix";
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<Type,blaze::rowMajor> > B( A );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+      const blaze::SolverStatistics stats( cg( B, b, x, control ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+
+   {
+      test_ = "CG solver with matrix-free operator";
+
+      auto op = [&A]( const blaze::DynamicVector<Type>& v, blaze::DynamicVector<Type>& y ) {
+         y = A * v;
+      };
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+      const blaze::SolverStatistics stats( cg( op, b, x, control ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+
+   {
+      test_ = "Preconditioned CG solver";
+
+      blaze::DynamicVector<Type,blaze::columnVector> d( N*N );
+      for( size_t i=0UL; i<N*N; ++i ) {
+         d[i] = Type(1) / A(i,i);
+      }
+
+      auto jacobi = [&d]( const blaze::DynamicVector<Type>& r, blaze::DynamicVector<Type>& z ) {
+         z = d * r;
+      };
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N );
+      randomize( x );
+
+      blaze::CGSolver<Type> solver( control );
+      const blaze::SolverStatistics stats( solver.solve( A, b, x, jacobi ) );
+      checkResult( stats, A, b, x, tolerance );
+
+      // Reusing the solver for a second right-hand side
+      blaze::DynamicVector<Type,blaze::columnVector> c( N*N );
+      initialize( c );
+      reset( x );
+
+      checkResult( solver.solve( A, c, x, jacobi ), A, c, x, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the (preconditioned) BiCGStab solver.
+//
+// \param N The number of grid points per dimension.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the BiCGStab solver for the two-dimensional convection-diffusion problem
+// on a \a N-by-\a N grid. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >
+void KrylovTest::testBiCGStab( size_t N, double tolerance )
+{
+   const blaze::SolverControl control( 1000UL, tolerance );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( N*N, N*N );
+   initialize( A, N, 0.3 );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( N*N );
+   initialize( b );
+
+   {
+      test_ = "BiCGStab solver with row-major compressed matrix";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+      const blaze::SolverStatistics stats( bicgstab( A, b, x, control ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+
+   {
+      test_ = "BiCGStab solver with dense matrix";
+
+      const blaze::DynamicMatrix<Type,blaze::columnMajor> B( A );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+      const blaze::SolverStatistics stats( bicgstab( B, b, x, control ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+
+   {
+      test_ = "BiCGStab solver with matrix-free operator";
+
+      auto op = [&A]( const blaze::DynamicVector<Type>& v, blaze::DynamicVector<Type>& y ) {
+         y = A * v;
+      };
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+      const blaze::SolverStatistics stats( bicgstab( op, b, x, control ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+
+   {
+      test_ = "Preconditioned BiCGStab solver";
+
+      auto jacobi = []( const blaze::DynamicVector<Type>& r, blaze::DynamicVector<Type>& z ) {
+         z = r / Type(4);
+      };
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( N*N );
+      randomize( x );
+
+      blaze::BiCGStabSolver<Type> solver( control );
+      const blaze::SolverStatistics stats( solver.solve( A, b, x, jacobi ) );
+      checkResult( stats, A, b, x, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the (preconditioned) restarted GMRES solver.
+//
+// \param N The number of grid points per dimension.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the restarted GMRES solver for the two-dimensional convection-diffusion
+// problem on a \a N-by-\a N grid. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void KrylovTest::testGMRES( size_t N, double tolerance )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( N*N, N*N );
+   initialize( A, N, 0.3 );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( N*N );
+   initialize( b );
+
+   for( size_t restart : { 1UL, 10UL, 30UL, 1000UL } )
+   {
+      const blaze::SolverControl control( 5000UL, tolerance, restart );
+
+      {
+         test_ = "GMRES solver with row-major compressed matrix";
+
+         blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+         const blaze::SolverStatistics stats( gmres( A, b, x, control ) );
+         checkResult( stats, A, b, x, tolerance );
+      }
+
+      {
+         test_ = "GMRES solver with dense matrix";
+
+         const blaze::DynamicMatrix<Type,blaze::rowMajor> B( A );
+
+         blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+         const blaze::SolverStatistics stats( gmres( B, b, x, control ) );
+         checkResult( stats, A, b, x, tolerance );
+      }
+
+      {
+         test_ = "GMRES solver with matrix-free operator";
+
+         auto op = [&A]( const blaze::DynamicVector<Type>& v, blaze::DynamicVector<Type>& y ) {
+            y = A * v;
+         };
+
+         blaze::DynamicVector<Type,blaze::columnVector> x( N*N, Type(0) );
+         const blaze::SolverStatistics stats( gmres( op, b, x, control ) );
+         checkResult( stats, A, b, x, tolerance );
+      }
+
+      {
+         test_ = "Preconditioned GMRES solver";
+
+         auto jacobi = []( const blaze::DynamicVector<Type>& r, blaze::DynamicVector<Type>& z ) {
+            z = r / Type(4);
+         };
+
+         blaze::DynamicVector<Type,blaze::columnVector> x( N*N );
+         randomize( x );
+
+         blaze::GMRESSolver<Type> solver( control );
+         const blaze::SolverStatistics stats( solver.solve( A, b, x, jacobi ) );
+         checkResult( stats, A, b, x, tolerance );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with a convection-diffusion discretization.
+//
+// \param A The matrix to be initialized.
+// \param N The number of grid points per dimension.
+// \param convection The convection coefficient (0 for the symmetric Poisson problem).
+// \return void
+//
+// This function initializes the given matrix with the five-point finite difference
+// discretization of the two-dimensional convection-diffusion problem on a \a N-by-\a N grid.
+*/
+template< typename MT >
+void KrylovTest::initialize( MT& A, size_t N, double convection )
+{
+   using ET = blaze::ElementType_<MT>;
+
+   initializeStencil( A, N, N, 1UL, { ET(4), ET(-1.0-convection), ET(-1.0+convection),
+                                      ET(-1), ET(-1), ET(0), ET(0) } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with random values.
+//
+// \param b The vector to be initialized.
+// \return void
+*/
+template< typename VT >
+void KrylovTest::initialize( VT& b )
+{
+   using ET = blaze::ElementType_<VT>;
+
+   randomize( b );
+
+   for( size_t i=0UL; i<b.size(); ++i ) {
+      b[i] += ET(1);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a solver run.
+//
+// \param stats The statistics of the solver run.
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The computed solution.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver converged and that the true relative residual of the
+// computed solution is within the requested tolerance (with a safety factor of 10 to account
+// for rounding errors). In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename MT, typename VT1, typename VT2 >
+void KrylovTest::checkResult( const blaze::SolverStatistics& stats, const MT& A, const VT1& b,
+                              const VT2& x, double tolerance )
+{
+   using ET = blaze::ElementType_<VT1>;
+
+   const blaze::DynamicVector<ET,blaze::columnVector> r( b - A * x );
+
+   const double rnorm( std::sqrt( static_cast<double>( std::abs( dot( conj( r ), r ) ) ) ) );
+   const double bnorm( std::sqrt( static_cast<double>( std::abs( dot( conj( b ), b ) ) ) ) );
+
+   if( !stats.converged || stats.residual > tolerance || rnorm > 10.0 * tolerance * bnorm ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solver failed to converge\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ET ).name() << "\n"
+          << "   System size = " << b.size() << "\n"
+          << "   Iterations = " << stats.iterations << "\n"
+          << "   Converged = " << stats.converged << "\n"
+          << "   Reported residual = " << stats.residual << "\n"
+          << "   True residual = " << ( rnorm / bnorm ) << "\n"
+          << "   Tolerance = " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the Krylov subspace solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   KrylovTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Krylov subspace solver test.
+*/
+#define RUN_SOLVERS_KRYLOV_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
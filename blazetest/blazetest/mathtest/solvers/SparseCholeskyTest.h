@@ -0,0 +1,419 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/SparseCholeskyTest.h
+//  \brief Header file for the sparse Cholesky solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_SPARSECHOLESKYTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_SPARSECHOLESKYTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/Reordering.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/Stencil.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all sparse Cholesky solver tests.
+//
+// This class represents a test suite for the SparseCholeskySolver class template. The solver
+// is applied to the discretization of a three-dimensional diffusion problem, given as symmetric
+// and Hermitian adaptors and as general sparse matrices, for different orderings and for single
+// and multiple right-hand sides. The results are checked by means of the residuals of the
+// computed solutions.
+*/
+class SparseCholeskyTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseCholeskyTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testOrderings();
+   void testFactorize();
+   void testErrors();
+   void testParallel();
+
+   template< typename Type >
+   void testSymmetric( size_t N, double tolerance );
+
+   template< typename Type >
+   void testHermitian( size_t N, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void initialize( blaze::CompressedMatrix<Type,blaze::rowMajor>& A, size_t N, Type offdiagonal );
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkResult( const MT& A, const VT1& b, const VT2& x, double tolerance );
+
+   template< typename MT, typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResults( const MT& A, const blaze::DenseMatrix<MT1,SO1>& B,
+                      const blaze::DenseMatrix<MT2,SO2>& X, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the sparse Cholesky solver for symmetric matrices.
+//
+// \param N The number of grid points per dimension.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse Cholesky solver for the three-dimensional diffusion problem on
+// a \a N-by-\a N-by-\a N grid, given as row-major and column-major symmetric matrices. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseCholeskyTest::testSymmetric( size_t N, double tolerance )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> tmp;
+   initialize( tmp, N, Type(-1) );
+
+   const blaze::SymmetricMatrix< blaze::CompressedMatrix<Type,blaze::rowMajor> > A( tmp );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( N*N*N );
+   randomize( b );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> B( N*N*N, 5UL );
+   randomize( B );
+
+   {
+      test_ = "Sparse Cholesky solver with row-major symmetric matrix";
+
+      const blaze::SparseCholeskySolver<Type> solver( A );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( A, b, x, tolerance );
+
+      x = b;
+      solver.solve( x, x );
+      checkResult( A, b, x, tolerance );
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with column-major symmetric matrix";
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<Type,blaze::columnMajor> > C( A );
+      const blaze::SparseCholeskySolver<Type> solver( C );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( A, b, x, tolerance );
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with multiple right-hand sides";
+
+      const blaze::SparseCholeskySolver<Type> solver( A );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> X;
+      solver.solve( B, X );
+      checkResults( A, B, X, tolerance );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> Y( B );
+      solver.solve( Y, Y );
+      checkResults( A, B, Y, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse Cholesky solver for Hermitian matrices.
+//
+// \param N The number of grid points per dimension.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse Cholesky solver for a complex Hermitian variant of the
+// three-dimensional diffusion problem on a \a N-by-\a N-by-\a N grid, given as row-major and
+// column-major Hermitian matrices. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void SparseCholeskyTest::testHermitian( size_t N, double tolerance )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> tmp;
+   initialize( tmp, N, Type( -0.8, 0.6 ) );
+
+   const blaze::HermitianMatrix< blaze::CompressedMatrix<Type,blaze::rowMajor> > A( tmp );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( N*N*N );
+   randomize( b );
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> B( N*N*N, 3UL );
+   randomize( B );
+
+   {
+      test_ = "Sparse Cholesky solver with row-major Hermitian matrix";
+
+      const blaze::SparseCholeskySolver<Type> solver( A );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( A, b, x, tolerance );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> X;
+      solver.solve( B, X );
+      checkResults( A, B, X, tolerance );
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with column-major Hermitian matrix";
+
+      const blaze::HermitianMatrix< blaze::CompressedMatrix<Type,blaze::columnMajor> > C( A );
+      const blaze::SparseCholeskySolver<Type> solver( C );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( A, b, x, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with a three-dimensional diffusion discretization.
+//
+// \param A The matrix to be initialized.
+// \param N The number of grid points per dimension.
+// \param offdiagonal The value of the elements below the diagonal.
+// \return void
+//
+// This function initializes the given matrix with the seven-point finite difference
+// discretization of the three-dimensional diffusion problem on a \a N-by-\a N-by-\a N grid.
+// The elements above the diagonal are set to the conjugate of the given off-diagonal value,
+// i.e. the resulting matrix is Hermitian and positive definite.
+*/
+template< typename Type >
+void SparseCholeskyTest::initialize( blaze::CompressedMatrix<Type,blaze::rowMajor>& A,
+                                     size_t N, Type offdiagonal )
+{
+   using blaze::conj;
+
+   const Type upper( conj( offdiagonal ) );
+
+   A.resize( N*N*N, N*N*N, false );
+   initializeStencil( A, N, N, N, { Type(6.5), offdiagonal, upper, offdiagonal, upper,
+                                    offdiagonal, upper } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a sparse Cholesky solve for a single right-hand side.
+//
+// \param A The system matrix.
+// \param b The right-hand side vector.
+// \param x The computed solution.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT, typename VT1, typename VT2 >
+void SparseCholeskyTest::checkResult( const MT& A, const VT1& b, const VT2& x, double tolerance )
+{
+   using ET = blaze::ElementType_<VT1>;
+
+   const blaze::DynamicVector<ET,blaze::columnVector> r( b - A * x );
+
+   const double rnorm( std::sqrt( static_cast<double>( std::abs( dot( conj( r ), r ) ) ) ) );
+   const double bnorm( std::sqrt( static_cast<double>( std::abs( dot( conj( b ), b ) ) ) ) );
+
+   if( x.size() != b.size() || rnorm > tolerance * bnorm ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Sparse Cholesky solve failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ET ).name() << "\n"
+          << "   System size = " << b.size() << "\n"
+          << "   Solution size = " << x.size() << "\n"
+          << "   Relative residual = " << ( rnorm / bnorm ) << "\n"
+          << "   Tolerance = " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a sparse Cholesky solve for multiple right-hand sides.
+//
+// \param A The system matrix.
+// \param B The right-hand side matrix.
+// \param X The computed solution.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT, typename MT1, bool SO1, typename MT2, bool SO2 >
+void SparseCholeskyTest::checkResults( const MT& A, const blaze::DenseMatrix<MT1,SO1>& B,
+                                       const blaze::DenseMatrix<MT2,SO2>& X, double tolerance )
+{
+   if( (~X).rows() != (~B).rows() || (~X).columns() != (~B).columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size of the solution matrix\n"
+          << " Details:\n"
+          << "   Solution matrix = " << (~X).rows() << "x" << (~X).columns() << "\n"
+          << "   Expected size = " << (~B).rows() << "x" << (~B).columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t k=0UL; k<(~B).columns(); ++k ) {
+      checkResult( A, column( ~B, k ), column( ~X, k ), tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse Cholesky solver.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseCholeskyTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse Cholesky solver test.
+*/
+#define RUN_SOLVERS_SPARSECHOLESKY_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
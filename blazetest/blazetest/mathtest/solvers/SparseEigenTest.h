@@ -0,0 +1,472 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/SparseEigenTest.h
+//  \brief Header file for the sparse eigenvalue solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_SPARSEEIGENTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_SPARSEEIGENTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/SpectrumFlag.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/Stencil.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all sparse eigenvalue solver tests.
+//
+// This class represents a test suite for the LanczosSolver and ArnoldiSolver class templates.
+// The solvers are applied to the discretizations of two-dimensional diffusion and convection-
+// diffusion problems on rectangular grids, whose eigenvalues are known analytically. The results
+// are checked by means of the exact eigenvalues, the residuals of the computed eigenpairs and
+// the orthonormality of the computed eigenvectors.
+*/
+class SparseEigenTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseEigenTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testMatrixFree();
+   void testComplexPairs();
+   void testErrors();
+
+   template< typename Type >
+   void testLanczos( size_t N, size_t M, Type offdiagonal, double tolerance );
+
+   template< typename Type >
+   void testArnoldi( size_t N, size_t M, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void initialize( blaze::CompressedMatrix<Type,blaze::rowMajor>& A, size_t N, size_t M,
+                    Type west, Type east );
+
+   std::vector<double> reference( size_t N, size_t M, double s, blaze::SpectrumFlag spectrum );
+
+   template< typename MT, typename VT, typename MT2 >
+   void checkEigenpairs( const MT& A, const VT& w, const MT2& X,
+                         const std::vector<double>& ref, double tolerance );
+
+   template< typename MT >
+   void checkOrthonormality( const MT& X, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Lanczos solver for symmetric and Hermitian matrices.
+//
+// \param N The number of grid points in x-direction.
+// \param M The number of grid points in y-direction.
+// \param offdiagonal The coupling to the western neighbor (of magnitude 1).
+// \param tolerance The tolerance for the computed eigenpairs.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Lanczos solver for the two-dimensional diffusion problem on a
+// \a N-by-\a M grid. For complex element types, the coupling in x-direction is given by a
+// constant phase, which does not change the eigenvalues. Both the largest and the smallest
+// eigenvalues are computed. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >
+void SparseEigenTest::testLanczos( size_t N, size_t M, Type offdiagonal, double tolerance )
+{
+   using blaze::conj;
+
+   using BT = blaze::UnderlyingElement_<Type>;
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+   initialize( A, N, M, offdiagonal, conj( offdiagonal ) );
+
+   const blaze::SolverControl control( 500UL, tolerance*1E-2, 20UL );
+
+   {
+      test_ = "Lanczos solver for the largest eigenvalues";
+
+      blaze::LanczosSolver<Type> solver( control );
+
+      blaze::DynamicVector<BT,blaze::columnVector> w;
+      blaze::DynamicMatrix<Type,blaze::columnMajor> X;
+
+      const blaze::SolverStatistics stats( solver.solve( A, w, X, 4UL ) );
+
+      if( !stats.converged ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lanczos solver did not converge\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Restarts = " << stats.iterations << "\n"
+             << "   Residual = " << stats.residual << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkEigenpairs( A, w, X, reference( N, M, 1.0, blaze::largestAlgebraic ), tolerance );
+      checkOrthonormality( X, tolerance );
+   }
+
+   {
+      test_ = "Lanczos solver for the smallest eigenvalues";
+
+      blaze::DynamicVector<BT,blaze::columnVector> w;
+      blaze::DynamicMatrix<Type,blaze::rowMajor> X;
+
+      blaze::lanczos( A, w, X, 3UL, blaze::smallestAlgebraic, control );
+
+      checkEigenpairs( A, w, X, reference( N, M, 1.0, blaze::smallestAlgebraic ), tolerance );
+      checkOrthonormality( X, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Arnoldi solver for non-symmetric matrices.
+//
+// \param N The number of grid points in x-direction.
+// \param M The number of grid points in y-direction.
+// \param tolerance The tolerance for the computed eigenpairs.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Arnoldi solver for the two-dimensional convection-diffusion problem
+// on a \a N-by-\a M grid, whose eigenvalues are real. Both the eigenvalues of largest magnitude
+// and the eigenvalues with smallest real part are computed. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseEigenTest::testArnoldi( size_t N, size_t M, double tolerance )
+{
+   using CT = blaze::complex< blaze::UnderlyingElement_<Type> >;
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+   initialize( A, N, M, Type(-1.3), Type(-0.7) );
+
+   const double s( std::sqrt( 1.3*0.7 ) );
+   const blaze::SolverControl control( 500UL, tolerance*1E-2, 20UL );
+
+   {
+      test_ = "Arnoldi solver for the eigenvalues of largest magnitude";
+
+      blaze::ArnoldiSolver<Type> solver( control );
+
+      blaze::DynamicVector<CT,blaze::columnVector> w;
+      blaze::DynamicMatrix<CT,blaze::columnMajor> X;
+
+      const blaze::SolverStatistics stats( solver.solve( A, w, X, 4UL ) );
+
+      if( !stats.converged ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Arnoldi solver did not converge\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Restarts = " << stats.iterations << "\n"
+             << "   Residual = " << stats.residual << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkEigenpairs( A, w, X, reference( N, M, s, blaze::largestMagnitude ), tolerance );
+   }
+
+   {
+      test_ = "Arnoldi solver for the eigenvalues with smallest real part";
+
+      blaze::ArnoldiSolver<Type> solver( control );
+
+      blaze::DynamicVector<CT,blaze::columnVector> w;
+      blaze::DynamicMatrix<CT,blaze::rowMajor> X;
+
+      solver.solve( A, w, X, 3UL, blaze::smallestAlgebraic );
+
+      checkEigenpairs( A, w, X, reference( N, M, s, blaze::smallestAlgebraic ), tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with a two-dimensional convection-diffusion problem.
+//
+// \param A The matrix to be initialized.
+// \param N The number of grid points in x-direction.
+// \param M The number of grid points in y-direction.
+// \param west The coupling to the western neighbor.
+// \param east The coupling to the eastern neighbor.
+// \return void
+//
+// This function initializes the given matrix with the five-point finite difference
+// discretization of the two-dimensional convection-diffusion problem on a \a N-by-\a M grid.
+// The coupling in y-direction is -1 and the diagonal elements are 4. In case \a east is the
+// conjugate of \a west, the resulting matrix is Hermitian.
+*/
+template< typename Type >
+void SparseEigenTest::initialize( blaze::CompressedMatrix<Type,blaze::rowMajor>& A,
+                                  size_t N, size_t M, Type west, Type east )
+{
+   A.resize( N*M, N*M, false );
+   initializeStencil( A, N, M, 1UL, { Type(4), west, east, Type(-1), Type(-1), Type(0), Type(0) } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the computed eigenpairs.
+//
+// \param A The system matrix.
+// \param w The computed eigenvalues.
+// \param X The computed eigenvectors.
+// \param ref The exact eigenvalues.
+// \param tolerance The tolerance for the computed eigenpairs.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the computed eigenvalues against the exact eigenvalues, the residuals
+// \f$ \|A*x-\lambda*x\|_2 \f$ and the normalization of the computed eigenvectors. Since the
+// largest eigenvalue of all test problems is about 8, the tolerance is scaled accordingly.
+*/
+template< typename MT, typename VT, typename MT2 >
+void SparseEigenTest::checkEigenpairs( const MT& A, const VT& w, const MT2& X,
+                                       const std::vector<double>& ref, double tolerance )
+{
+   using blaze::conj;
+
+   using ET = blaze::ElementType_<MT2>;
+
+   const size_t nev( w.size() );
+   const double scale( 8.0 );
+
+   if( X.rows() != A.rows() || X.columns() != nev ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size of the eigenvector matrix\n"
+          << " Details:\n"
+          << "   Eigenvector matrix = " << X.rows() << "x" << X.columns() << "\n"
+          << "   Expected size = " << A.rows() << "x" << nev << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<nev; ++i )
+   {
+      const blaze::DynamicVector<ET,blaze::columnVector> x( column( X, i ) );
+      const blaze::DynamicVector<ET,blaze::columnVector> r( A * x - ET( w[i] ) * x );
+
+      const double error( std::abs( blaze::complex<double>( w[i] ) - ref[i] ) );
+      const double rnorm( std::sqrt( static_cast<double>( std::abs( dot( conj( r ), r ) ) ) ) );
+
+      if( error > tolerance * scale || rnorm > tolerance * scale ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid eigenpair detected\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( ET ).name() << "\n"
+             << "   Index = " << i << "\n"
+             << "   Computed eigenvalue = " << w[i] << "\n"
+             << "   Exact eigenvalue = " << ref[i] << "\n"
+             << "   Residual = " << rnorm << "\n"
+             << "   Tolerance = " << tolerance << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const double xnorm( std::sqrt( static_cast<double>( std::abs( dot( conj( x ), x ) ) ) ) );
+
+      if( std::abs( xnorm - 1.0 ) > tolerance * scale ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvector is not normalized\n"
+             << " Details:\n"
+             << "   Element type:\n"
+             << "     " << typeid( ET ).name() << "\n"
+             << "   Index = " << i << "\n"
+             << "   Norm = " << xnorm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the orthonormality of the computed eigenvectors.
+//
+// \param X The computed eigenvectors.
+// \param tolerance The tolerance for the orthonormality.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >
+void SparseEigenTest::checkOrthonormality( const MT& X, double tolerance )
+{
+   using ET = blaze::ElementType_<MT>;
+
+   const blaze::DynamicMatrix<ET,blaze::columnMajor> I( ctrans( X ) * X );
+
+   for( size_t i=0UL; i<I.rows(); ++i ) {
+      for( size_t j=0UL; j<I.columns(); ++j )
+      {
+         if( std::abs( I(i,j) - ET( i == j ? 1 : 0 ) ) > tolerance ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Eigenvectors are not orthonormal\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( ET ).name() << "\n"
+                << "   Inner products:\n" << I << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse eigenvalue solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseEigenTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse eigenvalue solver test.
+*/
+#define RUN_SOLVERS_SPARSEEIGEN_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
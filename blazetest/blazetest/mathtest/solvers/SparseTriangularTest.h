@@ -0,0 +1,457 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/SparseTriangularTest.h
+//  \brief Header file for the sparse triangular solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_SPARSETRIANGULARTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_SPARSETRIANGULARTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blaze/math/UniUpperMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/Stencil.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all sparse triangular solver tests.
+//
+// This class represents a test suite for the SparseTriangularSolver class template. The solver
+// is applied to the lower and upper parts of the discretization of a two-dimensional
+// convection-diffusion problem, given as lower, upper, unilower, and uniupper adaptors, for
+// single and multiple right-hand sides. The results are checked by means of the residuals of
+// the computed solutions.
+*/
+class SparseTriangularTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SparseTriangularTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testUpdate();
+   void testErrors();
+
+   template< typename Type >
+   void testLower( size_t N, double tolerance );
+
+   template< typename Type >
+   void testUpper( size_t N, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& A, size_t N );
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkResult( const MT& A, const VT1& b, const VT2& x, double tolerance );
+
+   template< typename MT, typename MT1, bool SO1, typename MT2, bool SO2 >
+   void checkResults( const MT& A, const blaze::DenseMatrix<MT1,SO1>& B,
+                      const blaze::DenseMatrix<MT2,SO2>& X, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the sparse triangular solver for lower triangular matrices.
+//
+// \param N The number of grid points per dimension.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the forward substitution with the lower part of the two-dimensional
+// convection-diffusion problem on a \a N-by-\a N grid. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTriangularTest::testLower( size_t N, double tolerance )
+{
+   blaze::LowerMatrix< blaze::CompressedMatrix<Type,blaze::rowMajor> > L( N*N );
+   initialize( L, N );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( N*N );
+   randomize( b );
+
+   blaze::DynamicMatrix<Type,blaze::rowMajor> B( N*N, 5UL );
+   randomize( B );
+
+   {
+      test_ = "Forward substitution with row-major lower matrix";
+
+      const blaze::SparseTriangularSolver<Type> solver( L );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( L, b, x, tolerance );
+
+      x = b;
+      solver.solve( x, x );
+      checkResult( L, b, x, tolerance );
+   }
+
+   {
+      test_ = "Forward substitution with column-major lower matrix";
+
+      const blaze::LowerMatrix< blaze::CompressedMatrix<Type,blaze::columnMajor> > C( L );
+      const blaze::SparseTriangularSolver<Type> solver( C );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( L, b, x, tolerance );
+   }
+
+   {
+      test_ = "Forward substitution with unilower matrix";
+
+      blaze::UniLowerMatrix< blaze::CompressedMatrix<Type,blaze::rowMajor> > U( N*N );
+      for( size_t i=0UL; i<N*N; ++i ) {
+         for( auto element=L.begin(i); element!=L.end(i) && element->index()<i; ++element ) {
+            U(i,element->index()) = element->value() / Type(4);
+         }
+      }
+
+      const blaze::SparseTriangularSolver<Type> solver( U );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( U, b, x, tolerance );
+   }
+
+   {
+      test_ = "Forward substitution with multiple right-hand sides";
+
+      const blaze::SparseTriangularSolver<Type> solver( L );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> X;
+      solver.solve( B, X );
+      checkResults( L, B, X, tolerance );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> Y;
+      solver.solve( B, Y );
+      checkResults( L, B, Y, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse triangular solver for upper triangular matrices.
+//
+// \param N The number of grid points per dimension.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the backward substitution with the upper part of the two-dimensional
+// convection-diffusion problem on a \a N-by-\a N grid. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void SparseTriangularTest::testUpper( size_t N, double tolerance )
+{
+   blaze::UpperMatrix< blaze::CompressedMatrix<Type,blaze::rowMajor> > U( N*N );
+   initialize( U, N );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( N*N );
+   randomize( b );
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> B( N*N, 5UL );
+   randomize( B );
+
+   {
+      test_ = "Backward substitution with row-major upper matrix";
+
+      const blaze::SparseTriangularSolver<Type> solver( U );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( U, b, x, tolerance );
+   }
+
+   {
+      test_ = "Backward substitution with column-major upper matrix";
+
+      const blaze::UpperMatrix< blaze::CompressedMatrix<Type,blaze::columnMajor> > C( U );
+      const blaze::SparseTriangularSolver<Type> solver( C );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( U, b, x, tolerance );
+   }
+
+   {
+      test_ = "Backward substitution with uniupper matrix";
+
+      blaze::UniUpperMatrix< blaze::CompressedMatrix<Type,blaze::rowMajor> > V( N*N );
+      for( size_t i=0UL; i<N*N; ++i ) {
+         for( auto element=U.upperBound(i,i); element!=U.end(i); ++element ) {
+            V(i,element->index()) = element->value() / Type(4);
+         }
+      }
+
+      const blaze::SparseTriangularSolver<Type> solver( V );
+
+      blaze::DynamicVector<Type,blaze::columnVector> x;
+      solver.solve( b, x );
+      checkResult( V, b, x, tolerance );
+   }
+
+   {
+      test_ = "Backward substitution with multiple right-hand sides";
+
+      const blaze::SparseTriangularSolver<Type> solver( U );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> X;
+      solver.solve( B, X );
+      checkResults( U, B, X, tolerance );
+
+      blaze::DynamicMatrix<Type,blaze::columnMajor> Y( B );
+      solver.solve( Y, Y );
+      checkResults( U, B, Y, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given triangular matrix with a convection-diffusion discretization.
+//
+// \param A The lower or upper triangular matrix to be initialized.
+// \param N The number of grid points per dimension.
+// \return void
+//
+// This function initializes the given matrix with the lower or upper part of the five-point
+// finite difference discretization of the two-dimensional convection-diffusion problem on a
+// \a N-by-\a N grid.
+*/
+template< typename MT >
+void SparseTriangularTest::initialize( MT& A, size_t N )
+{
+   using ET = blaze::ElementType_<MT>;
+
+   const bool lower( blaze::IsLower<MT>::value );
+   const bool upper( blaze::IsUpper<MT>::value );
+
+   const ET zero( 0 );
+
+   initializeStencil( A, N, N, 1UL, { ET(4),
+                                      lower ? ET(-1.3) : zero, upper ? ET(-0.7) : zero,
+                                      lower ? ET(-1)   : zero, upper ? ET(-1)   : zero,
+                                      zero, zero } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a triangular solve for a single right-hand side.
+//
+// \param A The triangular matrix.
+// \param b The right-hand side vector.
+// \param x The computed solution.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT, typename VT1, typename VT2 >
+void SparseTriangularTest::checkResult( const MT& A, const VT1& b, const VT2& x, double tolerance )
+{
+   using ET = blaze::ElementType_<VT1>;
+
+   const blaze::DynamicVector<ET,blaze::columnVector> r( b - A * x );
+
+   const double rnorm( std::sqrt( static_cast<double>( std::abs( dot( conj( r ), r ) ) ) ) );
+   const double bnorm( std::sqrt( static_cast<double>( std::abs( dot( conj( b ), b ) ) ) ) );
+
+   if( x.size() != b.size() || rnorm > tolerance * bnorm ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Triangular solve failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ET ).name() << "\n"
+          << "   System size = " << b.size() << "\n"
+          << "   Solution size = " << x.size() << "\n"
+          << "   Relative residual = " << ( rnorm / bnorm ) << "\n"
+          << "   Tolerance = " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a triangular solve for multiple right-hand sides.
+//
+// \param A The triangular matrix.
+// \param B The right-hand side matrix.
+// \param X The computed solution.
+// \param tolerance The tolerance for the relative residual.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT, typename MT1, bool SO1, typename MT2, bool SO2 >
+void SparseTriangularTest::checkResults( const MT& A, const blaze::DenseMatrix<MT1,SO1>& B,
+                                         const blaze::DenseMatrix<MT2,SO2>& X, double tolerance )
+{
+   if( (~X).rows() != (~B).rows() || (~X).columns() != (~B).columns() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size of the solution matrix\n"
+          << " Details:\n"
+          << "   Solution matrix = " << (~X).rows() << "x" << (~X).columns() << "\n"
+          << "   Expected size = " << (~B).rows() << "x" << (~B).columns() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t k=0UL; k<(~B).columns(); ++k ) {
+      checkResult( A, column( ~B, k ), column( ~X, k ), tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse triangular solver.
+//
+// \return void
+*/
+void runTest()
+{
+   SparseTriangularTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse triangular solver test.
+*/
+#define RUN_SOLVERS_SPARSETRIANGULAR_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
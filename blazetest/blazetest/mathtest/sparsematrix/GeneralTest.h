@@ -103,6 +103,7 @@ class GeneralTest
    void testIsIdentity();
    void testMinimum();
    void testMaximum();
+   void testPartialReduce();
    void testTrace();
 
    template< typename Type >
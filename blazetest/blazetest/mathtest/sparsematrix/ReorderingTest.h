@@ -0,0 +1,232 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/sparsematrix/ReorderingTest.h
+//  \brief Header file for the sparse matrix reordering test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SPARSEMATRIX_REORDERINGTEST_H_
+#define _BLAZETEST_MATHTEST_SPARSEMATRIX_REORDERINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Reordering.h>
+#include <blazetest/mathtest/Stencil.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for tests of the sparse matrix reorderings.
+//
+// This class represents a test suite for the reordering functionality contained in the
+// <em><blaze/math/sparse/Reordering.h></em> header file. It tests the reverse Cuthill-McKee
+// and the approximate minimum degree orderings as well as the symmetric permutation of sparse
+// matrices and the permutation of dense vectors.
+*/
+class ReorderingTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ReorderingTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPermute();
+   void testRCM();
+   void testAMD();
+   void testErrors();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void initialize( MT& A, size_t N );
+
+   std::vector<size_t> shuffle( size_t n );
+
+   void checkPermutation( const std::vector<size_t>& perm, size_t n );
+
+   template< typename MT >
+   size_t fill( const MT& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with a two-dimensional Poisson discretization.
+//
+// \param A The matrix to be initialized.
+// \param N The number of grid points per dimension.
+// \return void
+//
+// This function initializes the given matrix with the five-point finite difference
+// discretization of the two-dimensional Poisson problem on a \a N-by-\a N grid.
+*/
+template< typename MT >
+void ReorderingTest::initialize( MT& A, size_t N )
+{
+   A.resize( N*N, N*N, false );
+   initializeStencil( A, N, N, 1UL, { 4.0, -1.0, -1.0, -1.0, -1.0, 0.0, 0.0 } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the number of non-zero elements of the Cholesky factor of the given matrix.
+//
+// \param A The row-major sparse matrix with symmetric sparsity pattern.
+// \return The number of non-zero elements of the lower Cholesky factor (including the diagonal).
+//
+// This function performs a symbolic Cholesky factorization of the given matrix by traversing
+// the row subtrees of the elimination tree.
+*/
+template< typename MT >
+size_t ReorderingTest::fill( const MT& A )
+{
+   const size_t n( A.rows() );
+
+   std::vector<size_t> parent( n, n ), mark( n, n );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      mark[i] = i;
+      ++nonzeros;
+
+      for( auto element=A.begin(i); element!=A.end(i) && element->index()<i; ++element ) {
+         for( size_t k=element->index(); mark[k]!=i; k=parent[k] ) {
+            if( parent[k] == n ) parent[k] = i;
+            mark[k] = i;
+            ++nonzeros;
+         }
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix reorderings.
+//
+// \return void
+*/
+void runTest()
+{
+   ReorderingTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix reordering test.
+*/
+#define RUN_SPARSEMATRIX_REORDERING_TEST \
+   blazetest::mathtest::sparsematrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
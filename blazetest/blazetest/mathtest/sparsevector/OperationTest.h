@@ -88,6 +88,8 @@ class OperationTest
    void testNormalize();
    void testMinimum();
    void testMaximum();
+   void testSum();
+   void testProd();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
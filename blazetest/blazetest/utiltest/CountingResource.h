@@ -0,0 +1,158 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/CountingResource.h
+//  \brief Header file for the CountingResource class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZETEST_UTILTEST_COUNTINGRESOURCE_H_
+#define _BLAZETEST_UTILTEST_COUNTINGRESOURCE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/MemoryResource.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Implementation of a memory resource that counts all allocations and deallocations.
+//
+// The CountingResource class represents a memory resource for testing purposes. It forwards
+// all requests to the system memory resource and counts the number of allocations, the number
+// of deallocations and the number of currently live allocations.
+*/
+class CountingResource : public blaze::MemoryResource
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline CountingResource();
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline blaze::byte_t* allocate  ( size_t size, size_t alignment ) override;
+   inline void           deallocate( blaze::byte_t* address, size_t size, size_t alignment ) noexcept override;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t allocations_;    //!< The total number of allocations.
+   size_t deallocations_;  //!< The total number of deallocations.
+   size_t live_;           //!< The number of currently live allocations.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor of CountingResource.
+*/
+inline CountingResource::CountingResource()
+   : allocations_  ( 0UL )  // The total number of allocations
+   , deallocations_( 0UL )  // The total number of deallocations
+   , live_         ( 0UL )  // The number of currently live allocations
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Counted allocation via the system memory resource.
+//
+// \param size The number of bytes to be allocated.
+// \param alignment The required minimum alignment.
+// \return Byte pointer to the allocated memory.
+// \exception std::bad_alloc Allocation failed.
+*/
+inline blaze::byte_t* CountingResource::allocate( size_t size, size_t alignment )
+{
+   blaze::byte_t* const address( blaze::systemMemoryResource()->allocate( size, alignment ) );
+   ++allocations_;
+   ++live_;
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counted deallocation via the system memory resource.
+//
+// \param address The address of the memory to be deallocated.
+// \param size The number of bytes that were allocated.
+// \param alignment The alignment of the allocation.
+// \return void
+*/
+inline void CountingResource::deallocate( blaze::byte_t* address, size_t size, size_t alignment ) noexcept
+{
+   blaze::systemMemoryResource()->deallocate( address, size, alignment );
+   ++deallocations_;
+   --live_;
+}
+//*************************************************************************************************
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
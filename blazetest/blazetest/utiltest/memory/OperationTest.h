@@ -83,6 +83,8 @@ class OperationTest
    void testBuiltinTypes();
    void testClassTypes();
    void testNullPointer();
+   void testScratchArena();
+   void testMemoryResource();
    //@}
    //**********************************************************************************************
 
@@ -0,0 +1,368 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/custommatrix/MappedTest.cpp
+//  \brief Source file for the MappedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/MappedMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/custommatrix/MappedTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace custommatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MappedTest::MappedTest()
+   : test_    ()
+   , filename_( "MappedTest.mat" )
+{
+   testRowMajor();
+   testColumnMajor();
+   testAdvise();
+   testInvalidFiles();
+
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a row-major MappedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates, modifies and reopens a row-major matrix file. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testRowMajor()
+{
+   test_ = "Row-major MappedMatrix";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> ref( 13UL, 7UL );
+   blaze::randomize( ref );
+
+   // Creating a new matrix file
+   {
+      blaze::MappedMatrix<double,blaze::rowMajor> mat( filename_, 13UL, 7UL );
+
+      if( mat.rows() != 13UL || mat.columns() != 7UL || mat.spacing() < 8UL ||
+          blaze::nonZeros( mat.matrix() ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a matrix file failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.matrix() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.matrix() = ref;
+      mat.flush();
+   }
+
+   // Mapping the matrix file read-only
+   {
+      const blaze::MappedMatrix<double,blaze::rowMajor> mat( filename_, blaze::readOnly );
+
+      blaze::DynamicVector<double,blaze::columnVector> x( 7UL );
+      blaze::randomize( x );
+
+      const blaze::DynamicVector<double,blaze::columnVector> y1( mat.matrix() * x );
+      const blaze::DynamicVector<double,blaze::columnVector> y2( ref * x );
+
+      if( mat.matrix() != ref || y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Read-only mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.matrix() << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Modifying the matrix file
+   {
+      blaze::MappedMatrix<double,blaze::rowMajor> mat( filename_, blaze::readWrite );
+      mat.matrix() *= 2.0;
+      ref *= 2.0;
+   }
+
+   {
+      const blaze::MappedMatrix<double,blaze::rowMajor> mat( filename_, blaze::readOnly );
+
+      if( mat.matrix() != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Read-write mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.matrix() << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a column-major MappedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates and reopens a column-major matrix file. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testColumnMajor()
+{
+   test_ = "Column-major MappedMatrix";
+
+   blaze::DynamicMatrix<float,blaze::columnMajor> ref( 5UL, 11UL );
+   blaze::randomize( ref );
+
+   {
+      blaze::MappedMatrix<float,blaze::columnMajor> mat( filename_, 5UL, 11UL );
+      mat.matrix() = ref;
+   }
+
+   {
+      blaze::MappedMatrix<float,blaze::columnMajor> mat( filename_, blaze::readOnly );
+
+      blaze::DynamicVector<float,blaze::rowVector> x( 5UL );
+      blaze::randomize( x );
+
+      const blaze::DynamicVector<float,blaze::rowVector> y1( x * mat.matrix() );
+      const blaze::DynamicVector<float,blaze::rowVector> y2( x * ref );
+
+      if( mat.rows() != 5UL || mat.columns() != 11UL || mat.spacing() < 16UL ||
+          mat.matrix() != ref || y1 != y2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Column-major mapping failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat.matrix() << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the access advices of MappedMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the advise() functions of the MappedMatrix class template. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testAdvise()
+{
+   test_ = "MappedMatrix::advise()";
+
+   {
+      blaze::MappedMatrix<double,blaze::rowMajor> mat( filename_, 1000UL, 100UL );
+      mat.matrix() = 1.0;
+   }
+
+   blaze::MappedMatrix<double,blaze::rowMajor> mat( filename_, blaze::readOnly );
+
+   mat.advise( blaze::sequentialAccess );
+   mat.advise( blaze::willNeedAccess, 500UL, 500UL );
+   mat.advise( blaze::dontNeedAccess, 0UL, 500UL );
+
+   if( blaze::sum( mat.matrix() ) != 100000.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix after access advices\n"
+          << " Details:\n"
+          << "   Result: " << blaze::sum( mat.matrix() ) << "\n"
+          << "   Expected result: 100000\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat.advise( blaze::willNeedAccess, 900UL, 101UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Advising an invalid row range succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the validation of matrix files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid or incompatible matrix files are rejected. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testInvalidFiles()
+{
+   test_ = "Invalid matrix files";
+
+   {
+      blaze::MappedMatrix<double,blaze::rowMajor> mat( filename_, 4UL, 4UL );
+   }
+
+   // Mismatching storage order
+   try {
+      blaze::MappedMatrix<double,blaze::columnMajor> mat( filename_, blaze::readOnly );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a matrix with mismatching storage order succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Mismatching element type
+   try {
+      blaze::MappedMatrix<float,blaze::rowMajor> mat( filename_, blaze::readOnly );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a matrix with mismatching element type succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Corrupted file signature
+   {
+      blaze::MappedFile file( filename_, blaze::readWrite );
+      file.data()[0] = 'X';
+   }
+
+   try {
+      blaze::MappedMatrix<double,blaze::rowMajor> mat( filename_, blaze::readOnly );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a corrupted matrix file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Non-existing file
+   try {
+      blaze::MappedMatrix<double,blaze::rowMajor> mat( "MappedTest.none", blaze::readOnly );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a non-existing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {
+      throw;
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ) != "Opening file failed" )
+         throw;
+   }
+}
+//*************************************************************************************************
+
+} // namespace custommatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_CUSTOMMATRIX_MAPPED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -42,7 +42,9 @@
 #include <memory>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/UpperMatrix.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Memory.h>
@@ -86,6 +88,7 @@ UnalignedUnpaddedTest::UnalignedUnpaddedTest()
    testTranspose();
    testCTranspose();
    testIsDefault();
+   testIsAligned();
 }
 //*************************************************************************************************
 
@@ -5622,6 +5625,146 @@ void UnalignedUnpaddedTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c isAligned() member function of the CustomMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isAligned() member function of the CustomMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void UnalignedUnpaddedTest::testIsAligned()
+{
+   const size_t SIMDSIZE( blaze::SIMDTrait<int>::size );
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major isAligned() function";
+
+      // isAligned with a spacing that is a multiple of the SIMD size
+      {
+         std::unique_ptr<int[],blaze::Deallocate> memory( blaze::allocate<int>( 4UL*SIMDSIZE ) );
+         MT mat( memory.get(), 2UL, SIMDSIZE-1UL, 2UL*SIMDSIZE );
+
+         if( !mat.isAligned() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isAligned evaluation\n"
+                << " Details:\n"
+                << "   Number of columns = " << mat.columns() << "\n"
+                << "   Spacing           = " << mat.spacing() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // isAligned with a spacing that is not a multiple of the SIMD size
+      {
+         std::unique_ptr<int[],blaze::Deallocate> memory( blaze::allocate<int>( 4UL*SIMDSIZE ) );
+         MT mat( memory.get(), 2UL, SIMDSIZE, SIMDSIZE+1UL );
+
+         if( mat.isAligned() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isAligned evaluation\n"
+                << " Details:\n"
+                << "   Number of columns = " << mat.columns() << "\n"
+                << "   Spacing           = " << mat.spacing() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<mat.rows(); ++i )
+            for( size_t j=0UL; j<mat.columns(); ++j )
+               mat(i,j) = static_cast<int>( i*mat.columns() + j );
+
+         blaze::DynamicMatrix<int,blaze::rowMajor> ref( mat );
+         mat += ref;
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            for( size_t j=0UL; j<mat.columns(); ++j ) {
+               if( mat(i,j) != 2*ref(i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Addition assignment to strided matrix failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Expected result:\n" << ( 2*ref ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major isAligned() function";
+
+      // isAligned with a spacing that is a multiple of the SIMD size
+      {
+         std::unique_ptr<int[],blaze::Deallocate> memory( blaze::allocate<int>( 4UL*SIMDSIZE ) );
+         OMT mat( memory.get(), SIMDSIZE-1UL, 2UL, 2UL*SIMDSIZE );
+
+         if( !mat.isAligned() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isAligned evaluation\n"
+                << " Details:\n"
+                << "   Number of rows = " << mat.rows() << "\n"
+                << "   Spacing        = " << mat.spacing() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // isAligned with a spacing that is not a multiple of the SIMD size
+      {
+         std::unique_ptr<int[],blaze::Deallocate> memory( blaze::allocate<int>( 4UL*SIMDSIZE ) );
+         OMT mat( memory.get(), SIMDSIZE, 2UL, SIMDSIZE+1UL );
+
+         if( mat.isAligned() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isAligned evaluation\n"
+                << " Details:\n"
+                << "   Number of rows = " << mat.rows() << "\n"
+                << "   Spacing        = " << mat.spacing() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t j=0UL; j<mat.columns(); ++j )
+            for( size_t i=0UL; i<mat.rows(); ++i )
+               mat(i,j) = static_cast<int>( j*mat.rows() + i );
+
+         blaze::DynamicMatrix<int,blaze::columnMajor> ref( mat );
+         mat += ref;
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            for( size_t i=0UL; i<mat.rows(); ++i ) {
+               if( mat(i,j) != 2*ref(i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Addition assignment to strided matrix failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Expected result:\n" << ( 2*ref ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace custommatrix
 
 } // namespace mathtest
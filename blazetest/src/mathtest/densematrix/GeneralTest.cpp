@@ -37,10 +37,13 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/densematrix/GeneralTest.h>
 
 
@@ -78,7 +81,11 @@ GeneralTest::GeneralTest()
    testIsIdentity();
    testMinimum();
    testMaximum();
+   testSum();
+   testReduce();
+   testPartialReduce();
    testTrace();
+   testMultiplicationChain();
 }
 //*************************************************************************************************
 
@@ -4555,6 +4562,475 @@ void GeneralTest::testMaximum()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSum()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sum()";
+
+      // Computing the sum of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 3UL, 2UL, 0 );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,0) =  3;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+         mat(2,1) = -6;
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 2UL );
+         checkNonZeros( mat, 6UL );
+
+         const int totalsum = sum( mat );
+
+         if( totalsum != -3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << totalsum << "\n"
+                << "   Expected result: -3\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the sum of a large matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 19UL, 37UL, 2 );
+         mat(18,36) = 0;
+
+         checkRows    ( mat, 19UL );
+         checkColumns ( mat, 37UL );
+         checkNonZeros( mat, 702UL );
+
+         const int totalsum = sum( mat );
+
+         if( totalsum != 1404 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << totalsum << "\n"
+                << "   Expected result: 1404\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sum()";
+
+      // Computing the sum of a small matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 3UL, 2UL, 0 );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,0) =  3;
+         mat(1,1) = -4;
+         mat(2,0) =  5;
+         mat(2,1) = -6;
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 2UL );
+         checkNonZeros( mat, 6UL );
+
+         const int totalsum = sum( mat );
+
+         if( totalsum != -3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << totalsum << "\n"
+                << "   Expected result: -3\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the sum of a large matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 19UL, 37UL, 2 );
+         mat(18,36) = 0;
+
+         checkRows    ( mat, 19UL );
+         checkColumns ( mat, 37UL );
+         checkNonZeros( mat, 702UL );
+
+         const int totalsum = sum( mat );
+
+         if( totalsum != 1404 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << totalsum << "\n"
+                << "   Expected result: 1404\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reduce() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce() function for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testReduce()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major reduce()";
+
+      // Computing the maximum absolute difference of two matrices
+      {
+         blaze::DynamicMatrix<double,blaze::rowMajor> A( 23UL, 17UL, 1.0 ), B( 23UL, 17UL, 1.0 );
+         B(11,9) = -2.5;
+
+         checkRows   ( A, 23UL );
+         checkColumns( A, 17UL );
+         checkRows   ( B, 23UL );
+         checkColumns( B, 17UL );
+
+         const double maxdiff = reduce( abs( A - B ), blaze::Max() );
+
+         if( maxdiff != 3.5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << maxdiff << "\n"
+                << "   Expected result: 3.5\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing a custom reduction
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) =  1;
+         mat(0,1) = -7;
+         mat(0,2) =  3;
+         mat(1,0) = -4;
+         mat(1,1) =  5;
+         mat(1,2) = -6;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 6UL );
+
+         const int maxabs = reduce( mat, []( int a, int b ){ return std::max( std::abs( a ), std::abs( b ) ); } );
+
+         if( maxabs != 7 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << maxabs << "\n"
+                << "   Expected result: 7\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major reduce()";
+
+      // Computing the maximum absolute difference of two matrices
+      {
+         blaze::DynamicMatrix<double,blaze::columnMajor> A( 23UL, 17UL, 1.0 ), B( 23UL, 17UL, 1.0 );
+         B(11,9) = -2.5;
+
+         checkRows   ( A, 23UL );
+         checkColumns( A, 17UL );
+         checkRows   ( B, 23UL );
+         checkColumns( B, 17UL );
+
+         const double maxdiff = reduce( abs( A - B ), blaze::Max() );
+
+         if( maxdiff != 3.5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << maxdiff << "\n"
+                << "   Expected result: 3.5\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing a custom reduction
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 2UL, 3UL, 0 );
+         mat(0,0) =  1;
+         mat(0,1) = -7;
+         mat(0,2) =  3;
+         mat(1,0) = -4;
+         mat(1,1) =  5;
+         mat(1,2) = -6;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 6UL );
+
+         const int maxabs = reduce( mat, []( int a, int b ){ return std::max( std::abs( a ), std::abs( b ) ); } );
+
+         if( maxabs != 7 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << maxabs << "\n"
+                << "   Expected result: 7\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the row-wise and column-wise \c reduce() functions for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the row-wise and column-wise \c reduce() functions for
+// dense matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPartialReduce()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sum<rowwise>() / sum<columnwise>()";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, 0 );
+      mat(0,0) =  1;
+      mat(0,2) = -2;
+      mat(1,1) =  3;
+      mat(1,3) =  4;
+      mat(2,0) = -5;
+      mat(2,3) =  6;
+
+      checkRows   ( mat, 3UL );
+      checkColumns( mat, 4UL );
+
+      // Row-wise reduction
+      {
+         blaze::DynamicVector<int,blaze::columnVector> rowsums( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( rowsums.size() != 3UL || rowsums[0] != -1 || rowsums[1] != 7 || rowsums[2] != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowsums << "\n"
+                << "   Expected result:\n( -1 7 1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Column-wise reduction
+      {
+         blaze::DynamicVector<int,blaze::rowVector> colsums( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( colsums.size() != 4UL || colsums[0] != -4 || colsums[1] != 3 || colsums[2] != -2 || colsums[3] != 10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colsums << "\n"
+                << "   Expected result:\n( -4 3 -2 10 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major reduce<rowwise>() / reduce<columnwise>()";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat( 31UL, 47UL );
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            mat(i,j) = static_cast<double>( ( i*7UL + j*3UL ) % 11UL ) - 5.0;
+         }
+      }
+
+      checkRows   ( mat, 31UL );
+      checkColumns( mat, 47UL );
+
+      // Row-wise maximum of an expression
+      {
+         const blaze::DynamicVector<double,blaze::columnVector> rowmax(
+            blaze::reduce<blaze::rowwise>( abs( mat ), blaze::Max() ) );
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( rowmax[i] != max( abs( row( mat, i ) ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Row-wise reduction failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << rowmax << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Column-wise minimum with a custom operation
+      {
+         const blaze::DynamicVector<double,blaze::rowVector> colmin(
+            blaze::reduce<blaze::columnwise>( mat, []( double a, double b ){ return std::min( a, b ); } ) );
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( colmin[j] != min( column( mat, j ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Column-wise reduction failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << colmin << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sum<rowwise>() / sum<columnwise>()";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 3UL, 4UL, 0 );
+      mat(0,0) =  1;
+      mat(0,2) = -2;
+      mat(1,1) =  3;
+      mat(1,3) =  4;
+      mat(2,0) = -5;
+      mat(2,3) =  6;
+
+      checkRows   ( mat, 3UL );
+      checkColumns( mat, 4UL );
+
+      // Row-wise reduction
+      {
+         blaze::DynamicVector<int,blaze::columnVector> rowsums( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( rowsums.size() != 3UL || rowsums[0] != -1 || rowsums[1] != 7 || rowsums[2] != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowsums << "\n"
+                << "   Expected result:\n( -1 7 1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Column-wise reduction
+      {
+         blaze::DynamicVector<int,blaze::rowVector> colsums( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( colsums.size() != 4UL || colsums[0] != -4 || colsums[1] != 3 || colsums[2] != -2 || colsums[3] != 10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colsums << "\n"
+                << "   Expected result:\n( -4 3 -2 10 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major reduce<rowwise>() / reduce<columnwise>()";
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat( 31UL, 47UL );
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            mat(i,j) = static_cast<double>( ( i*7UL + j*3UL ) % 11UL ) - 5.0;
+         }
+      }
+
+      checkRows   ( mat, 31UL );
+      checkColumns( mat, 47UL );
+
+      // Row-wise maximum of an expression
+      {
+         const blaze::DynamicVector<double,blaze::columnVector> rowmax(
+            blaze::reduce<blaze::rowwise>( abs( mat ), blaze::Max() ) );
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( rowmax[i] != max( abs( row( mat, i ) ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Row-wise reduction failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << rowmax << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Column-wise minimum with a custom operation
+      {
+         const blaze::DynamicVector<double,blaze::rowVector> colmin(
+            blaze::reduce<blaze::columnwise>( mat, []( double a, double b ){ return std::min( a, b ); } ) );
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( colmin[j] != min( column( mat, j ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Column-wise reduction failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << colmin << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c trace() function for dense matrices.
 //
@@ -4709,6 +5185,186 @@ void GeneralTest::testTrace()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the multiplication of chains of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of three or more matrices, which is
+// evaluated in the cheapest order determined at runtime. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testMultiplicationChain()
+{
+   //=====================================================================================
+   // Dense matrix chains
+   //=====================================================================================
+
+   {
+      test_ = "Dense matrix multiplication chain";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> A( 2UL, 5UL ), D( 4UL, 3UL );
+      blaze::DynamicMatrix<int,blaze::columnMajor> B( 5UL, 1UL ), C( 1UL, 4UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+         for( size_t j=0UL; j<A.columns(); ++j )
+            A(i,j) = static_cast<int>( i + 2UL*j ) - 3;
+      for( size_t i=0UL; i<B.rows(); ++i )
+         B(i,0UL) = static_cast<int>( i ) - 2;
+      for( size_t j=0UL; j<C.columns(); ++j )
+         C(0UL,j) = static_cast<int>( 3UL*j ) - 4;
+      for( size_t i=0UL; i<D.rows(); ++i )
+         for( size_t j=0UL; j<D.columns(); ++j )
+            D(i,j) = static_cast<int>( ( i*j ) % 3UL ) - 1;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> AB ( A * B  );
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ABC( AB * C );
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref( ABC * D );
+
+      // Assignment of chains of different length and shape
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> res1( A * B * C );
+         blaze::DynamicMatrix<int,blaze::columnMajor> res2( A * B * C * D );
+         blaze::DynamicMatrix<int,blaze::rowMajor> res3( ( A * B ) * ( C * D ) );
+         blaze::DynamicMatrix<int,blaze::rowMajor> res4( A * ( B * ( C * D ) ) );
+         blaze::DynamicMatrix<int,blaze::rowMajor> res5( ( 2 * A ) * ( B * C ) * D );
+
+         checkRows   ( res1, 2UL );
+         checkColumns( res1, 4UL );
+         checkRows   ( res2, 2UL );
+         checkColumns( res2, 3UL );
+
+         if( res1 != ABC || res2 != ref || res3 != ref || res4 != ref || res5 != 2*ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment of a multiplication chain failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res1 << "\n" << res2 << "\n" << res3 << "\n"
+                                 << res4 << "\n" << res5 << "\n"
+                << "   Expected result:\n" << ABC << "\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Addition, subtraction, and Schur product assignment
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> res( ref );
+
+         res += A * B * C * D;
+         res -= 3 * A * B * C * D;
+         res %= A * B * C * D;
+
+         if( res != -( ref % ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Compound assignment of a multiplication chain failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << -( ref % ref ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Element access, row access, and multiplication with a vector
+      {
+         const blaze::DynamicVector<int,blaze::rowVector> r( row( A * B * C * D, 1UL ) );
+         const blaze::DynamicVector<int,blaze::columnVector> x( 3UL, 1 );
+         const blaze::DynamicVector<int,blaze::columnVector> y( A * B * C * D * x );
+
+         if( ( A * B * C * D )(1,2) != ref(1,2) || r != row( ref, 1UL ) || y != ref * x ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Access to a multiplication chain failed\n"
+                << " Details:\n"
+                << "   Result:\n" << r << "\n" << trans( y ) << "\n"
+                << "   Expected result:\n" << row( ref, 1UL ) << "\n" << trans( ref * x ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Aliasing
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> res( A );
+
+         res = res * B * C * D;
+
+         if( res != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Aliased assignment of a multiplication chain failed\n"
+                << " Details:\n"
+                << "   Result:\n" << res << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Non-matching sizes
+      try {
+         blaze::DynamicMatrix<int,blaze::rowMajor> res( A * B * D );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication chain of non-matching matrices succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Mixed dense and sparse matrix chains
+   //=====================================================================================
+
+   {
+      test_ = "Mixed dense/sparse matrix multiplication chain";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> A( 6UL, 4UL );
+      blaze::CompressedMatrix<int,blaze::rowMajor> B( 4UL, 8UL );
+      blaze::CompressedMatrix<int,blaze::columnMajor> C( 8UL, 3UL );
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+         for( size_t j=0UL; j<A.columns(); ++j )
+            A(i,j) = static_cast<int>( ( i + j ) % 4UL ) - 1;
+
+      B(0,1) =  2;
+      B(1,5) = -1;
+      B(2,2) =  3;
+      B(3,7) =  4;
+      C(1,0) =  1;
+      C(2,1) = -2;
+      C(5,2) =  5;
+      C(7,0) = -3;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> AB( A * B );
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref( AB * C );
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> res1( A * B * C );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> res2( A * B * C );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> res3( B * C * trans( C ) * trans( B ) );
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref3( B * C * blaze::DynamicMatrix<int>( trans( B * C ) ) );
+
+      checkRows   ( res1, 6UL );
+      checkColumns( res1, 3UL );
+      checkRows   ( res3, 4UL );
+      checkColumns( res3, 4UL );
+
+      if( res1 != ref || res2 != ref || res3 != ref3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of a multiplication chain failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res1 << "\n" << res2 << "\n" << res3 << "\n"
+             << "   Expected result:\n" << ref << "\n" << ref3 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace densematrix
 
 } // namespace mathtest
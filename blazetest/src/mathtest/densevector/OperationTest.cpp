@@ -37,8 +37,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <type_traits>
+#include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/dense/DenseVector.h>
 #include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/densevector/OperationTest.h>
@@ -69,6 +72,10 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testSum();
+   testProd();
+   testReduce();
+   testDeferredScope();
 }
 //*************************************************************************************************
 
@@ -564,6 +571,537 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense vectors template. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSum()
+{
+   test_ = "sum() function";
+
+   {
+      // Initialization check
+      blaze::DynamicVector<int,blaze::rowVector> vec( 4UL );
+      vec[0] =  1;
+      vec[1] = -2;
+      vec[2] =  3;
+      vec[3] = -4;
+
+      checkSize    ( vec, 4UL );
+      checkCapacity( vec, 4UL );
+      checkNonZeros( vec, 4UL );
+
+      if( vec[0] != 1 || vec[1] != -2 || vec[2] != 3 || vec[3] != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Initialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 -2 3 -4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Testing the sum function
+      const int totalsum = sum( vec );
+
+      if( totalsum != -2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: -2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Initialization check
+      blaze::DynamicVector<int,blaze::columnVector> vec( 103UL );
+      for( size_t i=0UL; i<vec.size(); ++i ) {
+         vec[i] = static_cast<int>( i );
+      }
+
+      checkSize    ( vec, 103UL );
+      checkCapacity( vec, 103UL );
+      checkNonZeros( vec, 102UL );
+
+      // Testing the sum function
+      const int totalsum = sum( vec );
+
+      if( totalsum != 5253 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: 5253\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Testing the sum function for a vector expression
+      blaze::DynamicVector<int,blaze::columnVector> a( 37UL, 2 ), b( 37UL, -5 );
+
+      const int totalsum = sum( a + b );
+
+      if( totalsum != -111 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: -111\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Testing the sum function for an empty vector
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const int totalsum = sum( vec );
+
+      if( totalsum != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fourth computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c prod() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prod() function for dense vectors template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testProd()
+{
+   test_ = "prod() function";
+
+   {
+      // Initialization check
+      blaze::DynamicVector<int,blaze::rowVector> vec( 4UL );
+      vec[0] =  1;
+      vec[1] = -2;
+      vec[2] =  3;
+      vec[3] = -4;
+
+      checkSize    ( vec, 4UL );
+      checkCapacity( vec, 4UL );
+      checkNonZeros( vec, 4UL );
+
+      if( vec[0] != 1 || vec[1] != -2 || vec[2] != 3 || vec[3] != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Initialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 -2 3 -4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Testing the prod function
+      const int totalprod = prod( vec );
+
+      if( totalprod != 24 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalprod << "\n"
+             << "   Expected result: 24\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Initialization check
+      blaze::DynamicVector<double,blaze::columnVector> vec( 67UL, 1.0 );
+      vec[ 5] =  2.0;
+      vec[33] = -0.5;
+      vec[66] =  8.0;
+
+      checkSize    ( vec, 67UL );
+      checkCapacity( vec, 67UL );
+      checkNonZeros( vec, 67UL );
+
+      // Testing the prod function
+      const double totalprod = prod( vec );
+
+      if( totalprod != -8.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalprod << "\n"
+             << "   Expected result: -8\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reduce() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce() function for dense vectors template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReduce()
+{
+   test_ = "reduce() function";
+
+   {
+      // Initialization check
+      blaze::DynamicVector<int,blaze::rowVector> vec( 4UL );
+      vec[0] =  1;
+      vec[1] = -2;
+      vec[2] =  3;
+      vec[3] = -4;
+
+      checkSize    ( vec, 4UL );
+      checkCapacity( vec, 4UL );
+      checkNonZeros( vec, 4UL );
+
+      if( vec[0] != 1 || vec[1] != -2 || vec[2] != 3 || vec[3] != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Initialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 -2 3 -4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Testing the reduce function with a custom operation
+      const int maxabs = reduce( vec, []( int a, int b ){ return std::max( std::abs( a ), std::abs( b ) ); } );
+
+      if( maxabs != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << maxabs << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Initialization check
+      blaze::DynamicVector<double,blaze::columnVector> a( 71UL ), b( 71UL );
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a[i] = static_cast<double>( i );
+         b[i] = static_cast<double>( i );
+      }
+      b[42] = 49.0;
+
+      checkSize    ( a, 71UL );
+      checkCapacity( a, 71UL );
+      checkSize    ( b, 71UL );
+      checkCapacity( b, 71UL );
+
+      // Testing the reduce function for a vector expression
+      const double maxdiff = reduce( abs( a - b ), blaze::Max() );
+
+      if( maxdiff != 7.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << maxdiff << "\n"
+             << "   Expected result: 7\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DeferredScope class for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the fused evaluation of dense vector operations by means
+// of the DeferredScope class. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OperationTest::testDeferredScope()
+{
+   test_ = "DeferredScope class";
+
+   {
+      // Initialization check
+      const size_t N( 3UL*blaze::DeferredScope::blockSize + 17UL );
+
+      blaze::DynamicVector<double,blaze::columnVector> a( N ), b( N ), c( N ), x( N ), y( N );
+      for( size_t i=0UL; i<N; ++i ) {
+         a[i] = static_cast<double>( i % 7UL );
+         b[i] = static_cast<double>( i % 5UL ) - 2.0;
+         c[i] = 1.0;
+      }
+
+      checkSize( a, N );
+      checkSize( b, N );
+      checkSize( c, N );
+
+      // Recording and evaluating several statements
+      double ab( 0.0 ), bb( 0.0 ), maxabs( 0.0 );
+
+      blaze::DeferredScope scope;
+      scope.assign( x, 2.0 * a + b );
+      scope.addAssign( c, x );
+      scope.subAssign( c, a );
+      scope.multAssign( c, b );
+      scope.assign( y, c - x );
+      scope.dot( ab, a, b );
+      scope.dot( bb, b, b );
+      scope.reduce( maxabs, abs( y ), blaze::Max() );
+
+      if( scope.size() != 8UL || ab != 0.0 || bb != 0.0 || maxabs != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Premature evaluation detected\n"
+             << " Details:\n"
+             << "   Number of pending statements: " << scope.size() << "\n"
+             << "   Expected number: 8\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      scope.evaluate();
+
+      if( scope.size() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Evaluation failed\n"
+             << " Details:\n"
+             << "   Number of pending statements: " << scope.size() << "\n"
+             << "   Expected number: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      double refab( 0.0 ), refbb( 0.0 ), refmax( 0.0 );
+
+      for( size_t i=0UL; i<N; ++i )
+      {
+         const double refx( 2.0*a[i] + b[i] );
+         const double refc( ( 1.0 + refx - a[i] ) * b[i] );
+         const double refy( refc - refx );
+
+         if( x[i] != refx || c[i] != refc || y[i] != refy ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fused assignment failed\n"
+                << " Details:\n"
+                << "   Index: " << i << "\n"
+                << "   Result: ( " << x[i] << " " << c[i] << " " << y[i] << " )\n"
+                << "   Expected result: ( " << refx << " " << refc << " " << refy << " )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         refab += a[i]*b[i];
+         refbb += b[i]*b[i];
+         refmax = std::max( refmax, std::abs( refy ) );
+      }
+
+      if( ab != refab || bb != refbb || maxabs != refmax ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused reduction failed\n"
+             << " Details:\n"
+             << "   Result: ( " << ab << " " << bb << " " << maxabs << " )\n"
+             << "   Expected result: ( " << refab << " " << refbb << " " << refmax << " )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Evaluation at the end of the scope
+      blaze::DynamicVector<int,blaze::rowVector> a( 5UL, 2 ), b( 5UL, 3 );
+      int sum( 0 );
+
+      {
+         blaze::DeferredScope scope;
+         scope.addAssign( a, b );
+         scope.reduce( sum, a, blaze::Add() );
+      }
+
+      if( a[0] != 5 || a[1] != 5 || a[2] != 5 || a[3] != 5 || a[4] != 5 || sum != 25 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Evaluation at the end of the scope failed\n"
+             << " Details:\n"
+             << "   Result:\n" << a << "\n"
+             << "   Sum: " << sum << "\n"
+             << "   Expected result:\n( 5 5 5 5 5 )\n"
+             << "   Expected sum: 25\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Evaluation at the end of a scope left due to an exception
+      static_assert( std::is_nothrow_destructible<blaze::DeferredScope>::value,
+                     "Throwing destructor detected" );
+
+      blaze::DynamicVector<int,blaze::rowVector> a( 5UL, 2 ), b( 5UL, 3 );
+
+      try {
+         blaze::DeferredScope scope;
+         scope.addAssign( a, b );
+         throw std::logic_error( "Exception within a deferred scope" );
+      }
+      catch( std::logic_error& ) {}
+
+      if( a[0] != 5 || a[1] != 5 || a[2] != 5 || a[3] != 5 || a[4] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Evaluation at the end of a scope left due to an exception failed\n"
+             << " Details:\n"
+             << "   Result:\n" << a << "\n"
+             << "   Expected result:\n( 5 5 5 5 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Non-element-wise access to the target vectors of a scope
+      const size_t N( 3UL*blaze::DeferredScope::blockSize + 17UL );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> M( N, N, N );
+      for( size_t i=0UL; i<N; ++i ) {
+         M.append( i, ( i+1UL ) % N, 1.0 );
+         M.finalize( i );
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> h( N ), r( N ), z( N );
+      for( size_t i=0UL; i<N; ++i ) {
+         h[i] = static_cast<double>( i % 3UL );
+         r[i] = static_cast<double>( i % 11UL );
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> refr( r - 2.0*h );
+      blaze::DynamicVector<double,blaze::columnVector> refz( M * refr );
+      double sum( 0.0 );
+
+      // Read after write: z = M * r after r -= 2 * h
+      {
+         blaze::DeferredScope scope;
+         scope.subAssign( r, 2.0 * h );
+         scope.assign( z, M * r );
+         checkPending( scope, 1UL );
+         scope.evaluate();
+      }
+
+      checkResult( r, refr, "Read after write" );
+      checkResult( z, refz, "Read after write" );
+
+      // Write after read: r += h after z = M * r
+      refz = M * r;
+      refr = r + h;
+
+      {
+         blaze::DeferredScope scope;
+         scope.assign( z, M * r );
+         scope.addAssign( r, h );
+         checkPending( scope, 1UL );
+         scope.evaluate();
+      }
+
+      checkResult( r, refr, "Write after read" );
+      checkResult( z, refz, "Write after read" );
+
+      // Self-aliasing: r = M * r
+      refr = M * r;
+
+      {
+         blaze::DeferredScope scope;
+         scope.addAssign( z, h );
+         scope.assign( r, M * r );
+         checkPending( scope, 0UL );
+      }
+
+      checkResult( r, refr, "Self-aliasing" );
+
+      // Reduction after write: sum( M * r ) after r += h
+      refr = r + h;
+      refz = M * refr;
+
+      {
+         blaze::DeferredScope scope;
+         scope.addAssign( r, h );
+         scope.reduce( sum, M * r, blaze::Add() );
+         checkPending( scope, 1UL );
+         scope.evaluate();
+      }
+
+      checkResult( r, refr, "Reduction after write" );
+
+      if( sum != blaze::sum( refz ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reduction after write failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: " << blaze::sum( refz ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      // Recording statements with non-matching sizes
+      blaze::DynamicVector<int,blaze::columnVector> a( 5UL ), b( 5UL ), c( 6UL );
+
+      blaze::DeferredScope scope;
+      scope.assign( a, b );
+
+      try {
+         scope.assign( c, 2 * c );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Recording a statement of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         scope.assign( a, c );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Recording an assignment of non-matching vectors succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace mathtest
@@ -0,0 +1,341 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/inversion/BatchTest.cpp
+//  \brief Source file for the batched small matrix inversion test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/inversion/BatchTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace inversion {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BatchTest inversion test.
+//
+// \exception std::runtime_error Batched inversion error detected.
+*/
+BatchTest::BatchTest()
+{
+   //=====================================================================================
+   // Specific tests
+   //=====================================================================================
+
+   testContainer();
+   testSingular();
+
+
+   //=====================================================================================
+   // Random matrix tests
+   //=====================================================================================
+
+   for( size_t n : { 0UL, 1UL, 7UL, 33UL, 100UL } )
+   {
+      testRandom<double,1UL>( n );
+      testRandom<double,2UL>( n );
+      testRandom<double,3UL>( n );
+      testRandom<double,4UL>( n );
+      testRandom<double,5UL>( n );
+      testRandom<double,6UL>( n );
+
+      testRandom<float,2UL>( n );
+      testRandom<float,3UL>( n );
+      testRandom<float,6UL>( n );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MatrixBatch and VectorBatch containers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction, the element access and the resizing of the batch
+// containers. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BatchTest::testContainer()
+{
+   {
+      test_ = "MatrixBatch construction";
+
+      blaze::MatrixBatch<double,3UL,3UL> A( 5UL, 2.0 );
+
+      if( A.size() != 5UL || A.spacing() < 5UL ||
+          A.spacing() % blaze::SIMDTrait<double>::size != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid batch size\n"
+             << " Details:\n"
+             << "   Size    = " << A.size() << " (expected 5)\n"
+             << "   Spacing = " << A.spacing() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t k=A.size(); k<A.spacing(); ++k ) {
+         for( size_t i=0UL; i<3UL; ++i ) {
+            for( size_t j=0UL; j<3UL; ++j ) {
+               if( A.data(i,j)[k] != ( i == j ? 1.0 : 0.0 ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid padding matrix\n"
+                      << " Details:\n"
+                      << "   Padding index = " << k << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      blaze::StaticMatrix<double,3UL,3UL> B{ { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }, { 7.0, 8.0, 9.0 } };
+      A.set( 3UL, B );
+
+      if( A.get(3UL) != B || A(3UL,1UL,2UL) != 6.0 || A(2UL,1UL,2UL) != 2.0 ||
+          A.data()[(1UL*3UL+2UL)*A.spacing()+3UL] != 6.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A.get(3UL) << "\n"
+             << "   Expected result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         A.set( 0UL, blaze::StaticMatrix<double,2UL,3UL>() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix of invalid size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "MatrixBatch resize";
+
+      blaze::MatrixBatch<double,2UL,2UL> A( 3UL, 4.0 );
+      A.resize( 11UL );
+
+      if( A.size() != 11UL || A(2UL,1UL,0UL) != 4.0 || A(10UL,1UL,0UL) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the batch failed\n"
+             << " Details:\n"
+             << "   Size = " << A.size() << " (expected 11)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::MatrixBatch<double,2UL,2UL> B( std::move( A ) );
+
+      if( B.size() != 11UL || A.size() != 0UL || A.data() != nullptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Moving the batch failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "VectorBatch construction";
+
+      blaze::VectorBatch<float,4UL> b( 9UL, 1.0F );
+      blaze::StaticVector<float,4UL> v{ 1.0F, 2.0F, 3.0F, 4.0F };
+      b.set( 8UL, v );
+      b.resize( 20UL );
+
+      if( b.size() != 20UL || b.get(8UL) != v || b(7UL,3UL) != 1.0F || b(19UL,3UL) != 0.0F ||
+          b.data(2UL)[8UL] != 3.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Initializing the batch failed\n"
+             << " Details:\n"
+             << "   Size = " << b.size() << " (expected 20)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched kernels with singular and indefinite matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a single singular (or indefinite) matrix within a batch results
+// in an exception. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BatchTest::testSingular()
+{
+   {
+      test_ = "Batched inversion of singular matrix";
+
+      blaze::MatrixBatch<double,3UL,3UL> A( 37UL );
+      for( size_t k=0UL; k<A.size(); ++k ) {
+         for( size_t i=0UL; i<3UL; ++i ) {
+            A(k,i,i) = 1.0;
+         }
+      }
+      A(35UL,2UL,2UL) = 0.0;
+
+      try {
+         invert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Inversion of singular matrix failed" ) throw;
+      }
+   }
+
+   {
+      test_ = "Batched LU decomposition of singular matrix";
+
+      blaze::MatrixBatch<float,2UL,2UL> A( 5UL, 1.0F );
+
+      try {
+         lu( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LU decomposition of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Decomposition of singular matrix failed" ) throw;
+      }
+   }
+
+   {
+      test_ = "Batched Cholesky decomposition of indefinite matrix";
+
+      blaze::MatrixBatch<double,4UL,4UL> A( 6UL );
+      for( size_t k=0UL; k<A.size(); ++k ) {
+         for( size_t i=0UL; i<4UL; ++i ) {
+            A(k,i,i) = 1.0;
+         }
+      }
+      A(0UL,3UL,3UL) = -1.0;
+
+      try {
+         llh( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Cholesky decomposition of indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Batched solution with mismatching batch sizes";
+
+      blaze::MatrixBatch<double,3UL,3UL> A( 4UL );
+      blaze::VectorBatch<double,3UL> b( 5UL );
+
+      try {
+         solve( A, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution with mismatching batch sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace inversion
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running batched small matrix inversion test..." << std::endl;
+
+   try
+   {
+      RUN_INVERSION_BATCH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during batched small matrix inversion test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
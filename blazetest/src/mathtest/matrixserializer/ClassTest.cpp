@@ -68,6 +68,7 @@ ClassTest::ClassTest()
 {
    testEmptyMatrices();
    testRandomMatrices();
+   testLargeMatrices();
    testFailures();
 }
 //*************************************************************************************************
@@ -317,6 +318,51 @@ void ClassTest::testRandomMatrices()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serialization test with large matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs serialization tests with matrices whose elements exceed the size of
+// the internal buffer of the serializer and therefore require several block transfers. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLargeMatrices()
+{
+   test_ = "Large matrices";
+
+   {
+      blaze::DynamicMatrix<double,blaze::rowMajor> src( 397UL, 411UL );
+      randomize( src );
+      runDynamicMatrixTests( src );
+      runCompressedMatrixTests( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 411UL, 397UL );
+      randomize( src );
+      runDynamicMatrixTests( src );
+      runCompressedMatrixTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> src( 1000UL, 1200UL );
+      randomize( src, 100000UL );
+      runDynamicMatrixTests( src );
+      runCompressedMatrixTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<double,blaze::columnMajor> src( 1200UL, 1000UL );
+      randomize( src, 100000UL );
+      runDynamicMatrixTests( src );
+      runCompressedMatrixTests( src );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
@@ -0,0 +1,482 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixserializer/MappedTest.cpp
+//  \brief Source file for the MappedArchive class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/MappedArchive.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrixserializer/MappedTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixserializer {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedArchive class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MappedTest::MappedTest()
+   : test_    ()
+   , filename_( "MappedTest.blaze" )
+{
+   testCompressedView();
+   testDenseObjects();
+   testSparseObjects();
+   testInvalidFiles();
+
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedView class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access and the lookup functions of a CompressedView on
+// user-provided arrays. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void MappedTest::testCompressedView()
+{
+   test_ = "CompressedView";
+
+   // 3x4 matrix with the non-zero elements (0,1), (0,3), and (2,2)
+   const size_t pointers[] = { 0UL, 2UL, 2UL, 3UL };
+   const size_t indices [] = { 1UL, 3UL, 2UL };
+   const int    values  [] = { 1, 2, 3 };
+
+   {
+      const blaze::CompressedView<int,blaze::rowMajor> view( 3UL, 4UL, pointers, indices, values );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 4UL );
+      ref(0,1) = 1;
+      ref(0,3) = 2;
+      ref(2,2) = 3;
+
+      if( view.rows() != 3UL || view.columns() != 4UL || view.nonZeros() != 3UL ||
+          view.nonZeros( 0UL ) != 2UL || view.nonZeros( 1UL ) != 0UL ||
+          view(0,3) != 2 || view(1,1) != 0 || view != ref || !isIntact( view ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row-major view setup failed\n"
+             << " Details:\n"
+             << "   Result:\n" << view << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( view.find( 0UL, 3UL )->value() != 2 || view.find( 0UL, 2UL ) != view.end( 0UL ) ||
+          view.lowerBound( 0UL, 2UL )->index() != 3UL || view.upperBound( 0UL, 1UL )->index() != 3UL ||
+          view.upperBound( 2UL, 2UL ) != view.end( 2UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lookup operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << view << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::DynamicVector<int,blaze::columnVector> x{ 1, 2, 3, 4 };
+      const blaze::DynamicVector<int,blaze::columnVector> y( view * x );
+
+      if( y[0] != 10 || y[1] != 0 || y[2] != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Sparse matrix/dense vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 10 0 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      const blaze::CompressedView<int,blaze::columnMajor> view( 4UL, 3UL, pointers, indices, values );
+
+      if( view.nonZeros() != 3UL || view(3,0) != 2 || view(2,2) != 3 || view(0,0) != 0 ||
+          !isIntact( view ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Column-major view setup failed\n"
+             << " Details:\n"
+             << "   Result:\n" << view << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Detection of unsorted indices
+   {
+      const size_t unsorted[] = { 3UL, 1UL, 2UL };
+      const blaze::CompressedView<int,blaze::rowMajor> view( 3UL, 4UL, pointers, unsorted, values );
+
+      if( isIntact( view ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Unsorted indices not detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy loading of dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes several dense vectors and matrices to an archive and maps them back
+// into memory. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testDenseObjects()
+{
+   test_ = "Dense vectors and matrices";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 13UL, 7UL );
+   blaze::DynamicMatrix<float,blaze::columnMajor> B( 5UL, 11UL );
+   blaze::DynamicMatrix<blaze::complex<double>,blaze::rowMajor> C( 3UL, 3UL );
+   blaze::DynamicVector<int,blaze::columnVector> x( 37UL );
+   blaze::DynamicVector<double,blaze::columnVector> e;
+
+   blaze::randomize( A );
+   blaze::randomize( B );
+   blaze::randomize( C );
+   blaze::randomize( x );
+
+   {
+      blaze::MappedArchiveWriter archive( filename_ );
+      archive << A << B << C << x << e << ( A * trans( A ) );
+      archive.close();
+   }
+
+   blaze::MappedArchive archive( filename_ );
+   archive.advise( blaze::willNeedAccess );
+
+   blaze::CustomMatrix<double,blaze::aligned,blaze::unpadded,blaze::rowMajor> A2, AAt;
+   blaze::CustomMatrix<float,blaze::aligned,blaze::unpadded,blaze::columnMajor> B2;
+   blaze::CustomMatrix<blaze::complex<double>,blaze::unaligned,blaze::unpadded,blaze::rowMajor> C2;
+   blaze::CustomVector<int,blaze::aligned,blaze::unpadded,blaze::columnVector> x2;
+   blaze::CustomVector<double,blaze::aligned,blaze::unpadded,blaze::rowVector> e2;
+
+   archive >> A2 >> B2 >> C2 >> x2 >> e2 >> AAt;
+
+   if( A2 != A || B2 != B || C2 != C || x2 != x || e2.size() != 0UL ||
+       AAt != A * trans( A ) || !archive.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Zero-copy loading failed\n"
+          << " Details:\n"
+          << "   Result:\n" << A2 << "\n"
+          << "   Expected result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( A2.spacing() % 8UL != 0UL || B2.spacing() % 16UL != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid padding of mapped matrices\n"
+          << " Details:\n"
+          << "   Spacing of A: " << A2.spacing() << "\n"
+          << "   Spacing of B: " << B2.spacing() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::DynamicVector<double,blaze::columnVector> y1( A2 * blaze::DynamicVector<double>( 7UL, 1.0 ) );
+   const blaze::DynamicVector<double,blaze::columnVector> y2( A  * blaze::DynamicVector<double>( 7UL, 1.0 ) );
+
+   if( y1 != y2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Matrix/vector multiplication with mapped matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << y1 << "\n"
+          << "   Expected result:\n" << y2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy loading of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes several sparse matrices to an archive and maps them back into memory
+// via CompressedView. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testSparseObjects()
+{
+   test_ = "Sparse matrices";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 100UL, 53UL );
+   blaze::CompressedMatrix<int,blaze::columnMajor> B( 30UL, 40UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> C( 5UL, 5UL );
+
+   blaze::randomize( A, 400UL );
+   blaze::randomize( B, 100UL );
+
+   {
+      blaze::MappedArchiveWriter archive( filename_ );
+      archive << A << B << C;
+      archive.close();
+   }
+
+   blaze::MappedArchive archive( filename_ );
+
+   blaze::CompressedView<double,blaze::rowMajor> A2;
+   blaze::CompressedView<int,blaze::columnMajor> B2;
+   blaze::CompressedView<double,blaze::rowMajor> C2;
+
+   archive >> A2 >> B2 >> C2;
+
+   if( A2 != A || B2 != B || C2 != C || A2.nonZeros() != A.nonZeros() ||
+       C2.nonZeros() != 0UL || !isIntact( A2 ) || !isIntact( B2 ) || !archive.isEmpty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Zero-copy loading failed\n"
+          << " Details:\n"
+          << "   Result:\n" << A2 << "\n"
+          << "   Expected result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> x( 53UL );
+   blaze::randomize( x );
+
+   const blaze::DynamicVector<double,blaze::columnVector> y1( A2 * x );
+   const blaze::DynamicVector<double,blaze::columnVector> y2( A  * x );
+   const blaze::CompressedMatrix<double,blaze::rowMajor> P1( A2 * trans( A2 ) );
+   const blaze::CompressedMatrix<double,blaze::rowMajor> P2( A  * trans( A  ) );
+   const blaze::CompressedMatrix<int,blaze::rowMajor> B3( B2 );
+
+   if( y1 != y2 || P1 != P2 || B3 != B ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Expressions with mapped sparse matrices failed\n"
+          << " Details:\n"
+          << "   Result:\n" << y1 << "\n"
+          << "   Expected result:\n" << y2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the validation of archive files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid or incompatible objects are rejected. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void MappedTest::testInvalidFiles()
+{
+   test_ = "Invalid archive files";
+
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 4UL, 4UL );
+      A(1,2) = 1.0;
+
+      blaze::MappedArchiveWriter archive( filename_ );
+      archive << blaze::DynamicMatrix<double,blaze::rowMajor>( 4UL, 4UL, 1.0 ) << A;
+   }
+
+   blaze::MappedArchive archive( filename_ );
+
+   // Mismatching element type
+   try {
+      blaze::CustomMatrix<float,blaze::aligned,blaze::unpadded,blaze::rowMajor> A;
+      archive >> A;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a matrix with mismatching element type succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Mismatching storage order
+   try {
+      blaze::CustomMatrix<double,blaze::aligned,blaze::unpadded,blaze::columnMajor> A;
+      archive >> A;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a matrix with mismatching storage order succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Mismatching object type
+   try {
+      blaze::CompressedView<double,blaze::rowMajor> A;
+      archive >> A;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a sparse matrix from a dense matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Reading beyond the end of the archive
+   try {
+      blaze::CustomMatrix<double,blaze::aligned,blaze::unpadded,blaze::rowMajor> A;
+      blaze::CompressedView<double,blaze::rowMajor> B, C;
+      archive >> A >> B >> C;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading beyond the end of the archive succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {
+      throw;
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ) != "End of archive reached" )
+         throw;
+   }
+
+   // Corrupted row pointers (the last pointer of the sparse matrix)
+   {
+      blaze::MappedFile file( filename_, blaze::readWrite );
+      const size_t offset( 64UL + 64UL + 4UL*64UL + 64UL + 4UL*sizeof( size_t ) );
+      const size_t invalid( 2UL );
+      std::memcpy( file.data() + offset, &invalid, sizeof( size_t ) );
+   }
+
+   try {
+      blaze::MappedArchive corrupted( filename_ );
+      blaze::CustomMatrix<double,blaze::aligned,blaze::unpadded,blaze::rowMajor> A;
+      blaze::CompressedView<double,blaze::rowMajor> B;
+      corrupted >> A >> B;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a corrupted sparse matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Corrupted file signature
+   {
+      blaze::MappedFile file( filename_, blaze::readWrite );
+      file.data()[0] = 'X';
+   }
+
+   try {
+      blaze::MappedArchive corrupted( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a corrupted archive file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace matrixserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedArchive class test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXSERIALIZER_MAPPED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedArchive class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,528 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixserializer/MatrixMarketTest.cpp
+//  \brief Source file for the Matrix Market I/O test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/MatrixMarket.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/matrixserializer/MatrixMarketTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixserializer {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Matrix Market I/O test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MatrixMarketTest::MatrixMarketTest()
+   : test_    ()
+   , filename_( "MatrixMarketTest.mtx" )
+{
+   testCoordinateFiles();
+   testArrayFiles();
+   testRoundTrip();
+   testInvalidFiles();
+
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of reading Matrix Market files in coordinate format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reading of coordinate files with different fields and symmetries,
+// including comments, Windows line endings, unsorted and duplicate entries, and a missing
+// trailing newline. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MatrixMarketTest::testCoordinateFiles()
+{
+   //=====================================================================================
+   // General real matrix
+   //=====================================================================================
+
+   {
+      test_ = "General coordinate file";
+
+      writeFile( "%%MatrixMarket matrix coordinate real general\n"
+                 "% Comment line\n"
+                 "%\n"
+                 "3 4 5\n"
+                 "3 1 -2.5\r\n"
+                 "1 4 1E2\n"
+                 "  1  2  0.125\n"
+                 "1 4 1\n"
+                 "2 3 4" );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> ref( 3UL, 4UL );
+      ref(0,1) =   0.125;
+      ref(0,3) = 101.0;
+      ref(1,2) =   4.0;
+      ref(2,0) =  -2.5;
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      blaze::readMatrixMarket( filename_, A );
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> B;
+      blaze::readMatrixMarket( filename_, B );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> C;
+      blaze::readMatrixMarket( filename_, C );
+
+      if( A != ref || A.nonZeros() != 4UL || B != ref || B.nonZeros() != 4UL || C != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a general coordinate file failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << A << "\n"
+             << "   Column-major result:\n" << B << "\n"
+             << "   Dense result:\n" << C << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Symmetric integer matrix
+   //=====================================================================================
+
+   {
+      test_ = "Symmetric coordinate file";
+
+      writeFile( "%%MatrixMarket matrix coordinate integer symmetric\n"
+                 "3 3 3\n"
+                 "1 1 5\n"
+                 "3 1 -2\n"
+                 "3 2 7\n" );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 3UL );
+      ref(0,0) =  5;
+      ref(0,2) = -2;
+      ref(2,0) = -2;
+      ref(1,2) =  7;
+      ref(2,1) =  7;
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> A;
+      blaze::readMatrixMarket( filename_, A );
+
+      if( A != ref || A.nonZeros() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a symmetric coordinate file failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Skew-symmetric pattern and Hermitian complex matrices
+   //=====================================================================================
+
+   {
+      test_ = "Skew-symmetric coordinate file";
+
+      writeFile( "%%MatrixMarket matrix coordinate real skew-symmetric\n"
+                 "2 2 1\n"
+                 "2 1 3.0\n" );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::readMatrixMarket( filename_, A );
+
+      if( A.rows() != 2UL || A.columns() != 2UL ||
+          A(0,0) != 0.0 || A(0,1) != -3.0 || A(1,0) != 3.0 || A(1,1) != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a skew-symmetric coordinate file failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Pattern coordinate file";
+
+      writeFile( "%%MatrixMarket matrix coordinate pattern general\n"
+                 "2 3 2\n"
+                 "2 3\n"
+                 "1 1\n" );
+
+      blaze::CompressedMatrix<float,blaze::rowMajor> A;
+      blaze::readMatrixMarket( filename_, A );
+
+      if( A.rows() != 2UL || A.columns() != 3UL || A.nonZeros() != 2UL ||
+          A(0,0) != 1.0F || A(1,2) != 1.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a pattern coordinate file failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Hermitian coordinate file";
+
+      using cplx = blaze::complex<double>;
+
+      writeFile( "%%MatrixMarket matrix coordinate complex hermitian\n"
+                 "2 2 2\n"
+                 "1 1 1.0 0.0\n"
+                 "2 1 2.0 -3.0\n" );
+
+      blaze::CompressedMatrix<cplx,blaze::rowMajor> A;
+      blaze::readMatrixMarket( filename_, A );
+
+      if( A.nonZeros() != 3UL || A(0,0) != cplx( 1.0, 0.0 ) ||
+          A(1,0) != cplx( 2.0, -3.0 ) || A(0,1) != cplx( 2.0, 3.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a Hermitian coordinate file failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reading Matrix Market files in array format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reading of general and symmetric array files into dense and sparse
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MatrixMarketTest::testArrayFiles()
+{
+   {
+      test_ = "General array file";
+
+      writeFile( "%%MatrixMarket matrix array real general\n"
+                 "2 3\n"
+                 "1\n4\n2\n5\n3\n0\n" );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> ref{ { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 0.0 } };
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::readMatrixMarket( filename_, A );
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> B;
+      blaze::readMatrixMarket( filename_, B );
+
+      if( A != ref || B != ref || B.nonZeros() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a general array file failed\n"
+             << " Details:\n"
+             << "   Dense result:\n" << A << "\n"
+             << "   Sparse result:\n" << B << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Symmetric array file";
+
+      writeFile( "%%MatrixMarket matrix array integer symmetric\n"
+                 "3 3\n"
+                 "1\n2\n3\n4\n5\n6\n" );
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref{ { 1, 2, 3 }, { 2, 4, 5 }, { 3, 5, 6 } };
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> A;
+      blaze::readMatrixMarket( filename_, A );
+
+      if( A != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a symmetric array file failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of writing and reading Matrix Market files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes dense and sparse matrices of different element types to Matrix Market
+// files and reads them back. The large sparse matrix results in a file that is split into
+// several chunks. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void MatrixMarketTest::testRoundTrip()
+{
+   {
+      test_ = "Sparse matrix round trip";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 20000UL, 15000UL );
+      blaze::randomize( A, 400000UL, -1.0, 1.0 );
+
+      blaze::writeMatrixMarket( filename_, A );
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> B;
+      blaze::readMatrixMarket( filename_, B );
+
+      if( A != B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip of a row-major sparse matrix failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::writeMatrixMarket( filename_, B );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> C;
+      blaze::readMatrixMarket( filename_, C );
+
+      if( A != C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip of a column-major sparse matrix failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Complex sparse matrix round trip";
+
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::rowMajor> A( 50UL, 40UL );
+      blaze::randomize( A, 200UL );
+
+      blaze::writeMatrixMarket( filename_, A );
+
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::rowMajor> B;
+      blaze::readMatrixMarket( filename_, B );
+
+      if( A != B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip of a complex sparse matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Dense matrix round trip";
+
+      blaze::DynamicMatrix<float,blaze::rowMajor> A( 70UL, 30UL );
+      blaze::randomize( A );
+
+      blaze::writeMatrixMarket( filename_, A );
+
+      blaze::DynamicMatrix<float,blaze::columnMajor> B;
+      blaze::readMatrixMarket( filename_, B );
+
+      if( A != B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip of a single precision dense matrix failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicMatrix<long,blaze::columnMajor> C( 5UL, 3UL );
+      blaze::randomize( C, -1000000L, 1000000L );
+
+      blaze::writeMatrixMarket( filename_, C );
+
+      blaze::DynamicMatrix<long,blaze::rowMajor> D;
+      blaze::readMatrixMarket( filename_, D );
+
+      if( C != D ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip of an integral dense matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reading invalid Matrix Market files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid Matrix Market files are rejected. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void MatrixMarketTest::testInvalidFiles()
+{
+   test_ = "Invalid Matrix Market files";
+
+   const char* const files[] = {
+      "%%MatrixMarket vector coordinate real general\n2 2 1\n1 1 1\n",
+      "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n",
+      "%%MatrixMarket matrix coordinate real general\n2 2 1\n0 1 1\n",
+      "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n",
+      "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1\n",
+      "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 1 1\n",
+      "%%MatrixMarket matrix coordinate real symmetric\n2 3 1\n1 1 1\n",
+      "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n",
+      "%%MatrixMarket matrix coordinate complex general\n2 2 1\n1 1 1 1\n"
+   };
+
+   for( const char* file : files )
+   {
+      writeFile( file );
+
+      try {
+         blaze::CompressedMatrix<double,blaze::rowMajor> A;
+         blaze::readMatrixMarket( filename_, A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading an invalid Matrix Market file succeeded\n"
+             << " Details:\n"
+             << "   File:\n" << file << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writing the given content to the temporary file.
+//
+// \param content The content of the file.
+// \return void
+*/
+void MatrixMarketTest::writeFile( const std::string& content ) const
+{
+   std::ofstream os( filename_.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+   os << content;
+}
+//*************************************************************************************************
+
+} // namespace matrixserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Matrix Market I/O test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXSERIALIZER_MATRIXMARKET_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Matrix Market I/O test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,458 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixserializer/NpyTest.cpp
+//  \brief Source file for the NumPy .npy I/O test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Npy.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+#include <blazetest/mathtest/matrixserializer/NpyTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixserializer {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the NumPy .npy I/O test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+NpyTest::NpyTest()
+   : test_    ()
+   , filename_( "NpyTest.npy" )
+{
+   testMatrices();
+   testVectors();
+   testMappedMatrices();
+   testForeignFiles();
+   testInvalidFiles();
+
+   std::remove( filename_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of writing and reading dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes dense matrices and matrix expressions to .npy files and reads them back
+// into matrices of both storage orders. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void NpyTest::testMatrices()
+{
+   {
+      test_ = "Row-major dense matrix";
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( 7UL, 13UL );
+      blaze::randomize( A );
+
+      blaze::writeNpy( filename_, A );
+
+      std::ifstream is( filename_.c_str(), std::ios::in | std::ios::binary );
+      std::string preamble( 10UL, ' ' );
+      is.read( &preamble[0], 10 );
+      const size_t offset( 10UL + static_cast<unsigned char>( preamble[8] ) +
+                           256UL * static_cast<unsigned char>( preamble[9] ) );
+
+      if( preamble.compare( 0UL, 8UL, std::string( "\x93NUMPY\x01\x00", 8UL ) ) != 0 || offset % 64UL != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid .npy header\n"
+             << " Details:\n"
+             << "   Offset of the elements: " << offset << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> B;
+      blaze::readNpy( filename_, B );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> C;
+      blaze::readNpy( filename_, C );
+
+      if( A != B || A != C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip of a row-major matrix failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << B << "\n"
+             << "   Column-major result:\n" << C << "\n"
+             << "   Expected result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major matrix expression";
+
+      blaze::DynamicMatrix<blaze::complex<float>,blaze::columnMajor> A( 5UL, 3UL );
+      blaze::randomize( A );
+
+      blaze::writeNpy( filename_, A * trans( A ) );
+
+      blaze::SymmetricMatrix< blaze::DynamicMatrix<blaze::complex<float>,blaze::rowMajor> > B;
+      blaze::readNpy( filename_, B );
+
+      blaze::DynamicMatrix<blaze::complex<float>,blaze::columnMajor> C;
+      blaze::readNpy( filename_, C );
+
+      if( B != C || C != A * trans( A ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Round trip of a column-major matrix expression failed\n"
+             << " Details:\n"
+             << "   Symmetric result:\n" << B << "\n"
+             << "   Column-major result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of writing and reading dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes dense vectors to .npy files and reads them back. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void NpyTest::testVectors()
+{
+   test_ = "Dense vectors";
+
+   blaze::DynamicVector<int,blaze::columnVector> a( 17UL );
+   blaze::randomize( a );
+
+   blaze::writeNpy( filename_, a );
+
+   blaze::DynamicVector<int,blaze::rowVector> b;
+   blaze::readNpy( filename_, b );
+
+   if( trans( a ) != b ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Round trip of a dense vector failed\n"
+          << " Details:\n"
+          << "   Result:\n" << b << "\n"
+          << "   Expected result:\n" << trans( a ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::DynamicMatrix<int,blaze::rowMajor> A;
+      blaze::readNpy( filename_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a one-dimensional array into a matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the NpyMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the creation and the mapping of .npy files via the NpyMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void NpyTest::testMappedMatrices()
+{
+   test_ = "NpyMatrix";
+
+   blaze::DynamicMatrix<double,blaze::columnMajor> A( 9UL, 4UL );
+   blaze::randomize( A );
+
+   {
+      blaze::NpyMatrix<double,blaze::columnMajor> B( filename_, 9UL, 4UL );
+      B.matrix() = A;
+   }
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> C;
+   blaze::readNpy( filename_, C );
+
+   const blaze::NpyMatrix<double,blaze::columnMajor> D( filename_ );
+
+   if( C != A || D.rows() != 9UL || D.columns() != 4UL || D.matrix() != A ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a .npy file failed\n"
+          << " Details:\n"
+          << "   Read result:\n" << C << "\n"
+          << "   Mapped result:\n" << D.matrix() << "\n"
+          << "   Expected result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      blaze::NpyMatrix<double,blaze::rowMajor> E( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a .npy file with mismatching storage order succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reading .npy files written by other tools.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reading of .npy files with a 16-byte aligned version 1.0 header (as
+// written by older NumPy versions) and with a version 2.0 header. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void NpyTest::testForeignFiles()
+{
+   {
+      test_ = "Version 1.0 file";
+
+      std::string dict( "{'descr': '<i8', 'fortran_order': True, 'shape': (3, 2), }" );
+      dict.append( 15UL - ( 10UL + dict.size() ) % 16UL, ' ' );
+      dict += '\n';
+
+      std::string file( "\x93NUMPY\x01\x00", 8UL );
+      file += static_cast<char>( dict.size() & 0xFFUL );
+      file += static_cast<char>( dict.size() >> 8 );
+      file += dict;
+
+      const blaze::int64_t values[] = { 1, 2, 3, 4, 5, 6 };
+      file.append( reinterpret_cast<const char*>( values ), sizeof( values ) );
+
+      writeFile( file );
+
+      blaze::DynamicMatrix<blaze::int64_t,blaze::rowMajor> A;
+      blaze::readNpy( filename_, A );
+
+      const blaze::NpyMatrix<blaze::int64_t,blaze::columnMajor> B( filename_ );
+
+      const blaze::DynamicMatrix<blaze::int64_t,blaze::rowMajor> ref{ { 1, 4 }, { 2, 5 }, { 3, 6 } };
+
+      if( A != ref || B.matrix() != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a version 1.0 file failed\n"
+             << " Details:\n"
+             << "   Read result:\n" << A << "\n"
+             << "   Mapped result:\n" << B.matrix() << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Version 2.0 file";
+
+      std::string dict( "{\"descr\": \"<f4\", \"fortran_order\": False, \"shape\": (3,)}\n" );
+
+      std::string file( "\x93NUMPY\x02\x00", 8UL );
+      file += static_cast<char>( dict.size() );
+      file.append( 3UL, '\0' );
+      file += dict;
+
+      const float values[] = { 1.5F, 2.5F, 3.5F };
+      file.append( reinterpret_cast<const char*>( values ), sizeof( values ) );
+
+      writeFile( file );
+
+      blaze::DynamicVector<float,blaze::columnVector> a;
+      blaze::readNpy( filename_, a );
+
+      if( a.size() != 3UL || a[0] != 1.5F || a[1] != 2.5F || a[2] != 3.5F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading a version 2.0 file failed\n"
+             << " Details:\n"
+             << "   Result:\n" << a << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of reading invalid .npy files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid .npy files and mismatching element types are rejected. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void NpyTest::testInvalidFiles()
+{
+   test_ = "Invalid .npy files";
+
+   blaze::writeNpy( filename_, blaze::DynamicMatrix<double,blaze::rowMajor>( 3UL, 3UL, 1.0 ) );
+
+   try {
+      blaze::DynamicMatrix<float,blaze::rowMajor> A;
+      blaze::readNpy( filename_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading a matrix with mismatching element type succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::NpyMatrix<blaze::int64_t,blaze::rowMajor> A( filename_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a matrix with mismatching element type succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   writeFile( "NUMPY\x01\x00 is no valid file" );
+
+   try {
+      blaze::DynamicMatrix<double,blaze::rowMajor> A;
+      blaze::readNpy( filename_, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading an invalid .npy file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writing the given content to the temporary file.
+//
+// \param content The content of the file.
+// \return void
+*/
+void NpyTest::writeFile( const std::string& content ) const
+{
+   std::ofstream os( filename_.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+   os.write( content.data(), static_cast<std::streamsize>( content.size() ) );
+}
+//*************************************************************************************************
+
+} // namespace matrixserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running NumPy .npy I/O test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXSERIALIZER_NPY_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during NumPy .npy I/O test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
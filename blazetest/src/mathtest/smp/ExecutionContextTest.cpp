@@ -0,0 +1,471 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ExecutionContextTest.cpp
+//  \brief Source file for the ExecutionContext class test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blazetest/mathtest/smp/ExecutionContextTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ExecutionContextTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ExecutionContextTest::ExecutionContextTest()
+{
+   testRun();
+   testNesting();
+   testException();
+   testResize();
+   testBinding();
+   testConcurrency();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the run() function of the ExecutionContext class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that within the run() function the number of threads of the execution
+// context is used and that the previous number of threads is restored afterwards. Additionally
+// it tests that an execution context can be reused. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ExecutionContextTest::testRun()
+{
+   test_ = "ExecutionContext::run()";
+
+   const size_t global( blaze::getNumThreads() );
+
+   blaze::ExecutionContext ctx( 3UL );
+
+   VT a( 100000UL ), b( 100000UL ), c, ref( 100000UL );
+
+   for( size_t i=0UL; i<a.size(); ++i ) {
+      a[i]   = static_cast<double>( i );
+      b[i]   = static_cast<double>( i % 7UL );
+      ref[i] = a[i] + b[i];
+   }
+
+   for( size_t i=0UL; i<3UL; ++i )
+   {
+      ctx.run( [&]() {
+         checkNumThreads( blaze::getNumThreads(), ctx.size() );
+         c = a + b;
+      } );
+
+      checkNumThreads( blaze::getNumThreads(), global );
+      checkResult( c, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested execution contexts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the run() function of an execution context can be called within the
+// run() function of another execution context and that the outer execution context is restored
+// when the inner function returns. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ExecutionContextTest::testNesting()
+{
+   test_ = "Nested execution contexts";
+
+   const size_t global( blaze::getNumThreads() );
+
+   blaze::ExecutionContext outer( 2UL );
+   blaze::ExecutionContext inner( 3UL );
+
+   outer.run( [&]() {
+      checkNumThreads( blaze::getNumThreads(), outer.size() );
+      inner.run( [&]() {
+         checkNumThreads( blaze::getNumThreads(), inner.size() );
+      } );
+      checkNumThreads( blaze::getNumThreads(), outer.size() );
+   } );
+
+   checkNumThreads( blaze::getNumThreads(), global );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restoration of the previous binding in case of an exception.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the previous number of threads is restored in case the function
+// executed by the run() function throws an exception. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ExecutionContextTest::testException()
+{
+   test_ = "Exception within ExecutionContext::run()";
+
+   const size_t global( blaze::getNumThreads() );
+
+   blaze::ExecutionContext ctx( 2UL );
+
+   bool caught( false );
+
+   try {
+      ctx.run( []() {
+         throw std::logic_error( "Exception within an execution context" );
+      } );
+   }
+   catch( std::logic_error& ) {
+      caught = true;
+   }
+
+   if( !caught ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Exception has not been propagated\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkNumThreads( blaze::getNumThreads(), global );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of changing the number of threads of an execution context.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the resize() function of the ExecutionContext class and the setNumThreads()
+// function within the run() function. Changing the number of threads within an execution context
+// must not affect the number of threads outside the execution context. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ExecutionContextTest::testResize()
+{
+   test_ = "Resizing an execution context";
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   const size_t resized( 4UL );
+   const size_t threads( 3UL );
+#else
+   const size_t resized( 1UL );
+   const size_t threads( 1UL );
+#endif
+
+   const size_t global( blaze::getNumThreads() );
+
+   blaze::ExecutionContext ctx( 2UL );
+
+   ctx.resize( 4UL );
+   checkNumThreads( ctx.size(), resized );
+
+   ctx.run( [&]() {
+      blaze::setNumThreads( 3UL );
+      checkNumThreads( blaze::getNumThreads(), threads );
+   } );
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   checkNumThreads( ctx.size(), threads );
+#endif
+
+   checkNumThreads( blaze::getNumThreads(), global );
+
+   try {
+      ctx.resize( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing to 0 threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the binding of thread pools to the calling thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the binding of thread pools to the calling thread of the C++11 and Boost
+// thread-based parallelization. The binding of a thread pool only affects the calling thread,
+// all other threads continue to use their own binding or the global thread pool. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ExecutionContextTest::testBinding()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   test_ = "Binding of thread pools";
+
+   using Backend = blaze::TheThreadBackend;
+   using Pool    = Backend::Pool;
+
+   const size_t global( blaze::getNumThreads() );
+
+   // Binding and unbinding a thread pool
+   {
+      Pool pool( 3UL );
+
+      Pool* const previous( Backend::bind( &pool ) );
+      const size_t bound( blaze::getNumThreads() );
+      Pool* const current( Backend::bind( previous ) );
+
+      if( previous != nullptr || current != &pool ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid binding detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkNumThreads( bound, 3UL );
+      checkNumThreads( blaze::getNumThreads(), global );
+   }
+
+   // Binding of an execution context
+   {
+      blaze::ExecutionContext ctx( 2UL );
+
+      size_t other( 0UL );
+
+      ctx.run( [&]() {
+         checkNumThreads( Backend::size(), 2UL );
+
+         std::thread thread( [&other]() { other = blaze::getNumThreads(); } );
+         thread.join();
+      } );
+
+      checkNumThreads( other, global );
+
+      if( Backend::bind( nullptr ) != nullptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Binding has not been restored\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of execution contexts concurrently used by several application threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function runs parallel operations within independent execution contexts on two
+// application threads at the same time. Each thread must use the number of threads of its own
+// execution context and must compute the correct result. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ExecutionContextTest::testConcurrency()
+{
+   test_ = "Concurrent execution contexts";
+
+   const size_t global( blaze::getNumThreads() );
+
+   VT a( 100000UL ), b( 100000UL ), ref( 100000UL );
+
+   for( size_t i=0UL; i<a.size(); ++i ) {
+      a[i]   = static_cast<double>( i );
+      b[i]   = static_cast<double>( i % 7UL );
+      ref[i] = 2.0*a[i] + b[i];
+   }
+
+   std::string errors[2];
+
+   auto compute = [&]( size_t threads, std::string& error )
+   {
+      try {
+         blaze::ExecutionContext ctx( threads );
+         VT c;
+
+         for( size_t i=0UL; i<20UL; ++i ) {
+            ctx.run( [&]() {
+               checkNumThreads( blaze::getNumThreads(), ctx.size() );
+               c  = a + b;
+               c += a;
+            } );
+            checkResult( c, ref );
+         }
+      }
+      catch( std::exception& ex ) {
+         error = ex.what();
+      }
+   };
+
+   std::thread thread1( compute, 2UL, std::ref( errors[0] ) );
+   std::thread thread2( compute, 3UL, std::ref( errors[1] ) );
+
+   thread1.join();
+   thread2.join();
+
+   for( const std::string& error : errors ) {
+      if( !error.empty() ) {
+         throw std::runtime_error( error );
+      }
+   }
+
+   checkNumThreads( blaze::getNumThreads(), global );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of threads.
+//
+// \param threads The number of threads to be checked.
+// \param expected The expected number of threads.
+// \return void
+// \exception std::runtime_error Invalid number of threads detected.
+*/
+void ExecutionContextTest::checkNumThreads( size_t threads, size_t expected ) const
+{
+   if( threads != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads detected\n"
+          << " Details:\n"
+          << "   Number of threads         : " << threads << "\n"
+          << "   Expected number of threads: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a computation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+void ExecutionContextTest::checkResult( const VT& result, const VT& expected ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ExecutionContext class test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_EXECUTIONCONTEXT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ExecutionContext class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
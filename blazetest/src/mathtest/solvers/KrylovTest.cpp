@@ -0,0 +1,303 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/KrylovTest.cpp
+//  \brief Source file for the Krylov subspace solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/solvers/KrylovTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the KrylovTest solver test.
+//
+// \exception std::runtime_error Krylov solver error detected.
+*/
+KrylovTest::KrylovTest()
+{
+   //=====================================================================================
+   // Specific tests
+   //=====================================================================================
+
+   testSpecial();
+   testErrors();
+
+
+   //=====================================================================================
+   // Convergence tests
+   //=====================================================================================
+
+   for( size_t N : { 1UL, 7UL, 20UL } )
+   {
+      testCG<double>( N, 1E-10 );
+      testCG< blaze::complex<double> >( N, 1E-10 );
+      testCG<float>( N, 1E-4 );
+
+      testBiCGStab<double>( N, 1E-10 );
+      testBiCGStab< blaze::complex<double> >( N, 1E-10 );
+
+      testGMRES<double>( N, 1E-10 );
+      testGMRES< blaze::complex<double> >( N, 1E-10 );
+      testGMRES<float>( N, 1E-4 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the Krylov solvers for special right-hand sides and initial guesses.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Krylov solvers for a zero right-hand side and for an initial guess
+// that already solves the linear system. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void KrylovTest::testSpecial()
+{
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 25UL, 25UL );
+   initialize( A, 5UL, 0.0 );
+
+   {
+      test_ = "Krylov solvers with zero right-hand side";
+
+      const blaze::DynamicVector<double,blaze::columnVector> b( 25UL, 0.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x1( 25UL ), x2( 25UL ), x3( 25UL );
+      randomize( x1 );
+      randomize( x2 );
+      randomize( x3 );
+
+      const blaze::SolverStatistics stats1( blaze::cg      ( A, b, x1 ) );
+      const blaze::SolverStatistics stats2( blaze::bicgstab( A, b, x2 ) );
+      const blaze::SolverStatistics stats3( blaze::gmres   ( A, b, x3 ) );
+
+      if( !stats1.converged || stats1.iterations != 0UL || x1 != b ||
+          !stats2.converged || stats2.iterations != 0UL || x2 != b ||
+          !stats3.converged || stats3.iterations != 0UL || x3 != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Zero right-hand side not handled correctly\n"
+             << " Details:\n"
+             << "   CG result:\n" << x1 << "\n"
+             << "   BiCGStab result:\n" << x2 << "\n"
+             << "   GMRES result:\n" << x3 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Krylov solvers with exact initial guess";
+
+      blaze::DynamicVector<double,blaze::columnVector> x( 25UL );
+      randomize( x );
+
+      const blaze::DynamicVector<double,blaze::columnVector> b( A * x );
+      blaze::DynamicVector<double,blaze::columnVector> x1( x ), x2( x ), x3( x );
+
+      const blaze::SolverStatistics stats1( blaze::cg      ( A, b, x1 ) );
+      const blaze::SolverStatistics stats2( blaze::bicgstab( A, b, x2 ) );
+      const blaze::SolverStatistics stats3( blaze::gmres   ( A, b, x3 ) );
+
+      if( !stats1.converged || stats1.iterations != 0UL || x1 != x ||
+          !stats2.converged || stats2.iterations != 0UL || x2 != x ||
+          !stats3.converged || stats3.iterations != 0UL || x3 != x ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Exact initial guess not handled correctly\n"
+             << " Details:\n"
+             << "   CG iterations = " << stats1.iterations << "\n"
+             << "   BiCGStab iterations = " << stats2.iterations << "\n"
+             << "   GMRES iterations = " << stats3.iterations << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Krylov solvers with limited number of iterations";
+
+      blaze::DynamicVector<double,blaze::columnVector> b( 25UL );
+      initialize( b );
+
+      const blaze::SolverControl control( 2UL, 1E-12 );
+      blaze::DynamicVector<double,blaze::columnVector> x1( 25UL, 0.0 ), x2( 25UL, 0.0 ), x3( 25UL, 0.0 );
+
+      const blaze::SolverStatistics stats1( blaze::cg      ( A, b, x1, control ) );
+      const blaze::SolverStatistics stats2( blaze::bicgstab( A, b, x2, control ) );
+      const blaze::SolverStatistics stats3( blaze::gmres   ( A, b, x3, control ) );
+
+      if( stats1.converged || stats1.iterations != 2UL ||
+          stats2.converged || stats2.iterations != 2UL ||
+          stats3.converged || stats3.iterations != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Maximum number of iterations not respected\n"
+             << " Details:\n"
+             << "   CG iterations = " << stats1.iterations << "\n"
+             << "   BiCGStab iterations = " << stats2.iterations << "\n"
+             << "   GMRES iterations = " << stats3.iterations << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the Krylov solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the Krylov solvers reject non-square system matrices and vectors
+// of mismatching size. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void KrylovTest::testErrors()
+{
+   {
+      test_ = "Krylov solver with non-square system matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( 5UL, 4UL );
+      const blaze::DynamicVector<double,blaze::columnVector> b( 5UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x( 5UL, 0.0 );
+
+      try {
+         blaze::cg( A, b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with non-square system matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Krylov solver with mismatching vector sizes";
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 5UL, 1.0 );
+      const blaze::DynamicVector<double,blaze::columnVector> b( 5UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x( 4UL, 0.0 );
+
+      try {
+         blaze::gmres( A, b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with mismatching vector sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Krylov solver with invalid matrix-free operator";
+
+      auto op = []( const blaze::DynamicVector<double>& /*v*/, blaze::DynamicVector<double>& y ) {
+         y.resize( 3UL );
+      };
+
+      const blaze::DynamicVector<double,blaze::columnVector> b( 5UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x( 5UL, 1.0 );
+
+      try {
+         blaze::bicgstab( op, b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with invalid matrix-free operator succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Krylov subspace solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_KRYLOV_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Krylov subspace solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
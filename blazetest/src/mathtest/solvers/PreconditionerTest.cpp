@@ -0,0 +1,485 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/PreconditionerTest.cpp
+//  \brief Source file for the sparse preconditioner test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/solvers/PreconditionerTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PreconditionerTest solver test.
+//
+// \exception std::runtime_error Preconditioner error detected.
+*/
+PreconditionerTest::PreconditionerTest()
+{
+   //=====================================================================================
+   // Specific tests
+   //=====================================================================================
+
+   testExactness();
+   testRefactorization();
+   testErrors();
+
+
+   //=====================================================================================
+   // Convergence tests
+   //=====================================================================================
+
+   for( size_t N : { 1UL, 7UL, 20UL } )
+   {
+      testSymmetric<double>( N, 1E-10 );
+      testSymmetric< blaze::complex<double> >( N, 1E-10 );
+      testSymmetric<float>( N, 1E-4 );
+
+      testGeneral<double>( N, 1E-10 );
+      testGeneral< blaze::complex<double> >( N, 1E-10 );
+      testGeneral<float>( N, 1E-4 );
+
+      testBlockJacobi<double>( N, 1E-10 );
+      testBlockJacobi<float>( N, 1E-4 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the incomplete factorizations for matrices without fill-in.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the ILU(0) and IC(0) preconditioners compute the exact inverse of
+// tridiagonal matrices, for which the incomplete factorizations don't drop any fill-in. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testExactness()
+{
+   const size_t n( 50UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( n, n );
+   initializeStencil( A, n, 1UL, 1UL, { 3.0, -1.0, -1.5, 0.0, 0.0, 0.0, 0.0 } );
+
+   blaze::DynamicVector<double,blaze::columnVector> x( n );
+   randomize( x );
+
+   const blaze::DynamicVector<double,blaze::columnVector> b( A * x );
+   blaze::DynamicVector<double,blaze::columnVector> y;
+
+   {
+      test_ = "ILU(0) preconditioner for a tridiagonal matrix";
+
+      const blaze::ILU0Preconditioner<double> ilu( A );
+      ilu( b, y );
+
+      if( y.size() != n || max( abs( y - x ) ) > 1E-10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incomplete factorization is not exact\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "IC(0) preconditioner for a tridiagonal matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( A + trans( A ) );
+      const blaze::DynamicVector<double,blaze::columnVector> c( B * x );
+
+      const blaze::IC0Preconditioner<double> ic( B );
+      ic( c, y );
+
+      if( y.size() != n || max( abs( y - x ) ) > 1E-10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Incomplete factorization is not exact\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the numeric refactorization of the preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the numeric refactorization of the SSOR, ILU(0), and IC(0)
+// preconditioners for a matrix with the same sparsity pattern gives the same result as a
+// complete recomputation. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void PreconditionerTest::testRefactorization()
+{
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 100UL, 100UL );
+   initialize( A, 10UL, 0.0 );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> B( A );
+   for( size_t i=0UL; i<B.rows(); ++i ) {
+      B(i,i) = 5.0;
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> b( 100UL );
+   initialize( b );
+
+   blaze::DynamicVector<double,blaze::columnVector> y1, y2;
+
+   {
+      test_ = "ILU(0) refactorization";
+
+      blaze::ILU0Preconditioner<double> ilu( A );
+      ilu.factorize( B );
+      ilu( b, y1 );
+
+      const blaze::ILU0Preconditioner<double> ref( B );
+      ref( b, y2 );
+
+      if( max( abs( y1 - y2 ) ) > 1E-12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Refactorization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "IC(0) refactorization";
+
+      blaze::IC0Preconditioner<double> ic( A );
+      ic.factorize( B );
+      ic( b, y1 );
+
+      const blaze::IC0Preconditioner<double> ref( B );
+      ref( b, y2 );
+
+      if( max( abs( y1 - y2 ) ) > 1E-12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Refactorization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SSOR refactorization";
+
+      blaze::SSORPreconditioner<double> ssor( A, 1.2 );
+      ssor.factorize( B );
+      ssor( b, y1 );
+
+      const blaze::SSORPreconditioner<double> ref( B, 1.2 );
+      ref( b, y2 );
+
+      if( max( abs( y1 - y2 ) ) > 1E-12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Refactorization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << y2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the preconditioners reject non-square matrices, missing or zero
+// diagonal elements, matrices with a modified sparsity pattern during a refactorization, and
+// invalid relaxation parameters. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void PreconditionerTest::testErrors()
+{
+   {
+      test_ = "ILU(0) preconditioner with non-square matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( 5UL, 4UL );
+
+      try {
+         const blaze::ILU0Preconditioner<double> ilu( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "ILU(0) preconditioner with missing diagonal element";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 25UL, 25UL );
+      initialize( A, 5UL, 0.0 );
+      A.erase( 7UL, 7UL );
+
+      try {
+         const blaze::ILU0Preconditioner<double> ilu( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization with missing diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "ILU(0) refactorization with modified sparsity pattern";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 25UL, 25UL );
+      initialize( A, 5UL, 0.0 );
+
+      blaze::ILU0Preconditioner<double> ilu( A );
+
+      A(3UL,12UL) = 1.0;
+
+      try {
+         ilu.factorize( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Refactorization with modified sparsity pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "IC(0) refactorization with modified sparsity pattern";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 25UL, 25UL );
+      initialize( A, 5UL, 0.0 );
+
+      blaze::IC0Preconditioner<double> ic( A );
+
+      A(12UL,3UL) = 1.0;
+
+      try {
+         ic.factorize( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Refactorization with modified sparsity pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "IC(0) preconditioner with indefinite matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 25UL, 25UL );
+      initialize( A, 5UL, 0.0 );
+      A(12UL,12UL) = -4.0;
+
+      try {
+         const blaze::IC0Preconditioner<double> ic( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Jacobi preconditioner with zero diagonal element";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 25UL, 25UL );
+      initialize( A, 5UL, 0.0 );
+      A(12UL,12UL) = 0.0;
+
+      bool detected( false );
+
+      try {
+         const blaze::JacobiPreconditioner<double> jacobi( A );
+      }
+      catch( std::runtime_error& ) {
+         detected = true;
+      }
+
+      if( !detected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of zero diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SSOR preconditioner with invalid relaxation parameter";
+
+      try {
+         const blaze::SSORPreconditioner<double> ssor( 2.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with invalid relaxation parameter succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Preconditioner application with mismatching vector size";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 25UL, 25UL );
+      initialize( A, 5UL, 0.0 );
+
+      const blaze::ILU0Preconditioner<double> ilu( A );
+      const blaze::DynamicVector<double,blaze::columnVector> r( 24UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> z;
+
+      try {
+         ilu( r, z );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Application to vector of mismatching size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that a preconditioner reduced the number of iterations.
+//
+// \param stats The statistics of the preconditioned solver run.
+// \param reference The number of iterations of the unpreconditioned solver run.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the preconditioned solver run didn't require more iterations than
+// the unpreconditioned reference run. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void PreconditionerTest::checkIterations( const blaze::SolverStatistics& stats, size_t reference )
+{
+   if( stats.iterations > reference ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Preconditioner increased the number of iterations\n"
+          << " Details:\n"
+          << "   Iterations = " << stats.iterations << "\n"
+          << "   Unpreconditioned iterations = " << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse preconditioner test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_PRECONDITIONER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse preconditioner test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
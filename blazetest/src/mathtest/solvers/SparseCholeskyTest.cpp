@@ -0,0 +1,473 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/SparseCholeskyTest.cpp
+//  \brief Source file for the sparse Cholesky solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/solvers/SparseCholeskyTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SparseCholeskyTest solver test.
+//
+// \exception std::runtime_error Sparse Cholesky solver error detected.
+*/
+SparseCholeskyTest::SparseCholeskyTest()
+{
+   //=====================================================================================
+   // Specific tests
+   //=====================================================================================
+
+   testOrderings();
+   testFactorize();
+   testErrors();
+   testParallel();
+
+
+   //=====================================================================================
+   // Decomposition tests
+   //=====================================================================================
+
+   for( size_t N : { 1UL, 2UL, 7UL, 16UL } )
+   {
+      testSymmetric<double>( N, 1E-12 );
+      testSymmetric<float>( N, 1E-5 );
+
+      testHermitian< blaze::complex<double> >( N, 1E-12 );
+      testHermitian< blaze::complex<float> >( N, 1E-5 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the sparse Cholesky solver for different fill-reducing orderings.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the symbolic analysis of the sparse Cholesky solver for the natural
+// ordering, the reverse Cuthill-McKee ordering and the approximate minimum degree ordering.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseCholeskyTest::testOrderings()
+{
+   constexpr size_t N( 10UL );
+   constexpr size_t n( N*N*N );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> tmp;
+   initialize( tmp, N, -1.0 );
+
+   const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( tmp );
+
+   blaze::DynamicVector<double,blaze::columnVector> b( n ), x;
+   randomize( b );
+
+   std::vector<size_t> natural( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      natural[i] = i;
+   }
+
+   blaze::SparseCholeskySolver<double> solver;
+
+   {
+      test_ = "Sparse Cholesky solver with natural ordering";
+
+      solver.analyze( A, natural );
+      solver.factorize( A );
+      solver.solve( b, x );
+      checkResult( A, b, x, 1E-12 );
+   }
+
+   const size_t nonzeros( solver.nonZeros() );
+
+   if( nonzeros < ( A.nonZeros() + n ) / 2UL || solver.supernodes() > n ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid symbolic decomposition\n"
+          << " Details:\n"
+          << "   Non-zero elements of the factor = " << nonzeros << "\n"
+          << "   Number of supernodes = " << solver.supernodes() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with reverse Cuthill-McKee ordering";
+
+      solver.analyze( A, blaze::rcm( A ) );
+      solver.factorize( A );
+      solver.solve( b, x );
+      checkResult( A, b, x, 1E-12 );
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with approximate minimum degree ordering";
+
+      solver.compute( A );
+      solver.solve( b, x );
+      checkResult( A, b, x, 1E-12 );
+
+      std::vector<bool> found( n, false );
+      for( size_t p : solver.permutation() ) {
+         if( p < n ) found[p] = true;
+      }
+
+      if( solver.size() != n || solver.permutation().size() != n ||
+          std::find( found.begin(), found.end(), false ) != found.end() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation\n"
+             << " Details:\n"
+             << "   System size = " << solver.size() << "\n"
+             << "   Permutation size = " << solver.permutation().size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( solver.nonZeros() >= nonzeros ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: No fill reduction\n"
+             << " Details:\n"
+             << "   Non-zero elements (natural ordering) = " << nonzeros << "\n"
+             << "   Non-zero elements (AMD ordering) = " << solver.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the numeric decomposition of the sparse Cholesky solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the numeric decomposition of matrices with the sparsity pattern of a
+// previously analyzed matrix, including general sparse matrices that only store the lower part
+// of the symmetric matrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SparseCholeskyTest::testFactorize()
+{
+   constexpr size_t N( 8UL );
+   constexpr size_t n( N*N*N );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> tmp;
+   initialize( tmp, N, -1.0 );
+
+   const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( tmp );
+
+   blaze::DynamicVector<double,blaze::columnVector> b( n ), x;
+   randomize( b );
+
+   blaze::SparseCholeskySolver<double> solver( A );
+
+   {
+      test_ = "Numeric decomposition of a matrix with modified values";
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( auto element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+            element->value() *= ( element->index() == i ? 2.0 : 0.5 );
+         }
+      }
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > B( tmp );
+
+      solver.factorize( B );
+      solver.solve( b, x );
+      checkResult( B, b, x, 1E-12 );
+   }
+
+   {
+      test_ = "Numeric decomposition of a row-major matrix with lower part only";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> L( n, n );
+      L.reserve( ( A.nonZeros() + n ) / 2UL );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i) && element->index()<=i; ++element ) {
+            L.append( i, element->index(), element->value() );
+         }
+         L.finalize( i );
+      }
+
+      solver.factorize( L );
+      solver.solve( b, x );
+      checkResult( A, b, x, 1E-12 );
+   }
+
+   {
+      test_ = "Numeric decomposition of a column-major matrix with lower part only";
+
+      blaze::CompressedMatrix<double,blaze::columnMajor> L( n, n );
+      L.reserve( ( A.nonZeros() + n ) / 2UL );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         for( auto element=A.begin(j); element!=A.end(j); ++element ) {
+            if( element->index() >= j ) L.append( element->index(), j, element->value() );
+         }
+         L.finalize( j );
+      }
+
+      solver.factorize( L );
+      solver.solve( b, x );
+      checkResult( A, b, x, 1E-12 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the sparse Cholesky solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the sparse Cholesky solver detects non-square matrices, invalid
+// permutations, non-positive-definite matrices, modified sparsity patterns and right-hand
+// sides of invalid size. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SparseCholeskyTest::testErrors()
+{
+   blaze::CompressedMatrix<double,blaze::rowMajor> tmp;
+   initialize( tmp, 3UL, -1.0 );
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( tmp );
+
+   {
+      test_ = "Sparse Cholesky solver with non-square matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( 27UL, 26UL );
+
+      try {
+         const blaze::SparseCholeskySolver<double> solver( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with invalid permutation";
+
+      std::vector<size_t> perm( 27UL, 0UL );
+
+      try {
+         blaze::SparseCholeskySolver<double> solver;
+         solver.analyze( A, perm );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Analysis with invalid permutation succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with indefinite matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> B( A );
+      B(13,13) = -6.5;
+
+      try {
+         const blaze::SparseCholeskySolver<double> solver( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with modified sparsity pattern";
+
+      blaze::SparseCholeskySolver<double> solver( A );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> B( A );
+      B(26,0) = 0.1;
+      B(0,26) = 0.1;
+
+      try {
+         solver.factorize( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition with modified sparsity pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Sparse Cholesky solver with mismatching right-hand side";
+
+      const blaze::SparseCholeskySolver<double> solver( A );
+
+      const blaze::DynamicVector<double,blaze::columnVector> b( 26UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      try {
+         solver.solve( b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with mismatching right-hand side succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> B( 28UL, 2UL, 1.0 );
+      blaze::DynamicMatrix<double,blaze::rowMajor> X;
+
+      try {
+         solver.solve( B, X );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with mismatching right-hand side matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel numeric decomposition of the sparse Cholesky solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the numeric decomposition with two threads for a matrix that is large
+// enough for the independent supernodes of the elimination tree to be decomposed in parallel.
+// In case no shared-memory parallelization is active, the decomposition is performed serially.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseCholeskyTest::testParallel()
+{
+   test_ = "Parallel numeric decomposition";
+
+   constexpr size_t N( 20UL );
+   constexpr size_t n( N*N*N );
+
+   const size_t threads( blaze::getNumThreads() );
+   blaze::setNumThreads( 2UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> tmp;
+   initialize( tmp, N, -1.0 );
+
+   const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( tmp );
+
+   blaze::DynamicVector<double,blaze::columnVector> b( n ), x;
+   randomize( b );
+
+   blaze::SparseCholeskySolver<double> solver( A );
+   solver.solve( b, x );
+   checkResult( A, b, x, 1E-12 );
+
+   solver.factorize( A );
+   solver.solve( b, x );
+   checkResult( A, b, x, 1E-12 );
+
+   blaze::setNumThreads( threads );
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse Cholesky solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_SPARSECHOLESKY_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse Cholesky solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
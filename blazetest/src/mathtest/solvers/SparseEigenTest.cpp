@@ -0,0 +1,449 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/SparseEigenTest.cpp
+//  \brief Source file for the sparse eigenvalue solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/dense/Eigen.h>
+#include <blazetest/mathtest/solvers/SparseEigenTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SparseEigenTest solver test.
+//
+// \exception std::runtime_error Sparse eigenvalue solver error detected.
+*/
+SparseEigenTest::SparseEigenTest()
+{
+   //=====================================================================================
+   // Specific tests
+   //=====================================================================================
+
+   testMatrixFree();
+   testComplexPairs();
+   testErrors();
+
+
+   //=====================================================================================
+   // Lanczos tests
+   //=====================================================================================
+
+   testLanczos<double>( 20UL, 13UL, -1.0, 1E-10 );
+   testLanczos<float>( 20UL, 13UL, -1.0F, 1E-3 );
+   testLanczos< blaze::complex<double> >( 20UL, 13UL, blaze::complex<double>( -0.8, 0.6 ), 1E-10 );
+   testLanczos< blaze::complex<float> >( 20UL, 13UL, blaze::complex<float>( -0.8F, 0.6F ), 1E-3 );
+
+
+   //=====================================================================================
+   // Arnoldi tests
+   //=====================================================================================
+
+   testArnoldi<double>( 17UL, 11UL, 1E-10 );
+   testArnoldi<float>( 17UL, 11UL, 1E-3 );
+   testArnoldi< blaze::complex<double> >( 17UL, 11UL, 1E-10 );
+   testArnoldi< blaze::complex<float> >( 17UL, 11UL, 1E-3 );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the eigenvalue solvers for matrix-free operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Lanczos solver and the Arnoldi solver for matrix-free operators with
+// a user-specified start vector and for a symmetric matrix adaptor. Note that the start vector
+// must not be orthogonal to any of the wanted eigenvectors (as for instance a constant or a
+// linear vector, which are orthogonal to many of the grid modes). In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseEigenTest::testMatrixFree()
+{
+   using cplx = blaze::complex<double>;
+
+   constexpr size_t N( 16UL );
+   constexpr size_t M( 9UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   initialize( A, N, M, -1.0, -1.0 );
+
+   blaze::DynamicVector<double,blaze::columnVector> x0( N*M );
+   randomize( x0 );
+
+   const blaze::SolverControl control( 500UL, 1E-12, 24UL );
+
+   auto op = [&A]( const blaze::DynamicVector<double,blaze::columnVector>& x,
+                   blaze::DynamicVector<double,blaze::columnVector>& y ) {
+      y = A * x;
+   };
+
+   {
+      test_ = "Lanczos solver with matrix-free operator";
+
+      blaze::LanczosSolver<double> solver( control );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<double,blaze::columnMajor> X;
+
+      solver.solve( op, x0, w, X, 5UL, blaze::largestMagnitude );
+
+      checkEigenpairs( A, w, X, reference( N, M, 1.0, blaze::largestMagnitude ), 1E-10 );
+      checkOrthonormality( X, 1E-10 );
+   }
+
+   {
+      test_ = "Lanczos solver with symmetric matrix adaptor";
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::columnMajor> > B( A );
+
+      blaze::LanczosSolver<double> solver( control );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<double,blaze::columnMajor> X;
+
+      solver.solve( B, x0, w, X, 2UL, blaze::smallestAlgebraic );
+
+      checkEigenpairs( A, w, X, reference( N, M, 1.0, blaze::smallestAlgebraic ), 1E-10 );
+      checkOrthonormality( X, 1E-10 );
+
+      // Reusing the solver for a different number of eigenvalues
+      solver.solve( B, w, X, 6UL, blaze::smallestAlgebraic );
+
+      checkEigenpairs( A, w, X, reference( N, M, 1.0, blaze::smallestAlgebraic ), 1E-10 );
+      checkOrthonormality( X, 1E-10 );
+   }
+
+   {
+      test_ = "Arnoldi solver with matrix-free operator";
+
+      blaze::ArnoldiSolver<double> solver( control );
+
+      blaze::DynamicVector<cplx,blaze::columnVector> w;
+      blaze::DynamicMatrix<cplx,blaze::columnMajor> X;
+
+      solver.solve( op, x0, w, X, 3UL, blaze::largestAlgebraic );
+
+      checkEigenpairs( A, w, X, reference( N, M, 1.0, blaze::largestAlgebraic ), 1E-10 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Arnoldi solver for complex conjugate pairs of eigenvalues.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the real Arnoldi solver for a sparse matrix with complex conjugate pairs
+// of eigenvalues. The results are compared to the dense eigenvalue decomposition. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseEigenTest::testComplexPairs()
+{
+   using cplx = blaze::complex<double>;
+
+   test_ = "Arnoldi solver with complex conjugate pairs of eigenvalues";
+
+   constexpr size_t n( 100UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( n, n );
+   A.reserve( 2UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i+1UL == n ) A.append( i, 0UL, 1.0 );
+      A.append( i, i, 0.01*i );
+      if( i+1UL < n ) A.append( i, i+1UL, 1.0 );
+      A.finalize( i );
+   }
+
+   blaze::DynamicVector<cplx,blaze::columnVector> w;
+   blaze::DynamicMatrix<cplx,blaze::columnMajor> X;
+
+   blaze::ArnoldiSolver<double> solver( blaze::SolverControl( 500UL, 1E-12, 40UL ) );
+   const blaze::SolverStatistics stats( solver.solve( A, w, X, 6UL ) );
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> D( A );
+   blaze::DynamicVector<cplx,blaze::columnVector> ref;
+   blaze::eigen( D, ref );
+
+   std::vector<double> magnitudes( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      magnitudes[i] = std::abs( ref[i] );
+   }
+   std::sort( magnitudes.begin(), magnitudes.end(), std::greater<double>() );
+
+   for( size_t i=0UL; i<w.size(); ++i )
+   {
+      double error( std::abs( w[i] - ref[0UL] ) );
+      for( size_t j=1UL; j<n; ++j ) {
+         error = std::min( error, std::abs( w[i] - ref[j] ) );
+      }
+
+      const blaze::DynamicVector<cplx,blaze::columnVector> x( column( X, i ) );
+      const blaze::DynamicVector<cplx,blaze::columnVector> r( A * x - w[i] * x );
+      const double rnorm( std::sqrt( std::abs( dot( conj( r ), r ) ) ) );
+
+      if( !stats.converged || error > 1E-9 || rnorm > 1E-9 ||
+          std::abs( std::abs( w[i] ) - magnitudes[i] ) > 1E-9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid eigenpair detected\n"
+             << " Details:\n"
+             << "   Index = " << i << "\n"
+             << "   Computed eigenvalue = " << w[i] << "\n"
+             << "   Distance to the exact spectrum = " << error << "\n"
+             << "   Expected magnitude = " << magnitudes[i] << "\n"
+             << "   Residual = " << rnorm << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the eigenvalue solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the error handling of the eigenvalue solvers for non-square matrices,
+// invalid numbers of requested eigenvalues, invalid start vectors, and invalid matrix-free
+// operators. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SparseEigenTest::testErrors()
+{
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   initialize( A, 5UL, 4UL, -1.0, -1.0 );
+
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> X;
+
+   blaze::LanczosSolver<double> solver;
+
+   {
+      test_ = "Lanczos solver with non-square matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( 20UL, 19UL );
+
+      try {
+         solver.solve( B, w, X, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalue computation of non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Lanczos solver with invalid number of eigenvalues";
+
+      for( size_t nev : { 0UL, 21UL } )
+      {
+         try {
+            solver.solve( A, w, X, nev );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Computation of " << nev << " eigenvalues succeeded\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+      }
+   }
+
+   {
+      test_ = "Lanczos solver with start vector of invalid size";
+
+      const blaze::DynamicVector<double,blaze::columnVector> x0( 19UL, 1.0 );
+
+      try {
+         solver.solve( A, x0, w, X, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalue computation with start vector of invalid size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Arnoldi solver with zero start vector";
+
+      const blaze::DynamicVector<double,blaze::columnVector> x0( 20UL, 0.0 );
+
+      blaze::DynamicVector< blaze::complex<double>, blaze::columnVector > v;
+      blaze::DynamicMatrix< blaze::complex<double>, blaze::columnMajor > Y;
+
+      try {
+         blaze::ArnoldiSolver<double> arnoldi;
+         arnoldi.solve( A, x0, v, Y, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalue computation with zero start vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Lanczos solver with invalid matrix-free operator";
+
+      const blaze::DynamicVector<double,blaze::columnVector> x0( 20UL, 1.0 );
+
+      auto op = []( const blaze::DynamicVector<double,blaze::columnVector>& x,
+                    blaze::DynamicVector<double,blaze::columnVector>& y ) {
+         y.resize( x.size() + 1UL );
+      };
+
+      try {
+         solver.solve( op, x0, w, X, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Eigenvalue computation with invalid operator succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computation of the exact eigenvalues of the two-dimensional convection-diffusion problem.
+//
+// \param N The number of grid points in x-direction.
+// \param M The number of grid points in y-direction.
+// \param s The geometric mean of the couplings in x-direction.
+// \param spectrum The wanted part of the spectrum.
+// \return The exact eigenvalues, sorted according to the given spectrum flag.
+//
+// The eigenvalues of the five-point discretization on a \a N-by-\a M grid are given by
+// \f$ 4 - 2s\cos(\frac{j\pi}{N+1}) - 2\cos(\frac{i\pi}{M+1}) \f$. Since all eigenvalues are
+// positive, the largest eigenvalues and the eigenvalues of largest magnitude coincide.
+*/
+std::vector<double> SparseEigenTest::reference( size_t N, size_t M, double s,
+                                                blaze::SpectrumFlag spectrum )
+{
+   const double pi( std::acos( -1.0 ) );
+
+   std::vector<double> ev;
+   ev.reserve( N*M );
+
+   for( size_t i=1UL; i<=M; ++i ) {
+      for( size_t j=1UL; j<=N; ++j ) {
+         ev.push_back( 4.0 - 2.0*s*std::cos( j*pi/(N+1UL) ) - 2.0*std::cos( i*pi/(M+1UL) ) );
+      }
+   }
+
+   if( spectrum == blaze::smallestAlgebraic )
+      std::sort( ev.begin(), ev.end() );
+   else
+      std::sort( ev.begin(), ev.end(), std::greater<double>() );
+
+   return ev;
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse eigenvalue solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_SPARSEEIGEN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse eigenvalue solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
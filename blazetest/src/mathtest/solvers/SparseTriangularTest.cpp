@@ -0,0 +1,275 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/SparseTriangularTest.cpp
+//  \brief Source file for the sparse triangular solver test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/solvers/SparseTriangularTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SparseTriangularTest solver test.
+//
+// \exception std::runtime_error Sparse triangular solver error detected.
+*/
+SparseTriangularTest::SparseTriangularTest()
+{
+   //=====================================================================================
+   // Specific tests
+   //=====================================================================================
+
+   testUpdate();
+   testErrors();
+
+
+   //=====================================================================================
+   // Substitution tests
+   //=====================================================================================
+
+   for( size_t N : { 1UL, 7UL, 40UL } )
+   {
+      testLower<double>( N, 1E-12 );
+      testLower< blaze::complex<double> >( N, 1E-12 );
+      testLower<float>( N, 1E-5 );
+
+      testUpper<double>( N, 1E-12 );
+      testUpper< blaze::complex<double> >( N, 1E-12 );
+      testUpper<float>( N, 1E-5 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the numeric update of the sparse triangular solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the solver computes the correct solution after an update of the
+// values of the triangular matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void SparseTriangularTest::testUpdate()
+{
+   test_ = "Update of the triangular matrix";
+
+   blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > L( 100UL );
+   initialize( L, 10UL );
+
+   blaze::DynamicVector<double,blaze::columnVector> b( 100UL ), x;
+   randomize( b );
+
+   blaze::SparseTriangularSolver<double> solver( L );
+
+   for( size_t i=0UL; i<L.rows(); ++i ) {
+      for( auto element=L.begin(i); element!=L.end(i); ++element ) {
+         element->value() *= ( element->index() == i ? 2.0 : 0.5 );
+      }
+   }
+
+   solver.update( L );
+   solver.solve( b, x );
+   checkResult( L, b, x, 1E-12 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the sparse triangular solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the solver rejects singular matrices, modified sparsity patterns,
+// and right-hand sides of mismatching size. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SparseTriangularTest::testErrors()
+{
+   blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > L( 25UL );
+   initialize( L, 5UL );
+
+   {
+      test_ = "Sparse triangular solver with singular matrix";
+
+      blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > S( L );
+      S.erase( 12UL, 12UL );
+
+      bool detected( false );
+
+      try {
+         const blaze::SparseTriangularSolver<double> solver( S );
+      }
+      catch( std::runtime_error& ) {
+         detected = true;
+      }
+
+      if( !detected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Analysis of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Sparse triangular solver update with modified sparsity pattern";
+
+      blaze::SparseTriangularSolver<double> solver( L );
+
+      blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > M( L );
+      M(20UL,3UL) = 1.0;
+
+      try {
+         solver.update( M );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Update with modified sparsity pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Sparse triangular solver update with upper matrix";
+
+      blaze::SparseTriangularSolver<double> solver( L );
+
+      const blaze::UpperMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > U( trans( L ) );
+
+      try {
+         solver.update( U );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Update of lower matrix with upper matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Sparse triangular solver with mismatching right-hand side";
+
+      const blaze::SparseTriangularSolver<double> solver( L );
+
+      const blaze::DynamicVector<double,blaze::columnVector> b( 24UL, 1.0 );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      try {
+         solver.solve( b, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with mismatching right-hand side succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> B( 26UL, 2UL, 1.0 );
+      blaze::DynamicMatrix<double,blaze::rowMajor> X;
+
+      try {
+         solver.solve( B, X );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with mismatching right-hand side matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse triangular solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_SPARSETRIANGULAR_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse triangular solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
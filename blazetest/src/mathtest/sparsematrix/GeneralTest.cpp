@@ -37,10 +37,12 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <blaze/math/sparse/SparseMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/sparsematrix/GeneralTest.h>
 
 
@@ -78,6 +80,7 @@ GeneralTest::GeneralTest()
    testIsIdentity();
    testMinimum();
    testMaximum();
+   testPartialReduce();
    testTrace();
 }
 //*************************************************************************************************
@@ -4627,6 +4630,119 @@ void GeneralTest::testMaximum()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the row-wise and column-wise \c reduce() functions for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the row-wise and column-wise \c reduce() functions for
+// sparse matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testPartialReduce()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sum<rowwise>() / sum<columnwise>()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(0,0) =  1;
+      mat(0,2) = -2;
+      mat(1,1) =  3;
+      mat(1,3) =  4;
+      mat(2,0) = -5;
+      mat(2,3) =  6;
+
+      checkRows   ( mat, 3UL );
+      checkColumns( mat, 4UL );
+
+      // Row-wise reduction
+      {
+         blaze::DynamicVector<int,blaze::columnVector> rowsums( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( rowsums.size() != 3UL || rowsums[0] != -1 || rowsums[1] != 7 || rowsums[2] != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowsums << "\n"
+                << "   Expected result:\n( -1 7 1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Column-wise reduction
+      {
+         blaze::DynamicVector<int,blaze::rowVector> colsums( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( colsums.size() != 4UL || colsums[0] != -4 || colsums[1] != 3 || colsums[2] != -2 || colsums[3] != 10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colsums << "\n"
+                << "   Expected result:\n( -4 3 -2 10 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sum<rowwise>() / sum<columnwise>()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+      mat(0,0) =  1;
+      mat(0,2) = -2;
+      mat(1,1) =  3;
+      mat(1,3) =  4;
+      mat(2,0) = -5;
+      mat(2,3) =  6;
+
+      checkRows   ( mat, 3UL );
+      checkColumns( mat, 4UL );
+
+      // Row-wise reduction
+      {
+         blaze::DynamicVector<int,blaze::columnVector> rowsums( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( rowsums.size() != 3UL || rowsums[0] != -1 || rowsums[1] != 7 || rowsums[2] != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Row-wise reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowsums << "\n"
+                << "   Expected result:\n( -1 7 1 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Column-wise reduction
+      {
+         blaze::DynamicVector<int,blaze::rowVector> colsums( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( colsums.size() != 4UL || colsums[0] != -4 || colsums[1] != 3 || colsums[2] != -2 || colsums[3] != 10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Column-wise reduction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colsums << "\n"
+                << "   Expected result:\n( -4 3 -2 10 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c trace() function for sparse matrices.
 //
@@ -0,0 +1,471 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sparsematrix/ReorderingTest.cpp
+//  \brief Source file for the sparse matrix reordering test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/sparsematrix/ReorderingTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ReorderingTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ReorderingTest::ReorderingTest()
+{
+   testPermute();
+   testRCM();
+   testAMD();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the permute() and ipermute() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the symmetric permutation of row-major and column-major sparse matrices
+// and the permutation of dense vectors. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ReorderingTest::testPermute()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 5UL, 5UL );
+   tmp(0,0) = 1;
+   tmp(0,3) = 2;
+   tmp(1,4) = 3;
+   tmp(2,1) = 4;
+   tmp(3,3) = 5;
+   tmp(4,0) = 6;
+   tmp(4,2) = 7;
+
+   const blaze::CompressedMatrix<int,blaze::rowMajor> A( tmp );
+
+   const std::vector<size_t> perm{ 3UL, 0UL, 4UL, 1UL, 2UL };
+
+   {
+      test_ = "Symmetric permutation of a row-major sparse matrix";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> B( permute( A, perm ) );
+
+      for( size_t i=0UL; i<5UL; ++i ) {
+         for( size_t j=0UL; j<5UL; ++j ) {
+            if( B(i,j) != A(perm[i],perm[j]) || B.nonZeros() != A.nonZeros() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Permutation failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << B << "\n"
+                   << "   Original matrix:\n" << A << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Symmetric permutation of a column-major sparse matrix";
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> C( A );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> B( permute( C, perm ) );
+
+      for( size_t i=0UL; i<5UL; ++i ) {
+         for( size_t j=0UL; j<5UL; ++j ) {
+            if( B(i,j) != A(perm[i],perm[j]) || B.nonZeros() != A.nonZeros() ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Permutation failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << B << "\n"
+                   << "   Original matrix:\n" << A << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Permutation of a dense vector";
+
+      const blaze::DynamicVector<int,blaze::columnVector> x{ 1, 2, 3, 4, 5 };
+      const blaze::DynamicVector<int,blaze::columnVector> y( permute( x, perm ) );
+      const blaze::DynamicVector<int,blaze::columnVector> z( ipermute( y, perm ) );
+
+      if( y[0] != 4 || y[1] != 1 || y[2] != 5 || y[3] != 2 || y[4] != 3 || z != x ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation failed\n"
+             << " Details:\n"
+             << "   Permuted vector:\n" << y << "\n"
+             << "   Inversely permuted vector:\n" << z << "\n"
+             << "   Original vector:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Consistency of the matrix and vector permutations";
+
+      const blaze::DynamicVector<int,blaze::columnVector> x{ 1, -2, 3, -4, 5 };
+      const blaze::DynamicVector<int,blaze::columnVector> y( A * x );
+      const blaze::DynamicVector<int,blaze::columnVector> z( ipermute( permute( A, perm ) * permute( x, perm ), perm ) );
+
+      if( y != z ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permuted matrix/vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n" << y << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reverse Cuthill-McKee ordering.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reverse Cuthill-McKee ordering by means of a randomly numbered
+// two-dimensional grid, a matrix with several connected components, and an empty matrix. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ReorderingTest::testRCM()
+{
+   {
+      test_ = "RCM ordering of a randomly numbered grid";
+
+      const size_t N( 20UL );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      initialize( A, N );
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( permute( A, shuffle( N*N ) ) );
+      const std::vector<size_t> perm( rcm( B ) );
+      checkPermutation( perm, N*N );
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> C( permute( B, perm ) );
+
+      if( bandwidth( C ) > N+1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth not reduced\n"
+             << " Details:\n"
+             << "   Bandwidth of the shuffled matrix = " << bandwidth( B ) << "\n"
+             << "   Bandwidth of the reordered matrix = " << bandwidth( C ) << "\n"
+             << "   Expected bandwidth <= " << ( N+1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> D( B );
+
+      if( rcm( D ) != perm ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Storage order dependent ordering\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "RCM ordering of a non-symmetric matrix with several connected components";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 7UL, 7UL );
+      A(0,4) = 1.0;
+      A(4,2) = 1.0;
+      A(1,6) = 1.0;
+      A(5,5) = 1.0;
+
+      const std::vector<size_t> perm( rcm( A ) );
+      checkPermutation( perm, 7UL );
+
+      if( bandwidth( permute( A, perm ) ) != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Bandwidth not reduced\n"
+             << " Details:\n"
+             << "   Reordered matrix:\n" << permute( A, perm ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "RCM ordering of an empty matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A;
+
+      if( !rcm( A ).empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-empty ordering\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the approximate minimum degree ordering.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the approximate minimum degree ordering reduces the fill-in of the
+// Cholesky factor of a two-dimensional grid compared to both the natural and the reverse
+// Cuthill-McKee ordering. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ReorderingTest::testAMD()
+{
+   test_ = "AMD ordering of a randomly numbered grid";
+
+   const size_t N( 30UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   initialize( A, N );
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> B( permute( A, shuffle( N*N ) ) );
+   const std::vector<size_t> perm( amd( B ) );
+   checkPermutation( perm, N*N );
+
+   const size_t natural( fill( A ) );
+   const size_t reverse( fill( permute( B, rcm( B ) ) ) );
+   const size_t minimum( fill( permute( B, perm ) ) );
+
+   if( minimum >= natural || minimum >= reverse ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fill-in not reduced\n"
+          << " Details:\n"
+          << "   Non-zeros of the factor (natural ordering) = " << natural << "\n"
+          << "   Non-zeros of the factor (RCM ordering) = " << reverse << "\n"
+          << "   Non-zeros of the factor (AMD ordering) = " << minimum << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the reordering functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the reordering functions reject non-square matrices and invalid
+// permutation vectors. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ReorderingTest::testErrors()
+{
+   {
+      test_ = "Reordering of a non-square matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( 4UL, 5UL );
+
+      try {
+         amd( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reordering of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Permutation with an invalid permutation vector";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL );
+      const std::vector<size_t> perm{ 0UL, 2UL, 0UL };
+
+      try {
+         permute( A, perm );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with invalid permutation vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Permutation with a permutation vector of invalid size";
+
+      const blaze::DynamicVector<double,blaze::columnVector> x( 3UL, 1.0 );
+      const std::vector<size_t> perm{ 0UL, 1UL };
+
+      try {
+         ipermute( x, perm );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Permutation with permutation vector of invalid size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a random permutation of the given size.
+//
+// \param n The size of the permutation.
+// \return The random permutation vector.
+*/
+std::vector<size_t> ReorderingTest::shuffle( size_t n )
+{
+   std::vector<size_t> perm( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      perm[i] = i;
+   }
+
+   for( size_t i=n; i>1UL; --i ) {
+      std::swap( perm[i-1UL], perm[blaze::rand<size_t>( 0UL, i-1UL )] );
+   }
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the given permutation vector.
+//
+// \param perm The permutation vector to be checked.
+// \param n The expected size of the permutation.
+// \return void
+// \exception std::runtime_error Invalid permutation detected.
+*/
+void ReorderingTest::checkPermutation( const std::vector<size_t>& perm, size_t n )
+{
+   std::vector<bool> found( n, false );
+
+   for( size_t i : perm ) {
+      if( i >= n || found[i] ) break;
+      found[i] = true;
+   }
+
+   if( perm.size() != n || std::find( found.begin(), found.end(), false ) != found.end() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation vector\n"
+          << " Details:\n"
+          << "   Size of the permutation = " << perm.size() << "\n"
+          << "   Expected size = " << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse matrix reordering test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEMATRIX_REORDERING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse matrix reordering test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
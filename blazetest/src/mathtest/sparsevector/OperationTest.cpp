@@ -69,6 +69,8 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testSum();
+   testProd();
 }
 //*************************************************************************************************
 
@@ -577,6 +579,110 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for sparse vectors template. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSum()
+{
+   test_ = "sum() function";
+
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 8UL, 3UL );
+      vec[1] =  1;
+      vec[3] = -4;
+      vec[7] =  8;
+
+      const int totalsum = sum( vec );
+
+      if( totalsum != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 8UL );
+
+      const int totalsum = sum( vec );
+
+      if( totalsum != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalsum << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c prod() function for sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prod() function for sparse vectors template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testProd()
+{
+   test_ = "prod() function";
+
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 3UL, 3UL );
+      vec[0] =  2;
+      vec[1] = -3;
+      vec[2] =  4;
+
+      const int totalprod = prod( vec );
+
+      if( totalprod != -24 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalprod << "\n"
+             << "   Expected result: -24\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 8UL, 2UL );
+      vec[2] = 2;
+      vec[5] = 3;
+
+      const int totalprod = prod( vec );
+
+      if( totalprod != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << totalprod << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace sparsevector
 
 } // namespace mathtest
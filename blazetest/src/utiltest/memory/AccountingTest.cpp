@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/memory/AccountingTest.cpp
+//  \brief Source file for the memory accounting test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/MemoryAccounting.h>
+#include <blaze/util/ScratchArena.h>
+#include <blazetest/utiltest/memory/AccountingTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace memory {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AccountingTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+AccountingTest::AccountingTest()
+{
+   testCategories();
+   testPeak();
+   testSnapshot();
+   testScratchArena();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the per-category accounting of the Blaze data structures.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests whether the allocations of the dense and sparse vector and matrix types
+// are accounted to the according memory category. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AccountingTest::testCategories()
+{
+   test_ = "Memory categories";
+
+   const blaze::MemoryStatistics before( blaze::getMemoryStatistics() );
+
+   {
+      blaze::MemorySnapshot snapshot;
+
+      blaze::DynamicVector<double> a( 100UL );
+      blaze::DynamicMatrix<double> B( 10UL, 20UL );
+      blaze::CompressedVector<double> c( 100UL, 10UL );
+      blaze::CompressedMatrix<double> D( 10UL, 10UL, 20UL );
+
+      const blaze::MemoryStatistics stats( snapshot.statistics() );
+
+      if( stats.categoryAllocations[blaze::denseVectorMemory]  != 1UL ||
+          stats.categoryAllocations[blaze::denseMatrixMemory]  != 1UL ||
+          stats.categoryAllocations[blaze::sparseVectorMemory] != 1UL ||
+          stats.categoryAllocations[blaze::sparseMatrixMemory] == 0UL ||
+          stats.categoryAllocations[blaze::generalMemory]      != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid category allocations detected\n"
+             << " Details:\n"
+             << stats;
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( stats.categoryBytes[blaze::denseVectorMemory]  < 100UL*sizeof(double) ||
+          stats.categoryBytes[blaze::denseMatrixMemory]  < 200UL*sizeof(double) ||
+          stats.categoryBytes[blaze::sparseVectorMemory] < 10UL*sizeof(double) ||
+          stats.categoryBytes[blaze::sparseMatrixMemory] < 20UL*sizeof(double) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid category bytes detected\n"
+             << " Details:\n"
+             << stats;
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( stats.allocatedBytes != stats.currentBytes - before.currentBytes ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of bytes in use detected\n"
+             << " Details:\n"
+             << stats;
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const blaze::MemoryStatistics after( blaze::getMemoryStatistics() );
+
+   if( after.currentBytes != before.currentBytes ||
+       after.allocations - before.allocations != after.deallocations - before.deallocations ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unbalanced memory accounting detected\n"
+          << " Details:\n"
+          << "   Before:\n" << before
+          << "   After:\n" << after;
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the peak memory tracking.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the tracking of the peak memory usage and the resetPeakMemory() function.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AccountingTest::testPeak()
+{
+   test_ = "Peak memory usage";
+
+   blaze::resetPeakMemory();
+
+   const size_t base( blaze::getMemoryStatistics().currentBytes );
+
+   {
+      blaze::DynamicMatrix<double> A( 100UL, 100UL );
+   }
+
+   const blaze::MemoryStatistics stats( blaze::getMemoryStatistics() );
+
+   if( stats.currentBytes != base || stats.peakBytes < base + 10000UL*sizeof(double) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid peak memory usage detected\n"
+          << " Details:\n"
+          << stats;
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::resetPeakMemory();
+
+   if( blaze::getMemoryStatistics().peakBytes != base ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resetting the peak memory usage failed\n"
+          << " Details:\n"
+          << blaze::getMemoryStatistics();
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested memory snapshots.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the peak memory usage of nested memory snapshots. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void AccountingTest::testSnapshot()
+{
+   test_ = "Nested memory snapshots";
+
+   const size_t base( blaze::getMemoryStatistics().currentBytes );
+
+   blaze::MemorySnapshot outer;
+
+   {
+      blaze::DynamicVector<double> a( 1000UL );
+   }
+
+   {
+      blaze::MemorySnapshot inner;
+
+      {
+         blaze::DynamicVector<double> b( 100UL );
+      }
+
+      const blaze::MemoryStatistics stats( inner.statistics() );
+
+      if( stats.allocations != 1UL || stats.deallocations != 1UL ||
+          stats.peakBytes < base + 100UL*sizeof(double) ||
+          stats.peakBytes >= base + 1000UL*sizeof(double) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid inner snapshot detected\n"
+             << " Details:\n"
+             << stats;
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   const blaze::MemoryStatistics stats( outer.statistics() );
+
+   if( stats.allocations != 2UL || stats.deallocations != 2UL ||
+       stats.peakBytes < base + 1000UL*sizeof(double) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid outer snapshot detected\n"
+          << " Details:\n"
+          << stats;
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the accounting of scratch arena allocations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the accounting of the memory taken from the per-thread scratch arena.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AccountingTest::testScratchArena()
+{
+   test_ = "Scratch arena accounting";
+
+   blaze::MemorySnapshot snapshot;
+
+   {
+      blaze::ScratchScope scope;
+
+      blaze::DynamicVector<double> a( 100UL );
+      blaze::DynamicMatrix<double> B( 10UL, 10UL );
+   }
+
+   const blaze::MemoryStatistics stats( snapshot.statistics() );
+
+   if( stats.allocations != 2UL || stats.deallocations != 2UL ||
+       stats.allocatedBytes != stats.deallocatedBytes ||
+       stats.allocatedBytes < 200UL*sizeof(double) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid scratch arena accounting detected\n"
+          << " Details:\n"
+          << stats;
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace memory
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running memory accounting test..." << std::endl;
+
+   try
+   {
+      RUN_MEMORY_ACCOUNTING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during memory accounting test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -41,11 +41,16 @@
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/PoolMemoryResource.h>
+#include <blaze/util/ScratchArena.h>
 #include <blaze/util/typetraits/AlignmentOf.h>
 #include <blazetest/utiltest/memory/OperationTest.h>
 #include <blazetest/utiltest/AlignedResource.h>
+#include <blazetest/utiltest/CountingResource.h>
 #include <blazetest/utiltest/ThrowingResource.h>
 
 
@@ -71,6 +76,8 @@ OperationTest::OperationTest()
    testBuiltinTypes();
    testClassTypes();
    testNullPointer();
+   testScratchArena();
+   testMemoryResource();
 }
 //*************************************************************************************************
 
@@ -286,6 +293,288 @@ void OperationTest::testNullPointer()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the allocation from the per-thread scratch arena.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the allocation and deallocation of memory within the scope
+// of a ScratchScope. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testScratchArena()
+{
+   test_ = "Scratch arena";
+
+   if( blaze::scratchArenaCapacity == 0UL )
+      return;
+
+   const size_t alignment( blaze::AlignmentOf<double>::value );
+
+   double* escaped( nullptr );
+
+   {
+      blaze::ScratchScope scope;
+
+      if( !blaze::ScratchArena::isActive() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inactive scratch arena detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Reuse of the top-most memory block
+      double* const a( blaze::allocate<double>( number ) );
+
+      if( reinterpret_cast<size_t>( a ) % alignment != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment detected\n"
+             << " Details:\n"
+             << "   Expected alignment: " << alignment << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::deallocate( a );
+
+      double* const b( blaze::allocate<double>( number ) );
+
+      if( b != a ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Top-most memory block is not reused\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Reuse of a memory block released out of order
+      double* const c( blaze::allocate<double>( 2UL*number ) );
+      double* const d( blaze::allocate<double>( number ) );
+
+      blaze::deallocate( c );
+
+      double* const e( blaze::allocate<double>( number ) );
+
+      if( e != c ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Released memory block is not reused\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // User-specific class types
+      AlignedResource* const resources( blaze::allocate<AlignedResource>( number ) );
+
+      if( AlignedResource::getCount() != number ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of instances detected\n"
+             << " Details:\n"
+             << "   Current count : " << AlignedResource::getCount() << "\n"
+             << "   Expected count: " << number << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      blaze::deallocate( resources );
+      blaze::deallocate( e );
+      blaze::deallocate( d );
+
+      // Memory escaping the scope
+      escaped = blaze::allocate<double>( number );
+      blaze::deallocate( b );
+
+      for( size_t i=0UL; i<number; ++i ) {
+         escaped[i] = static_cast<double>( i );
+      }
+   }
+
+   if( blaze::ScratchArena::isActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Active scratch arena detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   double* const outside( blaze::allocate<double>( number ) );
+
+   for( size_t i=0UL; i<number; ++i ) {
+      outside[i] = 0.0;
+      if( escaped[i] != static_cast<double>( i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Escaped memory block has been overwritten\n"
+             << " Details:\n"
+             << "   Index: " << i << "\n"
+             << "   Value: " << escaped[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::deallocate( outside );
+   blaze::deallocate( escaped );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the allocation via custom memory resources.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the allocation and deallocation of memory via a custom
+// memory resource that is installed via the MemoryResourceScope class and the setMemoryResource()
+// function and of the huge page allocation of the SystemMemoryResource class. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testMemoryResource()
+{
+   // Allocation within a MemoryResourceScope
+   {
+      test_ = "MemoryResourceScope";
+
+      CountingResource resource;
+      blaze::DynamicMatrix<double> A;
+      blaze::CompressedMatrix<int> B;
+
+      {
+         blaze::MemoryResourceScope scope( resource );
+
+         if( blaze::getMemoryResource() != &resource ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Memory resource is not installed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::DynamicMatrix<double> C( 7UL, 5UL, 2.0 );
+         blaze::CompressedMatrix<int> D( 4UL, 6UL );
+         D(1,2) = 3;
+         D(3,5) = 4;
+
+         A = C * trans( C );
+         B = std::move( D );
+
+         char* const array( blaze::allocate<char>( number ) );
+
+         if( resource.allocations_ == 0UL || resource.allocations_ != resource.live_ + resource.deallocations_ ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Memory is not allocated from the memory resource\n"
+                << " Details:\n"
+                << "   Number of allocations  : " << resource.allocations_ << "\n"
+                << "   Number of deallocations: " << resource.deallocations_ << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         blaze::deallocate( array );
+      }
+
+      if( blaze::getMemoryResource() == &resource ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory resource is not uninstalled\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( A(0,0) != 20.0 || B(1,2) != 3 || B(3,5) != 4 || resource.live_ == 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid results after leaving the scope\n"
+             << " Details:\n"
+             << "   Live allocations: " << resource.live_ << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      A = blaze::DynamicMatrix<double>();
+      B = blaze::CompressedMatrix<int>();
+
+      if( resource.live_ != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory is not returned to the memory resource\n"
+             << " Details:\n"
+             << "   Live allocations: " << resource.live_ << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Allocation from a global PoolMemoryResource
+   {
+      test_ = "PoolMemoryResource";
+
+      blaze::PoolMemoryResource pool( 65536UL );
+      blaze::MemoryResource* const previous( blaze::setMemoryResource( &pool ) );
+
+      try {
+         blaze::DynamicMatrix<double> A( 10UL, 10UL, 1.0 );
+         blaze::DynamicMatrix<double> B( A * A );
+
+         if( pool.used() == 0UL || B(9,9) != 10.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Memory is not allocated from the pool\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         try {
+            blaze::DynamicMatrix<double> C( 100UL, 100UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Allocation beyond the capacity of the pool succeeded\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::bad_alloc& ) {}
+      }
+      catch( ... ) {
+         blaze::setMemoryResource( previous );
+         throw;
+      }
+
+      blaze::setMemoryResource( previous );
+
+      if( pool.used() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Memory is not returned to the pool\n"
+             << " Details:\n"
+             << "   Used bytes: " << pool.used() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Allocation via huge pages
+   {
+      test_ = "SystemMemoryResource (huge pages)";
+
+      const size_t size( 3UL*blaze::hugePageSize );
+
+      blaze::SystemMemoryResource resource( blaze::transparentHugePages, blaze::hugePageSize );
+      blaze::byte_t* const address( resource.allocate( size, 64UL ) );
+
+#if defined(__linux__)
+      if( reinterpret_cast<size_t>( address ) % blaze::hugePageSize != 0UL ) {
+         resource.deallocate( address, size, 64UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid alignment detected\n"
+             << " Details:\n"
+             << "   Expected alignment: " << blaze::hugePageSize << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+#endif
+
+      for( size_t i=0UL; i<size; i+=4096UL ) {
+         address[i] = blaze::byte_t( 1 );
+      }
+
+      resource.deallocate( address, size, 64UL );
+   }
+}
+//*************************************************************************************************
+
 } // namespace memory
 
 } // namespace utiltest
@@ -0,0 +1,335 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/partition/OperationTest.cpp
+//  \brief Source file for the partition operation test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/smp/Partition.h>
+#include <blazetest/utiltest/partition/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace partition {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   testUniformPartition();
+   testGuidedPartition();
+   testWeightedPartition();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the createUniformPartition() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the createUniformPartition() function for various range
+// sizes, numbers of blocks and alignments. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void OperationTest::testUniformPartition()
+{
+   test_ = "createUniformPartition()";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 16UL, 100UL, 1000UL } ) {
+      for( size_t blocks : { 1UL, 2UL, 3UL, 8UL, 12UL } ) {
+         for( size_t alignment : { 1UL, 4UL, 16UL } )
+         {
+            const blaze::Partition partition( blaze::createUniformPartition( n, blocks, alignment ) );
+
+            checkPartition( partition, n, alignment );
+            checkBlocks( partition, blocks );
+
+            for( size_t i=2UL; i+1UL<partition.size(); ++i ) {
+               if( partition[i] - partition[i-1UL] != partition[1UL] ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Blocks of different size detected\n"
+                      << " Details:\n"
+                      << "   Range size       = " << n << "\n"
+                      << "   Number of blocks = " << blocks << "\n"
+                      << "   Alignment        = " << alignment << "\n"
+                      << "   Block size       = " << partition[i] - partition[i-1UL] << "\n"
+                      << "   Expected size    = " << partition[1UL] << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the createGuidedPartition() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the createGuidedPartition() function for various range
+// sizes, numbers of threads, numbers of blocks per thread and alignments. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testGuidedPartition()
+{
+   test_ = "createGuidedPartition()";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 16UL, 100UL, 1000UL } ) {
+      for( size_t threads : { 1UL, 2UL, 4UL, 7UL } ) {
+         for( size_t blocksPerThread : { 1UL, 2UL, 4UL } ) {
+            for( size_t alignment : { 1UL, 4UL, 16UL } )
+            {
+               const blaze::Partition partition(
+                  blaze::createGuidedPartition( n, threads, blocksPerThread, alignment ) );
+
+               checkPartition( partition, n, alignment );
+
+               if( blocksPerThread == 1UL ) {
+                  checkBlocks( partition, threads );
+               }
+
+               for( size_t i=2UL; i+1UL<partition.size(); ++i ) {
+                  if( partition[i] - partition[i-1UL] > partition[i-1UL] - partition[i-2UL] ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Increasing block size detected\n"
+                         << " Details:\n"
+                         << "   Range size        = " << n << "\n"
+                         << "   Number of threads = " << threads << "\n"
+                         << "   Blocks per thread = " << blocksPerThread << "\n"
+                         << "   Alignment         = " << alignment << "\n"
+                         << "   Block index       = " << i-1UL << "\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the createWeightedPartition() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the createWeightedPartition() function for various range
+// sizes, numbers of blocks and alignments, both for increasing and decreasing costs. The cost
+// of each block must not exceed the equal share of the total cost by more than the cost of
+// \a alignment indices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::testWeightedPartition()
+{
+   test_ = "createWeightedPartition()";
+
+   for( size_t n : { 0UL, 1UL, 7UL, 16UL, 100UL, 1000UL } ) {
+      for( size_t blocks : { 1UL, 2UL, 3UL, 8UL, 12UL } ) {
+         for( size_t alignment : { 1UL, 4UL, 16UL } ) {
+            for( bool increasing : { true, false } )
+            {
+               const blaze::Partition partition(
+                  blaze::createWeightedPartition( n, blocks, alignment, increasing ) );
+
+               checkPartition( partition, n, alignment );
+               checkBlocks( partition, blocks );
+
+               // The cost of index i is i+1 for increasing and n-i for decreasing costs
+               const auto cost = [n,increasing]( size_t begin, size_t end ) {
+                  const size_t first( increasing ? begin+1UL : n-end+1UL );
+                  const size_t last ( increasing ? end       : n-begin   );
+                  return ( first + last ) * ( end - begin ) / 2UL;
+               };
+
+               const size_t share( cost( 0UL, n ) / blocks + alignment*n );
+
+               for( size_t i=1UL; i<partition.size(); ++i ) {
+                  if( cost( partition[i-1UL], partition[i] ) > share ) {
+                     std::ostringstream oss;
+                     oss << " Test: " << test_ << "\n"
+                         << " Error: Unbalanced partition detected\n"
+                         << " Details:\n"
+                         << "   Range size       = " << n << "\n"
+                         << "   Number of blocks = " << blocks << "\n"
+                         << "   Alignment        = " << alignment << "\n"
+                         << "   Increasing costs = " << increasing << "\n"
+                         << "   Block cost       = " << cost( partition[i-1UL], partition[i] ) << "\n"
+                         << "   Maximum cost     = " << share << "\n";
+                     throw std::runtime_error( oss.str() );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the coverage and the alignment of the given partition.
+//
+// \param partition The partition to be checked.
+// \param n The size of the partitioned index range \f$[0..n)\f$.
+// \param alignment The expected alignment of all block boundaries.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the given partition covers the complete index range \f$[0..n)\f$
+// by means of non-empty, consecutive blocks and that all inner block boundaries are multiples
+// of the given alignment. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void OperationTest::checkPartition( const blaze::Partition& partition, size_t n, size_t alignment ) const
+{
+   bool valid( !partition.empty() && partition.front() == 0UL && partition.back() == n );
+
+   for( size_t i=1UL; valid && i<partition.size(); ++i ) {
+      if( partition[i-1UL] >= partition[i] ||
+          ( i+1UL < partition.size() && partition[i] % alignment != 0UL ) ) {
+         valid = false;
+      }
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid partition detected\n"
+          << " Details:\n"
+          << "   Range size = " << n << "\n"
+          << "   Alignment  = " << alignment << "\n"
+          << "   Partition  = (";
+      for( size_t boundary : partition ) {
+         oss << " " << boundary;
+      }
+      oss << " )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of blocks of the given partition.
+//
+// \param partition The partition to be checked.
+// \param maxBlocks The maximum number of blocks.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the given partition consists of at most \a maxBlocks blocks. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::checkBlocks( const blaze::Partition& partition, size_t maxBlocks ) const
+{
+   if( partition.size() > maxBlocks+1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of blocks detected\n"
+          << " Details:\n"
+          << "   Number of blocks         : " << partition.size()-1UL << "\n"
+          << "   Expected number of blocks: " << maxBlocks << " or less\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace partition
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running partition operation test..." << std::endl;
+
+   try
+   {
+      RUN_PARTITION_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during partition operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
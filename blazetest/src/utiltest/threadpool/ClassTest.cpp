@@ -0,0 +1,484 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testBlockingMode();
+   testSpinMode();
+   testWait();
+   testConcurrentWait();
+   testPolling();
+   testShrink();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the execution of tasks in the blocking mode.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a number of tasks on a thread pool with disabled polling and checks
+// that all tasks have been executed after the call to the wait() function. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBlockingMode()
+{
+   test_ = "Blocking mode";
+
+   Pool pool( 3UL );
+
+   if( pool.size() != 3UL || pool.spinCount() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread pool configuration\n"
+          << " Details:\n"
+          << "   Number of threads = " << pool.size() << "\n"
+          << "   Spin count        = " << pool.spinCount() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::atomic<size_t> counter( 0UL );
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      pool.schedule( [&counter]() { ++counter; } );
+   }
+   pool.wait();
+
+   if( counter != 100UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Result          = " << counter << "\n"
+          << "   Expected result = 100\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the execution of tasks in the hybrid spin-then-block mode.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly schedules a number of tasks on a thread pool with enabled polling
+// and checks that all tasks have been executed after every call to the wait() function. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSpinMode()
+{
+   test_ = "Spin mode";
+
+   Pool pool( 3UL, 10000UL );
+
+   if( pool.size() != 3UL || pool.spinCount() != 10000UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread pool configuration\n"
+          << " Details:\n"
+          << "   Number of threads = " << pool.size() << "\n"
+          << "   Spin count        = " << pool.spinCount() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t round=0UL; round<10UL; ++round )
+   {
+      std::atomic<size_t> counter( 0UL );
+
+      for( size_t i=0UL; i<100UL; ++i ) {
+         pool.schedule( [&counter]() { ++counter; } );
+      }
+      pool.wait();
+
+      if( counter != 100UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of executed tasks\n"
+             << " Details:\n"
+             << "   Round           = " << round << "\n"
+             << "   Result          = " << counter << "\n"
+             << "   Expected result = 100\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the participation of the calling thread in the wait() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that in the hybrid spin-then-block mode the wait() function executes the
+// remaining tasks in the calling thread. The single thread of the pool is occupied by a task
+// that is only released by a second task. Therefore the second task can only be executed by
+// the thread calling the wait() function. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testWait()
+{
+   test_ = "Participation of the calling thread in wait()";
+
+   Pool pool( 1UL, 10000UL );
+
+   std::atomic<bool> started( false );
+   std::atomic<bool> released( false );
+   std::atomic<bool> timeout( false );
+   std::thread::id id;
+
+   pool.schedule( [this,&started,&released,&timeout]() {
+      started = true;
+      timeout = !waitFor( released );
+   } );
+
+   if( !waitFor( started ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scheduled task has not been started\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   pool.schedule( [&released,&id]() {
+      id = std::this_thread::get_id();
+      released = true;
+   } );
+   pool.wait();
+
+   if( timeout || id != std::this_thread::get_id() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Remaining task has not been executed by the calling thread\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of concurrent calls to the wait() function in several threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the wait() function does not return before the completion of all
+// tasks, including the tasks executed by other threads waiting concurrently. First, a task of
+// the main thread is executed by a second thread waiting for the completion of the tasks. The
+// wait() function of the main thread must not return before this task has been completed.
+// Second, two threads concurrently schedule tasks and wait for their completion. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConcurrentWait()
+{
+   test_ = "Concurrent calls to wait()";
+
+   // Waiting for a task executed by another waiting thread
+   {
+      Pool pool( 1UL, 10000UL );
+
+      std::atomic<bool> started( false );
+      std::atomic<bool> released( false );
+      std::atomic<bool> stolen( false );
+      std::atomic<bool> completed( false );
+
+      pool.schedule( [this,&started,&released]() {
+         started = true;
+         waitFor( released );
+      } );
+
+      if( !waitFor( started ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scheduled task has not been started\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      pool.schedule( [&stolen,&completed]() {
+         stolen = true;
+         std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+         completed = true;
+      } );
+
+      std::thread thread( [&pool]() { pool.wait(); } );
+
+      const bool executed( waitFor( stolen ) );
+      released = true;
+      pool.wait();
+      const bool waited( completed );
+
+      thread.join();
+
+      if( !executed || !waited ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: wait() returned before the completion of all tasks\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Scheduling and waiting in two threads at the same time
+   {
+      Pool pool( 2UL, 10000UL );
+
+      std::string errors[2];
+
+      auto compute = [&pool]( std::string& error )
+      {
+         for( size_t round=0UL; round<20UL; ++round )
+         {
+            std::atomic<size_t> counter( 0UL );
+
+            for( size_t i=0UL; i<50UL; ++i ) {
+               pool.schedule( [&counter]() {
+                  std::this_thread::yield();
+                  ++counter;
+               } );
+            }
+            pool.wait();
+
+            if( counter != 50UL ) {
+               std::ostringstream oss;
+               oss << " Error: Invalid number of executed tasks\n"
+                   << " Details:\n"
+                   << "   Round           = " << round << "\n"
+                   << "   Result          = " << counter << "\n"
+                   << "   Expected result = 50\n";
+               error = oss.str();
+
+               pool.wait();
+               return;
+            }
+         }
+      };
+
+      std::thread thread1( compute, std::ref( errors[0] ) );
+      std::thread thread2( compute, std::ref( errors[1] ) );
+
+      thread1.join();
+      thread2.join();
+
+      for( const std::string& error : errors ) {
+         if( !error.empty() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n" << error;
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of a task while the threads of the pool are polling.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a task while the idle thread of the pool is polling for new tasks
+// and checks that the task is picked up by the thread of the pool without calling the wait()
+// function. Afterwards the pool is destroyed while its thread is still polling. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPolling()
+{
+   test_ = "Scheduling while polling";
+
+   Pool pool( 1UL, 100000000UL );
+
+   std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+
+   std::atomic<bool> executed( false );
+   std::thread::id id( std::this_thread::get_id() );
+
+   pool.schedule( [&executed,&id]() {
+      id = std::this_thread::get_id();
+      executed = true;
+   } );
+
+   if( !waitFor( executed ) || id == std::this_thread::get_id() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scheduled task has not been executed by the thread pool\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of shrinking a thread pool while its threads are polling.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function shrinks a thread pool while its idle threads are polling for new tasks and
+// destroys the pool afterwards. Both the resize() function and the destructor must not wait
+// for the polling threads to block. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testShrink()
+{
+   test_ = "Shrinking while polling";
+
+   Pool pool( 2UL, 100000000UL );
+
+   std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+
+   pool.resize( 1UL, true );
+
+   if( pool.size() != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads\n"
+          << " Details:\n"
+          << "   Result          = " << pool.size() << "\n"
+          << "   Expected result = 1\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Waiting for the given flag to be set.
+//
+// \param flag The flag to wait for.
+// \return \a true in case the flag has been set, \a false in case of a timeout.
+//
+// This function waits at most 10 seconds for the given flag to be set. The timeout prevents
+// the test from hanging in case of an error.
+*/
+bool ClassTest::waitFor( const std::atomic<bool>& flag ) const
+{
+   const auto deadline( std::chrono::steady_clock::now() + std::chrono::seconds( 10 ) );
+
+   while( !flag ) {
+      if( std::chrono::steady_clock::now() > deadline )
+         return false;
+      std::this_thread::yield();
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************